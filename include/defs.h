@@ -8,6 +8,7 @@ struct spinlock;
 struct stat;
 struct superblock;
 struct msg;
+struct ipcop;
 
 #define unlikely(x) __builtin_expect(x, 0)
 #define likely(x) __builtin_expect(x, 1)
@@ -68,6 +69,10 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+int             kref(char*);
+char*           khugealloc(void);
+void            khugefree(char*);
+int             khugecount(void);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -79,6 +84,7 @@ int             cpunum(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -113,6 +119,7 @@ struct proc*    copyproc(struct proc*);
 void            exit(void);
 int             fork(void);
 int             growproc(int);
+int             sethuge(int);
 int             kill(int);
 void            pinit(void);
 void            procdump(void);
@@ -126,6 +133,28 @@ void            yield(void);
 int             send(int,struct msg* );
 int             send_recv(int,struct msg* );
 int             recv(int,struct msg* );
+int             call(int,struct msg* );
+int             reply_recv(int,struct msg*,int);
+int             sendx(int,struct msg*,int);
+int             ring_attach(int);
+int             notify(int,int);
+int             nfy_wait(int);
+int             send_timed(int,struct msg*,int);
+int             recv_timed(int,struct msg*,int);
+void            ipc_expire(void);
+int             set_add(int,int);
+int             set_del(int);
+int             recv_any(int,struct msg*,int*);
+int             ep_create(void);
+int             ep_close(int);
+int             ipc_affinity(int,int);
+int             setprio(int);
+int             ipc_batch(struct ipcop*,int);
+int             ipc_send(int,struct msg*);
+int             ipc_recv(int,struct msg*);
+int             ipc_send_recv(int,struct msg*);
+int             ipc_call(int,struct msg*);
+int             ipc_reply_recv(int,struct msg*,int);
 // swtch.S
 void            swtch(struct context**, struct context*);
 
@@ -179,12 +208,19 @@ void            kvmalloc(void);
 void            vmenable(void);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
-int             allocuvm(pde_t*, uint, uint);
+int             allocuvm(pde_t*, uint, uint, int);
 int             deallocuvm(pde_t*, uintp, uintp);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
+int             shareuvm(pde_t*, uintp, uintp, pde_t*, uintp, int);
+int             mapshared(pde_t*, uintp, char*);
+uintp           mapbase(pde_t*, uintp);
+int             mapvdso(pde_t*, char*);
+void            vdsotick(uint);
+void            loadcr3(struct proc*);
+void            tlbinval(struct proc*, uintp, uintp);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
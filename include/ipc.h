@@ -0,0 +1,48 @@
+// sendx() flags: what travels with the message besides its words.
+#define SX_MAP    0x1   // share the regs[1] pages at regs[0] with the receiver
+#define SX_GRANT  0x2   // move them; the range must end at the sender's break
+#define SX_CALL   0x4   // wait for a reply, as call() does
+#define SX_FD     0x8   // share the open file regs[SX_FDREG]
+#define SX_EP     0x10  // share the endpoint handle regs[SX_EPREG]
+
+#define SX_FDREG  7
+#define SX_EPREG  6
+
+// Errors from send_timed() and recv_timed().
+#define IPC_WOULDBLOCK (-2)  // timeout 0 and no partner waiting
+#define IPC_TIMEOUT    (-3)  // no partner within the timeout
+
+#define try_send(ch, m) send_timed(ch, m, 0)
+#define try_recv(ch, m) recv_timed(ch, m, 0)
+
+// One operation in an ipc_batch() vector.  arg is the timeout for
+// IPCOP_SEND and IPCOP_RECV (negative: forever) and the reply token
+// for IPCOP_REPLYRECV; ret receives what the single call would return.
+#define IPCOP_SEND      1
+#define IPCOP_RECV      2
+#define IPCOP_SENDRECV  3
+#define IPCOP_CALL      4
+#define IPCOP_REPLYRECV 5
+
+#define IPC_MAXBATCH  64
+
+struct ipcop {
+  int op;
+  int ch;
+  int arg;
+  int ret;
+  struct msg m;
+};
+
+// Message ring shared by ring_attach() between one producer and
+// one consumer on an endpoint.  head and tail count messages ever
+// taken and put; each sits in its own cache line.
+#define RING_SLOTS 32
+
+struct ring {
+  volatile uint head;
+  char pad0[60];
+  volatile uint tail;
+  char pad1[60];
+  struct msg slot[RING_SLOTS];
+};
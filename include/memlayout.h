@@ -13,6 +13,11 @@
 #define DEVBASE  0xFE000000         // First device virtual address
 #endif
 #define KERNLINK (KERNBASE+EXTMEM)  // Address where kernel is linked
+#if X64
+#define USERTOP  0x3fa00000         // End of user memory (pgdir[510] up is reserved)
+#else
+#define USERTOP  KERNBASE           // End of user memory
+#endif
 
 #ifndef __ASSEMBLER__
 
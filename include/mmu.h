@@ -38,7 +38,8 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
-#define CR4_PCIDE       1ul<<17ul
+#define CR4_PGE         0x00000080      // Global pages
+#define CR4_PCIDE       (1ul<<17)       // Process-context identifiers
 
 #define SEG_KCODE 1  // kernel code
 #define SEG_KDATA 2  // kernel data+stack
@@ -144,6 +145,10 @@ struct segdesc {
 #define PGROUNDUP(sz)  (((sz)+((uintp)PGSIZE-1)) & ~((uintp)(PGSIZE-1)))
 #define PGROUNDDOWN(a) (((a)) & ~((uintp)(PGSIZE-1)))
 
+#define HUGEPGSIZE     ((uintp)1 << PDXSHIFT)  // bytes mapped by a PTE_PS entry
+#define HUGEPGROUNDDOWN(a) (((a)) & ~(HUGEPGSIZE-1))
+#define HUGEPGROUNDUP(a) (((a)+HUGEPGSIZE-1) & ~(HUGEPGSIZE-1))
+
 // Page table/directory entry flags.
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
@@ -153,7 +158,9 @@ struct segdesc {
 #define PTE_A           0x020   // Accessed
 #define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_G           0x100   // Global: survives CR3 loads (CR4.PGE)
 #define PTE_MBZ         0x180   // Bits must be zero
+#define PTE_SHARED      0x200   // Shared with another page table (software)
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uintp)(pte) & ~0xFFF)
@@ -1,6 +1,6 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
-#define NCPU          1  // maximum number of CPUs
+#define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NBUF         10  // size of disk block cache
@@ -9,5 +9,10 @@
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define LOGSIZE      10  // max data sectors in on-disk log
-#define NENDS        16
-#define NPCIDS        7
\ No newline at end of file
+#define NENDS        16  // well-known IPC endpoints, inherited from init
+#define NENDPOINT   512  // IPC endpoints per system
+#define NHANDLE     128  // IPC endpoint handles per process
+#define NHUGEPG      16  // large pages set aside for user heaps (see sethuge)
+#define NPCIDS     4095  // PCIDs for user address spaces; 0 is the kernel's
+#define NPRIO         8  // scheduling priorities
+#define QUANTUM       2  // timer ticks a process runs before yielding
\ No newline at end of file
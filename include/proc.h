@@ -1,6 +1,13 @@
 // Segments in proc->gdt.
 #define NSEGS     7
 
+// Runnable processes queued on a CPU, one FIFO per priority.
+struct runq {
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  uint mask;                   // bit i set if head[i] is non-empty
+};
+
 // Per-CPU state
 struct cpu {
   uchar id;                    // index into cpus[] below
@@ -11,6 +18,9 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
+  unsigned long long pcidgen;  // Current PCID generation (see loadcr3)
+  uint pcidnext;               // Next PCID to hand out in it
+  struct runq runq;            // Processes waiting to run here
 
   // Cpu-local storage variables; see below
 #if X64
@@ -31,10 +41,12 @@ extern int ncpu;
 // %gs segment register so that %gs refers to the memory
 // holding those two variables in the local cpu's struct cpu.
 // This is similar to how thread-local variables are implemented
-// in thread libraries such as Linux pthreads.
+// in thread libraries such as Linux pthreads.  On x86-64 they are
+// thread-local variables proper, addressed through %fs, whose base
+// seginit points into the CPU's local storage page.
 #if X64
-extern  struct cpu *cpu;
-extern  struct proc *proc;
+extern __thread struct cpu *cpu;
+extern __thread struct proc *proc;
 #else
 extern struct cpu *cpu asm("%gs:0");       // &cpus[cpunum()]
 extern struct proc *proc asm("%gs:4");     // cpus[cpunum()].proc
@@ -90,11 +102,45 @@ struct proc {
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct endpoint *ipcends[NHANDLE]; // IPC endpoint handles
   char name[16];               // Process name (debugging)
-  unsigned long long pcid;
+  unsigned long long pcid[NCPU]; // PCID on each CPU (see loadcr3)
+  struct proc *ipcnext;        // Next in endpoint queue
+  struct ipcq *ipcq;           // Endpoint queue we are on, if any
+  uint ipcdeadline;            // Tick at which an IPC_TIMED wait ends
+  int ipcchan;                 // Channel our last message was sent on
+  int cpuaff;                  // CPU we are pinned to, or -1
+  int ipcspin;                 // Iterations to spin before blocking in recv
+  int prio;                    // Scheduling priority, 0 most urgent
+  int slice;                   // Ticks left in our quantum
+  struct proc *sc;             // Whose quantum and priority we run on
+  int hugepg;                  // Grow the heap in large pages (sethuge)
+  char *vproc;                 // Page mapped at VPROC (see vdso.h)
+  struct proc *runnext;        // Next on a CPU's run queue
+  int onrunq;                  // On a run queue (possibly no longer runnable)
+  struct proc *sleepnext;      // Next on chan's sleep queue
+  struct proc **sleepprev;     // Link pointing at us on that queue
+  int ipcflags;                // IPC_* flags while blocked
+  int ipcret;                  // Result for a blocked IPC call
+  int ipcitems;                // SX_* items riding on ipcmsg
+  struct proc *ipcreply;       // Server that owes us a reply
+  uint ipcgen;                 // Number of our current call(), for its token
+  struct msg *ipcmsg;          // Message in flight: ipcbuf or a register frame
+  struct msg ipcbuf __attribute__ ((aligned (64))); // Staged copy of a user message
 };
-extern unsigned long long pcid_counter;
-#define PCID_EPOCH(count) count/NPCIDS
+
+// ipcflags
+#define IPC_RECV  0x1          // After sending, wait for a message
+#define IPC_CALL  0x2          // After sending, wait for a reply
+#define IPC_TIMED 0x4          // Give up at ipcdeadline
+
+// ipcitems once the items are delivered
+#define IPC_NOMAP 0x100        // SX_MAP/SX_GRANT pages could not be mapped
+// Each proc->pcid[] entry holds a PCID of that CPU in its low
+// PCID_BITS and the generation it was handed out in above them;
+// 0 means none.
+#define PCID_BITS 12
+#define PCID_MASK ((1ull<<PCID_BITS)-1)
 #define CR3_ENTRY_INVALIDATE(pcid, address) ((unsigned long long)(pcid)|(unsigned long long)(address))&~(1ul<<63ul)
 #define CR3_ENTRY_PRESERVE(pcid, address) ((unsigned long long)(pcid)|(unsigned long long)(address))|(1ul<<63ul)
 //#define CR3_ENTRY_PRESERVE CR3_ENTRY_INVALIDATE
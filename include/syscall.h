@@ -25,4 +25,29 @@
 #define SYS_send_recv 24
 #define SYS_cr3_test 25
 #define SYS_cr3_kernel 26
-#define SYS_null_call 27
\ No newline at end of file
+#define SYS_null_call 27
+#define SYS_call   28
+#define SYS_reply_recv 29
+#define SYS_send_reg 30
+#define SYS_recv_reg 31
+#define SYS_send_recv_reg 32
+#define SYS_call_reg 33
+#define SYS_reply_recv_reg 34
+#define SYS_sendx  35
+#define SYS_ring_attach 36
+#define SYS_notify 37
+#define SYS_nfy_wait 38
+#define SYS_send_timed 39
+#define SYS_recv_timed 40
+#define SYS_set_add 41
+#define SYS_set_del 42
+#define SYS_recv_any 43
+#define SYS_ep_create 44
+#define SYS_ep_close 45
+#define SYS_ipc_affinity 46
+#define SYS_setprio 47
+#define SYS_ipc_batch 48
+#define SYS_sethuge 49
+#define SYS_cr3_switch 50
+
+#define NSYSCALL 51  // size of syscalls_fast[]
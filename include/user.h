@@ -1,5 +1,8 @@
 struct stat;
-struct msg;
+struct ipcop;
+struct msg{
+  unsigned long long regs[8];
+};
 // system calls
 int fork(void);
 int exit(void) __attribute__((noreturn));
@@ -18,13 +21,33 @@ int link(char*, char*);
 int mkdir(char*);
 int chdir(char*);
 int dup(int);
-int getpid(void);
 char* sbrk(int);
 int sleep(int);
-int uptime(void);
 int send(int,  struct msg*);
 int recv(int,  struct msg*);
 int send_recv(int, struct msg*);
+int call(int, struct msg*);
+int reply_recv(int, struct msg*, int);
+int send_reg(int, struct msg*);
+int recv_reg(int, struct msg*);
+int send_recv_reg(int, struct msg*);
+int call_reg(int, struct msg*);
+int reply_recv_reg(int, struct msg*, int);
+int sendx(int, struct msg*, int);
+int ring_attach(int);
+int notify(int, int);
+int nfy_wait(int);
+int send_timed(int, struct msg*, int);
+int recv_timed(int, struct msg*, int);
+int set_add(int, int);
+int set_del(int);
+int recv_any(int, struct msg*, int*);
+int ep_create(void);
+int ep_close(int);
+int ipc_affinity(int, int);
+int setprio(int);
+int ipc_batch(struct ipcop*, int);
+int sethuge(int);
 // ulib.c
 int stat(char*, struct stat*);
 char* strcpy(char*, char*);
@@ -40,4 +63,15 @@ void free(void*);
 int atoi(const char*);
 int cr3_test(void);
 int cr3_kernel(unsigned long long);
-int null_call(void);
\ No newline at end of file
+int cr3_switch(int);
+int null_call(void);
+
+// vdso.c
+int getpid(void);
+int uptime(void);
+unsigned long long tscticks(void);
+
+// ring.c
+struct ring;
+int ring_send(int, struct ring*, struct msg*);
+int ring_recv(int, struct ring*, struct msg*);
\ No newline at end of file
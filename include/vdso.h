@@ -0,0 +1,15 @@
+// Read-only pages the kernel maps just above user memory in every
+// address space, so that user code can read a few values without
+// a system call (see ulib/vdso.c).  Include memlayout.h first.
+
+#define VDSO   USERTOP           // struct vdso, shared by everyone
+#define VPROC  (USERTOP + 4096)  // struct vproc, one per process
+
+struct vdso {
+  volatile uint ticks;                   // timer ticks since boot
+  volatile unsigned long long tscticks;  // TSC cycles per tick, 0 until calibrated
+};
+
+struct vproc {
+  int pid;
+};
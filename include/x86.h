@@ -105,6 +105,12 @@ readeflags(void)
   return eflags;
 }
 
+static inline void
+loadfs(ushort v)
+{
+  asm volatile("movw %0, %%fs" : : "r" (v));
+}
+
 static inline void
 loadgs(ushort v)
 {
@@ -129,6 +135,12 @@ hlt(void)
   asm volatile("hlt");
 }
 
+static inline void
+pause(void)
+{
+  asm volatile("pause" : : : "memory");
+}
+
 static inline uint
 xchg(volatile uint *addr, uintp newval)
 {
@@ -155,6 +167,47 @@ lcr3(uintp val)
 {
   asm volatile("mov %0,%%cr3" : : "r" (val));
 }
+
+static inline unsigned long long
+rdtsc(void)
+{
+  uint lo, hi;
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((unsigned long long)hi << 32) | lo;
+}
+
+static inline uintp
+rcr4(void)
+{
+  uintp val;
+  asm volatile("mov %%cr4,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+lcr4(uintp val)
+{
+  asm volatile("mov %0,%%cr4" : : "r" (val));
+}
+
+static inline void
+cpuid(uint leaf, uint sub, uint *a, uint *b, uint *c, uint *d)
+{
+  asm volatile("cpuid" : "=a" (*a), "=b" (*b), "=c" (*c), "=d" (*d)
+               : "a" (leaf), "c" (sub));
+}
+
+// INVPCID types
+#define INVPCID_ADDR 0   // one address in one PCID
+#define INVPCID_CTX  1   // all of one PCID but global pages
+#define INVPCID_ALL  2   // everything, global pages included
+
+static inline void
+invpcid(uintp type, uintp pcid, uintp addr)
+{
+  struct { unsigned long long pcid, addr; } desc = { pcid, addr };
+  asm volatile("invpcid %0, %1" : : "m" (desc), "r" (type) : "memory");
+}
 #ifdef X64
 static inline void rdmsr(uint msr, unsigned long long * bits)
 {
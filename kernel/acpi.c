@@ -90,6 +90,8 @@ static int acpi_config_smp(struct acpi_madt *madt) {
         break;
       if (!(lapic->flags & APIC_LAPIC_ENABLED))
         break;
+      if (ncpu == NCPU)
+        break;
       cprintf("acpi: cpu#%d apicid %d\n", ncpu, lapic->apic_id);
       cpus[ncpu].id = ncpu;
       cpus[ncpu].apicid = lapic->apic_id;
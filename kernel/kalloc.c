@@ -1,6 +1,7 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, and large pages
+// for user heaps from a pool set aside at boot.
 
 #include "types.h"
 #include "defs.h"
@@ -20,6 +21,9 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  struct run *hugelist;       // free large pages
+  int nhuge;                  // pages on hugelist
+  uchar ref[PHYSTOP/PGSIZE];  // Page tables mapping each page (see kref)
 } kmem;
 
 // Initialization happens in two phases.
@@ -37,10 +41,18 @@ kinit1(void *vstart, void *vend)
   freerange(vstart, vend);
 }
 
+// kinit2() sets the top NHUGEPG large pages aside for khugealloc(),
+// since contiguous memory cannot be found on the free list later.
+// kalloc() breaks them up if it runs out of small pages first.
 void
 kinit2(void *vstart, void *vend)
 {
-  freerange(vstart, vend);
+  char *p;
+
+  p = (char*)HUGEPGROUNDDOWN((uintp)vend) - NHUGEPG*HUGEPGSIZE;
+  freerange(vstart, p);
+  for(; p + HUGEPGSIZE <= (char*)vend; p += HUGEPGSIZE)
+    khugefree(p);
   kmem.use_lock = 1;
 }
 
@@ -58,6 +70,7 @@ freerange(void *vstart, void *vend)
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
+// A page shared with kref() is only freed by its last user.
 void
 kfree(char *v)
 {
@@ -66,11 +79,19 @@ kfree(char *v)
   if((uintp)v % PGSIZE || v < end || v2p(v) >= PHYSTOP)
     panic("kfree");
 
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(kmem.ref[v2p(v) / PGSIZE] > 1){
+    kmem.ref[v2p(v) / PGSIZE]--;
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return;
+  }
+  kmem.ref[v2p(v) / PGSIZE] = 0;
+
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
@@ -85,15 +106,99 @@ char*
 kalloc(void)
 {
   struct run *r;
+  char *p;
 
   if(kmem.use_lock)
     acquire(&kmem.lock);
+  if(kmem.freelist == 0 && kmem.hugelist){
+    // Out of small pages: give up a large one to the free list.
+    p = (char*)kmem.hugelist;
+    kmem.hugelist = kmem.hugelist->next;
+    kmem.nhuge--;
+    for(r = (struct run*)(p + HUGEPGSIZE); (char*)r > p; ){
+      r = (struct run*)((char*)r - PGSIZE);
+      r->next = kmem.freelist;
+      kmem.freelist = r;
+    }
+  }
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.ref[v2p(r) / PGSIZE] = 1;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
   //cprintf("kalloc:%x\n", r); 
   return (char*)r;
 }
 
+
+// Take another reference to the page at v, which is about
+// to be mapped into a second page table.  Returns 0, or -1 if
+// the page already has as many references as the count holds.
+int
+kref(char *v)
+{
+  if((uintp)v % PGSIZE || v < end || v2p(v) >= PHYSTOP)
+    panic("kref");
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(kmem.ref[v2p(v) / PGSIZE] == 0)
+    panic("kref: count");
+  if(kmem.ref[v2p(v) / PGSIZE] == 255){
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return -1;
+  }
+  kmem.ref[v2p(v) / PGSIZE]++;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return 0;
+}
+
+// Allocate one physically contiguous HUGEPGSIZE page.
+// Returns 0 if the pool is empty.
+char*
+khugealloc(void)
+{
+  struct run *r;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  r = kmem.hugelist;
+  if(r){
+    kmem.hugelist = r->next;
+    kmem.nhuge--;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return (char*)r;
+}
+
+// Return a page from khugealloc() to the pool.
+void
+khugefree(char *v)
+{
+  struct run *r;
+
+  if((uintp)v % HUGEPGSIZE || v < end || v2p(v) >= PHYSTOP)
+    panic("khugefree");
+
+  memset(v, 1, HUGEPGSIZE);
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  r = (struct run*)v;
+  r->next = kmem.hugelist;
+  kmem.hugelist = r;
+  kmem.nhuge++;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Number of large pages left in the pool.
+int
+khugecount(void)
+{
+  return kmem.nhuge;
+}
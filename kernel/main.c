@@ -38,8 +38,8 @@ main(void)
   uartearlyinit();
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
-  //if (acpiinit()) // try to use acpi for machine info
-  //  mpinit();      // otherwise use bios MP tables
+  if (acpiinit()) // try to use acpi for machine info
+    mpinit();      // otherwise use bios MP tables
   lapicinit();
   seginit();       // set up segments
   
@@ -56,9 +56,8 @@ main(void)
   ideinit();       // disk
   if(!ismp)
     timerinit();   // uniprocessor timer
-  //startothers();   // start other processors
+  startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
-  syscallinit();
   userinit();      // first user process
   // Finish setting up this processor in mpmain.
   mpmain();
@@ -80,10 +79,9 @@ mpmain(void)
 {
   cprintf("cpu%d: starting\n", cpu->id);
   idtinit();       // load idt register
+  syscallinit();   // syscall instruction MSRs are per CPU
   xchg(&cpu->started, 1); // tell startothers() we're up
-  asm volatile("movq %%cr4, %%rax\n\t"
-               "bts $17, %%rax\n\t"
-               "movq %%rax, %%cr4":::"rax");
+  lcr4(rcr4() | CR4_PCIDE | CR4_PGE);  // PCIDs and global kernel pages
   scheduler();     // start running processes
 }
 
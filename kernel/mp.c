@@ -106,8 +106,10 @@ mpinit(void)
   struct mpioapic *ioapic;
 
   bcpu = &cpus[0];
-  if((conf = mpconfig(&mp)) == 0)
+  if((conf = mpconfig(&mp)) == 0){
+    ncpu = 1;
     return;
+  }
   ismp = 1;
   lapic = IO2V((uintp)conf->lapicaddr);
   for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
@@ -115,11 +117,13 @@ mpinit(void)
     case MPPROC:
       proc = (struct mpproc*)p;
       cprintf("mpinit ncpu=%d apicid=%d\n", ncpu, proc->apicid);
-      if(proc->flags & MPBOOT)
-        bcpu = &cpus[ncpu];
-      cpus[ncpu].id = ncpu;
-      cpus[ncpu].apicid = proc->apicid;
-      ncpu++;
+      if(ncpu < NCPU){
+        if(proc->flags & MPBOOT)
+          bcpu = &cpus[ncpu];
+        cpus[ncpu].id = ncpu;
+        cpus[ncpu].apicid = proc->apicid;
+        ncpu++;
+      }
       p += sizeof(struct mpproc);
       continue;
     case MPIOAPIC:
@@ -6,16 +6,44 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "traps.h"
+#include "ipc.h"
+#include "vdso.h"
+
+// Sleeping processes hang off sleepq[], hashed by channel, so
+// a wakeup visits only those that might be sleeping on it.
+#define SLEEPQ_BITS 6
+#define NSLEEPQ (1<<SLEEPQ_BITS)
+#define SLEEPQ(chan) \
+  (&ptable.sleepq[(uint)((uintp)(chan) >> 3) * 0x9E3779B1u >> (32-SLEEPQ_BITS)])
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct proc *sleepq[NSLEEPQ];
 } ptable;
-struct{
-    struct proc * p;
-    struct msg m __attribute__ ((aligned (64)));
-  } ipc_endpoints[NENDS];
-unsigned long long pcid_counter = NPCIDS+1;
+// FIFO of processes blocked on an endpoint, linked through ipcnext.
+struct ipcq {
+  struct proc *head;
+  struct proc *tail;
+};
+// IPC endpoints.  Processes name them through handles, indexes
+// into proc->ipcends; the first NENDS are well-known channels that
+// init is given and every process inherits.  All fields, including
+// ref, are protected by ptable.lock.
+struct endpoint {
+  int ref;                   // handles naming this endpoint
+  struct ipcq recvq;         // receivers waiting for a message
+  struct ipcq sendq;         // senders waiting for a receiver
+  uint nfy;                  // notification bits not yet collected
+  char *ring;                // page holding the endpoint's struct ring
+  struct endpoint *set;      // set we belong to (see set_add)
+  struct endpoint *members;  // if we are a set, our members
+  struct endpoint *setnext;  // next member of our set
+  int setch;                 // our handle in the set owner's table
+} ipc_endpoints[NENDPOINT];
+static int ipc_ntimed;   // processes in a timed IPC wait
+static uint ipc_callgen; // numbers call()s for their reply tokens
 unsigned int n_calls = 0;
 static struct proc *initproc;
 
@@ -24,6 +52,11 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void setrunnable(struct proc *p);
+static void ipc_cancel(struct proc *p, int ret);
+static struct endpoint *ep_dup(struct endpoint *e);
+static void ep_put(struct endpoint *e);
+static int ep_install(struct proc *p, struct endpoint *e);
 
 void
 pinit(void)
@@ -52,14 +85,28 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
-  p->pcid = 0;
+  memset(p->pcid, 0, sizeof(p->pcid));
+  p->cpuaff = -1;
+  p->ipcspin = 0;
+  p->hugepg = 0;
+  p->prio = NPRIO/2;
+  p->slice = QUANTUM;
+  p->sc = p;
   release(&ptable.lock);
 
-  // Allocate kernel stack.
+  // Allocate kernel stack and the page user code reads our pid from.
   if((p->kstack = kalloc()) == 0){
     p->state = UNUSED;
     return 0;
   }
+  if((p->vproc = kalloc()) == 0){
+    kfree(p->kstack);
+    p->kstack = 0;
+    p->state = UNUSED;
+    return 0;
+  }
+  memset(p->vproc, 0, PGSIZE);
+  ((struct vproc*)p->vproc)->pid = p->pid;
   sp = p->kstack + KSTACKSIZE;
   
   // Leave room for trap frame.
@@ -85,11 +132,12 @@ void
 userinit(void)
 {
   struct proc *p;
+  int i;
   extern char _binary_out_initcode_start[], _binary_out_initcode_size[];
   
   p = allocproc();
   initproc = p;
-  if((p->pgdir = setupkvm()) == 0)
+  if((p->pgdir = setupkvm()) == 0 || mapvdso(p->pgdir, p->vproc) < 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_out_initcode_start, (uintp)_binary_out_initcode_size);
   p->sz = PGSIZE;
@@ -107,7 +155,15 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  p->state = RUNNABLE;
+  // The well-known endpoints keep one reference forever.
+  for(i = 0; i < NENDS; i++){
+    ipc_endpoints[i].ref = 2;
+    p->ipcends[i] = &ipc_endpoints[i];
+  }
+
+  acquire(&ptable.lock);
+  setrunnable(p);
+  release(&ptable.lock);
 }
 
 // Grow current process's memory by n bytes.
@@ -119,18 +175,27 @@ growproc(int n)
   
   sz = proc->sz;
   if(n > 0){
-    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+    if((sz = allocuvm(proc->pgdir, sz, sz + n, proc->hugepg)) == 0)
       return -1;
   } else if(n < 0){
     if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
       return -1;
+    tlbinval(proc, sz, proc->sz - sz);
   }
   proc->sz = sz;
-  proc->pcid=0;
-  switchuvm(proc);
   return 0;
 }
 
+// Back later heap growth with large pages where whole aligned
+// ones fit (on != 0), or only with small pages (on == 0).
+// Returns the number of large pages still free in the pool.
+int
+sethuge(int on)
+{
+  proc->hugepg = on != 0;
+  return khugecount();
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
@@ -145,14 +210,23 @@ fork(void)
     return -1;
 
   // Copy process state from p.
-  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
+  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0 ||
+     mapvdso(np->pgdir, np->vproc) < 0){
+    if(np->pgdir)
+      freevm(np->pgdir);
     kfree(np->kstack);
     np->kstack = 0;
+    kfree(np->vproc);
+    np->vproc = 0;
     np->state = UNUSED;
     return -1;
   }
   np->sz = proc->sz;
   np->parent = proc;
+  np->cpuaff = proc->cpuaff;
+  np->ipcspin = proc->ipcspin;
+  np->hugepg = proc->hugepg;
+  np->prio = proc->prio;
   *np->tf = *proc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -162,9 +236,16 @@ fork(void)
     if(proc->ofile[i])
       np->ofile[i] = filedup(proc->ofile[i]);
   np->cwd = idup(proc->cwd);
+  acquire(&ptable.lock);
+  for(i = 0; i < NHANDLE; i++)
+    if(proc->ipcends[i])
+      np->ipcends[i] = ep_dup(proc->ipcends[i]);
+  release(&ptable.lock);
  
   pid = np->pid;
-  np->state = RUNNABLE;
+  acquire(&ptable.lock);
+  setrunnable(np);
+  release(&ptable.lock);
   safestrcpy(np->name, proc->name, sizeof(proc->name));
   return pid;
 }
@@ -194,16 +275,31 @@ exit(void)
 
   acquire(&ptable.lock);
 
+  for(fd = 0; fd < NHANDLE; fd++){
+    if(proc->ipcends[fd]){
+      ep_put(proc->ipcends[fd]);
+      proc->ipcends[fd] = 0;
+    }
+  }
+
   // Parent might be sleeping in wait().
   wakeup1(proc->parent);
 
-  // Pass abandoned children to init.
+  // Pass abandoned children to init, and fail any calls
+  // still waiting for this process to reply.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == proc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
         wakeup1(initproc);
     }
+    if(p->ipcreply == proc){
+      p->ipcreply = 0;
+      p->ipcret = -1;
+      setrunnable(p);
+    }
+    if(p->sc == proc)
+      p->sc = p;
   }
 
   // Jump into the scheduler, never to return.
@@ -233,6 +329,8 @@ wait(void)
         pid = p->pid;
         kfree(p->kstack);
         p->kstack = 0;
+        kfree(p->vproc);
+        p->vproc = 0;
         freevm(p->pgdir);
         p->state = UNUSED;
         p->pid = 0;
@@ -255,6 +353,131 @@ wait(void)
   }
 }
 
+// CPUs halted in scheduler() for want of work, one bit each.
+// Protected by ptable.lock.
+static uint idlecpus;
+
+// Priority p is scheduled at: its own, or that of the client
+// whose scheduling context it runs on if that is more urgent.
+static inline int
+schedprio(struct proc *p)
+{
+  return p->sc->prio < p->prio ? p->sc->prio : p->prio;
+}
+
+// Queue p, which is runnable, on the CPU it is pinned to, or
+// else on this one, behind others of its scheduling priority.
+// Queue entries are not removed when a process stops being
+// runnable: runq_pop skips them, and a process already queued
+// is not queued again.  Caller holds ptable.lock.
+static void
+runq_push(struct proc *p)
+{
+  struct runq *q;
+  int pr;
+
+  if(p->onrunq)
+    return;
+  q = &cpus[p->cpuaff >= 0 ? p->cpuaff : cpu->id].runq;
+  pr = schedprio(p);
+  p->runnext = 0;
+  if(q->head[pr])
+    q->tail[pr]->runnext = p;
+  else
+    q->head[pr] = p;
+  q->tail[pr] = p;
+  q->mask |= 1 << pr;
+  p->onrunq = 1;
+}
+
+// Take the most urgent runnable process off q, or return 0.
+static struct proc*
+runq_pop(struct runq *q)
+{
+  struct proc *p;
+  int pr;
+
+  while(q->mask){
+    pr = __builtin_ctz(q->mask);
+    p = q->head[pr];
+    if((q->head[pr] = p->runnext) == 0)
+      q->mask &= ~(1 << pr);
+    p->onrunq = 0;
+    if(p->state == RUNNABLE)
+      return p;
+  }
+  return 0;
+}
+
+// Take a process queued on another CPU for this idle one.  Peers
+// are tried from the next CPU up so that thieves spread out.  From
+// each the most urgent process that has waited longest is taken,
+// as it has had the longest to lose its cache footprint there.
+// Processes pinned elsewhere stay put.  Caller holds ptable.lock.
+static struct proc*
+runq_steal(void)
+{
+  struct runq *q;
+  struct proc *p, *prev;
+  uint m;
+  int i, pr;
+
+  for(i = 1; i < ncpu; i++){
+    q = &cpus[(cpu->id + i) % ncpu].runq;
+    for(m = q->mask; m; m &= m - 1){
+      pr = __builtin_ctz(m);
+      prev = 0;
+      for(p = q->head[pr]; p; prev = p, p = p->runnext){
+        if(p->state != RUNNABLE ||
+           (p->cpuaff >= 0 && p->cpuaff != cpu->id))
+          continue;
+        if(prev)
+          prev->runnext = p->runnext;
+        else if((q->head[pr] = p->runnext) == 0)
+          q->mask &= ~(1 << pr);
+        if(q->tail[pr] == p)
+          q->tail[pr] = prev;
+        p->onrunq = 0;
+        return p;
+      }
+    }
+  }
+  return 0;
+}
+
+// Mark p runnable and queue it.  Kick the CPU it is pinned to if
+// that is not this one, or if p waits behind us here, an idle CPU
+// to steal it, so that it is picked up without waiting for a tick.
+// Caller holds ptable.lock.
+static void
+setrunnable(struct proc *p)
+{
+  int c;
+
+  p->state = RUNNABLE;
+  runq_push(p);
+  if(unlikely(p->cpuaff >= 0 && p->cpuaff != cpu->id))
+    lapicipi(cpus[p->cpuaff].apicid, T_IPI);
+  else if(idlecpus && proc && p != proc && p->cpuaff < 0){
+    c = __builtin_ctz(idlecpus);
+    idlecpus &= ~(1 << c);   // one kick per idle CPU
+    lapicipi(cpus[c].apicid, T_IPI);
+  }
+}
+
+// Next process for this CPU to run, or 0 if none.
+// Caller holds ptable.lock.
+static struct proc*
+runq_next(void)
+{
+  struct proc *p;
+
+  while((p = runq_pop(&cpu->runq)) != 0 &&
+        p->cpuaff >= 0 && p->cpuaff != cpu->id)
+    runq_push(p);   // pinned elsewhere since it was queued
+  return p;
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -266,23 +489,14 @@ wait(void)
 void
 scheduler(void)
 {
-  struct proc *p = 0;
+  struct proc *p;
 
   for(;;){
-    // Enable interrupts on this processor.
-    sti();
-
-    // no runnable processes? (did we hit the end of the table last time?)
-    // if so, wait for irq before trying again.
-    if (p == &ptable.proc[NPROC])
-      hlt();
-
-    // Loop over process table looking for process to run.
+    // Run processes off this CPU's queue, most urgent first,
+    // and then any stolen from busy CPUs, until there are none.
     acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
+    idlecpus &= ~(1 << cpu->id);
+    while((p = runq_next()) != 0 || (p = runq_steal()) != 0){
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
       // before jumping back to us.
@@ -292,20 +506,57 @@ scheduler(void)
       swtch(&cpu->scheduler, proc->context);
       //lcr3(CR3_ENTRY_PRESERVE(0,v2p(kpml4)));
 
-      // Process is done running for now.
+      // Process is done running for now; it may have handed the
+      // CPU on to others (see sched) before one of them came back.
       // It should have changed its p->state before coming back.
       proc = 0;
     }
-    release(&ptable.lock);
+    idlecpus |= 1 << cpu->id;
 
+    // Nothing to run: wait for an interrupt.  A process that
+    // switched back here left its own intena behind, so clear it
+    // or release would turn interrupts on before the hlt.  With
+    // them off until the sti, whose one-instruction delay covers
+    // the hlt, a kick from another CPU that queues work here in
+    // between stays pending and still ends the hlt.
+    cpu->intena = 0;
+    release(&ptable.lock);
+    sti();
+    hlt();
+    cli();
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+__attribute__((always_inline)) static void tss_set_rsp(uint *tss, uint n, uint64 rsp) {
+  tss[n*2 + 1] = rsp;
+  tss[n*2 + 2] = rsp >> 32;
+}
+
+// Switch from proc to p, which must be runnable on this CPU.
+// Whoever switches back to us still holds ptable.lock.
+static void
+switchto(struct proc *p)
+{
+  struct proc *from;
+  int intena;
+
+  from = proc;
+  intena = cpu->intena;
+  uint * tss = (uint*) (((char*) cpu->local) + 1024);
+  tss_set_rsp(tss, 0, (uintp)p->kstack + KSTACKSIZE);
+  loadcr3(p);
+  proc = p;
+  p->state = RUNNING;
+  swtch(&from->context, p->context);
+  cpu->intena = intena;
+}
+
+// Give up the CPU.  Must hold only ptable.lock
 // and have changed proc->state.
 void
 sched(void)
 {
+  struct proc *p;
   int intena;
 
   if(!holding(&ptable.lock))
@@ -316,6 +567,19 @@ sched(void)
     panic("sched running");
   if(readeflags()&FL_IF)
     panic("sched interruptible");
+
+  // Hand the CPU straight to the next process on the queue,
+  // or carry on if that is us.  Only an idle CPU goes back to
+  // the scheduler loop.
+  p = runq_next();
+  if(p == proc){
+    p->state = RUNNING;
+    return;
+  }
+  if(p){
+    switchto(p);
+    return;
+  }
   intena = cpu->intena;
   swtch(&proc->context, cpu->scheduler);
   cpu->intena = intena;
@@ -326,7 +590,7 @@ void
 yield(void)
 {
   acquire(&ptable.lock);  //DOC: yieldlock
-  proc->state = RUNNABLE;
+  setrunnable(proc);
   sched();
   release(&ptable.lock);
 }
@@ -351,6 +615,31 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// Put p on the sleep queue of p->chan.  Caller holds ptable.lock.
+static void
+sleepq_push(struct proc *p)
+{
+  struct proc **q;
+
+  q = SLEEPQ(p->chan);
+  p->sleepnext = *q;
+  p->sleepprev = q;
+  if(*q)
+    (*q)->sleepprev = &p->sleepnext;
+  *q = p;
+}
+
+// Take sleeping p off its sleep queue.  Caller holds ptable.lock.
+static void
+sleepq_remove(struct proc *p)
+{
+  *p->sleepprev = p->sleepnext;
+  if(p->sleepnext)
+    p->sleepnext->sleepprev = p->sleepprev;
+  p->sleepnext = 0;
+  p->sleepprev = 0;
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
@@ -376,6 +665,7 @@ sleep(void *chan, struct spinlock *lk)
   // Go to sleep.
   proc->chan = chan;
   proc->state = SLEEPING;
+  sleepq_push(proc);
   sched();
 
   // Tidy up.
@@ -394,11 +684,15 @@ sleep(void *chan, struct spinlock *lk)
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
+  struct proc *p, *next;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  for(p = *SLEEPQ(chan); p; p = next){
+    next = p->sleepnext;
+    if(p->chan == chan){
+      sleepq_remove(p);
+      setrunnable(p);
+    }
+  }
 }
 
 // Wake up all processes sleeping on chan.
@@ -423,8 +717,11 @@ kill(int pid)
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+      if(p->state == SLEEPING){
+        sleepq_remove(p);
+        setrunnable(p);
+      } else if(p->state == IPC_DISPATCH)
+        ipc_cancel(p, -1);
       release(&ptable.lock);
       return 0;
     }
@@ -470,84 +767,871 @@ procdump(void)
     cprintf("\n");
   }
 }
-__attribute__((always_inline)) static void tss_set_rsp(uint *tss, uint n, uint64 rsp) {
-  tss[n*2 + 1] = rsp;
-  tss[n*2 + 2] = rsp >> 32;
+
+static void
+ipcq_push(struct ipcq *q, struct proc *p)
+{
+  p->ipcnext = 0;
+  p->ipcq = q;
+  if(q->tail)
+    q->tail->ipcnext = p;
+  else
+    q->head = p;
+  q->tail = p;
 }
-int send(int channel,struct msg * m){
-  struct proc * pro;
-  void * pml4;
-  if(unlikely((unsigned long long)m>=proc->sz || (unsigned long long)m+ sizeof(struct msg)>=proc->sz))
+
+static struct proc*
+ipcq_pop(struct ipcq *q)
+{
+  struct proc *p;
+
+  p = q->head;
+  if(p){
+    q->head = p->ipcnext;
+    if(q->head == 0)
+      q->tail = 0;
+    p->ipcq = 0;
+  }
+  return p;
+}
+
+// Unlink p from the middle of q.
+static void
+ipcq_remove(struct ipcq *q, struct proc *p)
+{
+  struct proc **pp, *prev;
+
+  prev = 0;
+  for(pp = &q->head; *pp; pp = &(*pp)->ipcnext){
+    if(*pp == p){
+      *pp = p->ipcnext;
+      if(q->tail == p)
+        q->tail = prev;
+      p->ipcq = 0;
+      return;
+    }
+    prev = *pp;
+  }
+  panic("ipcq_remove");
+}
+
+// Hand the CPU straight to p without a trip through the scheduler.
+// Like sched(), must hold only ptable.lock and have changed
+// proc->state; whoever switches back to us still holds it.
+// If p is pinned to another CPU it is handed there instead, and
+// we keep running if still RUNNABLE or give up the CPU if not.
+static void
+ipc_switch(struct proc *p)
+{
+  if(unlikely(p->cpuaff >= 0 && p->cpuaff != cpu->id)){
+    setrunnable(p);
+    if(proc->state == RUNNABLE)
+      proc->state = RUNNING;
+    else
+      sched();
+    return;
+  }
+  switchto(p);
+}
+
+// Reply tokens name the slot of a process waiting in call() in
+// their low 8 bits, and that call's number in the rest, so a token
+// answers only the call it was handed out for.
+#define IPC_TOKEN(p) ((int)((p)->ipcgen << 8 & 0x7fffffff) | \
+                      ((int)((p) - ptable.proc) + 1))
+#define IPC_TOKENSLOT(t) (((t) & 0xff) - 1)
+
+// Where the current process keeps a message while blocked.
+// Register frames on the kernel stack (see IPC_REG in trapasm64.S)
+// are visible from every address space and are used in place;
+// user buffers are staged in ipcbuf.
+static inline struct msg*
+ipc_slot(struct msg *m)
+{
+  if((uintp)m >= KERNBASE)
+    return m;
+  return &proc->ipcbuf;
+}
+
+// Park outgoing message m where a receiver can reach it.
+static inline void
+ipc_stage(struct msg *m)
+{
+  proc->ipcmsg = ipc_slot(m);
+  if(proc->ipcmsg != m)
+    *proc->ipcmsg = *m;
+}
+
+// Copy a message delivered while blocked out to m.
+static inline void
+ipc_unstage(struct msg *m)
+{
+  if(proc->ipcmsg != m)
+    *m = *proc->ipcmsg;
+}
+
+static inline int
+ipc_badmsg(struct msg *m)
+{
+  return (unsigned long long)m>=proc->sz || (unsigned long long)m+ sizeof(struct msg)>=proc->sz;
+}
+
+// Block the caller on q until an IPC partner picks it up.
+// Returns the ipcret left by whoever woke us, or -1 if killed.
+static int
+ipc_block(struct ipcq *q, int flags)
+{
+  if(unlikely(proc->killed))
     return -1;
-  if(unlikely(ipc_endpoints[channel].p==0))
-    return -2;
-  pro = proc;
-  
-  proc = ipc_endpoints[channel].p;
-  ipc_endpoints[channel].m = *m;
-  ipc_endpoints[channel].p = 0;
-  proc->state = RUNNING;
-  pro->state = RUNNABLE;
-  uint * tss = (uint*) (((char*) cpu->local) + 1024);
-  tss_set_rsp(tss, 0, (uintp)proc->kstack + KSTACKSIZE);
-  pml4 = (void*) PTE_ADDR(proc->pgdir[511]);
-  if(unlikely(proc->pcid+NPCIDS<pcid_counter)){
-    proc->pcid = pcid_counter;
-    pcid_counter++;
-    lcr3(CR3_ENTRY_INVALIDATE((proc->pcid%NPCIDS + 1),v2p(pml4)));
+  proc->ipcflags = flags;
+  ipcq_push(q, proc);
+  proc->state = IPC_DISPATCH;
+  sched();
+  return proc->ipcret;
+}
+
+// ipc_block() giving up after timeout ticks; a negative
+// timeout waits forever.
+static inline int
+ipc_wait(struct ipcq *q, int flags, int timeout)
+{
+  int r;
+
+  if(timeout < 0)
+    return ipc_block(q, flags);
+  proc->ipcdeadline = ticks + timeout;
+  ipc_ntimed++;
+  r = ipc_block(q, flags | IPC_TIMED);
+  ipc_ntimed--;
+  return r;
+}
+
+// Abort the IPC wait of p, making its operation return ret.
+static void
+ipc_cancel(struct proc *p, int ret)
+{
+  if(p->ipcq)
+    ipcq_remove(p->ipcq, p);
+  else if(p->ipcreply == 0)
+    return;   // already picked up and about to run
+  p->ipcreply = 0;
+  p->ipcret = ret;
+  setrunnable(p);
+}
+
+// Called on every clock tick: time out expired timed waits.
+void
+ipc_expire(void)
+{
+  struct proc *p;
+
+  if(ipc_ntimed == 0)
+    return;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state == IPC_DISPATCH && (p->ipcflags & IPC_TIMED) && p->ipcq &&
+       (int)(ticks - p->ipcdeadline) >= 0)
+      ipc_cancel(p, IPC_TIMEOUT);
+  release(&ptable.lock);
+}
+
+// Hand the items attached to sender s by sendx() to receiver r.
+// d is r's copy of the message, rewritten to name the items as r
+// sees them.  Pages go at r's break (see mapbase): regs[0]
+// becomes their new address, or both words are cleared and s is
+// left with IPC_NOMAP for sendx if they cannot be mapped, and a
+// grant also unmaps them from s.  A file or
+// endpoint handle gets the lowest free slot in r's table, or -1
+// if it is full.
+// One of s and r is the current process and the other is blocked
+// in the IPC code, so r's memory and tables are not in use while
+// they change (see ipc_ep).  Caller holds ptable.lock.
+static void
+ipc_items(struct proc *s, struct proc *r, struct msg *d)
+{
+  struct file *f;
+  struct endpoint *e;
+  uintp va, n, dva;
+  int fd, h, nomap;
+
+  nomap = 0;
+  if(s->ipcitems & (SX_MAP|SX_GRANT)){
+    va = d->regs[0];
+    n = d->regs[1];
+    dva = mapbase(r->pgdir, r->sz);
+    if(n > (USERTOP - dva) / PGSIZE ||
+       shareuvm(s->pgdir, va, n, r->pgdir, dva, !(s->ipcitems & SX_GRANT)) < 0){
+      d->regs[0] = d->regs[1] = 0;
+      nomap = IPC_NOMAP;
+    } else {
+      r->sz = dva + n*PGSIZE;
+      d->regs[0] = dva;
+      if(s->ipcitems & SX_GRANT){
+        deallocuvm(s->pgdir, s->sz, va);
+        tlbinval(s, va, s->sz - va);
+        s->sz = va;
+      }
+    }
+  }
+  if(s->ipcitems & SX_FD){
+    fd = d->regs[SX_FDREG];
+    f = (uint)fd < NOFILE ? s->ofile[fd] : 0;
+    for(fd = 0; fd < NOFILE && r->ofile[fd]; fd++)
+      ;
+    if(f == 0 || fd == NOFILE)
+      fd = -1;
+    else
+      r->ofile[fd] = filedup(f);
+    d->regs[SX_FDREG] = fd;
+  }
+  if(s->ipcitems & SX_EP){
+    h = d->regs[SX_EPREG];
+    e = (uint)h < NHANDLE ? s->ipcends[h] : 0;
+    if(e == 0 || (h = ep_install(r, e)) < 0)
+      h = -1;
+    else
+      ep_dup(e);
+    d->regs[SX_EPREG] = h;
+  }
+  s->ipcitems = nomap;
+}
+
+// Take the message of p, which was queued on channel's send queue,
+// and return the token to reply with (0 if p does not want a reply).
+static int
+ipc_accept(struct endpoint *e, struct proc *p, struct msg *m)
+{
+  *m = *p->ipcmsg;
+  if(unlikely(p->ipcitems))
+    ipc_items(p, proc, m);
+  if(p->ipcflags & IPC_RECV){
+    // A send_recv() caller now waits for the answer on this channel.
+    ipcq_push(&e->recvq, p);
+    return 0;
+  }
+  if(p->ipcflags & IPC_CALL){
+    p->ipcreply = proc;
+    proc->sc = p->sc;   // serve the call on the client's time
+    return IPC_TOKEN(p);
+  }
+  p->ipcret = 0;
+  setrunnable(p);
+  return 0;
+}
+
+// Take the longest-waiting sender on *ep or, if *ep is a set and
+// has none, on the first of its members that does, pointing *ep
+// at that member.
+static inline struct proc*
+ipc_sender(struct endpoint **ep)
+{
+  struct endpoint *s, *e;
+  struct proc *p;
+
+  s = *ep;
+  for(e = s; e; e = (e == s) ? s->members : e->setnext){
+    if((p = ipcq_pop(&e->sendq)) != 0){
+      *ep = e;
+      return p;
+    }
+  }
+  return 0;
+}
+
+// Find a receiver for a message on e: one waiting on e itself,
+// else one waiting on e's set, which is told e's handle.
+static inline struct proc*
+ipc_receiver(struct endpoint *e)
+{
+  struct proc *p;
+
+  p = ipcq_pop(&e->recvq);
+  if(p == 0 && e->set != 0){
+    p = ipcq_pop(&e->set->recvq);
+    if(p)
+      p->ipcchan = e->setch;
   }
-  else{
+  return p;
+}
+
+// Look up the caller's handle h.  A handle table changes only
+// while its owner runs, or while it is blocked in the IPC code and
+// a sender installs an SX_EP handle (see ipc_items).  Either way it
+// never changes under a running owner, so this needs no lock.
+static inline struct endpoint*
+ipc_ep(int h)
+{
+  if(unlikely((uint)h>=NHANDLE))
+    return 0;
+  return proc->ipcends[h];
+}
+
+// The ipc_* operations take m either as a checked user pointer
+// or as a register frame; the system calls below check and
+// forward user pointers.
 
-    lcr3(CR3_ENTRY_PRESERVE((proc->pcid%NPCIDS + 1),v2p(pml4)));
+// Send m to the first receiver waiting on channel, switching
+// to it directly.  If nobody is receiving, wait in line for
+// a receiver for up to timeout ticks (forever if negative).
+static inline int
+ipc_send_timed(int channel, struct msg *m, int timeout)
+{
+  struct proc * p;
+  struct endpoint * e;
+  int r;
+  if(unlikely((e = ipc_ep(channel)) == 0))
+    return -1;
+  acquire(&ptable.lock);
+  p = ipc_receiver(e);
+  if(unlikely(p==0)){
+    if(timeout == 0){
+      release(&ptable.lock);
+      return IPC_WOULDBLOCK;
+    }
+    ipc_stage(m);
+    r = ipc_wait(&e->sendq, 0, timeout);
+    release(&ptable.lock);
+    return r < 0 ? r : 1;
   }
-  swtch(&pro->context, proc->context);
+  *p->ipcmsg = *m;
+  if(unlikely(proc->ipcitems))
+    ipc_items(proc, p, p->ipcmsg);
+  p->ipcret = 0;
+  setrunnable(proc);
+  ipc_switch(p);
   release(&ptable.lock);
   return 1;
 }
-int recv(int channel, struct msg * m){
-  if(unlikely((unsigned long long)m>=proc->sz || (unsigned long long)m+ sizeof(struct msg)>=proc->sz||channel>=NENDS))
+
+int
+ipc_send(int channel, struct msg *m)
+{
+  return ipc_send_timed(channel, m, -1);
+}
+
+// Receive the next message on channel.  Takes it from the
+// longest-waiting sender if there is one, otherwise joins the
+// queue of receivers so several servers can drain one channel,
+// for up to timeout ticks (forever if negative).  A set channel
+// also takes messages sent to its members.
+// Returns a reply token if the sender is waiting in call(), else 0.
+static inline int
+ipc_recv_timed(int channel, struct msg *m, int timeout)
+{
+  struct proc * p;
+  struct endpoint * e;
+  int i, tok;
+  if(unlikely((e = ipc_ep(channel)) == 0))
+    return -1;
+  acquire(&ptable.lock);
+  p = ipc_sender(&e);
+  if(p){
+    tok = ipc_accept(e, p, m);
+    release(&ptable.lock);
+    return tok;
+  }
+  if(timeout == 0){
+    release(&ptable.lock);
+    return IPC_WOULDBLOCK;
+  }
+  if(unlikely(proc->ipcspin) && ncpu > 1){
+    // A sender on another CPU may be about to arrive:
+    // watch the queue for a while before going to sleep.
+    release(&ptable.lock);
+    for(i = proc->ipcspin; i > 0 && e->sendq.head == 0; i--)
+      pause();
+    acquire(&ptable.lock);
+    if((p = ipc_sender(&e)) != 0){
+      tok = ipc_accept(e, p, m);
+      release(&ptable.lock);
+      return tok;
+    }
+  }
+  proc->ipcmsg = ipc_slot(m);
+  proc->sc = proc;
+  tok = ipc_wait(&e->recvq, 0, timeout);
+  if(tok >= 0)
+    ipc_unstage(m);
+  release(&ptable.lock);
+  return tok;
+}
+
+int
+ipc_recv(int channel, struct msg *m)
+{
+  return ipc_recv_timed(channel, m, -1);
+}
+
+// Send m on channel and wait for the next message on it.
+int
+ipc_send_recv(int channel, struct msg *m)
+{
+  struct proc * p;
+  struct endpoint * e;
+  int r;
+  if(unlikely((e = ipc_ep(channel)) == 0))
     return -1;
-    
-  ipc_endpoints[channel].p = proc;
+  acquire(&ptable.lock);
+  p = ipc_receiver(e);
+  if(unlikely(p==0)){
+    ipc_stage(m);
+    r = ipc_block(&e->sendq, IPC_RECV);
+    if(r >= 0)
+      ipc_unstage(m);
+    release(&ptable.lock);
+    return r < 0 ? r : 1;
+  }
+  *p->ipcmsg = *m;
+  if(unlikely(proc->ipcitems))
+    ipc_items(proc, p, p->ipcmsg);
+  p->ipcret = 0;
+  proc->ipcmsg = ipc_slot(m);
+  ipcq_push(&e->recvq, proc);
+  proc->ipcflags = 0;
   proc->state = IPC_DISPATCH;
+  ipc_switch(p);
+  r = proc->ipcret;
+  if(r >= 0)
+    ipc_unstage(m);
+  release(&ptable.lock);
+  return r < 0 ? r : 1;
+}
+
+// Send m to a receiver on channel and wait for its reply, which
+// comes straight back to us rather than through the channel.
+// Returns 1, or -1 if the server exited without replying.
+int
+ipc_call(int channel, struct msg *m)
+{
+  struct proc * p;
+  struct endpoint * e;
+  int r;
+  if(unlikely((e = ipc_ep(channel)) == 0))
+    return -1;
   acquire(&ptable.lock);
-  swtch(&proc->context, cpu->scheduler);
-  *m = ipc_endpoints[channel].m;
-  return 1;
+  proc->ipcgen = ++ipc_callgen;
+  p = ipc_receiver(e);
+  if(unlikely(p==0)){
+    ipc_stage(m);
+    r = ipc_block(&e->sendq, IPC_CALL);
+  } else {
+    *p->ipcmsg = *m;
+    if(unlikely(proc->ipcitems))
+      ipc_items(proc, p, p->ipcmsg);
+    p->ipcret = IPC_TOKEN(proc);
+    p->sc = proc->sc;
+    proc->ipcmsg = ipc_slot(m);
+    proc->ipcreply = p;
+    proc->ipcflags = IPC_CALL;
+    proc->state = IPC_DISPATCH;
+    ipc_switch(p);
+    r = proc->ipcret;
+  }
+  if(r >= 0)
+    ipc_unstage(m);
+  release(&ptable.lock);
+  return r;
+}
+
+// Answer the call named by token with m, then wait for the next
+// message on channel.  Replying consumes the token.  If a sender is
+// already queued the caller keeps the CPU; otherwise it switches
+// straight to the client.  Returns like recv().
+int
+ipc_reply_recv(int channel, struct msg *m, int token)
+{
+  struct proc * c, * p;
+  struct endpoint * e;
+  int tok;
+  if(unlikely((e = ipc_ep(channel)) == 0 || token <= 0 ||
+              (uint)IPC_TOKENSLOT(token)>=NPROC))
+    return -1;
+  acquire(&ptable.lock);
+  c = &ptable.proc[IPC_TOKENSLOT(token)];
+  if(unlikely(c->state!=IPC_DISPATCH || c->ipcreply!=proc ||
+              IPC_TOKEN(c)!=token)){
+    release(&ptable.lock);
+    return -1;
+  }
+  c->ipcreply = 0;
+  *c->ipcmsg = *m;
+  c->ipcret = 1;
+  proc->sc = proc;
+  p = ipc_sender(&e);
+  if(unlikely(p!=0)){
+    setrunnable(c);
+    tok = ipc_accept(e, p, m);
+    release(&ptable.lock);
+    return tok;
+  }
+  proc->ipcmsg = ipc_slot(m);
+  ipcq_push(&e->recvq, proc);
+  proc->ipcflags = 0;
+  proc->state = IPC_DISPATCH;
+  ipc_switch(c);
+  tok = proc->ipcret;
+  if(tok >= 0)
+    ipc_unstage(m);
+  release(&ptable.lock);
+  return tok;
+}
+
+int send(int channel,struct msg * m){
+  if(unlikely(ipc_badmsg(m)))
+    return -1;
+  return ipc_send(channel, m);
+}
+
+int recv(int channel, struct msg * m){
+  if(unlikely(ipc_badmsg(m)))
+    return -1;
+  return ipc_recv(channel, m);
+}
+
+// Timed send() and recv(): give up after timeout ticks with
+// IPC_TIMEOUT, or at once with IPC_WOULDBLOCK if timeout is 0.
+int send_timed(int channel, struct msg * m, int timeout){
+  if(unlikely(ipc_badmsg(m)))
+    return -1;
+  return ipc_send_timed(channel, m, timeout);
+}
+
+int recv_timed(int channel, struct msg * m, int timeout){
+  if(unlikely(ipc_badmsg(m)))
+    return -1;
+  return ipc_recv_timed(channel, m, timeout);
 }
 
 int send_recv(int channel, struct msg * m){
+  if(unlikely(ipc_badmsg(m)))
+    return -1;
+  return ipc_send_recv(channel, m);
+}
 
-  struct proc * pro;
-  void * pml4;
-  if(unlikely((unsigned long long)m>=proc->sz || (unsigned long long)m+ sizeof(struct msg)>=proc->sz||channel>=NENDS))
+int call(int channel, struct msg * m){
+  if(unlikely(ipc_badmsg(m)))
     return -1;
-  if(unlikely(ipc_endpoints[channel].p==0))
-    return -2;
-  pro = proc;
-  proc->state = IPC_DISPATCH;
-  
-  ipc_endpoints[channel].m = *m;
-  
-  ipc_endpoints[channel].p->state = RUNNING;
-  uint * tss = (uint*) (((char*) cpu->local) + 1024);
-  pml4 = (void*) PTE_ADDR( ipc_endpoints[channel].p->pgdir[511]);
-  tss_set_rsp(tss, 0, (uintp)ipc_endpoints[channel].p->kstack+KSTACKSIZE);
-  if(unlikely(ipc_endpoints[channel].p->pcid+NPCIDS<pcid_counter)){
-    ipc_endpoints[channel].p->pcid = pcid_counter;
-    pcid_counter++;
-
-    lcr3(CR3_ENTRY_INVALIDATE((ipc_endpoints[channel].p->pcid%NPCIDS + 1),v2p(pml4)));
-  }
-  else{
-    lcr3(CR3_ENTRY_PRESERVE((ipc_endpoints[channel].p->pcid%NPCIDS + 1),v2p(pml4)));
-  }
-  //(ipc_endpoints[channel].p->pcid%NPCIDS + 1)
-  proc = ipc_endpoints[channel].p;
-  ipc_endpoints[channel].p = pro;
-  swtch(&pro->context, proc->context);
-  *m = ipc_endpoints[channel].m;
-  return 1;
+  return ipc_call(channel, m);
 }
 
+int reply_recv(int channel, struct msg * m, int token){
+  if(unlikely(ipc_badmsg(m)))
+    return -1;
+  return ipc_reply_recv(channel, m, token);
+}
+
+// Run n IPC operations from the user array ops in one kernel
+// entry, storing each result in its ret.  Stops at the first
+// operation that fails.  Returns the number that succeeded.
+int ipc_batch(struct ipcop * ops, int n){
+  struct ipcop * o;
+  int i, r;
+  if(n < 0 || n > IPC_MAXBATCH || (uintp)ops >= proc->sz ||
+     (uintp)ops + n*sizeof(*ops) >= proc->sz)
+    return -1;
+  for(i = 0; i < n; i++){
+    o = &ops[i];
+    switch(o->op){
+    case IPCOP_SEND:
+      r = ipc_send_timed(o->ch, &o->m, o->arg);
+      break;
+    case IPCOP_RECV:
+      r = ipc_recv_timed(o->ch, &o->m, o->arg);
+      break;
+    case IPCOP_SENDRECV:
+      r = ipc_send_recv(o->ch, &o->m);
+      break;
+    case IPCOP_CALL:
+      r = ipc_call(o->ch, &o->m);
+      break;
+    case IPCOP_REPLYRECV:
+      r = ipc_reply_recv(o->ch, &o->m, o->arg);
+      break;
+    default:
+      r = -1;
+    }
+    o->ret = r;
+    if(r < 0)
+      break;
+  }
+  return i;
+}
 
+// Set the caller's scheduling priority, 0 being the most urgent.
+int setprio(int prio){
+  if((uint)prio>=NPRIO)
+    return -1;
+  proc->prio = prio;
+  return 0;
+}
+
+// Pin the caller to CPU c (-1: run anywhere) and have its IPC
+// receives spin for up to spin iterations waiting for a sender
+// before blocking; spinning only pays when partners run on
+// other CPUs.
+int ipc_affinity(int c, int spin){
+  if((c != -1 && (c < 0 || c >= ncpu)) || spin < 0)
+    return -1;
+  proc->cpuaff = c;
+  proc->ipcspin = spin;
+  if(c >= 0 && c != cpu->id)
+    yield();
+  return 0;
+}
+
+// Take e out of its set.
+static void
+set_unlink(struct endpoint *e)
+{
+  struct endpoint **pp;
+
+  for(pp = &e->set->members; *pp != e; pp = &(*pp)->setnext)
+    ;
+  *pp = e->setnext;
+  e->set = 0;
+  e->setnext = 0;
+}
+
+// Make channel a member of the endpoint set named by set: a
+// recv_any() on set then also receives channel's messages.
+// A set cannot itself join a set.
+int set_add(int set, int channel){
+  struct endpoint *s, *e;
+  if((s = ipc_ep(set)) == 0 || (e = ipc_ep(channel)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  if(e == s || e->set || e->members || s->set){
+    release(&ptable.lock);
+    return -1;
+  }
+  e->set = s;
+  e->setch = channel;
+  e->setnext = s->members;
+  s->members = e;
+  release(&ptable.lock);
+  return 0;
+}
+
+// Take channel back out of its set.
+int set_del(int channel){
+  struct endpoint *e;
+  if((e = ipc_ep(channel)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  if(e->set == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  set_unlink(e);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Receive the next message sent to set or to any of its members,
+// storing the channel it arrived on in *chp.  Returns like recv().
+int recv_any(int set, struct msg * m, int * chp){
+  struct endpoint *s, *e;
+  struct proc *p;
+  int ch, tok;
+  if(unlikely(ipc_badmsg(m) || (uintp)chp >= proc->sz ||
+              (uintp)chp + sizeof(*chp) > proc->sz || (s = ipc_ep(set)) == 0))
+    return -1;
+  acquire(&ptable.lock);
+  e = s;
+  if((p = ipc_sender(&e)) != 0){
+    ch = (e == s) ? set : e->setch;
+    tok = ipc_accept(e, p, m);
+    release(&ptable.lock);
+    *chp = ch;
+    return tok;
+  }
+  proc->ipcmsg = ipc_slot(m);
+  proc->ipcchan = set;
+  proc->sc = proc;
+  tok = ipc_block(&s->recvq, 0);
+  if(tok >= 0){
+    ipc_unstage(m);
+    *chp = proc->ipcchan;
+  }
+  release(&ptable.lock);
+  return tok;
+}
+
+// Map channel's message ring (see struct ring in ipc.h) at the
+// caller's break, creating it on first use.  Both ends of the
+// channel attach the same page.  Returns its address.
+int ring_attach(int channel){
+  struct endpoint *e;
+  uintp va;
+  char *ring;
+  if((e = ipc_ep(channel)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  if((ring = e->ring) == 0){
+    if((ring = kalloc()) == 0){
+      release(&ptable.lock);
+      return -1;
+    }
+    memset(ring, 0, PGSIZE);
+    e->ring = ring;
+  }
+  va = mapbase(proc->pgdir, proc->sz);
+  if(va + PGSIZE > USERTOP || mapshared(proc->pgdir, va, ring) < 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  proc->sz = va + PGSIZE;
+  release(&ptable.lock);
+  return va;
+}
+
+// Post bits on channel's notification word without blocking,
+// waking anyone waiting in nfy_wait().
+int notify(int channel, int bits){
+  struct endpoint *e;
+  if((e = ipc_ep(channel)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  e->nfy |= bits;
+  wakeup1(&e->nfy);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Wait until channel's notification word is non-zero, then
+// clear it and return the bits that were posted.
+int nfy_wait(int channel){
+  struct endpoint *e;
+  int bits;
+  if((e = ipc_ep(channel)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  while(e->nfy == 0){
+    if(proc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+    sleep(&e->nfy, &ptable.lock);
+  }
+  bits = e->nfy;
+  e->nfy = 0;
+  release(&ptable.lock);
+  return bits;
+}
+
+// Send m along with the items it names.  With SX_MAP or SX_GRANT,
+// regs[0] is the page-aligned start and regs[1] the number of
+// pages; SX_MAP shares them, SX_GRANT moves them out of the tail of
+// our memory, and the receiver finds them at the address now in its
+// regs[0].  SX_FD shares the open file regs[SX_FDREG] and SX_EP the
+// endpoint handle regs[SX_EPREG]; the receiver finds its own
+// descriptor or handle in the same word.  With SX_CALL the caller
+// then waits for a reply.  If the pages could not be mapped the
+// message still goes, with regs[0] and regs[1] zero, but sendx
+// returns -1.
+int sendx(int channel, struct msg * m, int flags){
+  uintp va, n;
+  int r;
+  if(unlikely(ipc_badmsg(m)))
+    return -1;
+  if((flags & ~(SX_MAP|SX_GRANT|SX_CALL|SX_FD|SX_EP)) ||
+     (flags & (SX_MAP|SX_GRANT)) == (SX_MAP|SX_GRANT))
+    return -1;
+  if((flags & SX_FD) &&
+     (m->regs[SX_FDREG] >= NOFILE || proc->ofile[m->regs[SX_FDREG]] == 0))
+    return -1;
+  if((flags & SX_EP) &&
+     (m->regs[SX_EPREG] >= NHANDLE || proc->ipcends[m->regs[SX_EPREG]] == 0))
+    return -1;
+  if(flags & (SX_MAP|SX_GRANT)){
+    va = m->regs[0];
+    n = m->regs[1];
+    if(va % PGSIZE || n == 0 || n > USERTOP/PGSIZE ||
+       va + n*PGSIZE > PGROUNDUP(proc->sz))
+      return -1;
+    // A grant takes the tail of memory, which must not hold m.
+    if((flags & SX_GRANT) &&
+       (va + n*PGSIZE != PGROUNDUP(proc->sz) || (uintp)m + sizeof(*m) > va))
+      return -1;
+  }
+  proc->ipcitems = flags & (SX_MAP|SX_GRANT|SX_FD|SX_EP);
+  if(flags & SX_CALL)
+    r = ipc_call(channel, m);
+  else
+    r = ipc_send(channel, m);
+  if(proc->ipcitems == IPC_NOMAP)
+    r = -1;
+  proc->ipcitems = 0;
+  return r;
+}
+
+// Take another reference to e.  Caller holds ptable.lock.
+static struct endpoint*
+ep_dup(struct endpoint *e)
+{
+  e->ref++;
+  return e;
+}
+
+// Drop a reference to e, freeing it with the last one.
+// Nobody can be queued on e then: waiters hold handles.
+// Caller holds ptable.lock.
+static void
+ep_put(struct endpoint *e)
+{
+  if(--e->ref > 0)
+    return;
+  if(e->set)
+    set_unlink(e);
+  while(e->members)
+    set_unlink(e->members);
+  if(e->ring)
+    kfree(e->ring);
+  memset(e, 0, sizeof(*e));
+}
+
+// Install e in the lowest free slot of p's handle table.
+static int
+ep_install(struct proc *p, struct endpoint *e)
+{
+  int h;
+
+  for(h = 0; h < NHANDLE; h++){
+    if(p->ipcends[h] == 0){
+      p->ipcends[h] = e;
+      return h;
+    }
+  }
+  return -1;
+}
+
+// Create a new endpoint and return a handle to it.
+int ep_create(void){
+  struct endpoint *e;
+  int h;
+
+  acquire(&ptable.lock);
+  for(e = &ipc_endpoints[NENDS]; e < &ipc_endpoints[NENDPOINT]; e++){
+    if(e->ref == 0){
+      if((h = ep_install(proc, e)) >= 0)
+        e->ref = 1;
+      release(&ptable.lock);
+      return h;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Drop handle h.
+int ep_close(int h){
+  struct endpoint *e;
+
+  if((e = ipc_ep(h)) == 0)
+    return -1;
+  acquire(&ptable.lock);
+  proc->ipcends[h] = 0;
+  ep_put(e);
+  release(&ptable.lock);
+  return 0;
+}
@@ -171,34 +171,27 @@ int (*syscalls[])(void) = {
 int
 sys_cr3_reload(void)
 {
-  void * pml4 = (void*) PTE_ADDR(proc->pgdir[511]);
-  if(unlikely(proc->pcid+NPCIDS<pcid_counter)){
-    proc->pcid = pcid_counter;
-    pcid_counter++;
-
-    lcr3(CR3_ENTRY_INVALIDATE((proc->pcid%NPCIDS + 1),v2p(pml4)));
-  }
-  else{
-    lcr3(CR3_ENTRY_PRESERVE((proc->pcid%NPCIDS + 1),v2p(pml4)));
-  }
+  loadcr3(proc);
   return 1;
 }
 int
 sys_cr3_kernel(unsigned long long num)
 {
 
-  for(unsigned long long i = 0;i<num;i++){
-  void * pml4 = (void*) PTE_ADDR(proc->pgdir[511]);
-  if(unlikely(proc->pcid+NPCIDS<pcid_counter)){
-    proc->pcid = pcid_counter;
-    pcid_counter++;
-
-    lcr3(CR3_ENTRY_INVALIDATE((proc->pcid%NPCIDS + 1),v2p(pml4)));
-  }
-  else{
-    lcr3(CR3_ENTRY_PRESERVE((proc->pcid%NPCIDS + 1),v2p(pml4)));
-  }
-  }
+  for(unsigned long long i = 0;i<num;i++)
+    loadcr3(proc);
+  return 1;
+}
+// Switch to the kernel page table and back, as a round trip
+// through another address space would.  With flush set our
+// translations are dropped on the way, as without PCIDs.
+int
+sys_cr3_switch(int flush)
+{
+  switchkvm();
+  if(flush)
+    tlbinval(proc, 0, 0);
+  loadcr3(proc);
   return 1;
 }
 int
@@ -206,13 +199,66 @@ sys_null_call(void)
 {
   return 1;
 }
-void * syscalls_fast[] = {
+extern int sys_send_reg(void);
+extern int sys_recv_reg(void);
+extern int sys_send_recv_reg(void);
+extern int sys_call_reg(void);
+extern int sys_reply_recv_reg(void);
+
+// Calls made with the syscall instruction, which take their
+// arguments in rdi, rsi and rdx.  The handlers written for the int
+// path find them with argint() and friends too: syscall_entry stores
+// them in a minimal trap frame.  fork and exec need a full trap
+// frame and are only reachable through int.
+void * syscalls_fast[NSYSCALL] = {
+[SYS_exit]    sys_exit,
+[SYS_wait]    sys_wait,
+[SYS_pipe]    sys_pipe,
+[SYS_read]    sys_read,
+[SYS_kill]    sys_kill,
+[SYS_fstat]   sys_fstat,
+[SYS_chdir]   sys_chdir,
+[SYS_dup]     sys_dup,
+[SYS_getpid]  sys_getpid,
+[SYS_sbrk]    sys_sbrk,
+[SYS_sleep]   sys_sleep,
+[SYS_uptime]  sys_uptime,
+[SYS_open]    sys_open,
+[SYS_write]   sys_write,
+[SYS_mknod]   sys_mknod,
+[SYS_unlink]  sys_unlink,
+[SYS_link]    sys_link,
+[SYS_mkdir]   sys_mkdir,
+[SYS_close]   sys_close,
   [SYS_cr3_test]  sys_cr3_reload,
   [SYS_cr3_kernel]  sys_cr3_kernel,
+  [SYS_cr3_switch]  sys_cr3_switch,
   [SYS_null_call]  sys_null_call,
 [SYS_send]    send,
 [SYS_send_recv]    send_recv,
 [SYS_recv]    recv,
+[SYS_call]    call,
+[SYS_reply_recv]    reply_recv,
+[SYS_send_reg]    sys_send_reg,
+[SYS_recv_reg]    sys_recv_reg,
+[SYS_send_recv_reg]    sys_send_recv_reg,
+[SYS_call_reg]    sys_call_reg,
+[SYS_reply_recv_reg]    sys_reply_recv_reg,
+[SYS_sendx]    sendx,
+[SYS_ring_attach]    ring_attach,
+[SYS_notify]    notify,
+[SYS_nfy_wait]    nfy_wait,
+[SYS_send_timed]    send_timed,
+[SYS_recv_timed]    recv_timed,
+[SYS_set_add]    set_add,
+[SYS_set_del]    set_del,
+[SYS_recv_any]    recv_any,
+[SYS_ep_create]    ep_create,
+[SYS_ep_close]    ep_close,
+[SYS_ipc_affinity]    ipc_affinity,
+[SYS_setprio]    setprio,
+[SYS_ipc_batch]    ipc_batch,
+[SYS_sethuge]    sethuge,
 };
 
 void
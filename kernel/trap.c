@@ -173,8 +173,10 @@ trap(struct trapframe *tf)
     if(cpu->id == 0){
       acquire(&tickslock);
       ticks++;
+      vdsotick(ticks);
       wakeup(&ticks);
       release(&tickslock);
+      ipc_expire();
     }
     lapiceoi();
     break;
@@ -193,6 +195,12 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_IPI:
+    // A process pinned here was made runnable; the yield
+    // below lets the scheduler switch to it.  An idle CPU is
+    // kicked to steal work and finds it back in scheduler().
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -232,7 +240,14 @@ trap(struct trapframe *tf)
 
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  // The tick is charged to the scheduling context we run on,
+  // which a server in the middle of a call borrows from its client.
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+     --proc->sc->slice <= 0){
+    proc->sc->slice = QUANTUM;
+    yield();
+  }
+  if(proc && proc->state == RUNNING && tf->trapno == T_IPI)
     yield();
 
   // Check if the process has been killed since we yielded
@@ -6,11 +6,19 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "vdso.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
 struct segdesc gdt[NSEGS];
 
+// The page every process sees at VDSO.
+static char vdsopage[PGSIZE] __attribute__((aligned(PGSIZE)));
+static struct vdso *vdso = (struct vdso*)vdsopage;
+
+// Timer ticks over which vdsotick() calibrates the TSC.
+#define CALTICKS 10
+
 #ifndef X64
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
@@ -43,7 +51,8 @@ seginit(void)
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
+// create any required page table pages.  If va is in a
+// large page, return its directory entry.
 static pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
@@ -51,6 +60,8 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if(*pde & PTE_PS)
+    return pde;
   if(*pde & PTE_P){
     pgtab = (pte_t*)p2v(PTE_ADDR(*pde));
   } else {
@@ -68,7 +79,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
 
 // Create PTEs for virtual addresses starting at va that refer to
 // physical addresses starting at pa. va and size might not
-// be page-aligned.
+// be page-aligned.  Fails if part of the range is in a large page.
 static int
 mappages(pde_t *pgdir, void *va, uintp size, uintp pa, int perm)
 {
@@ -78,7 +89,7 @@ mappages(pde_t *pgdir, void *va, uintp size, uintp pa, int perm)
   a = (char*)PGROUNDDOWN((uintp)va);
   last = (char*)PGROUNDDOWN(((uintp)va) + size - 1);
   for(;;){
-    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+    if((pte = walkpgdir(pgdir, a, 1)) == 0 || (*pte & PTE_PS))
       return -1;
     if(*pte & PTE_P)
       panic("remap");
@@ -220,20 +231,36 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
 }
 
 // Allocate page tables and physical memory to grow process from oldsz to
-// newsz, which need not be page aligned.  Returns new size or 0 on error.
+// newsz, which need not be page aligned.  If huge is set, aligned
+// HUGEPGSIZE stretches are backed by large pages while the pool
+// lasts.  Returns new size or 0 on error.
 int
-allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+allocuvm(pde_t *pgdir, uint oldsz, uint newsz, int huge)
 {
   char *mem;
   uintp a;
+  pde_t *pde;
 
-  if(newsz >= KERNBASE)
+  if(newsz >= USERTOP)
     return 0;
   if(newsz < oldsz)
     return oldsz;
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
+    pde = &pgdir[PDX(a)];
+    if(*pde & PTE_PS){
+      // Kept by deallocuvm; still mapped.
+      a = HUGEPGROUNDDOWN(a) + HUGEPGSIZE - PGSIZE;
+      continue;
+    }
+    if(huge && a % HUGEPGSIZE == 0 && a + HUGEPGSIZE <= newsz &&
+       !(*pde & PTE_P) && (mem = khugealloc()) != 0){
+      memset(mem, 0, HUGEPGSIZE);
+      *pde = v2p(mem) | PTE_PS | PTE_P | PTE_W | PTE_U;
+      a += HUGEPGSIZE - PGSIZE;
+      continue;
+    }
     mem = kalloc();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
@@ -249,7 +276,9 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
-// process size.  Returns the new process size.
+// process size.  Returns the new process size.  A large page is
+// only freed once newsz drops to its start; until then it stays
+// mapped whole.
 int
 deallocuvm(pde_t *pgdir, uintp oldsz, uintp newsz)
 {
@@ -261,6 +290,14 @@ deallocuvm(pde_t *pgdir, uintp oldsz, uintp newsz)
 
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
+    if(pgdir[PDX(a)] & PTE_PS){
+      if(a % HUGEPGSIZE == 0){
+        khugefree(p2v(PTE_ADDR(pgdir[PDX(a)])));
+        pgdir[PDX(a)] = 0;
+      }
+      a = HUGEPGROUNDDOWN(a) + HUGEPGSIZE - PGSIZE;
+      continue;
+    }
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a += (NPTENTRIES - 1) * PGSIZE;
@@ -284,7 +321,7 @@ freevm(pde_t *pgdir)
   uint i;
   if(pgdir == 0)
     panic("freevm: no pgdir");
-  deallocuvm(pgdir, 0x3fa00000, 0);
+  deallocuvm(pgdir, USERTOP, 0);
   for(i = 0; i < NPDENTRIES-2; i++){
     if(pgdir[i] & PTE_P){
       char * v = p2v(PTE_ADDR(pgdir[i]));
@@ -307,6 +344,33 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Copy the large page mapped by pde to va in page table d,
+// into small pages if the pool is empty.  Those stop at the
+// process size sz, which may end partway into the large page.
+static int
+copyhuge(pde_t pde, pde_t *d, uintp va, uintp sz)
+{
+  char *src, *mem;
+  uintp i;
+
+  src = p2v(PTE_ADDR(pde));
+  if((mem = khugealloc()) != 0){
+    memmove(mem, src, HUGEPGSIZE);
+    d[PDX(va)] = v2p(mem) | PTE_FLAGS(pde);
+    return 0;
+  }
+  for(i = 0; i < HUGEPGSIZE && va + i < sz; i += PGSIZE){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, src + i, PGSIZE);
+    if(mappages(d, (void*)(va + i), PGSIZE, v2p(mem), PTE_W|PTE_U) < 0){
+      kfree(mem);
+      return -1;
+    }
+  }
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
 // of it for a child.
 pde_t*
@@ -320,12 +384,27 @@ copyuvm(pde_t *pgdir, uint sz)
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
+    if(pgdir[PDX(i)] & PTE_PS){
+      if(copyhuge(pgdir[PDX(i)], d, i, sz) < 0)
+        goto bad;
+      i += HUGEPGSIZE - PGSIZE;
+      continue;
+    }
     if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
       panic("copyuvm: pte should exist");
     if(!(*pte & PTE_P))
       panic("copyuvm: page not present");
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
+    if(flags & PTE_SHARED){
+      if(kref(p2v(pa)) < 0)
+        goto bad;
+      if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0){
+        kfree(p2v(pa));
+        goto bad;
+      }
+      continue;
+    }
     if((mem = kalloc()) == 0)
       goto bad;
     memmove(mem, (char*)p2v(pa), PGSIZE);
@@ -339,6 +418,91 @@ bad:
   return 0;
 }
 
+// Map the n user pages at va in page table src into page table dst
+// at dva, without copying. If share is set both mappings are marked
+// PTE_SHARED so that fork shares rather than copies them. Returns 0,
+// or -1 with dst unchanged if a page table page could not be allocated,
+// a page is part of a large page or has too many references.
+int
+shareuvm(pde_t *src, uintp va, uintp n, pde_t *dst, uintp dva, int share)
+{
+  pte_t *pte;
+  uintp i, pa, flags;
+
+  for(i = 0; i < n; i++)
+    if(src[PDX(va + i*PGSIZE)] & PTE_PS)
+      return -1;
+  for(i = 0; i < n; i++){
+    if((pte = walkpgdir(src, (void*)(va + i*PGSIZE), 0)) == 0 || !(*pte & PTE_P))
+      panic("shareuvm: page not present");
+    if(share)
+      *pte |= PTE_SHARED;
+    pa = PTE_ADDR(*pte);
+    flags = PTE_FLAGS(*pte) & (PTE_W|PTE_U|PTE_SHARED);
+    if(kref(p2v(pa)) < 0){
+      deallocuvm(dst, dva + i*PGSIZE, dva);
+      return -1;
+    }
+    if(mappages(dst, (void*)(dva + i*PGSIZE), PGSIZE, pa, flags) < 0){
+      kfree(p2v(pa));
+      deallocuvm(dst, dva + i*PGSIZE, dva);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// First address at which pages can be mapped above a process of
+// size sz: its page-rounded size, or the end of the large page sz
+// ends in, which deallocuvm keeps mapped whole.
+uintp
+mapbase(pde_t *pgdir, uintp sz)
+{
+  if(sz < USERTOP && (pgdir[PDX(sz)] & PTE_PS))
+    return HUGEPGROUNDUP(sz);
+  return PGROUNDUP(sz);
+}
+
+// Map the kernel page mem writable at user address va in pgdir,
+// tagged PTE_SHARED.  Returns 0, or -1 if out of memory or mem
+// has too many references.
+int
+mapshared(pde_t *pgdir, uintp va, char *mem)
+{
+  if(kref(mem) < 0)
+    return -1;
+  if(mappages(pgdir, (void*)va, PGSIZE, v2p(mem), PTE_W|PTE_U|PTE_SHARED) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Map the shared vdso page and the process's vproc page read-only
+// into pgdir.  Returns 0, or -1 if out of memory.
+int
+mapvdso(pde_t *pgdir, char *vproc)
+{
+  if(mappages(pgdir, (void*)VDSO, PGSIZE, v2p(vdsopage), PTE_U) < 0 ||
+     mappages(pgdir, (void*)VPROC, PGSIZE, v2p(vproc), PTE_U) < 0)
+    return -1;
+  return 0;
+}
+
+// Publish timer tick t in the vdso page, timing the TSC against
+// the first CALTICKS ticks.  Called by the CPU that counts ticks.
+void
+vdsotick(uint t)
+{
+  static unsigned long long tsc0;
+
+  if(t == 1)
+    tsc0 = rdtsc();
+  else if(t == 1 + CALTICKS)
+    vdso->tscticks = (rdtsc() - tsc0) / CALTICKS;
+  vdso->ticks = t;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -32,14 +32,15 @@
 #include "proc.h"
 #include "elf.h"
 
- struct cpu *cpu;
- struct proc *proc;
+__thread struct cpu *cpu;
+__thread struct proc *proc;
 
 pde_t *kpml4;
 static pde_t *kpdpt;
 static pde_t *iopgdir;
 static pde_t *kpgdir0;
 static pde_t *kpgdir1;
+static int haveinvpcid;  // CPU has the INVPCID instruction
 
 
 void tvinit(void) {}
@@ -73,9 +74,10 @@ seginit(void)
 {
   uint64 *gdt;
   uint *tss;
-  uint64 addr;
+  uint64 addr, *tp;
   void *local;
   struct cpu *c;
+  uint eax, ebx, ecx, edx;
   uint *idt = (uint*) kalloc();
   int n;
   memset(idt, 0, PGSIZE);
@@ -97,14 +99,24 @@ seginit(void)
   *((unsigned long long *)(&(tss[13]))) = (unsigned long long)kalloc();
   tss[16] = 0x00680000; // IO Map Base = End of TSS
 
-  // point FS smack in the middle of our local storage page
-  wrmsr(0xC0000100, ((uint64) local) + (PGSIZE / 2));
+  // point FS smack in the middle of our local storage page, which
+  // holds a pointer to itself there.  KERNEL_GS_BASE keeps a copy
+  // that user code cannot change, for fixfs in trapasm64.S.  The
+  // word after it is scratch for syscall_entry.
+  tp = (uint64*) (((char*) local) + (PGSIZE / 2));
+  *tp = (uint64) tp;
+  wrmsr(0xC0000100, (uint64) tp);
+  wrmsr(0xC0000102, (uint64) tp);
 
   c = &cpus[cpunum()];
   c->local = local;
 
   cpu = c;
   proc = 0;
+  c->pcidgen = 1;
+  c->pcidnext = 1;
+  cpuid(7, 0, &eax, &ebx, &ecx, &edx);
+  haveinvpcid = (ebx >> 10) & 1;
 
   addr = (uint64) tss;
   gdt[0] =         0x0000000000000000;
@@ -121,6 +133,12 @@ seginit(void)
   lgdt((void*) gdt, 8 * sizeof(uint64));
 
   ltr(SEG_TSS << 3);
+
+  // Keep a kernel selector in %fs: user code cannot load it, so
+  // entry code can tell whether the base is still ours.  Loading
+  // it zeroes the base, so set that again.
+  loadfs(SEG_KDATA << 3);
+  wrmsr(0xC0000100, (uint64) tp);
 };
 
 // The core xv6 code only knows about two levels of page tables,
@@ -161,6 +179,9 @@ setupkvm(void)
 // space for scheduler processes.
 //
 // linear map the first 4GB of physical memory starting at 0xFFFFFFFF80000000
+//
+// Every process shares these mappings, so they are global: with
+// CR4.PGE set their TLB entries survive CR3 loads.
 void
 kvmalloc(void)
 {
@@ -178,11 +199,11 @@ kvmalloc(void)
   kpdpt[510] = v2p(kpgdir0) | PTE_P | PTE_W;
   kpdpt[509] = v2p(iopgdir) | PTE_P | PTE_W;
   for (n = 0; n < NPDENTRIES; n++) {
-    kpgdir0[n] = (n << PDXSHIFT) | PTE_PS | PTE_P | PTE_W;
-    kpgdir1[n] = ((n + 512) << PDXSHIFT) | PTE_PS | PTE_P | PTE_W;
+    kpgdir0[n] = (n << PDXSHIFT) | PTE_PS | PTE_P | PTE_W | PTE_G;
+    kpgdir1[n] = ((n + 512) << PDXSHIFT) | PTE_PS | PTE_P | PTE_W | PTE_G;
   }
   for (n = 0; n < 16; n++)
-    iopgdir[n] = (DEVSPACE + (n << PDXSHIFT)) | PTE_PS | PTE_P | PTE_W | PTE_PWT | PTE_PCD;
+    iopgdir[n] = (DEVSPACE + (n << PDXSHIFT)) | PTE_PS | PTE_P | PTE_W | PTE_PWT | PTE_PCD | PTE_G;
   switchkvm();
 }
 
@@ -192,28 +213,95 @@ switchkvm()
   lcr3(CR3_ENTRY_INVALIDATE(0,v2p(kpml4)));
 }
 
+// Ranges up to this many pages are invalidated page by page.
+#define TLBINVAL_PAGES 32
+
+// Throw away the TLB entries of every PCID.  Turning CR4.PCIDE
+// off does that, and it can only be turned back on with PCID 0
+// loaded.
+static void
+pcidflush(void)
+{
+  uintp cr4;
+
+  cr4 = rcr4();
+  lcr3(v2p(kpml4));
+  lcr4(cr4 & ~CR4_PCIDE);
+  lcr4(cr4);
+}
+
+// Load p's page table under its PCID on this CPU, first giving it
+// a fresh one if it has none from the CPU's current generation.
+// PCIDs are not reused within a generation, so a fresh one holds
+// no stale translations and no load needs to flush; when all
+// NPCIDS are used up a new generation starts with a single full
+// flush.  Runs with interrupts off, as callers such as the cr3
+// system calls may be preempted onto another CPU midway.
 void
-switchuvm(struct proc *p)
+loadcr3(struct proc *p)
 {
+  unsigned long long *pcid;
   void *pml4;
+
+  pushcli();
+  pcid = &p->pcid[cpu->id];
+  if(unlikely(*pcid >> PCID_BITS != cpu->pcidgen)){
+    if(cpu->pcidnext > NPCIDS){
+      pcidflush();
+      cpu->pcidgen++;
+      cpu->pcidnext = 1;
+    }
+    *pcid = cpu->pcidgen << PCID_BITS | cpu->pcidnext++;
+  }
+  pml4 = (void*) PTE_ADDR(p->pgdir[511]);
+  lcr3(CR3_ENTRY_PRESERVE(*pcid & PCID_MASK, v2p(pml4)));
+  popcli();
+}
+
+// Drop the translations p may have cached for the n bytes of
+// user memory at va, or for all of it if n is 0, after their
+// mappings changed.  On this CPU INVPCID removes just those
+// entries, a page at a time for small ranges; other CPUs, which
+// are not running p, just forget its PCID.  Without INVPCID p
+// gets a fresh PCID here too.
+void
+tlbinval(struct proc *p, uintp va, uintp n)
+{
+  unsigned long long pcid;
+  uintp a;
+  int i;
+
+  pushcli();
+  for(i = 0; i < NCPU; i++)
+    if(i != cpu->id)
+      p->pcid[i] = 0;
+  // Nothing is cached under a PCID from an earlier generation.
+  pcid = p->pcid[cpu->id];
+  if(pcid >> PCID_BITS == cpu->pcidgen){
+    if(!haveinvpcid){
+      p->pcid[cpu->id] = 0;
+      if(p == proc)
+        loadcr3(p);
+    } else if(n == 0 || n > TLBINVAL_PAGES*PGSIZE){
+      invpcid(INVPCID_CTX, pcid & PCID_MASK, 0);
+    } else {
+      for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE)
+        invpcid(INVPCID_ADDR, pcid & PCID_MASK, a);
+    }
+  }
+  popcli();
+}
+
+void
+switchuvm(struct proc *p)
+{
   uint *tss;
   pushcli();
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
   tss = (uint*) (((char*) cpu->local) + 1024);
-  tss_set_rsp(tss, 0, (uintp)proc->kstack + KSTACKSIZE);
-  pml4 = (void*) PTE_ADDR(p->pgdir[511]);
-  if(unlikely(proc->pcid+NPCIDS<pcid_counter)){
-    proc->pcid = pcid_counter;
-    pcid_counter+=1;
-    lcr3(CR3_ENTRY_INVALIDATE((proc->pcid%NPCIDS + 1), v2p(pml4)));
-  }
-  else{
-    //outb(0xf4, 0x00);
-    lcr3(CR3_ENTRY_PRESERVE((proc->pcid%NPCIDS + 1), v2p(pml4)));
-
-    
-  }
+  tss_set_rsp(tss, 0, (uintp)p->kstack + KSTACKSIZE);
+  loadcr3(p);
   popcli();
 }
 
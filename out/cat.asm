@@ -0,0 +1,1789 @@
+
+fs/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+       b:	eb 16                	jmp    23 <cat+0x23>
+    write(1, buf, n);
+       d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      10:	89 c2                	mov    %eax,%edx
+      12:	48 c7 c6 a0 13 00 00 	mov    $0x13a0,%rsi
+      19:	bf 01 00 00 00       	mov    $0x1,%edi
+      1e:	e8 18 04 00 00       	call   43b <write>
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+      23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      26:	ba 00 02 00 00       	mov    $0x200,%edx
+      2b:	48 c7 c6 a0 13 00 00 	mov    $0x13a0,%rsi
+      32:	89 c7                	mov    %eax,%edi
+      34:	e8 f8 03 00 00       	call   431 <read>
+      39:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      3c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      40:	7f cb                	jg     d <cat+0xd>
+  if(n < 0){
+      42:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      46:	79 1b                	jns    63 <cat+0x63>
+    printf(1, "cat: read error\n");
+      48:	48 c7 c6 42 10 00 00 	mov    $0x1042,%rsi
+      4f:	bf 01 00 00 00       	mov    $0x1,%edi
+      54:	b8 00 00 00 00       	mov    $0x0,%eax
+      59:	e8 28 08 00 00       	call   886 <printf>
+    exit();
+      5e:	e8 b0 03 00 00       	call   413 <exit>
+  }
+}
+      63:	90                   	nop
+      64:	c9                   	leave
+      65:	c3                   	ret
+
+0000000000000066 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      66:	55                   	push   %rbp
+      67:	48 89 e5             	mov    %rsp,%rbp
+      6a:	48 83 ec 20          	sub    $0x20,%rsp
+      6e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      71:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, i;
+
+  if(argc <= 1){
+      75:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+      79:	7f 0f                	jg     8a <main+0x24>
+    cat(0);
+      7b:	bf 00 00 00 00       	mov    $0x0,%edi
+      80:	e8 7b ff ff ff       	call   0 <cat>
+    exit();
+      85:	e8 89 03 00 00       	call   413 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+      8a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+      91:	eb 7a                	jmp    10d <main+0xa7>
+    if((fd = open(argv[i], 0)) < 0){
+      93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      96:	48 98                	cltq
+      98:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      9f:	00 
+      a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      a4:	48 01 d0             	add    %rdx,%rax
+      a7:	48 8b 00             	mov    (%rax),%rax
+      aa:	be 00 00 00 00       	mov    $0x0,%esi
+      af:	48 89 c7             	mov    %rax,%rdi
+      b2:	e8 ac 03 00 00       	call   463 <open>
+      b7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      ba:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      be:	79 35                	jns    f5 <main+0x8f>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      c3:	48 98                	cltq
+      c5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      cc:	00 
+      cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      d1:	48 01 d0             	add    %rdx,%rax
+      d4:	48 8b 00             	mov    (%rax),%rax
+      d7:	48 89 c2             	mov    %rax,%rdx
+      da:	48 c7 c6 53 10 00 00 	mov    $0x1053,%rsi
+      e1:	bf 01 00 00 00       	mov    $0x1,%edi
+      e6:	b8 00 00 00 00       	mov    $0x0,%eax
+      eb:	e8 96 07 00 00       	call   886 <printf>
+      exit();
+      f0:	e8 1e 03 00 00       	call   413 <exit>
+    }
+    cat(fd);
+      f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      f8:	89 c7                	mov    %eax,%edi
+      fa:	e8 01 ff ff ff       	call   0 <cat>
+    close(fd);
+      ff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     102:	89 c7                	mov    %eax,%edi
+     104:	e8 3c 03 00 00       	call   445 <close>
+  for(i = 1; i < argc; i++){
+     109:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     10d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     110:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     113:	0f 8c 7a ff ff ff    	jl     93 <main+0x2d>
+  }
+  exit();
+     119:	e8 f5 02 00 00       	call   413 <exit>
+
+000000000000011e <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     11e:	55                   	push   %rbp
+     11f:	48 89 e5             	mov    %rsp,%rbp
+     122:	48 83 ec 10          	sub    $0x10,%rsp
+     126:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     12a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     12d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     130:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     134:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     137:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     13a:	48 89 ce             	mov    %rcx,%rsi
+     13d:	48 89 f7             	mov    %rsi,%rdi
+     140:	89 d1                	mov    %edx,%ecx
+     142:	fc                   	cld
+     143:	f3 aa                	rep stos %al,%es:(%rdi)
+     145:	89 ca                	mov    %ecx,%edx
+     147:	48 89 fe             	mov    %rdi,%rsi
+     14a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     14e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     151:	90                   	nop
+     152:	c9                   	leave
+     153:	c3                   	ret
+
+0000000000000154 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     154:	55                   	push   %rbp
+     155:	48 89 e5             	mov    %rsp,%rbp
+     158:	48 83 ec 20          	sub    $0x20,%rsp
+     15c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     160:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     164:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     168:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     16c:	90                   	nop
+     16d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     171:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     175:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     179:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     17d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     181:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     185:	0f b6 12             	movzbl (%rdx),%edx
+     188:	88 10                	mov    %dl,(%rax)
+     18a:	0f b6 00             	movzbl (%rax),%eax
+     18d:	84 c0                	test   %al,%al
+     18f:	75 dc                	jne    16d <strcpy+0x19>
+    ;
+  return os;
+     191:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     195:	c9                   	leave
+     196:	c3                   	ret
+
+0000000000000197 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     197:	55                   	push   %rbp
+     198:	48 89 e5             	mov    %rsp,%rbp
+     19b:	48 83 ec 10          	sub    $0x10,%rsp
+     19f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     1a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     1a7:	eb 0a                	jmp    1b3 <strcmp+0x1c>
+    p++, q++;
+     1a9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     1ae:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     1b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     1b7:	0f b6 00             	movzbl (%rax),%eax
+     1ba:	84 c0                	test   %al,%al
+     1bc:	74 12                	je     1d0 <strcmp+0x39>
+     1be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     1c2:	0f b6 10             	movzbl (%rax),%edx
+     1c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1c9:	0f b6 00             	movzbl (%rax),%eax
+     1cc:	38 c2                	cmp    %al,%dl
+     1ce:	74 d9                	je     1a9 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     1d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     1d4:	0f b6 00             	movzbl (%rax),%eax
+     1d7:	0f b6 d0             	movzbl %al,%edx
+     1da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1de:	0f b6 00             	movzbl (%rax),%eax
+     1e1:	0f b6 c0             	movzbl %al,%eax
+     1e4:	29 c2                	sub    %eax,%edx
+     1e6:	89 d0                	mov    %edx,%eax
+}
+     1e8:	c9                   	leave
+     1e9:	c3                   	ret
+
+00000000000001ea <strlen>:
+
+uint
+strlen(char *s)
+{
+     1ea:	55                   	push   %rbp
+     1eb:	48 89 e5             	mov    %rsp,%rbp
+     1ee:	48 83 ec 18          	sub    $0x18,%rsp
+     1f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     1f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     1fd:	eb 04                	jmp    203 <strlen+0x19>
+     1ff:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     203:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     206:	48 63 d0             	movslq %eax,%rdx
+     209:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     20d:	48 01 d0             	add    %rdx,%rax
+     210:	0f b6 00             	movzbl (%rax),%eax
+     213:	84 c0                	test   %al,%al
+     215:	75 e8                	jne    1ff <strlen+0x15>
+    ;
+  return n;
+     217:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     21a:	c9                   	leave
+     21b:	c3                   	ret
+
+000000000000021c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     21c:	55                   	push   %rbp
+     21d:	48 89 e5             	mov    %rsp,%rbp
+     220:	48 83 ec 10          	sub    $0x10,%rsp
+     224:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     228:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     22b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     22e:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     231:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     234:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     238:	89 ce                	mov    %ecx,%esi
+     23a:	48 89 c7             	mov    %rax,%rdi
+     23d:	e8 dc fe ff ff       	call   11e <stosb>
+  return dst;
+     242:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     246:	c9                   	leave
+     247:	c3                   	ret
+
+0000000000000248 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     248:	55                   	push   %rbp
+     249:	48 89 e5             	mov    %rsp,%rbp
+     24c:	48 83 ec 10          	sub    $0x10,%rsp
+     250:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     254:	89 f0                	mov    %esi,%eax
+     256:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     259:	eb 17                	jmp    272 <strchr+0x2a>
+    if(*s == c)
+     25b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     25f:	0f b6 00             	movzbl (%rax),%eax
+     262:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     265:	75 06                	jne    26d <strchr+0x25>
+      return (char*)s;
+     267:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     26b:	eb 15                	jmp    282 <strchr+0x3a>
+  for(; *s; s++)
+     26d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     272:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     276:	0f b6 00             	movzbl (%rax),%eax
+     279:	84 c0                	test   %al,%al
+     27b:	75 de                	jne    25b <strchr+0x13>
+  return 0;
+     27d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     282:	c9                   	leave
+     283:	c3                   	ret
+
+0000000000000284 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     284:	55                   	push   %rbp
+     285:	48 89 e5             	mov    %rsp,%rbp
+     288:	48 83 ec 20          	sub    $0x20,%rsp
+     28c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     290:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     293:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     29a:	eb 48                	jmp    2e4 <gets+0x60>
+    cc = read(0, &c, 1);
+     29c:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     2a0:	ba 01 00 00 00       	mov    $0x1,%edx
+     2a5:	48 89 c6             	mov    %rax,%rsi
+     2a8:	bf 00 00 00 00       	mov    $0x0,%edi
+     2ad:	e8 7f 01 00 00       	call   431 <read>
+     2b2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     2b5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     2b9:	7e 36                	jle    2f1 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     2bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2be:	8d 50 01             	lea    0x1(%rax),%edx
+     2c1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     2c4:	48 63 d0             	movslq %eax,%rdx
+     2c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     2cb:	48 01 c2             	add    %rax,%rdx
+     2ce:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     2d2:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     2d4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     2d8:	3c 0a                	cmp    $0xa,%al
+     2da:	74 16                	je     2f2 <gets+0x6e>
+     2dc:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     2e0:	3c 0d                	cmp    $0xd,%al
+     2e2:	74 0e                	je     2f2 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     2e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2e7:	83 c0 01             	add    $0x1,%eax
+     2ea:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     2ed:	7f ad                	jg     29c <gets+0x18>
+     2ef:	eb 01                	jmp    2f2 <gets+0x6e>
+      break;
+     2f1:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     2f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2f5:	48 63 d0             	movslq %eax,%rdx
+     2f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     2fc:	48 01 d0             	add    %rdx,%rax
+     2ff:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     302:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     306:	c9                   	leave
+     307:	c3                   	ret
+
+0000000000000308 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     308:	55                   	push   %rbp
+     309:	48 89 e5             	mov    %rsp,%rbp
+     30c:	48 83 ec 20          	sub    $0x20,%rsp
+     310:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     314:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     318:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     31c:	be 00 00 00 00       	mov    $0x0,%esi
+     321:	48 89 c7             	mov    %rax,%rdi
+     324:	e8 3a 01 00 00       	call   463 <open>
+     329:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     32c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     330:	79 07                	jns    339 <stat+0x31>
+    return -1;
+     332:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     337:	eb 21                	jmp    35a <stat+0x52>
+  r = fstat(fd, st);
+     339:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     33d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     340:	48 89 d6             	mov    %rdx,%rsi
+     343:	89 c7                	mov    %eax,%edi
+     345:	e8 37 01 00 00       	call   481 <fstat>
+     34a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     34d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     350:	89 c7                	mov    %eax,%edi
+     352:	e8 ee 00 00 00       	call   445 <close>
+  return r;
+     357:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     35a:	c9                   	leave
+     35b:	c3                   	ret
+
+000000000000035c <atoi>:
+
+int
+atoi(const char *s)
+{
+     35c:	55                   	push   %rbp
+     35d:	48 89 e5             	mov    %rsp,%rbp
+     360:	48 83 ec 18          	sub    $0x18,%rsp
+     364:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     368:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     36f:	eb 28                	jmp    399 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     371:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     374:	89 d0                	mov    %edx,%eax
+     376:	c1 e0 02             	shl    $0x2,%eax
+     379:	01 d0                	add    %edx,%eax
+     37b:	01 c0                	add    %eax,%eax
+     37d:	89 c1                	mov    %eax,%ecx
+     37f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     383:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     387:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     38b:	0f b6 00             	movzbl (%rax),%eax
+     38e:	0f be c0             	movsbl %al,%eax
+     391:	01 c8                	add    %ecx,%eax
+     393:	83 e8 30             	sub    $0x30,%eax
+     396:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     399:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     39d:	0f b6 00             	movzbl (%rax),%eax
+     3a0:	3c 2f                	cmp    $0x2f,%al
+     3a2:	7e 0b                	jle    3af <atoi+0x53>
+     3a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3a8:	0f b6 00             	movzbl (%rax),%eax
+     3ab:	3c 39                	cmp    $0x39,%al
+     3ad:	7e c2                	jle    371 <atoi+0x15>
+  return n;
+     3af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     3b2:	c9                   	leave
+     3b3:	c3                   	ret
+
+00000000000003b4 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     3b4:	55                   	push   %rbp
+     3b5:	48 89 e5             	mov    %rsp,%rbp
+     3b8:	48 83 ec 28          	sub    $0x28,%rsp
+     3bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     3c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     3c4:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     3c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     3cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     3d3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     3d7:	eb 1d                	jmp    3f6 <memmove+0x42>
+    *dst++ = *src++;
+     3d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     3dd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     3e1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     3e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3e9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     3ed:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     3f1:	0f b6 12             	movzbl (%rdx),%edx
+     3f4:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     3f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     3f9:	8d 50 ff             	lea    -0x1(%rax),%edx
+     3fc:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     3ff:	85 c0                	test   %eax,%eax
+     401:	7f d6                	jg     3d9 <memmove+0x25>
+  return vdst;
+     403:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     407:	c9                   	leave
+     408:	c3                   	ret
+
+0000000000000409 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     409:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     410:	cd 40                	int    $0x40
+     412:	c3                   	ret
+
+0000000000000413 <exit>:
+SYSCALL_FAST(exit)
+     413:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     41a:	0f 05                	syscall
+     41c:	c3                   	ret
+
+000000000000041d <wait>:
+SYSCALL_FAST(wait)
+     41d:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     424:	0f 05                	syscall
+     426:	c3                   	ret
+
+0000000000000427 <pipe>:
+SYSCALL_FAST(pipe)
+     427:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     42e:	0f 05                	syscall
+     430:	c3                   	ret
+
+0000000000000431 <read>:
+SYSCALL_FAST(read)
+     431:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     438:	0f 05                	syscall
+     43a:	c3                   	ret
+
+000000000000043b <write>:
+SYSCALL_FAST(write)
+     43b:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     442:	0f 05                	syscall
+     444:	c3                   	ret
+
+0000000000000445 <close>:
+SYSCALL_FAST(close)
+     445:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     44c:	0f 05                	syscall
+     44e:	c3                   	ret
+
+000000000000044f <kill>:
+SYSCALL_FAST(kill)
+     44f:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     456:	0f 05                	syscall
+     458:	c3                   	ret
+
+0000000000000459 <exec>:
+SYSCALL(exec)
+     459:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     460:	cd 40                	int    $0x40
+     462:	c3                   	ret
+
+0000000000000463 <open>:
+SYSCALL_FAST(open)
+     463:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     46a:	0f 05                	syscall
+     46c:	c3                   	ret
+
+000000000000046d <mknod>:
+SYSCALL_FAST(mknod)
+     46d:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     474:	0f 05                	syscall
+     476:	c3                   	ret
+
+0000000000000477 <unlink>:
+SYSCALL_FAST(unlink)
+     477:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     47e:	0f 05                	syscall
+     480:	c3                   	ret
+
+0000000000000481 <fstat>:
+SYSCALL_FAST(fstat)
+     481:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     488:	0f 05                	syscall
+     48a:	c3                   	ret
+
+000000000000048b <link>:
+SYSCALL_FAST(link)
+     48b:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     492:	0f 05                	syscall
+     494:	c3                   	ret
+
+0000000000000495 <mkdir>:
+SYSCALL_FAST(mkdir)
+     495:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     49c:	0f 05                	syscall
+     49e:	c3                   	ret
+
+000000000000049f <chdir>:
+SYSCALL_FAST(chdir)
+     49f:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     4a6:	0f 05                	syscall
+     4a8:	c3                   	ret
+
+00000000000004a9 <dup>:
+SYSCALL_FAST(dup)
+     4a9:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     4b0:	0f 05                	syscall
+     4b2:	c3                   	ret
+
+00000000000004b3 <sbrk>:
+SYSCALL_FAST(sbrk)
+     4b3:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     4ba:	0f 05                	syscall
+     4bc:	c3                   	ret
+
+00000000000004bd <sleep>:
+SYSCALL_FAST(sleep)
+     4bd:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     4c4:	0f 05                	syscall
+     4c6:	c3                   	ret
+
+00000000000004c7 <send>:
+SYSCALL_FAST(send)
+     4c7:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     4ce:	0f 05                	syscall
+     4d0:	c3                   	ret
+
+00000000000004d1 <send_recv>:
+SYSCALL_FAST(send_recv)
+     4d1:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     4d8:	0f 05                	syscall
+     4da:	c3                   	ret
+
+00000000000004db <recv>:
+SYSCALL_FAST(recv)
+     4db:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     4e2:	0f 05                	syscall
+     4e4:	c3                   	ret
+
+00000000000004e5 <call>:
+SYSCALL_FAST(call)
+     4e5:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     4ec:	0f 05                	syscall
+     4ee:	c3                   	ret
+
+00000000000004ef <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     4ef:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     4f6:	0f 05                	syscall
+     4f8:	c3                   	ret
+
+00000000000004f9 <send_reg>:
+SYSCALL_REG(send_reg)
+     4f9:	41 54                	push   %r12
+     4fb:	41 55                	push   %r13
+     4fd:	41 56                	push   %r14
+     4ff:	41 57                	push   %r15
+     501:	56                   	push   %rsi
+     502:	49 89 f3             	mov    %rsi,%r11
+     505:	48 89 d6             	mov    %rdx,%rsi
+     508:	49 8b 13             	mov    (%r11),%rdx
+     50b:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     50f:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     513:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     517:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     51b:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     51f:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     523:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     527:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     52e:	0f 05                	syscall
+     530:	41 5b                	pop    %r11
+     532:	49 89 13             	mov    %rdx,(%r11)
+     535:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     539:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     53d:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     541:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     545:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     549:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     54d:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     551:	41 5f                	pop    %r15
+     553:	41 5e                	pop    %r14
+     555:	41 5d                	pop    %r13
+     557:	41 5c                	pop    %r12
+     559:	c3                   	ret
+
+000000000000055a <recv_reg>:
+SYSCALL_REG(recv_reg)
+     55a:	41 54                	push   %r12
+     55c:	41 55                	push   %r13
+     55e:	41 56                	push   %r14
+     560:	41 57                	push   %r15
+     562:	56                   	push   %rsi
+     563:	49 89 f3             	mov    %rsi,%r11
+     566:	48 89 d6             	mov    %rdx,%rsi
+     569:	49 8b 13             	mov    (%r11),%rdx
+     56c:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     570:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     574:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     578:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     57c:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     580:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     584:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     588:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+     58f:	0f 05                	syscall
+     591:	41 5b                	pop    %r11
+     593:	49 89 13             	mov    %rdx,(%r11)
+     596:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     59a:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     59e:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     5a2:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     5a6:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     5aa:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     5ae:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     5b2:	41 5f                	pop    %r15
+     5b4:	41 5e                	pop    %r14
+     5b6:	41 5d                	pop    %r13
+     5b8:	41 5c                	pop    %r12
+     5ba:	c3                   	ret
+
+00000000000005bb <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+     5bb:	41 54                	push   %r12
+     5bd:	41 55                	push   %r13
+     5bf:	41 56                	push   %r14
+     5c1:	41 57                	push   %r15
+     5c3:	56                   	push   %rsi
+     5c4:	49 89 f3             	mov    %rsi,%r11
+     5c7:	48 89 d6             	mov    %rdx,%rsi
+     5ca:	49 8b 13             	mov    (%r11),%rdx
+     5cd:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     5d1:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     5d5:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     5d9:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     5dd:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     5e1:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     5e5:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     5e9:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+     5f0:	0f 05                	syscall
+     5f2:	41 5b                	pop    %r11
+     5f4:	49 89 13             	mov    %rdx,(%r11)
+     5f7:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     5fb:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     5ff:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     603:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     607:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     60b:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     60f:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     613:	41 5f                	pop    %r15
+     615:	41 5e                	pop    %r14
+     617:	41 5d                	pop    %r13
+     619:	41 5c                	pop    %r12
+     61b:	c3                   	ret
+
+000000000000061c <call_reg>:
+SYSCALL_REG(call_reg)
+     61c:	41 54                	push   %r12
+     61e:	41 55                	push   %r13
+     620:	41 56                	push   %r14
+     622:	41 57                	push   %r15
+     624:	56                   	push   %rsi
+     625:	49 89 f3             	mov    %rsi,%r11
+     628:	48 89 d6             	mov    %rdx,%rsi
+     62b:	49 8b 13             	mov    (%r11),%rdx
+     62e:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     632:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     636:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     63a:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     63e:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     642:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     646:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     64a:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+     651:	0f 05                	syscall
+     653:	41 5b                	pop    %r11
+     655:	49 89 13             	mov    %rdx,(%r11)
+     658:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     65c:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     660:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     664:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     668:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     66c:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     670:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     674:	41 5f                	pop    %r15
+     676:	41 5e                	pop    %r14
+     678:	41 5d                	pop    %r13
+     67a:	41 5c                	pop    %r12
+     67c:	c3                   	ret
+
+000000000000067d <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+     67d:	41 54                	push   %r12
+     67f:	41 55                	push   %r13
+     681:	41 56                	push   %r14
+     683:	41 57                	push   %r15
+     685:	56                   	push   %rsi
+     686:	49 89 f3             	mov    %rsi,%r11
+     689:	48 89 d6             	mov    %rdx,%rsi
+     68c:	49 8b 13             	mov    (%r11),%rdx
+     68f:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     693:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     697:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     69b:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     69f:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     6a3:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     6a7:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     6ab:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+     6b2:	0f 05                	syscall
+     6b4:	41 5b                	pop    %r11
+     6b6:	49 89 13             	mov    %rdx,(%r11)
+     6b9:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     6bd:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     6c1:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     6c5:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     6c9:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     6cd:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     6d1:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     6d5:	41 5f                	pop    %r15
+     6d7:	41 5e                	pop    %r14
+     6d9:	41 5d                	pop    %r13
+     6db:	41 5c                	pop    %r12
+     6dd:	c3                   	ret
+
+00000000000006de <sendx>:
+SYSCALL_FAST(sendx)
+     6de:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+     6e5:	0f 05                	syscall
+     6e7:	c3                   	ret
+
+00000000000006e8 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+     6e8:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+     6ef:	0f 05                	syscall
+     6f1:	c3                   	ret
+
+00000000000006f2 <notify>:
+SYSCALL_FAST(notify)
+     6f2:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+     6f9:	0f 05                	syscall
+     6fb:	c3                   	ret
+
+00000000000006fc <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+     6fc:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+     703:	0f 05                	syscall
+     705:	c3                   	ret
+
+0000000000000706 <send_timed>:
+SYSCALL_FAST(send_timed)
+     706:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+     70d:	0f 05                	syscall
+     70f:	c3                   	ret
+
+0000000000000710 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+     710:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+     717:	0f 05                	syscall
+     719:	c3                   	ret
+
+000000000000071a <set_add>:
+SYSCALL_FAST(set_add)
+     71a:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+     721:	0f 05                	syscall
+     723:	c3                   	ret
+
+0000000000000724 <set_del>:
+SYSCALL_FAST(set_del)
+     724:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+     72b:	0f 05                	syscall
+     72d:	c3                   	ret
+
+000000000000072e <recv_any>:
+SYSCALL_FAST(recv_any)
+     72e:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+     735:	0f 05                	syscall
+     737:	c3                   	ret
+
+0000000000000738 <ep_create>:
+SYSCALL_FAST(ep_create)
+     738:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+     73f:	0f 05                	syscall
+     741:	c3                   	ret
+
+0000000000000742 <ep_close>:
+SYSCALL_FAST(ep_close)
+     742:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+     749:	0f 05                	syscall
+     74b:	c3                   	ret
+
+000000000000074c <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+     74c:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+     753:	0f 05                	syscall
+     755:	c3                   	ret
+
+0000000000000756 <setprio>:
+SYSCALL_FAST(setprio)
+     756:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+     75d:	0f 05                	syscall
+     75f:	c3                   	ret
+
+0000000000000760 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+     760:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+     767:	0f 05                	syscall
+     769:	c3                   	ret
+
+000000000000076a <sethuge>:
+SYSCALL_FAST(sethuge)
+     76a:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+     771:	0f 05                	syscall
+     773:	c3                   	ret
+
+0000000000000774 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+     774:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+     77b:	0f 05                	syscall
+     77d:	c3                   	ret
+
+000000000000077e <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+     77e:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+     785:	0f 05                	syscall
+     787:	c3                   	ret
+
+0000000000000788 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+     788:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+     78f:	0f 05                	syscall
+     791:	c3                   	ret
+
+0000000000000792 <null_call>:
+     792:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+     799:	0f 05                	syscall
+     79b:	c3                   	ret
+
+000000000000079c <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     79c:	55                   	push   %rbp
+     79d:	48 89 e5             	mov    %rsp,%rbp
+     7a0:	48 83 ec 10          	sub    $0x10,%rsp
+     7a4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     7a7:	89 f0                	mov    %esi,%eax
+     7a9:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     7ac:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     7b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7b3:	ba 01 00 00 00       	mov    $0x1,%edx
+     7b8:	48 89 ce             	mov    %rcx,%rsi
+     7bb:	89 c7                	mov    %eax,%edi
+     7bd:	e8 79 fc ff ff       	call   43b <write>
+}
+     7c2:	90                   	nop
+     7c3:	c9                   	leave
+     7c4:	c3                   	ret
+
+00000000000007c5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     7c5:	55                   	push   %rbp
+     7c6:	48 89 e5             	mov    %rsp,%rbp
+     7c9:	48 83 ec 30          	sub    $0x30,%rsp
+     7cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     7d0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     7d3:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     7d6:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     7d9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     7e0:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     7e4:	74 17                	je     7fd <printint+0x38>
+     7e6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     7ea:	79 11                	jns    7fd <printint+0x38>
+    neg = 1;
+     7ec:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     7f3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     7f6:	f7 d8                	neg    %eax
+     7f8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     7fb:	eb 06                	jmp    803 <printint+0x3e>
+  } else {
+    x = xx;
+     7fd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     800:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     803:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     80a:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     80d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     810:	ba 00 00 00 00       	mov    $0x0,%edx
+     815:	f7 f1                	div    %ecx
+     817:	89 d1                	mov    %edx,%ecx
+     819:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     81c:	8d 50 01             	lea    0x1(%rax),%edx
+     81f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     822:	89 ca                	mov    %ecx,%edx
+     824:	0f b6 92 70 13 00 00 	movzbl 0x1370(%rdx),%edx
+     82b:	48 98                	cltq
+     82d:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     831:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     834:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     837:	ba 00 00 00 00       	mov    $0x0,%edx
+     83c:	f7 f6                	div    %esi
+     83e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     841:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     845:	75 c3                	jne    80a <printint+0x45>
+  if(neg)
+     847:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     84b:	74 2b                	je     878 <printint+0xb3>
+    buf[i++] = '-';
+     84d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     850:	8d 50 01             	lea    0x1(%rax),%edx
+     853:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     856:	48 98                	cltq
+     858:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+     85d:	eb 19                	jmp    878 <printint+0xb3>
+    putc(fd, buf[i]);
+     85f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     862:	48 98                	cltq
+     864:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+     869:	0f be d0             	movsbl %al,%edx
+     86c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     86f:	89 d6                	mov    %edx,%esi
+     871:	89 c7                	mov    %eax,%edi
+     873:	e8 24 ff ff ff       	call   79c <putc>
+  while(--i >= 0)
+     878:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     87c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     880:	79 dd                	jns    85f <printint+0x9a>
+}
+     882:	90                   	nop
+     883:	90                   	nop
+     884:	c9                   	leave
+     885:	c3                   	ret
+
+0000000000000886 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     886:	55                   	push   %rbp
+     887:	48 89 e5             	mov    %rsp,%rbp
+     88a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+     891:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+     897:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+     89e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+     8a5:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+     8ac:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+     8b3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+     8ba:	84 c0                	test   %al,%al
+     8bc:	74 20                	je     8de <printf+0x58>
+     8be:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+     8c2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+     8c6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+     8ca:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+     8ce:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+     8d2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+     8d6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+     8da:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+     8de:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+     8e5:	00 00 00 
+     8e8:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+     8ef:	00 00 00 
+     8f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     8f6:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+     8fd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+     904:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+     90b:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     912:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     915:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+     91c:	00 00 00 
+     91f:	e9 a8 02 00 00       	jmp    bcc <printf+0x346>
+    c = fmt[i] & 0xff;
+     924:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     92a:	48 63 d0             	movslq %eax,%rdx
+     92d:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     934:	48 01 d0             	add    %rdx,%rax
+     937:	0f b6 00             	movzbl (%rax),%eax
+     93a:	0f be c0             	movsbl %al,%eax
+     93d:	25 ff 00 00 00       	and    $0xff,%eax
+     942:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+     948:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+     94f:	75 35                	jne    986 <printf+0x100>
+      if(c == '%'){
+     951:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     958:	75 0f                	jne    969 <printf+0xe3>
+        state = '%';
+     95a:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+     961:	00 00 00 
+     964:	e9 5c 02 00 00       	jmp    bc5 <printf+0x33f>
+      } else {
+        putc(fd, c);
+     969:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     96f:	0f be d0             	movsbl %al,%edx
+     972:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     978:	89 d6                	mov    %edx,%esi
+     97a:	89 c7                	mov    %eax,%edi
+     97c:	e8 1b fe ff ff       	call   79c <putc>
+     981:	e9 3f 02 00 00       	jmp    bc5 <printf+0x33f>
+      }
+    } else if(state == '%'){
+     986:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+     98d:	0f 85 32 02 00 00    	jne    bc5 <printf+0x33f>
+      if(c == 'd'){
+     993:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+     99a:	75 5e                	jne    9fa <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+     99c:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     9a2:	83 f8 2f             	cmp    $0x2f,%eax
+     9a5:	77 23                	ja     9ca <printf+0x144>
+     9a7:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     9ae:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     9b4:	89 d2                	mov    %edx,%edx
+     9b6:	48 01 d0             	add    %rdx,%rax
+     9b9:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     9bf:	83 c2 08             	add    $0x8,%edx
+     9c2:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     9c8:	eb 12                	jmp    9dc <printf+0x156>
+     9ca:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     9d1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     9d5:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     9dc:	8b 30                	mov    (%rax),%esi
+     9de:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     9e4:	b9 01 00 00 00       	mov    $0x1,%ecx
+     9e9:	ba 0a 00 00 00       	mov    $0xa,%edx
+     9ee:	89 c7                	mov    %eax,%edi
+     9f0:	e8 d0 fd ff ff       	call   7c5 <printint>
+     9f5:	e9 c1 01 00 00       	jmp    bbb <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+     9fa:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+     a01:	74 09                	je     a0c <printf+0x186>
+     a03:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+     a0a:	75 5e                	jne    a6a <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+     a0c:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     a12:	83 f8 2f             	cmp    $0x2f,%eax
+     a15:	77 23                	ja     a3a <printf+0x1b4>
+     a17:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     a1e:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a24:	89 d2                	mov    %edx,%edx
+     a26:	48 01 d0             	add    %rdx,%rax
+     a29:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a2f:	83 c2 08             	add    $0x8,%edx
+     a32:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     a38:	eb 12                	jmp    a4c <printf+0x1c6>
+     a3a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     a41:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a45:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     a4c:	8b 30                	mov    (%rax),%esi
+     a4e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     a54:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a59:	ba 10 00 00 00       	mov    $0x10,%edx
+     a5e:	89 c7                	mov    %eax,%edi
+     a60:	e8 60 fd ff ff       	call   7c5 <printint>
+     a65:	e9 51 01 00 00       	jmp    bbb <printf+0x335>
+      } else if(c == 's'){
+     a6a:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+     a71:	0f 85 98 00 00 00    	jne    b0f <printf+0x289>
+        s = va_arg(ap, char*);
+     a77:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     a7d:	83 f8 2f             	cmp    $0x2f,%eax
+     a80:	77 23                	ja     aa5 <printf+0x21f>
+     a82:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     a89:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a8f:	89 d2                	mov    %edx,%edx
+     a91:	48 01 d0             	add    %rdx,%rax
+     a94:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a9a:	83 c2 08             	add    $0x8,%edx
+     a9d:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     aa3:	eb 12                	jmp    ab7 <printf+0x231>
+     aa5:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     aac:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ab0:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     ab7:	48 8b 00             	mov    (%rax),%rax
+     aba:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+     ac1:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+     ac8:	00 
+     ac9:	75 31                	jne    afc <printf+0x276>
+          s = "(null)";
+     acb:	48 c7 85 48 ff ff ff 	movq   $0x1068,-0xb8(%rbp)
+     ad2:	68 10 00 00 
+        while(*s != 0){
+     ad6:	eb 24                	jmp    afc <printf+0x276>
+          putc(fd, *s);
+     ad8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     adf:	0f b6 00             	movzbl (%rax),%eax
+     ae2:	0f be d0             	movsbl %al,%edx
+     ae5:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     aeb:	89 d6                	mov    %edx,%esi
+     aed:	89 c7                	mov    %eax,%edi
+     aef:	e8 a8 fc ff ff       	call   79c <putc>
+          s++;
+     af4:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+     afb:	01 
+        while(*s != 0){
+     afc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     b03:	0f b6 00             	movzbl (%rax),%eax
+     b06:	84 c0                	test   %al,%al
+     b08:	75 ce                	jne    ad8 <printf+0x252>
+     b0a:	e9 ac 00 00 00       	jmp    bbb <printf+0x335>
+        }
+      } else if(c == 'c'){
+     b0f:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+     b16:	75 56                	jne    b6e <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+     b18:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     b1e:	83 f8 2f             	cmp    $0x2f,%eax
+     b21:	77 23                	ja     b46 <printf+0x2c0>
+     b23:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     b2a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b30:	89 d2                	mov    %edx,%edx
+     b32:	48 01 d0             	add    %rdx,%rax
+     b35:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b3b:	83 c2 08             	add    $0x8,%edx
+     b3e:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     b44:	eb 12                	jmp    b58 <printf+0x2d2>
+     b46:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     b4d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     b51:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     b58:	8b 00                	mov    (%rax),%eax
+     b5a:	0f be d0             	movsbl %al,%edx
+     b5d:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b63:	89 d6                	mov    %edx,%esi
+     b65:	89 c7                	mov    %eax,%edi
+     b67:	e8 30 fc ff ff       	call   79c <putc>
+     b6c:	eb 4d                	jmp    bbb <printf+0x335>
+      } else if(c == '%'){
+     b6e:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     b75:	75 1a                	jne    b91 <printf+0x30b>
+        putc(fd, c);
+     b77:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     b7d:	0f be d0             	movsbl %al,%edx
+     b80:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b86:	89 d6                	mov    %edx,%esi
+     b88:	89 c7                	mov    %eax,%edi
+     b8a:	e8 0d fc ff ff       	call   79c <putc>
+     b8f:	eb 2a                	jmp    bbb <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     b91:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b97:	be 25 00 00 00       	mov    $0x25,%esi
+     b9c:	89 c7                	mov    %eax,%edi
+     b9e:	e8 f9 fb ff ff       	call   79c <putc>
+        putc(fd, c);
+     ba3:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     ba9:	0f be d0             	movsbl %al,%edx
+     bac:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     bb2:	89 d6                	mov    %edx,%esi
+     bb4:	89 c7                	mov    %eax,%edi
+     bb6:	e8 e1 fb ff ff       	call   79c <putc>
+      }
+      state = 0;
+     bbb:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     bc2:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     bc5:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+     bcc:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     bd2:	48 63 d0             	movslq %eax,%rdx
+     bd5:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     bdc:	48 01 d0             	add    %rdx,%rax
+     bdf:	0f b6 00             	movzbl (%rax),%eax
+     be2:	84 c0                	test   %al,%al
+     be4:	0f 85 3a fd ff ff    	jne    924 <printf+0x9e>
+    }
+  }
+}
+     bea:	90                   	nop
+     beb:	90                   	nop
+     bec:	c9                   	leave
+     bed:	c3                   	ret
+
+0000000000000bee <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     bee:	55                   	push   %rbp
+     bef:	48 89 e5             	mov    %rsp,%rbp
+     bf2:	48 83 ec 18          	sub    $0x18,%rsp
+     bf6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bfe:	48 83 e8 10          	sub    $0x10,%rax
+     c02:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c06:	48 8b 05 a3 09 00 00 	mov    0x9a3(%rip),%rax        # 15b0 <freep>
+     c0d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     c11:	eb 2f                	jmp    c42 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     c13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c17:	48 8b 00             	mov    (%rax),%rax
+     c1a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c1e:	72 17                	jb     c37 <free+0x49>
+     c20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c24:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c28:	72 2f                	jb     c59 <free+0x6b>
+     c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c2e:	48 8b 00             	mov    (%rax),%rax
+     c31:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     c35:	72 22                	jb     c59 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c3b:	48 8b 00             	mov    (%rax),%rax
+     c3e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     c42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c46:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c4a:	73 c7                	jae    c13 <free+0x25>
+     c4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c50:	48 8b 00             	mov    (%rax),%rax
+     c53:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     c57:	73 ba                	jae    c13 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     c59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c5d:	8b 40 08             	mov    0x8(%rax),%eax
+     c60:	89 c0                	mov    %eax,%eax
+     c62:	48 c1 e0 04          	shl    $0x4,%rax
+     c66:	48 89 c2             	mov    %rax,%rdx
+     c69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c6d:	48 01 c2             	add    %rax,%rdx
+     c70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c74:	48 8b 00             	mov    (%rax),%rax
+     c77:	48 39 c2             	cmp    %rax,%rdx
+     c7a:	75 2d                	jne    ca9 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+     c7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c80:	8b 50 08             	mov    0x8(%rax),%edx
+     c83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c87:	48 8b 00             	mov    (%rax),%rax
+     c8a:	8b 40 08             	mov    0x8(%rax),%eax
+     c8d:	01 c2                	add    %eax,%edx
+     c8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c93:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     c96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c9a:	48 8b 00             	mov    (%rax),%rax
+     c9d:	48 8b 10             	mov    (%rax),%rdx
+     ca0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ca4:	48 89 10             	mov    %rdx,(%rax)
+     ca7:	eb 0e                	jmp    cb7 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+     ca9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cad:	48 8b 10             	mov    (%rax),%rdx
+     cb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cb4:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     cb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cbb:	8b 40 08             	mov    0x8(%rax),%eax
+     cbe:	89 c0                	mov    %eax,%eax
+     cc0:	48 c1 e0 04          	shl    $0x4,%rax
+     cc4:	48 89 c2             	mov    %rax,%rdx
+     cc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ccb:	48 01 d0             	add    %rdx,%rax
+     cce:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     cd2:	75 27                	jne    cfb <free+0x10d>
+    p->s.size += bp->s.size;
+     cd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cd8:	8b 50 08             	mov    0x8(%rax),%edx
+     cdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cdf:	8b 40 08             	mov    0x8(%rax),%eax
+     ce2:	01 c2                	add    %eax,%edx
+     ce4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ce8:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     ceb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cef:	48 8b 10             	mov    (%rax),%rdx
+     cf2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cf6:	48 89 10             	mov    %rdx,(%rax)
+     cf9:	eb 0b                	jmp    d06 <free+0x118>
+  } else
+    p->s.ptr = bp;
+     cfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d03:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     d06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d0a:	48 89 05 9f 08 00 00 	mov    %rax,0x89f(%rip)        # 15b0 <freep>
+}
+     d11:	90                   	nop
+     d12:	c9                   	leave
+     d13:	c3                   	ret
+
+0000000000000d14 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     d14:	55                   	push   %rbp
+     d15:	48 89 e5             	mov    %rsp,%rbp
+     d18:	48 83 ec 20          	sub    $0x20,%rsp
+     d1c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     d1f:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     d26:	77 07                	ja     d2f <morecore+0x1b>
+    nu = 4096;
+     d28:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     d2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     d32:	c1 e0 04             	shl    $0x4,%eax
+     d35:	89 c7                	mov    %eax,%edi
+     d37:	e8 77 f7 ff ff       	call   4b3 <sbrk>
+     d3c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     d40:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     d45:	75 07                	jne    d4e <morecore+0x3a>
+    return 0;
+     d47:	b8 00 00 00 00       	mov    $0x0,%eax
+     d4c:	eb 29                	jmp    d77 <morecore+0x63>
+  hp = (Header*)p;
+     d4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d52:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     d56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d5a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     d5d:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     d60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d64:	48 83 c0 10          	add    $0x10,%rax
+     d68:	48 89 c7             	mov    %rax,%rdi
+     d6b:	e8 7e fe ff ff       	call   bee <free>
+  return freep;
+     d70:	48 8b 05 39 08 00 00 	mov    0x839(%rip),%rax        # 15b0 <freep>
+}
+     d77:	c9                   	leave
+     d78:	c3                   	ret
+
+0000000000000d79 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     d79:	55                   	push   %rbp
+     d7a:	48 89 e5             	mov    %rsp,%rbp
+     d7d:	48 83 ec 30          	sub    $0x30,%rsp
+     d81:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     d84:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     d87:	48 83 c0 0f          	add    $0xf,%rax
+     d8b:	48 c1 e8 04          	shr    $0x4,%rax
+     d8f:	83 c0 01             	add    $0x1,%eax
+     d92:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+     d95:	48 8b 05 14 08 00 00 	mov    0x814(%rip),%rax        # 15b0 <freep>
+     d9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     da0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     da5:	75 2b                	jne    dd2 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+     da7:	48 c7 45 f0 a0 15 00 	movq   $0x15a0,-0x10(%rbp)
+     dae:	00 
+     daf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     db3:	48 89 05 f6 07 00 00 	mov    %rax,0x7f6(%rip)        # 15b0 <freep>
+     dba:	48 8b 05 ef 07 00 00 	mov    0x7ef(%rip),%rax        # 15b0 <freep>
+     dc1:	48 89 05 d8 07 00 00 	mov    %rax,0x7d8(%rip)        # 15a0 <base>
+    base.s.size = 0;
+     dc8:	c7 05 d6 07 00 00 00 	movl   $0x0,0x7d6(%rip)        # 15a8 <base+0x8>
+     dcf:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     dd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     dd6:	48 8b 00             	mov    (%rax),%rax
+     dd9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     ddd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     de1:	8b 40 08             	mov    0x8(%rax),%eax
+     de4:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     de7:	72 5f                	jb     e48 <malloc+0xcf>
+      if(p->s.size == nunits)
+     de9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ded:	8b 40 08             	mov    0x8(%rax),%eax
+     df0:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     df3:	75 10                	jne    e05 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+     df5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     df9:	48 8b 10             	mov    (%rax),%rdx
+     dfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e00:	48 89 10             	mov    %rdx,(%rax)
+     e03:	eb 2e                	jmp    e33 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+     e05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e09:	8b 40 08             	mov    0x8(%rax),%eax
+     e0c:	2b 45 ec             	sub    -0x14(%rbp),%eax
+     e0f:	89 c2                	mov    %eax,%edx
+     e11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e15:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+     e18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e1c:	8b 40 08             	mov    0x8(%rax),%eax
+     e1f:	89 c0                	mov    %eax,%eax
+     e21:	48 c1 e0 04          	shl    $0x4,%rax
+     e25:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+     e29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e2d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     e30:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+     e33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e37:	48 89 05 72 07 00 00 	mov    %rax,0x772(%rip)        # 15b0 <freep>
+      return (void*)(p + 1);
+     e3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e42:	48 83 c0 10          	add    $0x10,%rax
+     e46:	eb 41                	jmp    e89 <malloc+0x110>
+    }
+    if(p == freep)
+     e48:	48 8b 05 61 07 00 00 	mov    0x761(%rip),%rax        # 15b0 <freep>
+     e4f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e53:	75 1c                	jne    e71 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+     e55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     e58:	89 c7                	mov    %eax,%edi
+     e5a:	e8 b5 fe ff ff       	call   d14 <morecore>
+     e5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e63:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     e68:	75 07                	jne    e71 <malloc+0xf8>
+        return 0;
+     e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e6f:	eb 18                	jmp    e89 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     e79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e7d:	48 8b 00             	mov    (%rax),%rax
+     e80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     e84:	e9 54 ff ff ff       	jmp    ddd <malloc+0x64>
+  }
+}
+     e89:	c9                   	leave
+     e8a:	c3                   	ret
+
+0000000000000e8b <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+     e8b:	55                   	push   %rbp
+     e8c:	48 89 e5             	mov    %rsp,%rbp
+     e8f:	53                   	push   %rbx
+     e90:	48 83 ec 38          	sub    $0x38,%rsp
+     e94:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     e97:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     e9b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+     e9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     ea3:	8b 40 40             	mov    0x40(%rax),%eax
+     ea6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+     ea9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     ead:	8b 00                	mov    (%rax),%eax
+     eaf:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     eb2:	29 c2                	sub    %eax,%edx
+     eb4:	83 fa 20             	cmp    $0x20,%edx
+     eb7:	75 0a                	jne    ec3 <ring_send+0x38>
+    return -1;
+     eb9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ebe:	e9 93 00 00 00       	jmp    f56 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+     ec3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     ec6:	83 e0 1f             	and    $0x1f,%eax
+     ec9:	89 c2                	mov    %eax,%edx
+     ecb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     ecf:	89 d2                	mov    %edx,%edx
+     ed1:	48 83 c2 02          	add    $0x2,%rdx
+     ed5:	48 c1 e2 06          	shl    $0x6,%rdx
+     ed9:	48 01 c2             	add    %rax,%rdx
+     edc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     ee0:	48 8b 08             	mov    (%rax),%rcx
+     ee3:	48 8b 58 08          	mov    0x8(%rax),%rbx
+     ee7:	48 89 0a             	mov    %rcx,(%rdx)
+     eea:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+     eee:	48 8b 48 10          	mov    0x10(%rax),%rcx
+     ef2:	48 8b 58 18          	mov    0x18(%rax),%rbx
+     ef6:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+     efa:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+     efe:	48 8b 48 20          	mov    0x20(%rax),%rcx
+     f02:	48 8b 58 28          	mov    0x28(%rax),%rbx
+     f06:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+     f0a:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+     f0e:	48 8b 48 30          	mov    0x30(%rax),%rcx
+     f12:	48 8b 58 38          	mov    0x38(%rax),%rbx
+     f16:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+     f1a:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+     f1e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+     f24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f27:	8d 50 01             	lea    0x1(%rax),%edx
+     f2a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f2e:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+     f31:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+     f37:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f3b:	8b 00                	mov    (%rax),%eax
+     f3d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     f40:	75 0f                	jne    f51 <ring_send+0xc6>
+    notify(channel, 1);
+     f42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f45:	be 01 00 00 00       	mov    $0x1,%esi
+     f4a:	89 c7                	mov    %eax,%edi
+     f4c:	e8 a1 f7 ff ff       	call   6f2 <notify>
+  return 0;
+     f51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     f5a:	c9                   	leave
+     f5b:	c3                   	ret
+
+0000000000000f5c <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+     f5c:	55                   	push   %rbp
+     f5d:	48 89 e5             	mov    %rsp,%rbp
+     f60:	53                   	push   %rbx
+     f61:	48 83 ec 38          	sub    $0x38,%rsp
+     f65:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     f68:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     f6c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+     f70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f74:	8b 00                	mov    (%rax),%eax
+     f76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+     f79:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+     f7f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f83:	8b 40 40             	mov    0x40(%rax),%eax
+     f86:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     f89:	75 15                	jne    fa0 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+     f8b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f8e:	89 c7                	mov    %eax,%edi
+     f90:	e8 67 f7 ff ff       	call   6fc <nfy_wait>
+     f95:	85 c0                	test   %eax,%eax
+     f97:	79 e0                	jns    f79 <ring_recv+0x1d>
+      return -1;
+     f99:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f9e:	eb 73                	jmp    1013 <ring_recv+0xb7>
+      break;
+     fa0:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+     fa1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fa4:	83 e0 1f             	and    $0x1f,%eax
+     fa7:	89 c1                	mov    %eax,%ecx
+     fa9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     fad:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+     fb1:	89 c9                	mov    %ecx,%ecx
+     fb3:	48 83 c1 02          	add    $0x2,%rcx
+     fb7:	48 c1 e1 06          	shl    $0x6,%rcx
+     fbb:	48 01 ca             	add    %rcx,%rdx
+     fbe:	48 8b 0a             	mov    (%rdx),%rcx
+     fc1:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+     fc5:	48 89 08             	mov    %rcx,(%rax)
+     fc8:	48 89 58 08          	mov    %rbx,0x8(%rax)
+     fcc:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+     fd0:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+     fd4:	48 89 48 10          	mov    %rcx,0x10(%rax)
+     fd8:	48 89 58 18          	mov    %rbx,0x18(%rax)
+     fdc:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+     fe0:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+     fe4:	48 89 48 20          	mov    %rcx,0x20(%rax)
+     fe8:	48 89 58 28          	mov    %rbx,0x28(%rax)
+     fec:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+     ff0:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+     ff4:	48 89 48 30          	mov    %rcx,0x30(%rax)
+     ff8:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+     ffc:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    1002:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1005:	8d 50 01             	lea    0x1(%rax),%edx
+    1008:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    100c:	89 10                	mov    %edx,(%rax)
+  return 0;
+    100e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1013:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1017:	c9                   	leave
+    1018:	c3                   	ret
+
+0000000000001019 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    1019:	55                   	push   %rbp
+    101a:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    101d:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1022:	8b 00                	mov    (%rax),%eax
+}
+    1024:	5d                   	pop    %rbp
+    1025:	c3                   	ret
+
+0000000000001026 <getpid>:
+
+int
+getpid(void)
+{
+    1026:	55                   	push   %rbp
+    1027:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    102a:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    102f:	8b 00                	mov    (%rax),%eax
+}
+    1031:	5d                   	pop    %rbp
+    1032:	c3                   	ret
+
+0000000000001033 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    1033:	55                   	push   %rbp
+    1034:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    1037:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    103c:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    1040:	5d                   	pop    %rbp
+    1041:	c3                   	ret
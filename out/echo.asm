@@ -0,0 +1,1716 @@
+
+fs/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+   b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  for(i = 1; i < argc; i++)
+   f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  16:	eb 4f                	jmp    67 <main+0x67>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  1b:	83 c0 01             	add    $0x1,%eax
+  1e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  21:	7e 09                	jle    2c <main+0x2c>
+  23:	48 c7 c1 98 0f 00 00 	mov    $0xf98,%rcx
+  2a:	eb 07                	jmp    33 <main+0x33>
+  2c:	48 c7 c1 9a 0f 00 00 	mov    $0xf9a,%rcx
+  33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  36:	48 98                	cltq
+  38:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  3f:	00 
+  40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  44:	48 01 d0             	add    %rdx,%rax
+  47:	48 8b 00             	mov    (%rax),%rax
+  4a:	48 89 c2             	mov    %rax,%rdx
+  4d:	48 c7 c6 9c 0f 00 00 	mov    $0xf9c,%rsi
+  54:	bf 01 00 00 00       	mov    $0x1,%edi
+  59:	b8 00 00 00 00       	mov    $0x0,%eax
+  5e:	e8 79 07 00 00       	call   7dc <printf>
+  for(i = 1; i < argc; i++)
+  63:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  6a:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  6d:	7c a9                	jl     18 <main+0x18>
+  exit();
+  6f:	e8 f5 02 00 00       	call   369 <exit>
+
+0000000000000074 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  74:	55                   	push   %rbp
+  75:	48 89 e5             	mov    %rsp,%rbp
+  78:	48 83 ec 10          	sub    $0x10,%rsp
+  7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  83:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+  86:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  90:	48 89 ce             	mov    %rcx,%rsi
+  93:	48 89 f7             	mov    %rsi,%rdi
+  96:	89 d1                	mov    %edx,%ecx
+  98:	fc                   	cld
+  99:	f3 aa                	rep stos %al,%es:(%rdi)
+  9b:	89 ca                	mov    %ecx,%edx
+  9d:	48 89 fe             	mov    %rdi,%rsi
+  a0:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  a4:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  a7:	90                   	nop
+  a8:	c9                   	leave
+  a9:	c3                   	ret
+
+00000000000000aa <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  aa:	55                   	push   %rbp
+  ab:	48 89 e5             	mov    %rsp,%rbp
+  ae:	48 83 ec 20          	sub    $0x20,%rsp
+  b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+  ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  c7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  d3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  d7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  db:	0f b6 12             	movzbl (%rdx),%edx
+  de:	88 10                	mov    %dl,(%rax)
+  e0:	0f b6 00             	movzbl (%rax),%eax
+  e3:	84 c0                	test   %al,%al
+  e5:	75 dc                	jne    c3 <strcpy+0x19>
+    ;
+  return os;
+  e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+
+00000000000000ed <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  ed:	55                   	push   %rbp
+  ee:	48 89 e5             	mov    %rsp,%rbp
+  f1:	48 83 ec 10          	sub    $0x10,%rsp
+  f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+  fd:	eb 0a                	jmp    109 <strcmp+0x1c>
+    p++, q++;
+  ff:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 104:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 109:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 10d:	0f b6 00             	movzbl (%rax),%eax
+ 110:	84 c0                	test   %al,%al
+ 112:	74 12                	je     126 <strcmp+0x39>
+ 114:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 118:	0f b6 10             	movzbl (%rax),%edx
+ 11b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 11f:	0f b6 00             	movzbl (%rax),%eax
+ 122:	38 c2                	cmp    %al,%dl
+ 124:	74 d9                	je     ff <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+ 126:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 12a:	0f b6 00             	movzbl (%rax),%eax
+ 12d:	0f b6 d0             	movzbl %al,%edx
+ 130:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 134:	0f b6 00             	movzbl (%rax),%eax
+ 137:	0f b6 c0             	movzbl %al,%eax
+ 13a:	29 c2                	sub    %eax,%edx
+ 13c:	89 d0                	mov    %edx,%eax
+}
+ 13e:	c9                   	leave
+ 13f:	c3                   	ret
+
+0000000000000140 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 140:	55                   	push   %rbp
+ 141:	48 89 e5             	mov    %rsp,%rbp
+ 144:	48 83 ec 18          	sub    $0x18,%rsp
+ 148:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 14c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 153:	eb 04                	jmp    159 <strlen+0x19>
+ 155:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 159:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 15c:	48 63 d0             	movslq %eax,%rdx
+ 15f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 163:	48 01 d0             	add    %rdx,%rax
+ 166:	0f b6 00             	movzbl (%rax),%eax
+ 169:	84 c0                	test   %al,%al
+ 16b:	75 e8                	jne    155 <strlen+0x15>
+    ;
+  return n;
+ 16d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 170:	c9                   	leave
+ 171:	c3                   	ret
+
+0000000000000172 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 172:	55                   	push   %rbp
+ 173:	48 89 e5             	mov    %rsp,%rbp
+ 176:	48 83 ec 10          	sub    $0x10,%rsp
+ 17a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 17e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 181:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 184:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 187:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 18a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 18e:	89 ce                	mov    %ecx,%esi
+ 190:	48 89 c7             	mov    %rax,%rdi
+ 193:	e8 dc fe ff ff       	call   74 <stosb>
+  return dst;
+ 198:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 19c:	c9                   	leave
+ 19d:	c3                   	ret
+
+000000000000019e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 19e:	55                   	push   %rbp
+ 19f:	48 89 e5             	mov    %rsp,%rbp
+ 1a2:	48 83 ec 10          	sub    $0x10,%rsp
+ 1a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 1aa:	89 f0                	mov    %esi,%eax
+ 1ac:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 1af:	eb 17                	jmp    1c8 <strchr+0x2a>
+    if(*s == c)
+ 1b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1b5:	0f b6 00             	movzbl (%rax),%eax
+ 1b8:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 1bb:	75 06                	jne    1c3 <strchr+0x25>
+      return (char*)s;
+ 1bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1c1:	eb 15                	jmp    1d8 <strchr+0x3a>
+  for(; *s; s++)
+ 1c3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 1c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1cc:	0f b6 00             	movzbl (%rax),%eax
+ 1cf:	84 c0                	test   %al,%al
+ 1d1:	75 de                	jne    1b1 <strchr+0x13>
+  return 0;
+ 1d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1d8:	c9                   	leave
+ 1d9:	c3                   	ret
+
+00000000000001da <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1da:	55                   	push   %rbp
+ 1db:	48 89 e5             	mov    %rsp,%rbp
+ 1de:	48 83 ec 20          	sub    $0x20,%rsp
+ 1e2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 1e6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 1f0:	eb 48                	jmp    23a <gets+0x60>
+    cc = read(0, &c, 1);
+ 1f2:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 1f6:	ba 01 00 00 00       	mov    $0x1,%edx
+ 1fb:	48 89 c6             	mov    %rax,%rsi
+ 1fe:	bf 00 00 00 00       	mov    $0x0,%edi
+ 203:	e8 7f 01 00 00       	call   387 <read>
+ 208:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 20b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 20f:	7e 36                	jle    247 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 211:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 214:	8d 50 01             	lea    0x1(%rax),%edx
+ 217:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 21a:	48 63 d0             	movslq %eax,%rdx
+ 21d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 221:	48 01 c2             	add    %rax,%rdx
+ 224:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 228:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 22a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 22e:	3c 0a                	cmp    $0xa,%al
+ 230:	74 16                	je     248 <gets+0x6e>
+ 232:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 236:	3c 0d                	cmp    $0xd,%al
+ 238:	74 0e                	je     248 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 23a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 23d:	83 c0 01             	add    $0x1,%eax
+ 240:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 243:	7f ad                	jg     1f2 <gets+0x18>
+ 245:	eb 01                	jmp    248 <gets+0x6e>
+      break;
+ 247:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 248:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 24b:	48 63 d0             	movslq %eax,%rdx
+ 24e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 252:	48 01 d0             	add    %rdx,%rax
+ 255:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 258:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 25c:	c9                   	leave
+ 25d:	c3                   	ret
+
+000000000000025e <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 25e:	55                   	push   %rbp
+ 25f:	48 89 e5             	mov    %rsp,%rbp
+ 262:	48 83 ec 20          	sub    $0x20,%rsp
+ 266:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 26a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 26e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 272:	be 00 00 00 00       	mov    $0x0,%esi
+ 277:	48 89 c7             	mov    %rax,%rdi
+ 27a:	e8 3a 01 00 00       	call   3b9 <open>
+ 27f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 282:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 286:	79 07                	jns    28f <stat+0x31>
+    return -1;
+ 288:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 28d:	eb 21                	jmp    2b0 <stat+0x52>
+  r = fstat(fd, st);
+ 28f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 293:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 296:	48 89 d6             	mov    %rdx,%rsi
+ 299:	89 c7                	mov    %eax,%edi
+ 29b:	e8 37 01 00 00       	call   3d7 <fstat>
+ 2a0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 2a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2a6:	89 c7                	mov    %eax,%edi
+ 2a8:	e8 ee 00 00 00       	call   39b <close>
+  return r;
+ 2ad:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 2b0:	c9                   	leave
+ 2b1:	c3                   	ret
+
+00000000000002b2 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2b2:	55                   	push   %rbp
+ 2b3:	48 89 e5             	mov    %rsp,%rbp
+ 2b6:	48 83 ec 18          	sub    $0x18,%rsp
+ 2ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 2be:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 2c5:	eb 28                	jmp    2ef <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+ 2c7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 2ca:	89 d0                	mov    %edx,%eax
+ 2cc:	c1 e0 02             	shl    $0x2,%eax
+ 2cf:	01 d0                	add    %edx,%eax
+ 2d1:	01 c0                	add    %eax,%eax
+ 2d3:	89 c1                	mov    %eax,%ecx
+ 2d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2d9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 2dd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 2e1:	0f b6 00             	movzbl (%rax),%eax
+ 2e4:	0f be c0             	movsbl %al,%eax
+ 2e7:	01 c8                	add    %ecx,%eax
+ 2e9:	83 e8 30             	sub    $0x30,%eax
+ 2ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 2ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2f3:	0f b6 00             	movzbl (%rax),%eax
+ 2f6:	3c 2f                	cmp    $0x2f,%al
+ 2f8:	7e 0b                	jle    305 <atoi+0x53>
+ 2fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2fe:	0f b6 00             	movzbl (%rax),%eax
+ 301:	3c 39                	cmp    $0x39,%al
+ 303:	7e c2                	jle    2c7 <atoi+0x15>
+  return n;
+ 305:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 308:	c9                   	leave
+ 309:	c3                   	ret
+
+000000000000030a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 30a:	55                   	push   %rbp
+ 30b:	48 89 e5             	mov    %rsp,%rbp
+ 30e:	48 83 ec 28          	sub    $0x28,%rsp
+ 312:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 316:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 31a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+ 31d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 321:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 325:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 329:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 32d:	eb 1d                	jmp    34c <memmove+0x42>
+    *dst++ = *src++;
+ 32f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 333:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 337:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 33b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 33f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 343:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 347:	0f b6 12             	movzbl (%rdx),%edx
+ 34a:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 34c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 34f:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 352:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 355:	85 c0                	test   %eax,%eax
+ 357:	7f d6                	jg     32f <memmove+0x25>
+  return vdst;
+ 359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 35d:	c9                   	leave
+ 35e:	c3                   	ret
+
+000000000000035f <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+ 35f:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+0000000000000369 <exit>:
+SYSCALL_FAST(exit)
+ 369:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+ 370:	0f 05                	syscall
+ 372:	c3                   	ret
+
+0000000000000373 <wait>:
+SYSCALL_FAST(wait)
+ 373:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+ 37a:	0f 05                	syscall
+ 37c:	c3                   	ret
+
+000000000000037d <pipe>:
+SYSCALL_FAST(pipe)
+ 37d:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+ 384:	0f 05                	syscall
+ 386:	c3                   	ret
+
+0000000000000387 <read>:
+SYSCALL_FAST(read)
+ 387:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+ 38e:	0f 05                	syscall
+ 390:	c3                   	ret
+
+0000000000000391 <write>:
+SYSCALL_FAST(write)
+ 391:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+ 398:	0f 05                	syscall
+ 39a:	c3                   	ret
+
+000000000000039b <close>:
+SYSCALL_FAST(close)
+ 39b:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+ 3a2:	0f 05                	syscall
+ 3a4:	c3                   	ret
+
+00000000000003a5 <kill>:
+SYSCALL_FAST(kill)
+ 3a5:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+ 3ac:	0f 05                	syscall
+ 3ae:	c3                   	ret
+
+00000000000003af <exec>:
+SYSCALL(exec)
+ 3af:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+00000000000003b9 <open>:
+SYSCALL_FAST(open)
+ 3b9:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+ 3c0:	0f 05                	syscall
+ 3c2:	c3                   	ret
+
+00000000000003c3 <mknod>:
+SYSCALL_FAST(mknod)
+ 3c3:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+ 3ca:	0f 05                	syscall
+ 3cc:	c3                   	ret
+
+00000000000003cd <unlink>:
+SYSCALL_FAST(unlink)
+ 3cd:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+ 3d4:	0f 05                	syscall
+ 3d6:	c3                   	ret
+
+00000000000003d7 <fstat>:
+SYSCALL_FAST(fstat)
+ 3d7:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+ 3de:	0f 05                	syscall
+ 3e0:	c3                   	ret
+
+00000000000003e1 <link>:
+SYSCALL_FAST(link)
+ 3e1:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+ 3e8:	0f 05                	syscall
+ 3ea:	c3                   	ret
+
+00000000000003eb <mkdir>:
+SYSCALL_FAST(mkdir)
+ 3eb:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+ 3f2:	0f 05                	syscall
+ 3f4:	c3                   	ret
+
+00000000000003f5 <chdir>:
+SYSCALL_FAST(chdir)
+ 3f5:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+ 3fc:	0f 05                	syscall
+ 3fe:	c3                   	ret
+
+00000000000003ff <dup>:
+SYSCALL_FAST(dup)
+ 3ff:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+ 406:	0f 05                	syscall
+ 408:	c3                   	ret
+
+0000000000000409 <sbrk>:
+SYSCALL_FAST(sbrk)
+ 409:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+ 410:	0f 05                	syscall
+ 412:	c3                   	ret
+
+0000000000000413 <sleep>:
+SYSCALL_FAST(sleep)
+ 413:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+ 41a:	0f 05                	syscall
+ 41c:	c3                   	ret
+
+000000000000041d <send>:
+SYSCALL_FAST(send)
+ 41d:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+ 424:	0f 05                	syscall
+ 426:	c3                   	ret
+
+0000000000000427 <send_recv>:
+SYSCALL_FAST(send_recv)
+ 427:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+ 42e:	0f 05                	syscall
+ 430:	c3                   	ret
+
+0000000000000431 <recv>:
+SYSCALL_FAST(recv)
+ 431:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+ 438:	0f 05                	syscall
+ 43a:	c3                   	ret
+
+000000000000043b <call>:
+SYSCALL_FAST(call)
+ 43b:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+ 442:	0f 05                	syscall
+ 444:	c3                   	ret
+
+0000000000000445 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+ 445:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+ 44c:	0f 05                	syscall
+ 44e:	c3                   	ret
+
+000000000000044f <send_reg>:
+SYSCALL_REG(send_reg)
+ 44f:	41 54                	push   %r12
+ 451:	41 55                	push   %r13
+ 453:	41 56                	push   %r14
+ 455:	41 57                	push   %r15
+ 457:	56                   	push   %rsi
+ 458:	49 89 f3             	mov    %rsi,%r11
+ 45b:	48 89 d6             	mov    %rdx,%rsi
+ 45e:	49 8b 13             	mov    (%r11),%rdx
+ 461:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 465:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 469:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 46d:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 471:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 475:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 479:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 47d:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+ 484:	0f 05                	syscall
+ 486:	41 5b                	pop    %r11
+ 488:	49 89 13             	mov    %rdx,(%r11)
+ 48b:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 48f:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 493:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 497:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 49b:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 49f:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 4a3:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 4a7:	41 5f                	pop    %r15
+ 4a9:	41 5e                	pop    %r14
+ 4ab:	41 5d                	pop    %r13
+ 4ad:	41 5c                	pop    %r12
+ 4af:	c3                   	ret
+
+00000000000004b0 <recv_reg>:
+SYSCALL_REG(recv_reg)
+ 4b0:	41 54                	push   %r12
+ 4b2:	41 55                	push   %r13
+ 4b4:	41 56                	push   %r14
+ 4b6:	41 57                	push   %r15
+ 4b8:	56                   	push   %rsi
+ 4b9:	49 89 f3             	mov    %rsi,%r11
+ 4bc:	48 89 d6             	mov    %rdx,%rsi
+ 4bf:	49 8b 13             	mov    (%r11),%rdx
+ 4c2:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 4c6:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 4ca:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 4ce:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 4d2:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 4d6:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 4da:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 4de:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+ 4e5:	0f 05                	syscall
+ 4e7:	41 5b                	pop    %r11
+ 4e9:	49 89 13             	mov    %rdx,(%r11)
+ 4ec:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 4f0:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 4f4:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 4f8:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 4fc:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 500:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 504:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 508:	41 5f                	pop    %r15
+ 50a:	41 5e                	pop    %r14
+ 50c:	41 5d                	pop    %r13
+ 50e:	41 5c                	pop    %r12
+ 510:	c3                   	ret
+
+0000000000000511 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+ 511:	41 54                	push   %r12
+ 513:	41 55                	push   %r13
+ 515:	41 56                	push   %r14
+ 517:	41 57                	push   %r15
+ 519:	56                   	push   %rsi
+ 51a:	49 89 f3             	mov    %rsi,%r11
+ 51d:	48 89 d6             	mov    %rdx,%rsi
+ 520:	49 8b 13             	mov    (%r11),%rdx
+ 523:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 527:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 52b:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 52f:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 533:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 537:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 53b:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 53f:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+ 546:	0f 05                	syscall
+ 548:	41 5b                	pop    %r11
+ 54a:	49 89 13             	mov    %rdx,(%r11)
+ 54d:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 551:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 555:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 559:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 55d:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 561:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 565:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 569:	41 5f                	pop    %r15
+ 56b:	41 5e                	pop    %r14
+ 56d:	41 5d                	pop    %r13
+ 56f:	41 5c                	pop    %r12
+ 571:	c3                   	ret
+
+0000000000000572 <call_reg>:
+SYSCALL_REG(call_reg)
+ 572:	41 54                	push   %r12
+ 574:	41 55                	push   %r13
+ 576:	41 56                	push   %r14
+ 578:	41 57                	push   %r15
+ 57a:	56                   	push   %rsi
+ 57b:	49 89 f3             	mov    %rsi,%r11
+ 57e:	48 89 d6             	mov    %rdx,%rsi
+ 581:	49 8b 13             	mov    (%r11),%rdx
+ 584:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 588:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 58c:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 590:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 594:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 598:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 59c:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 5a0:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+ 5a7:	0f 05                	syscall
+ 5a9:	41 5b                	pop    %r11
+ 5ab:	49 89 13             	mov    %rdx,(%r11)
+ 5ae:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 5b2:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 5b6:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 5ba:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 5be:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 5c2:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 5c6:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 5ca:	41 5f                	pop    %r15
+ 5cc:	41 5e                	pop    %r14
+ 5ce:	41 5d                	pop    %r13
+ 5d0:	41 5c                	pop    %r12
+ 5d2:	c3                   	ret
+
+00000000000005d3 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+ 5d3:	41 54                	push   %r12
+ 5d5:	41 55                	push   %r13
+ 5d7:	41 56                	push   %r14
+ 5d9:	41 57                	push   %r15
+ 5db:	56                   	push   %rsi
+ 5dc:	49 89 f3             	mov    %rsi,%r11
+ 5df:	48 89 d6             	mov    %rdx,%rsi
+ 5e2:	49 8b 13             	mov    (%r11),%rdx
+ 5e5:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 5e9:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 5ed:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 5f1:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 5f5:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 5f9:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 5fd:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 601:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+ 608:	0f 05                	syscall
+ 60a:	41 5b                	pop    %r11
+ 60c:	49 89 13             	mov    %rdx,(%r11)
+ 60f:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 613:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 617:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 61b:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 61f:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 623:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 627:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 62b:	41 5f                	pop    %r15
+ 62d:	41 5e                	pop    %r14
+ 62f:	41 5d                	pop    %r13
+ 631:	41 5c                	pop    %r12
+ 633:	c3                   	ret
+
+0000000000000634 <sendx>:
+SYSCALL_FAST(sendx)
+ 634:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+ 63b:	0f 05                	syscall
+ 63d:	c3                   	ret
+
+000000000000063e <ring_attach>:
+SYSCALL_FAST(ring_attach)
+ 63e:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+ 645:	0f 05                	syscall
+ 647:	c3                   	ret
+
+0000000000000648 <notify>:
+SYSCALL_FAST(notify)
+ 648:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+ 64f:	0f 05                	syscall
+ 651:	c3                   	ret
+
+0000000000000652 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+ 652:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+ 659:	0f 05                	syscall
+ 65b:	c3                   	ret
+
+000000000000065c <send_timed>:
+SYSCALL_FAST(send_timed)
+ 65c:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+ 663:	0f 05                	syscall
+ 665:	c3                   	ret
+
+0000000000000666 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+ 666:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+ 66d:	0f 05                	syscall
+ 66f:	c3                   	ret
+
+0000000000000670 <set_add>:
+SYSCALL_FAST(set_add)
+ 670:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+ 677:	0f 05                	syscall
+ 679:	c3                   	ret
+
+000000000000067a <set_del>:
+SYSCALL_FAST(set_del)
+ 67a:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+ 681:	0f 05                	syscall
+ 683:	c3                   	ret
+
+0000000000000684 <recv_any>:
+SYSCALL_FAST(recv_any)
+ 684:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+ 68b:	0f 05                	syscall
+ 68d:	c3                   	ret
+
+000000000000068e <ep_create>:
+SYSCALL_FAST(ep_create)
+ 68e:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+ 695:	0f 05                	syscall
+ 697:	c3                   	ret
+
+0000000000000698 <ep_close>:
+SYSCALL_FAST(ep_close)
+ 698:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+ 69f:	0f 05                	syscall
+ 6a1:	c3                   	ret
+
+00000000000006a2 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+ 6a2:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+ 6a9:	0f 05                	syscall
+ 6ab:	c3                   	ret
+
+00000000000006ac <setprio>:
+SYSCALL_FAST(setprio)
+ 6ac:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+ 6b3:	0f 05                	syscall
+ 6b5:	c3                   	ret
+
+00000000000006b6 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+ 6b6:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+ 6bd:	0f 05                	syscall
+ 6bf:	c3                   	ret
+
+00000000000006c0 <sethuge>:
+SYSCALL_FAST(sethuge)
+ 6c0:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+ 6c7:	0f 05                	syscall
+ 6c9:	c3                   	ret
+
+00000000000006ca <cr3_test>:
+SYSCALL_FAST(cr3_test)
+ 6ca:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+ 6d1:	0f 05                	syscall
+ 6d3:	c3                   	ret
+
+00000000000006d4 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+ 6d4:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+ 6db:	0f 05                	syscall
+ 6dd:	c3                   	ret
+
+00000000000006de <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+ 6de:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+ 6e5:	0f 05                	syscall
+ 6e7:	c3                   	ret
+
+00000000000006e8 <null_call>:
+ 6e8:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+ 6ef:	0f 05                	syscall
+ 6f1:	c3                   	ret
+
+00000000000006f2 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6f2:	55                   	push   %rbp
+ 6f3:	48 89 e5             	mov    %rsp,%rbp
+ 6f6:	48 83 ec 10          	sub    $0x10,%rsp
+ 6fa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 6fd:	89 f0                	mov    %esi,%eax
+ 6ff:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+ 702:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 706:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 709:	ba 01 00 00 00       	mov    $0x1,%edx
+ 70e:	48 89 ce             	mov    %rcx,%rsi
+ 711:	89 c7                	mov    %eax,%edi
+ 713:	e8 79 fc ff ff       	call   391 <write>
+}
+ 718:	90                   	nop
+ 719:	c9                   	leave
+ 71a:	c3                   	ret
+
+000000000000071b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 71b:	55                   	push   %rbp
+ 71c:	48 89 e5             	mov    %rsp,%rbp
+ 71f:	48 83 ec 30          	sub    $0x30,%rsp
+ 723:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 726:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 729:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 72c:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 72f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 736:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 73a:	74 17                	je     753 <printint+0x38>
+ 73c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 740:	79 11                	jns    753 <printint+0x38>
+    neg = 1;
+ 742:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 749:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 74c:	f7 d8                	neg    %eax
+ 74e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 751:	eb 06                	jmp    759 <printint+0x3e>
+  } else {
+    x = xx;
+ 753:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 756:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 759:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 760:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 763:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 766:	ba 00 00 00 00       	mov    $0x0,%edx
+ 76b:	f7 f1                	div    %ecx
+ 76d:	89 d1                	mov    %edx,%ecx
+ 76f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 772:	8d 50 01             	lea    0x1(%rax),%edx
+ 775:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 778:	89 ca                	mov    %ecx,%edx
+ 77a:	0f b6 92 90 12 00 00 	movzbl 0x1290(%rdx),%edx
+ 781:	48 98                	cltq
+ 783:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 787:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 78a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 78d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 792:	f7 f6                	div    %esi
+ 794:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 797:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 79b:	75 c3                	jne    760 <printint+0x45>
+  if(neg)
+ 79d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 7a1:	74 2b                	je     7ce <printint+0xb3>
+    buf[i++] = '-';
+ 7a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7a6:	8d 50 01             	lea    0x1(%rax),%edx
+ 7a9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 7ac:	48 98                	cltq
+ 7ae:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 7b3:	eb 19                	jmp    7ce <printint+0xb3>
+    putc(fd, buf[i]);
+ 7b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7b8:	48 98                	cltq
+ 7ba:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+ 7bf:	0f be d0             	movsbl %al,%edx
+ 7c2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7c5:	89 d6                	mov    %edx,%esi
+ 7c7:	89 c7                	mov    %eax,%edi
+ 7c9:	e8 24 ff ff ff       	call   6f2 <putc>
+  while(--i >= 0)
+ 7ce:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 7d2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 7d6:	79 dd                	jns    7b5 <printint+0x9a>
+}
+ 7d8:	90                   	nop
+ 7d9:	90                   	nop
+ 7da:	c9                   	leave
+ 7db:	c3                   	ret
+
+00000000000007dc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7dc:	55                   	push   %rbp
+ 7dd:	48 89 e5             	mov    %rsp,%rbp
+ 7e0:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+ 7e7:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+ 7ed:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+ 7f4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+ 7fb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+ 802:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+ 809:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+ 810:	84 c0                	test   %al,%al
+ 812:	74 20                	je     834 <printf+0x58>
+ 814:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+ 818:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+ 81c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+ 820:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+ 824:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+ 828:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+ 82c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+ 830:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 834:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+ 83b:	00 00 00 
+ 83e:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+ 845:	00 00 00 
+ 848:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 84c:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+ 853:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+ 85a:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+ 861:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ 868:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ 86b:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+ 872:	00 00 00 
+ 875:	e9 a8 02 00 00       	jmp    b22 <printf+0x346>
+    c = fmt[i] & 0xff;
+ 87a:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ 880:	48 63 d0             	movslq %eax,%rdx
+ 883:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ 88a:	48 01 d0             	add    %rdx,%rax
+ 88d:	0f b6 00             	movzbl (%rax),%eax
+ 890:	0f be c0             	movsbl %al,%eax
+ 893:	25 ff 00 00 00       	and    $0xff,%eax
+ 898:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+ 89e:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+ 8a5:	75 35                	jne    8dc <printf+0x100>
+      if(c == '%'){
+ 8a7:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ 8ae:	75 0f                	jne    8bf <printf+0xe3>
+        state = '%';
+ 8b0:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+ 8b7:	00 00 00 
+ 8ba:	e9 5c 02 00 00       	jmp    b1b <printf+0x33f>
+      } else {
+        putc(fd, c);
+ 8bf:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ 8c5:	0f be d0             	movsbl %al,%edx
+ 8c8:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 8ce:	89 d6                	mov    %edx,%esi
+ 8d0:	89 c7                	mov    %eax,%edi
+ 8d2:	e8 1b fe ff ff       	call   6f2 <putc>
+ 8d7:	e9 3f 02 00 00       	jmp    b1b <printf+0x33f>
+      }
+    } else if(state == '%'){
+ 8dc:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+ 8e3:	0f 85 32 02 00 00    	jne    b1b <printf+0x33f>
+      if(c == 'd'){
+ 8e9:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+ 8f0:	75 5e                	jne    950 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 8f2:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 8f8:	83 f8 2f             	cmp    $0x2f,%eax
+ 8fb:	77 23                	ja     920 <printf+0x144>
+ 8fd:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 904:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 90a:	89 d2                	mov    %edx,%edx
+ 90c:	48 01 d0             	add    %rdx,%rax
+ 90f:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 915:	83 c2 08             	add    $0x8,%edx
+ 918:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 91e:	eb 12                	jmp    932 <printf+0x156>
+ 920:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 927:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 92b:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 932:	8b 30                	mov    (%rax),%esi
+ 934:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 93a:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 93f:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 944:	89 c7                	mov    %eax,%edi
+ 946:	e8 d0 fd ff ff       	call   71b <printint>
+ 94b:	e9 c1 01 00 00       	jmp    b11 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+ 950:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+ 957:	74 09                	je     962 <printf+0x186>
+ 959:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+ 960:	75 5e                	jne    9c0 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 962:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 968:	83 f8 2f             	cmp    $0x2f,%eax
+ 96b:	77 23                	ja     990 <printf+0x1b4>
+ 96d:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 974:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 97a:	89 d2                	mov    %edx,%edx
+ 97c:	48 01 d0             	add    %rdx,%rax
+ 97f:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 985:	83 c2 08             	add    $0x8,%edx
+ 988:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 98e:	eb 12                	jmp    9a2 <printf+0x1c6>
+ 990:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 997:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 99b:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 9a2:	8b 30                	mov    (%rax),%esi
+ 9a4:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 9aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 9af:	ba 10 00 00 00       	mov    $0x10,%edx
+ 9b4:	89 c7                	mov    %eax,%edi
+ 9b6:	e8 60 fd ff ff       	call   71b <printint>
+ 9bb:	e9 51 01 00 00       	jmp    b11 <printf+0x335>
+      } else if(c == 's'){
+ 9c0:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+ 9c7:	0f 85 98 00 00 00    	jne    a65 <printf+0x289>
+        s = va_arg(ap, char*);
+ 9cd:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 9d3:	83 f8 2f             	cmp    $0x2f,%eax
+ 9d6:	77 23                	ja     9fb <printf+0x21f>
+ 9d8:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 9df:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 9e5:	89 d2                	mov    %edx,%edx
+ 9e7:	48 01 d0             	add    %rdx,%rax
+ 9ea:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 9f0:	83 c2 08             	add    $0x8,%edx
+ 9f3:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 9f9:	eb 12                	jmp    a0d <printf+0x231>
+ 9fb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ a02:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ a06:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ a0d:	48 8b 00             	mov    (%rax),%rax
+ a10:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+ a17:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+ a1e:	00 
+ a1f:	75 31                	jne    a52 <printf+0x276>
+          s = "(null)";
+ a21:	48 c7 85 48 ff ff ff 	movq   $0xfa1,-0xb8(%rbp)
+ a28:	a1 0f 00 00 
+        while(*s != 0){
+ a2c:	eb 24                	jmp    a52 <printf+0x276>
+          putc(fd, *s);
+ a2e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a35:	0f b6 00             	movzbl (%rax),%eax
+ a38:	0f be d0             	movsbl %al,%edx
+ a3b:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ a41:	89 d6                	mov    %edx,%esi
+ a43:	89 c7                	mov    %eax,%edi
+ a45:	e8 a8 fc ff ff       	call   6f2 <putc>
+          s++;
+ a4a:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+ a51:	01 
+        while(*s != 0){
+ a52:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a59:	0f b6 00             	movzbl (%rax),%eax
+ a5c:	84 c0                	test   %al,%al
+ a5e:	75 ce                	jne    a2e <printf+0x252>
+ a60:	e9 ac 00 00 00       	jmp    b11 <printf+0x335>
+        }
+      } else if(c == 'c'){
+ a65:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+ a6c:	75 56                	jne    ac4 <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+ a6e:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ a74:	83 f8 2f             	cmp    $0x2f,%eax
+ a77:	77 23                	ja     a9c <printf+0x2c0>
+ a79:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ a80:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a86:	89 d2                	mov    %edx,%edx
+ a88:	48 01 d0             	add    %rdx,%rax
+ a8b:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a91:	83 c2 08             	add    $0x8,%edx
+ a94:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ a9a:	eb 12                	jmp    aae <printf+0x2d2>
+ a9c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ aa3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ aa7:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ aae:	8b 00                	mov    (%rax),%eax
+ ab0:	0f be d0             	movsbl %al,%edx
+ ab3:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ ab9:	89 d6                	mov    %edx,%esi
+ abb:	89 c7                	mov    %eax,%edi
+ abd:	e8 30 fc ff ff       	call   6f2 <putc>
+ ac2:	eb 4d                	jmp    b11 <printf+0x335>
+      } else if(c == '%'){
+ ac4:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ acb:	75 1a                	jne    ae7 <printf+0x30b>
+        putc(fd, c);
+ acd:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ ad3:	0f be d0             	movsbl %al,%edx
+ ad6:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ adc:	89 d6                	mov    %edx,%esi
+ ade:	89 c7                	mov    %eax,%edi
+ ae0:	e8 0d fc ff ff       	call   6f2 <putc>
+ ae5:	eb 2a                	jmp    b11 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ ae7:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ aed:	be 25 00 00 00       	mov    $0x25,%esi
+ af2:	89 c7                	mov    %eax,%edi
+ af4:	e8 f9 fb ff ff       	call   6f2 <putc>
+        putc(fd, c);
+ af9:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ aff:	0f be d0             	movsbl %al,%edx
+ b02:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ b08:	89 d6                	mov    %edx,%esi
+ b0a:	89 c7                	mov    %eax,%edi
+ b0c:	e8 e1 fb ff ff       	call   6f2 <putc>
+      }
+      state = 0;
+ b11:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ b18:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ b1b:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+ b22:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ b28:	48 63 d0             	movslq %eax,%rdx
+ b2b:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ b32:	48 01 d0             	add    %rdx,%rax
+ b35:	0f b6 00             	movzbl (%rax),%eax
+ b38:	84 c0                	test   %al,%al
+ b3a:	0f 85 3a fd ff ff    	jne    87a <printf+0x9e>
+    }
+  }
+}
+ b40:	90                   	nop
+ b41:	90                   	nop
+ b42:	c9                   	leave
+ b43:	c3                   	ret
+
+0000000000000b44 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b44:	55                   	push   %rbp
+ b45:	48 89 e5             	mov    %rsp,%rbp
+ b48:	48 83 ec 18          	sub    $0x18,%rsp
+ b4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ b54:	48 83 e8 10          	sub    $0x10,%rax
+ b58:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b5c:	48 8b 05 5d 07 00 00 	mov    0x75d(%rip),%rax        # 12c0 <freep>
+ b63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b67:	eb 2f                	jmp    b98 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b6d:	48 8b 00             	mov    (%rax),%rax
+ b70:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b74:	72 17                	jb     b8d <free+0x49>
+ b76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b7a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b7e:	72 2f                	jb     baf <free+0x6b>
+ b80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b84:	48 8b 00             	mov    (%rax),%rax
+ b87:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ b8b:	72 22                	jb     baf <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b91:	48 8b 00             	mov    (%rax),%rax
+ b94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b9c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ ba0:	73 c7                	jae    b69 <free+0x25>
+ ba2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ba6:	48 8b 00             	mov    (%rax),%rax
+ ba9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ bad:	73 ba                	jae    b69 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ baf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bb3:	8b 40 08             	mov    0x8(%rax),%eax
+ bb6:	89 c0                	mov    %eax,%eax
+ bb8:	48 c1 e0 04          	shl    $0x4,%rax
+ bbc:	48 89 c2             	mov    %rax,%rdx
+ bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bc3:	48 01 c2             	add    %rax,%rdx
+ bc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bca:	48 8b 00             	mov    (%rax),%rax
+ bcd:	48 39 c2             	cmp    %rax,%rdx
+ bd0:	75 2d                	jne    bff <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+ bd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bd6:	8b 50 08             	mov    0x8(%rax),%edx
+ bd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bdd:	48 8b 00             	mov    (%rax),%rax
+ be0:	8b 40 08             	mov    0x8(%rax),%eax
+ be3:	01 c2                	add    %eax,%edx
+ be5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ be9:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bf0:	48 8b 00             	mov    (%rax),%rax
+ bf3:	48 8b 10             	mov    (%rax),%rdx
+ bf6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bfa:	48 89 10             	mov    %rdx,(%rax)
+ bfd:	eb 0e                	jmp    c0d <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c03:	48 8b 10             	mov    (%rax),%rdx
+ c06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c0a:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ c0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c11:	8b 40 08             	mov    0x8(%rax),%eax
+ c14:	89 c0                	mov    %eax,%eax
+ c16:	48 c1 e0 04          	shl    $0x4,%rax
+ c1a:	48 89 c2             	mov    %rax,%rdx
+ c1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c21:	48 01 d0             	add    %rdx,%rax
+ c24:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ c28:	75 27                	jne    c51 <free+0x10d>
+    p->s.size += bp->s.size;
+ c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c2e:	8b 50 08             	mov    0x8(%rax),%edx
+ c31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c35:	8b 40 08             	mov    0x8(%rax),%eax
+ c38:	01 c2                	add    %eax,%edx
+ c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c3e:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ c41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c45:	48 8b 10             	mov    (%rax),%rdx
+ c48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c4c:	48 89 10             	mov    %rdx,(%rax)
+ c4f:	eb 0b                	jmp    c5c <free+0x118>
+  } else
+    p->s.ptr = bp;
+ c51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c55:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ c59:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ c5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c60:	48 89 05 59 06 00 00 	mov    %rax,0x659(%rip)        # 12c0 <freep>
+}
+ c67:	90                   	nop
+ c68:	c9                   	leave
+ c69:	c3                   	ret
+
+0000000000000c6a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c6a:	55                   	push   %rbp
+ c6b:	48 89 e5             	mov    %rsp,%rbp
+ c6e:	48 83 ec 20          	sub    $0x20,%rsp
+ c72:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c75:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ c7c:	77 07                	ja     c85 <morecore+0x1b>
+    nu = 4096;
+ c7e:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ c85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c88:	c1 e0 04             	shl    $0x4,%eax
+ c8b:	89 c7                	mov    %eax,%edi
+ c8d:	e8 77 f7 ff ff       	call   409 <sbrk>
+ c92:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ c96:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ c9b:	75 07                	jne    ca4 <morecore+0x3a>
+    return 0;
+ c9d:	b8 00 00 00 00       	mov    $0x0,%eax
+ ca2:	eb 29                	jmp    ccd <morecore+0x63>
+  hp = (Header*)p;
+ ca4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ca8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ cac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cb0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ cb3:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ cb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cba:	48 83 c0 10          	add    $0x10,%rax
+ cbe:	48 89 c7             	mov    %rax,%rdi
+ cc1:	e8 7e fe ff ff       	call   b44 <free>
+  return freep;
+ cc6:	48 8b 05 f3 05 00 00 	mov    0x5f3(%rip),%rax        # 12c0 <freep>
+}
+ ccd:	c9                   	leave
+ cce:	c3                   	ret
+
+0000000000000ccf <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ccf:	55                   	push   %rbp
+ cd0:	48 89 e5             	mov    %rsp,%rbp
+ cd3:	48 83 ec 30          	sub    $0x30,%rsp
+ cd7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cda:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ cdd:	48 83 c0 0f          	add    $0xf,%rax
+ ce1:	48 c1 e8 04          	shr    $0x4,%rax
+ ce5:	83 c0 01             	add    $0x1,%eax
+ ce8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+ ceb:	48 8b 05 ce 05 00 00 	mov    0x5ce(%rip),%rax        # 12c0 <freep>
+ cf2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ cf6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ cfb:	75 2b                	jne    d28 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+ cfd:	48 c7 45 f0 b0 12 00 	movq   $0x12b0,-0x10(%rbp)
+ d04:	00 
+ d05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d09:	48 89 05 b0 05 00 00 	mov    %rax,0x5b0(%rip)        # 12c0 <freep>
+ d10:	48 8b 05 a9 05 00 00 	mov    0x5a9(%rip),%rax        # 12c0 <freep>
+ d17:	48 89 05 92 05 00 00 	mov    %rax,0x592(%rip)        # 12b0 <base>
+    base.s.size = 0;
+ d1e:	c7 05 90 05 00 00 00 	movl   $0x0,0x590(%rip)        # 12b8 <base+0x8>
+ d25:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d2c:	48 8b 00             	mov    (%rax),%rax
+ d2f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ d33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d37:	8b 40 08             	mov    0x8(%rax),%eax
+ d3a:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ d3d:	72 5f                	jb     d9e <malloc+0xcf>
+      if(p->s.size == nunits)
+ d3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d43:	8b 40 08             	mov    0x8(%rax),%eax
+ d46:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ d49:	75 10                	jne    d5b <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+ d4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d4f:	48 8b 10             	mov    (%rax),%rdx
+ d52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d56:	48 89 10             	mov    %rdx,(%rax)
+ d59:	eb 2e                	jmp    d89 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+ d5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d5f:	8b 40 08             	mov    0x8(%rax),%eax
+ d62:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ d65:	89 c2                	mov    %eax,%edx
+ d67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d6b:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ d6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d72:	8b 40 08             	mov    0x8(%rax),%eax
+ d75:	89 c0                	mov    %eax,%eax
+ d77:	48 c1 e0 04          	shl    $0x4,%rax
+ d7b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ d7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d83:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ d86:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ d89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d8d:	48 89 05 2c 05 00 00 	mov    %rax,0x52c(%rip)        # 12c0 <freep>
+      return (void*)(p + 1);
+ d94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d98:	48 83 c0 10          	add    $0x10,%rax
+ d9c:	eb 41                	jmp    ddf <malloc+0x110>
+    }
+    if(p == freep)
+ d9e:	48 8b 05 1b 05 00 00 	mov    0x51b(%rip),%rax        # 12c0 <freep>
+ da5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ da9:	75 1c                	jne    dc7 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+ dab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ dae:	89 c7                	mov    %eax,%edi
+ db0:	e8 b5 fe ff ff       	call   c6a <morecore>
+ db5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ db9:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ dbe:	75 07                	jne    dc7 <malloc+0xf8>
+        return 0;
+ dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+ dc5:	eb 18                	jmp    ddf <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ dcb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ dcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ dd3:	48 8b 00             	mov    (%rax),%rax
+ dd6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ dda:	e9 54 ff ff ff       	jmp    d33 <malloc+0x64>
+  }
+}
+ ddf:	c9                   	leave
+ de0:	c3                   	ret
+
+0000000000000de1 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+ de1:	55                   	push   %rbp
+ de2:	48 89 e5             	mov    %rsp,%rbp
+ de5:	53                   	push   %rbx
+ de6:	48 83 ec 38          	sub    $0x38,%rsp
+ dea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ ded:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ df1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+ df5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ df9:	8b 40 40             	mov    0x40(%rax),%eax
+ dfc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+ dff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e03:	8b 00                	mov    (%rax),%eax
+ e05:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ e08:	29 c2                	sub    %eax,%edx
+ e0a:	83 fa 20             	cmp    $0x20,%edx
+ e0d:	75 0a                	jne    e19 <ring_send+0x38>
+    return -1;
+ e0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e14:	e9 93 00 00 00       	jmp    eac <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+ e19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e1c:	83 e0 1f             	and    $0x1f,%eax
+ e1f:	89 c2                	mov    %eax,%edx
+ e21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e25:	89 d2                	mov    %edx,%edx
+ e27:	48 83 c2 02          	add    $0x2,%rdx
+ e2b:	48 c1 e2 06          	shl    $0x6,%rdx
+ e2f:	48 01 c2             	add    %rax,%rdx
+ e32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ e36:	48 8b 08             	mov    (%rax),%rcx
+ e39:	48 8b 58 08          	mov    0x8(%rax),%rbx
+ e3d:	48 89 0a             	mov    %rcx,(%rdx)
+ e40:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+ e44:	48 8b 48 10          	mov    0x10(%rax),%rcx
+ e48:	48 8b 58 18          	mov    0x18(%rax),%rbx
+ e4c:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+ e50:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+ e54:	48 8b 48 20          	mov    0x20(%rax),%rcx
+ e58:	48 8b 58 28          	mov    0x28(%rax),%rbx
+ e5c:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+ e60:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+ e64:	48 8b 48 30          	mov    0x30(%rax),%rcx
+ e68:	48 8b 58 38          	mov    0x38(%rax),%rbx
+ e6c:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+ e70:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+ e74:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+ e7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e7d:	8d 50 01             	lea    0x1(%rax),%edx
+ e80:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e84:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+ e87:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+ e8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e91:	8b 00                	mov    (%rax),%eax
+ e93:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ e96:	75 0f                	jne    ea7 <ring_send+0xc6>
+    notify(channel, 1);
+ e98:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ e9b:	be 01 00 00 00       	mov    $0x1,%esi
+ ea0:	89 c7                	mov    %eax,%edi
+ ea2:	e8 a1 f7 ff ff       	call   648 <notify>
+  return 0;
+ ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ eac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ eb0:	c9                   	leave
+ eb1:	c3                   	ret
+
+0000000000000eb2 <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+ eb2:	55                   	push   %rbp
+ eb3:	48 89 e5             	mov    %rsp,%rbp
+ eb6:	53                   	push   %rbx
+ eb7:	48 83 ec 38          	sub    $0x38,%rsp
+ ebb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ ebe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ ec2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+ ec6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ eca:	8b 00                	mov    (%rax),%eax
+ ecc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+ ecf:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+ ed5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ ed9:	8b 40 40             	mov    0x40(%rax),%eax
+ edc:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ edf:	75 15                	jne    ef6 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+ ee1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ ee4:	89 c7                	mov    %eax,%edi
+ ee6:	e8 67 f7 ff ff       	call   652 <nfy_wait>
+ eeb:	85 c0                	test   %eax,%eax
+ eed:	79 e0                	jns    ecf <ring_recv+0x1d>
+      return -1;
+ eef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ef4:	eb 73                	jmp    f69 <ring_recv+0xb7>
+      break;
+ ef6:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+ ef7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ efa:	83 e0 1f             	and    $0x1f,%eax
+ efd:	89 c1                	mov    %eax,%ecx
+ eff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ f03:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ f07:	89 c9                	mov    %ecx,%ecx
+ f09:	48 83 c1 02          	add    $0x2,%rcx
+ f0d:	48 c1 e1 06          	shl    $0x6,%rcx
+ f11:	48 01 ca             	add    %rcx,%rdx
+ f14:	48 8b 0a             	mov    (%rdx),%rcx
+ f17:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+ f1b:	48 89 08             	mov    %rcx,(%rax)
+ f1e:	48 89 58 08          	mov    %rbx,0x8(%rax)
+ f22:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+ f26:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+ f2a:	48 89 48 10          	mov    %rcx,0x10(%rax)
+ f2e:	48 89 58 18          	mov    %rbx,0x18(%rax)
+ f32:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+ f36:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+ f3a:	48 89 48 20          	mov    %rcx,0x20(%rax)
+ f3e:	48 89 58 28          	mov    %rbx,0x28(%rax)
+ f42:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+ f46:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+ f4a:	48 89 48 30          	mov    %rcx,0x30(%rax)
+ f4e:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+ f52:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+ f58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ f5b:	8d 50 01             	lea    0x1(%rax),%edx
+ f5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ f62:	89 10                	mov    %edx,(%rax)
+  return 0;
+ f64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ f69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ f6d:	c9                   	leave
+ f6e:	c3                   	ret
+
+0000000000000f6f <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+ f6f:	55                   	push   %rbp
+ f70:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+ f73:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ f78:	8b 00                	mov    (%rax),%eax
+}
+ f7a:	5d                   	pop    %rbp
+ f7b:	c3                   	ret
+
+0000000000000f7c <getpid>:
+
+int
+getpid(void)
+{
+ f7c:	55                   	push   %rbp
+ f7d:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+ f80:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+ f85:	8b 00                	mov    (%rax),%eax
+}
+ f87:	5d                   	pop    %rbp
+ f88:	c3                   	ret
+
+0000000000000f89 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+ f89:	55                   	push   %rbp
+ f8a:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+ f8d:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ f92:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+ f96:	5d                   	pop    %rbp
+ f97:	c3                   	ret
@@ -0,0 +1,1897 @@
+
+fs/forkbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <rdtscp>:
+#define NITER 200
+#define NELEM(x) (sizeof(x)/sizeof((x)[0]))
+
+static inline unsigned long long
+rdtscp(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  uint lo, hi;
+  asm volatile("rdtscp" : "=a" (lo), "=d" (hi) : : "rcx");
+       8:	0f 01 f9             	rdtscp
+       b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+       e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((unsigned long long)hi << 32) | lo;
+      11:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      14:	48 c1 e0 20          	shl    $0x20,%rax
+      18:	48 89 c2             	mov    %rax,%rdx
+      1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      1e:	48 09 d0             	or     %rdx,%rax
+}
+      21:	c9                   	leave
+      22:	c3                   	ret
+
+0000000000000023 <worker>:
+
+static void
+worker(char *self)
+{
+      23:	55                   	push   %rbp
+      24:	48 89 e5             	mov    %rsp,%rbp
+      27:	48 83 ec 30          	sub    $0x30,%rsp
+      2b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  char *argv[] = { self, "-", 0 };
+      2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      33:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      37:	48 c7 45 e8 50 11 00 	movq   $0x1150,-0x18(%rbp)
+      3e:	00 
+      3f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+      46:	00 
+  int i, pid;
+
+  for(i = 0; i < NITER; i++){
+      47:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      4e:	eb 6d                	jmp    bd <worker+0x9a>
+    pid = fork();
+      50:	e8 c0 04 00 00       	call   515 <fork>
+      55:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(pid < 0){
+      58:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      5c:	79 1b                	jns    79 <worker+0x56>
+      printf(1, "forkbench: fork failed\n");
+      5e:	48 c7 c6 52 11 00 00 	mov    $0x1152,%rsi
+      65:	bf 01 00 00 00       	mov    $0x1,%edi
+      6a:	b8 00 00 00 00       	mov    $0x0,%eax
+      6f:	e8 1e 09 00 00       	call   992 <printf>
+      exit();
+      74:	e8 a6 04 00 00       	call   51f <exit>
+    }
+    if(pid == 0){
+      79:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      7d:	75 35                	jne    b4 <worker+0x91>
+      exec(self, argv);
+      7f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+      83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      87:	48 89 d6             	mov    %rdx,%rsi
+      8a:	48 89 c7             	mov    %rax,%rdi
+      8d:	e8 d3 04 00 00       	call   565 <exec>
+      printf(1, "forkbench: exec %s failed\n", self);
+      92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      96:	48 89 c2             	mov    %rax,%rdx
+      99:	48 c7 c6 6a 11 00 00 	mov    $0x116a,%rsi
+      a0:	bf 01 00 00 00       	mov    $0x1,%edi
+      a5:	b8 00 00 00 00       	mov    $0x0,%eax
+      aa:	e8 e3 08 00 00       	call   992 <printf>
+      exit();
+      af:	e8 6b 04 00 00       	call   51f <exit>
+    }
+    wait();
+      b4:	e8 70 04 00 00       	call   529 <wait>
+  for(i = 0; i < NITER; i++){
+      b9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      bd:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+      c4:	7e 8a                	jle    50 <worker+0x2d>
+  }
+  exit();
+      c6:	e8 54 04 00 00       	call   51f <exit>
+
+00000000000000cb <bench>:
+}
+
+static void
+bench(char *self, int p)
+{
+      cb:	55                   	push   %rbp
+      cc:	48 89 e5             	mov    %rsp,%rbp
+      cf:	48 83 ec 20          	sub    $0x20,%rsp
+      d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+      d7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  unsigned long long t;
+  int i;
+
+  t = rdtscp();
+      da:	e8 21 ff ff ff       	call   0 <rdtscp>
+      df:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(i = 0; i < p; i++)
+      e3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      ea:	eb 19                	jmp    105 <bench+0x3a>
+    if(fork() == 0)
+      ec:	e8 24 04 00 00       	call   515 <fork>
+      f1:	85 c0                	test   %eax,%eax
+      f3:	75 0c                	jne    101 <bench+0x36>
+      worker(self);
+      f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      f9:	48 89 c7             	mov    %rax,%rdi
+      fc:	e8 22 ff ff ff       	call   23 <worker>
+  for(i = 0; i < p; i++)
+     101:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     105:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     108:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+     10b:	7c df                	jl     ec <bench+0x21>
+  for(i = 0; i < p; i++)
+     10d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     114:	eb 09                	jmp    11f <bench+0x54>
+    wait();
+     116:	e8 0e 04 00 00       	call   529 <wait>
+  for(i = 0; i < p; i++)
+     11b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     11f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     122:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+     125:	7c ef                	jl     116 <bench+0x4b>
+  t = rdtscp() - t;
+     127:	e8 d4 fe ff ff       	call   0 <rdtscp>
+     12c:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+     130:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  printf(1, "forkbench procs=%d n=%d total=%d per=%d\n",
+         p, p*NITER, (int)(t / 1000), (int)(t / (p*NITER)));
+     134:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     137:	69 c0 c8 00 00 00    	imul   $0xc8,%eax,%eax
+     13d:	48 63 c8             	movslq %eax,%rcx
+     140:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     144:	ba 00 00 00 00       	mov    $0x0,%edx
+     149:	48 f7 f1             	div    %rcx
+  printf(1, "forkbench procs=%d n=%d total=%d per=%d\n",
+     14c:	89 c6                	mov    %eax,%esi
+         p, p*NITER, (int)(t / 1000), (int)(t / (p*NITER)));
+     14e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     152:	48 c1 e8 03          	shr    $0x3,%rax
+     156:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+     15d:	9b c4 20 
+     160:	48 f7 e2             	mul    %rdx
+     163:	48 89 d0             	mov    %rdx,%rax
+     166:	48 c1 e8 04          	shr    $0x4,%rax
+  printf(1, "forkbench procs=%d n=%d total=%d per=%d\n",
+     16a:	89 c1                	mov    %eax,%ecx
+     16c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     16f:	69 d0 c8 00 00 00    	imul   $0xc8,%eax,%edx
+     175:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     178:	41 89 f1             	mov    %esi,%r9d
+     17b:	41 89 c8             	mov    %ecx,%r8d
+     17e:	89 d1                	mov    %edx,%ecx
+     180:	89 c2                	mov    %eax,%edx
+     182:	48 c7 c6 88 11 00 00 	mov    $0x1188,%rsi
+     189:	bf 01 00 00 00       	mov    $0x1,%edi
+     18e:	b8 00 00 00 00       	mov    $0x0,%eax
+     193:	e8 fa 07 00 00       	call   992 <printf>
+}
+     198:	90                   	nop
+     199:	c9                   	leave
+     19a:	c3                   	ret
+
+000000000000019b <main>:
+
+int
+main(int argc, char *argv[])
+{
+     19b:	55                   	push   %rbp
+     19c:	48 89 e5             	mov    %rsp,%rbp
+     19f:	48 83 ec 20          	sub    $0x20,%rsp
+     1a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     1a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  static int procs[] = { 1, 2, 4, 8 };
+  int i;
+
+  if(argc > 1 && argv[1][0] == '-')
+     1aa:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     1ae:	7e 17                	jle    1c7 <main+0x2c>
+     1b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1b4:	48 83 c0 08          	add    $0x8,%rax
+     1b8:	48 8b 00             	mov    (%rax),%rax
+     1bb:	0f b6 00             	movzbl (%rax),%eax
+     1be:	3c 2d                	cmp    $0x2d,%al
+     1c0:	75 05                	jne    1c7 <main+0x2c>
+    exit();
+     1c2:	e8 58 03 00 00       	call   51f <exit>
+  printf(1, "forkbench start\n");
+     1c7:	48 c7 c6 b1 11 00 00 	mov    $0x11b1,%rsi
+     1ce:	bf 01 00 00 00       	mov    $0x1,%edi
+     1d3:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d8:	e8 b5 07 00 00       	call   992 <printf>
+  for(i = 0; i < NELEM(procs); i++)
+     1dd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     1e4:	eb 21                	jmp    207 <main+0x6c>
+    bench(argv[0], procs[i]);
+     1e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1e9:	48 98                	cltq
+     1eb:	8b 14 85 20 15 00 00 	mov    0x1520(,%rax,4),%edx
+     1f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1f6:	48 8b 00             	mov    (%rax),%rax
+     1f9:	89 d6                	mov    %edx,%esi
+     1fb:	48 89 c7             	mov    %rax,%rdi
+     1fe:	e8 c8 fe ff ff       	call   cb <bench>
+  for(i = 0; i < NELEM(procs); i++)
+     203:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     207:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     20a:	83 f8 03             	cmp    $0x3,%eax
+     20d:	76 d7                	jbe    1e6 <main+0x4b>
+  printf(1, "forkbench done\n");
+     20f:	48 c7 c6 c2 11 00 00 	mov    $0x11c2,%rsi
+     216:	bf 01 00 00 00       	mov    $0x1,%edi
+     21b:	b8 00 00 00 00       	mov    $0x0,%eax
+     220:	e8 6d 07 00 00       	call   992 <printf>
+  exit();
+     225:	e8 f5 02 00 00       	call   51f <exit>
+
+000000000000022a <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     22a:	55                   	push   %rbp
+     22b:	48 89 e5             	mov    %rsp,%rbp
+     22e:	48 83 ec 10          	sub    $0x10,%rsp
+     232:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     236:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     239:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     23c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     240:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     243:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     246:	48 89 ce             	mov    %rcx,%rsi
+     249:	48 89 f7             	mov    %rsi,%rdi
+     24c:	89 d1                	mov    %edx,%ecx
+     24e:	fc                   	cld
+     24f:	f3 aa                	rep stos %al,%es:(%rdi)
+     251:	89 ca                	mov    %ecx,%edx
+     253:	48 89 fe             	mov    %rdi,%rsi
+     256:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     25a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     25d:	90                   	nop
+     25e:	c9                   	leave
+     25f:	c3                   	ret
+
+0000000000000260 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     260:	55                   	push   %rbp
+     261:	48 89 e5             	mov    %rsp,%rbp
+     264:	48 83 ec 20          	sub    $0x20,%rsp
+     268:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     26c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     274:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     278:	90                   	nop
+     279:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     27d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     281:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     285:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     289:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     28d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     291:	0f b6 12             	movzbl (%rdx),%edx
+     294:	88 10                	mov    %dl,(%rax)
+     296:	0f b6 00             	movzbl (%rax),%eax
+     299:	84 c0                	test   %al,%al
+     29b:	75 dc                	jne    279 <strcpy+0x19>
+    ;
+  return os;
+     29d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     2a1:	c9                   	leave
+     2a2:	c3                   	ret
+
+00000000000002a3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2a3:	55                   	push   %rbp
+     2a4:	48 89 e5             	mov    %rsp,%rbp
+     2a7:	48 83 ec 10          	sub    $0x10,%rsp
+     2ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     2af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     2b3:	eb 0a                	jmp    2bf <strcmp+0x1c>
+    p++, q++;
+     2b5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     2ba:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     2bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2c3:	0f b6 00             	movzbl (%rax),%eax
+     2c6:	84 c0                	test   %al,%al
+     2c8:	74 12                	je     2dc <strcmp+0x39>
+     2ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2ce:	0f b6 10             	movzbl (%rax),%edx
+     2d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2d5:	0f b6 00             	movzbl (%rax),%eax
+     2d8:	38 c2                	cmp    %al,%dl
+     2da:	74 d9                	je     2b5 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     2dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2e0:	0f b6 00             	movzbl (%rax),%eax
+     2e3:	0f b6 d0             	movzbl %al,%edx
+     2e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2ea:	0f b6 00             	movzbl (%rax),%eax
+     2ed:	0f b6 c0             	movzbl %al,%eax
+     2f0:	29 c2                	sub    %eax,%edx
+     2f2:	89 d0                	mov    %edx,%eax
+}
+     2f4:	c9                   	leave
+     2f5:	c3                   	ret
+
+00000000000002f6 <strlen>:
+
+uint
+strlen(char *s)
+{
+     2f6:	55                   	push   %rbp
+     2f7:	48 89 e5             	mov    %rsp,%rbp
+     2fa:	48 83 ec 18          	sub    $0x18,%rsp
+     2fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     302:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     309:	eb 04                	jmp    30f <strlen+0x19>
+     30b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     30f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     312:	48 63 d0             	movslq %eax,%rdx
+     315:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     319:	48 01 d0             	add    %rdx,%rax
+     31c:	0f b6 00             	movzbl (%rax),%eax
+     31f:	84 c0                	test   %al,%al
+     321:	75 e8                	jne    30b <strlen+0x15>
+    ;
+  return n;
+     323:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     326:	c9                   	leave
+     327:	c3                   	ret
+
+0000000000000328 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     328:	55                   	push   %rbp
+     329:	48 89 e5             	mov    %rsp,%rbp
+     32c:	48 83 ec 10          	sub    $0x10,%rsp
+     330:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     334:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     337:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     33a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     33d:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     344:	89 ce                	mov    %ecx,%esi
+     346:	48 89 c7             	mov    %rax,%rdi
+     349:	e8 dc fe ff ff       	call   22a <stosb>
+  return dst;
+     34e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     352:	c9                   	leave
+     353:	c3                   	ret
+
+0000000000000354 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     354:	55                   	push   %rbp
+     355:	48 89 e5             	mov    %rsp,%rbp
+     358:	48 83 ec 10          	sub    $0x10,%rsp
+     35c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     360:	89 f0                	mov    %esi,%eax
+     362:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     365:	eb 17                	jmp    37e <strchr+0x2a>
+    if(*s == c)
+     367:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     36b:	0f b6 00             	movzbl (%rax),%eax
+     36e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     371:	75 06                	jne    379 <strchr+0x25>
+      return (char*)s;
+     373:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     377:	eb 15                	jmp    38e <strchr+0x3a>
+  for(; *s; s++)
+     379:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     37e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     382:	0f b6 00             	movzbl (%rax),%eax
+     385:	84 c0                	test   %al,%al
+     387:	75 de                	jne    367 <strchr+0x13>
+  return 0;
+     389:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     38e:	c9                   	leave
+     38f:	c3                   	ret
+
+0000000000000390 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     390:	55                   	push   %rbp
+     391:	48 89 e5             	mov    %rsp,%rbp
+     394:	48 83 ec 20          	sub    $0x20,%rsp
+     398:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     39c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     39f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     3a6:	eb 48                	jmp    3f0 <gets+0x60>
+    cc = read(0, &c, 1);
+     3a8:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     3ac:	ba 01 00 00 00       	mov    $0x1,%edx
+     3b1:	48 89 c6             	mov    %rax,%rsi
+     3b4:	bf 00 00 00 00       	mov    $0x0,%edi
+     3b9:	e8 7f 01 00 00       	call   53d <read>
+     3be:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     3c1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     3c5:	7e 36                	jle    3fd <gets+0x6d>
+      break;
+    buf[i++] = c;
+     3c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3ca:	8d 50 01             	lea    0x1(%rax),%edx
+     3cd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     3d0:	48 63 d0             	movslq %eax,%rdx
+     3d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3d7:	48 01 c2             	add    %rax,%rdx
+     3da:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     3de:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     3e0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     3e4:	3c 0a                	cmp    $0xa,%al
+     3e6:	74 16                	je     3fe <gets+0x6e>
+     3e8:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     3ec:	3c 0d                	cmp    $0xd,%al
+     3ee:	74 0e                	je     3fe <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     3f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3f3:	83 c0 01             	add    $0x1,%eax
+     3f6:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     3f9:	7f ad                	jg     3a8 <gets+0x18>
+     3fb:	eb 01                	jmp    3fe <gets+0x6e>
+      break;
+     3fd:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     3fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     401:	48 63 d0             	movslq %eax,%rdx
+     404:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     408:	48 01 d0             	add    %rdx,%rax
+     40b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     40e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     412:	c9                   	leave
+     413:	c3                   	ret
+
+0000000000000414 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     414:	55                   	push   %rbp
+     415:	48 89 e5             	mov    %rsp,%rbp
+     418:	48 83 ec 20          	sub    $0x20,%rsp
+     41c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     420:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     424:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     428:	be 00 00 00 00       	mov    $0x0,%esi
+     42d:	48 89 c7             	mov    %rax,%rdi
+     430:	e8 3a 01 00 00       	call   56f <open>
+     435:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     438:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     43c:	79 07                	jns    445 <stat+0x31>
+    return -1;
+     43e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     443:	eb 21                	jmp    466 <stat+0x52>
+  r = fstat(fd, st);
+     445:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     449:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     44c:	48 89 d6             	mov    %rdx,%rsi
+     44f:	89 c7                	mov    %eax,%edi
+     451:	e8 37 01 00 00       	call   58d <fstat>
+     456:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     459:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     45c:	89 c7                	mov    %eax,%edi
+     45e:	e8 ee 00 00 00       	call   551 <close>
+  return r;
+     463:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     466:	c9                   	leave
+     467:	c3                   	ret
+
+0000000000000468 <atoi>:
+
+int
+atoi(const char *s)
+{
+     468:	55                   	push   %rbp
+     469:	48 89 e5             	mov    %rsp,%rbp
+     46c:	48 83 ec 18          	sub    $0x18,%rsp
+     470:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     474:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     47b:	eb 28                	jmp    4a5 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     47d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     480:	89 d0                	mov    %edx,%eax
+     482:	c1 e0 02             	shl    $0x2,%eax
+     485:	01 d0                	add    %edx,%eax
+     487:	01 c0                	add    %eax,%eax
+     489:	89 c1                	mov    %eax,%ecx
+     48b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     48f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     493:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     497:	0f b6 00             	movzbl (%rax),%eax
+     49a:	0f be c0             	movsbl %al,%eax
+     49d:	01 c8                	add    %ecx,%eax
+     49f:	83 e8 30             	sub    $0x30,%eax
+     4a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     4a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     4a9:	0f b6 00             	movzbl (%rax),%eax
+     4ac:	3c 2f                	cmp    $0x2f,%al
+     4ae:	7e 0b                	jle    4bb <atoi+0x53>
+     4b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     4b4:	0f b6 00             	movzbl (%rax),%eax
+     4b7:	3c 39                	cmp    $0x39,%al
+     4b9:	7e c2                	jle    47d <atoi+0x15>
+  return n;
+     4bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     4be:	c9                   	leave
+     4bf:	c3                   	ret
+
+00000000000004c0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     4c0:	55                   	push   %rbp
+     4c1:	48 89 e5             	mov    %rsp,%rbp
+     4c4:	48 83 ec 28          	sub    $0x28,%rsp
+     4c8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     4cc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     4d0:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     4d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     4d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     4db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     4df:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     4e3:	eb 1d                	jmp    502 <memmove+0x42>
+    *dst++ = *src++;
+     4e5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     4e9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     4ed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     4f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4f5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     4f9:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     4fd:	0f b6 12             	movzbl (%rdx),%edx
+     500:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     502:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     505:	8d 50 ff             	lea    -0x1(%rax),%edx
+     508:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     50b:	85 c0                	test   %eax,%eax
+     50d:	7f d6                	jg     4e5 <memmove+0x25>
+  return vdst;
+     50f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     513:	c9                   	leave
+     514:	c3                   	ret
+
+0000000000000515 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     515:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     51c:	cd 40                	int    $0x40
+     51e:	c3                   	ret
+
+000000000000051f <exit>:
+SYSCALL_FAST(exit)
+     51f:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     526:	0f 05                	syscall
+     528:	c3                   	ret
+
+0000000000000529 <wait>:
+SYSCALL_FAST(wait)
+     529:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     530:	0f 05                	syscall
+     532:	c3                   	ret
+
+0000000000000533 <pipe>:
+SYSCALL_FAST(pipe)
+     533:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     53a:	0f 05                	syscall
+     53c:	c3                   	ret
+
+000000000000053d <read>:
+SYSCALL_FAST(read)
+     53d:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     544:	0f 05                	syscall
+     546:	c3                   	ret
+
+0000000000000547 <write>:
+SYSCALL_FAST(write)
+     547:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     54e:	0f 05                	syscall
+     550:	c3                   	ret
+
+0000000000000551 <close>:
+SYSCALL_FAST(close)
+     551:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     558:	0f 05                	syscall
+     55a:	c3                   	ret
+
+000000000000055b <kill>:
+SYSCALL_FAST(kill)
+     55b:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     562:	0f 05                	syscall
+     564:	c3                   	ret
+
+0000000000000565 <exec>:
+SYSCALL(exec)
+     565:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     56c:	cd 40                	int    $0x40
+     56e:	c3                   	ret
+
+000000000000056f <open>:
+SYSCALL_FAST(open)
+     56f:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     576:	0f 05                	syscall
+     578:	c3                   	ret
+
+0000000000000579 <mknod>:
+SYSCALL_FAST(mknod)
+     579:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     580:	0f 05                	syscall
+     582:	c3                   	ret
+
+0000000000000583 <unlink>:
+SYSCALL_FAST(unlink)
+     583:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     58a:	0f 05                	syscall
+     58c:	c3                   	ret
+
+000000000000058d <fstat>:
+SYSCALL_FAST(fstat)
+     58d:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     594:	0f 05                	syscall
+     596:	c3                   	ret
+
+0000000000000597 <link>:
+SYSCALL_FAST(link)
+     597:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     59e:	0f 05                	syscall
+     5a0:	c3                   	ret
+
+00000000000005a1 <mkdir>:
+SYSCALL_FAST(mkdir)
+     5a1:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     5a8:	0f 05                	syscall
+     5aa:	c3                   	ret
+
+00000000000005ab <chdir>:
+SYSCALL_FAST(chdir)
+     5ab:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     5b2:	0f 05                	syscall
+     5b4:	c3                   	ret
+
+00000000000005b5 <dup>:
+SYSCALL_FAST(dup)
+     5b5:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     5bc:	0f 05                	syscall
+     5be:	c3                   	ret
+
+00000000000005bf <sbrk>:
+SYSCALL_FAST(sbrk)
+     5bf:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     5c6:	0f 05                	syscall
+     5c8:	c3                   	ret
+
+00000000000005c9 <sleep>:
+SYSCALL_FAST(sleep)
+     5c9:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     5d0:	0f 05                	syscall
+     5d2:	c3                   	ret
+
+00000000000005d3 <send>:
+SYSCALL_FAST(send)
+     5d3:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     5da:	0f 05                	syscall
+     5dc:	c3                   	ret
+
+00000000000005dd <send_recv>:
+SYSCALL_FAST(send_recv)
+     5dd:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     5e4:	0f 05                	syscall
+     5e6:	c3                   	ret
+
+00000000000005e7 <recv>:
+SYSCALL_FAST(recv)
+     5e7:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     5ee:	0f 05                	syscall
+     5f0:	c3                   	ret
+
+00000000000005f1 <call>:
+SYSCALL_FAST(call)
+     5f1:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     5f8:	0f 05                	syscall
+     5fa:	c3                   	ret
+
+00000000000005fb <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     5fb:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     602:	0f 05                	syscall
+     604:	c3                   	ret
+
+0000000000000605 <send_reg>:
+SYSCALL_REG(send_reg)
+     605:	41 54                	push   %r12
+     607:	41 55                	push   %r13
+     609:	41 56                	push   %r14
+     60b:	41 57                	push   %r15
+     60d:	56                   	push   %rsi
+     60e:	49 89 f3             	mov    %rsi,%r11
+     611:	48 89 d6             	mov    %rdx,%rsi
+     614:	49 8b 13             	mov    (%r11),%rdx
+     617:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     61b:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     61f:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     623:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     627:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     62b:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     62f:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     633:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     63a:	0f 05                	syscall
+     63c:	41 5b                	pop    %r11
+     63e:	49 89 13             	mov    %rdx,(%r11)
+     641:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     645:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     649:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     64d:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     651:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     655:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     659:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     65d:	41 5f                	pop    %r15
+     65f:	41 5e                	pop    %r14
+     661:	41 5d                	pop    %r13
+     663:	41 5c                	pop    %r12
+     665:	c3                   	ret
+
+0000000000000666 <recv_reg>:
+SYSCALL_REG(recv_reg)
+     666:	41 54                	push   %r12
+     668:	41 55                	push   %r13
+     66a:	41 56                	push   %r14
+     66c:	41 57                	push   %r15
+     66e:	56                   	push   %rsi
+     66f:	49 89 f3             	mov    %rsi,%r11
+     672:	48 89 d6             	mov    %rdx,%rsi
+     675:	49 8b 13             	mov    (%r11),%rdx
+     678:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     67c:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     680:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     684:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     688:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     68c:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     690:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     694:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+     69b:	0f 05                	syscall
+     69d:	41 5b                	pop    %r11
+     69f:	49 89 13             	mov    %rdx,(%r11)
+     6a2:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     6a6:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     6aa:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     6ae:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     6b2:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     6b6:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     6ba:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     6be:	41 5f                	pop    %r15
+     6c0:	41 5e                	pop    %r14
+     6c2:	41 5d                	pop    %r13
+     6c4:	41 5c                	pop    %r12
+     6c6:	c3                   	ret
+
+00000000000006c7 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+     6c7:	41 54                	push   %r12
+     6c9:	41 55                	push   %r13
+     6cb:	41 56                	push   %r14
+     6cd:	41 57                	push   %r15
+     6cf:	56                   	push   %rsi
+     6d0:	49 89 f3             	mov    %rsi,%r11
+     6d3:	48 89 d6             	mov    %rdx,%rsi
+     6d6:	49 8b 13             	mov    (%r11),%rdx
+     6d9:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     6dd:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     6e1:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     6e5:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     6e9:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     6ed:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     6f1:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     6f5:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+     6fc:	0f 05                	syscall
+     6fe:	41 5b                	pop    %r11
+     700:	49 89 13             	mov    %rdx,(%r11)
+     703:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     707:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     70b:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     70f:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     713:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     717:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     71b:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     71f:	41 5f                	pop    %r15
+     721:	41 5e                	pop    %r14
+     723:	41 5d                	pop    %r13
+     725:	41 5c                	pop    %r12
+     727:	c3                   	ret
+
+0000000000000728 <call_reg>:
+SYSCALL_REG(call_reg)
+     728:	41 54                	push   %r12
+     72a:	41 55                	push   %r13
+     72c:	41 56                	push   %r14
+     72e:	41 57                	push   %r15
+     730:	56                   	push   %rsi
+     731:	49 89 f3             	mov    %rsi,%r11
+     734:	48 89 d6             	mov    %rdx,%rsi
+     737:	49 8b 13             	mov    (%r11),%rdx
+     73a:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     73e:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     742:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     746:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     74a:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     74e:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     752:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     756:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+     75d:	0f 05                	syscall
+     75f:	41 5b                	pop    %r11
+     761:	49 89 13             	mov    %rdx,(%r11)
+     764:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     768:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     76c:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     770:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     774:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     778:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     77c:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     780:	41 5f                	pop    %r15
+     782:	41 5e                	pop    %r14
+     784:	41 5d                	pop    %r13
+     786:	41 5c                	pop    %r12
+     788:	c3                   	ret
+
+0000000000000789 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+     789:	41 54                	push   %r12
+     78b:	41 55                	push   %r13
+     78d:	41 56                	push   %r14
+     78f:	41 57                	push   %r15
+     791:	56                   	push   %rsi
+     792:	49 89 f3             	mov    %rsi,%r11
+     795:	48 89 d6             	mov    %rdx,%rsi
+     798:	49 8b 13             	mov    (%r11),%rdx
+     79b:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     79f:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     7a3:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     7a7:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     7ab:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     7af:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     7b3:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     7b7:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+     7be:	0f 05                	syscall
+     7c0:	41 5b                	pop    %r11
+     7c2:	49 89 13             	mov    %rdx,(%r11)
+     7c5:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     7c9:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     7cd:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     7d1:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     7d5:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     7d9:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     7dd:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     7e1:	41 5f                	pop    %r15
+     7e3:	41 5e                	pop    %r14
+     7e5:	41 5d                	pop    %r13
+     7e7:	41 5c                	pop    %r12
+     7e9:	c3                   	ret
+
+00000000000007ea <sendx>:
+SYSCALL_FAST(sendx)
+     7ea:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+     7f1:	0f 05                	syscall
+     7f3:	c3                   	ret
+
+00000000000007f4 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+     7f4:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+     7fb:	0f 05                	syscall
+     7fd:	c3                   	ret
+
+00000000000007fe <notify>:
+SYSCALL_FAST(notify)
+     7fe:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+     805:	0f 05                	syscall
+     807:	c3                   	ret
+
+0000000000000808 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+     808:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+     80f:	0f 05                	syscall
+     811:	c3                   	ret
+
+0000000000000812 <send_timed>:
+SYSCALL_FAST(send_timed)
+     812:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+     819:	0f 05                	syscall
+     81b:	c3                   	ret
+
+000000000000081c <recv_timed>:
+SYSCALL_FAST(recv_timed)
+     81c:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+     823:	0f 05                	syscall
+     825:	c3                   	ret
+
+0000000000000826 <set_add>:
+SYSCALL_FAST(set_add)
+     826:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+     82d:	0f 05                	syscall
+     82f:	c3                   	ret
+
+0000000000000830 <set_del>:
+SYSCALL_FAST(set_del)
+     830:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+     837:	0f 05                	syscall
+     839:	c3                   	ret
+
+000000000000083a <recv_any>:
+SYSCALL_FAST(recv_any)
+     83a:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+     841:	0f 05                	syscall
+     843:	c3                   	ret
+
+0000000000000844 <ep_create>:
+SYSCALL_FAST(ep_create)
+     844:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+     84b:	0f 05                	syscall
+     84d:	c3                   	ret
+
+000000000000084e <ep_close>:
+SYSCALL_FAST(ep_close)
+     84e:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+     855:	0f 05                	syscall
+     857:	c3                   	ret
+
+0000000000000858 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+     858:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+     85f:	0f 05                	syscall
+     861:	c3                   	ret
+
+0000000000000862 <setprio>:
+SYSCALL_FAST(setprio)
+     862:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+     869:	0f 05                	syscall
+     86b:	c3                   	ret
+
+000000000000086c <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+     86c:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+     873:	0f 05                	syscall
+     875:	c3                   	ret
+
+0000000000000876 <sethuge>:
+SYSCALL_FAST(sethuge)
+     876:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+     87d:	0f 05                	syscall
+     87f:	c3                   	ret
+
+0000000000000880 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+     880:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+     887:	0f 05                	syscall
+     889:	c3                   	ret
+
+000000000000088a <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+     88a:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+     891:	0f 05                	syscall
+     893:	c3                   	ret
+
+0000000000000894 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+     894:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+     89b:	0f 05                	syscall
+     89d:	c3                   	ret
+
+000000000000089e <null_call>:
+     89e:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+     8a5:	0f 05                	syscall
+     8a7:	c3                   	ret
+
+00000000000008a8 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     8a8:	55                   	push   %rbp
+     8a9:	48 89 e5             	mov    %rsp,%rbp
+     8ac:	48 83 ec 10          	sub    $0x10,%rsp
+     8b0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     8b3:	89 f0                	mov    %esi,%eax
+     8b5:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     8b8:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     8bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8bf:	ba 01 00 00 00       	mov    $0x1,%edx
+     8c4:	48 89 ce             	mov    %rcx,%rsi
+     8c7:	89 c7                	mov    %eax,%edi
+     8c9:	e8 79 fc ff ff       	call   547 <write>
+}
+     8ce:	90                   	nop
+     8cf:	c9                   	leave
+     8d0:	c3                   	ret
+
+00000000000008d1 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     8d1:	55                   	push   %rbp
+     8d2:	48 89 e5             	mov    %rsp,%rbp
+     8d5:	48 83 ec 30          	sub    $0x30,%rsp
+     8d9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     8dc:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     8df:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     8e2:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     8e5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     8ec:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     8f0:	74 17                	je     909 <printint+0x38>
+     8f2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     8f6:	79 11                	jns    909 <printint+0x38>
+    neg = 1;
+     8f8:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     8ff:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     902:	f7 d8                	neg    %eax
+     904:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     907:	eb 06                	jmp    90f <printint+0x3e>
+  } else {
+    x = xx;
+     909:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     90c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     90f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     916:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     919:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     91c:	ba 00 00 00 00       	mov    $0x0,%edx
+     921:	f7 f1                	div    %ecx
+     923:	89 d1                	mov    %edx,%ecx
+     925:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     928:	8d 50 01             	lea    0x1(%rax),%edx
+     92b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     92e:	89 ca                	mov    %ecx,%edx
+     930:	0f b6 92 30 15 00 00 	movzbl 0x1530(%rdx),%edx
+     937:	48 98                	cltq
+     939:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     93d:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     940:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     943:	ba 00 00 00 00       	mov    $0x0,%edx
+     948:	f7 f6                	div    %esi
+     94a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     94d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     951:	75 c3                	jne    916 <printint+0x45>
+  if(neg)
+     953:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     957:	74 2b                	je     984 <printint+0xb3>
+    buf[i++] = '-';
+     959:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     95c:	8d 50 01             	lea    0x1(%rax),%edx
+     95f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     962:	48 98                	cltq
+     964:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+     969:	eb 19                	jmp    984 <printint+0xb3>
+    putc(fd, buf[i]);
+     96b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     96e:	48 98                	cltq
+     970:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+     975:	0f be d0             	movsbl %al,%edx
+     978:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     97b:	89 d6                	mov    %edx,%esi
+     97d:	89 c7                	mov    %eax,%edi
+     97f:	e8 24 ff ff ff       	call   8a8 <putc>
+  while(--i >= 0)
+     984:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     988:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     98c:	79 dd                	jns    96b <printint+0x9a>
+}
+     98e:	90                   	nop
+     98f:	90                   	nop
+     990:	c9                   	leave
+     991:	c3                   	ret
+
+0000000000000992 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     992:	55                   	push   %rbp
+     993:	48 89 e5             	mov    %rsp,%rbp
+     996:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+     99d:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+     9a3:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+     9aa:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+     9b1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+     9b8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+     9bf:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+     9c6:	84 c0                	test   %al,%al
+     9c8:	74 20                	je     9ea <printf+0x58>
+     9ca:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+     9ce:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+     9d2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+     9d6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+     9da:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+     9de:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+     9e2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+     9e6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+     9ea:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+     9f1:	00 00 00 
+     9f4:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+     9fb:	00 00 00 
+     9fe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     a02:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+     a09:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+     a10:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+     a17:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     a1e:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     a21:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+     a28:	00 00 00 
+     a2b:	e9 a8 02 00 00       	jmp    cd8 <printf+0x346>
+    c = fmt[i] & 0xff;
+     a30:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     a36:	48 63 d0             	movslq %eax,%rdx
+     a39:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     a40:	48 01 d0             	add    %rdx,%rax
+     a43:	0f b6 00             	movzbl (%rax),%eax
+     a46:	0f be c0             	movsbl %al,%eax
+     a49:	25 ff 00 00 00       	and    $0xff,%eax
+     a4e:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+     a54:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+     a5b:	75 35                	jne    a92 <printf+0x100>
+      if(c == '%'){
+     a5d:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     a64:	75 0f                	jne    a75 <printf+0xe3>
+        state = '%';
+     a66:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+     a6d:	00 00 00 
+     a70:	e9 5c 02 00 00       	jmp    cd1 <printf+0x33f>
+      } else {
+        putc(fd, c);
+     a75:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     a7b:	0f be d0             	movsbl %al,%edx
+     a7e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     a84:	89 d6                	mov    %edx,%esi
+     a86:	89 c7                	mov    %eax,%edi
+     a88:	e8 1b fe ff ff       	call   8a8 <putc>
+     a8d:	e9 3f 02 00 00       	jmp    cd1 <printf+0x33f>
+      }
+    } else if(state == '%'){
+     a92:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+     a99:	0f 85 32 02 00 00    	jne    cd1 <printf+0x33f>
+      if(c == 'd'){
+     a9f:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+     aa6:	75 5e                	jne    b06 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+     aa8:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     aae:	83 f8 2f             	cmp    $0x2f,%eax
+     ab1:	77 23                	ja     ad6 <printf+0x144>
+     ab3:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     aba:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     ac0:	89 d2                	mov    %edx,%edx
+     ac2:	48 01 d0             	add    %rdx,%rax
+     ac5:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     acb:	83 c2 08             	add    $0x8,%edx
+     ace:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     ad4:	eb 12                	jmp    ae8 <printf+0x156>
+     ad6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     add:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ae1:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     ae8:	8b 30                	mov    (%rax),%esi
+     aea:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     af0:	b9 01 00 00 00       	mov    $0x1,%ecx
+     af5:	ba 0a 00 00 00       	mov    $0xa,%edx
+     afa:	89 c7                	mov    %eax,%edi
+     afc:	e8 d0 fd ff ff       	call   8d1 <printint>
+     b01:	e9 c1 01 00 00       	jmp    cc7 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+     b06:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+     b0d:	74 09                	je     b18 <printf+0x186>
+     b0f:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+     b16:	75 5e                	jne    b76 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+     b18:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     b1e:	83 f8 2f             	cmp    $0x2f,%eax
+     b21:	77 23                	ja     b46 <printf+0x1b4>
+     b23:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     b2a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b30:	89 d2                	mov    %edx,%edx
+     b32:	48 01 d0             	add    %rdx,%rax
+     b35:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b3b:	83 c2 08             	add    $0x8,%edx
+     b3e:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     b44:	eb 12                	jmp    b58 <printf+0x1c6>
+     b46:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     b4d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     b51:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     b58:	8b 30                	mov    (%rax),%esi
+     b5a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b60:	b9 00 00 00 00       	mov    $0x0,%ecx
+     b65:	ba 10 00 00 00       	mov    $0x10,%edx
+     b6a:	89 c7                	mov    %eax,%edi
+     b6c:	e8 60 fd ff ff       	call   8d1 <printint>
+     b71:	e9 51 01 00 00       	jmp    cc7 <printf+0x335>
+      } else if(c == 's'){
+     b76:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+     b7d:	0f 85 98 00 00 00    	jne    c1b <printf+0x289>
+        s = va_arg(ap, char*);
+     b83:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     b89:	83 f8 2f             	cmp    $0x2f,%eax
+     b8c:	77 23                	ja     bb1 <printf+0x21f>
+     b8e:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     b95:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b9b:	89 d2                	mov    %edx,%edx
+     b9d:	48 01 d0             	add    %rdx,%rax
+     ba0:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     ba6:	83 c2 08             	add    $0x8,%edx
+     ba9:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     baf:	eb 12                	jmp    bc3 <printf+0x231>
+     bb1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     bb8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     bbc:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     bc3:	48 8b 00             	mov    (%rax),%rax
+     bc6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+     bcd:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+     bd4:	00 
+     bd5:	75 31                	jne    c08 <printf+0x276>
+          s = "(null)";
+     bd7:	48 c7 85 48 ff ff ff 	movq   $0x11d2,-0xb8(%rbp)
+     bde:	d2 11 00 00 
+        while(*s != 0){
+     be2:	eb 24                	jmp    c08 <printf+0x276>
+          putc(fd, *s);
+     be4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     beb:	0f b6 00             	movzbl (%rax),%eax
+     bee:	0f be d0             	movsbl %al,%edx
+     bf1:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     bf7:	89 d6                	mov    %edx,%esi
+     bf9:	89 c7                	mov    %eax,%edi
+     bfb:	e8 a8 fc ff ff       	call   8a8 <putc>
+          s++;
+     c00:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+     c07:	01 
+        while(*s != 0){
+     c08:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     c0f:	0f b6 00             	movzbl (%rax),%eax
+     c12:	84 c0                	test   %al,%al
+     c14:	75 ce                	jne    be4 <printf+0x252>
+     c16:	e9 ac 00 00 00       	jmp    cc7 <printf+0x335>
+        }
+      } else if(c == 'c'){
+     c1b:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+     c22:	75 56                	jne    c7a <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+     c24:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     c2a:	83 f8 2f             	cmp    $0x2f,%eax
+     c2d:	77 23                	ja     c52 <printf+0x2c0>
+     c2f:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     c36:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c3c:	89 d2                	mov    %edx,%edx
+     c3e:	48 01 d0             	add    %rdx,%rax
+     c41:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c47:	83 c2 08             	add    $0x8,%edx
+     c4a:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     c50:	eb 12                	jmp    c64 <printf+0x2d2>
+     c52:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     c59:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c5d:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     c64:	8b 00                	mov    (%rax),%eax
+     c66:	0f be d0             	movsbl %al,%edx
+     c69:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c6f:	89 d6                	mov    %edx,%esi
+     c71:	89 c7                	mov    %eax,%edi
+     c73:	e8 30 fc ff ff       	call   8a8 <putc>
+     c78:	eb 4d                	jmp    cc7 <printf+0x335>
+      } else if(c == '%'){
+     c7a:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     c81:	75 1a                	jne    c9d <printf+0x30b>
+        putc(fd, c);
+     c83:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     c89:	0f be d0             	movsbl %al,%edx
+     c8c:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c92:	89 d6                	mov    %edx,%esi
+     c94:	89 c7                	mov    %eax,%edi
+     c96:	e8 0d fc ff ff       	call   8a8 <putc>
+     c9b:	eb 2a                	jmp    cc7 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     c9d:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     ca3:	be 25 00 00 00       	mov    $0x25,%esi
+     ca8:	89 c7                	mov    %eax,%edi
+     caa:	e8 f9 fb ff ff       	call   8a8 <putc>
+        putc(fd, c);
+     caf:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     cb5:	0f be d0             	movsbl %al,%edx
+     cb8:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     cbe:	89 d6                	mov    %edx,%esi
+     cc0:	89 c7                	mov    %eax,%edi
+     cc2:	e8 e1 fb ff ff       	call   8a8 <putc>
+      }
+      state = 0;
+     cc7:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     cce:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     cd1:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+     cd8:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     cde:	48 63 d0             	movslq %eax,%rdx
+     ce1:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     ce8:	48 01 d0             	add    %rdx,%rax
+     ceb:	0f b6 00             	movzbl (%rax),%eax
+     cee:	84 c0                	test   %al,%al
+     cf0:	0f 85 3a fd ff ff    	jne    a30 <printf+0x9e>
+    }
+  }
+}
+     cf6:	90                   	nop
+     cf7:	90                   	nop
+     cf8:	c9                   	leave
+     cf9:	c3                   	ret
+
+0000000000000cfa <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     cfa:	55                   	push   %rbp
+     cfb:	48 89 e5             	mov    %rsp,%rbp
+     cfe:	48 83 ec 18          	sub    $0x18,%rsp
+     d02:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     d06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d0a:	48 83 e8 10          	sub    $0x10,%rax
+     d0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d12:	48 8b 05 47 08 00 00 	mov    0x847(%rip),%rax        # 1560 <freep>
+     d19:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     d1d:	eb 2f                	jmp    d4e <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d23:	48 8b 00             	mov    (%rax),%rax
+     d26:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     d2a:	72 17                	jb     d43 <free+0x49>
+     d2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d30:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     d34:	72 2f                	jb     d65 <free+0x6b>
+     d36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d3a:	48 8b 00             	mov    (%rax),%rax
+     d3d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     d41:	72 22                	jb     d65 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d47:	48 8b 00             	mov    (%rax),%rax
+     d4a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     d4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d52:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     d56:	73 c7                	jae    d1f <free+0x25>
+     d58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d5c:	48 8b 00             	mov    (%rax),%rax
+     d5f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     d63:	73 ba                	jae    d1f <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     d65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d69:	8b 40 08             	mov    0x8(%rax),%eax
+     d6c:	89 c0                	mov    %eax,%eax
+     d6e:	48 c1 e0 04          	shl    $0x4,%rax
+     d72:	48 89 c2             	mov    %rax,%rdx
+     d75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d79:	48 01 c2             	add    %rax,%rdx
+     d7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d80:	48 8b 00             	mov    (%rax),%rax
+     d83:	48 39 c2             	cmp    %rax,%rdx
+     d86:	75 2d                	jne    db5 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+     d88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d8c:	8b 50 08             	mov    0x8(%rax),%edx
+     d8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d93:	48 8b 00             	mov    (%rax),%rax
+     d96:	8b 40 08             	mov    0x8(%rax),%eax
+     d99:	01 c2                	add    %eax,%edx
+     d9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d9f:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     da2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     da6:	48 8b 00             	mov    (%rax),%rax
+     da9:	48 8b 10             	mov    (%rax),%rdx
+     dac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     db0:	48 89 10             	mov    %rdx,(%rax)
+     db3:	eb 0e                	jmp    dc3 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+     db5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     db9:	48 8b 10             	mov    (%rax),%rdx
+     dbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     dc0:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dc7:	8b 40 08             	mov    0x8(%rax),%eax
+     dca:	89 c0                	mov    %eax,%eax
+     dcc:	48 c1 e0 04          	shl    $0x4,%rax
+     dd0:	48 89 c2             	mov    %rax,%rdx
+     dd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dd7:	48 01 d0             	add    %rdx,%rax
+     dda:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     dde:	75 27                	jne    e07 <free+0x10d>
+    p->s.size += bp->s.size;
+     de0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     de4:	8b 50 08             	mov    0x8(%rax),%edx
+     de7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     deb:	8b 40 08             	mov    0x8(%rax),%eax
+     dee:	01 c2                	add    %eax,%edx
+     df0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     df4:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     df7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     dfb:	48 8b 10             	mov    (%rax),%rdx
+     dfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e02:	48 89 10             	mov    %rdx,(%rax)
+     e05:	eb 0b                	jmp    e12 <free+0x118>
+  } else
+    p->s.ptr = bp;
+     e07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e0b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e0f:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     e12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e16:	48 89 05 43 07 00 00 	mov    %rax,0x743(%rip)        # 1560 <freep>
+}
+     e1d:	90                   	nop
+     e1e:	c9                   	leave
+     e1f:	c3                   	ret
+
+0000000000000e20 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     e20:	55                   	push   %rbp
+     e21:	48 89 e5             	mov    %rsp,%rbp
+     e24:	48 83 ec 20          	sub    $0x20,%rsp
+     e28:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     e2b:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     e32:	77 07                	ja     e3b <morecore+0x1b>
+    nu = 4096;
+     e34:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     e3b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     e3e:	c1 e0 04             	shl    $0x4,%eax
+     e41:	89 c7                	mov    %eax,%edi
+     e43:	e8 77 f7 ff ff       	call   5bf <sbrk>
+     e48:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     e4c:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     e51:	75 07                	jne    e5a <morecore+0x3a>
+    return 0;
+     e53:	b8 00 00 00 00       	mov    $0x0,%eax
+     e58:	eb 29                	jmp    e83 <morecore+0x63>
+  hp = (Header*)p;
+     e5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e5e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     e62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e66:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     e69:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     e6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e70:	48 83 c0 10          	add    $0x10,%rax
+     e74:	48 89 c7             	mov    %rax,%rdi
+     e77:	e8 7e fe ff ff       	call   cfa <free>
+  return freep;
+     e7c:	48 8b 05 dd 06 00 00 	mov    0x6dd(%rip),%rax        # 1560 <freep>
+}
+     e83:	c9                   	leave
+     e84:	c3                   	ret
+
+0000000000000e85 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     e85:	55                   	push   %rbp
+     e86:	48 89 e5             	mov    %rsp,%rbp
+     e89:	48 83 ec 30          	sub    $0x30,%rsp
+     e8d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e93:	48 83 c0 0f          	add    $0xf,%rax
+     e97:	48 c1 e8 04          	shr    $0x4,%rax
+     e9b:	83 c0 01             	add    $0x1,%eax
+     e9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+     ea1:	48 8b 05 b8 06 00 00 	mov    0x6b8(%rip),%rax        # 1560 <freep>
+     ea8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     eac:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     eb1:	75 2b                	jne    ede <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+     eb3:	48 c7 45 f0 50 15 00 	movq   $0x1550,-0x10(%rbp)
+     eba:	00 
+     ebb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ebf:	48 89 05 9a 06 00 00 	mov    %rax,0x69a(%rip)        # 1560 <freep>
+     ec6:	48 8b 05 93 06 00 00 	mov    0x693(%rip),%rax        # 1560 <freep>
+     ecd:	48 89 05 7c 06 00 00 	mov    %rax,0x67c(%rip)        # 1550 <base>
+    base.s.size = 0;
+     ed4:	c7 05 7a 06 00 00 00 	movl   $0x0,0x67a(%rip)        # 1558 <base+0x8>
+     edb:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ede:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ee2:	48 8b 00             	mov    (%rax),%rax
+     ee5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     ee9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eed:	8b 40 08             	mov    0x8(%rax),%eax
+     ef0:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     ef3:	72 5f                	jb     f54 <malloc+0xcf>
+      if(p->s.size == nunits)
+     ef5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ef9:	8b 40 08             	mov    0x8(%rax),%eax
+     efc:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     eff:	75 10                	jne    f11 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+     f01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f05:	48 8b 10             	mov    (%rax),%rdx
+     f08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f0c:	48 89 10             	mov    %rdx,(%rax)
+     f0f:	eb 2e                	jmp    f3f <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+     f11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f15:	8b 40 08             	mov    0x8(%rax),%eax
+     f18:	2b 45 ec             	sub    -0x14(%rbp),%eax
+     f1b:	89 c2                	mov    %eax,%edx
+     f1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f21:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+     f24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f28:	8b 40 08             	mov    0x8(%rax),%eax
+     f2b:	89 c0                	mov    %eax,%eax
+     f2d:	48 c1 e0 04          	shl    $0x4,%rax
+     f31:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+     f35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f39:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     f3c:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+     f3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f43:	48 89 05 16 06 00 00 	mov    %rax,0x616(%rip)        # 1560 <freep>
+      return (void*)(p + 1);
+     f4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f4e:	48 83 c0 10          	add    $0x10,%rax
+     f52:	eb 41                	jmp    f95 <malloc+0x110>
+    }
+    if(p == freep)
+     f54:	48 8b 05 05 06 00 00 	mov    0x605(%rip),%rax        # 1560 <freep>
+     f5b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     f5f:	75 1c                	jne    f7d <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+     f61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f64:	89 c7                	mov    %eax,%edi
+     f66:	e8 b5 fe ff ff       	call   e20 <morecore>
+     f6b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     f6f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     f74:	75 07                	jne    f7d <malloc+0xf8>
+        return 0;
+     f76:	b8 00 00 00 00       	mov    $0x0,%eax
+     f7b:	eb 18                	jmp    f95 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f81:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     f85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f89:	48 8b 00             	mov    (%rax),%rax
+     f8c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     f90:	e9 54 ff ff ff       	jmp    ee9 <malloc+0x64>
+  }
+}
+     f95:	c9                   	leave
+     f96:	c3                   	ret
+
+0000000000000f97 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+     f97:	55                   	push   %rbp
+     f98:	48 89 e5             	mov    %rsp,%rbp
+     f9b:	53                   	push   %rbx
+     f9c:	48 83 ec 38          	sub    $0x38,%rsp
+     fa0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     fa3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     fa7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+     fab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     faf:	8b 40 40             	mov    0x40(%rax),%eax
+     fb2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+     fb5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     fb9:	8b 00                	mov    (%rax),%eax
+     fbb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     fbe:	29 c2                	sub    %eax,%edx
+     fc0:	83 fa 20             	cmp    $0x20,%edx
+     fc3:	75 0a                	jne    fcf <ring_send+0x38>
+    return -1;
+     fc5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fca:	e9 93 00 00 00       	jmp    1062 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+     fcf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fd2:	83 e0 1f             	and    $0x1f,%eax
+     fd5:	89 c2                	mov    %eax,%edx
+     fd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     fdb:	89 d2                	mov    %edx,%edx
+     fdd:	48 83 c2 02          	add    $0x2,%rdx
+     fe1:	48 c1 e2 06          	shl    $0x6,%rdx
+     fe5:	48 01 c2             	add    %rax,%rdx
+     fe8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     fec:	48 8b 08             	mov    (%rax),%rcx
+     fef:	48 8b 58 08          	mov    0x8(%rax),%rbx
+     ff3:	48 89 0a             	mov    %rcx,(%rdx)
+     ff6:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+     ffa:	48 8b 48 10          	mov    0x10(%rax),%rcx
+     ffe:	48 8b 58 18          	mov    0x18(%rax),%rbx
+    1002:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+    1006:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+    100a:	48 8b 48 20          	mov    0x20(%rax),%rcx
+    100e:	48 8b 58 28          	mov    0x28(%rax),%rbx
+    1012:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+    1016:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+    101a:	48 8b 48 30          	mov    0x30(%rax),%rcx
+    101e:	48 8b 58 38          	mov    0x38(%rax),%rbx
+    1022:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+    1026:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+    102a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+    1030:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1033:	8d 50 01             	lea    0x1(%rax),%edx
+    1036:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    103a:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+    103d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+    1043:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1047:	8b 00                	mov    (%rax),%eax
+    1049:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    104c:	75 0f                	jne    105d <ring_send+0xc6>
+    notify(channel, 1);
+    104e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1051:	be 01 00 00 00       	mov    $0x1,%esi
+    1056:	89 c7                	mov    %eax,%edi
+    1058:	e8 a1 f7 ff ff       	call   7fe <notify>
+  return 0;
+    105d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1062:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1066:	c9                   	leave
+    1067:	c3                   	ret
+
+0000000000001068 <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+    1068:	55                   	push   %rbp
+    1069:	48 89 e5             	mov    %rsp,%rbp
+    106c:	53                   	push   %rbx
+    106d:	48 83 ec 38          	sub    $0x38,%rsp
+    1071:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1074:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1078:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+    107c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1080:	8b 00                	mov    (%rax),%eax
+    1082:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+    1085:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+    108b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    108f:	8b 40 40             	mov    0x40(%rax),%eax
+    1092:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1095:	75 15                	jne    10ac <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+    1097:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    109a:	89 c7                	mov    %eax,%edi
+    109c:	e8 67 f7 ff ff       	call   808 <nfy_wait>
+    10a1:	85 c0                	test   %eax,%eax
+    10a3:	79 e0                	jns    1085 <ring_recv+0x1d>
+      return -1;
+    10a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10aa:	eb 73                	jmp    111f <ring_recv+0xb7>
+      break;
+    10ac:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+    10ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10b0:	83 e0 1f             	and    $0x1f,%eax
+    10b3:	89 c1                	mov    %eax,%ecx
+    10b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    10b9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    10bd:	89 c9                	mov    %ecx,%ecx
+    10bf:	48 83 c1 02          	add    $0x2,%rcx
+    10c3:	48 c1 e1 06          	shl    $0x6,%rcx
+    10c7:	48 01 ca             	add    %rcx,%rdx
+    10ca:	48 8b 0a             	mov    (%rdx),%rcx
+    10cd:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+    10d1:	48 89 08             	mov    %rcx,(%rax)
+    10d4:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    10d8:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    10dc:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    10e0:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    10e4:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    10e8:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    10ec:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    10f0:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    10f4:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    10f8:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    10fc:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    1100:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    1104:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    1108:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    110e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1111:	8d 50 01             	lea    0x1(%rax),%edx
+    1114:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1118:	89 10                	mov    %edx,(%rax)
+  return 0;
+    111a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    111f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1123:	c9                   	leave
+    1124:	c3                   	ret
+
+0000000000001125 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    1125:	55                   	push   %rbp
+    1126:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    1129:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    112e:	8b 00                	mov    (%rax),%eax
+}
+    1130:	5d                   	pop    %rbp
+    1131:	c3                   	ret
+
+0000000000001132 <getpid>:
+
+int
+getpid(void)
+{
+    1132:	55                   	push   %rbp
+    1133:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    1136:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    113b:	8b 00                	mov    (%rax),%eax
+}
+    113d:	5d                   	pop    %rbp
+    113e:	c3                   	ret
+
+000000000000113f <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    113f:	55                   	push   %rbp
+    1140:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    1143:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1148:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    114c:	5d                   	pop    %rbp
+    114d:	c3                   	ret
@@ -0,0 +1,975 @@
+
+fs/forktest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, char *s, ...)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 81 ec c0 00 00 00 	sub    $0xc0,%rsp
+   b:	89 bd 4c ff ff ff    	mov    %edi,-0xb4(%rbp)
+  11:	48 89 b5 40 ff ff ff 	mov    %rsi,-0xc0(%rbp)
+  18:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  1f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  26:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  2d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  34:	84 c0                	test   %al,%al
+  36:	74 20                	je     58 <printf+0x58>
+  38:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  3c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  40:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  44:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  48:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  4c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  50:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  54:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  write(fd, s, strlen(s));
+  58:	48 8b 85 40 ff ff ff 	mov    -0xc0(%rbp),%rax
+  5f:	48 89 c7             	mov    %rax,%rdi
+  62:	e8 db 01 00 00       	call   242 <strlen>
+  67:	89 c2                	mov    %eax,%edx
+  69:	48 8b 8d 40 ff ff ff 	mov    -0xc0(%rbp),%rcx
+  70:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+  76:	48 89 ce             	mov    %rcx,%rsi
+  79:	89 c7                	mov    %eax,%edi
+  7b:	e8 13 04 00 00       	call   493 <write>
+}
+  80:	90                   	nop
+  81:	c9                   	leave
+  82:	c3                   	ret
+
+0000000000000083 <forktest>:
+
+void
+forktest(void)
+{
+  83:	55                   	push   %rbp
+  84:	48 89 e5             	mov    %rsp,%rbp
+  87:	48 83 ec 10          	sub    $0x10,%rsp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  8b:	48 c7 c6 f8 07 00 00 	mov    $0x7f8,%rsi
+  92:	bf 01 00 00 00       	mov    $0x1,%edi
+  97:	b8 00 00 00 00       	mov    $0x0,%eax
+  9c:	e8 5f ff ff ff       	call   0 <printf>
+
+  for(n=0; n<N; n++){
+  a1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  a8:	eb 1d                	jmp    c7 <forktest+0x44>
+    pid = fork();
+  aa:	e8 b2 03 00 00       	call   461 <fork>
+  af:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(pid < 0)
+  b2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  b6:	78 1a                	js     d2 <forktest+0x4f>
+      break;
+    if(pid == 0)
+  b8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  bc:	75 05                	jne    c3 <forktest+0x40>
+      exit();
+  be:	e8 a8 03 00 00       	call   46b <exit>
+  for(n=0; n<N; n++){
+  c3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  c7:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+  ce:	7e da                	jle    aa <forktest+0x27>
+  d0:	eb 01                	jmp    d3 <forktest+0x50>
+      break;
+  d2:	90                   	nop
+  }
+  
+  if(n == N){
+  d3:	81 7d fc e8 03 00 00 	cmpl   $0x3e8,-0x4(%rbp)
+  da:	75 48                	jne    124 <forktest+0xa1>
+    printf(1, "fork claimed to work N times!\n", N);
+  dc:	ba e8 03 00 00       	mov    $0x3e8,%edx
+  e1:	48 c7 c6 08 08 00 00 	mov    $0x808,%rsi
+  e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  f2:	e8 09 ff ff ff       	call   0 <printf>
+    exit();
+  f7:	e8 6f 03 00 00       	call   46b <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+  fc:	e8 74 03 00 00       	call   475 <wait>
+ 101:	85 c0                	test   %eax,%eax
+ 103:	79 1b                	jns    120 <forktest+0x9d>
+      printf(1, "wait stopped early\n");
+ 105:	48 c7 c6 27 08 00 00 	mov    $0x827,%rsi
+ 10c:	bf 01 00 00 00       	mov    $0x1,%edi
+ 111:	b8 00 00 00 00       	mov    $0x0,%eax
+ 116:	e8 e5 fe ff ff       	call   0 <printf>
+      exit();
+ 11b:	e8 4b 03 00 00       	call   46b <exit>
+  for(; n > 0; n--){
+ 120:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 124:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 128:	7f d2                	jg     fc <forktest+0x79>
+    }
+  }
+  
+  if(wait() != -1){
+ 12a:	e8 46 03 00 00       	call   475 <wait>
+ 12f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 132:	74 1b                	je     14f <forktest+0xcc>
+    printf(1, "wait got too many\n");
+ 134:	48 c7 c6 3b 08 00 00 	mov    $0x83b,%rsi
+ 13b:	bf 01 00 00 00       	mov    $0x1,%edi
+ 140:	b8 00 00 00 00       	mov    $0x0,%eax
+ 145:	e8 b6 fe ff ff       	call   0 <printf>
+    exit();
+ 14a:	e8 1c 03 00 00       	call   46b <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+ 14f:	48 c7 c6 4e 08 00 00 	mov    $0x84e,%rsi
+ 156:	bf 01 00 00 00       	mov    $0x1,%edi
+ 15b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 160:	e8 9b fe ff ff       	call   0 <printf>
+}
+ 165:	90                   	nop
+ 166:	c9                   	leave
+ 167:	c3                   	ret
+
+0000000000000168 <main>:
+
+int
+main(void)
+{
+ 168:	55                   	push   %rbp
+ 169:	48 89 e5             	mov    %rsp,%rbp
+  forktest();
+ 16c:	e8 12 ff ff ff       	call   83 <forktest>
+  exit();
+ 171:	e8 f5 02 00 00       	call   46b <exit>
+
+0000000000000176 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 176:	55                   	push   %rbp
+ 177:	48 89 e5             	mov    %rsp,%rbp
+ 17a:	48 83 ec 10          	sub    $0x10,%rsp
+ 17e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 182:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 185:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+ 188:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 18c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 18f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 192:	48 89 ce             	mov    %rcx,%rsi
+ 195:	48 89 f7             	mov    %rsi,%rdi
+ 198:	89 d1                	mov    %edx,%ecx
+ 19a:	fc                   	cld
+ 19b:	f3 aa                	rep stos %al,%es:(%rdi)
+ 19d:	89 ca                	mov    %ecx,%edx
+ 19f:	48 89 fe             	mov    %rdi,%rsi
+ 1a2:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 1a6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 1a9:	90                   	nop
+ 1aa:	c9                   	leave
+ 1ab:	c3                   	ret
+
+00000000000001ac <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1ac:	55                   	push   %rbp
+ 1ad:	48 89 e5             	mov    %rsp,%rbp
+ 1b0:	48 83 ec 20          	sub    $0x20,%rsp
+ 1b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 1b8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+ 1bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 1c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+ 1c4:	90                   	nop
+ 1c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 1c9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 1cd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 1d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 1d5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 1d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 1dd:	0f b6 12             	movzbl (%rdx),%edx
+ 1e0:	88 10                	mov    %dl,(%rax)
+ 1e2:	0f b6 00             	movzbl (%rax),%eax
+ 1e5:	84 c0                	test   %al,%al
+ 1e7:	75 dc                	jne    1c5 <strcpy+0x19>
+    ;
+  return os;
+ 1e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 1ed:	c9                   	leave
+ 1ee:	c3                   	ret
+
+00000000000001ef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1ef:	55                   	push   %rbp
+ 1f0:	48 89 e5             	mov    %rsp,%rbp
+ 1f3:	48 83 ec 10          	sub    $0x10,%rsp
+ 1f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 1fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 1ff:	eb 0a                	jmp    20b <strcmp+0x1c>
+    p++, q++;
+ 201:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 206:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 20b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 20f:	0f b6 00             	movzbl (%rax),%eax
+ 212:	84 c0                	test   %al,%al
+ 214:	74 12                	je     228 <strcmp+0x39>
+ 216:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 21a:	0f b6 10             	movzbl (%rax),%edx
+ 21d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 221:	0f b6 00             	movzbl (%rax),%eax
+ 224:	38 c2                	cmp    %al,%dl
+ 226:	74 d9                	je     201 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+ 228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 22c:	0f b6 00             	movzbl (%rax),%eax
+ 22f:	0f b6 d0             	movzbl %al,%edx
+ 232:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 236:	0f b6 00             	movzbl (%rax),%eax
+ 239:	0f b6 c0             	movzbl %al,%eax
+ 23c:	29 c2                	sub    %eax,%edx
+ 23e:	89 d0                	mov    %edx,%eax
+}
+ 240:	c9                   	leave
+ 241:	c3                   	ret
+
+0000000000000242 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 242:	55                   	push   %rbp
+ 243:	48 89 e5             	mov    %rsp,%rbp
+ 246:	48 83 ec 18          	sub    $0x18,%rsp
+ 24a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 24e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 255:	eb 04                	jmp    25b <strlen+0x19>
+ 257:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 25b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 25e:	48 63 d0             	movslq %eax,%rdx
+ 261:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 265:	48 01 d0             	add    %rdx,%rax
+ 268:	0f b6 00             	movzbl (%rax),%eax
+ 26b:	84 c0                	test   %al,%al
+ 26d:	75 e8                	jne    257 <strlen+0x15>
+    ;
+  return n;
+ 26f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 272:	c9                   	leave
+ 273:	c3                   	ret
+
+0000000000000274 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 274:	55                   	push   %rbp
+ 275:	48 89 e5             	mov    %rsp,%rbp
+ 278:	48 83 ec 10          	sub    $0x10,%rsp
+ 27c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 280:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 283:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 286:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 289:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 28c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 290:	89 ce                	mov    %ecx,%esi
+ 292:	48 89 c7             	mov    %rax,%rdi
+ 295:	e8 dc fe ff ff       	call   176 <stosb>
+  return dst;
+ 29a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 29e:	c9                   	leave
+ 29f:	c3                   	ret
+
+00000000000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2a0:	55                   	push   %rbp
+ 2a1:	48 89 e5             	mov    %rsp,%rbp
+ 2a4:	48 83 ec 10          	sub    $0x10,%rsp
+ 2a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 2ac:	89 f0                	mov    %esi,%eax
+ 2ae:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 2b1:	eb 17                	jmp    2ca <strchr+0x2a>
+    if(*s == c)
+ 2b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2b7:	0f b6 00             	movzbl (%rax),%eax
+ 2ba:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 2bd:	75 06                	jne    2c5 <strchr+0x25>
+      return (char*)s;
+ 2bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2c3:	eb 15                	jmp    2da <strchr+0x3a>
+  for(; *s; s++)
+ 2c5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 2ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2ce:	0f b6 00             	movzbl (%rax),%eax
+ 2d1:	84 c0                	test   %al,%al
+ 2d3:	75 de                	jne    2b3 <strchr+0x13>
+  return 0;
+ 2d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2da:	c9                   	leave
+ 2db:	c3                   	ret
+
+00000000000002dc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2dc:	55                   	push   %rbp
+ 2dd:	48 89 e5             	mov    %rsp,%rbp
+ 2e0:	48 83 ec 20          	sub    $0x20,%rsp
+ 2e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 2e8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 2f2:	eb 48                	jmp    33c <gets+0x60>
+    cc = read(0, &c, 1);
+ 2f4:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 2f8:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2fd:	48 89 c6             	mov    %rax,%rsi
+ 300:	bf 00 00 00 00       	mov    $0x0,%edi
+ 305:	e8 7f 01 00 00       	call   489 <read>
+ 30a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 30d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 311:	7e 36                	jle    349 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 313:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 316:	8d 50 01             	lea    0x1(%rax),%edx
+ 319:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 31c:	48 63 d0             	movslq %eax,%rdx
+ 31f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 323:	48 01 c2             	add    %rax,%rdx
+ 326:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 32a:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 32c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 330:	3c 0a                	cmp    $0xa,%al
+ 332:	74 16                	je     34a <gets+0x6e>
+ 334:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 338:	3c 0d                	cmp    $0xd,%al
+ 33a:	74 0e                	je     34a <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 33c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 33f:	83 c0 01             	add    $0x1,%eax
+ 342:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 345:	7f ad                	jg     2f4 <gets+0x18>
+ 347:	eb 01                	jmp    34a <gets+0x6e>
+      break;
+ 349:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 34a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 34d:	48 63 d0             	movslq %eax,%rdx
+ 350:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 354:	48 01 d0             	add    %rdx,%rax
+ 357:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 35a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 35e:	c9                   	leave
+ 35f:	c3                   	ret
+
+0000000000000360 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 360:	55                   	push   %rbp
+ 361:	48 89 e5             	mov    %rsp,%rbp
+ 364:	48 83 ec 20          	sub    $0x20,%rsp
+ 368:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 36c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 370:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 374:	be 00 00 00 00       	mov    $0x0,%esi
+ 379:	48 89 c7             	mov    %rax,%rdi
+ 37c:	e8 3a 01 00 00       	call   4bb <open>
+ 381:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 384:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 388:	79 07                	jns    391 <stat+0x31>
+    return -1;
+ 38a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 38f:	eb 21                	jmp    3b2 <stat+0x52>
+  r = fstat(fd, st);
+ 391:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 395:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 398:	48 89 d6             	mov    %rdx,%rsi
+ 39b:	89 c7                	mov    %eax,%edi
+ 39d:	e8 37 01 00 00       	call   4d9 <fstat>
+ 3a2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 3a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 3a8:	89 c7                	mov    %eax,%edi
+ 3aa:	e8 ee 00 00 00       	call   49d <close>
+  return r;
+ 3af:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 3b2:	c9                   	leave
+ 3b3:	c3                   	ret
+
+00000000000003b4 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3b4:	55                   	push   %rbp
+ 3b5:	48 89 e5             	mov    %rsp,%rbp
+ 3b8:	48 83 ec 18          	sub    $0x18,%rsp
+ 3bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 3c0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 3c7:	eb 28                	jmp    3f1 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+ 3c9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 3cc:	89 d0                	mov    %edx,%eax
+ 3ce:	c1 e0 02             	shl    $0x2,%eax
+ 3d1:	01 d0                	add    %edx,%eax
+ 3d3:	01 c0                	add    %eax,%eax
+ 3d5:	89 c1                	mov    %eax,%ecx
+ 3d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 3db:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 3df:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 3e3:	0f b6 00             	movzbl (%rax),%eax
+ 3e6:	0f be c0             	movsbl %al,%eax
+ 3e9:	01 c8                	add    %ecx,%eax
+ 3eb:	83 e8 30             	sub    $0x30,%eax
+ 3ee:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 3f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 3f5:	0f b6 00             	movzbl (%rax),%eax
+ 3f8:	3c 2f                	cmp    $0x2f,%al
+ 3fa:	7e 0b                	jle    407 <atoi+0x53>
+ 3fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 400:	0f b6 00             	movzbl (%rax),%eax
+ 403:	3c 39                	cmp    $0x39,%al
+ 405:	7e c2                	jle    3c9 <atoi+0x15>
+  return n;
+ 407:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+
+000000000000040c <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 40c:	55                   	push   %rbp
+ 40d:	48 89 e5             	mov    %rsp,%rbp
+ 410:	48 83 ec 28          	sub    $0x28,%rsp
+ 414:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 418:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 41c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+ 41f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 423:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 427:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 42b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 42f:	eb 1d                	jmp    44e <memmove+0x42>
+    *dst++ = *src++;
+ 431:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 435:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 439:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 43d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 441:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 445:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 449:	0f b6 12             	movzbl (%rdx),%edx
+ 44c:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 44e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 451:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 454:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 457:	85 c0                	test   %eax,%eax
+ 459:	7f d6                	jg     431 <memmove+0x25>
+  return vdst;
+ 45b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 45f:	c9                   	leave
+ 460:	c3                   	ret
+
+0000000000000461 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+ 461:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+000000000000046b <exit>:
+SYSCALL_FAST(exit)
+ 46b:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+ 472:	0f 05                	syscall
+ 474:	c3                   	ret
+
+0000000000000475 <wait>:
+SYSCALL_FAST(wait)
+ 475:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+ 47c:	0f 05                	syscall
+ 47e:	c3                   	ret
+
+000000000000047f <pipe>:
+SYSCALL_FAST(pipe)
+ 47f:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+ 486:	0f 05                	syscall
+ 488:	c3                   	ret
+
+0000000000000489 <read>:
+SYSCALL_FAST(read)
+ 489:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+ 490:	0f 05                	syscall
+ 492:	c3                   	ret
+
+0000000000000493 <write>:
+SYSCALL_FAST(write)
+ 493:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+ 49a:	0f 05                	syscall
+ 49c:	c3                   	ret
+
+000000000000049d <close>:
+SYSCALL_FAST(close)
+ 49d:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+ 4a4:	0f 05                	syscall
+ 4a6:	c3                   	ret
+
+00000000000004a7 <kill>:
+SYSCALL_FAST(kill)
+ 4a7:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+ 4ae:	0f 05                	syscall
+ 4b0:	c3                   	ret
+
+00000000000004b1 <exec>:
+SYSCALL(exec)
+ 4b1:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+00000000000004bb <open>:
+SYSCALL_FAST(open)
+ 4bb:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+ 4c2:	0f 05                	syscall
+ 4c4:	c3                   	ret
+
+00000000000004c5 <mknod>:
+SYSCALL_FAST(mknod)
+ 4c5:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+ 4cc:	0f 05                	syscall
+ 4ce:	c3                   	ret
+
+00000000000004cf <unlink>:
+SYSCALL_FAST(unlink)
+ 4cf:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+ 4d6:	0f 05                	syscall
+ 4d8:	c3                   	ret
+
+00000000000004d9 <fstat>:
+SYSCALL_FAST(fstat)
+ 4d9:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+ 4e0:	0f 05                	syscall
+ 4e2:	c3                   	ret
+
+00000000000004e3 <link>:
+SYSCALL_FAST(link)
+ 4e3:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+ 4ea:	0f 05                	syscall
+ 4ec:	c3                   	ret
+
+00000000000004ed <mkdir>:
+SYSCALL_FAST(mkdir)
+ 4ed:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+ 4f4:	0f 05                	syscall
+ 4f6:	c3                   	ret
+
+00000000000004f7 <chdir>:
+SYSCALL_FAST(chdir)
+ 4f7:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+ 4fe:	0f 05                	syscall
+ 500:	c3                   	ret
+
+0000000000000501 <dup>:
+SYSCALL_FAST(dup)
+ 501:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+ 508:	0f 05                	syscall
+ 50a:	c3                   	ret
+
+000000000000050b <sbrk>:
+SYSCALL_FAST(sbrk)
+ 50b:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+ 512:	0f 05                	syscall
+ 514:	c3                   	ret
+
+0000000000000515 <sleep>:
+SYSCALL_FAST(sleep)
+ 515:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+ 51c:	0f 05                	syscall
+ 51e:	c3                   	ret
+
+000000000000051f <send>:
+SYSCALL_FAST(send)
+ 51f:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+ 526:	0f 05                	syscall
+ 528:	c3                   	ret
+
+0000000000000529 <send_recv>:
+SYSCALL_FAST(send_recv)
+ 529:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+ 530:	0f 05                	syscall
+ 532:	c3                   	ret
+
+0000000000000533 <recv>:
+SYSCALL_FAST(recv)
+ 533:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+ 53a:	0f 05                	syscall
+ 53c:	c3                   	ret
+
+000000000000053d <call>:
+SYSCALL_FAST(call)
+ 53d:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+ 544:	0f 05                	syscall
+ 546:	c3                   	ret
+
+0000000000000547 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+ 547:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+ 54e:	0f 05                	syscall
+ 550:	c3                   	ret
+
+0000000000000551 <send_reg>:
+SYSCALL_REG(send_reg)
+ 551:	41 54                	push   %r12
+ 553:	41 55                	push   %r13
+ 555:	41 56                	push   %r14
+ 557:	41 57                	push   %r15
+ 559:	56                   	push   %rsi
+ 55a:	49 89 f3             	mov    %rsi,%r11
+ 55d:	48 89 d6             	mov    %rdx,%rsi
+ 560:	49 8b 13             	mov    (%r11),%rdx
+ 563:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 567:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 56b:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 56f:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 573:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 577:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 57b:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 57f:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+ 586:	0f 05                	syscall
+ 588:	41 5b                	pop    %r11
+ 58a:	49 89 13             	mov    %rdx,(%r11)
+ 58d:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 591:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 595:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 599:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 59d:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 5a1:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 5a5:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 5a9:	41 5f                	pop    %r15
+ 5ab:	41 5e                	pop    %r14
+ 5ad:	41 5d                	pop    %r13
+ 5af:	41 5c                	pop    %r12
+ 5b1:	c3                   	ret
+
+00000000000005b2 <recv_reg>:
+SYSCALL_REG(recv_reg)
+ 5b2:	41 54                	push   %r12
+ 5b4:	41 55                	push   %r13
+ 5b6:	41 56                	push   %r14
+ 5b8:	41 57                	push   %r15
+ 5ba:	56                   	push   %rsi
+ 5bb:	49 89 f3             	mov    %rsi,%r11
+ 5be:	48 89 d6             	mov    %rdx,%rsi
+ 5c1:	49 8b 13             	mov    (%r11),%rdx
+ 5c4:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 5c8:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 5cc:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 5d0:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 5d4:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 5d8:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 5dc:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 5e0:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+ 5e7:	0f 05                	syscall
+ 5e9:	41 5b                	pop    %r11
+ 5eb:	49 89 13             	mov    %rdx,(%r11)
+ 5ee:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 5f2:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 5f6:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 5fa:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 5fe:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 602:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 606:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 60a:	41 5f                	pop    %r15
+ 60c:	41 5e                	pop    %r14
+ 60e:	41 5d                	pop    %r13
+ 610:	41 5c                	pop    %r12
+ 612:	c3                   	ret
+
+0000000000000613 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+ 613:	41 54                	push   %r12
+ 615:	41 55                	push   %r13
+ 617:	41 56                	push   %r14
+ 619:	41 57                	push   %r15
+ 61b:	56                   	push   %rsi
+ 61c:	49 89 f3             	mov    %rsi,%r11
+ 61f:	48 89 d6             	mov    %rdx,%rsi
+ 622:	49 8b 13             	mov    (%r11),%rdx
+ 625:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 629:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 62d:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 631:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 635:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 639:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 63d:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 641:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+ 648:	0f 05                	syscall
+ 64a:	41 5b                	pop    %r11
+ 64c:	49 89 13             	mov    %rdx,(%r11)
+ 64f:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 653:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 657:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 65b:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 65f:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 663:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 667:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 66b:	41 5f                	pop    %r15
+ 66d:	41 5e                	pop    %r14
+ 66f:	41 5d                	pop    %r13
+ 671:	41 5c                	pop    %r12
+ 673:	c3                   	ret
+
+0000000000000674 <call_reg>:
+SYSCALL_REG(call_reg)
+ 674:	41 54                	push   %r12
+ 676:	41 55                	push   %r13
+ 678:	41 56                	push   %r14
+ 67a:	41 57                	push   %r15
+ 67c:	56                   	push   %rsi
+ 67d:	49 89 f3             	mov    %rsi,%r11
+ 680:	48 89 d6             	mov    %rdx,%rsi
+ 683:	49 8b 13             	mov    (%r11),%rdx
+ 686:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 68a:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 68e:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 692:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 696:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 69a:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 69e:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 6a2:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+ 6a9:	0f 05                	syscall
+ 6ab:	41 5b                	pop    %r11
+ 6ad:	49 89 13             	mov    %rdx,(%r11)
+ 6b0:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 6b4:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 6b8:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 6bc:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 6c0:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 6c4:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 6c8:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 6cc:	41 5f                	pop    %r15
+ 6ce:	41 5e                	pop    %r14
+ 6d0:	41 5d                	pop    %r13
+ 6d2:	41 5c                	pop    %r12
+ 6d4:	c3                   	ret
+
+00000000000006d5 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+ 6d5:	41 54                	push   %r12
+ 6d7:	41 55                	push   %r13
+ 6d9:	41 56                	push   %r14
+ 6db:	41 57                	push   %r15
+ 6dd:	56                   	push   %rsi
+ 6de:	49 89 f3             	mov    %rsi,%r11
+ 6e1:	48 89 d6             	mov    %rdx,%rsi
+ 6e4:	49 8b 13             	mov    (%r11),%rdx
+ 6e7:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 6eb:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 6ef:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 6f3:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 6f7:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 6fb:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 6ff:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 703:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+ 70a:	0f 05                	syscall
+ 70c:	41 5b                	pop    %r11
+ 70e:	49 89 13             	mov    %rdx,(%r11)
+ 711:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 715:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 719:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 71d:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 721:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 725:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 729:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 72d:	41 5f                	pop    %r15
+ 72f:	41 5e                	pop    %r14
+ 731:	41 5d                	pop    %r13
+ 733:	41 5c                	pop    %r12
+ 735:	c3                   	ret
+
+0000000000000736 <sendx>:
+SYSCALL_FAST(sendx)
+ 736:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+ 73d:	0f 05                	syscall
+ 73f:	c3                   	ret
+
+0000000000000740 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+ 740:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+ 747:	0f 05                	syscall
+ 749:	c3                   	ret
+
+000000000000074a <notify>:
+SYSCALL_FAST(notify)
+ 74a:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+ 751:	0f 05                	syscall
+ 753:	c3                   	ret
+
+0000000000000754 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+ 754:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+ 75b:	0f 05                	syscall
+ 75d:	c3                   	ret
+
+000000000000075e <send_timed>:
+SYSCALL_FAST(send_timed)
+ 75e:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+ 765:	0f 05                	syscall
+ 767:	c3                   	ret
+
+0000000000000768 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+ 768:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+ 76f:	0f 05                	syscall
+ 771:	c3                   	ret
+
+0000000000000772 <set_add>:
+SYSCALL_FAST(set_add)
+ 772:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+ 779:	0f 05                	syscall
+ 77b:	c3                   	ret
+
+000000000000077c <set_del>:
+SYSCALL_FAST(set_del)
+ 77c:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+ 783:	0f 05                	syscall
+ 785:	c3                   	ret
+
+0000000000000786 <recv_any>:
+SYSCALL_FAST(recv_any)
+ 786:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+ 78d:	0f 05                	syscall
+ 78f:	c3                   	ret
+
+0000000000000790 <ep_create>:
+SYSCALL_FAST(ep_create)
+ 790:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+ 797:	0f 05                	syscall
+ 799:	c3                   	ret
+
+000000000000079a <ep_close>:
+SYSCALL_FAST(ep_close)
+ 79a:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+ 7a1:	0f 05                	syscall
+ 7a3:	c3                   	ret
+
+00000000000007a4 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+ 7a4:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+ 7ab:	0f 05                	syscall
+ 7ad:	c3                   	ret
+
+00000000000007ae <setprio>:
+SYSCALL_FAST(setprio)
+ 7ae:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+ 7b5:	0f 05                	syscall
+ 7b7:	c3                   	ret
+
+00000000000007b8 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+ 7b8:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+ 7bf:	0f 05                	syscall
+ 7c1:	c3                   	ret
+
+00000000000007c2 <sethuge>:
+SYSCALL_FAST(sethuge)
+ 7c2:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+ 7c9:	0f 05                	syscall
+ 7cb:	c3                   	ret
+
+00000000000007cc <cr3_test>:
+SYSCALL_FAST(cr3_test)
+ 7cc:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+ 7d3:	0f 05                	syscall
+ 7d5:	c3                   	ret
+
+00000000000007d6 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+ 7d6:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+ 7dd:	0f 05                	syscall
+ 7df:	c3                   	ret
+
+00000000000007e0 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+ 7e0:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+ 7e7:	0f 05                	syscall
+ 7e9:	c3                   	ret
+
+00000000000007ea <null_call>:
+ 7ea:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+ 7f1:	0f 05                	syscall
+ 7f3:	c3                   	ret
@@ -0,0 +1,2046 @@
+
+fs/grep:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <grep>:
+char buf[1024];
+int match(char*, char*);
+
+void
+grep(char *pattern, int fd)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 30          	sub    $0x30,%rsp
+       8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+       c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  int n, m;
+  char *p, *q;
+  
+  m = 0;
+       f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while((n = read(fd, buf+m, sizeof(buf)-m)) > 0){
+      16:	e9 bc 00 00 00       	jmp    d7 <grep+0xd7>
+    m += n;
+      1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      1e:	01 45 fc             	add    %eax,-0x4(%rbp)
+    p = buf;
+      21:	48 c7 45 f0 80 16 00 	movq   $0x1680,-0x10(%rbp)
+      28:	00 
+    while((q = strchr(p, '\n')) != 0){
+      29:	eb 50                	jmp    7b <grep+0x7b>
+      *q = 0;
+      2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      2f:	c6 00 00             	movb   $0x0,(%rax)
+      if(match(pattern, p)){
+      32:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+      36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      3a:	48 89 d6             	mov    %rdx,%rsi
+      3d:	48 89 c7             	mov    %rax,%rdi
+      40:	e8 bc 01 00 00       	call   201 <match>
+      45:	85 c0                	test   %eax,%eax
+      47:	74 26                	je     6f <grep+0x6f>
+        *q = '\n';
+      49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      4d:	c6 00 0a             	movb   $0xa,(%rax)
+        write(1, p, q+1 - p);
+      50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      54:	48 83 c0 01          	add    $0x1,%rax
+      58:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+      5c:	89 c2                	mov    %eax,%edx
+      5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      62:	48 89 c6             	mov    %rax,%rsi
+      65:	bf 01 00 00 00       	mov    $0x1,%edi
+      6a:	e8 48 06 00 00       	call   6b7 <write>
+      }
+      p = q+1;
+      6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      73:	48 83 c0 01          	add    $0x1,%rax
+      77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    while((q = strchr(p, '\n')) != 0){
+      7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      7f:	be 0a 00 00 00       	mov    $0xa,%esi
+      84:	48 89 c7             	mov    %rax,%rdi
+      87:	e8 38 04 00 00       	call   4c4 <strchr>
+      8c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      90:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+      95:	75 94                	jne    2b <grep+0x2b>
+    }
+    if(p == buf)
+      97:	48 81 7d f0 80 16 00 	cmpq   $0x1680,-0x10(%rbp)
+      9e:	00 
+      9f:	75 07                	jne    a8 <grep+0xa8>
+      m = 0;
+      a1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    if(m > 0){
+      a8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      ac:	7e 29                	jle    d7 <grep+0xd7>
+      m -= p - buf;
+      ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+      b5:	48 81 ea 80 16 00 00 	sub    $0x1680,%rdx
+      bc:	29 d0                	sub    %edx,%eax
+      be:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      memmove(buf, p, m);
+      c1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      c8:	48 89 c6             	mov    %rax,%rsi
+      cb:	48 c7 c7 80 16 00 00 	mov    $0x1680,%rdi
+      d2:	e8 59 05 00 00       	call   630 <memmove>
+  while((n = read(fd, buf+m, sizeof(buf)-m)) > 0){
+      d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      da:	ba 00 04 00 00       	mov    $0x400,%edx
+      df:	29 c2                	sub    %eax,%edx
+      e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      e4:	48 98                	cltq
+      e6:	48 8d 88 80 16 00 00 	lea    0x1680(%rax),%rcx
+      ed:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+      f0:	48 89 ce             	mov    %rcx,%rsi
+      f3:	89 c7                	mov    %eax,%edi
+      f5:	e8 b3 05 00 00       	call   6ad <read>
+      fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+      fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     101:	0f 8f 14 ff ff ff    	jg     1b <grep+0x1b>
+    }
+  }
+}
+     107:	90                   	nop
+     108:	90                   	nop
+     109:	c9                   	leave
+     10a:	c3                   	ret
+
+000000000000010b <main>:
+
+int
+main(int argc, char *argv[])
+{
+     10b:	55                   	push   %rbp
+     10c:	48 89 e5             	mov    %rsp,%rbp
+     10f:	48 83 ec 30          	sub    $0x30,%rsp
+     113:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     116:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int fd, i;
+  char *pattern;
+  
+  if(argc <= 1){
+     11a:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+     11e:	7f 1b                	jg     13b <main+0x30>
+    printf(2, "usage: grep pattern [file ...]\n");
+     120:	48 c7 c6 c0 12 00 00 	mov    $0x12c0,%rsi
+     127:	bf 02 00 00 00       	mov    $0x2,%edi
+     12c:	b8 00 00 00 00       	mov    $0x0,%eax
+     131:	e8 cc 09 00 00       	call   b02 <printf>
+    exit();
+     136:	e8 54 05 00 00       	call   68f <exit>
+  }
+  pattern = argv[1];
+     13b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     13f:	48 8b 40 08          	mov    0x8(%rax),%rax
+     143:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  
+  if(argc <= 2){
+     147:	83 7d dc 02          	cmpl   $0x2,-0x24(%rbp)
+     14b:	7f 16                	jg     163 <main+0x58>
+    grep(pattern, 0);
+     14d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     151:	be 00 00 00 00       	mov    $0x0,%esi
+     156:	48 89 c7             	mov    %rax,%rdi
+     159:	e8 a2 fe ff ff       	call   0 <grep>
+    exit();
+     15e:	e8 2c 05 00 00       	call   68f <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+     163:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+     16a:	e9 81 00 00 00       	jmp    1f0 <main+0xe5>
+    if((fd = open(argv[i], 0)) < 0){
+     16f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     172:	48 98                	cltq
+     174:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     17b:	00 
+     17c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     180:	48 01 d0             	add    %rdx,%rax
+     183:	48 8b 00             	mov    (%rax),%rax
+     186:	be 00 00 00 00       	mov    $0x0,%esi
+     18b:	48 89 c7             	mov    %rax,%rdi
+     18e:	e8 4c 05 00 00       	call   6df <open>
+     193:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     196:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     19a:	79 35                	jns    1d1 <main+0xc6>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+     19c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     19f:	48 98                	cltq
+     1a1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     1a8:	00 
+     1a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     1ad:	48 01 d0             	add    %rdx,%rax
+     1b0:	48 8b 00             	mov    (%rax),%rax
+     1b3:	48 89 c2             	mov    %rax,%rdx
+     1b6:	48 c7 c6 e0 12 00 00 	mov    $0x12e0,%rsi
+     1bd:	bf 01 00 00 00       	mov    $0x1,%edi
+     1c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c7:	e8 36 09 00 00       	call   b02 <printf>
+      exit();
+     1cc:	e8 be 04 00 00       	call   68f <exit>
+    }
+    grep(pattern, fd);
+     1d1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     1d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1d8:	89 d6                	mov    %edx,%esi
+     1da:	48 89 c7             	mov    %rax,%rdi
+     1dd:	e8 1e fe ff ff       	call   0 <grep>
+    close(fd);
+     1e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1e5:	89 c7                	mov    %eax,%edi
+     1e7:	e8 d5 04 00 00       	call   6c1 <close>
+  for(i = 2; i < argc; i++){
+     1ec:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1f3:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+     1f6:	0f 8c 73 ff ff ff    	jl     16f <main+0x64>
+  }
+  exit();
+     1fc:	e8 8e 04 00 00       	call   68f <exit>
+
+0000000000000201 <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+     201:	55                   	push   %rbp
+     202:	48 89 e5             	mov    %rsp,%rbp
+     205:	48 83 ec 10          	sub    $0x10,%rsp
+     209:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     20d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(re[0] == '^')
+     211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     215:	0f b6 00             	movzbl (%rax),%eax
+     218:	3c 5e                	cmp    $0x5e,%al
+     21a:	75 19                	jne    235 <match+0x34>
+    return matchhere(re+1, text);
+     21c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     220:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     224:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     228:	48 89 c6             	mov    %rax,%rsi
+     22b:	48 89 d7             	mov    %rdx,%rdi
+     22e:	e8 3a 00 00 00       	call   26d <matchhere>
+     233:	eb 36                	jmp    26b <match+0x6a>
+  do{  // must look at empty string
+    if(matchhere(re, text))
+     235:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     239:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     23d:	48 89 d6             	mov    %rdx,%rsi
+     240:	48 89 c7             	mov    %rax,%rdi
+     243:	e8 25 00 00 00       	call   26d <matchhere>
+     248:	85 c0                	test   %eax,%eax
+     24a:	74 07                	je     253 <match+0x52>
+      return 1;
+     24c:	b8 01 00 00 00       	mov    $0x1,%eax
+     251:	eb 18                	jmp    26b <match+0x6a>
+  }while(*text++ != '\0');
+     253:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     257:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     25b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     25f:	0f b6 00             	movzbl (%rax),%eax
+     262:	84 c0                	test   %al,%al
+     264:	75 cf                	jne    235 <match+0x34>
+  return 0;
+     266:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     26b:	c9                   	leave
+     26c:	c3                   	ret
+
+000000000000026d <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+     26d:	55                   	push   %rbp
+     26e:	48 89 e5             	mov    %rsp,%rbp
+     271:	48 83 ec 10          	sub    $0x10,%rsp
+     275:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     279:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(re[0] == '\0')
+     27d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     281:	0f b6 00             	movzbl (%rax),%eax
+     284:	84 c0                	test   %al,%al
+     286:	75 0a                	jne    292 <matchhere+0x25>
+    return 1;
+     288:	b8 01 00 00 00       	mov    $0x1,%eax
+     28d:	e9 a6 00 00 00       	jmp    338 <matchhere+0xcb>
+  if(re[1] == '*')
+     292:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     296:	48 83 c0 01          	add    $0x1,%rax
+     29a:	0f b6 00             	movzbl (%rax),%eax
+     29d:	3c 2a                	cmp    $0x2a,%al
+     29f:	75 22                	jne    2c3 <matchhere+0x56>
+    return matchstar(re[0], re+2, text);
+     2a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2a5:	48 8d 48 02          	lea    0x2(%rax),%rcx
+     2a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2ad:	0f b6 00             	movzbl (%rax),%eax
+     2b0:	0f be c0             	movsbl %al,%eax
+     2b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     2b7:	48 89 ce             	mov    %rcx,%rsi
+     2ba:	89 c7                	mov    %eax,%edi
+     2bc:	e8 79 00 00 00       	call   33a <matchstar>
+     2c1:	eb 75                	jmp    338 <matchhere+0xcb>
+  if(re[0] == '$' && re[1] == '\0')
+     2c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2c7:	0f b6 00             	movzbl (%rax),%eax
+     2ca:	3c 24                	cmp    $0x24,%al
+     2cc:	75 20                	jne    2ee <matchhere+0x81>
+     2ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2d2:	48 83 c0 01          	add    $0x1,%rax
+     2d6:	0f b6 00             	movzbl (%rax),%eax
+     2d9:	84 c0                	test   %al,%al
+     2db:	75 11                	jne    2ee <matchhere+0x81>
+    return *text == '\0';
+     2dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2e1:	0f b6 00             	movzbl (%rax),%eax
+     2e4:	84 c0                	test   %al,%al
+     2e6:	0f 94 c0             	sete   %al
+     2e9:	0f b6 c0             	movzbl %al,%eax
+     2ec:	eb 4a                	jmp    338 <matchhere+0xcb>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     2ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2f2:	0f b6 00             	movzbl (%rax),%eax
+     2f5:	84 c0                	test   %al,%al
+     2f7:	74 3a                	je     333 <matchhere+0xc6>
+     2f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2fd:	0f b6 00             	movzbl (%rax),%eax
+     300:	3c 2e                	cmp    $0x2e,%al
+     302:	74 12                	je     316 <matchhere+0xa9>
+     304:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     308:	0f b6 10             	movzbl (%rax),%edx
+     30b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     30f:	0f b6 00             	movzbl (%rax),%eax
+     312:	38 c2                	cmp    %al,%dl
+     314:	75 1d                	jne    333 <matchhere+0xc6>
+    return matchhere(re+1, text+1);
+     316:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     31a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     31e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     322:	48 83 c0 01          	add    $0x1,%rax
+     326:	48 89 d6             	mov    %rdx,%rsi
+     329:	48 89 c7             	mov    %rax,%rdi
+     32c:	e8 3c ff ff ff       	call   26d <matchhere>
+     331:	eb 05                	jmp    338 <matchhere+0xcb>
+  return 0;
+     333:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     338:	c9                   	leave
+     339:	c3                   	ret
+
+000000000000033a <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+     33a:	55                   	push   %rbp
+     33b:	48 89 e5             	mov    %rsp,%rbp
+     33e:	48 83 ec 20          	sub    $0x20,%rsp
+     342:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     345:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     349:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     34d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     351:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     355:	48 89 d6             	mov    %rdx,%rsi
+     358:	48 89 c7             	mov    %rax,%rdi
+     35b:	e8 0d ff ff ff       	call   26d <matchhere>
+     360:	85 c0                	test   %eax,%eax
+     362:	74 07                	je     36b <matchstar+0x31>
+      return 1;
+     364:	b8 01 00 00 00       	mov    $0x1,%eax
+     369:	eb 2d                	jmp    398 <matchstar+0x5e>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     36b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     36f:	0f b6 00             	movzbl (%rax),%eax
+     372:	84 c0                	test   %al,%al
+     374:	74 1d                	je     393 <matchstar+0x59>
+     376:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     37a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     37e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     382:	0f b6 00             	movzbl (%rax),%eax
+     385:	0f be c0             	movsbl %al,%eax
+     388:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     38b:	74 c0                	je     34d <matchstar+0x13>
+     38d:	83 7d fc 2e          	cmpl   $0x2e,-0x4(%rbp)
+     391:	74 ba                	je     34d <matchstar+0x13>
+  return 0;
+     393:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     398:	c9                   	leave
+     399:	c3                   	ret
+
+000000000000039a <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     39a:	55                   	push   %rbp
+     39b:	48 89 e5             	mov    %rsp,%rbp
+     39e:	48 83 ec 10          	sub    $0x10,%rsp
+     3a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     3a6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     3a9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     3ac:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     3b0:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     3b3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     3b6:	48 89 ce             	mov    %rcx,%rsi
+     3b9:	48 89 f7             	mov    %rsi,%rdi
+     3bc:	89 d1                	mov    %edx,%ecx
+     3be:	fc                   	cld
+     3bf:	f3 aa                	rep stos %al,%es:(%rdi)
+     3c1:	89 ca                	mov    %ecx,%edx
+     3c3:	48 89 fe             	mov    %rdi,%rsi
+     3c6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     3ca:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     3cd:	90                   	nop
+     3ce:	c9                   	leave
+     3cf:	c3                   	ret
+
+00000000000003d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     3d0:	55                   	push   %rbp
+     3d1:	48 89 e5             	mov    %rsp,%rbp
+     3d4:	48 83 ec 20          	sub    $0x20,%rsp
+     3d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     3dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     3e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     3e8:	90                   	nop
+     3e9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     3ed:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     3f1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     3f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3f9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     3fd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     401:	0f b6 12             	movzbl (%rdx),%edx
+     404:	88 10                	mov    %dl,(%rax)
+     406:	0f b6 00             	movzbl (%rax),%eax
+     409:	84 c0                	test   %al,%al
+     40b:	75 dc                	jne    3e9 <strcpy+0x19>
+    ;
+  return os;
+     40d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     411:	c9                   	leave
+     412:	c3                   	ret
+
+0000000000000413 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     413:	55                   	push   %rbp
+     414:	48 89 e5             	mov    %rsp,%rbp
+     417:	48 83 ec 10          	sub    $0x10,%rsp
+     41b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     41f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     423:	eb 0a                	jmp    42f <strcmp+0x1c>
+    p++, q++;
+     425:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     42a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     42f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     433:	0f b6 00             	movzbl (%rax),%eax
+     436:	84 c0                	test   %al,%al
+     438:	74 12                	je     44c <strcmp+0x39>
+     43a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     43e:	0f b6 10             	movzbl (%rax),%edx
+     441:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     445:	0f b6 00             	movzbl (%rax),%eax
+     448:	38 c2                	cmp    %al,%dl
+     44a:	74 d9                	je     425 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     44c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     450:	0f b6 00             	movzbl (%rax),%eax
+     453:	0f b6 d0             	movzbl %al,%edx
+     456:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     45a:	0f b6 00             	movzbl (%rax),%eax
+     45d:	0f b6 c0             	movzbl %al,%eax
+     460:	29 c2                	sub    %eax,%edx
+     462:	89 d0                	mov    %edx,%eax
+}
+     464:	c9                   	leave
+     465:	c3                   	ret
+
+0000000000000466 <strlen>:
+
+uint
+strlen(char *s)
+{
+     466:	55                   	push   %rbp
+     467:	48 89 e5             	mov    %rsp,%rbp
+     46a:	48 83 ec 18          	sub    $0x18,%rsp
+     46e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     472:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     479:	eb 04                	jmp    47f <strlen+0x19>
+     47b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     47f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     482:	48 63 d0             	movslq %eax,%rdx
+     485:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     489:	48 01 d0             	add    %rdx,%rax
+     48c:	0f b6 00             	movzbl (%rax),%eax
+     48f:	84 c0                	test   %al,%al
+     491:	75 e8                	jne    47b <strlen+0x15>
+    ;
+  return n;
+     493:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     496:	c9                   	leave
+     497:	c3                   	ret
+
+0000000000000498 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     498:	55                   	push   %rbp
+     499:	48 89 e5             	mov    %rsp,%rbp
+     49c:	48 83 ec 10          	sub    $0x10,%rsp
+     4a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     4a4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     4a7:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     4aa:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     4ad:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     4b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4b4:	89 ce                	mov    %ecx,%esi
+     4b6:	48 89 c7             	mov    %rax,%rdi
+     4b9:	e8 dc fe ff ff       	call   39a <stosb>
+  return dst;
+     4be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     4c2:	c9                   	leave
+     4c3:	c3                   	ret
+
+00000000000004c4 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4c4:	55                   	push   %rbp
+     4c5:	48 89 e5             	mov    %rsp,%rbp
+     4c8:	48 83 ec 10          	sub    $0x10,%rsp
+     4cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     4d0:	89 f0                	mov    %esi,%eax
+     4d2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     4d5:	eb 17                	jmp    4ee <strchr+0x2a>
+    if(*s == c)
+     4d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4db:	0f b6 00             	movzbl (%rax),%eax
+     4de:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     4e1:	75 06                	jne    4e9 <strchr+0x25>
+      return (char*)s;
+     4e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4e7:	eb 15                	jmp    4fe <strchr+0x3a>
+  for(; *s; s++)
+     4e9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     4ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4f2:	0f b6 00             	movzbl (%rax),%eax
+     4f5:	84 c0                	test   %al,%al
+     4f7:	75 de                	jne    4d7 <strchr+0x13>
+  return 0;
+     4f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     4fe:	c9                   	leave
+     4ff:	c3                   	ret
+
+0000000000000500 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     500:	55                   	push   %rbp
+     501:	48 89 e5             	mov    %rsp,%rbp
+     504:	48 83 ec 20          	sub    $0x20,%rsp
+     508:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     50c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     50f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     516:	eb 48                	jmp    560 <gets+0x60>
+    cc = read(0, &c, 1);
+     518:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     51c:	ba 01 00 00 00       	mov    $0x1,%edx
+     521:	48 89 c6             	mov    %rax,%rsi
+     524:	bf 00 00 00 00       	mov    $0x0,%edi
+     529:	e8 7f 01 00 00       	call   6ad <read>
+     52e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     531:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     535:	7e 36                	jle    56d <gets+0x6d>
+      break;
+    buf[i++] = c;
+     537:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     53a:	8d 50 01             	lea    0x1(%rax),%edx
+     53d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     540:	48 63 d0             	movslq %eax,%rdx
+     543:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     547:	48 01 c2             	add    %rax,%rdx
+     54a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     54e:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     550:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     554:	3c 0a                	cmp    $0xa,%al
+     556:	74 16                	je     56e <gets+0x6e>
+     558:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     55c:	3c 0d                	cmp    $0xd,%al
+     55e:	74 0e                	je     56e <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     560:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     563:	83 c0 01             	add    $0x1,%eax
+     566:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     569:	7f ad                	jg     518 <gets+0x18>
+     56b:	eb 01                	jmp    56e <gets+0x6e>
+      break;
+     56d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     56e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     571:	48 63 d0             	movslq %eax,%rdx
+     574:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     578:	48 01 d0             	add    %rdx,%rax
+     57b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     57e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     582:	c9                   	leave
+     583:	c3                   	ret
+
+0000000000000584 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     584:	55                   	push   %rbp
+     585:	48 89 e5             	mov    %rsp,%rbp
+     588:	48 83 ec 20          	sub    $0x20,%rsp
+     58c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     590:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     594:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     598:	be 00 00 00 00       	mov    $0x0,%esi
+     59d:	48 89 c7             	mov    %rax,%rdi
+     5a0:	e8 3a 01 00 00       	call   6df <open>
+     5a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     5a8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     5ac:	79 07                	jns    5b5 <stat+0x31>
+    return -1;
+     5ae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5b3:	eb 21                	jmp    5d6 <stat+0x52>
+  r = fstat(fd, st);
+     5b5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     5b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5bc:	48 89 d6             	mov    %rdx,%rsi
+     5bf:	89 c7                	mov    %eax,%edi
+     5c1:	e8 37 01 00 00       	call   6fd <fstat>
+     5c6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     5c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5cc:	89 c7                	mov    %eax,%edi
+     5ce:	e8 ee 00 00 00       	call   6c1 <close>
+  return r;
+     5d3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     5d6:	c9                   	leave
+     5d7:	c3                   	ret
+
+00000000000005d8 <atoi>:
+
+int
+atoi(const char *s)
+{
+     5d8:	55                   	push   %rbp
+     5d9:	48 89 e5             	mov    %rsp,%rbp
+     5dc:	48 83 ec 18          	sub    $0x18,%rsp
+     5e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     5e4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     5eb:	eb 28                	jmp    615 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     5ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     5f0:	89 d0                	mov    %edx,%eax
+     5f2:	c1 e0 02             	shl    $0x2,%eax
+     5f5:	01 d0                	add    %edx,%eax
+     5f7:	01 c0                	add    %eax,%eax
+     5f9:	89 c1                	mov    %eax,%ecx
+     5fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     5ff:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     603:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     607:	0f b6 00             	movzbl (%rax),%eax
+     60a:	0f be c0             	movsbl %al,%eax
+     60d:	01 c8                	add    %ecx,%eax
+     60f:	83 e8 30             	sub    $0x30,%eax
+     612:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     615:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     619:	0f b6 00             	movzbl (%rax),%eax
+     61c:	3c 2f                	cmp    $0x2f,%al
+     61e:	7e 0b                	jle    62b <atoi+0x53>
+     620:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     624:	0f b6 00             	movzbl (%rax),%eax
+     627:	3c 39                	cmp    $0x39,%al
+     629:	7e c2                	jle    5ed <atoi+0x15>
+  return n;
+     62b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     62e:	c9                   	leave
+     62f:	c3                   	ret
+
+0000000000000630 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     630:	55                   	push   %rbp
+     631:	48 89 e5             	mov    %rsp,%rbp
+     634:	48 83 ec 28          	sub    $0x28,%rsp
+     638:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     63c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     640:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     647:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     64b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     64f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     653:	eb 1d                	jmp    672 <memmove+0x42>
+    *dst++ = *src++;
+     655:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     659:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     65d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     665:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     669:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     66d:	0f b6 12             	movzbl (%rdx),%edx
+     670:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     672:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     675:	8d 50 ff             	lea    -0x1(%rax),%edx
+     678:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     67b:	85 c0                	test   %eax,%eax
+     67d:	7f d6                	jg     655 <memmove+0x25>
+  return vdst;
+     67f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     683:	c9                   	leave
+     684:	c3                   	ret
+
+0000000000000685 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     685:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     68c:	cd 40                	int    $0x40
+     68e:	c3                   	ret
+
+000000000000068f <exit>:
+SYSCALL_FAST(exit)
+     68f:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     696:	0f 05                	syscall
+     698:	c3                   	ret
+
+0000000000000699 <wait>:
+SYSCALL_FAST(wait)
+     699:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     6a0:	0f 05                	syscall
+     6a2:	c3                   	ret
+
+00000000000006a3 <pipe>:
+SYSCALL_FAST(pipe)
+     6a3:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     6aa:	0f 05                	syscall
+     6ac:	c3                   	ret
+
+00000000000006ad <read>:
+SYSCALL_FAST(read)
+     6ad:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     6b4:	0f 05                	syscall
+     6b6:	c3                   	ret
+
+00000000000006b7 <write>:
+SYSCALL_FAST(write)
+     6b7:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     6be:	0f 05                	syscall
+     6c0:	c3                   	ret
+
+00000000000006c1 <close>:
+SYSCALL_FAST(close)
+     6c1:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     6c8:	0f 05                	syscall
+     6ca:	c3                   	ret
+
+00000000000006cb <kill>:
+SYSCALL_FAST(kill)
+     6cb:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     6d2:	0f 05                	syscall
+     6d4:	c3                   	ret
+
+00000000000006d5 <exec>:
+SYSCALL(exec)
+     6d5:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     6dc:	cd 40                	int    $0x40
+     6de:	c3                   	ret
+
+00000000000006df <open>:
+SYSCALL_FAST(open)
+     6df:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     6e6:	0f 05                	syscall
+     6e8:	c3                   	ret
+
+00000000000006e9 <mknod>:
+SYSCALL_FAST(mknod)
+     6e9:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     6f0:	0f 05                	syscall
+     6f2:	c3                   	ret
+
+00000000000006f3 <unlink>:
+SYSCALL_FAST(unlink)
+     6f3:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     6fa:	0f 05                	syscall
+     6fc:	c3                   	ret
+
+00000000000006fd <fstat>:
+SYSCALL_FAST(fstat)
+     6fd:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     704:	0f 05                	syscall
+     706:	c3                   	ret
+
+0000000000000707 <link>:
+SYSCALL_FAST(link)
+     707:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     70e:	0f 05                	syscall
+     710:	c3                   	ret
+
+0000000000000711 <mkdir>:
+SYSCALL_FAST(mkdir)
+     711:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     718:	0f 05                	syscall
+     71a:	c3                   	ret
+
+000000000000071b <chdir>:
+SYSCALL_FAST(chdir)
+     71b:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     722:	0f 05                	syscall
+     724:	c3                   	ret
+
+0000000000000725 <dup>:
+SYSCALL_FAST(dup)
+     725:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     72c:	0f 05                	syscall
+     72e:	c3                   	ret
+
+000000000000072f <sbrk>:
+SYSCALL_FAST(sbrk)
+     72f:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     736:	0f 05                	syscall
+     738:	c3                   	ret
+
+0000000000000739 <sleep>:
+SYSCALL_FAST(sleep)
+     739:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     740:	0f 05                	syscall
+     742:	c3                   	ret
+
+0000000000000743 <send>:
+SYSCALL_FAST(send)
+     743:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     74a:	0f 05                	syscall
+     74c:	c3                   	ret
+
+000000000000074d <send_recv>:
+SYSCALL_FAST(send_recv)
+     74d:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     754:	0f 05                	syscall
+     756:	c3                   	ret
+
+0000000000000757 <recv>:
+SYSCALL_FAST(recv)
+     757:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     75e:	0f 05                	syscall
+     760:	c3                   	ret
+
+0000000000000761 <call>:
+SYSCALL_FAST(call)
+     761:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     768:	0f 05                	syscall
+     76a:	c3                   	ret
+
+000000000000076b <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     76b:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     772:	0f 05                	syscall
+     774:	c3                   	ret
+
+0000000000000775 <send_reg>:
+SYSCALL_REG(send_reg)
+     775:	41 54                	push   %r12
+     777:	41 55                	push   %r13
+     779:	41 56                	push   %r14
+     77b:	41 57                	push   %r15
+     77d:	56                   	push   %rsi
+     77e:	49 89 f3             	mov    %rsi,%r11
+     781:	48 89 d6             	mov    %rdx,%rsi
+     784:	49 8b 13             	mov    (%r11),%rdx
+     787:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     78b:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     78f:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     793:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     797:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     79b:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     79f:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     7a3:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     7aa:	0f 05                	syscall
+     7ac:	41 5b                	pop    %r11
+     7ae:	49 89 13             	mov    %rdx,(%r11)
+     7b1:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     7b5:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     7b9:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     7bd:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     7c1:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     7c5:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     7c9:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     7cd:	41 5f                	pop    %r15
+     7cf:	41 5e                	pop    %r14
+     7d1:	41 5d                	pop    %r13
+     7d3:	41 5c                	pop    %r12
+     7d5:	c3                   	ret
+
+00000000000007d6 <recv_reg>:
+SYSCALL_REG(recv_reg)
+     7d6:	41 54                	push   %r12
+     7d8:	41 55                	push   %r13
+     7da:	41 56                	push   %r14
+     7dc:	41 57                	push   %r15
+     7de:	56                   	push   %rsi
+     7df:	49 89 f3             	mov    %rsi,%r11
+     7e2:	48 89 d6             	mov    %rdx,%rsi
+     7e5:	49 8b 13             	mov    (%r11),%rdx
+     7e8:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     7ec:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     7f0:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     7f4:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     7f8:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     7fc:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     800:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     804:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+     80b:	0f 05                	syscall
+     80d:	41 5b                	pop    %r11
+     80f:	49 89 13             	mov    %rdx,(%r11)
+     812:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     816:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     81a:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     81e:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     822:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     826:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     82a:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     82e:	41 5f                	pop    %r15
+     830:	41 5e                	pop    %r14
+     832:	41 5d                	pop    %r13
+     834:	41 5c                	pop    %r12
+     836:	c3                   	ret
+
+0000000000000837 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+     837:	41 54                	push   %r12
+     839:	41 55                	push   %r13
+     83b:	41 56                	push   %r14
+     83d:	41 57                	push   %r15
+     83f:	56                   	push   %rsi
+     840:	49 89 f3             	mov    %rsi,%r11
+     843:	48 89 d6             	mov    %rdx,%rsi
+     846:	49 8b 13             	mov    (%r11),%rdx
+     849:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     84d:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     851:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     855:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     859:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     85d:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     861:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     865:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+     86c:	0f 05                	syscall
+     86e:	41 5b                	pop    %r11
+     870:	49 89 13             	mov    %rdx,(%r11)
+     873:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     877:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     87b:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     87f:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     883:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     887:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     88b:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     88f:	41 5f                	pop    %r15
+     891:	41 5e                	pop    %r14
+     893:	41 5d                	pop    %r13
+     895:	41 5c                	pop    %r12
+     897:	c3                   	ret
+
+0000000000000898 <call_reg>:
+SYSCALL_REG(call_reg)
+     898:	41 54                	push   %r12
+     89a:	41 55                	push   %r13
+     89c:	41 56                	push   %r14
+     89e:	41 57                	push   %r15
+     8a0:	56                   	push   %rsi
+     8a1:	49 89 f3             	mov    %rsi,%r11
+     8a4:	48 89 d6             	mov    %rdx,%rsi
+     8a7:	49 8b 13             	mov    (%r11),%rdx
+     8aa:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     8ae:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     8b2:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     8b6:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     8ba:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     8be:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     8c2:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     8c6:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+     8cd:	0f 05                	syscall
+     8cf:	41 5b                	pop    %r11
+     8d1:	49 89 13             	mov    %rdx,(%r11)
+     8d4:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     8d8:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     8dc:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     8e0:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     8e4:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     8e8:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     8ec:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     8f0:	41 5f                	pop    %r15
+     8f2:	41 5e                	pop    %r14
+     8f4:	41 5d                	pop    %r13
+     8f6:	41 5c                	pop    %r12
+     8f8:	c3                   	ret
+
+00000000000008f9 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+     8f9:	41 54                	push   %r12
+     8fb:	41 55                	push   %r13
+     8fd:	41 56                	push   %r14
+     8ff:	41 57                	push   %r15
+     901:	56                   	push   %rsi
+     902:	49 89 f3             	mov    %rsi,%r11
+     905:	48 89 d6             	mov    %rdx,%rsi
+     908:	49 8b 13             	mov    (%r11),%rdx
+     90b:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     90f:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     913:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     917:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     91b:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     91f:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     923:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     927:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+     92e:	0f 05                	syscall
+     930:	41 5b                	pop    %r11
+     932:	49 89 13             	mov    %rdx,(%r11)
+     935:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     939:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     93d:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     941:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     945:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     949:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     94d:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     951:	41 5f                	pop    %r15
+     953:	41 5e                	pop    %r14
+     955:	41 5d                	pop    %r13
+     957:	41 5c                	pop    %r12
+     959:	c3                   	ret
+
+000000000000095a <sendx>:
+SYSCALL_FAST(sendx)
+     95a:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+     961:	0f 05                	syscall
+     963:	c3                   	ret
+
+0000000000000964 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+     964:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+     96b:	0f 05                	syscall
+     96d:	c3                   	ret
+
+000000000000096e <notify>:
+SYSCALL_FAST(notify)
+     96e:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+     975:	0f 05                	syscall
+     977:	c3                   	ret
+
+0000000000000978 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+     978:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+     97f:	0f 05                	syscall
+     981:	c3                   	ret
+
+0000000000000982 <send_timed>:
+SYSCALL_FAST(send_timed)
+     982:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+     989:	0f 05                	syscall
+     98b:	c3                   	ret
+
+000000000000098c <recv_timed>:
+SYSCALL_FAST(recv_timed)
+     98c:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+     993:	0f 05                	syscall
+     995:	c3                   	ret
+
+0000000000000996 <set_add>:
+SYSCALL_FAST(set_add)
+     996:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+     99d:	0f 05                	syscall
+     99f:	c3                   	ret
+
+00000000000009a0 <set_del>:
+SYSCALL_FAST(set_del)
+     9a0:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+     9a7:	0f 05                	syscall
+     9a9:	c3                   	ret
+
+00000000000009aa <recv_any>:
+SYSCALL_FAST(recv_any)
+     9aa:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+     9b1:	0f 05                	syscall
+     9b3:	c3                   	ret
+
+00000000000009b4 <ep_create>:
+SYSCALL_FAST(ep_create)
+     9b4:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+     9bb:	0f 05                	syscall
+     9bd:	c3                   	ret
+
+00000000000009be <ep_close>:
+SYSCALL_FAST(ep_close)
+     9be:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+     9c5:	0f 05                	syscall
+     9c7:	c3                   	ret
+
+00000000000009c8 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+     9c8:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+     9cf:	0f 05                	syscall
+     9d1:	c3                   	ret
+
+00000000000009d2 <setprio>:
+SYSCALL_FAST(setprio)
+     9d2:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+     9d9:	0f 05                	syscall
+     9db:	c3                   	ret
+
+00000000000009dc <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+     9dc:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+     9e3:	0f 05                	syscall
+     9e5:	c3                   	ret
+
+00000000000009e6 <sethuge>:
+SYSCALL_FAST(sethuge)
+     9e6:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+     9ed:	0f 05                	syscall
+     9ef:	c3                   	ret
+
+00000000000009f0 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+     9f0:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+     9f7:	0f 05                	syscall
+     9f9:	c3                   	ret
+
+00000000000009fa <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+     9fa:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+     a01:	0f 05                	syscall
+     a03:	c3                   	ret
+
+0000000000000a04 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+     a04:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+     a0b:	0f 05                	syscall
+     a0d:	c3                   	ret
+
+0000000000000a0e <null_call>:
+     a0e:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+     a15:	0f 05                	syscall
+     a17:	c3                   	ret
+
+0000000000000a18 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     a18:	55                   	push   %rbp
+     a19:	48 89 e5             	mov    %rsp,%rbp
+     a1c:	48 83 ec 10          	sub    $0x10,%rsp
+     a20:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     a23:	89 f0                	mov    %esi,%eax
+     a25:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     a28:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     a2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a2f:	ba 01 00 00 00       	mov    $0x1,%edx
+     a34:	48 89 ce             	mov    %rcx,%rsi
+     a37:	89 c7                	mov    %eax,%edi
+     a39:	e8 79 fc ff ff       	call   6b7 <write>
+}
+     a3e:	90                   	nop
+     a3f:	c9                   	leave
+     a40:	c3                   	ret
+
+0000000000000a41 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     a41:	55                   	push   %rbp
+     a42:	48 89 e5             	mov    %rsp,%rbp
+     a45:	48 83 ec 30          	sub    $0x30,%rsp
+     a49:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     a4c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     a4f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     a52:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     a55:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     a5c:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     a60:	74 17                	je     a79 <printint+0x38>
+     a62:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     a66:	79 11                	jns    a79 <printint+0x38>
+    neg = 1;
+     a68:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     a6f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a72:	f7 d8                	neg    %eax
+     a74:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     a77:	eb 06                	jmp    a7f <printint+0x3e>
+  } else {
+    x = xx;
+     a79:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a7c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     a7f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     a86:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     a89:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a8c:	ba 00 00 00 00       	mov    $0x0,%edx
+     a91:	f7 f1                	div    %ecx
+     a93:	89 d1                	mov    %edx,%ecx
+     a95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a98:	8d 50 01             	lea    0x1(%rax),%edx
+     a9b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     a9e:	89 ca                	mov    %ecx,%edx
+     aa0:	0f b6 92 60 16 00 00 	movzbl 0x1660(%rdx),%edx
+     aa7:	48 98                	cltq
+     aa9:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     aad:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     ab0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     ab3:	ba 00 00 00 00       	mov    $0x0,%edx
+     ab8:	f7 f6                	div    %esi
+     aba:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     abd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     ac1:	75 c3                	jne    a86 <printint+0x45>
+  if(neg)
+     ac3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     ac7:	74 2b                	je     af4 <printint+0xb3>
+    buf[i++] = '-';
+     ac9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     acc:	8d 50 01             	lea    0x1(%rax),%edx
+     acf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     ad2:	48 98                	cltq
+     ad4:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+     ad9:	eb 19                	jmp    af4 <printint+0xb3>
+    putc(fd, buf[i]);
+     adb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ade:	48 98                	cltq
+     ae0:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+     ae5:	0f be d0             	movsbl %al,%edx
+     ae8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     aeb:	89 d6                	mov    %edx,%esi
+     aed:	89 c7                	mov    %eax,%edi
+     aef:	e8 24 ff ff ff       	call   a18 <putc>
+  while(--i >= 0)
+     af4:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     af8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     afc:	79 dd                	jns    adb <printint+0x9a>
+}
+     afe:	90                   	nop
+     aff:	90                   	nop
+     b00:	c9                   	leave
+     b01:	c3                   	ret
+
+0000000000000b02 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b02:	55                   	push   %rbp
+     b03:	48 89 e5             	mov    %rsp,%rbp
+     b06:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+     b0d:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+     b13:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+     b1a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+     b21:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+     b28:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+     b2f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+     b36:	84 c0                	test   %al,%al
+     b38:	74 20                	je     b5a <printf+0x58>
+     b3a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+     b3e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+     b42:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+     b46:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+     b4a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+     b4e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+     b52:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+     b56:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+     b5a:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+     b61:	00 00 00 
+     b64:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+     b6b:	00 00 00 
+     b6e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     b72:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+     b79:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+     b80:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+     b87:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     b8e:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     b91:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+     b98:	00 00 00 
+     b9b:	e9 a8 02 00 00       	jmp    e48 <printf+0x346>
+    c = fmt[i] & 0xff;
+     ba0:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     ba6:	48 63 d0             	movslq %eax,%rdx
+     ba9:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     bb0:	48 01 d0             	add    %rdx,%rax
+     bb3:	0f b6 00             	movzbl (%rax),%eax
+     bb6:	0f be c0             	movsbl %al,%eax
+     bb9:	25 ff 00 00 00       	and    $0xff,%eax
+     bbe:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+     bc4:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+     bcb:	75 35                	jne    c02 <printf+0x100>
+      if(c == '%'){
+     bcd:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     bd4:	75 0f                	jne    be5 <printf+0xe3>
+        state = '%';
+     bd6:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+     bdd:	00 00 00 
+     be0:	e9 5c 02 00 00       	jmp    e41 <printf+0x33f>
+      } else {
+        putc(fd, c);
+     be5:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     beb:	0f be d0             	movsbl %al,%edx
+     bee:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     bf4:	89 d6                	mov    %edx,%esi
+     bf6:	89 c7                	mov    %eax,%edi
+     bf8:	e8 1b fe ff ff       	call   a18 <putc>
+     bfd:	e9 3f 02 00 00       	jmp    e41 <printf+0x33f>
+      }
+    } else if(state == '%'){
+     c02:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+     c09:	0f 85 32 02 00 00    	jne    e41 <printf+0x33f>
+      if(c == 'd'){
+     c0f:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+     c16:	75 5e                	jne    c76 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+     c18:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     c1e:	83 f8 2f             	cmp    $0x2f,%eax
+     c21:	77 23                	ja     c46 <printf+0x144>
+     c23:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     c2a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c30:	89 d2                	mov    %edx,%edx
+     c32:	48 01 d0             	add    %rdx,%rax
+     c35:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c3b:	83 c2 08             	add    $0x8,%edx
+     c3e:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     c44:	eb 12                	jmp    c58 <printf+0x156>
+     c46:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     c4d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c51:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     c58:	8b 30                	mov    (%rax),%esi
+     c5a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c60:	b9 01 00 00 00       	mov    $0x1,%ecx
+     c65:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c6a:	89 c7                	mov    %eax,%edi
+     c6c:	e8 d0 fd ff ff       	call   a41 <printint>
+     c71:	e9 c1 01 00 00       	jmp    e37 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+     c76:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+     c7d:	74 09                	je     c88 <printf+0x186>
+     c7f:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+     c86:	75 5e                	jne    ce6 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+     c88:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     c8e:	83 f8 2f             	cmp    $0x2f,%eax
+     c91:	77 23                	ja     cb6 <printf+0x1b4>
+     c93:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     c9a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     ca0:	89 d2                	mov    %edx,%edx
+     ca2:	48 01 d0             	add    %rdx,%rax
+     ca5:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     cab:	83 c2 08             	add    $0x8,%edx
+     cae:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     cb4:	eb 12                	jmp    cc8 <printf+0x1c6>
+     cb6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     cbd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     cc1:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     cc8:	8b 30                	mov    (%rax),%esi
+     cca:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     cd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+     cd5:	ba 10 00 00 00       	mov    $0x10,%edx
+     cda:	89 c7                	mov    %eax,%edi
+     cdc:	e8 60 fd ff ff       	call   a41 <printint>
+     ce1:	e9 51 01 00 00       	jmp    e37 <printf+0x335>
+      } else if(c == 's'){
+     ce6:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+     ced:	0f 85 98 00 00 00    	jne    d8b <printf+0x289>
+        s = va_arg(ap, char*);
+     cf3:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     cf9:	83 f8 2f             	cmp    $0x2f,%eax
+     cfc:	77 23                	ja     d21 <printf+0x21f>
+     cfe:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     d05:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     d0b:	89 d2                	mov    %edx,%edx
+     d0d:	48 01 d0             	add    %rdx,%rax
+     d10:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     d16:	83 c2 08             	add    $0x8,%edx
+     d19:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     d1f:	eb 12                	jmp    d33 <printf+0x231>
+     d21:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     d28:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     d2c:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     d33:	48 8b 00             	mov    (%rax),%rax
+     d36:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+     d3d:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+     d44:	00 
+     d45:	75 31                	jne    d78 <printf+0x276>
+          s = "(null)";
+     d47:	48 c7 85 48 ff ff ff 	movq   $0x12f6,-0xb8(%rbp)
+     d4e:	f6 12 00 00 
+        while(*s != 0){
+     d52:	eb 24                	jmp    d78 <printf+0x276>
+          putc(fd, *s);
+     d54:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     d5b:	0f b6 00             	movzbl (%rax),%eax
+     d5e:	0f be d0             	movsbl %al,%edx
+     d61:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     d67:	89 d6                	mov    %edx,%esi
+     d69:	89 c7                	mov    %eax,%edi
+     d6b:	e8 a8 fc ff ff       	call   a18 <putc>
+          s++;
+     d70:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+     d77:	01 
+        while(*s != 0){
+     d78:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     d7f:	0f b6 00             	movzbl (%rax),%eax
+     d82:	84 c0                	test   %al,%al
+     d84:	75 ce                	jne    d54 <printf+0x252>
+     d86:	e9 ac 00 00 00       	jmp    e37 <printf+0x335>
+        }
+      } else if(c == 'c'){
+     d8b:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+     d92:	75 56                	jne    dea <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+     d94:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     d9a:	83 f8 2f             	cmp    $0x2f,%eax
+     d9d:	77 23                	ja     dc2 <printf+0x2c0>
+     d9f:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     da6:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     dac:	89 d2                	mov    %edx,%edx
+     dae:	48 01 d0             	add    %rdx,%rax
+     db1:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     db7:	83 c2 08             	add    $0x8,%edx
+     dba:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     dc0:	eb 12                	jmp    dd4 <printf+0x2d2>
+     dc2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     dc9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     dcd:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     dd4:	8b 00                	mov    (%rax),%eax
+     dd6:	0f be d0             	movsbl %al,%edx
+     dd9:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     ddf:	89 d6                	mov    %edx,%esi
+     de1:	89 c7                	mov    %eax,%edi
+     de3:	e8 30 fc ff ff       	call   a18 <putc>
+     de8:	eb 4d                	jmp    e37 <printf+0x335>
+      } else if(c == '%'){
+     dea:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     df1:	75 1a                	jne    e0d <printf+0x30b>
+        putc(fd, c);
+     df3:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     df9:	0f be d0             	movsbl %al,%edx
+     dfc:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     e02:	89 d6                	mov    %edx,%esi
+     e04:	89 c7                	mov    %eax,%edi
+     e06:	e8 0d fc ff ff       	call   a18 <putc>
+     e0b:	eb 2a                	jmp    e37 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     e0d:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     e13:	be 25 00 00 00       	mov    $0x25,%esi
+     e18:	89 c7                	mov    %eax,%edi
+     e1a:	e8 f9 fb ff ff       	call   a18 <putc>
+        putc(fd, c);
+     e1f:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     e25:	0f be d0             	movsbl %al,%edx
+     e28:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     e2e:	89 d6                	mov    %edx,%esi
+     e30:	89 c7                	mov    %eax,%edi
+     e32:	e8 e1 fb ff ff       	call   a18 <putc>
+      }
+      state = 0;
+     e37:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     e3e:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     e41:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+     e48:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     e4e:	48 63 d0             	movslq %eax,%rdx
+     e51:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     e58:	48 01 d0             	add    %rdx,%rax
+     e5b:	0f b6 00             	movzbl (%rax),%eax
+     e5e:	84 c0                	test   %al,%al
+     e60:	0f 85 3a fd ff ff    	jne    ba0 <printf+0x9e>
+    }
+  }
+}
+     e66:	90                   	nop
+     e67:	90                   	nop
+     e68:	c9                   	leave
+     e69:	c3                   	ret
+
+0000000000000e6a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e6a:	55                   	push   %rbp
+     e6b:	48 89 e5             	mov    %rsp,%rbp
+     e6e:	48 83 ec 18          	sub    $0x18,%rsp
+     e72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e7a:	48 83 e8 10          	sub    $0x10,%rax
+     e7e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e82:	48 8b 05 07 0c 00 00 	mov    0xc07(%rip),%rax        # 1a90 <freep>
+     e89:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e8d:	eb 2f                	jmp    ebe <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e93:	48 8b 00             	mov    (%rax),%rax
+     e96:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e9a:	72 17                	jb     eb3 <free+0x49>
+     e9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ea0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ea4:	72 2f                	jb     ed5 <free+0x6b>
+     ea6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eaa:	48 8b 00             	mov    (%rax),%rax
+     ead:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     eb1:	72 22                	jb     ed5 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     eb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eb7:	48 8b 00             	mov    (%rax),%rax
+     eba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     ebe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ec2:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ec6:	73 c7                	jae    e8f <free+0x25>
+     ec8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ecc:	48 8b 00             	mov    (%rax),%rax
+     ecf:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     ed3:	73 ba                	jae    e8f <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ed5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ed9:	8b 40 08             	mov    0x8(%rax),%eax
+     edc:	89 c0                	mov    %eax,%eax
+     ede:	48 c1 e0 04          	shl    $0x4,%rax
+     ee2:	48 89 c2             	mov    %rax,%rdx
+     ee5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ee9:	48 01 c2             	add    %rax,%rdx
+     eec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ef0:	48 8b 00             	mov    (%rax),%rax
+     ef3:	48 39 c2             	cmp    %rax,%rdx
+     ef6:	75 2d                	jne    f25 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+     ef8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     efc:	8b 50 08             	mov    0x8(%rax),%edx
+     eff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f03:	48 8b 00             	mov    (%rax),%rax
+     f06:	8b 40 08             	mov    0x8(%rax),%eax
+     f09:	01 c2                	add    %eax,%edx
+     f0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f0f:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f16:	48 8b 00             	mov    (%rax),%rax
+     f19:	48 8b 10             	mov    (%rax),%rdx
+     f1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f20:	48 89 10             	mov    %rdx,(%rax)
+     f23:	eb 0e                	jmp    f33 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+     f25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f29:	48 8b 10             	mov    (%rax),%rdx
+     f2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f30:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     f33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f37:	8b 40 08             	mov    0x8(%rax),%eax
+     f3a:	89 c0                	mov    %eax,%eax
+     f3c:	48 c1 e0 04          	shl    $0x4,%rax
+     f40:	48 89 c2             	mov    %rax,%rdx
+     f43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f47:	48 01 d0             	add    %rdx,%rax
+     f4a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     f4e:	75 27                	jne    f77 <free+0x10d>
+    p->s.size += bp->s.size;
+     f50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f54:	8b 50 08             	mov    0x8(%rax),%edx
+     f57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f5b:	8b 40 08             	mov    0x8(%rax),%eax
+     f5e:	01 c2                	add    %eax,%edx
+     f60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f64:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     f67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f6b:	48 8b 10             	mov    (%rax),%rdx
+     f6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f72:	48 89 10             	mov    %rdx,(%rax)
+     f75:	eb 0b                	jmp    f82 <free+0x118>
+  } else
+    p->s.ptr = bp;
+     f77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f7b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f7f:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     f82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f86:	48 89 05 03 0b 00 00 	mov    %rax,0xb03(%rip)        # 1a90 <freep>
+}
+     f8d:	90                   	nop
+     f8e:	c9                   	leave
+     f8f:	c3                   	ret
+
+0000000000000f90 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     f90:	55                   	push   %rbp
+     f91:	48 89 e5             	mov    %rsp,%rbp
+     f94:	48 83 ec 20          	sub    $0x20,%rsp
+     f98:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     f9b:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     fa2:	77 07                	ja     fab <morecore+0x1b>
+    nu = 4096;
+     fa4:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     fab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fae:	c1 e0 04             	shl    $0x4,%eax
+     fb1:	89 c7                	mov    %eax,%edi
+     fb3:	e8 77 f7 ff ff       	call   72f <sbrk>
+     fb8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     fbc:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     fc1:	75 07                	jne    fca <morecore+0x3a>
+    return 0;
+     fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+     fc8:	eb 29                	jmp    ff3 <morecore+0x63>
+  hp = (Header*)p;
+     fca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     fd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fd6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     fd9:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     fdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fe0:	48 83 c0 10          	add    $0x10,%rax
+     fe4:	48 89 c7             	mov    %rax,%rdi
+     fe7:	e8 7e fe ff ff       	call   e6a <free>
+  return freep;
+     fec:	48 8b 05 9d 0a 00 00 	mov    0xa9d(%rip),%rax        # 1a90 <freep>
+}
+     ff3:	c9                   	leave
+     ff4:	c3                   	ret
+
+0000000000000ff5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     ff5:	55                   	push   %rbp
+     ff6:	48 89 e5             	mov    %rsp,%rbp
+     ff9:	48 83 ec 30          	sub    $0x30,%rsp
+     ffd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1000:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1003:	48 83 c0 0f          	add    $0xf,%rax
+    1007:	48 c1 e8 04          	shr    $0x4,%rax
+    100b:	83 c0 01             	add    $0x1,%eax
+    100e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+    1011:	48 8b 05 78 0a 00 00 	mov    0xa78(%rip),%rax        # 1a90 <freep>
+    1018:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    101c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1021:	75 2b                	jne    104e <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+    1023:	48 c7 45 f0 80 1a 00 	movq   $0x1a80,-0x10(%rbp)
+    102a:	00 
+    102b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    102f:	48 89 05 5a 0a 00 00 	mov    %rax,0xa5a(%rip)        # 1a90 <freep>
+    1036:	48 8b 05 53 0a 00 00 	mov    0xa53(%rip),%rax        # 1a90 <freep>
+    103d:	48 89 05 3c 0a 00 00 	mov    %rax,0xa3c(%rip)        # 1a80 <base>
+    base.s.size = 0;
+    1044:	c7 05 3a 0a 00 00 00 	movl   $0x0,0xa3a(%rip)        # 1a88 <base+0x8>
+    104b:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    104e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1052:	48 8b 00             	mov    (%rax),%rax
+    1055:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1059:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    105d:	8b 40 08             	mov    0x8(%rax),%eax
+    1060:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1063:	72 5f                	jb     10c4 <malloc+0xcf>
+      if(p->s.size == nunits)
+    1065:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1069:	8b 40 08             	mov    0x8(%rax),%eax
+    106c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    106f:	75 10                	jne    1081 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+    1071:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1075:	48 8b 10             	mov    (%rax),%rdx
+    1078:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    107c:	48 89 10             	mov    %rdx,(%rax)
+    107f:	eb 2e                	jmp    10af <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+    1081:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1085:	8b 40 08             	mov    0x8(%rax),%eax
+    1088:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    108b:	89 c2                	mov    %eax,%edx
+    108d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1091:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1094:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1098:	8b 40 08             	mov    0x8(%rax),%eax
+    109b:	89 c0                	mov    %eax,%eax
+    109d:	48 c1 e0 04          	shl    $0x4,%rax
+    10a1:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    10a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10a9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    10ac:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    10af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10b3:	48 89 05 d6 09 00 00 	mov    %rax,0x9d6(%rip)        # 1a90 <freep>
+      return (void*)(p + 1);
+    10ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10be:	48 83 c0 10          	add    $0x10,%rax
+    10c2:	eb 41                	jmp    1105 <malloc+0x110>
+    }
+    if(p == freep)
+    10c4:	48 8b 05 c5 09 00 00 	mov    0x9c5(%rip),%rax        # 1a90 <freep>
+    10cb:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    10cf:	75 1c                	jne    10ed <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+    10d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10d4:	89 c7                	mov    %eax,%edi
+    10d6:	e8 b5 fe ff ff       	call   f90 <morecore>
+    10db:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    10df:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    10e4:	75 07                	jne    10ed <malloc+0xf8>
+        return 0;
+    10e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    10eb:	eb 18                	jmp    1105 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10f1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    10f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10f9:	48 8b 00             	mov    (%rax),%rax
+    10fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1100:	e9 54 ff ff ff       	jmp    1059 <malloc+0x64>
+  }
+}
+    1105:	c9                   	leave
+    1106:	c3                   	ret
+
+0000000000001107 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+    1107:	55                   	push   %rbp
+    1108:	48 89 e5             	mov    %rsp,%rbp
+    110b:	53                   	push   %rbx
+    110c:	48 83 ec 38          	sub    $0x38,%rsp
+    1110:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1113:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1117:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+    111b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    111f:	8b 40 40             	mov    0x40(%rax),%eax
+    1122:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+    1125:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1129:	8b 00                	mov    (%rax),%eax
+    112b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    112e:	29 c2                	sub    %eax,%edx
+    1130:	83 fa 20             	cmp    $0x20,%edx
+    1133:	75 0a                	jne    113f <ring_send+0x38>
+    return -1;
+    1135:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    113a:	e9 93 00 00 00       	jmp    11d2 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+    113f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1142:	83 e0 1f             	and    $0x1f,%eax
+    1145:	89 c2                	mov    %eax,%edx
+    1147:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    114b:	89 d2                	mov    %edx,%edx
+    114d:	48 83 c2 02          	add    $0x2,%rdx
+    1151:	48 c1 e2 06          	shl    $0x6,%rdx
+    1155:	48 01 c2             	add    %rax,%rdx
+    1158:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    115c:	48 8b 08             	mov    (%rax),%rcx
+    115f:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    1163:	48 89 0a             	mov    %rcx,(%rdx)
+    1166:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+    116a:	48 8b 48 10          	mov    0x10(%rax),%rcx
+    116e:	48 8b 58 18          	mov    0x18(%rax),%rbx
+    1172:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+    1176:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+    117a:	48 8b 48 20          	mov    0x20(%rax),%rcx
+    117e:	48 8b 58 28          	mov    0x28(%rax),%rbx
+    1182:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+    1186:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+    118a:	48 8b 48 30          	mov    0x30(%rax),%rcx
+    118e:	48 8b 58 38          	mov    0x38(%rax),%rbx
+    1192:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+    1196:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+    119a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+    11a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    11a3:	8d 50 01             	lea    0x1(%rax),%edx
+    11a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11aa:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+    11ad:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+    11b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11b7:	8b 00                	mov    (%rax),%eax
+    11b9:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    11bc:	75 0f                	jne    11cd <ring_send+0xc6>
+    notify(channel, 1);
+    11be:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11c1:	be 01 00 00 00       	mov    $0x1,%esi
+    11c6:	89 c7                	mov    %eax,%edi
+    11c8:	e8 a1 f7 ff ff       	call   96e <notify>
+  return 0;
+    11cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    11d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    11d6:	c9                   	leave
+    11d7:	c3                   	ret
+
+00000000000011d8 <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+    11d8:	55                   	push   %rbp
+    11d9:	48 89 e5             	mov    %rsp,%rbp
+    11dc:	53                   	push   %rbx
+    11dd:	48 83 ec 38          	sub    $0x38,%rsp
+    11e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    11e4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    11e8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+    11ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11f0:	8b 00                	mov    (%rax),%eax
+    11f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+    11f5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+    11fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11ff:	8b 40 40             	mov    0x40(%rax),%eax
+    1202:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1205:	75 15                	jne    121c <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+    1207:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    120a:	89 c7                	mov    %eax,%edi
+    120c:	e8 67 f7 ff ff       	call   978 <nfy_wait>
+    1211:	85 c0                	test   %eax,%eax
+    1213:	79 e0                	jns    11f5 <ring_recv+0x1d>
+      return -1;
+    1215:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    121a:	eb 73                	jmp    128f <ring_recv+0xb7>
+      break;
+    121c:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+    121d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1220:	83 e0 1f             	and    $0x1f,%eax
+    1223:	89 c1                	mov    %eax,%ecx
+    1225:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1229:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    122d:	89 c9                	mov    %ecx,%ecx
+    122f:	48 83 c1 02          	add    $0x2,%rcx
+    1233:	48 c1 e1 06          	shl    $0x6,%rcx
+    1237:	48 01 ca             	add    %rcx,%rdx
+    123a:	48 8b 0a             	mov    (%rdx),%rcx
+    123d:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+    1241:	48 89 08             	mov    %rcx,(%rax)
+    1244:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    1248:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    124c:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    1250:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    1254:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    1258:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    125c:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    1260:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    1264:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    1268:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    126c:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    1270:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    1274:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    1278:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    127e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1281:	8d 50 01             	lea    0x1(%rax),%edx
+    1284:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1288:	89 10                	mov    %edx,(%rax)
+  return 0;
+    128a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    128f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1293:	c9                   	leave
+    1294:	c3                   	ret
+
+0000000000001295 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    1295:	55                   	push   %rbp
+    1296:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    1299:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    129e:	8b 00                	mov    (%rax),%eax
+}
+    12a0:	5d                   	pop    %rbp
+    12a1:	c3                   	ret
+
+00000000000012a2 <getpid>:
+
+int
+getpid(void)
+{
+    12a2:	55                   	push   %rbp
+    12a3:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    12a6:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    12ab:	8b 00                	mov    (%rax),%eax
+}
+    12ad:	5d                   	pop    %rbp
+    12ae:	c3                   	ret
+
+00000000000012af <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    12af:	55                   	push   %rbp
+    12b0:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    12b3:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    12b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    12bc:	5d                   	pop    %rbp
+    12bd:	c3                   	ret
@@ -0,0 +1,1759 @@
+
+fs/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid, wpid;
+  
+  if(open("console", O_RDWR) < 0){
+       8:	be 02 00 00 00       	mov    $0x2,%esi
+       d:	48 c7 c7 27 10 00 00 	mov    $0x1027,%rdi
+      14:	e8 2c 04 00 00       	call   445 <open>
+      19:	85 c0                	test   %eax,%eax
+      1b:	79 27                	jns    44 <main+0x44>
+    mknod("console", 1, 1);
+      1d:	ba 01 00 00 00       	mov    $0x1,%edx
+      22:	be 01 00 00 00       	mov    $0x1,%esi
+      27:	48 c7 c7 27 10 00 00 	mov    $0x1027,%rdi
+      2e:	e8 1c 04 00 00       	call   44f <mknod>
+    open("console", O_RDWR);
+      33:	be 02 00 00 00       	mov    $0x2,%esi
+      38:	48 c7 c7 27 10 00 00 	mov    $0x1027,%rdi
+      3f:	e8 01 04 00 00       	call   445 <open>
+  }
+  
+  dup(0);  // stdout
+      44:	bf 00 00 00 00       	mov    $0x0,%edi
+      49:	e8 3d 04 00 00       	call   48b <dup>
+  dup(0);  // stderr
+      4e:	bf 00 00 00 00       	mov    $0x0,%edi
+      53:	e8 33 04 00 00       	call   48b <dup>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+      58:	48 c7 c6 2f 10 00 00 	mov    $0x102f,%rsi
+      5f:	bf 01 00 00 00       	mov    $0x1,%edi
+      64:	b8 00 00 00 00       	mov    $0x0,%eax
+      69:	e8 fa 07 00 00       	call   868 <printf>
+    pid = fork();
+      6e:	e8 78 03 00 00       	call   3eb <fork>
+      73:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if(pid < 0){
+      76:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      7a:	79 1b                	jns    97 <main+0x97>
+      printf(1, "init: fork failed\n");
+      7c:	48 c7 c6 42 10 00 00 	mov    $0x1042,%rsi
+      83:	bf 01 00 00 00       	mov    $0x1,%edi
+      88:	b8 00 00 00 00       	mov    $0x0,%eax
+      8d:	e8 d6 07 00 00       	call   868 <printf>
+      exit();
+      92:	e8 5e 03 00 00       	call   3f5 <exit>
+    }
+    if(pid == 0){
+      97:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      9b:	75 44                	jne    e1 <main+0xe1>
+      exec("sh", argv);
+      9d:	48 c7 c6 60 13 00 00 	mov    $0x1360,%rsi
+      a4:	48 c7 c7 24 10 00 00 	mov    $0x1024,%rdi
+      ab:	e8 8b 03 00 00       	call   43b <exec>
+      printf(1, "init: exec sh failed\n");
+      b0:	48 c7 c6 55 10 00 00 	mov    $0x1055,%rsi
+      b7:	bf 01 00 00 00       	mov    $0x1,%edi
+      bc:	b8 00 00 00 00       	mov    $0x0,%eax
+      c1:	e8 a2 07 00 00       	call   868 <printf>
+      exit();
+      c6:	e8 2a 03 00 00       	call   3f5 <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+      cb:	48 c7 c6 6b 10 00 00 	mov    $0x106b,%rsi
+      d2:	bf 01 00 00 00       	mov    $0x1,%edi
+      d7:	b8 00 00 00 00       	mov    $0x0,%eax
+      dc:	e8 87 07 00 00       	call   868 <printf>
+    while((wpid=wait()) >= 0 && wpid != pid)
+      e1:	e8 19 03 00 00       	call   3ff <wait>
+      e6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      e9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      ed:	0f 88 65 ff ff ff    	js     58 <main+0x58>
+      f3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      f6:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+      f9:	75 d0                	jne    cb <main+0xcb>
+    printf(1, "init: starting sh\n");
+      fb:	e9 58 ff ff ff       	jmp    58 <main+0x58>
+
+0000000000000100 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     100:	55                   	push   %rbp
+     101:	48 89 e5             	mov    %rsp,%rbp
+     104:	48 83 ec 10          	sub    $0x10,%rsp
+     108:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     10c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     10f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     112:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     116:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     119:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     11c:	48 89 ce             	mov    %rcx,%rsi
+     11f:	48 89 f7             	mov    %rsi,%rdi
+     122:	89 d1                	mov    %edx,%ecx
+     124:	fc                   	cld
+     125:	f3 aa                	rep stos %al,%es:(%rdi)
+     127:	89 ca                	mov    %ecx,%edx
+     129:	48 89 fe             	mov    %rdi,%rsi
+     12c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     130:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     133:	90                   	nop
+     134:	c9                   	leave
+     135:	c3                   	ret
+
+0000000000000136 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     136:	55                   	push   %rbp
+     137:	48 89 e5             	mov    %rsp,%rbp
+     13a:	48 83 ec 20          	sub    $0x20,%rsp
+     13e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     142:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     146:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     14a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     14e:	90                   	nop
+     14f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     153:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     157:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     15b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     15f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     163:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     167:	0f b6 12             	movzbl (%rdx),%edx
+     16a:	88 10                	mov    %dl,(%rax)
+     16c:	0f b6 00             	movzbl (%rax),%eax
+     16f:	84 c0                	test   %al,%al
+     171:	75 dc                	jne    14f <strcpy+0x19>
+    ;
+  return os;
+     173:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     177:	c9                   	leave
+     178:	c3                   	ret
+
+0000000000000179 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     179:	55                   	push   %rbp
+     17a:	48 89 e5             	mov    %rsp,%rbp
+     17d:	48 83 ec 10          	sub    $0x10,%rsp
+     181:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     185:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     189:	eb 0a                	jmp    195 <strcmp+0x1c>
+    p++, q++;
+     18b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     190:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     195:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     199:	0f b6 00             	movzbl (%rax),%eax
+     19c:	84 c0                	test   %al,%al
+     19e:	74 12                	je     1b2 <strcmp+0x39>
+     1a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     1a4:	0f b6 10             	movzbl (%rax),%edx
+     1a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1ab:	0f b6 00             	movzbl (%rax),%eax
+     1ae:	38 c2                	cmp    %al,%dl
+     1b0:	74 d9                	je     18b <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     1b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     1b6:	0f b6 00             	movzbl (%rax),%eax
+     1b9:	0f b6 d0             	movzbl %al,%edx
+     1bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1c0:	0f b6 00             	movzbl (%rax),%eax
+     1c3:	0f b6 c0             	movzbl %al,%eax
+     1c6:	29 c2                	sub    %eax,%edx
+     1c8:	89 d0                	mov    %edx,%eax
+}
+     1ca:	c9                   	leave
+     1cb:	c3                   	ret
+
+00000000000001cc <strlen>:
+
+uint
+strlen(char *s)
+{
+     1cc:	55                   	push   %rbp
+     1cd:	48 89 e5             	mov    %rsp,%rbp
+     1d0:	48 83 ec 18          	sub    $0x18,%rsp
+     1d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     1d8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     1df:	eb 04                	jmp    1e5 <strlen+0x19>
+     1e1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1e8:	48 63 d0             	movslq %eax,%rdx
+     1eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1ef:	48 01 d0             	add    %rdx,%rax
+     1f2:	0f b6 00             	movzbl (%rax),%eax
+     1f5:	84 c0                	test   %al,%al
+     1f7:	75 e8                	jne    1e1 <strlen+0x15>
+    ;
+  return n;
+     1f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     1fc:	c9                   	leave
+     1fd:	c3                   	ret
+
+00000000000001fe <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1fe:	55                   	push   %rbp
+     1ff:	48 89 e5             	mov    %rsp,%rbp
+     202:	48 83 ec 10          	sub    $0x10,%rsp
+     206:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     20a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     20d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     210:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     213:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     216:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     21a:	89 ce                	mov    %ecx,%esi
+     21c:	48 89 c7             	mov    %rax,%rdi
+     21f:	e8 dc fe ff ff       	call   100 <stosb>
+  return dst;
+     224:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     228:	c9                   	leave
+     229:	c3                   	ret
+
+000000000000022a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     22a:	55                   	push   %rbp
+     22b:	48 89 e5             	mov    %rsp,%rbp
+     22e:	48 83 ec 10          	sub    $0x10,%rsp
+     232:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     236:	89 f0                	mov    %esi,%eax
+     238:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     23b:	eb 17                	jmp    254 <strchr+0x2a>
+    if(*s == c)
+     23d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     241:	0f b6 00             	movzbl (%rax),%eax
+     244:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     247:	75 06                	jne    24f <strchr+0x25>
+      return (char*)s;
+     249:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     24d:	eb 15                	jmp    264 <strchr+0x3a>
+  for(; *s; s++)
+     24f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     254:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     258:	0f b6 00             	movzbl (%rax),%eax
+     25b:	84 c0                	test   %al,%al
+     25d:	75 de                	jne    23d <strchr+0x13>
+  return 0;
+     25f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     264:	c9                   	leave
+     265:	c3                   	ret
+
+0000000000000266 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     266:	55                   	push   %rbp
+     267:	48 89 e5             	mov    %rsp,%rbp
+     26a:	48 83 ec 20          	sub    $0x20,%rsp
+     26e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     272:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     275:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     27c:	eb 48                	jmp    2c6 <gets+0x60>
+    cc = read(0, &c, 1);
+     27e:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     282:	ba 01 00 00 00       	mov    $0x1,%edx
+     287:	48 89 c6             	mov    %rax,%rsi
+     28a:	bf 00 00 00 00       	mov    $0x0,%edi
+     28f:	e8 7f 01 00 00       	call   413 <read>
+     294:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     297:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     29b:	7e 36                	jle    2d3 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     29d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2a0:	8d 50 01             	lea    0x1(%rax),%edx
+     2a3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     2a6:	48 63 d0             	movslq %eax,%rdx
+     2a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     2ad:	48 01 c2             	add    %rax,%rdx
+     2b0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     2b4:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     2b6:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     2ba:	3c 0a                	cmp    $0xa,%al
+     2bc:	74 16                	je     2d4 <gets+0x6e>
+     2be:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     2c2:	3c 0d                	cmp    $0xd,%al
+     2c4:	74 0e                	je     2d4 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     2c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2c9:	83 c0 01             	add    $0x1,%eax
+     2cc:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     2cf:	7f ad                	jg     27e <gets+0x18>
+     2d1:	eb 01                	jmp    2d4 <gets+0x6e>
+      break;
+     2d3:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     2d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2d7:	48 63 d0             	movslq %eax,%rdx
+     2da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     2de:	48 01 d0             	add    %rdx,%rax
+     2e1:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     2e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     2e8:	c9                   	leave
+     2e9:	c3                   	ret
+
+00000000000002ea <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     2ea:	55                   	push   %rbp
+     2eb:	48 89 e5             	mov    %rsp,%rbp
+     2ee:	48 83 ec 20          	sub    $0x20,%rsp
+     2f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     2f6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     2fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     2fe:	be 00 00 00 00       	mov    $0x0,%esi
+     303:	48 89 c7             	mov    %rax,%rdi
+     306:	e8 3a 01 00 00       	call   445 <open>
+     30b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     30e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     312:	79 07                	jns    31b <stat+0x31>
+    return -1;
+     314:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     319:	eb 21                	jmp    33c <stat+0x52>
+  r = fstat(fd, st);
+     31b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     31f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     322:	48 89 d6             	mov    %rdx,%rsi
+     325:	89 c7                	mov    %eax,%edi
+     327:	e8 37 01 00 00       	call   463 <fstat>
+     32c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     32f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     332:	89 c7                	mov    %eax,%edi
+     334:	e8 ee 00 00 00       	call   427 <close>
+  return r;
+     339:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     33c:	c9                   	leave
+     33d:	c3                   	ret
+
+000000000000033e <atoi>:
+
+int
+atoi(const char *s)
+{
+     33e:	55                   	push   %rbp
+     33f:	48 89 e5             	mov    %rsp,%rbp
+     342:	48 83 ec 18          	sub    $0x18,%rsp
+     346:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     34a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     351:	eb 28                	jmp    37b <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     353:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     356:	89 d0                	mov    %edx,%eax
+     358:	c1 e0 02             	shl    $0x2,%eax
+     35b:	01 d0                	add    %edx,%eax
+     35d:	01 c0                	add    %eax,%eax
+     35f:	89 c1                	mov    %eax,%ecx
+     361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     365:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     369:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     36d:	0f b6 00             	movzbl (%rax),%eax
+     370:	0f be c0             	movsbl %al,%eax
+     373:	01 c8                	add    %ecx,%eax
+     375:	83 e8 30             	sub    $0x30,%eax
+     378:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     37b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     37f:	0f b6 00             	movzbl (%rax),%eax
+     382:	3c 2f                	cmp    $0x2f,%al
+     384:	7e 0b                	jle    391 <atoi+0x53>
+     386:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     38a:	0f b6 00             	movzbl (%rax),%eax
+     38d:	3c 39                	cmp    $0x39,%al
+     38f:	7e c2                	jle    353 <atoi+0x15>
+  return n;
+     391:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     394:	c9                   	leave
+     395:	c3                   	ret
+
+0000000000000396 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     396:	55                   	push   %rbp
+     397:	48 89 e5             	mov    %rsp,%rbp
+     39a:	48 83 ec 28          	sub    $0x28,%rsp
+     39e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     3a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     3a6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     3a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     3b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     3b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     3b9:	eb 1d                	jmp    3d8 <memmove+0x42>
+    *dst++ = *src++;
+     3bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     3bf:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     3c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     3c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3cb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     3cf:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     3d3:	0f b6 12             	movzbl (%rdx),%edx
+     3d6:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     3d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     3db:	8d 50 ff             	lea    -0x1(%rax),%edx
+     3de:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     3e1:	85 c0                	test   %eax,%eax
+     3e3:	7f d6                	jg     3bb <memmove+0x25>
+  return vdst;
+     3e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     3e9:	c9                   	leave
+     3ea:	c3                   	ret
+
+00000000000003eb <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     3eb:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     3f2:	cd 40                	int    $0x40
+     3f4:	c3                   	ret
+
+00000000000003f5 <exit>:
+SYSCALL_FAST(exit)
+     3f5:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     3fc:	0f 05                	syscall
+     3fe:	c3                   	ret
+
+00000000000003ff <wait>:
+SYSCALL_FAST(wait)
+     3ff:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     406:	0f 05                	syscall
+     408:	c3                   	ret
+
+0000000000000409 <pipe>:
+SYSCALL_FAST(pipe)
+     409:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     410:	0f 05                	syscall
+     412:	c3                   	ret
+
+0000000000000413 <read>:
+SYSCALL_FAST(read)
+     413:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     41a:	0f 05                	syscall
+     41c:	c3                   	ret
+
+000000000000041d <write>:
+SYSCALL_FAST(write)
+     41d:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     424:	0f 05                	syscall
+     426:	c3                   	ret
+
+0000000000000427 <close>:
+SYSCALL_FAST(close)
+     427:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     42e:	0f 05                	syscall
+     430:	c3                   	ret
+
+0000000000000431 <kill>:
+SYSCALL_FAST(kill)
+     431:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     438:	0f 05                	syscall
+     43a:	c3                   	ret
+
+000000000000043b <exec>:
+SYSCALL(exec)
+     43b:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     442:	cd 40                	int    $0x40
+     444:	c3                   	ret
+
+0000000000000445 <open>:
+SYSCALL_FAST(open)
+     445:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     44c:	0f 05                	syscall
+     44e:	c3                   	ret
+
+000000000000044f <mknod>:
+SYSCALL_FAST(mknod)
+     44f:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     456:	0f 05                	syscall
+     458:	c3                   	ret
+
+0000000000000459 <unlink>:
+SYSCALL_FAST(unlink)
+     459:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     460:	0f 05                	syscall
+     462:	c3                   	ret
+
+0000000000000463 <fstat>:
+SYSCALL_FAST(fstat)
+     463:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     46a:	0f 05                	syscall
+     46c:	c3                   	ret
+
+000000000000046d <link>:
+SYSCALL_FAST(link)
+     46d:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     474:	0f 05                	syscall
+     476:	c3                   	ret
+
+0000000000000477 <mkdir>:
+SYSCALL_FAST(mkdir)
+     477:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     47e:	0f 05                	syscall
+     480:	c3                   	ret
+
+0000000000000481 <chdir>:
+SYSCALL_FAST(chdir)
+     481:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     488:	0f 05                	syscall
+     48a:	c3                   	ret
+
+000000000000048b <dup>:
+SYSCALL_FAST(dup)
+     48b:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     492:	0f 05                	syscall
+     494:	c3                   	ret
+
+0000000000000495 <sbrk>:
+SYSCALL_FAST(sbrk)
+     495:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     49c:	0f 05                	syscall
+     49e:	c3                   	ret
+
+000000000000049f <sleep>:
+SYSCALL_FAST(sleep)
+     49f:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     4a6:	0f 05                	syscall
+     4a8:	c3                   	ret
+
+00000000000004a9 <send>:
+SYSCALL_FAST(send)
+     4a9:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     4b0:	0f 05                	syscall
+     4b2:	c3                   	ret
+
+00000000000004b3 <send_recv>:
+SYSCALL_FAST(send_recv)
+     4b3:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     4ba:	0f 05                	syscall
+     4bc:	c3                   	ret
+
+00000000000004bd <recv>:
+SYSCALL_FAST(recv)
+     4bd:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     4c4:	0f 05                	syscall
+     4c6:	c3                   	ret
+
+00000000000004c7 <call>:
+SYSCALL_FAST(call)
+     4c7:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     4ce:	0f 05                	syscall
+     4d0:	c3                   	ret
+
+00000000000004d1 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     4d1:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     4d8:	0f 05                	syscall
+     4da:	c3                   	ret
+
+00000000000004db <send_reg>:
+SYSCALL_REG(send_reg)
+     4db:	41 54                	push   %r12
+     4dd:	41 55                	push   %r13
+     4df:	41 56                	push   %r14
+     4e1:	41 57                	push   %r15
+     4e3:	56                   	push   %rsi
+     4e4:	49 89 f3             	mov    %rsi,%r11
+     4e7:	48 89 d6             	mov    %rdx,%rsi
+     4ea:	49 8b 13             	mov    (%r11),%rdx
+     4ed:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     4f1:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     4f5:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     4f9:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     4fd:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     501:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     505:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     509:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     510:	0f 05                	syscall
+     512:	41 5b                	pop    %r11
+     514:	49 89 13             	mov    %rdx,(%r11)
+     517:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     51b:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     51f:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     523:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     527:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     52b:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     52f:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     533:	41 5f                	pop    %r15
+     535:	41 5e                	pop    %r14
+     537:	41 5d                	pop    %r13
+     539:	41 5c                	pop    %r12
+     53b:	c3                   	ret
+
+000000000000053c <recv_reg>:
+SYSCALL_REG(recv_reg)
+     53c:	41 54                	push   %r12
+     53e:	41 55                	push   %r13
+     540:	41 56                	push   %r14
+     542:	41 57                	push   %r15
+     544:	56                   	push   %rsi
+     545:	49 89 f3             	mov    %rsi,%r11
+     548:	48 89 d6             	mov    %rdx,%rsi
+     54b:	49 8b 13             	mov    (%r11),%rdx
+     54e:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     552:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     556:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     55a:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     55e:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     562:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     566:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     56a:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+     571:	0f 05                	syscall
+     573:	41 5b                	pop    %r11
+     575:	49 89 13             	mov    %rdx,(%r11)
+     578:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     57c:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     580:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     584:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     588:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     58c:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     590:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     594:	41 5f                	pop    %r15
+     596:	41 5e                	pop    %r14
+     598:	41 5d                	pop    %r13
+     59a:	41 5c                	pop    %r12
+     59c:	c3                   	ret
+
+000000000000059d <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+     59d:	41 54                	push   %r12
+     59f:	41 55                	push   %r13
+     5a1:	41 56                	push   %r14
+     5a3:	41 57                	push   %r15
+     5a5:	56                   	push   %rsi
+     5a6:	49 89 f3             	mov    %rsi,%r11
+     5a9:	48 89 d6             	mov    %rdx,%rsi
+     5ac:	49 8b 13             	mov    (%r11),%rdx
+     5af:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     5b3:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     5b7:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     5bb:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     5bf:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     5c3:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     5c7:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     5cb:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+     5d2:	0f 05                	syscall
+     5d4:	41 5b                	pop    %r11
+     5d6:	49 89 13             	mov    %rdx,(%r11)
+     5d9:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     5dd:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     5e1:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     5e5:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     5e9:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     5ed:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     5f1:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     5f5:	41 5f                	pop    %r15
+     5f7:	41 5e                	pop    %r14
+     5f9:	41 5d                	pop    %r13
+     5fb:	41 5c                	pop    %r12
+     5fd:	c3                   	ret
+
+00000000000005fe <call_reg>:
+SYSCALL_REG(call_reg)
+     5fe:	41 54                	push   %r12
+     600:	41 55                	push   %r13
+     602:	41 56                	push   %r14
+     604:	41 57                	push   %r15
+     606:	56                   	push   %rsi
+     607:	49 89 f3             	mov    %rsi,%r11
+     60a:	48 89 d6             	mov    %rdx,%rsi
+     60d:	49 8b 13             	mov    (%r11),%rdx
+     610:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     614:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     618:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     61c:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     620:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     624:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     628:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     62c:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+     633:	0f 05                	syscall
+     635:	41 5b                	pop    %r11
+     637:	49 89 13             	mov    %rdx,(%r11)
+     63a:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     63e:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     642:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     646:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     64a:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     64e:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     652:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     656:	41 5f                	pop    %r15
+     658:	41 5e                	pop    %r14
+     65a:	41 5d                	pop    %r13
+     65c:	41 5c                	pop    %r12
+     65e:	c3                   	ret
+
+000000000000065f <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+     65f:	41 54                	push   %r12
+     661:	41 55                	push   %r13
+     663:	41 56                	push   %r14
+     665:	41 57                	push   %r15
+     667:	56                   	push   %rsi
+     668:	49 89 f3             	mov    %rsi,%r11
+     66b:	48 89 d6             	mov    %rdx,%rsi
+     66e:	49 8b 13             	mov    (%r11),%rdx
+     671:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     675:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     679:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     67d:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     681:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     685:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     689:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     68d:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+     694:	0f 05                	syscall
+     696:	41 5b                	pop    %r11
+     698:	49 89 13             	mov    %rdx,(%r11)
+     69b:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     69f:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     6a3:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     6a7:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     6ab:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     6af:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     6b3:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     6b7:	41 5f                	pop    %r15
+     6b9:	41 5e                	pop    %r14
+     6bb:	41 5d                	pop    %r13
+     6bd:	41 5c                	pop    %r12
+     6bf:	c3                   	ret
+
+00000000000006c0 <sendx>:
+SYSCALL_FAST(sendx)
+     6c0:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+     6c7:	0f 05                	syscall
+     6c9:	c3                   	ret
+
+00000000000006ca <ring_attach>:
+SYSCALL_FAST(ring_attach)
+     6ca:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+     6d1:	0f 05                	syscall
+     6d3:	c3                   	ret
+
+00000000000006d4 <notify>:
+SYSCALL_FAST(notify)
+     6d4:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+     6db:	0f 05                	syscall
+     6dd:	c3                   	ret
+
+00000000000006de <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+     6de:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+     6e5:	0f 05                	syscall
+     6e7:	c3                   	ret
+
+00000000000006e8 <send_timed>:
+SYSCALL_FAST(send_timed)
+     6e8:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+     6ef:	0f 05                	syscall
+     6f1:	c3                   	ret
+
+00000000000006f2 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+     6f2:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+     6f9:	0f 05                	syscall
+     6fb:	c3                   	ret
+
+00000000000006fc <set_add>:
+SYSCALL_FAST(set_add)
+     6fc:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+     703:	0f 05                	syscall
+     705:	c3                   	ret
+
+0000000000000706 <set_del>:
+SYSCALL_FAST(set_del)
+     706:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+     70d:	0f 05                	syscall
+     70f:	c3                   	ret
+
+0000000000000710 <recv_any>:
+SYSCALL_FAST(recv_any)
+     710:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+     717:	0f 05                	syscall
+     719:	c3                   	ret
+
+000000000000071a <ep_create>:
+SYSCALL_FAST(ep_create)
+     71a:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+     721:	0f 05                	syscall
+     723:	c3                   	ret
+
+0000000000000724 <ep_close>:
+SYSCALL_FAST(ep_close)
+     724:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+     72b:	0f 05                	syscall
+     72d:	c3                   	ret
+
+000000000000072e <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+     72e:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+     735:	0f 05                	syscall
+     737:	c3                   	ret
+
+0000000000000738 <setprio>:
+SYSCALL_FAST(setprio)
+     738:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+     73f:	0f 05                	syscall
+     741:	c3                   	ret
+
+0000000000000742 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+     742:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+     749:	0f 05                	syscall
+     74b:	c3                   	ret
+
+000000000000074c <sethuge>:
+SYSCALL_FAST(sethuge)
+     74c:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+     753:	0f 05                	syscall
+     755:	c3                   	ret
+
+0000000000000756 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+     756:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+     75d:	0f 05                	syscall
+     75f:	c3                   	ret
+
+0000000000000760 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+     760:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+     767:	0f 05                	syscall
+     769:	c3                   	ret
+
+000000000000076a <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+     76a:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+     771:	0f 05                	syscall
+     773:	c3                   	ret
+
+0000000000000774 <null_call>:
+     774:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+     77b:	0f 05                	syscall
+     77d:	c3                   	ret
+
+000000000000077e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     77e:	55                   	push   %rbp
+     77f:	48 89 e5             	mov    %rsp,%rbp
+     782:	48 83 ec 10          	sub    $0x10,%rsp
+     786:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     789:	89 f0                	mov    %esi,%eax
+     78b:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     78e:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     792:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     795:	ba 01 00 00 00       	mov    $0x1,%edx
+     79a:	48 89 ce             	mov    %rcx,%rsi
+     79d:	89 c7                	mov    %eax,%edi
+     79f:	e8 79 fc ff ff       	call   41d <write>
+}
+     7a4:	90                   	nop
+     7a5:	c9                   	leave
+     7a6:	c3                   	ret
+
+00000000000007a7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     7a7:	55                   	push   %rbp
+     7a8:	48 89 e5             	mov    %rsp,%rbp
+     7ab:	48 83 ec 30          	sub    $0x30,%rsp
+     7af:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     7b2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     7b5:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     7b8:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     7bb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     7c2:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     7c6:	74 17                	je     7df <printint+0x38>
+     7c8:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     7cc:	79 11                	jns    7df <printint+0x38>
+    neg = 1;
+     7ce:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     7d5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     7d8:	f7 d8                	neg    %eax
+     7da:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     7dd:	eb 06                	jmp    7e5 <printint+0x3e>
+  } else {
+    x = xx;
+     7df:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     7e2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     7e5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     7ec:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     7ef:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     7f2:	ba 00 00 00 00       	mov    $0x0,%edx
+     7f7:	f7 f1                	div    %ecx
+     7f9:	89 d1                	mov    %edx,%ecx
+     7fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7fe:	8d 50 01             	lea    0x1(%rax),%edx
+     801:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     804:	89 ca                	mov    %ecx,%edx
+     806:	0f b6 92 70 13 00 00 	movzbl 0x1370(%rdx),%edx
+     80d:	48 98                	cltq
+     80f:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     813:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     816:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     819:	ba 00 00 00 00       	mov    $0x0,%edx
+     81e:	f7 f6                	div    %esi
+     820:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     823:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     827:	75 c3                	jne    7ec <printint+0x45>
+  if(neg)
+     829:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     82d:	74 2b                	je     85a <printint+0xb3>
+    buf[i++] = '-';
+     82f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     832:	8d 50 01             	lea    0x1(%rax),%edx
+     835:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     838:	48 98                	cltq
+     83a:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+     83f:	eb 19                	jmp    85a <printint+0xb3>
+    putc(fd, buf[i]);
+     841:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     844:	48 98                	cltq
+     846:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+     84b:	0f be d0             	movsbl %al,%edx
+     84e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     851:	89 d6                	mov    %edx,%esi
+     853:	89 c7                	mov    %eax,%edi
+     855:	e8 24 ff ff ff       	call   77e <putc>
+  while(--i >= 0)
+     85a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     85e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     862:	79 dd                	jns    841 <printint+0x9a>
+}
+     864:	90                   	nop
+     865:	90                   	nop
+     866:	c9                   	leave
+     867:	c3                   	ret
+
+0000000000000868 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     868:	55                   	push   %rbp
+     869:	48 89 e5             	mov    %rsp,%rbp
+     86c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+     873:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+     879:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+     880:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+     887:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+     88e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+     895:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+     89c:	84 c0                	test   %al,%al
+     89e:	74 20                	je     8c0 <printf+0x58>
+     8a0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+     8a4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+     8a8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+     8ac:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+     8b0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+     8b4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+     8b8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+     8bc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+     8c0:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+     8c7:	00 00 00 
+     8ca:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+     8d1:	00 00 00 
+     8d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     8d8:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+     8df:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+     8e6:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+     8ed:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     8f4:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     8f7:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+     8fe:	00 00 00 
+     901:	e9 a8 02 00 00       	jmp    bae <printf+0x346>
+    c = fmt[i] & 0xff;
+     906:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     90c:	48 63 d0             	movslq %eax,%rdx
+     90f:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     916:	48 01 d0             	add    %rdx,%rax
+     919:	0f b6 00             	movzbl (%rax),%eax
+     91c:	0f be c0             	movsbl %al,%eax
+     91f:	25 ff 00 00 00       	and    $0xff,%eax
+     924:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+     92a:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+     931:	75 35                	jne    968 <printf+0x100>
+      if(c == '%'){
+     933:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     93a:	75 0f                	jne    94b <printf+0xe3>
+        state = '%';
+     93c:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+     943:	00 00 00 
+     946:	e9 5c 02 00 00       	jmp    ba7 <printf+0x33f>
+      } else {
+        putc(fd, c);
+     94b:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     951:	0f be d0             	movsbl %al,%edx
+     954:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     95a:	89 d6                	mov    %edx,%esi
+     95c:	89 c7                	mov    %eax,%edi
+     95e:	e8 1b fe ff ff       	call   77e <putc>
+     963:	e9 3f 02 00 00       	jmp    ba7 <printf+0x33f>
+      }
+    } else if(state == '%'){
+     968:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+     96f:	0f 85 32 02 00 00    	jne    ba7 <printf+0x33f>
+      if(c == 'd'){
+     975:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+     97c:	75 5e                	jne    9dc <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+     97e:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     984:	83 f8 2f             	cmp    $0x2f,%eax
+     987:	77 23                	ja     9ac <printf+0x144>
+     989:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     990:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     996:	89 d2                	mov    %edx,%edx
+     998:	48 01 d0             	add    %rdx,%rax
+     99b:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     9a1:	83 c2 08             	add    $0x8,%edx
+     9a4:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     9aa:	eb 12                	jmp    9be <printf+0x156>
+     9ac:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     9b3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     9b7:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     9be:	8b 30                	mov    (%rax),%esi
+     9c0:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     9c6:	b9 01 00 00 00       	mov    $0x1,%ecx
+     9cb:	ba 0a 00 00 00       	mov    $0xa,%edx
+     9d0:	89 c7                	mov    %eax,%edi
+     9d2:	e8 d0 fd ff ff       	call   7a7 <printint>
+     9d7:	e9 c1 01 00 00       	jmp    b9d <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+     9dc:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+     9e3:	74 09                	je     9ee <printf+0x186>
+     9e5:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+     9ec:	75 5e                	jne    a4c <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+     9ee:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     9f4:	83 f8 2f             	cmp    $0x2f,%eax
+     9f7:	77 23                	ja     a1c <printf+0x1b4>
+     9f9:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     a00:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a06:	89 d2                	mov    %edx,%edx
+     a08:	48 01 d0             	add    %rdx,%rax
+     a0b:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a11:	83 c2 08             	add    $0x8,%edx
+     a14:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     a1a:	eb 12                	jmp    a2e <printf+0x1c6>
+     a1c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     a23:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a27:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     a2e:	8b 30                	mov    (%rax),%esi
+     a30:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     a36:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a3b:	ba 10 00 00 00       	mov    $0x10,%edx
+     a40:	89 c7                	mov    %eax,%edi
+     a42:	e8 60 fd ff ff       	call   7a7 <printint>
+     a47:	e9 51 01 00 00       	jmp    b9d <printf+0x335>
+      } else if(c == 's'){
+     a4c:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+     a53:	0f 85 98 00 00 00    	jne    af1 <printf+0x289>
+        s = va_arg(ap, char*);
+     a59:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     a5f:	83 f8 2f             	cmp    $0x2f,%eax
+     a62:	77 23                	ja     a87 <printf+0x21f>
+     a64:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     a6b:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a71:	89 d2                	mov    %edx,%edx
+     a73:	48 01 d0             	add    %rdx,%rax
+     a76:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a7c:	83 c2 08             	add    $0x8,%edx
+     a7f:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     a85:	eb 12                	jmp    a99 <printf+0x231>
+     a87:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     a8e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a92:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     a99:	48 8b 00             	mov    (%rax),%rax
+     a9c:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+     aa3:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+     aaa:	00 
+     aab:	75 31                	jne    ade <printf+0x276>
+          s = "(null)";
+     aad:	48 c7 85 48 ff ff ff 	movq   $0x1074,-0xb8(%rbp)
+     ab4:	74 10 00 00 
+        while(*s != 0){
+     ab8:	eb 24                	jmp    ade <printf+0x276>
+          putc(fd, *s);
+     aba:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     ac1:	0f b6 00             	movzbl (%rax),%eax
+     ac4:	0f be d0             	movsbl %al,%edx
+     ac7:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     acd:	89 d6                	mov    %edx,%esi
+     acf:	89 c7                	mov    %eax,%edi
+     ad1:	e8 a8 fc ff ff       	call   77e <putc>
+          s++;
+     ad6:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+     add:	01 
+        while(*s != 0){
+     ade:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     ae5:	0f b6 00             	movzbl (%rax),%eax
+     ae8:	84 c0                	test   %al,%al
+     aea:	75 ce                	jne    aba <printf+0x252>
+     aec:	e9 ac 00 00 00       	jmp    b9d <printf+0x335>
+        }
+      } else if(c == 'c'){
+     af1:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+     af8:	75 56                	jne    b50 <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+     afa:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     b00:	83 f8 2f             	cmp    $0x2f,%eax
+     b03:	77 23                	ja     b28 <printf+0x2c0>
+     b05:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     b0c:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b12:	89 d2                	mov    %edx,%edx
+     b14:	48 01 d0             	add    %rdx,%rax
+     b17:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b1d:	83 c2 08             	add    $0x8,%edx
+     b20:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     b26:	eb 12                	jmp    b3a <printf+0x2d2>
+     b28:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     b2f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     b33:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     b3a:	8b 00                	mov    (%rax),%eax
+     b3c:	0f be d0             	movsbl %al,%edx
+     b3f:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b45:	89 d6                	mov    %edx,%esi
+     b47:	89 c7                	mov    %eax,%edi
+     b49:	e8 30 fc ff ff       	call   77e <putc>
+     b4e:	eb 4d                	jmp    b9d <printf+0x335>
+      } else if(c == '%'){
+     b50:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     b57:	75 1a                	jne    b73 <printf+0x30b>
+        putc(fd, c);
+     b59:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     b5f:	0f be d0             	movsbl %al,%edx
+     b62:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b68:	89 d6                	mov    %edx,%esi
+     b6a:	89 c7                	mov    %eax,%edi
+     b6c:	e8 0d fc ff ff       	call   77e <putc>
+     b71:	eb 2a                	jmp    b9d <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     b73:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b79:	be 25 00 00 00       	mov    $0x25,%esi
+     b7e:	89 c7                	mov    %eax,%edi
+     b80:	e8 f9 fb ff ff       	call   77e <putc>
+        putc(fd, c);
+     b85:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     b8b:	0f be d0             	movsbl %al,%edx
+     b8e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b94:	89 d6                	mov    %edx,%esi
+     b96:	89 c7                	mov    %eax,%edi
+     b98:	e8 e1 fb ff ff       	call   77e <putc>
+      }
+      state = 0;
+     b9d:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     ba4:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     ba7:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+     bae:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     bb4:	48 63 d0             	movslq %eax,%rdx
+     bb7:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     bbe:	48 01 d0             	add    %rdx,%rax
+     bc1:	0f b6 00             	movzbl (%rax),%eax
+     bc4:	84 c0                	test   %al,%al
+     bc6:	0f 85 3a fd ff ff    	jne    906 <printf+0x9e>
+    }
+  }
+}
+     bcc:	90                   	nop
+     bcd:	90                   	nop
+     bce:	c9                   	leave
+     bcf:	c3                   	ret
+
+0000000000000bd0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     bd0:	55                   	push   %rbp
+     bd1:	48 89 e5             	mov    %rsp,%rbp
+     bd4:	48 83 ec 18          	sub    $0x18,%rsp
+     bd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     bdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     be0:	48 83 e8 10          	sub    $0x10,%rax
+     be4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     be8:	48 8b 05 b1 07 00 00 	mov    0x7b1(%rip),%rax        # 13a0 <freep>
+     bef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     bf3:	eb 2f                	jmp    c24 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     bf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bf9:	48 8b 00             	mov    (%rax),%rax
+     bfc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c00:	72 17                	jb     c19 <free+0x49>
+     c02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c06:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c0a:	72 2f                	jb     c3b <free+0x6b>
+     c0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c10:	48 8b 00             	mov    (%rax),%rax
+     c13:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     c17:	72 22                	jb     c3b <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c1d:	48 8b 00             	mov    (%rax),%rax
+     c20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     c24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c28:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c2c:	73 c7                	jae    bf5 <free+0x25>
+     c2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c32:	48 8b 00             	mov    (%rax),%rax
+     c35:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     c39:	73 ba                	jae    bf5 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     c3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c3f:	8b 40 08             	mov    0x8(%rax),%eax
+     c42:	89 c0                	mov    %eax,%eax
+     c44:	48 c1 e0 04          	shl    $0x4,%rax
+     c48:	48 89 c2             	mov    %rax,%rdx
+     c4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c4f:	48 01 c2             	add    %rax,%rdx
+     c52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c56:	48 8b 00             	mov    (%rax),%rax
+     c59:	48 39 c2             	cmp    %rax,%rdx
+     c5c:	75 2d                	jne    c8b <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+     c5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c62:	8b 50 08             	mov    0x8(%rax),%edx
+     c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c69:	48 8b 00             	mov    (%rax),%rax
+     c6c:	8b 40 08             	mov    0x8(%rax),%eax
+     c6f:	01 c2                	add    %eax,%edx
+     c71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c75:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     c78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c7c:	48 8b 00             	mov    (%rax),%rax
+     c7f:	48 8b 10             	mov    (%rax),%rdx
+     c82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c86:	48 89 10             	mov    %rdx,(%rax)
+     c89:	eb 0e                	jmp    c99 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+     c8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c8f:	48 8b 10             	mov    (%rax),%rdx
+     c92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c96:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     c99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c9d:	8b 40 08             	mov    0x8(%rax),%eax
+     ca0:	89 c0                	mov    %eax,%eax
+     ca2:	48 c1 e0 04          	shl    $0x4,%rax
+     ca6:	48 89 c2             	mov    %rax,%rdx
+     ca9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cad:	48 01 d0             	add    %rdx,%rax
+     cb0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     cb4:	75 27                	jne    cdd <free+0x10d>
+    p->s.size += bp->s.size;
+     cb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cba:	8b 50 08             	mov    0x8(%rax),%edx
+     cbd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cc1:	8b 40 08             	mov    0x8(%rax),%eax
+     cc4:	01 c2                	add    %eax,%edx
+     cc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cca:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     ccd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cd1:	48 8b 10             	mov    (%rax),%rdx
+     cd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cd8:	48 89 10             	mov    %rdx,(%rax)
+     cdb:	eb 0b                	jmp    ce8 <free+0x118>
+  } else
+    p->s.ptr = bp;
+     cdd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ce1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ce5:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     ce8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cec:	48 89 05 ad 06 00 00 	mov    %rax,0x6ad(%rip)        # 13a0 <freep>
+}
+     cf3:	90                   	nop
+     cf4:	c9                   	leave
+     cf5:	c3                   	ret
+
+0000000000000cf6 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     cf6:	55                   	push   %rbp
+     cf7:	48 89 e5             	mov    %rsp,%rbp
+     cfa:	48 83 ec 20          	sub    $0x20,%rsp
+     cfe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     d01:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     d08:	77 07                	ja     d11 <morecore+0x1b>
+    nu = 4096;
+     d0a:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     d11:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     d14:	c1 e0 04             	shl    $0x4,%eax
+     d17:	89 c7                	mov    %eax,%edi
+     d19:	e8 77 f7 ff ff       	call   495 <sbrk>
+     d1e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     d22:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     d27:	75 07                	jne    d30 <morecore+0x3a>
+    return 0;
+     d29:	b8 00 00 00 00       	mov    $0x0,%eax
+     d2e:	eb 29                	jmp    d59 <morecore+0x63>
+  hp = (Header*)p;
+     d30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d34:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     d38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d3c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     d3f:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     d42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d46:	48 83 c0 10          	add    $0x10,%rax
+     d4a:	48 89 c7             	mov    %rax,%rdi
+     d4d:	e8 7e fe ff ff       	call   bd0 <free>
+  return freep;
+     d52:	48 8b 05 47 06 00 00 	mov    0x647(%rip),%rax        # 13a0 <freep>
+}
+     d59:	c9                   	leave
+     d5a:	c3                   	ret
+
+0000000000000d5b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     d5b:	55                   	push   %rbp
+     d5c:	48 89 e5             	mov    %rsp,%rbp
+     d5f:	48 83 ec 30          	sub    $0x30,%rsp
+     d63:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     d66:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     d69:	48 83 c0 0f          	add    $0xf,%rax
+     d6d:	48 c1 e8 04          	shr    $0x4,%rax
+     d71:	83 c0 01             	add    $0x1,%eax
+     d74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+     d77:	48 8b 05 22 06 00 00 	mov    0x622(%rip),%rax        # 13a0 <freep>
+     d7e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     d82:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     d87:	75 2b                	jne    db4 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+     d89:	48 c7 45 f0 90 13 00 	movq   $0x1390,-0x10(%rbp)
+     d90:	00 
+     d91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d95:	48 89 05 04 06 00 00 	mov    %rax,0x604(%rip)        # 13a0 <freep>
+     d9c:	48 8b 05 fd 05 00 00 	mov    0x5fd(%rip),%rax        # 13a0 <freep>
+     da3:	48 89 05 e6 05 00 00 	mov    %rax,0x5e6(%rip)        # 1390 <base>
+    base.s.size = 0;
+     daa:	c7 05 e4 05 00 00 00 	movl   $0x0,0x5e4(%rip)        # 1398 <base+0x8>
+     db1:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     db4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     db8:	48 8b 00             	mov    (%rax),%rax
+     dbb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     dbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dc3:	8b 40 08             	mov    0x8(%rax),%eax
+     dc6:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     dc9:	72 5f                	jb     e2a <malloc+0xcf>
+      if(p->s.size == nunits)
+     dcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dcf:	8b 40 08             	mov    0x8(%rax),%eax
+     dd2:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     dd5:	75 10                	jne    de7 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+     dd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ddb:	48 8b 10             	mov    (%rax),%rdx
+     dde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     de2:	48 89 10             	mov    %rdx,(%rax)
+     de5:	eb 2e                	jmp    e15 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+     de7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     deb:	8b 40 08             	mov    0x8(%rax),%eax
+     dee:	2b 45 ec             	sub    -0x14(%rbp),%eax
+     df1:	89 c2                	mov    %eax,%edx
+     df3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     df7:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+     dfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dfe:	8b 40 08             	mov    0x8(%rax),%eax
+     e01:	89 c0                	mov    %eax,%eax
+     e03:	48 c1 e0 04          	shl    $0x4,%rax
+     e07:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+     e0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e0f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     e12:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+     e15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e19:	48 89 05 80 05 00 00 	mov    %rax,0x580(%rip)        # 13a0 <freep>
+      return (void*)(p + 1);
+     e20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e24:	48 83 c0 10          	add    $0x10,%rax
+     e28:	eb 41                	jmp    e6b <malloc+0x110>
+    }
+    if(p == freep)
+     e2a:	48 8b 05 6f 05 00 00 	mov    0x56f(%rip),%rax        # 13a0 <freep>
+     e31:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e35:	75 1c                	jne    e53 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+     e37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     e3a:	89 c7                	mov    %eax,%edi
+     e3c:	e8 b5 fe ff ff       	call   cf6 <morecore>
+     e41:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e45:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     e4a:	75 07                	jne    e53 <malloc+0xf8>
+        return 0;
+     e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+     e51:	eb 18                	jmp    e6b <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e57:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     e5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e5f:	48 8b 00             	mov    (%rax),%rax
+     e62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     e66:	e9 54 ff ff ff       	jmp    dbf <malloc+0x64>
+  }
+}
+     e6b:	c9                   	leave
+     e6c:	c3                   	ret
+
+0000000000000e6d <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+     e6d:	55                   	push   %rbp
+     e6e:	48 89 e5             	mov    %rsp,%rbp
+     e71:	53                   	push   %rbx
+     e72:	48 83 ec 38          	sub    $0x38,%rsp
+     e76:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     e79:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     e7d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+     e81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     e85:	8b 40 40             	mov    0x40(%rax),%eax
+     e88:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+     e8b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     e8f:	8b 00                	mov    (%rax),%eax
+     e91:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     e94:	29 c2                	sub    %eax,%edx
+     e96:	83 fa 20             	cmp    $0x20,%edx
+     e99:	75 0a                	jne    ea5 <ring_send+0x38>
+    return -1;
+     e9b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ea0:	e9 93 00 00 00       	jmp    f38 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+     ea5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     ea8:	83 e0 1f             	and    $0x1f,%eax
+     eab:	89 c2                	mov    %eax,%edx
+     ead:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     eb1:	89 d2                	mov    %edx,%edx
+     eb3:	48 83 c2 02          	add    $0x2,%rdx
+     eb7:	48 c1 e2 06          	shl    $0x6,%rdx
+     ebb:	48 01 c2             	add    %rax,%rdx
+     ebe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     ec2:	48 8b 08             	mov    (%rax),%rcx
+     ec5:	48 8b 58 08          	mov    0x8(%rax),%rbx
+     ec9:	48 89 0a             	mov    %rcx,(%rdx)
+     ecc:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+     ed0:	48 8b 48 10          	mov    0x10(%rax),%rcx
+     ed4:	48 8b 58 18          	mov    0x18(%rax),%rbx
+     ed8:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+     edc:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+     ee0:	48 8b 48 20          	mov    0x20(%rax),%rcx
+     ee4:	48 8b 58 28          	mov    0x28(%rax),%rbx
+     ee8:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+     eec:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+     ef0:	48 8b 48 30          	mov    0x30(%rax),%rcx
+     ef4:	48 8b 58 38          	mov    0x38(%rax),%rbx
+     ef8:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+     efc:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+     f00:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+     f06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f09:	8d 50 01             	lea    0x1(%rax),%edx
+     f0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f10:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+     f13:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+     f19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f1d:	8b 00                	mov    (%rax),%eax
+     f1f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     f22:	75 0f                	jne    f33 <ring_send+0xc6>
+    notify(channel, 1);
+     f24:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f27:	be 01 00 00 00       	mov    $0x1,%esi
+     f2c:	89 c7                	mov    %eax,%edi
+     f2e:	e8 a1 f7 ff ff       	call   6d4 <notify>
+  return 0;
+     f33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     f3c:	c9                   	leave
+     f3d:	c3                   	ret
+
+0000000000000f3e <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+     f3e:	55                   	push   %rbp
+     f3f:	48 89 e5             	mov    %rsp,%rbp
+     f42:	53                   	push   %rbx
+     f43:	48 83 ec 38          	sub    $0x38,%rsp
+     f47:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     f4a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     f4e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+     f52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f56:	8b 00                	mov    (%rax),%eax
+     f58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+     f5b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+     f61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f65:	8b 40 40             	mov    0x40(%rax),%eax
+     f68:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     f6b:	75 15                	jne    f82 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+     f6d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f70:	89 c7                	mov    %eax,%edi
+     f72:	e8 67 f7 ff ff       	call   6de <nfy_wait>
+     f77:	85 c0                	test   %eax,%eax
+     f79:	79 e0                	jns    f5b <ring_recv+0x1d>
+      return -1;
+     f7b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f80:	eb 73                	jmp    ff5 <ring_recv+0xb7>
+      break;
+     f82:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+     f83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f86:	83 e0 1f             	and    $0x1f,%eax
+     f89:	89 c1                	mov    %eax,%ecx
+     f8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f8f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+     f93:	89 c9                	mov    %ecx,%ecx
+     f95:	48 83 c1 02          	add    $0x2,%rcx
+     f99:	48 c1 e1 06          	shl    $0x6,%rcx
+     f9d:	48 01 ca             	add    %rcx,%rdx
+     fa0:	48 8b 0a             	mov    (%rdx),%rcx
+     fa3:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+     fa7:	48 89 08             	mov    %rcx,(%rax)
+     faa:	48 89 58 08          	mov    %rbx,0x8(%rax)
+     fae:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+     fb2:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+     fb6:	48 89 48 10          	mov    %rcx,0x10(%rax)
+     fba:	48 89 58 18          	mov    %rbx,0x18(%rax)
+     fbe:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+     fc2:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+     fc6:	48 89 48 20          	mov    %rcx,0x20(%rax)
+     fca:	48 89 58 28          	mov    %rbx,0x28(%rax)
+     fce:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+     fd2:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+     fd6:	48 89 48 30          	mov    %rcx,0x30(%rax)
+     fda:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+     fde:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+     fe4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fe7:	8d 50 01             	lea    0x1(%rax),%edx
+     fea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     fee:	89 10                	mov    %edx,(%rax)
+  return 0;
+     ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     ff5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     ff9:	c9                   	leave
+     ffa:	c3                   	ret
+
+0000000000000ffb <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+     ffb:	55                   	push   %rbp
+     ffc:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+     fff:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1004:	8b 00                	mov    (%rax),%eax
+}
+    1006:	5d                   	pop    %rbp
+    1007:	c3                   	ret
+
+0000000000001008 <getpid>:
+
+int
+getpid(void)
+{
+    1008:	55                   	push   %rbp
+    1009:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    100c:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    1011:	8b 00                	mov    (%rax),%eax
+}
+    1013:	5d                   	pop    %rbp
+    1014:	c3                   	ret
+
+0000000000001015 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    1015:	55                   	push   %rbp
+    1016:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    1019:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    101e:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    1022:	5d                   	pop    %rbp
+    1023:	c3                   	ret
@@ -0,0 +1,2787 @@
+
+fs/ipcbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <rdtscp>:
+
+static uint samples[NSAMPLE];
+
+static inline unsigned long long
+rdtscp(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  uint lo, hi;
+  asm volatile("rdtscp" : "=a" (lo), "=d" (hi) : : "rcx");
+       8:	0f 01 f9             	rdtscp
+       b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+       e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((unsigned long long)hi << 32) | lo;
+      11:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      14:	48 c1 e0 20          	shl    $0x20,%rax
+      18:	48 89 c2             	mov    %rax,%rdx
+      1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      1e:	48 09 d0             	or     %rdx,%rax
+}
+      21:	c9                   	leave
+      22:	c3                   	ret
+
+0000000000000023 <sort>:
+
+static void
+sort(uint *a, int n)
+{
+      23:	55                   	push   %rbp
+      24:	48 89 e5             	mov    %rsp,%rbp
+      27:	48 83 ec 20          	sub    $0x20,%rsp
+      2b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+      2f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int gap, i, j;
+  uint t;
+
+  for(gap = n/2; gap > 0; gap /= 2){
+      32:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+      35:	89 c2                	mov    %eax,%edx
+      37:	c1 ea 1f             	shr    $0x1f,%edx
+      3a:	01 d0                	add    %edx,%eax
+      3c:	d1 f8                	sar    %eax
+      3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      41:	e9 c0 00 00 00       	jmp    106 <sort+0xe3>
+    for(i = gap; i < n; i++){
+      46:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      49:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      4c:	e9 9a 00 00 00       	jmp    eb <sort+0xc8>
+      t = a[i];
+      51:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      54:	48 98                	cltq
+      56:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      5d:	00 
+      5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      62:	48 01 d0             	add    %rdx,%rax
+      65:	8b 00                	mov    (%rax),%eax
+      67:	89 45 f0             	mov    %eax,-0x10(%rbp)
+      for(j = i; j >= gap && a[j-gap] > t; j -= gap)
+      6a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      6d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+      70:	eb 36                	jmp    a8 <sort+0x85>
+        a[j] = a[j-gap];
+      72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      75:	2b 45 fc             	sub    -0x4(%rbp),%eax
+      78:	48 98                	cltq
+      7a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      81:	00 
+      82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      86:	48 01 d0             	add    %rdx,%rax
+      89:	8b 55 f4             	mov    -0xc(%rbp),%edx
+      8c:	48 63 d2             	movslq %edx,%rdx
+      8f:	48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+      96:	00 
+      97:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+      9b:	48 01 ca             	add    %rcx,%rdx
+      9e:	8b 00                	mov    (%rax),%eax
+      a0:	89 02                	mov    %eax,(%rdx)
+      for(j = i; j >= gap && a[j-gap] > t; j -= gap)
+      a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      a5:	29 45 f4             	sub    %eax,-0xc(%rbp)
+      a8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      ab:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+      ae:	7c 1e                	jl     ce <sort+0xab>
+      b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      b3:	2b 45 fc             	sub    -0x4(%rbp),%eax
+      b6:	48 98                	cltq
+      b8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      bf:	00 
+      c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      c4:	48 01 d0             	add    %rdx,%rax
+      c7:	8b 00                	mov    (%rax),%eax
+      c9:	39 45 f0             	cmp    %eax,-0x10(%rbp)
+      cc:	72 a4                	jb     72 <sort+0x4f>
+      a[j] = t;
+      ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      d1:	48 98                	cltq
+      d3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      da:	00 
+      db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      df:	48 01 c2             	add    %rax,%rdx
+      e2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+      e5:	89 02                	mov    %eax,(%rdx)
+    for(i = gap; i < n; i++){
+      e7:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+      eb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      ee:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+      f1:	0f 8c 5a ff ff ff    	jl     51 <sort+0x2e>
+  for(gap = n/2; gap > 0; gap /= 2){
+      f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      fa:	89 c2                	mov    %eax,%edx
+      fc:	c1 ea 1f             	shr    $0x1f,%edx
+      ff:	01 d0                	add    %edx,%eax
+     101:	d1 f8                	sar    %eax
+     103:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     106:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     10a:	0f 8f 36 ff ff ff    	jg     46 <sort+0x23>
+    }
+  }
+}
+     110:	90                   	nop
+     111:	90                   	nop
+     112:	c9                   	leave
+     113:	c3                   	ret
+
+0000000000000114 <report>:
+
+static void
+report(char *test, int size, int eps, int procs)
+{
+     114:	55                   	push   %rbp
+     115:	48 89 e5             	mov    %rsp,%rbp
+     118:	48 83 ec 20          	sub    $0x20,%rsp
+     11c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     120:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     123:	89 55 f0             	mov    %edx,-0x10(%rbp)
+     126:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  sort(samples, NSAMPLE);
+     129:	be 10 27 00 00       	mov    $0x2710,%esi
+     12e:	48 c7 c7 40 20 00 00 	mov    $0x2040,%rdi
+     135:	e8 e9 fe ff ff       	call   23 <sort>
+  printf(1, "ipcbench test=%s size=%d eps=%d procs=%d n=%d min=%d p50=%d p99=%d max=%d\n",
+     13a:	44 8b 05 3b bb 00 00 	mov    0xbb3b(%rip),%r8d        # bc7c <samples+0x9c3c>
+     141:	8b 3d a9 b9 00 00    	mov    0xb9a9(%rip),%edi        # baf0 <samples+0x9ab0>
+     147:	8b 35 13 6d 00 00    	mov    0x6d13(%rip),%esi        # 6e60 <samples+0x4e20>
+     14d:	8b 0d ed 1e 00 00    	mov    0x1eed(%rip),%ecx        # 2040 <samples>
+     153:	44 8b 4d ec          	mov    -0x14(%rbp),%r9d
+     157:	44 8b 55 f0          	mov    -0x10(%rbp),%r10d
+     15b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     15e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     162:	48 83 ec 08          	sub    $0x8,%rsp
+     166:	41 50                	push   %r8
+     168:	57                   	push   %rdi
+     169:	56                   	push   %rsi
+     16a:	51                   	push   %rcx
+     16b:	68 10 27 00 00       	push   $0x2710
+     170:	45 89 d0             	mov    %r10d,%r8d
+     173:	89 d1                	mov    %edx,%ecx
+     175:	48 89 c2             	mov    %rax,%rdx
+     178:	48 c7 c6 c0 1a 00 00 	mov    $0x1ac0,%rsi
+     17f:	bf 01 00 00 00       	mov    $0x1,%edi
+     184:	b8 00 00 00 00       	mov    $0x0,%eax
+     189:	e8 74 11 00 00       	call   1302 <printf>
+     18e:	48 83 c4 30          	add    $0x30,%rsp
+         test, size, eps, procs, NSAMPLE, samples[0], samples[NSAMPLE/2],
+         samples[NSAMPLE*99/100], samples[NSAMPLE-1]);
+}
+     192:	90                   	nop
+     193:	c9                   	leave
+     194:	c3                   	ret
+
+0000000000000195 <null_bench>:
+
+static void
+null_bench(void)
+{
+     195:	55                   	push   %rbp
+     196:	48 89 e5             	mov    %rsp,%rbp
+     199:	48 83 ec 10          	sub    $0x10,%rsp
+  unsigned long long t;
+  int i;
+
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     19d:	c7 45 fc 9c ff ff ff 	movl   $0xffffff9c,-0x4(%rbp)
+     1a4:	eb 37                	jmp    1dd <null_bench+0x48>
+    t = rdtscp();
+     1a6:	e8 55 fe ff ff       	call   0 <rdtscp>
+     1ab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    null_call();
+     1af:	e8 5a 10 00 00       	call   120e <null_call>
+    t = rdtscp() - t;
+     1b4:	e8 47 fe ff ff       	call   0 <rdtscp>
+     1b9:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+     1bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(i >= 0)
+     1c1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     1c5:	78 12                	js     1d9 <null_bench+0x44>
+      samples[i] = t;
+     1c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1cb:	89 c2                	mov    %eax,%edx
+     1cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1d0:	48 98                	cltq
+     1d2:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%rax,4)
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     1d9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1dd:	81 7d fc 0f 27 00 00 	cmpl   $0x270f,-0x4(%rbp)
+     1e4:	7e c0                	jle    1a6 <null_bench+0x11>
+  }
+  report("null_call", 0, 0, 1);
+     1e6:	b9 01 00 00 00       	mov    $0x1,%ecx
+     1eb:	ba 00 00 00 00       	mov    $0x0,%edx
+     1f0:	be 00 00 00 00       	mov    $0x0,%esi
+     1f5:	48 c7 c7 0b 1b 00 00 	mov    $0x1b0b,%rdi
+     1fc:	e8 13 ff ff ff       	call   114 <report>
+}
+     201:	90                   	nop
+     202:	c9                   	leave
+     203:	c3                   	ret
+
+0000000000000204 <cr3_bench>:
+
+static void
+cr3_bench(void)
+{
+     204:	55                   	push   %rbp
+     205:	48 89 e5             	mov    %rsp,%rbp
+     208:	48 83 ec 10          	sub    $0x10,%rsp
+  unsigned long long t;
+  int i;
+
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     20c:	c7 45 fc 9c ff ff ff 	movl   $0xffffff9c,-0x4(%rbp)
+     213:	eb 37                	jmp    24c <cr3_bench+0x48>
+    t = rdtscp();
+     215:	e8 e6 fd ff ff       	call   0 <rdtscp>
+     21a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    cr3_test();
+     21e:	e8 cd 0f 00 00       	call   11f0 <cr3_test>
+    t = rdtscp() - t;
+     223:	e8 d8 fd ff ff       	call   0 <rdtscp>
+     228:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+     22c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(i >= 0)
+     230:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     234:	78 12                	js     248 <cr3_bench+0x44>
+      samples[i] = t;
+     236:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     23a:	89 c2                	mov    %eax,%edx
+     23c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     23f:	48 98                	cltq
+     241:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%rax,4)
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     248:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     24c:	81 7d fc 0f 27 00 00 	cmpl   $0x270f,-0x4(%rbp)
+     253:	7e c0                	jle    215 <cr3_bench+0x11>
+  }
+  report("cr3_reload", 0, 0, 1);
+     255:	b9 01 00 00 00       	mov    $0x1,%ecx
+     25a:	ba 00 00 00 00       	mov    $0x0,%edx
+     25f:	be 00 00 00 00       	mov    $0x0,%esi
+     264:	48 c7 c7 15 1b 00 00 	mov    $0x1b15,%rdi
+     26b:	e8 a4 fe ff ff       	call   114 <report>
+
+  // The in-kernel loop can only be timed as a whole.
+  t = rdtscp();
+     270:	e8 8b fd ff ff       	call   0 <rdtscp>
+     275:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  cr3_kernel(NSAMPLE);
+     279:	bf 10 27 00 00       	mov    $0x2710,%edi
+     27e:	e8 77 0f 00 00       	call   11fa <cr3_kernel>
+  t = (rdtscp() - t) / NSAMPLE;
+     283:	e8 78 fd ff ff       	call   0 <rdtscp>
+     288:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+     28c:	48 ba 4b 59 86 38 d6 	movabs $0x346dc5d63886594b,%rdx
+     293:	c5 6d 34 
+     296:	48 f7 e2             	mul    %rdx
+     299:	48 89 d0             	mov    %rdx,%rax
+     29c:	48 c1 e8 0b          	shr    $0xb,%rax
+     2a0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  printf(1, "ipcbench test=cr3_kernel n=%d mean=%d\n", NSAMPLE, (int)t);
+     2a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2a8:	89 c1                	mov    %eax,%ecx
+     2aa:	ba 10 27 00 00       	mov    $0x2710,%edx
+     2af:	48 c7 c6 20 1b 00 00 	mov    $0x1b20,%rsi
+     2b6:	bf 01 00 00 00       	mov    $0x1,%edi
+     2bb:	b8 00 00 00 00       	mov    $0x0,%eax
+     2c0:	e8 3d 10 00 00       	call   1302 <printf>
+}
+     2c5:	90                   	nop
+     2c6:	c9                   	leave
+     2c7:	c3                   	ret
+
+00000000000002c8 <send_recv_bench>:
+
+// The original symmetric benchmark: both sides in send_recv().
+static void
+send_recv_bench(void)
+{
+     2c8:	55                   	push   %rbp
+     2c9:	48 89 e5             	mov    %rsp,%rbp
+     2cc:	48 83 ec 50          	sub    $0x50,%rsp
+  struct msg m;
+  unsigned long long t;
+  int h, i;
+
+  h = ep_create();
+     2d0:	e8 df 0e 00 00       	call   11b4 <ep_create>
+     2d5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if(fork() == 0){
+     2d8:	e8 a8 0b 00 00       	call   e85 <fork>
+     2dd:	85 c0                	test   %eax,%eax
+     2df:	75 4e                	jne    32f <send_recv_bench+0x67>
+    recv(h, &m);
+     2e1:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     2e5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2e8:	48 89 d6             	mov    %rdx,%rsi
+     2eb:	89 c7                	mov    %eax,%edi
+     2ed:	e8 65 0c 00 00       	call   f57 <recv>
+    for(i = 1; i < WARMUP + NSAMPLE; i++)
+     2f2:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     2f9:	eb 15                	jmp    310 <send_recv_bench+0x48>
+      send_recv(h, &m);
+     2fb:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     2ff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     302:	48 89 d6             	mov    %rdx,%rsi
+     305:	89 c7                	mov    %eax,%edi
+     307:	e8 41 0c 00 00       	call   f4d <send_recv>
+    for(i = 1; i < WARMUP + NSAMPLE; i++)
+     30c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     310:	81 7d fc 73 27 00 00 	cmpl   $0x2773,-0x4(%rbp)
+     317:	7e e2                	jle    2fb <send_recv_bench+0x33>
+    send(h, &m);
+     319:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     31d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     320:	48 89 d6             	mov    %rdx,%rsi
+     323:	89 c7                	mov    %eax,%edi
+     325:	e8 19 0c 00 00       	call   f43 <send>
+    exit();
+     32a:	e8 60 0b 00 00       	call   e8f <exit>
+  }
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     32f:	c7 45 fc 9c ff ff ff 	movl   $0xffffff9c,-0x4(%rbp)
+     336:	eb 43                	jmp    37b <send_recv_bench+0xb3>
+    t = rdtscp();
+     338:	e8 c3 fc ff ff       	call   0 <rdtscp>
+     33d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    send_recv(h, &m);
+     341:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     345:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     348:	48 89 d6             	mov    %rdx,%rsi
+     34b:	89 c7                	mov    %eax,%edi
+     34d:	e8 fb 0b 00 00       	call   f4d <send_recv>
+    t = rdtscp() - t;
+     352:	e8 a9 fc ff ff       	call   0 <rdtscp>
+     357:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+     35b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(i >= 0)
+     35f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     363:	78 12                	js     377 <send_recv_bench+0xaf>
+      samples[i] = t;
+     365:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     369:	89 c2                	mov    %eax,%edx
+     36b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     36e:	48 98                	cltq
+     370:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%rax,4)
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     377:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     37b:	81 7d fc 0f 27 00 00 	cmpl   $0x270f,-0x4(%rbp)
+     382:	7e b4                	jle    338 <send_recv_bench+0x70>
+  }
+  wait();
+     384:	e8 10 0b 00 00       	call   e99 <wait>
+  ep_close(h);
+     389:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     38c:	89 c7                	mov    %eax,%edi
+     38e:	e8 2b 0e 00 00       	call   11be <ep_close>
+  report("send_recv", sizeof(m), 1, 2);
+     393:	b9 02 00 00 00       	mov    $0x2,%ecx
+     398:	ba 01 00 00 00       	mov    $0x1,%edx
+     39d:	be 40 00 00 00       	mov    $0x40,%esi
+     3a2:	48 c7 c7 47 1b 00 00 	mov    $0x1b47,%rdi
+     3a9:	e8 66 fd ff ff       	call   114 <report>
+}
+     3ae:	90                   	nop
+     3af:	c9                   	leave
+     3b0:	c3                   	ret
+
+00000000000003b1 <server>:
+
+// Server answering calls on h until it gets a plain send.  With
+// pages set it unmaps the pages each call brings.
+static void
+server(int h, int pages)
+{
+     3b1:	55                   	push   %rbp
+     3b2:	48 89 e5             	mov    %rsp,%rbp
+     3b5:	48 83 ec 60          	sub    $0x60,%rsp
+     3b9:	89 7d ac             	mov    %edi,-0x54(%rbp)
+     3bc:	89 75 a8             	mov    %esi,-0x58(%rbp)
+  struct msg m;
+  int tok;
+
+  tok = recv(h, &m);
+     3bf:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     3c3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+     3c6:	48 89 d6             	mov    %rdx,%rsi
+     3c9:	89 c7                	mov    %eax,%edi
+     3cb:	e8 87 0b 00 00       	call   f57 <recv>
+     3d0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while(tok > 0){
+     3d3:	eb 49                	jmp    41e <server+0x6d>
+    if(pages){
+     3d5:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+     3d9:	74 20                	je     3fb <server+0x4a>
+      ((char*)(uintp)m.regs[0])[0]++;
+     3db:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3df:	0f b6 10             	movzbl (%rax),%edx
+     3e2:	83 c2 01             	add    $0x1,%edx
+     3e5:	88 10                	mov    %dl,(%rax)
+      sbrk(-pages*PGSIZE);
+     3e7:	8b 55 a8             	mov    -0x58(%rbp),%edx
+     3ea:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ef:	29 d0                	sub    %edx,%eax
+     3f1:	c1 e0 0c             	shl    $0xc,%eax
+     3f4:	89 c7                	mov    %eax,%edi
+     3f6:	e8 34 0b 00 00       	call   f2f <sbrk>
+    }
+    m.regs[0]++;
+     3fb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3ff:	48 83 c0 01          	add    $0x1,%rax
+     403:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    tok = reply_recv(h, &m, tok);
+     407:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     40a:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+     40e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+     411:	48 89 ce             	mov    %rcx,%rsi
+     414:	89 c7                	mov    %eax,%edi
+     416:	e8 50 0b 00 00       	call   f6b <reply_recv>
+     41b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while(tok > 0){
+     41e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     422:	7f b1                	jg     3d5 <server+0x24>
+  }
+  exit();
+     424:	e8 66 0a 00 00       	call   e8f <exit>
+
+0000000000000429 <call_bench>:
+// Time call() from one client while procs-2 other clients keep the
+// server busy.  kind selects how the message travels: 0 in memory,
+// -1 in registers, else as that many mapped pages.
+static void
+call_bench(char *test, int kind, int eps, int procs)
+{
+     429:	55                   	push   %rbp
+     42a:	48 89 e5             	mov    %rsp,%rbp
+     42d:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+     434:	48 89 bd 48 ff ff ff 	mov    %rdi,-0xb8(%rbp)
+     43b:	89 b5 44 ff ff ff    	mov    %esi,-0xbc(%rbp)
+     441:	89 95 40 ff ff ff    	mov    %edx,-0xc0(%rbp)
+     447:	89 8d 3c ff ff ff    	mov    %ecx,-0xc4(%rbp)
+  struct msg m;
+  unsigned long long t;
+  int h[16], set, i, j, k, size;
+  char *buf;
+
+  set = ep_create();
+     44d:	e8 62 0d 00 00       	call   11b4 <ep_create>
+     452:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  h[0] = set;
+     455:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     458:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%rbp)
+  for(i = 1; i < eps; i++){
+     45e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     465:	eb 2e                	jmp    495 <call_bench+0x6c>
+    h[i] = ep_create();
+     467:	e8 48 0d 00 00       	call   11b4 <ep_create>
+     46c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     46f:	48 63 d2             	movslq %edx,%rdx
+     472:	89 84 95 50 ff ff ff 	mov    %eax,-0xb0(%rbp,%rdx,4)
+    set_add(set, h[i]);
+     479:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     47c:	48 98                	cltq
+     47e:	8b 94 85 50 ff ff ff 	mov    -0xb0(%rbp,%rax,4),%edx
+     485:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     488:	89 d6                	mov    %edx,%esi
+     48a:	89 c7                	mov    %eax,%edi
+     48c:	e8 05 0d 00 00       	call   1196 <set_add>
+  for(i = 1; i < eps; i++){
+     491:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     495:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     498:	3b 85 40 ff ff ff    	cmp    -0xc0(%rbp),%eax
+     49e:	7c c7                	jl     467 <call_bench+0x3e>
+  }
+  if(fork() == 0)
+     4a0:	e8 e0 09 00 00       	call   e85 <fork>
+     4a5:	85 c0                	test   %eax,%eax
+     4a7:	75 1c                	jne    4c5 <call_bench+0x9c>
+    server(set, kind > 0 ? kind : 0);
+     4a9:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     4af:	ba 00 00 00 00       	mov    $0x0,%edx
+     4b4:	85 c0                	test   %eax,%eax
+     4b6:	0f 49 d0             	cmovns %eax,%edx
+     4b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     4bc:	89 d6                	mov    %edx,%esi
+     4be:	89 c7                	mov    %eax,%edi
+     4c0:	e8 ec fe ff ff       	call   3b1 <server>
+
+  buf = 0;
+     4c5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+     4cc:	00 
+  if(kind > 0){
+     4cd:	83 bd 44 ff ff ff 00 	cmpl   $0x0,-0xbc(%rbp)
+     4d4:	7e 34                	jle    50a <call_bench+0xe1>
+    buf = sbrk(0);
+     4d6:	bf 00 00 00 00       	mov    $0x0,%edi
+     4db:	e8 4f 0a 00 00       	call   f2f <sbrk>
+     4e0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sbrk((PGSIZE - (uintp)buf % PGSIZE) % PGSIZE);
+     4e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     4e8:	f7 d8                	neg    %eax
+     4ea:	25 ff 0f 00 00       	and    $0xfff,%eax
+     4ef:	89 c7                	mov    %eax,%edi
+     4f1:	e8 39 0a 00 00       	call   f2f <sbrk>
+    buf = sbrk(kind*PGSIZE);
+     4f6:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     4fc:	c1 e0 0c             	shl    $0xc,%eax
+     4ff:	89 c7                	mov    %eax,%edi
+     501:	e8 29 0a 00 00       	call   f2f <sbrk>
+     506:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  }
+  size = kind > 0 ? kind*PGSIZE : sizeof(m);
+     50a:	83 bd 44 ff ff ff 00 	cmpl   $0x0,-0xbc(%rbp)
+     511:	7e 0b                	jle    51e <call_bench+0xf5>
+     513:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     519:	c1 e0 0c             	shl    $0xc,%eax
+     51c:	eb 05                	jmp    523 <call_bench+0xfa>
+     51e:	b8 40 00 00 00       	mov    $0x40,%eax
+     523:	89 45 e8             	mov    %eax,-0x18(%rbp)
+
+  for(k = 1; k < procs - 1; k++){
+     526:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+     52d:	eb 5f                	jmp    58e <call_bench+0x165>
+    if(fork() == 0){
+     52f:	e8 51 09 00 00       	call   e85 <fork>
+     534:	85 c0                	test   %eax,%eax
+     536:	75 52                	jne    58a <call_bench+0x161>
+      for(i = -WARMUP; i < NSAMPLE; i++)
+     538:	c7 45 fc 9c ff ff ff 	movl   $0xffffff9c,-0x4(%rbp)
+     53f:	eb 3b                	jmp    57c <call_bench+0x153>
+        call(h[((i + k) % eps + eps) % eps], &m);
+     541:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     544:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     547:	01 d0                	add    %edx,%eax
+     549:	99                   	cltd
+     54a:	f7 bd 40 ff ff ff    	idivl  -0xc0(%rbp)
+     550:	8b 85 40 ff ff ff    	mov    -0xc0(%rbp),%eax
+     556:	01 d0                	add    %edx,%eax
+     558:	99                   	cltd
+     559:	f7 bd 40 ff ff ff    	idivl  -0xc0(%rbp)
+     55f:	89 d0                	mov    %edx,%eax
+     561:	48 98                	cltq
+     563:	8b 84 85 50 ff ff ff 	mov    -0xb0(%rbp,%rax,4),%eax
+     56a:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+     56e:	48 89 d6             	mov    %rdx,%rsi
+     571:	89 c7                	mov    %eax,%edi
+     573:	e8 e9 09 00 00       	call   f61 <call>
+      for(i = -WARMUP; i < NSAMPLE; i++)
+     578:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     57c:	81 7d fc 0f 27 00 00 	cmpl   $0x270f,-0x4(%rbp)
+     583:	7e bc                	jle    541 <call_bench+0x118>
+      exit();
+     585:	e8 05 09 00 00       	call   e8f <exit>
+  for(k = 1; k < procs - 1; k++){
+     58a:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     58e:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     594:	83 e8 01             	sub    $0x1,%eax
+     597:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     59a:	7c 93                	jl     52f <call_bench+0x106>
+    }
+  }
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     59c:	c7 45 fc 9c ff ff ff 	movl   $0xffffff9c,-0x4(%rbp)
+     5a3:	e9 d5 00 00 00       	jmp    67d <call_bench+0x254>
+    m.regs[0] = (uintp)buf;
+     5a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     5ac:	48 89 45 90          	mov    %rax,-0x70(%rbp)
+    m.regs[1] = kind > 0 ? kind : 0;
+     5b0:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     5b6:	ba 00 00 00 00       	mov    $0x0,%edx
+     5bb:	85 c0                	test   %eax,%eax
+     5bd:	0f 48 c2             	cmovs  %edx,%eax
+     5c0:	48 98                	cltq
+     5c2:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+    j = (i % eps + eps) % eps;   // i is negative while warming up
+     5c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5c9:	99                   	cltd
+     5ca:	f7 bd 40 ff ff ff    	idivl  -0xc0(%rbp)
+     5d0:	8b 85 40 ff ff ff    	mov    -0xc0(%rbp),%eax
+     5d6:	01 d0                	add    %edx,%eax
+     5d8:	99                   	cltd
+     5d9:	f7 bd 40 ff ff ff    	idivl  -0xc0(%rbp)
+     5df:	89 55 e4             	mov    %edx,-0x1c(%rbp)
+    t = rdtscp();
+     5e2:	e8 19 fa ff ff       	call   0 <rdtscp>
+     5e7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if(kind == 0)
+     5eb:	83 bd 44 ff ff ff 00 	cmpl   $0x0,-0xbc(%rbp)
+     5f2:	75 1c                	jne    610 <call_bench+0x1e7>
+      call(h[j], &m);
+     5f4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     5f7:	48 98                	cltq
+     5f9:	8b 84 85 50 ff ff ff 	mov    -0xb0(%rbp,%rax,4),%eax
+     600:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+     604:	48 89 d6             	mov    %rdx,%rsi
+     607:	89 c7                	mov    %eax,%edi
+     609:	e8 53 09 00 00       	call   f61 <call>
+     60e:	eb 44                	jmp    654 <call_bench+0x22b>
+    else if(kind < 0)
+     610:	83 bd 44 ff ff ff 00 	cmpl   $0x0,-0xbc(%rbp)
+     617:	79 1c                	jns    635 <call_bench+0x20c>
+      call_reg(h[j], &m);
+     619:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     61c:	48 98                	cltq
+     61e:	8b 84 85 50 ff ff ff 	mov    -0xb0(%rbp,%rax,4),%eax
+     625:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+     629:	48 89 d6             	mov    %rdx,%rsi
+     62c:	89 c7                	mov    %eax,%edi
+     62e:	e8 65 0a 00 00       	call   1098 <call_reg>
+     633:	eb 1f                	jmp    654 <call_bench+0x22b>
+    else
+      sendx(h[j], &m, SX_MAP|SX_CALL);
+     635:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     638:	48 98                	cltq
+     63a:	8b 84 85 50 ff ff ff 	mov    -0xb0(%rbp,%rax,4),%eax
+     641:	48 8d 4d 90          	lea    -0x70(%rbp),%rcx
+     645:	ba 05 00 00 00       	mov    $0x5,%edx
+     64a:	48 89 ce             	mov    %rcx,%rsi
+     64d:	89 c7                	mov    %eax,%edi
+     64f:	e8 06 0b 00 00       	call   115a <sendx>
+    t = rdtscp() - t;
+     654:	e8 a7 f9 ff ff       	call   0 <rdtscp>
+     659:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+     65d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if(i >= 0)
+     661:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     665:	78 12                	js     679 <call_bench+0x250>
+      samples[i] = t;
+     667:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     66b:	89 c2                	mov    %eax,%edx
+     66d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     670:	48 98                	cltq
+     672:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%rax,4)
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     679:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     67d:	81 7d fc 0f 27 00 00 	cmpl   $0x270f,-0x4(%rbp)
+     684:	0f 8e 1e ff ff ff    	jle    5a8 <call_bench+0x17f>
+  }
+  for(k = 1; k < procs - 1; k++)
+     68a:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+     691:	eb 09                	jmp    69c <call_bench+0x273>
+    wait();
+     693:	e8 01 08 00 00       	call   e99 <wait>
+  for(k = 1; k < procs - 1; k++)
+     698:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     69c:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     6a2:	83 e8 01             	sub    $0x1,%eax
+     6a5:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     6a8:	7c e9                	jl     693 <call_bench+0x26a>
+  send(set, &m);
+     6aa:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+     6ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     6b1:	48 89 d6             	mov    %rdx,%rsi
+     6b4:	89 c7                	mov    %eax,%edi
+     6b6:	e8 88 08 00 00       	call   f43 <send>
+  wait();
+     6bb:	e8 d9 07 00 00       	call   e99 <wait>
+  for(i = 0; i < eps; i++)
+     6c0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     6c7:	eb 17                	jmp    6e0 <call_bench+0x2b7>
+    ep_close(h[i]);
+     6c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6cc:	48 98                	cltq
+     6ce:	8b 84 85 50 ff ff ff 	mov    -0xb0(%rbp,%rax,4),%eax
+     6d5:	89 c7                	mov    %eax,%edi
+     6d7:	e8 e2 0a 00 00       	call   11be <ep_close>
+  for(i = 0; i < eps; i++)
+     6dc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     6e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6e3:	3b 85 40 ff ff ff    	cmp    -0xc0(%rbp),%eax
+     6e9:	7c de                	jl     6c9 <call_bench+0x2a0>
+  if(kind > 0)
+     6eb:	83 bd 44 ff ff ff 00 	cmpl   $0x0,-0xbc(%rbp)
+     6f2:	7e 17                	jle    70b <call_bench+0x2e2>
+    sbrk(-kind*PGSIZE);
+     6f4:	8b 95 44 ff ff ff    	mov    -0xbc(%rbp),%edx
+     6fa:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ff:	29 d0                	sub    %edx,%eax
+     701:	c1 e0 0c             	shl    $0xc,%eax
+     704:	89 c7                	mov    %eax,%edi
+     706:	e8 24 08 00 00       	call   f2f <sbrk>
+  report(test, size, eps, procs);
+     70b:	8b 8d 3c ff ff ff    	mov    -0xc4(%rbp),%ecx
+     711:	8b 95 40 ff ff ff    	mov    -0xc0(%rbp),%edx
+     717:	8b 75 e8             	mov    -0x18(%rbp),%esi
+     71a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     721:	48 89 c7             	mov    %rax,%rdi
+     724:	e8 eb f9 ff ff       	call   114 <report>
+}
+     729:	90                   	nop
+     72a:	c9                   	leave
+     72b:	c3                   	ret
+
+000000000000072c <batch_bench>:
+
+// Pipeline b calls per ipc_batch() entry; samples are per message.
+static void
+batch_bench(int b)
+{
+     72c:	55                   	push   %rbp
+     72d:	48 89 e5             	mov    %rsp,%rbp
+     730:	48 83 ec 70          	sub    $0x70,%rsp
+     734:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  static struct ipcop ops[IPC_MAXBATCH];
+  struct msg m;
+  unsigned long long t;
+  int h, i, j;
+
+  h = ep_create();
+     737:	e8 78 0a 00 00       	call   11b4 <ep_create>
+     73c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if(fork() == 0)
+     73f:	e8 41 07 00 00       	call   e85 <fork>
+     744:	85 c0                	test   %eax,%eax
+     746:	75 0f                	jne    757 <batch_bench+0x2b>
+    server(h, 0);
+     748:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     74b:	be 00 00 00 00       	mov    $0x0,%esi
+     750:	89 c7                	mov    %eax,%edi
+     752:	e8 5a fc ff ff       	call   3b1 <server>
+  for(j = 0; j < b; j++){
+     757:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     75e:	eb 44                	jmp    7a4 <batch_bench+0x78>
+    ops[j].op = IPCOP_CALL;
+     760:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     763:	48 63 d0             	movslq %eax,%rdx
+     766:	48 89 d0             	mov    %rdx,%rax
+     769:	48 c1 e0 02          	shl    $0x2,%rax
+     76d:	48 01 d0             	add    %rdx,%rax
+     770:	48 c1 e0 04          	shl    $0x4,%rax
+     774:	48 05 80 bc 00 00    	add    $0xbc80,%rax
+     77a:	c7 00 04 00 00 00    	movl   $0x4,(%rax)
+    ops[j].ch = h;
+     780:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     783:	48 63 d0             	movslq %eax,%rdx
+     786:	48 89 d0             	mov    %rdx,%rax
+     789:	48 c1 e0 02          	shl    $0x2,%rax
+     78d:	48 01 d0             	add    %rdx,%rax
+     790:	48 c1 e0 04          	shl    $0x4,%rax
+     794:	48 8d 90 84 bc 00 00 	lea    0xbc84(%rax),%rdx
+     79b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     79e:	89 02                	mov    %eax,(%rdx)
+  for(j = 0; j < b; j++){
+     7a0:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     7a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     7a7:	3b 45 9c             	cmp    -0x64(%rbp),%eax
+     7aa:	7c b4                	jl     760 <batch_bench+0x34>
+  }
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     7ac:	c7 45 fc 9c ff ff ff 	movl   $0xffffff9c,-0x4(%rbp)
+     7b3:	eb 51                	jmp    806 <batch_bench+0xda>
+    t = rdtscp();
+     7b5:	e8 46 f8 ff ff       	call   0 <rdtscp>
+     7ba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    ipc_batch(ops, b);
+     7be:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7c1:	89 c6                	mov    %eax,%esi
+     7c3:	48 c7 c7 80 bc 00 00 	mov    $0xbc80,%rdi
+     7ca:	e8 0d 0a 00 00       	call   11dc <ipc_batch>
+    t = (rdtscp() - t) / b;
+     7cf:	e8 2c f8 ff ff       	call   0 <rdtscp>
+     7d4:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+     7d8:	8b 55 9c             	mov    -0x64(%rbp),%edx
+     7db:	48 63 ca             	movslq %edx,%rcx
+     7de:	ba 00 00 00 00       	mov    $0x0,%edx
+     7e3:	48 f7 f1             	div    %rcx
+     7e6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if(i >= 0)
+     7ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     7ee:	78 12                	js     802 <batch_bench+0xd6>
+      samples[i] = t;
+     7f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     7f4:	89 c2                	mov    %eax,%edx
+     7f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7f9:	48 98                	cltq
+     7fb:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%rax,4)
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     802:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     806:	81 7d fc 0f 27 00 00 	cmpl   $0x270f,-0x4(%rbp)
+     80d:	7e a6                	jle    7b5 <batch_bench+0x89>
+  }
+  send(h, &m);
+     80f:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+     813:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     816:	48 89 d6             	mov    %rdx,%rsi
+     819:	89 c7                	mov    %eax,%edi
+     81b:	e8 23 07 00 00       	call   f43 <send>
+  wait();
+     820:	e8 74 06 00 00       	call   e99 <wait>
+  ep_close(h);
+     825:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     828:	89 c7                	mov    %eax,%edi
+     82a:	e8 8f 09 00 00       	call   11be <ep_close>
+  report("call_batch", b*sizeof(m), 1, 2);
+     82f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     832:	48 98                	cltq
+     834:	c1 e0 06             	shl    $0x6,%eax
+     837:	b9 02 00 00 00       	mov    $0x2,%ecx
+     83c:	ba 01 00 00 00       	mov    $0x1,%edx
+     841:	89 c6                	mov    %eax,%esi
+     843:	48 c7 c7 51 1b 00 00 	mov    $0x1b51,%rdi
+     84a:	e8 c5 f8 ff ff       	call   114 <report>
+}
+     84f:	90                   	nop
+     850:	c9                   	leave
+     851:	c3                   	ret
+
+0000000000000852 <hop_bench>:
+// Pass a message around n processes, each in its own address space;
+// samples are per hop.  Stays flat for as long as the TLB entries
+// of all n survive the switches between them.
+static void
+hop_bench(int n)
+{
+     852:	55                   	push   %rbp
+     853:	48 89 e5             	mov    %rsp,%rbp
+     856:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+     85d:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  struct msg m;
+  unsigned long long t;
+  int h[32], i, k;
+
+  for(i = 0; i < n; i++)
+     863:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     86a:	eb 16                	jmp    882 <hop_bench+0x30>
+    h[i] = ep_create();
+     86c:	e8 43 09 00 00       	call   11b4 <ep_create>
+     871:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     874:	48 63 d2             	movslq %edx,%rdx
+     877:	89 84 95 30 ff ff ff 	mov    %eax,-0xd0(%rbp,%rdx,4)
+  for(i = 0; i < n; i++)
+     87e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     882:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     885:	3b 85 2c ff ff ff    	cmp    -0xd4(%rbp),%eax
+     88b:	7c df                	jl     86c <hop_bench+0x1a>
+  for(k = 1; k < n; k++){
+     88d:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+     894:	eb 5b                	jmp    8f1 <hop_bench+0x9f>
+    if(fork() == 0){
+     896:	e8 ea 05 00 00       	call   e85 <fork>
+     89b:	85 c0                	test   %eax,%eax
+     89d:	75 4e                	jne    8ed <hop_bench+0x9b>
+      for(;;){
+        recv(h[k], &m);
+     89f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8a2:	48 98                	cltq
+     8a4:	8b 84 85 30 ff ff ff 	mov    -0xd0(%rbp,%rax,4),%eax
+     8ab:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     8af:	48 89 d6             	mov    %rdx,%rsi
+     8b2:	89 c7                	mov    %eax,%edi
+     8b4:	e8 9e 06 00 00       	call   f57 <recv>
+        send(h[(k + 1) % n], &m);
+     8b9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8bc:	83 c0 01             	add    $0x1,%eax
+     8bf:	99                   	cltd
+     8c0:	f7 bd 2c ff ff ff    	idivl  -0xd4(%rbp)
+     8c6:	89 d0                	mov    %edx,%eax
+     8c8:	48 98                	cltq
+     8ca:	8b 84 85 30 ff ff ff 	mov    -0xd0(%rbp,%rax,4),%eax
+     8d1:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     8d5:	48 89 d6             	mov    %rdx,%rsi
+     8d8:	89 c7                	mov    %eax,%edi
+     8da:	e8 64 06 00 00       	call   f43 <send>
+        if(m.regs[0] == 0)
+     8df:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8e3:	48 85 c0             	test   %rax,%rax
+     8e6:	75 b7                	jne    89f <hop_bench+0x4d>
+          exit();
+     8e8:	e8 a2 05 00 00       	call   e8f <exit>
+  for(k = 1; k < n; k++){
+     8ed:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     8f1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8f4:	3b 85 2c ff ff ff    	cmp    -0xd4(%rbp),%eax
+     8fa:	7c 9a                	jl     896 <hop_bench+0x44>
+      }
+    }
+  }
+  m.regs[0] = 1;
+     8fc:	48 c7 45 b0 01 00 00 	movq   $0x1,-0x50(%rbp)
+     903:	00 
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     904:	c7 45 fc 9c ff ff ff 	movl   $0xffffff9c,-0x4(%rbp)
+     90b:	eb 6b                	jmp    978 <hop_bench+0x126>
+    t = rdtscp();
+     90d:	e8 ee f6 ff ff       	call   0 <rdtscp>
+     912:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    send(h[1], &m);
+     916:	8b 85 34 ff ff ff    	mov    -0xcc(%rbp),%eax
+     91c:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     920:	48 89 d6             	mov    %rdx,%rsi
+     923:	89 c7                	mov    %eax,%edi
+     925:	e8 19 06 00 00       	call   f43 <send>
+    recv(h[0], &m);
+     92a:	8b 85 30 ff ff ff    	mov    -0xd0(%rbp),%eax
+     930:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     934:	48 89 d6             	mov    %rdx,%rsi
+     937:	89 c7                	mov    %eax,%edi
+     939:	e8 19 06 00 00       	call   f57 <recv>
+    t = (rdtscp() - t) / n;
+     93e:	e8 bd f6 ff ff       	call   0 <rdtscp>
+     943:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+     947:	8b 95 2c ff ff ff    	mov    -0xd4(%rbp),%edx
+     94d:	48 63 ca             	movslq %edx,%rcx
+     950:	ba 00 00 00 00       	mov    $0x0,%edx
+     955:	48 f7 f1             	div    %rcx
+     958:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(i >= 0)
+     95c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     960:	78 12                	js     974 <hop_bench+0x122>
+      samples[i] = t;
+     962:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     966:	89 c2                	mov    %eax,%edx
+     968:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     96b:	48 98                	cltq
+     96d:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%rax,4)
+  for(i = -WARMUP; i < NSAMPLE; i++){
+     974:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     978:	81 7d fc 0f 27 00 00 	cmpl   $0x270f,-0x4(%rbp)
+     97f:	7e 8c                	jle    90d <hop_bench+0xbb>
+  }
+  m.regs[0] = 0;
+     981:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+     988:	00 
+  send(h[1], &m);
+     989:	8b 85 34 ff ff ff    	mov    -0xcc(%rbp),%eax
+     98f:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     993:	48 89 d6             	mov    %rdx,%rsi
+     996:	89 c7                	mov    %eax,%edi
+     998:	e8 a6 05 00 00       	call   f43 <send>
+  recv(h[0], &m);
+     99d:	8b 85 30 ff ff ff    	mov    -0xd0(%rbp),%eax
+     9a3:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     9a7:	48 89 d6             	mov    %rdx,%rsi
+     9aa:	89 c7                	mov    %eax,%edi
+     9ac:	e8 a6 05 00 00       	call   f57 <recv>
+  for(k = 1; k < n; k++)
+     9b1:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+     9b8:	eb 09                	jmp    9c3 <hop_bench+0x171>
+    wait();
+     9ba:	e8 da 04 00 00       	call   e99 <wait>
+  for(k = 1; k < n; k++)
+     9bf:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     9c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     9c6:	3b 85 2c ff ff ff    	cmp    -0xd4(%rbp),%eax
+     9cc:	7c ec                	jl     9ba <hop_bench+0x168>
+  for(i = 0; i < n; i++)
+     9ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     9d5:	eb 17                	jmp    9ee <hop_bench+0x19c>
+    ep_close(h[i]);
+     9d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9da:	48 98                	cltq
+     9dc:	8b 84 85 30 ff ff ff 	mov    -0xd0(%rbp,%rax,4),%eax
+     9e3:	89 c7                	mov    %eax,%edi
+     9e5:	e8 d4 07 00 00       	call   11be <ep_close>
+  for(i = 0; i < n; i++)
+     9ea:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     9ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9f1:	3b 85 2c ff ff ff    	cmp    -0xd4(%rbp),%eax
+     9f7:	7c de                	jl     9d7 <hop_bench+0x185>
+  report("hop", sizeof(m), 1, n);
+     9f9:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+     9ff:	89 c1                	mov    %eax,%ecx
+     a01:	ba 01 00 00 00       	mov    $0x1,%edx
+     a06:	be 40 00 00 00       	mov    $0x40,%esi
+     a0b:	48 c7 c7 5c 1b 00 00 	mov    $0x1b5c,%rdi
+     a12:	e8 fd f6 ff ff       	call   114 <report>
+}
+     a17:	90                   	nop
+     a18:	c9                   	leave
+     a19:	c3                   	ret
+
+0000000000000a1a <main>:
+
+int
+main(int argc, char *argv[])
+{
+     a1a:	55                   	push   %rbp
+     a1b:	48 89 e5             	mov    %rsp,%rbp
+     a1e:	48 83 ec 20          	sub    $0x20,%rsp
+     a22:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     a25:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  static int procs[] = { 2, 3, 5 };
+  static int batch[] = { 1, 4, 16 };
+  static int hops[] = { 2, 8, 32 };
+  int i;
+
+  printf(1, "ipcbench start\n");
+     a29:	48 c7 c6 60 1b 00 00 	mov    $0x1b60,%rsi
+     a30:	bf 01 00 00 00       	mov    $0x1,%edi
+     a35:	b8 00 00 00 00       	mov    $0x0,%eax
+     a3a:	e8 c3 08 00 00       	call   1302 <printf>
+  null_bench();
+     a3f:	e8 51 f7 ff ff       	call   195 <null_bench>
+  cr3_bench();
+     a44:	e8 bb f7 ff ff       	call   204 <cr3_bench>
+  send_recv_bench();
+     a49:	e8 7a f8 ff ff       	call   2c8 <send_recv_bench>
+  call_bench("call", 0, 1, 2);
+     a4e:	b9 02 00 00 00       	mov    $0x2,%ecx
+     a53:	ba 01 00 00 00       	mov    $0x1,%edx
+     a58:	be 00 00 00 00       	mov    $0x0,%esi
+     a5d:	48 c7 c7 70 1b 00 00 	mov    $0x1b70,%rdi
+     a64:	e8 c0 f9 ff ff       	call   429 <call_bench>
+  call_bench("call_reg", -1, 1, 2);
+     a69:	b9 02 00 00 00       	mov    $0x2,%ecx
+     a6e:	ba 01 00 00 00       	mov    $0x1,%edx
+     a73:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     a78:	48 c7 c7 75 1b 00 00 	mov    $0x1b75,%rdi
+     a7f:	e8 a5 f9 ff ff       	call   429 <call_bench>
+  for(i = 0; i < NELEM(sizes); i++)
+     a84:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a8b:	eb 28                	jmp    ab5 <main+0x9b>
+    call_bench("call_map", sizes[i], 1, 2);
+     a8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a90:	48 98                	cltq
+     a92:	8b 04 85 d0 1f 00 00 	mov    0x1fd0(,%rax,4),%eax
+     a99:	b9 02 00 00 00       	mov    $0x2,%ecx
+     a9e:	ba 01 00 00 00       	mov    $0x1,%edx
+     aa3:	89 c6                	mov    %eax,%esi
+     aa5:	48 c7 c7 7e 1b 00 00 	mov    $0x1b7e,%rdi
+     aac:	e8 78 f9 ff ff       	call   429 <call_bench>
+  for(i = 0; i < NELEM(sizes); i++)
+     ab1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ab5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ab8:	83 f8 02             	cmp    $0x2,%eax
+     abb:	76 d0                	jbe    a8d <main+0x73>
+  for(i = 0; i < NELEM(eps); i++)
+     abd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ac4:	eb 28                	jmp    aee <main+0xd4>
+    call_bench("call_set", 0, eps[i], 2);
+     ac6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ac9:	48 98                	cltq
+     acb:	8b 04 85 e0 1f 00 00 	mov    0x1fe0(,%rax,4),%eax
+     ad2:	b9 02 00 00 00       	mov    $0x2,%ecx
+     ad7:	89 c2                	mov    %eax,%edx
+     ad9:	be 00 00 00 00       	mov    $0x0,%esi
+     ade:	48 c7 c7 87 1b 00 00 	mov    $0x1b87,%rdi
+     ae5:	e8 3f f9 ff ff       	call   429 <call_bench>
+  for(i = 0; i < NELEM(eps); i++)
+     aea:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     aee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     af1:	83 f8 02             	cmp    $0x2,%eax
+     af4:	76 d0                	jbe    ac6 <main+0xac>
+  for(i = 0; i < NELEM(procs); i++)
+     af6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     afd:	eb 28                	jmp    b27 <main+0x10d>
+    call_bench("call_shared", 0, 1, procs[i]);
+     aff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b02:	48 98                	cltq
+     b04:	8b 04 85 f0 1f 00 00 	mov    0x1ff0(,%rax,4),%eax
+     b0b:	89 c1                	mov    %eax,%ecx
+     b0d:	ba 01 00 00 00       	mov    $0x1,%edx
+     b12:	be 00 00 00 00       	mov    $0x0,%esi
+     b17:	48 c7 c7 90 1b 00 00 	mov    $0x1b90,%rdi
+     b1e:	e8 06 f9 ff ff       	call   429 <call_bench>
+  for(i = 0; i < NELEM(procs); i++)
+     b23:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b2a:	83 f8 02             	cmp    $0x2,%eax
+     b2d:	76 d0                	jbe    aff <main+0xe5>
+  for(i = 0; i < NELEM(batch); i++)
+     b2f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b36:	eb 17                	jmp    b4f <main+0x135>
+    batch_bench(batch[i]);
+     b38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b3b:	48 98                	cltq
+     b3d:	8b 04 85 00 20 00 00 	mov    0x2000(,%rax,4),%eax
+     b44:	89 c7                	mov    %eax,%edi
+     b46:	e8 e1 fb ff ff       	call   72c <batch_bench>
+  for(i = 0; i < NELEM(batch); i++)
+     b4b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b52:	83 f8 02             	cmp    $0x2,%eax
+     b55:	76 e1                	jbe    b38 <main+0x11e>
+  for(i = 0; i < NELEM(hops); i++)
+     b57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b5e:	eb 17                	jmp    b77 <main+0x15d>
+    hop_bench(hops[i]);
+     b60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b63:	48 98                	cltq
+     b65:	8b 04 85 10 20 00 00 	mov    0x2010(,%rax,4),%eax
+     b6c:	89 c7                	mov    %eax,%edi
+     b6e:	e8 df fc ff ff       	call   852 <hop_bench>
+  for(i = 0; i < NELEM(hops); i++)
+     b73:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b7a:	83 f8 02             	cmp    $0x2,%eax
+     b7d:	76 e1                	jbe    b60 <main+0x146>
+  printf(1, "ipcbench done\n");
+     b7f:	48 c7 c6 9c 1b 00 00 	mov    $0x1b9c,%rsi
+     b86:	bf 01 00 00 00       	mov    $0x1,%edi
+     b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+     b90:	e8 6d 07 00 00       	call   1302 <printf>
+  exit();
+     b95:	e8 f5 02 00 00       	call   e8f <exit>
+
+0000000000000b9a <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     b9a:	55                   	push   %rbp
+     b9b:	48 89 e5             	mov    %rsp,%rbp
+     b9e:	48 83 ec 10          	sub    $0x10,%rsp
+     ba2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ba6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     ba9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     bac:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     bb0:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     bb3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     bb6:	48 89 ce             	mov    %rcx,%rsi
+     bb9:	48 89 f7             	mov    %rsi,%rdi
+     bbc:	89 d1                	mov    %edx,%ecx
+     bbe:	fc                   	cld
+     bbf:	f3 aa                	rep stos %al,%es:(%rdi)
+     bc1:	89 ca                	mov    %ecx,%edx
+     bc3:	48 89 fe             	mov    %rdi,%rsi
+     bc6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     bca:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     bcd:	90                   	nop
+     bce:	c9                   	leave
+     bcf:	c3                   	ret
+
+0000000000000bd0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     bd0:	55                   	push   %rbp
+     bd1:	48 89 e5             	mov    %rsp,%rbp
+     bd4:	48 83 ec 20          	sub    $0x20,%rsp
+     bd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     bdc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     be0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     be4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     be8:	90                   	nop
+     be9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     bed:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     bf1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     bf5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bf9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     bfd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     c01:	0f b6 12             	movzbl (%rdx),%edx
+     c04:	88 10                	mov    %dl,(%rax)
+     c06:	0f b6 00             	movzbl (%rax),%eax
+     c09:	84 c0                	test   %al,%al
+     c0b:	75 dc                	jne    be9 <strcpy+0x19>
+    ;
+  return os;
+     c0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     c11:	c9                   	leave
+     c12:	c3                   	ret
+
+0000000000000c13 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c13:	55                   	push   %rbp
+     c14:	48 89 e5             	mov    %rsp,%rbp
+     c17:	48 83 ec 10          	sub    $0x10,%rsp
+     c1b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c1f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     c23:	eb 0a                	jmp    c2f <strcmp+0x1c>
+    p++, q++;
+     c25:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     c2a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     c2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c33:	0f b6 00             	movzbl (%rax),%eax
+     c36:	84 c0                	test   %al,%al
+     c38:	74 12                	je     c4c <strcmp+0x39>
+     c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c3e:	0f b6 10             	movzbl (%rax),%edx
+     c41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c45:	0f b6 00             	movzbl (%rax),%eax
+     c48:	38 c2                	cmp    %al,%dl
+     c4a:	74 d9                	je     c25 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     c4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c50:	0f b6 00             	movzbl (%rax),%eax
+     c53:	0f b6 d0             	movzbl %al,%edx
+     c56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c5a:	0f b6 00             	movzbl (%rax),%eax
+     c5d:	0f b6 c0             	movzbl %al,%eax
+     c60:	29 c2                	sub    %eax,%edx
+     c62:	89 d0                	mov    %edx,%eax
+}
+     c64:	c9                   	leave
+     c65:	c3                   	ret
+
+0000000000000c66 <strlen>:
+
+uint
+strlen(char *s)
+{
+     c66:	55                   	push   %rbp
+     c67:	48 89 e5             	mov    %rsp,%rbp
+     c6a:	48 83 ec 18          	sub    $0x18,%rsp
+     c6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     c72:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c79:	eb 04                	jmp    c7f <strlen+0x19>
+     c7b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c82:	48 63 d0             	movslq %eax,%rdx
+     c85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c89:	48 01 d0             	add    %rdx,%rax
+     c8c:	0f b6 00             	movzbl (%rax),%eax
+     c8f:	84 c0                	test   %al,%al
+     c91:	75 e8                	jne    c7b <strlen+0x15>
+    ;
+  return n;
+     c93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     c96:	c9                   	leave
+     c97:	c3                   	ret
+
+0000000000000c98 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     c98:	55                   	push   %rbp
+     c99:	48 89 e5             	mov    %rsp,%rbp
+     c9c:	48 83 ec 10          	sub    $0x10,%rsp
+     ca0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ca4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     ca7:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     caa:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     cad:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     cb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cb4:	89 ce                	mov    %ecx,%esi
+     cb6:	48 89 c7             	mov    %rax,%rdi
+     cb9:	e8 dc fe ff ff       	call   b9a <stosb>
+  return dst;
+     cbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     cc2:	c9                   	leave
+     cc3:	c3                   	ret
+
+0000000000000cc4 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     cc4:	55                   	push   %rbp
+     cc5:	48 89 e5             	mov    %rsp,%rbp
+     cc8:	48 83 ec 10          	sub    $0x10,%rsp
+     ccc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cd0:	89 f0                	mov    %esi,%eax
+     cd2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     cd5:	eb 17                	jmp    cee <strchr+0x2a>
+    if(*s == c)
+     cd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cdb:	0f b6 00             	movzbl (%rax),%eax
+     cde:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     ce1:	75 06                	jne    ce9 <strchr+0x25>
+      return (char*)s;
+     ce3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ce7:	eb 15                	jmp    cfe <strchr+0x3a>
+  for(; *s; s++)
+     ce9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     cee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cf2:	0f b6 00             	movzbl (%rax),%eax
+     cf5:	84 c0                	test   %al,%al
+     cf7:	75 de                	jne    cd7 <strchr+0x13>
+  return 0;
+     cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     cfe:	c9                   	leave
+     cff:	c3                   	ret
+
+0000000000000d00 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     d00:	55                   	push   %rbp
+     d01:	48 89 e5             	mov    %rsp,%rbp
+     d04:	48 83 ec 20          	sub    $0x20,%rsp
+     d08:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d0c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     d0f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d16:	eb 48                	jmp    d60 <gets+0x60>
+    cc = read(0, &c, 1);
+     d18:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     d1c:	ba 01 00 00 00       	mov    $0x1,%edx
+     d21:	48 89 c6             	mov    %rax,%rsi
+     d24:	bf 00 00 00 00       	mov    $0x0,%edi
+     d29:	e8 7f 01 00 00       	call   ead <read>
+     d2e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     d31:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     d35:	7e 36                	jle    d6d <gets+0x6d>
+      break;
+    buf[i++] = c;
+     d37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d3a:	8d 50 01             	lea    0x1(%rax),%edx
+     d3d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d40:	48 63 d0             	movslq %eax,%rdx
+     d43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d47:	48 01 c2             	add    %rax,%rdx
+     d4a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d4e:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     d50:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d54:	3c 0a                	cmp    $0xa,%al
+     d56:	74 16                	je     d6e <gets+0x6e>
+     d58:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d5c:	3c 0d                	cmp    $0xd,%al
+     d5e:	74 0e                	je     d6e <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     d60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d63:	83 c0 01             	add    $0x1,%eax
+     d66:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     d69:	7f ad                	jg     d18 <gets+0x18>
+     d6b:	eb 01                	jmp    d6e <gets+0x6e>
+      break;
+     d6d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     d6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d71:	48 63 d0             	movslq %eax,%rdx
+     d74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d78:	48 01 d0             	add    %rdx,%rax
+     d7b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     d7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     d82:	c9                   	leave
+     d83:	c3                   	ret
+
+0000000000000d84 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     d84:	55                   	push   %rbp
+     d85:	48 89 e5             	mov    %rsp,%rbp
+     d88:	48 83 ec 20          	sub    $0x20,%rsp
+     d8c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d90:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d98:	be 00 00 00 00       	mov    $0x0,%esi
+     d9d:	48 89 c7             	mov    %rax,%rdi
+     da0:	e8 3a 01 00 00       	call   edf <open>
+     da5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     da8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     dac:	79 07                	jns    db5 <stat+0x31>
+    return -1;
+     dae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     db3:	eb 21                	jmp    dd6 <stat+0x52>
+  r = fstat(fd, st);
+     db5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     db9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dbc:	48 89 d6             	mov    %rdx,%rsi
+     dbf:	89 c7                	mov    %eax,%edi
+     dc1:	e8 37 01 00 00       	call   efd <fstat>
+     dc6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     dc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dcc:	89 c7                	mov    %eax,%edi
+     dce:	e8 ee 00 00 00       	call   ec1 <close>
+  return r;
+     dd3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     dd6:	c9                   	leave
+     dd7:	c3                   	ret
+
+0000000000000dd8 <atoi>:
+
+int
+atoi(const char *s)
+{
+     dd8:	55                   	push   %rbp
+     dd9:	48 89 e5             	mov    %rsp,%rbp
+     ddc:	48 83 ec 18          	sub    $0x18,%rsp
+     de0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     de4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     deb:	eb 28                	jmp    e15 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     ded:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     df0:	89 d0                	mov    %edx,%eax
+     df2:	c1 e0 02             	shl    $0x2,%eax
+     df5:	01 d0                	add    %edx,%eax
+     df7:	01 c0                	add    %eax,%eax
+     df9:	89 c1                	mov    %eax,%ecx
+     dfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dff:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     e03:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     e07:	0f b6 00             	movzbl (%rax),%eax
+     e0a:	0f be c0             	movsbl %al,%eax
+     e0d:	01 c8                	add    %ecx,%eax
+     e0f:	83 e8 30             	sub    $0x30,%eax
+     e12:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     e15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e19:	0f b6 00             	movzbl (%rax),%eax
+     e1c:	3c 2f                	cmp    $0x2f,%al
+     e1e:	7e 0b                	jle    e2b <atoi+0x53>
+     e20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e24:	0f b6 00             	movzbl (%rax),%eax
+     e27:	3c 39                	cmp    $0x39,%al
+     e29:	7e c2                	jle    ded <atoi+0x15>
+  return n;
+     e2b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     e2e:	c9                   	leave
+     e2f:	c3                   	ret
+
+0000000000000e30 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     e30:	55                   	push   %rbp
+     e31:	48 89 e5             	mov    %rsp,%rbp
+     e34:	48 83 ec 28          	sub    $0x28,%rsp
+     e38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e3c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     e40:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     e43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     e4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e4f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     e53:	eb 1d                	jmp    e72 <memmove+0x42>
+    *dst++ = *src++;
+     e55:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e59:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     e5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     e61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e65:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     e69:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     e6d:	0f b6 12             	movzbl (%rdx),%edx
+     e70:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     e72:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e75:	8d 50 ff             	lea    -0x1(%rax),%edx
+     e78:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     e7b:	85 c0                	test   %eax,%eax
+     e7d:	7f d6                	jg     e55 <memmove+0x25>
+  return vdst;
+     e7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     e83:	c9                   	leave
+     e84:	c3                   	ret
+
+0000000000000e85 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     e85:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     e8c:	cd 40                	int    $0x40
+     e8e:	c3                   	ret
+
+0000000000000e8f <exit>:
+SYSCALL_FAST(exit)
+     e8f:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     e96:	0f 05                	syscall
+     e98:	c3                   	ret
+
+0000000000000e99 <wait>:
+SYSCALL_FAST(wait)
+     e99:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     ea0:	0f 05                	syscall
+     ea2:	c3                   	ret
+
+0000000000000ea3 <pipe>:
+SYSCALL_FAST(pipe)
+     ea3:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     eaa:	0f 05                	syscall
+     eac:	c3                   	ret
+
+0000000000000ead <read>:
+SYSCALL_FAST(read)
+     ead:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     eb4:	0f 05                	syscall
+     eb6:	c3                   	ret
+
+0000000000000eb7 <write>:
+SYSCALL_FAST(write)
+     eb7:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     ebe:	0f 05                	syscall
+     ec0:	c3                   	ret
+
+0000000000000ec1 <close>:
+SYSCALL_FAST(close)
+     ec1:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     ec8:	0f 05                	syscall
+     eca:	c3                   	ret
+
+0000000000000ecb <kill>:
+SYSCALL_FAST(kill)
+     ecb:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     ed2:	0f 05                	syscall
+     ed4:	c3                   	ret
+
+0000000000000ed5 <exec>:
+SYSCALL(exec)
+     ed5:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     edc:	cd 40                	int    $0x40
+     ede:	c3                   	ret
+
+0000000000000edf <open>:
+SYSCALL_FAST(open)
+     edf:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     ee6:	0f 05                	syscall
+     ee8:	c3                   	ret
+
+0000000000000ee9 <mknod>:
+SYSCALL_FAST(mknod)
+     ee9:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     ef0:	0f 05                	syscall
+     ef2:	c3                   	ret
+
+0000000000000ef3 <unlink>:
+SYSCALL_FAST(unlink)
+     ef3:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     efa:	0f 05                	syscall
+     efc:	c3                   	ret
+
+0000000000000efd <fstat>:
+SYSCALL_FAST(fstat)
+     efd:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     f04:	0f 05                	syscall
+     f06:	c3                   	ret
+
+0000000000000f07 <link>:
+SYSCALL_FAST(link)
+     f07:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     f0e:	0f 05                	syscall
+     f10:	c3                   	ret
+
+0000000000000f11 <mkdir>:
+SYSCALL_FAST(mkdir)
+     f11:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     f18:	0f 05                	syscall
+     f1a:	c3                   	ret
+
+0000000000000f1b <chdir>:
+SYSCALL_FAST(chdir)
+     f1b:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     f22:	0f 05                	syscall
+     f24:	c3                   	ret
+
+0000000000000f25 <dup>:
+SYSCALL_FAST(dup)
+     f25:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     f2c:	0f 05                	syscall
+     f2e:	c3                   	ret
+
+0000000000000f2f <sbrk>:
+SYSCALL_FAST(sbrk)
+     f2f:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     f36:	0f 05                	syscall
+     f38:	c3                   	ret
+
+0000000000000f39 <sleep>:
+SYSCALL_FAST(sleep)
+     f39:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     f40:	0f 05                	syscall
+     f42:	c3                   	ret
+
+0000000000000f43 <send>:
+SYSCALL_FAST(send)
+     f43:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     f4a:	0f 05                	syscall
+     f4c:	c3                   	ret
+
+0000000000000f4d <send_recv>:
+SYSCALL_FAST(send_recv)
+     f4d:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     f54:	0f 05                	syscall
+     f56:	c3                   	ret
+
+0000000000000f57 <recv>:
+SYSCALL_FAST(recv)
+     f57:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     f5e:	0f 05                	syscall
+     f60:	c3                   	ret
+
+0000000000000f61 <call>:
+SYSCALL_FAST(call)
+     f61:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     f68:	0f 05                	syscall
+     f6a:	c3                   	ret
+
+0000000000000f6b <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     f6b:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     f72:	0f 05                	syscall
+     f74:	c3                   	ret
+
+0000000000000f75 <send_reg>:
+SYSCALL_REG(send_reg)
+     f75:	41 54                	push   %r12
+     f77:	41 55                	push   %r13
+     f79:	41 56                	push   %r14
+     f7b:	41 57                	push   %r15
+     f7d:	56                   	push   %rsi
+     f7e:	49 89 f3             	mov    %rsi,%r11
+     f81:	48 89 d6             	mov    %rdx,%rsi
+     f84:	49 8b 13             	mov    (%r11),%rdx
+     f87:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     f8b:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     f8f:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     f93:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     f97:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     f9b:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     f9f:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     fa3:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     faa:	0f 05                	syscall
+     fac:	41 5b                	pop    %r11
+     fae:	49 89 13             	mov    %rdx,(%r11)
+     fb1:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     fb5:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     fb9:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     fbd:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     fc1:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     fc5:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     fc9:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     fcd:	41 5f                	pop    %r15
+     fcf:	41 5e                	pop    %r14
+     fd1:	41 5d                	pop    %r13
+     fd3:	41 5c                	pop    %r12
+     fd5:	c3                   	ret
+
+0000000000000fd6 <recv_reg>:
+SYSCALL_REG(recv_reg)
+     fd6:	41 54                	push   %r12
+     fd8:	41 55                	push   %r13
+     fda:	41 56                	push   %r14
+     fdc:	41 57                	push   %r15
+     fde:	56                   	push   %rsi
+     fdf:	49 89 f3             	mov    %rsi,%r11
+     fe2:	48 89 d6             	mov    %rdx,%rsi
+     fe5:	49 8b 13             	mov    (%r11),%rdx
+     fe8:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     fec:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     ff0:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     ff4:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     ff8:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     ffc:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1000:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1004:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+    100b:	0f 05                	syscall
+    100d:	41 5b                	pop    %r11
+    100f:	49 89 13             	mov    %rdx,(%r11)
+    1012:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    1016:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    101a:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    101e:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    1022:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    1026:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    102a:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    102e:	41 5f                	pop    %r15
+    1030:	41 5e                	pop    %r14
+    1032:	41 5d                	pop    %r13
+    1034:	41 5c                	pop    %r12
+    1036:	c3                   	ret
+
+0000000000001037 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+    1037:	41 54                	push   %r12
+    1039:	41 55                	push   %r13
+    103b:	41 56                	push   %r14
+    103d:	41 57                	push   %r15
+    103f:	56                   	push   %rsi
+    1040:	49 89 f3             	mov    %rsi,%r11
+    1043:	48 89 d6             	mov    %rdx,%rsi
+    1046:	49 8b 13             	mov    (%r11),%rdx
+    1049:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    104d:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    1051:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    1055:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    1059:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    105d:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1061:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1065:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+    106c:	0f 05                	syscall
+    106e:	41 5b                	pop    %r11
+    1070:	49 89 13             	mov    %rdx,(%r11)
+    1073:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    1077:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    107b:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    107f:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    1083:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    1087:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    108b:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    108f:	41 5f                	pop    %r15
+    1091:	41 5e                	pop    %r14
+    1093:	41 5d                	pop    %r13
+    1095:	41 5c                	pop    %r12
+    1097:	c3                   	ret
+
+0000000000001098 <call_reg>:
+SYSCALL_REG(call_reg)
+    1098:	41 54                	push   %r12
+    109a:	41 55                	push   %r13
+    109c:	41 56                	push   %r14
+    109e:	41 57                	push   %r15
+    10a0:	56                   	push   %rsi
+    10a1:	49 89 f3             	mov    %rsi,%r11
+    10a4:	48 89 d6             	mov    %rdx,%rsi
+    10a7:	49 8b 13             	mov    (%r11),%rdx
+    10aa:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    10ae:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    10b2:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    10b6:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    10ba:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    10be:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    10c2:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    10c6:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+    10cd:	0f 05                	syscall
+    10cf:	41 5b                	pop    %r11
+    10d1:	49 89 13             	mov    %rdx,(%r11)
+    10d4:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    10d8:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    10dc:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    10e0:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    10e4:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    10e8:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    10ec:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    10f0:	41 5f                	pop    %r15
+    10f2:	41 5e                	pop    %r14
+    10f4:	41 5d                	pop    %r13
+    10f6:	41 5c                	pop    %r12
+    10f8:	c3                   	ret
+
+00000000000010f9 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+    10f9:	41 54                	push   %r12
+    10fb:	41 55                	push   %r13
+    10fd:	41 56                	push   %r14
+    10ff:	41 57                	push   %r15
+    1101:	56                   	push   %rsi
+    1102:	49 89 f3             	mov    %rsi,%r11
+    1105:	48 89 d6             	mov    %rdx,%rsi
+    1108:	49 8b 13             	mov    (%r11),%rdx
+    110b:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    110f:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    1113:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    1117:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    111b:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    111f:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1123:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1127:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+    112e:	0f 05                	syscall
+    1130:	41 5b                	pop    %r11
+    1132:	49 89 13             	mov    %rdx,(%r11)
+    1135:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    1139:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    113d:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    1141:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    1145:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    1149:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    114d:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    1151:	41 5f                	pop    %r15
+    1153:	41 5e                	pop    %r14
+    1155:	41 5d                	pop    %r13
+    1157:	41 5c                	pop    %r12
+    1159:	c3                   	ret
+
+000000000000115a <sendx>:
+SYSCALL_FAST(sendx)
+    115a:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+    1161:	0f 05                	syscall
+    1163:	c3                   	ret
+
+0000000000001164 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+    1164:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+    116b:	0f 05                	syscall
+    116d:	c3                   	ret
+
+000000000000116e <notify>:
+SYSCALL_FAST(notify)
+    116e:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+    1175:	0f 05                	syscall
+    1177:	c3                   	ret
+
+0000000000001178 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+    1178:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+    117f:	0f 05                	syscall
+    1181:	c3                   	ret
+
+0000000000001182 <send_timed>:
+SYSCALL_FAST(send_timed)
+    1182:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+    1189:	0f 05                	syscall
+    118b:	c3                   	ret
+
+000000000000118c <recv_timed>:
+SYSCALL_FAST(recv_timed)
+    118c:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+    1193:	0f 05                	syscall
+    1195:	c3                   	ret
+
+0000000000001196 <set_add>:
+SYSCALL_FAST(set_add)
+    1196:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+    119d:	0f 05                	syscall
+    119f:	c3                   	ret
+
+00000000000011a0 <set_del>:
+SYSCALL_FAST(set_del)
+    11a0:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+    11a7:	0f 05                	syscall
+    11a9:	c3                   	ret
+
+00000000000011aa <recv_any>:
+SYSCALL_FAST(recv_any)
+    11aa:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+    11b1:	0f 05                	syscall
+    11b3:	c3                   	ret
+
+00000000000011b4 <ep_create>:
+SYSCALL_FAST(ep_create)
+    11b4:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+    11bb:	0f 05                	syscall
+    11bd:	c3                   	ret
+
+00000000000011be <ep_close>:
+SYSCALL_FAST(ep_close)
+    11be:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+    11c5:	0f 05                	syscall
+    11c7:	c3                   	ret
+
+00000000000011c8 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+    11c8:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+    11cf:	0f 05                	syscall
+    11d1:	c3                   	ret
+
+00000000000011d2 <setprio>:
+SYSCALL_FAST(setprio)
+    11d2:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+    11d9:	0f 05                	syscall
+    11db:	c3                   	ret
+
+00000000000011dc <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+    11dc:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+    11e3:	0f 05                	syscall
+    11e5:	c3                   	ret
+
+00000000000011e6 <sethuge>:
+SYSCALL_FAST(sethuge)
+    11e6:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+    11ed:	0f 05                	syscall
+    11ef:	c3                   	ret
+
+00000000000011f0 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+    11f0:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+    11f7:	0f 05                	syscall
+    11f9:	c3                   	ret
+
+00000000000011fa <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+    11fa:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+    1201:	0f 05                	syscall
+    1203:	c3                   	ret
+
+0000000000001204 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+    1204:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+    120b:	0f 05                	syscall
+    120d:	c3                   	ret
+
+000000000000120e <null_call>:
+    120e:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+    1215:	0f 05                	syscall
+    1217:	c3                   	ret
+
+0000000000001218 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    1218:	55                   	push   %rbp
+    1219:	48 89 e5             	mov    %rsp,%rbp
+    121c:	48 83 ec 10          	sub    $0x10,%rsp
+    1220:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1223:	89 f0                	mov    %esi,%eax
+    1225:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    1228:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    122c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    122f:	ba 01 00 00 00       	mov    $0x1,%edx
+    1234:	48 89 ce             	mov    %rcx,%rsi
+    1237:	89 c7                	mov    %eax,%edi
+    1239:	e8 79 fc ff ff       	call   eb7 <write>
+}
+    123e:	90                   	nop
+    123f:	c9                   	leave
+    1240:	c3                   	ret
+
+0000000000001241 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1241:	55                   	push   %rbp
+    1242:	48 89 e5             	mov    %rsp,%rbp
+    1245:	48 83 ec 30          	sub    $0x30,%rsp
+    1249:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    124c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    124f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1252:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1255:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    125c:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1260:	74 17                	je     1279 <printint+0x38>
+    1262:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1266:	79 11                	jns    1279 <printint+0x38>
+    neg = 1;
+    1268:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    126f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1272:	f7 d8                	neg    %eax
+    1274:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1277:	eb 06                	jmp    127f <printint+0x3e>
+  } else {
+    x = xx;
+    1279:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    127c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    127f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    1286:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1289:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    128c:	ba 00 00 00 00       	mov    $0x0,%edx
+    1291:	f7 f1                	div    %ecx
+    1293:	89 d1                	mov    %edx,%ecx
+    1295:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1298:	8d 50 01             	lea    0x1(%rax),%edx
+    129b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    129e:	89 ca                	mov    %ecx,%edx
+    12a0:	0f b6 92 20 20 00 00 	movzbl 0x2020(%rdx),%edx
+    12a7:	48 98                	cltq
+    12a9:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    12ad:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    12b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    12b3:	ba 00 00 00 00       	mov    $0x0,%edx
+    12b8:	f7 f6                	div    %esi
+    12ba:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    12bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    12c1:	75 c3                	jne    1286 <printint+0x45>
+  if(neg)
+    12c3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    12c7:	74 2b                	je     12f4 <printint+0xb3>
+    buf[i++] = '-';
+    12c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12cc:	8d 50 01             	lea    0x1(%rax),%edx
+    12cf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    12d2:	48 98                	cltq
+    12d4:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+    12d9:	eb 19                	jmp    12f4 <printint+0xb3>
+    putc(fd, buf[i]);
+    12db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12de:	48 98                	cltq
+    12e0:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+    12e5:	0f be d0             	movsbl %al,%edx
+    12e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    12eb:	89 d6                	mov    %edx,%esi
+    12ed:	89 c7                	mov    %eax,%edi
+    12ef:	e8 24 ff ff ff       	call   1218 <putc>
+  while(--i >= 0)
+    12f4:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    12f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    12fc:	79 dd                	jns    12db <printint+0x9a>
+}
+    12fe:	90                   	nop
+    12ff:	90                   	nop
+    1300:	c9                   	leave
+    1301:	c3                   	ret
+
+0000000000001302 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1302:	55                   	push   %rbp
+    1303:	48 89 e5             	mov    %rsp,%rbp
+    1306:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+    130d:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+    1313:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+    131a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+    1321:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+    1328:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+    132f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+    1336:	84 c0                	test   %al,%al
+    1338:	74 20                	je     135a <printf+0x58>
+    133a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+    133e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+    1342:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+    1346:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+    134a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+    134e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+    1352:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+    1356:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+    135a:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+    1361:	00 00 00 
+    1364:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+    136b:	00 00 00 
+    136e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1372:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+    1379:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+    1380:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+    1387:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+    138e:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+    1391:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+    1398:	00 00 00 
+    139b:	e9 a8 02 00 00       	jmp    1648 <printf+0x346>
+    c = fmt[i] & 0xff;
+    13a0:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+    13a6:	48 63 d0             	movslq %eax,%rdx
+    13a9:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    13b0:	48 01 d0             	add    %rdx,%rax
+    13b3:	0f b6 00             	movzbl (%rax),%eax
+    13b6:	0f be c0             	movsbl %al,%eax
+    13b9:	25 ff 00 00 00       	and    $0xff,%eax
+    13be:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+    13c4:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+    13cb:	75 35                	jne    1402 <printf+0x100>
+      if(c == '%'){
+    13cd:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+    13d4:	75 0f                	jne    13e5 <printf+0xe3>
+        state = '%';
+    13d6:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+    13dd:	00 00 00 
+    13e0:	e9 5c 02 00 00       	jmp    1641 <printf+0x33f>
+      } else {
+        putc(fd, c);
+    13e5:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    13eb:	0f be d0             	movsbl %al,%edx
+    13ee:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    13f4:	89 d6                	mov    %edx,%esi
+    13f6:	89 c7                	mov    %eax,%edi
+    13f8:	e8 1b fe ff ff       	call   1218 <putc>
+    13fd:	e9 3f 02 00 00       	jmp    1641 <printf+0x33f>
+      }
+    } else if(state == '%'){
+    1402:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+    1409:	0f 85 32 02 00 00    	jne    1641 <printf+0x33f>
+      if(c == 'd'){
+    140f:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+    1416:	75 5e                	jne    1476 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+    1418:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    141e:	83 f8 2f             	cmp    $0x2f,%eax
+    1421:	77 23                	ja     1446 <printf+0x144>
+    1423:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    142a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    1430:	89 d2                	mov    %edx,%edx
+    1432:	48 01 d0             	add    %rdx,%rax
+    1435:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    143b:	83 c2 08             	add    $0x8,%edx
+    143e:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    1444:	eb 12                	jmp    1458 <printf+0x156>
+    1446:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    144d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1451:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    1458:	8b 30                	mov    (%rax),%esi
+    145a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1460:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1465:	ba 0a 00 00 00       	mov    $0xa,%edx
+    146a:	89 c7                	mov    %eax,%edi
+    146c:	e8 d0 fd ff ff       	call   1241 <printint>
+    1471:	e9 c1 01 00 00       	jmp    1637 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+    1476:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+    147d:	74 09                	je     1488 <printf+0x186>
+    147f:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+    1486:	75 5e                	jne    14e6 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+    1488:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    148e:	83 f8 2f             	cmp    $0x2f,%eax
+    1491:	77 23                	ja     14b6 <printf+0x1b4>
+    1493:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    149a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    14a0:	89 d2                	mov    %edx,%edx
+    14a2:	48 01 d0             	add    %rdx,%rax
+    14a5:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    14ab:	83 c2 08             	add    $0x8,%edx
+    14ae:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    14b4:	eb 12                	jmp    14c8 <printf+0x1c6>
+    14b6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    14bd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    14c1:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    14c8:	8b 30                	mov    (%rax),%esi
+    14ca:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    14d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    14d5:	ba 10 00 00 00       	mov    $0x10,%edx
+    14da:	89 c7                	mov    %eax,%edi
+    14dc:	e8 60 fd ff ff       	call   1241 <printint>
+    14e1:	e9 51 01 00 00       	jmp    1637 <printf+0x335>
+      } else if(c == 's'){
+    14e6:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+    14ed:	0f 85 98 00 00 00    	jne    158b <printf+0x289>
+        s = va_arg(ap, char*);
+    14f3:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    14f9:	83 f8 2f             	cmp    $0x2f,%eax
+    14fc:	77 23                	ja     1521 <printf+0x21f>
+    14fe:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    1505:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    150b:	89 d2                	mov    %edx,%edx
+    150d:	48 01 d0             	add    %rdx,%rax
+    1510:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    1516:	83 c2 08             	add    $0x8,%edx
+    1519:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    151f:	eb 12                	jmp    1533 <printf+0x231>
+    1521:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    1528:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    152c:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    1533:	48 8b 00             	mov    (%rax),%rax
+    1536:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+    153d:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+    1544:	00 
+    1545:	75 31                	jne    1578 <printf+0x276>
+          s = "(null)";
+    1547:	48 c7 85 48 ff ff ff 	movq   $0x1bab,-0xb8(%rbp)
+    154e:	ab 1b 00 00 
+        while(*s != 0){
+    1552:	eb 24                	jmp    1578 <printf+0x276>
+          putc(fd, *s);
+    1554:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+    155b:	0f b6 00             	movzbl (%rax),%eax
+    155e:	0f be d0             	movsbl %al,%edx
+    1561:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1567:	89 d6                	mov    %edx,%esi
+    1569:	89 c7                	mov    %eax,%edi
+    156b:	e8 a8 fc ff ff       	call   1218 <putc>
+          s++;
+    1570:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+    1577:	01 
+        while(*s != 0){
+    1578:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+    157f:	0f b6 00             	movzbl (%rax),%eax
+    1582:	84 c0                	test   %al,%al
+    1584:	75 ce                	jne    1554 <printf+0x252>
+    1586:	e9 ac 00 00 00       	jmp    1637 <printf+0x335>
+        }
+      } else if(c == 'c'){
+    158b:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+    1592:	75 56                	jne    15ea <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+    1594:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    159a:	83 f8 2f             	cmp    $0x2f,%eax
+    159d:	77 23                	ja     15c2 <printf+0x2c0>
+    159f:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    15a6:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    15ac:	89 d2                	mov    %edx,%edx
+    15ae:	48 01 d0             	add    %rdx,%rax
+    15b1:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    15b7:	83 c2 08             	add    $0x8,%edx
+    15ba:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    15c0:	eb 12                	jmp    15d4 <printf+0x2d2>
+    15c2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    15c9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    15cd:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    15d4:	8b 00                	mov    (%rax),%eax
+    15d6:	0f be d0             	movsbl %al,%edx
+    15d9:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    15df:	89 d6                	mov    %edx,%esi
+    15e1:	89 c7                	mov    %eax,%edi
+    15e3:	e8 30 fc ff ff       	call   1218 <putc>
+    15e8:	eb 4d                	jmp    1637 <printf+0x335>
+      } else if(c == '%'){
+    15ea:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+    15f1:	75 1a                	jne    160d <printf+0x30b>
+        putc(fd, c);
+    15f3:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    15f9:	0f be d0             	movsbl %al,%edx
+    15fc:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1602:	89 d6                	mov    %edx,%esi
+    1604:	89 c7                	mov    %eax,%edi
+    1606:	e8 0d fc ff ff       	call   1218 <putc>
+    160b:	eb 2a                	jmp    1637 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    160d:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1613:	be 25 00 00 00       	mov    $0x25,%esi
+    1618:	89 c7                	mov    %eax,%edi
+    161a:	e8 f9 fb ff ff       	call   1218 <putc>
+        putc(fd, c);
+    161f:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    1625:	0f be d0             	movsbl %al,%edx
+    1628:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    162e:	89 d6                	mov    %edx,%esi
+    1630:	89 c7                	mov    %eax,%edi
+    1632:	e8 e1 fb ff ff       	call   1218 <putc>
+      }
+      state = 0;
+    1637:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+    163e:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+    1641:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+    1648:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+    164e:	48 63 d0             	movslq %eax,%rdx
+    1651:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    1658:	48 01 d0             	add    %rdx,%rax
+    165b:	0f b6 00             	movzbl (%rax),%eax
+    165e:	84 c0                	test   %al,%al
+    1660:	0f 85 3a fd ff ff    	jne    13a0 <printf+0x9e>
+    }
+  }
+}
+    1666:	90                   	nop
+    1667:	90                   	nop
+    1668:	c9                   	leave
+    1669:	c3                   	ret
+
+000000000000166a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    166a:	55                   	push   %rbp
+    166b:	48 89 e5             	mov    %rsp,%rbp
+    166e:	48 83 ec 18          	sub    $0x18,%rsp
+    1672:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1676:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    167a:	48 83 e8 10          	sub    $0x10,%rax
+    167e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1682:	48 8b 05 07 ba 00 00 	mov    0xba07(%rip),%rax        # d090 <freep>
+    1689:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    168d:	eb 2f                	jmp    16be <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    168f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1693:	48 8b 00             	mov    (%rax),%rax
+    1696:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    169a:	72 17                	jb     16b3 <free+0x49>
+    169c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16a0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    16a4:	72 2f                	jb     16d5 <free+0x6b>
+    16a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16aa:	48 8b 00             	mov    (%rax),%rax
+    16ad:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    16b1:	72 22                	jb     16d5 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16b7:	48 8b 00             	mov    (%rax),%rax
+    16ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16c2:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    16c6:	73 c7                	jae    168f <free+0x25>
+    16c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16cc:	48 8b 00             	mov    (%rax),%rax
+    16cf:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    16d3:	73 ba                	jae    168f <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16d9:	8b 40 08             	mov    0x8(%rax),%eax
+    16dc:	89 c0                	mov    %eax,%eax
+    16de:	48 c1 e0 04          	shl    $0x4,%rax
+    16e2:	48 89 c2             	mov    %rax,%rdx
+    16e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e9:	48 01 c2             	add    %rax,%rdx
+    16ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f0:	48 8b 00             	mov    (%rax),%rax
+    16f3:	48 39 c2             	cmp    %rax,%rdx
+    16f6:	75 2d                	jne    1725 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+    16f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16fc:	8b 50 08             	mov    0x8(%rax),%edx
+    16ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1703:	48 8b 00             	mov    (%rax),%rax
+    1706:	8b 40 08             	mov    0x8(%rax),%eax
+    1709:	01 c2                	add    %eax,%edx
+    170b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    170f:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1712:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1716:	48 8b 00             	mov    (%rax),%rax
+    1719:	48 8b 10             	mov    (%rax),%rdx
+    171c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1720:	48 89 10             	mov    %rdx,(%rax)
+    1723:	eb 0e                	jmp    1733 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1725:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1729:	48 8b 10             	mov    (%rax),%rdx
+    172c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1730:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    1733:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1737:	8b 40 08             	mov    0x8(%rax),%eax
+    173a:	89 c0                	mov    %eax,%eax
+    173c:	48 c1 e0 04          	shl    $0x4,%rax
+    1740:	48 89 c2             	mov    %rax,%rdx
+    1743:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1747:	48 01 d0             	add    %rdx,%rax
+    174a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    174e:	75 27                	jne    1777 <free+0x10d>
+    p->s.size += bp->s.size;
+    1750:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1754:	8b 50 08             	mov    0x8(%rax),%edx
+    1757:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    175b:	8b 40 08             	mov    0x8(%rax),%eax
+    175e:	01 c2                	add    %eax,%edx
+    1760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1764:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1767:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    176b:	48 8b 10             	mov    (%rax),%rdx
+    176e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1772:	48 89 10             	mov    %rdx,(%rax)
+    1775:	eb 0b                	jmp    1782 <free+0x118>
+  } else
+    p->s.ptr = bp;
+    1777:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    177b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    177f:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1786:	48 89 05 03 b9 00 00 	mov    %rax,0xb903(%rip)        # d090 <freep>
+}
+    178d:	90                   	nop
+    178e:	c9                   	leave
+    178f:	c3                   	ret
+
+0000000000001790 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1790:	55                   	push   %rbp
+    1791:	48 89 e5             	mov    %rsp,%rbp
+    1794:	48 83 ec 20          	sub    $0x20,%rsp
+    1798:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    179b:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    17a2:	77 07                	ja     17ab <morecore+0x1b>
+    nu = 4096;
+    17a4:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    17ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    17ae:	c1 e0 04             	shl    $0x4,%eax
+    17b1:	89 c7                	mov    %eax,%edi
+    17b3:	e8 77 f7 ff ff       	call   f2f <sbrk>
+    17b8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    17bc:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    17c1:	75 07                	jne    17ca <morecore+0x3a>
+    return 0;
+    17c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    17c8:	eb 29                	jmp    17f3 <morecore+0x63>
+  hp = (Header*)p;
+    17ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    17d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17d6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    17d9:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    17dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17e0:	48 83 c0 10          	add    $0x10,%rax
+    17e4:	48 89 c7             	mov    %rax,%rdi
+    17e7:	e8 7e fe ff ff       	call   166a <free>
+  return freep;
+    17ec:	48 8b 05 9d b8 00 00 	mov    0xb89d(%rip),%rax        # d090 <freep>
+}
+    17f3:	c9                   	leave
+    17f4:	c3                   	ret
+
+00000000000017f5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    17f5:	55                   	push   %rbp
+    17f6:	48 89 e5             	mov    %rsp,%rbp
+    17f9:	48 83 ec 30          	sub    $0x30,%rsp
+    17fd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1800:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1803:	48 83 c0 0f          	add    $0xf,%rax
+    1807:	48 c1 e8 04          	shr    $0x4,%rax
+    180b:	83 c0 01             	add    $0x1,%eax
+    180e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+    1811:	48 8b 05 78 b8 00 00 	mov    0xb878(%rip),%rax        # d090 <freep>
+    1818:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    181c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1821:	75 2b                	jne    184e <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+    1823:	48 c7 45 f0 80 d0 00 	movq   $0xd080,-0x10(%rbp)
+    182a:	00 
+    182b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    182f:	48 89 05 5a b8 00 00 	mov    %rax,0xb85a(%rip)        # d090 <freep>
+    1836:	48 8b 05 53 b8 00 00 	mov    0xb853(%rip),%rax        # d090 <freep>
+    183d:	48 89 05 3c b8 00 00 	mov    %rax,0xb83c(%rip)        # d080 <base>
+    base.s.size = 0;
+    1844:	c7 05 3a b8 00 00 00 	movl   $0x0,0xb83a(%rip)        # d088 <base+0x8>
+    184b:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    184e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1852:	48 8b 00             	mov    (%rax),%rax
+    1855:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1859:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    185d:	8b 40 08             	mov    0x8(%rax),%eax
+    1860:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1863:	72 5f                	jb     18c4 <malloc+0xcf>
+      if(p->s.size == nunits)
+    1865:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1869:	8b 40 08             	mov    0x8(%rax),%eax
+    186c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    186f:	75 10                	jne    1881 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+    1871:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1875:	48 8b 10             	mov    (%rax),%rdx
+    1878:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    187c:	48 89 10             	mov    %rdx,(%rax)
+    187f:	eb 2e                	jmp    18af <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+    1881:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1885:	8b 40 08             	mov    0x8(%rax),%eax
+    1888:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    188b:	89 c2                	mov    %eax,%edx
+    188d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1891:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1894:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1898:	8b 40 08             	mov    0x8(%rax),%eax
+    189b:	89 c0                	mov    %eax,%eax
+    189d:	48 c1 e0 04          	shl    $0x4,%rax
+    18a1:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    18a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18a9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    18ac:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    18af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18b3:	48 89 05 d6 b7 00 00 	mov    %rax,0xb7d6(%rip)        # d090 <freep>
+      return (void*)(p + 1);
+    18ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18be:	48 83 c0 10          	add    $0x10,%rax
+    18c2:	eb 41                	jmp    1905 <malloc+0x110>
+    }
+    if(p == freep)
+    18c4:	48 8b 05 c5 b7 00 00 	mov    0xb7c5(%rip),%rax        # d090 <freep>
+    18cb:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    18cf:	75 1c                	jne    18ed <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+    18d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    18d4:	89 c7                	mov    %eax,%edi
+    18d6:	e8 b5 fe ff ff       	call   1790 <morecore>
+    18db:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18df:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    18e4:	75 07                	jne    18ed <malloc+0xf8>
+        return 0;
+    18e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    18eb:	eb 18                	jmp    1905 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18f1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    18f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18f9:	48 8b 00             	mov    (%rax),%rax
+    18fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1900:	e9 54 ff ff ff       	jmp    1859 <malloc+0x64>
+  }
+}
+    1905:	c9                   	leave
+    1906:	c3                   	ret
+
+0000000000001907 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+    1907:	55                   	push   %rbp
+    1908:	48 89 e5             	mov    %rsp,%rbp
+    190b:	53                   	push   %rbx
+    190c:	48 83 ec 38          	sub    $0x38,%rsp
+    1910:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1913:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1917:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+    191b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    191f:	8b 40 40             	mov    0x40(%rax),%eax
+    1922:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+    1925:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1929:	8b 00                	mov    (%rax),%eax
+    192b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    192e:	29 c2                	sub    %eax,%edx
+    1930:	83 fa 20             	cmp    $0x20,%edx
+    1933:	75 0a                	jne    193f <ring_send+0x38>
+    return -1;
+    1935:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    193a:	e9 93 00 00 00       	jmp    19d2 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+    193f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1942:	83 e0 1f             	and    $0x1f,%eax
+    1945:	89 c2                	mov    %eax,%edx
+    1947:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    194b:	89 d2                	mov    %edx,%edx
+    194d:	48 83 c2 02          	add    $0x2,%rdx
+    1951:	48 c1 e2 06          	shl    $0x6,%rdx
+    1955:	48 01 c2             	add    %rax,%rdx
+    1958:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    195c:	48 8b 08             	mov    (%rax),%rcx
+    195f:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    1963:	48 89 0a             	mov    %rcx,(%rdx)
+    1966:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+    196a:	48 8b 48 10          	mov    0x10(%rax),%rcx
+    196e:	48 8b 58 18          	mov    0x18(%rax),%rbx
+    1972:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+    1976:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+    197a:	48 8b 48 20          	mov    0x20(%rax),%rcx
+    197e:	48 8b 58 28          	mov    0x28(%rax),%rbx
+    1982:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+    1986:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+    198a:	48 8b 48 30          	mov    0x30(%rax),%rcx
+    198e:	48 8b 58 38          	mov    0x38(%rax),%rbx
+    1992:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+    1996:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+    199a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+    19a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    19a3:	8d 50 01             	lea    0x1(%rax),%edx
+    19a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    19aa:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+    19ad:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+    19b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    19b7:	8b 00                	mov    (%rax),%eax
+    19b9:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    19bc:	75 0f                	jne    19cd <ring_send+0xc6>
+    notify(channel, 1);
+    19be:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19c1:	be 01 00 00 00       	mov    $0x1,%esi
+    19c6:	89 c7                	mov    %eax,%edi
+    19c8:	e8 a1 f7 ff ff       	call   116e <notify>
+  return 0;
+    19cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    19d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    19d6:	c9                   	leave
+    19d7:	c3                   	ret
+
+00000000000019d8 <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+    19d8:	55                   	push   %rbp
+    19d9:	48 89 e5             	mov    %rsp,%rbp
+    19dc:	53                   	push   %rbx
+    19dd:	48 83 ec 38          	sub    $0x38,%rsp
+    19e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    19e4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    19e8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+    19ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    19f0:	8b 00                	mov    (%rax),%eax
+    19f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+    19f5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+    19fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    19ff:	8b 40 40             	mov    0x40(%rax),%eax
+    1a02:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1a05:	75 15                	jne    1a1c <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+    1a07:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a0a:	89 c7                	mov    %eax,%edi
+    1a0c:	e8 67 f7 ff ff       	call   1178 <nfy_wait>
+    1a11:	85 c0                	test   %eax,%eax
+    1a13:	79 e0                	jns    19f5 <ring_recv+0x1d>
+      return -1;
+    1a15:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a1a:	eb 73                	jmp    1a8f <ring_recv+0xb7>
+      break;
+    1a1c:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+    1a1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1a20:	83 e0 1f             	and    $0x1f,%eax
+    1a23:	89 c1                	mov    %eax,%ecx
+    1a25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1a29:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1a2d:	89 c9                	mov    %ecx,%ecx
+    1a2f:	48 83 c1 02          	add    $0x2,%rcx
+    1a33:	48 c1 e1 06          	shl    $0x6,%rcx
+    1a37:	48 01 ca             	add    %rcx,%rdx
+    1a3a:	48 8b 0a             	mov    (%rdx),%rcx
+    1a3d:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+    1a41:	48 89 08             	mov    %rcx,(%rax)
+    1a44:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    1a48:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    1a4c:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    1a50:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    1a54:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    1a58:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    1a5c:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    1a60:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    1a64:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    1a68:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    1a6c:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    1a70:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    1a74:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    1a78:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    1a7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1a81:	8d 50 01             	lea    0x1(%rax),%edx
+    1a84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1a88:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1a8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1a93:	c9                   	leave
+    1a94:	c3                   	ret
+
+0000000000001a95 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    1a95:	55                   	push   %rbp
+    1a96:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    1a99:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1a9e:	8b 00                	mov    (%rax),%eax
+}
+    1aa0:	5d                   	pop    %rbp
+    1aa1:	c3                   	ret
+
+0000000000001aa2 <getpid>:
+
+int
+getpid(void)
+{
+    1aa2:	55                   	push   %rbp
+    1aa3:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    1aa6:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    1aab:	8b 00                	mov    (%rax),%eax
+}
+    1aad:	5d                   	pop    %rbp
+    1aae:	c3                   	ret
+
+0000000000001aaf <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    1aaf:	55                   	push   %rbp
+    1ab0:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    1ab3:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1ab8:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    1abc:	5d                   	pop    %rbp
+    1abd:	c3                   	ret
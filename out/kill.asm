@@ -0,0 +1,1719 @@
+
+fs/kill:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+   b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if(argc < 1){
+   f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  13:	7f 1b                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  15:	48 c7 c6 94 0f 00 00 	mov    $0xf94,%rsi
+  1c:	bf 02 00 00 00       	mov    $0x2,%edi
+  21:	b8 00 00 00 00       	mov    $0x0,%eax
+  26:	e8 ad 07 00 00       	call   7d8 <printf>
+    exit();
+  2b:	e8 35 03 00 00       	call   365 <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  37:	eb 2a                	jmp    63 <main+0x63>
+    kill(atoi(argv[i]));
+  39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  3c:	48 98                	cltq
+  3e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  45:	00 
+  46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  4a:	48 01 d0             	add    %rdx,%rax
+  4d:	48 8b 00             	mov    (%rax),%rax
+  50:	48 89 c7             	mov    %rax,%rdi
+  53:	e8 56 02 00 00       	call   2ae <atoi>
+  58:	89 c7                	mov    %eax,%edi
+  5a:	e8 42 03 00 00       	call   3a1 <kill>
+  for(i=1; i<argc; i++)
+  5f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  66:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  69:	7c ce                	jl     39 <main+0x39>
+  exit();
+  6b:	e8 f5 02 00 00       	call   365 <exit>
+
+0000000000000070 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  70:	55                   	push   %rbp
+  71:	48 89 e5             	mov    %rsp,%rbp
+  74:	48 83 ec 10          	sub    $0x10,%rsp
+  78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  7c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  7f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+  82:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  86:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  89:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8c:	48 89 ce             	mov    %rcx,%rsi
+  8f:	48 89 f7             	mov    %rsi,%rdi
+  92:	89 d1                	mov    %edx,%ecx
+  94:	fc                   	cld
+  95:	f3 aa                	rep stos %al,%es:(%rdi)
+  97:	89 ca                	mov    %ecx,%edx
+  99:	48 89 fe             	mov    %rdi,%rsi
+  9c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  a0:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  a3:	90                   	nop
+  a4:	c9                   	leave
+  a5:	c3                   	ret
+
+00000000000000a6 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  a6:	55                   	push   %rbp
+  a7:	48 89 e5             	mov    %rsp,%rbp
+  aa:	48 83 ec 20          	sub    $0x20,%rsp
+  ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  b2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+  b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+  be:	90                   	nop
+  bf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  c3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  c7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  cf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  d3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  d7:	0f b6 12             	movzbl (%rdx),%edx
+  da:	88 10                	mov    %dl,(%rax)
+  dc:	0f b6 00             	movzbl (%rax),%eax
+  df:	84 c0                	test   %al,%al
+  e1:	75 dc                	jne    bf <strcpy+0x19>
+    ;
+  return os;
+  e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  e7:	c9                   	leave
+  e8:	c3                   	ret
+
+00000000000000e9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  e9:	55                   	push   %rbp
+  ea:	48 89 e5             	mov    %rsp,%rbp
+  ed:	48 83 ec 10          	sub    $0x10,%rsp
+  f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  f5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+  f9:	eb 0a                	jmp    105 <strcmp+0x1c>
+    p++, q++;
+  fb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 100:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 105:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 109:	0f b6 00             	movzbl (%rax),%eax
+ 10c:	84 c0                	test   %al,%al
+ 10e:	74 12                	je     122 <strcmp+0x39>
+ 110:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 114:	0f b6 10             	movzbl (%rax),%edx
+ 117:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 11b:	0f b6 00             	movzbl (%rax),%eax
+ 11e:	38 c2                	cmp    %al,%dl
+ 120:	74 d9                	je     fb <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+ 122:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 126:	0f b6 00             	movzbl (%rax),%eax
+ 129:	0f b6 d0             	movzbl %al,%edx
+ 12c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 130:	0f b6 00             	movzbl (%rax),%eax
+ 133:	0f b6 c0             	movzbl %al,%eax
+ 136:	29 c2                	sub    %eax,%edx
+ 138:	89 d0                	mov    %edx,%eax
+}
+ 13a:	c9                   	leave
+ 13b:	c3                   	ret
+
+000000000000013c <strlen>:
+
+uint
+strlen(char *s)
+{
+ 13c:	55                   	push   %rbp
+ 13d:	48 89 e5             	mov    %rsp,%rbp
+ 140:	48 83 ec 18          	sub    $0x18,%rsp
+ 144:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 148:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 14f:	eb 04                	jmp    155 <strlen+0x19>
+ 151:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 155:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 158:	48 63 d0             	movslq %eax,%rdx
+ 15b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 15f:	48 01 d0             	add    %rdx,%rax
+ 162:	0f b6 00             	movzbl (%rax),%eax
+ 165:	84 c0                	test   %al,%al
+ 167:	75 e8                	jne    151 <strlen+0x15>
+    ;
+  return n;
+ 169:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 16c:	c9                   	leave
+ 16d:	c3                   	ret
+
+000000000000016e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 16e:	55                   	push   %rbp
+ 16f:	48 89 e5             	mov    %rsp,%rbp
+ 172:	48 83 ec 10          	sub    $0x10,%rsp
+ 176:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 17a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 17d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 180:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 183:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 186:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 18a:	89 ce                	mov    %ecx,%esi
+ 18c:	48 89 c7             	mov    %rax,%rdi
+ 18f:	e8 dc fe ff ff       	call   70 <stosb>
+  return dst;
+ 194:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 198:	c9                   	leave
+ 199:	c3                   	ret
+
+000000000000019a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 19a:	55                   	push   %rbp
+ 19b:	48 89 e5             	mov    %rsp,%rbp
+ 19e:	48 83 ec 10          	sub    $0x10,%rsp
+ 1a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 1a6:	89 f0                	mov    %esi,%eax
+ 1a8:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 1ab:	eb 17                	jmp    1c4 <strchr+0x2a>
+    if(*s == c)
+ 1ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1b1:	0f b6 00             	movzbl (%rax),%eax
+ 1b4:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 1b7:	75 06                	jne    1bf <strchr+0x25>
+      return (char*)s;
+ 1b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1bd:	eb 15                	jmp    1d4 <strchr+0x3a>
+  for(; *s; s++)
+ 1bf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 1c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1c8:	0f b6 00             	movzbl (%rax),%eax
+ 1cb:	84 c0                	test   %al,%al
+ 1cd:	75 de                	jne    1ad <strchr+0x13>
+  return 0;
+ 1cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1d4:	c9                   	leave
+ 1d5:	c3                   	ret
+
+00000000000001d6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1d6:	55                   	push   %rbp
+ 1d7:	48 89 e5             	mov    %rsp,%rbp
+ 1da:	48 83 ec 20          	sub    $0x20,%rsp
+ 1de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 1e2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1e5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 1ec:	eb 48                	jmp    236 <gets+0x60>
+    cc = read(0, &c, 1);
+ 1ee:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 1f2:	ba 01 00 00 00       	mov    $0x1,%edx
+ 1f7:	48 89 c6             	mov    %rax,%rsi
+ 1fa:	bf 00 00 00 00       	mov    $0x0,%edi
+ 1ff:	e8 7f 01 00 00       	call   383 <read>
+ 204:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 207:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 20b:	7e 36                	jle    243 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 20d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 210:	8d 50 01             	lea    0x1(%rax),%edx
+ 213:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 216:	48 63 d0             	movslq %eax,%rdx
+ 219:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 21d:	48 01 c2             	add    %rax,%rdx
+ 220:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 224:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 226:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 22a:	3c 0a                	cmp    $0xa,%al
+ 22c:	74 16                	je     244 <gets+0x6e>
+ 22e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 232:	3c 0d                	cmp    $0xd,%al
+ 234:	74 0e                	je     244 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 236:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 239:	83 c0 01             	add    $0x1,%eax
+ 23c:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 23f:	7f ad                	jg     1ee <gets+0x18>
+ 241:	eb 01                	jmp    244 <gets+0x6e>
+      break;
+ 243:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 244:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 247:	48 63 d0             	movslq %eax,%rdx
+ 24a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 24e:	48 01 d0             	add    %rdx,%rax
+ 251:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 254:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 258:	c9                   	leave
+ 259:	c3                   	ret
+
+000000000000025a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 25a:	55                   	push   %rbp
+ 25b:	48 89 e5             	mov    %rsp,%rbp
+ 25e:	48 83 ec 20          	sub    $0x20,%rsp
+ 262:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 266:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 26a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 26e:	be 00 00 00 00       	mov    $0x0,%esi
+ 273:	48 89 c7             	mov    %rax,%rdi
+ 276:	e8 3a 01 00 00       	call   3b5 <open>
+ 27b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 27e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 282:	79 07                	jns    28b <stat+0x31>
+    return -1;
+ 284:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 289:	eb 21                	jmp    2ac <stat+0x52>
+  r = fstat(fd, st);
+ 28b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 28f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 292:	48 89 d6             	mov    %rdx,%rsi
+ 295:	89 c7                	mov    %eax,%edi
+ 297:	e8 37 01 00 00       	call   3d3 <fstat>
+ 29c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 29f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2a2:	89 c7                	mov    %eax,%edi
+ 2a4:	e8 ee 00 00 00       	call   397 <close>
+  return r;
+ 2a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 2ac:	c9                   	leave
+ 2ad:	c3                   	ret
+
+00000000000002ae <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2ae:	55                   	push   %rbp
+ 2af:	48 89 e5             	mov    %rsp,%rbp
+ 2b2:	48 83 ec 18          	sub    $0x18,%rsp
+ 2b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 2ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 2c1:	eb 28                	jmp    2eb <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+ 2c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 2c6:	89 d0                	mov    %edx,%eax
+ 2c8:	c1 e0 02             	shl    $0x2,%eax
+ 2cb:	01 d0                	add    %edx,%eax
+ 2cd:	01 c0                	add    %eax,%eax
+ 2cf:	89 c1                	mov    %eax,%ecx
+ 2d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2d5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 2d9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 2dd:	0f b6 00             	movzbl (%rax),%eax
+ 2e0:	0f be c0             	movsbl %al,%eax
+ 2e3:	01 c8                	add    %ecx,%eax
+ 2e5:	83 e8 30             	sub    $0x30,%eax
+ 2e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 2eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2ef:	0f b6 00             	movzbl (%rax),%eax
+ 2f2:	3c 2f                	cmp    $0x2f,%al
+ 2f4:	7e 0b                	jle    301 <atoi+0x53>
+ 2f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2fa:	0f b6 00             	movzbl (%rax),%eax
+ 2fd:	3c 39                	cmp    $0x39,%al
+ 2ff:	7e c2                	jle    2c3 <atoi+0x15>
+  return n;
+ 301:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 304:	c9                   	leave
+ 305:	c3                   	ret
+
+0000000000000306 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 306:	55                   	push   %rbp
+ 307:	48 89 e5             	mov    %rsp,%rbp
+ 30a:	48 83 ec 28          	sub    $0x28,%rsp
+ 30e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 312:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 316:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+ 319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 31d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 321:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 325:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 329:	eb 1d                	jmp    348 <memmove+0x42>
+    *dst++ = *src++;
+ 32b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 32f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 333:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 337:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 33b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 33f:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 343:	0f b6 12             	movzbl (%rdx),%edx
+ 346:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 348:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 34b:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 34e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 351:	85 c0                	test   %eax,%eax
+ 353:	7f d6                	jg     32b <memmove+0x25>
+  return vdst;
+ 355:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 359:	c9                   	leave
+ 35a:	c3                   	ret
+
+000000000000035b <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+ 35b:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+ 362:	cd 40                	int    $0x40
+ 364:	c3                   	ret
+
+0000000000000365 <exit>:
+SYSCALL_FAST(exit)
+ 365:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+ 36c:	0f 05                	syscall
+ 36e:	c3                   	ret
+
+000000000000036f <wait>:
+SYSCALL_FAST(wait)
+ 36f:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+ 376:	0f 05                	syscall
+ 378:	c3                   	ret
+
+0000000000000379 <pipe>:
+SYSCALL_FAST(pipe)
+ 379:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+ 380:	0f 05                	syscall
+ 382:	c3                   	ret
+
+0000000000000383 <read>:
+SYSCALL_FAST(read)
+ 383:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+ 38a:	0f 05                	syscall
+ 38c:	c3                   	ret
+
+000000000000038d <write>:
+SYSCALL_FAST(write)
+ 38d:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+ 394:	0f 05                	syscall
+ 396:	c3                   	ret
+
+0000000000000397 <close>:
+SYSCALL_FAST(close)
+ 397:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+ 39e:	0f 05                	syscall
+ 3a0:	c3                   	ret
+
+00000000000003a1 <kill>:
+SYSCALL_FAST(kill)
+ 3a1:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+ 3a8:	0f 05                	syscall
+ 3aa:	c3                   	ret
+
+00000000000003ab <exec>:
+SYSCALL(exec)
+ 3ab:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+00000000000003b5 <open>:
+SYSCALL_FAST(open)
+ 3b5:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+ 3bc:	0f 05                	syscall
+ 3be:	c3                   	ret
+
+00000000000003bf <mknod>:
+SYSCALL_FAST(mknod)
+ 3bf:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+ 3c6:	0f 05                	syscall
+ 3c8:	c3                   	ret
+
+00000000000003c9 <unlink>:
+SYSCALL_FAST(unlink)
+ 3c9:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+ 3d0:	0f 05                	syscall
+ 3d2:	c3                   	ret
+
+00000000000003d3 <fstat>:
+SYSCALL_FAST(fstat)
+ 3d3:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+ 3da:	0f 05                	syscall
+ 3dc:	c3                   	ret
+
+00000000000003dd <link>:
+SYSCALL_FAST(link)
+ 3dd:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+ 3e4:	0f 05                	syscall
+ 3e6:	c3                   	ret
+
+00000000000003e7 <mkdir>:
+SYSCALL_FAST(mkdir)
+ 3e7:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+ 3ee:	0f 05                	syscall
+ 3f0:	c3                   	ret
+
+00000000000003f1 <chdir>:
+SYSCALL_FAST(chdir)
+ 3f1:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+ 3f8:	0f 05                	syscall
+ 3fa:	c3                   	ret
+
+00000000000003fb <dup>:
+SYSCALL_FAST(dup)
+ 3fb:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+ 402:	0f 05                	syscall
+ 404:	c3                   	ret
+
+0000000000000405 <sbrk>:
+SYSCALL_FAST(sbrk)
+ 405:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+ 40c:	0f 05                	syscall
+ 40e:	c3                   	ret
+
+000000000000040f <sleep>:
+SYSCALL_FAST(sleep)
+ 40f:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+ 416:	0f 05                	syscall
+ 418:	c3                   	ret
+
+0000000000000419 <send>:
+SYSCALL_FAST(send)
+ 419:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+ 420:	0f 05                	syscall
+ 422:	c3                   	ret
+
+0000000000000423 <send_recv>:
+SYSCALL_FAST(send_recv)
+ 423:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+ 42a:	0f 05                	syscall
+ 42c:	c3                   	ret
+
+000000000000042d <recv>:
+SYSCALL_FAST(recv)
+ 42d:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+ 434:	0f 05                	syscall
+ 436:	c3                   	ret
+
+0000000000000437 <call>:
+SYSCALL_FAST(call)
+ 437:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+ 43e:	0f 05                	syscall
+ 440:	c3                   	ret
+
+0000000000000441 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+ 441:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+ 448:	0f 05                	syscall
+ 44a:	c3                   	ret
+
+000000000000044b <send_reg>:
+SYSCALL_REG(send_reg)
+ 44b:	41 54                	push   %r12
+ 44d:	41 55                	push   %r13
+ 44f:	41 56                	push   %r14
+ 451:	41 57                	push   %r15
+ 453:	56                   	push   %rsi
+ 454:	49 89 f3             	mov    %rsi,%r11
+ 457:	48 89 d6             	mov    %rdx,%rsi
+ 45a:	49 8b 13             	mov    (%r11),%rdx
+ 45d:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 461:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 465:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 469:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 46d:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 471:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 475:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 479:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+ 480:	0f 05                	syscall
+ 482:	41 5b                	pop    %r11
+ 484:	49 89 13             	mov    %rdx,(%r11)
+ 487:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 48b:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 48f:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 493:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 497:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 49b:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 49f:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 4a3:	41 5f                	pop    %r15
+ 4a5:	41 5e                	pop    %r14
+ 4a7:	41 5d                	pop    %r13
+ 4a9:	41 5c                	pop    %r12
+ 4ab:	c3                   	ret
+
+00000000000004ac <recv_reg>:
+SYSCALL_REG(recv_reg)
+ 4ac:	41 54                	push   %r12
+ 4ae:	41 55                	push   %r13
+ 4b0:	41 56                	push   %r14
+ 4b2:	41 57                	push   %r15
+ 4b4:	56                   	push   %rsi
+ 4b5:	49 89 f3             	mov    %rsi,%r11
+ 4b8:	48 89 d6             	mov    %rdx,%rsi
+ 4bb:	49 8b 13             	mov    (%r11),%rdx
+ 4be:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 4c2:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 4c6:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 4ca:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 4ce:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 4d2:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 4d6:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 4da:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+ 4e1:	0f 05                	syscall
+ 4e3:	41 5b                	pop    %r11
+ 4e5:	49 89 13             	mov    %rdx,(%r11)
+ 4e8:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 4ec:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 4f0:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 4f4:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 4f8:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 4fc:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 500:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 504:	41 5f                	pop    %r15
+ 506:	41 5e                	pop    %r14
+ 508:	41 5d                	pop    %r13
+ 50a:	41 5c                	pop    %r12
+ 50c:	c3                   	ret
+
+000000000000050d <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+ 50d:	41 54                	push   %r12
+ 50f:	41 55                	push   %r13
+ 511:	41 56                	push   %r14
+ 513:	41 57                	push   %r15
+ 515:	56                   	push   %rsi
+ 516:	49 89 f3             	mov    %rsi,%r11
+ 519:	48 89 d6             	mov    %rdx,%rsi
+ 51c:	49 8b 13             	mov    (%r11),%rdx
+ 51f:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 523:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 527:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 52b:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 52f:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 533:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 537:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 53b:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+ 542:	0f 05                	syscall
+ 544:	41 5b                	pop    %r11
+ 546:	49 89 13             	mov    %rdx,(%r11)
+ 549:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 54d:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 551:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 555:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 559:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 55d:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 561:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 565:	41 5f                	pop    %r15
+ 567:	41 5e                	pop    %r14
+ 569:	41 5d                	pop    %r13
+ 56b:	41 5c                	pop    %r12
+ 56d:	c3                   	ret
+
+000000000000056e <call_reg>:
+SYSCALL_REG(call_reg)
+ 56e:	41 54                	push   %r12
+ 570:	41 55                	push   %r13
+ 572:	41 56                	push   %r14
+ 574:	41 57                	push   %r15
+ 576:	56                   	push   %rsi
+ 577:	49 89 f3             	mov    %rsi,%r11
+ 57a:	48 89 d6             	mov    %rdx,%rsi
+ 57d:	49 8b 13             	mov    (%r11),%rdx
+ 580:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 584:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 588:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 58c:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 590:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 594:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 598:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 59c:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+ 5a3:	0f 05                	syscall
+ 5a5:	41 5b                	pop    %r11
+ 5a7:	49 89 13             	mov    %rdx,(%r11)
+ 5aa:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 5ae:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 5b2:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 5b6:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 5ba:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 5be:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 5c2:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 5c6:	41 5f                	pop    %r15
+ 5c8:	41 5e                	pop    %r14
+ 5ca:	41 5d                	pop    %r13
+ 5cc:	41 5c                	pop    %r12
+ 5ce:	c3                   	ret
+
+00000000000005cf <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+ 5cf:	41 54                	push   %r12
+ 5d1:	41 55                	push   %r13
+ 5d3:	41 56                	push   %r14
+ 5d5:	41 57                	push   %r15
+ 5d7:	56                   	push   %rsi
+ 5d8:	49 89 f3             	mov    %rsi,%r11
+ 5db:	48 89 d6             	mov    %rdx,%rsi
+ 5de:	49 8b 13             	mov    (%r11),%rdx
+ 5e1:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 5e5:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 5e9:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 5ed:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 5f1:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 5f5:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 5f9:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 5fd:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+ 604:	0f 05                	syscall
+ 606:	41 5b                	pop    %r11
+ 608:	49 89 13             	mov    %rdx,(%r11)
+ 60b:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 60f:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 613:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 617:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 61b:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 61f:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 623:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 627:	41 5f                	pop    %r15
+ 629:	41 5e                	pop    %r14
+ 62b:	41 5d                	pop    %r13
+ 62d:	41 5c                	pop    %r12
+ 62f:	c3                   	ret
+
+0000000000000630 <sendx>:
+SYSCALL_FAST(sendx)
+ 630:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+ 637:	0f 05                	syscall
+ 639:	c3                   	ret
+
+000000000000063a <ring_attach>:
+SYSCALL_FAST(ring_attach)
+ 63a:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+ 641:	0f 05                	syscall
+ 643:	c3                   	ret
+
+0000000000000644 <notify>:
+SYSCALL_FAST(notify)
+ 644:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+ 64b:	0f 05                	syscall
+ 64d:	c3                   	ret
+
+000000000000064e <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+ 64e:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+ 655:	0f 05                	syscall
+ 657:	c3                   	ret
+
+0000000000000658 <send_timed>:
+SYSCALL_FAST(send_timed)
+ 658:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+ 65f:	0f 05                	syscall
+ 661:	c3                   	ret
+
+0000000000000662 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+ 662:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+ 669:	0f 05                	syscall
+ 66b:	c3                   	ret
+
+000000000000066c <set_add>:
+SYSCALL_FAST(set_add)
+ 66c:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+ 673:	0f 05                	syscall
+ 675:	c3                   	ret
+
+0000000000000676 <set_del>:
+SYSCALL_FAST(set_del)
+ 676:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+ 67d:	0f 05                	syscall
+ 67f:	c3                   	ret
+
+0000000000000680 <recv_any>:
+SYSCALL_FAST(recv_any)
+ 680:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+ 687:	0f 05                	syscall
+ 689:	c3                   	ret
+
+000000000000068a <ep_create>:
+SYSCALL_FAST(ep_create)
+ 68a:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+ 691:	0f 05                	syscall
+ 693:	c3                   	ret
+
+0000000000000694 <ep_close>:
+SYSCALL_FAST(ep_close)
+ 694:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+ 69b:	0f 05                	syscall
+ 69d:	c3                   	ret
+
+000000000000069e <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+ 69e:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+ 6a5:	0f 05                	syscall
+ 6a7:	c3                   	ret
+
+00000000000006a8 <setprio>:
+SYSCALL_FAST(setprio)
+ 6a8:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+ 6af:	0f 05                	syscall
+ 6b1:	c3                   	ret
+
+00000000000006b2 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+ 6b2:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+ 6b9:	0f 05                	syscall
+ 6bb:	c3                   	ret
+
+00000000000006bc <sethuge>:
+SYSCALL_FAST(sethuge)
+ 6bc:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+ 6c3:	0f 05                	syscall
+ 6c5:	c3                   	ret
+
+00000000000006c6 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+ 6c6:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+ 6cd:	0f 05                	syscall
+ 6cf:	c3                   	ret
+
+00000000000006d0 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+ 6d0:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+ 6d7:	0f 05                	syscall
+ 6d9:	c3                   	ret
+
+00000000000006da <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+ 6da:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+ 6e1:	0f 05                	syscall
+ 6e3:	c3                   	ret
+
+00000000000006e4 <null_call>:
+ 6e4:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+ 6eb:	0f 05                	syscall
+ 6ed:	c3                   	ret
+
+00000000000006ee <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6ee:	55                   	push   %rbp
+ 6ef:	48 89 e5             	mov    %rsp,%rbp
+ 6f2:	48 83 ec 10          	sub    $0x10,%rsp
+ 6f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 6f9:	89 f0                	mov    %esi,%eax
+ 6fb:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+ 6fe:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 702:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 705:	ba 01 00 00 00       	mov    $0x1,%edx
+ 70a:	48 89 ce             	mov    %rcx,%rsi
+ 70d:	89 c7                	mov    %eax,%edi
+ 70f:	e8 79 fc ff ff       	call   38d <write>
+}
+ 714:	90                   	nop
+ 715:	c9                   	leave
+ 716:	c3                   	ret
+
+0000000000000717 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 717:	55                   	push   %rbp
+ 718:	48 89 e5             	mov    %rsp,%rbp
+ 71b:	48 83 ec 30          	sub    $0x30,%rsp
+ 71f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 722:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 725:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 728:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 72b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 732:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 736:	74 17                	je     74f <printint+0x38>
+ 738:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 73c:	79 11                	jns    74f <printint+0x38>
+    neg = 1;
+ 73e:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 745:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 748:	f7 d8                	neg    %eax
+ 74a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 74d:	eb 06                	jmp    755 <printint+0x3e>
+  } else {
+    x = xx;
+ 74f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 752:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 755:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 75c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 75f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 762:	ba 00 00 00 00       	mov    $0x0,%edx
+ 767:	f7 f1                	div    %ecx
+ 769:	89 d1                	mov    %edx,%ecx
+ 76b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 76e:	8d 50 01             	lea    0x1(%rax),%edx
+ 771:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 774:	89 ca                	mov    %ecx,%edx
+ 776:	0f b6 92 90 12 00 00 	movzbl 0x1290(%rdx),%edx
+ 77d:	48 98                	cltq
+ 77f:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 783:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 786:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 789:	ba 00 00 00 00       	mov    $0x0,%edx
+ 78e:	f7 f6                	div    %esi
+ 790:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 793:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 797:	75 c3                	jne    75c <printint+0x45>
+  if(neg)
+ 799:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 79d:	74 2b                	je     7ca <printint+0xb3>
+    buf[i++] = '-';
+ 79f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7a2:	8d 50 01             	lea    0x1(%rax),%edx
+ 7a5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 7a8:	48 98                	cltq
+ 7aa:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 7af:	eb 19                	jmp    7ca <printint+0xb3>
+    putc(fd, buf[i]);
+ 7b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7b4:	48 98                	cltq
+ 7b6:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+ 7bb:	0f be d0             	movsbl %al,%edx
+ 7be:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7c1:	89 d6                	mov    %edx,%esi
+ 7c3:	89 c7                	mov    %eax,%edi
+ 7c5:	e8 24 ff ff ff       	call   6ee <putc>
+  while(--i >= 0)
+ 7ca:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 7ce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 7d2:	79 dd                	jns    7b1 <printint+0x9a>
+}
+ 7d4:	90                   	nop
+ 7d5:	90                   	nop
+ 7d6:	c9                   	leave
+ 7d7:	c3                   	ret
+
+00000000000007d8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7d8:	55                   	push   %rbp
+ 7d9:	48 89 e5             	mov    %rsp,%rbp
+ 7dc:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+ 7e3:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+ 7e9:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+ 7f0:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+ 7f7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+ 7fe:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+ 805:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+ 80c:	84 c0                	test   %al,%al
+ 80e:	74 20                	je     830 <printf+0x58>
+ 810:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+ 814:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+ 818:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+ 81c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+ 820:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+ 824:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+ 828:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+ 82c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 830:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+ 837:	00 00 00 
+ 83a:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+ 841:	00 00 00 
+ 844:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 848:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+ 84f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+ 856:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+ 85d:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ 864:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ 867:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+ 86e:	00 00 00 
+ 871:	e9 a8 02 00 00       	jmp    b1e <printf+0x346>
+    c = fmt[i] & 0xff;
+ 876:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ 87c:	48 63 d0             	movslq %eax,%rdx
+ 87f:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ 886:	48 01 d0             	add    %rdx,%rax
+ 889:	0f b6 00             	movzbl (%rax),%eax
+ 88c:	0f be c0             	movsbl %al,%eax
+ 88f:	25 ff 00 00 00       	and    $0xff,%eax
+ 894:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+ 89a:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+ 8a1:	75 35                	jne    8d8 <printf+0x100>
+      if(c == '%'){
+ 8a3:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ 8aa:	75 0f                	jne    8bb <printf+0xe3>
+        state = '%';
+ 8ac:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+ 8b3:	00 00 00 
+ 8b6:	e9 5c 02 00 00       	jmp    b17 <printf+0x33f>
+      } else {
+        putc(fd, c);
+ 8bb:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ 8c1:	0f be d0             	movsbl %al,%edx
+ 8c4:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 8ca:	89 d6                	mov    %edx,%esi
+ 8cc:	89 c7                	mov    %eax,%edi
+ 8ce:	e8 1b fe ff ff       	call   6ee <putc>
+ 8d3:	e9 3f 02 00 00       	jmp    b17 <printf+0x33f>
+      }
+    } else if(state == '%'){
+ 8d8:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+ 8df:	0f 85 32 02 00 00    	jne    b17 <printf+0x33f>
+      if(c == 'd'){
+ 8e5:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+ 8ec:	75 5e                	jne    94c <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 8ee:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 8f4:	83 f8 2f             	cmp    $0x2f,%eax
+ 8f7:	77 23                	ja     91c <printf+0x144>
+ 8f9:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 900:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 906:	89 d2                	mov    %edx,%edx
+ 908:	48 01 d0             	add    %rdx,%rax
+ 90b:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 911:	83 c2 08             	add    $0x8,%edx
+ 914:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 91a:	eb 12                	jmp    92e <printf+0x156>
+ 91c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 923:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 927:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 92e:	8b 30                	mov    (%rax),%esi
+ 930:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 936:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 93b:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 940:	89 c7                	mov    %eax,%edi
+ 942:	e8 d0 fd ff ff       	call   717 <printint>
+ 947:	e9 c1 01 00 00       	jmp    b0d <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+ 94c:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+ 953:	74 09                	je     95e <printf+0x186>
+ 955:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+ 95c:	75 5e                	jne    9bc <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 95e:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 964:	83 f8 2f             	cmp    $0x2f,%eax
+ 967:	77 23                	ja     98c <printf+0x1b4>
+ 969:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 970:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 976:	89 d2                	mov    %edx,%edx
+ 978:	48 01 d0             	add    %rdx,%rax
+ 97b:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 981:	83 c2 08             	add    $0x8,%edx
+ 984:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 98a:	eb 12                	jmp    99e <printf+0x1c6>
+ 98c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 993:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 997:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 99e:	8b 30                	mov    (%rax),%esi
+ 9a0:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 9a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 9ab:	ba 10 00 00 00       	mov    $0x10,%edx
+ 9b0:	89 c7                	mov    %eax,%edi
+ 9b2:	e8 60 fd ff ff       	call   717 <printint>
+ 9b7:	e9 51 01 00 00       	jmp    b0d <printf+0x335>
+      } else if(c == 's'){
+ 9bc:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+ 9c3:	0f 85 98 00 00 00    	jne    a61 <printf+0x289>
+        s = va_arg(ap, char*);
+ 9c9:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 9cf:	83 f8 2f             	cmp    $0x2f,%eax
+ 9d2:	77 23                	ja     9f7 <printf+0x21f>
+ 9d4:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 9db:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 9e1:	89 d2                	mov    %edx,%edx
+ 9e3:	48 01 d0             	add    %rdx,%rax
+ 9e6:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 9ec:	83 c2 08             	add    $0x8,%edx
+ 9ef:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 9f5:	eb 12                	jmp    a09 <printf+0x231>
+ 9f7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 9fe:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ a02:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ a09:	48 8b 00             	mov    (%rax),%rax
+ a0c:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+ a13:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+ a1a:	00 
+ a1b:	75 31                	jne    a4e <printf+0x276>
+          s = "(null)";
+ a1d:	48 c7 85 48 ff ff ff 	movq   $0xfa8,-0xb8(%rbp)
+ a24:	a8 0f 00 00 
+        while(*s != 0){
+ a28:	eb 24                	jmp    a4e <printf+0x276>
+          putc(fd, *s);
+ a2a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a31:	0f b6 00             	movzbl (%rax),%eax
+ a34:	0f be d0             	movsbl %al,%edx
+ a37:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ a3d:	89 d6                	mov    %edx,%esi
+ a3f:	89 c7                	mov    %eax,%edi
+ a41:	e8 a8 fc ff ff       	call   6ee <putc>
+          s++;
+ a46:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+ a4d:	01 
+        while(*s != 0){
+ a4e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a55:	0f b6 00             	movzbl (%rax),%eax
+ a58:	84 c0                	test   %al,%al
+ a5a:	75 ce                	jne    a2a <printf+0x252>
+ a5c:	e9 ac 00 00 00       	jmp    b0d <printf+0x335>
+        }
+      } else if(c == 'c'){
+ a61:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+ a68:	75 56                	jne    ac0 <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+ a6a:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ a70:	83 f8 2f             	cmp    $0x2f,%eax
+ a73:	77 23                	ja     a98 <printf+0x2c0>
+ a75:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ a7c:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a82:	89 d2                	mov    %edx,%edx
+ a84:	48 01 d0             	add    %rdx,%rax
+ a87:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a8d:	83 c2 08             	add    $0x8,%edx
+ a90:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ a96:	eb 12                	jmp    aaa <printf+0x2d2>
+ a98:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ a9f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ aa3:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ aaa:	8b 00                	mov    (%rax),%eax
+ aac:	0f be d0             	movsbl %al,%edx
+ aaf:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ ab5:	89 d6                	mov    %edx,%esi
+ ab7:	89 c7                	mov    %eax,%edi
+ ab9:	e8 30 fc ff ff       	call   6ee <putc>
+ abe:	eb 4d                	jmp    b0d <printf+0x335>
+      } else if(c == '%'){
+ ac0:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ ac7:	75 1a                	jne    ae3 <printf+0x30b>
+        putc(fd, c);
+ ac9:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ acf:	0f be d0             	movsbl %al,%edx
+ ad2:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ ad8:	89 d6                	mov    %edx,%esi
+ ada:	89 c7                	mov    %eax,%edi
+ adc:	e8 0d fc ff ff       	call   6ee <putc>
+ ae1:	eb 2a                	jmp    b0d <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ ae3:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ ae9:	be 25 00 00 00       	mov    $0x25,%esi
+ aee:	89 c7                	mov    %eax,%edi
+ af0:	e8 f9 fb ff ff       	call   6ee <putc>
+        putc(fd, c);
+ af5:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ afb:	0f be d0             	movsbl %al,%edx
+ afe:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ b04:	89 d6                	mov    %edx,%esi
+ b06:	89 c7                	mov    %eax,%edi
+ b08:	e8 e1 fb ff ff       	call   6ee <putc>
+      }
+      state = 0;
+ b0d:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ b14:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ b17:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+ b1e:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ b24:	48 63 d0             	movslq %eax,%rdx
+ b27:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ b2e:	48 01 d0             	add    %rdx,%rax
+ b31:	0f b6 00             	movzbl (%rax),%eax
+ b34:	84 c0                	test   %al,%al
+ b36:	0f 85 3a fd ff ff    	jne    876 <printf+0x9e>
+    }
+  }
+}
+ b3c:	90                   	nop
+ b3d:	90                   	nop
+ b3e:	c9                   	leave
+ b3f:	c3                   	ret
+
+0000000000000b40 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b40:	55                   	push   %rbp
+ b41:	48 89 e5             	mov    %rsp,%rbp
+ b44:	48 83 ec 18          	sub    $0x18,%rsp
+ b48:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ b50:	48 83 e8 10          	sub    $0x10,%rax
+ b54:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b58:	48 8b 05 61 07 00 00 	mov    0x761(%rip),%rax        # 12c0 <freep>
+ b5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b63:	eb 2f                	jmp    b94 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b69:	48 8b 00             	mov    (%rax),%rax
+ b6c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b70:	72 17                	jb     b89 <free+0x49>
+ b72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b76:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b7a:	72 2f                	jb     bab <free+0x6b>
+ b7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b80:	48 8b 00             	mov    (%rax),%rax
+ b83:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ b87:	72 22                	jb     bab <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b8d:	48 8b 00             	mov    (%rax),%rax
+ b90:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b98:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b9c:	73 c7                	jae    b65 <free+0x25>
+ b9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ba2:	48 8b 00             	mov    (%rax),%rax
+ ba5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ ba9:	73 ba                	jae    b65 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ baf:	8b 40 08             	mov    0x8(%rax),%eax
+ bb2:	89 c0                	mov    %eax,%eax
+ bb4:	48 c1 e0 04          	shl    $0x4,%rax
+ bb8:	48 89 c2             	mov    %rax,%rdx
+ bbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bbf:	48 01 c2             	add    %rax,%rdx
+ bc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bc6:	48 8b 00             	mov    (%rax),%rax
+ bc9:	48 39 c2             	cmp    %rax,%rdx
+ bcc:	75 2d                	jne    bfb <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+ bce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bd2:	8b 50 08             	mov    0x8(%rax),%edx
+ bd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd9:	48 8b 00             	mov    (%rax),%rax
+ bdc:	8b 40 08             	mov    0x8(%rax),%eax
+ bdf:	01 c2                	add    %eax,%edx
+ be1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ be5:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ be8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bec:	48 8b 00             	mov    (%rax),%rax
+ bef:	48 8b 10             	mov    (%rax),%rdx
+ bf2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bf6:	48 89 10             	mov    %rdx,(%rax)
+ bf9:	eb 0e                	jmp    c09 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bff:	48 8b 10             	mov    (%rax),%rdx
+ c02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c06:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ c09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c0d:	8b 40 08             	mov    0x8(%rax),%eax
+ c10:	89 c0                	mov    %eax,%eax
+ c12:	48 c1 e0 04          	shl    $0x4,%rax
+ c16:	48 89 c2             	mov    %rax,%rdx
+ c19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c1d:	48 01 d0             	add    %rdx,%rax
+ c20:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ c24:	75 27                	jne    c4d <free+0x10d>
+    p->s.size += bp->s.size;
+ c26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c2a:	8b 50 08             	mov    0x8(%rax),%edx
+ c2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c31:	8b 40 08             	mov    0x8(%rax),%eax
+ c34:	01 c2                	add    %eax,%edx
+ c36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c3a:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ c3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c41:	48 8b 10             	mov    (%rax),%rdx
+ c44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c48:	48 89 10             	mov    %rdx,(%rax)
+ c4b:	eb 0b                	jmp    c58 <free+0x118>
+  } else
+    p->s.ptr = bp;
+ c4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c51:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ c55:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ c58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c5c:	48 89 05 5d 06 00 00 	mov    %rax,0x65d(%rip)        # 12c0 <freep>
+}
+ c63:	90                   	nop
+ c64:	c9                   	leave
+ c65:	c3                   	ret
+
+0000000000000c66 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c66:	55                   	push   %rbp
+ c67:	48 89 e5             	mov    %rsp,%rbp
+ c6a:	48 83 ec 20          	sub    $0x20,%rsp
+ c6e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c71:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ c78:	77 07                	ja     c81 <morecore+0x1b>
+    nu = 4096;
+ c7a:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ c81:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c84:	c1 e0 04             	shl    $0x4,%eax
+ c87:	89 c7                	mov    %eax,%edi
+ c89:	e8 77 f7 ff ff       	call   405 <sbrk>
+ c8e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ c92:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ c97:	75 07                	jne    ca0 <morecore+0x3a>
+    return 0;
+ c99:	b8 00 00 00 00       	mov    $0x0,%eax
+ c9e:	eb 29                	jmp    cc9 <morecore+0x63>
+  hp = (Header*)p;
+ ca0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ca4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ ca8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cac:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ caf:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ cb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cb6:	48 83 c0 10          	add    $0x10,%rax
+ cba:	48 89 c7             	mov    %rax,%rdi
+ cbd:	e8 7e fe ff ff       	call   b40 <free>
+  return freep;
+ cc2:	48 8b 05 f7 05 00 00 	mov    0x5f7(%rip),%rax        # 12c0 <freep>
+}
+ cc9:	c9                   	leave
+ cca:	c3                   	ret
+
+0000000000000ccb <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ccb:	55                   	push   %rbp
+ ccc:	48 89 e5             	mov    %rsp,%rbp
+ ccf:	48 83 ec 30          	sub    $0x30,%rsp
+ cd3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cd6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ cd9:	48 83 c0 0f          	add    $0xf,%rax
+ cdd:	48 c1 e8 04          	shr    $0x4,%rax
+ ce1:	83 c0 01             	add    $0x1,%eax
+ ce4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+ ce7:	48 8b 05 d2 05 00 00 	mov    0x5d2(%rip),%rax        # 12c0 <freep>
+ cee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ cf2:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ cf7:	75 2b                	jne    d24 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+ cf9:	48 c7 45 f0 b0 12 00 	movq   $0x12b0,-0x10(%rbp)
+ d00:	00 
+ d01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d05:	48 89 05 b4 05 00 00 	mov    %rax,0x5b4(%rip)        # 12c0 <freep>
+ d0c:	48 8b 05 ad 05 00 00 	mov    0x5ad(%rip),%rax        # 12c0 <freep>
+ d13:	48 89 05 96 05 00 00 	mov    %rax,0x596(%rip)        # 12b0 <base>
+    base.s.size = 0;
+ d1a:	c7 05 94 05 00 00 00 	movl   $0x0,0x594(%rip)        # 12b8 <base+0x8>
+ d21:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d28:	48 8b 00             	mov    (%rax),%rax
+ d2b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ d2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d33:	8b 40 08             	mov    0x8(%rax),%eax
+ d36:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ d39:	72 5f                	jb     d9a <malloc+0xcf>
+      if(p->s.size == nunits)
+ d3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d3f:	8b 40 08             	mov    0x8(%rax),%eax
+ d42:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ d45:	75 10                	jne    d57 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+ d47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d4b:	48 8b 10             	mov    (%rax),%rdx
+ d4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d52:	48 89 10             	mov    %rdx,(%rax)
+ d55:	eb 2e                	jmp    d85 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+ d57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d5b:	8b 40 08             	mov    0x8(%rax),%eax
+ d5e:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ d61:	89 c2                	mov    %eax,%edx
+ d63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d67:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ d6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d6e:	8b 40 08             	mov    0x8(%rax),%eax
+ d71:	89 c0                	mov    %eax,%eax
+ d73:	48 c1 e0 04          	shl    $0x4,%rax
+ d77:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ d7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d7f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ d82:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ d85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d89:	48 89 05 30 05 00 00 	mov    %rax,0x530(%rip)        # 12c0 <freep>
+      return (void*)(p + 1);
+ d90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d94:	48 83 c0 10          	add    $0x10,%rax
+ d98:	eb 41                	jmp    ddb <malloc+0x110>
+    }
+    if(p == freep)
+ d9a:	48 8b 05 1f 05 00 00 	mov    0x51f(%rip),%rax        # 12c0 <freep>
+ da1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ da5:	75 1c                	jne    dc3 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+ da7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ daa:	89 c7                	mov    %eax,%edi
+ dac:	e8 b5 fe ff ff       	call   c66 <morecore>
+ db1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ db5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ dba:	75 07                	jne    dc3 <malloc+0xf8>
+        return 0;
+ dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+ dc1:	eb 18                	jmp    ddb <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ dc7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ dcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ dcf:	48 8b 00             	mov    (%rax),%rax
+ dd2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ dd6:	e9 54 ff ff ff       	jmp    d2f <malloc+0x64>
+  }
+}
+ ddb:	c9                   	leave
+ ddc:	c3                   	ret
+
+0000000000000ddd <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+ ddd:	55                   	push   %rbp
+ dde:	48 89 e5             	mov    %rsp,%rbp
+ de1:	53                   	push   %rbx
+ de2:	48 83 ec 38          	sub    $0x38,%rsp
+ de6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ de9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ ded:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+ df1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ df5:	8b 40 40             	mov    0x40(%rax),%eax
+ df8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+ dfb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ dff:	8b 00                	mov    (%rax),%eax
+ e01:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ e04:	29 c2                	sub    %eax,%edx
+ e06:	83 fa 20             	cmp    $0x20,%edx
+ e09:	75 0a                	jne    e15 <ring_send+0x38>
+    return -1;
+ e0b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e10:	e9 93 00 00 00       	jmp    ea8 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+ e15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e18:	83 e0 1f             	and    $0x1f,%eax
+ e1b:	89 c2                	mov    %eax,%edx
+ e1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e21:	89 d2                	mov    %edx,%edx
+ e23:	48 83 c2 02          	add    $0x2,%rdx
+ e27:	48 c1 e2 06          	shl    $0x6,%rdx
+ e2b:	48 01 c2             	add    %rax,%rdx
+ e2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ e32:	48 8b 08             	mov    (%rax),%rcx
+ e35:	48 8b 58 08          	mov    0x8(%rax),%rbx
+ e39:	48 89 0a             	mov    %rcx,(%rdx)
+ e3c:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+ e40:	48 8b 48 10          	mov    0x10(%rax),%rcx
+ e44:	48 8b 58 18          	mov    0x18(%rax),%rbx
+ e48:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+ e4c:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+ e50:	48 8b 48 20          	mov    0x20(%rax),%rcx
+ e54:	48 8b 58 28          	mov    0x28(%rax),%rbx
+ e58:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+ e5c:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+ e60:	48 8b 48 30          	mov    0x30(%rax),%rcx
+ e64:	48 8b 58 38          	mov    0x38(%rax),%rbx
+ e68:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+ e6c:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+ e70:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+ e76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e79:	8d 50 01             	lea    0x1(%rax),%edx
+ e7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e80:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+ e83:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+ e89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e8d:	8b 00                	mov    (%rax),%eax
+ e8f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ e92:	75 0f                	jne    ea3 <ring_send+0xc6>
+    notify(channel, 1);
+ e94:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ e97:	be 01 00 00 00       	mov    $0x1,%esi
+ e9c:	89 c7                	mov    %eax,%edi
+ e9e:	e8 a1 f7 ff ff       	call   644 <notify>
+  return 0;
+ ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ ea8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ eac:	c9                   	leave
+ ead:	c3                   	ret
+
+0000000000000eae <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+ eae:	55                   	push   %rbp
+ eaf:	48 89 e5             	mov    %rsp,%rbp
+ eb2:	53                   	push   %rbx
+ eb3:	48 83 ec 38          	sub    $0x38,%rsp
+ eb7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ eba:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ ebe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+ ec2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ ec6:	8b 00                	mov    (%rax),%eax
+ ec8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+ ecb:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+ ed1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ ed5:	8b 40 40             	mov    0x40(%rax),%eax
+ ed8:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ edb:	75 15                	jne    ef2 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+ edd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ ee0:	89 c7                	mov    %eax,%edi
+ ee2:	e8 67 f7 ff ff       	call   64e <nfy_wait>
+ ee7:	85 c0                	test   %eax,%eax
+ ee9:	79 e0                	jns    ecb <ring_recv+0x1d>
+      return -1;
+ eeb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ef0:	eb 73                	jmp    f65 <ring_recv+0xb7>
+      break;
+ ef2:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+ ef3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ ef6:	83 e0 1f             	and    $0x1f,%eax
+ ef9:	89 c1                	mov    %eax,%ecx
+ efb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ eff:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ f03:	89 c9                	mov    %ecx,%ecx
+ f05:	48 83 c1 02          	add    $0x2,%rcx
+ f09:	48 c1 e1 06          	shl    $0x6,%rcx
+ f0d:	48 01 ca             	add    %rcx,%rdx
+ f10:	48 8b 0a             	mov    (%rdx),%rcx
+ f13:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+ f17:	48 89 08             	mov    %rcx,(%rax)
+ f1a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+ f1e:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+ f22:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+ f26:	48 89 48 10          	mov    %rcx,0x10(%rax)
+ f2a:	48 89 58 18          	mov    %rbx,0x18(%rax)
+ f2e:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+ f32:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+ f36:	48 89 48 20          	mov    %rcx,0x20(%rax)
+ f3a:	48 89 58 28          	mov    %rbx,0x28(%rax)
+ f3e:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+ f42:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+ f46:	48 89 48 30          	mov    %rcx,0x30(%rax)
+ f4a:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+ f4e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+ f54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ f57:	8d 50 01             	lea    0x1(%rax),%edx
+ f5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ f5e:	89 10                	mov    %edx,(%rax)
+  return 0;
+ f60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ f65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ f69:	c9                   	leave
+ f6a:	c3                   	ret
+
+0000000000000f6b <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+ f6b:	55                   	push   %rbp
+ f6c:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+ f6f:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ f74:	8b 00                	mov    (%rax),%eax
+}
+ f76:	5d                   	pop    %rbp
+ f77:	c3                   	ret
+
+0000000000000f78 <getpid>:
+
+int
+getpid(void)
+{
+ f78:	55                   	push   %rbp
+ f79:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+ f7c:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+ f81:	8b 00                	mov    (%rax),%eax
+}
+ f83:	5d                   	pop    %rbp
+ f84:	c3                   	ret
+
+0000000000000f85 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+ f85:	55                   	push   %rbp
+ f86:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+ f89:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ f8e:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+ f92:	5d                   	pop    %rbp
+ f93:	c3                   	ret
@@ -0,0 +1,1722 @@
+
+fs/ln:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 10          	sub    $0x10,%rsp
+   8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+   b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(argc != 3){
+   f:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+  13:	74 1b                	je     30 <main+0x30>
+    printf(2, "Usage: ln old new\n");
+  15:	48 c7 c6 b0 0f 00 00 	mov    $0xfb0,%rsi
+  1c:	bf 02 00 00 00       	mov    $0x2,%edi
+  21:	b8 00 00 00 00       	mov    $0x0,%eax
+  26:	e8 c9 07 00 00       	call   7f4 <printf>
+    exit();
+  2b:	e8 51 03 00 00       	call   381 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  34:	48 83 c0 10          	add    $0x10,%rax
+  38:	48 8b 10             	mov    (%rax),%rdx
+  3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  3f:	48 83 c0 08          	add    $0x8,%rax
+  43:	48 8b 00             	mov    (%rax),%rax
+  46:	48 89 d6             	mov    %rdx,%rsi
+  49:	48 89 c7             	mov    %rax,%rdi
+  4c:	e8 a8 03 00 00       	call   3f9 <link>
+  51:	85 c0                	test   %eax,%eax
+  53:	79 32                	jns    87 <main+0x87>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  59:	48 83 c0 10          	add    $0x10,%rax
+  5d:	48 8b 10             	mov    (%rax),%rdx
+  60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  64:	48 83 c0 08          	add    $0x8,%rax
+  68:	48 8b 00             	mov    (%rax),%rax
+  6b:	48 89 d1             	mov    %rdx,%rcx
+  6e:	48 89 c2             	mov    %rax,%rdx
+  71:	48 c7 c6 c3 0f 00 00 	mov    $0xfc3,%rsi
+  78:	bf 02 00 00 00       	mov    $0x2,%edi
+  7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  82:	e8 6d 07 00 00       	call   7f4 <printf>
+  exit();
+  87:	e8 f5 02 00 00       	call   381 <exit>
+
+000000000000008c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  8c:	55                   	push   %rbp
+  8d:	48 89 e5             	mov    %rsp,%rbp
+  90:	48 83 ec 10          	sub    $0x10,%rsp
+  94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  98:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  9b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+  9e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  a2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  a8:	48 89 ce             	mov    %rcx,%rsi
+  ab:	48 89 f7             	mov    %rsi,%rdi
+  ae:	89 d1                	mov    %edx,%ecx
+  b0:	fc                   	cld
+  b1:	f3 aa                	rep stos %al,%es:(%rdi)
+  b3:	89 ca                	mov    %ecx,%edx
+  b5:	48 89 fe             	mov    %rdi,%rsi
+  b8:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  bc:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  bf:	90                   	nop
+  c0:	c9                   	leave
+  c1:	c3                   	ret
+
+00000000000000c2 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  c2:	55                   	push   %rbp
+  c3:	48 89 e5             	mov    %rsp,%rbp
+  c6:	48 83 ec 20          	sub    $0x20,%rsp
+  ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+  d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+  da:	90                   	nop
+  db:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  df:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  e3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  eb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  f3:	0f b6 12             	movzbl (%rdx),%edx
+  f6:	88 10                	mov    %dl,(%rax)
+  f8:	0f b6 00             	movzbl (%rax),%eax
+  fb:	84 c0                	test   %al,%al
+  fd:	75 dc                	jne    db <strcpy+0x19>
+    ;
+  return os;
+  ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 103:	c9                   	leave
+ 104:	c3                   	ret
+
+0000000000000105 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 105:	55                   	push   %rbp
+ 106:	48 89 e5             	mov    %rsp,%rbp
+ 109:	48 83 ec 10          	sub    $0x10,%rsp
+ 10d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 111:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 115:	eb 0a                	jmp    121 <strcmp+0x1c>
+    p++, q++;
+ 117:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 11c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 121:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 125:	0f b6 00             	movzbl (%rax),%eax
+ 128:	84 c0                	test   %al,%al
+ 12a:	74 12                	je     13e <strcmp+0x39>
+ 12c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 130:	0f b6 10             	movzbl (%rax),%edx
+ 133:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 137:	0f b6 00             	movzbl (%rax),%eax
+ 13a:	38 c2                	cmp    %al,%dl
+ 13c:	74 d9                	je     117 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+ 13e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 142:	0f b6 00             	movzbl (%rax),%eax
+ 145:	0f b6 d0             	movzbl %al,%edx
+ 148:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 14c:	0f b6 00             	movzbl (%rax),%eax
+ 14f:	0f b6 c0             	movzbl %al,%eax
+ 152:	29 c2                	sub    %eax,%edx
+ 154:	89 d0                	mov    %edx,%eax
+}
+ 156:	c9                   	leave
+ 157:	c3                   	ret
+
+0000000000000158 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 158:	55                   	push   %rbp
+ 159:	48 89 e5             	mov    %rsp,%rbp
+ 15c:	48 83 ec 18          	sub    $0x18,%rsp
+ 160:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 164:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 16b:	eb 04                	jmp    171 <strlen+0x19>
+ 16d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 171:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 174:	48 63 d0             	movslq %eax,%rdx
+ 177:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 17b:	48 01 d0             	add    %rdx,%rax
+ 17e:	0f b6 00             	movzbl (%rax),%eax
+ 181:	84 c0                	test   %al,%al
+ 183:	75 e8                	jne    16d <strlen+0x15>
+    ;
+  return n;
+ 185:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 188:	c9                   	leave
+ 189:	c3                   	ret
+
+000000000000018a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 18a:	55                   	push   %rbp
+ 18b:	48 89 e5             	mov    %rsp,%rbp
+ 18e:	48 83 ec 10          	sub    $0x10,%rsp
+ 192:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 196:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 199:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 19c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 19f:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 1a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1a6:	89 ce                	mov    %ecx,%esi
+ 1a8:	48 89 c7             	mov    %rax,%rdi
+ 1ab:	e8 dc fe ff ff       	call   8c <stosb>
+  return dst;
+ 1b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 1b4:	c9                   	leave
+ 1b5:	c3                   	ret
+
+00000000000001b6 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1b6:	55                   	push   %rbp
+ 1b7:	48 89 e5             	mov    %rsp,%rbp
+ 1ba:	48 83 ec 10          	sub    $0x10,%rsp
+ 1be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 1c2:	89 f0                	mov    %esi,%eax
+ 1c4:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 1c7:	eb 17                	jmp    1e0 <strchr+0x2a>
+    if(*s == c)
+ 1c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1cd:	0f b6 00             	movzbl (%rax),%eax
+ 1d0:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 1d3:	75 06                	jne    1db <strchr+0x25>
+      return (char*)s;
+ 1d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1d9:	eb 15                	jmp    1f0 <strchr+0x3a>
+  for(; *s; s++)
+ 1db:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 1e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1e4:	0f b6 00             	movzbl (%rax),%eax
+ 1e7:	84 c0                	test   %al,%al
+ 1e9:	75 de                	jne    1c9 <strchr+0x13>
+  return 0;
+ 1eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1f0:	c9                   	leave
+ 1f1:	c3                   	ret
+
+00000000000001f2 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1f2:	55                   	push   %rbp
+ 1f3:	48 89 e5             	mov    %rsp,%rbp
+ 1f6:	48 83 ec 20          	sub    $0x20,%rsp
+ 1fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 1fe:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 201:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 208:	eb 48                	jmp    252 <gets+0x60>
+    cc = read(0, &c, 1);
+ 20a:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 20e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 213:	48 89 c6             	mov    %rax,%rsi
+ 216:	bf 00 00 00 00       	mov    $0x0,%edi
+ 21b:	e8 7f 01 00 00       	call   39f <read>
+ 220:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 223:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 227:	7e 36                	jle    25f <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 229:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 22c:	8d 50 01             	lea    0x1(%rax),%edx
+ 22f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 232:	48 63 d0             	movslq %eax,%rdx
+ 235:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 239:	48 01 c2             	add    %rax,%rdx
+ 23c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 240:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 242:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 246:	3c 0a                	cmp    $0xa,%al
+ 248:	74 16                	je     260 <gets+0x6e>
+ 24a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 24e:	3c 0d                	cmp    $0xd,%al
+ 250:	74 0e                	je     260 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 252:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 255:	83 c0 01             	add    $0x1,%eax
+ 258:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 25b:	7f ad                	jg     20a <gets+0x18>
+ 25d:	eb 01                	jmp    260 <gets+0x6e>
+      break;
+ 25f:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 260:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 263:	48 63 d0             	movslq %eax,%rdx
+ 266:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 26a:	48 01 d0             	add    %rdx,%rax
+ 26d:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 274:	c9                   	leave
+ 275:	c3                   	ret
+
+0000000000000276 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 276:	55                   	push   %rbp
+ 277:	48 89 e5             	mov    %rsp,%rbp
+ 27a:	48 83 ec 20          	sub    $0x20,%rsp
+ 27e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 282:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 286:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 28a:	be 00 00 00 00       	mov    $0x0,%esi
+ 28f:	48 89 c7             	mov    %rax,%rdi
+ 292:	e8 3a 01 00 00       	call   3d1 <open>
+ 297:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 29a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 29e:	79 07                	jns    2a7 <stat+0x31>
+    return -1;
+ 2a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2a5:	eb 21                	jmp    2c8 <stat+0x52>
+  r = fstat(fd, st);
+ 2a7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 2ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2ae:	48 89 d6             	mov    %rdx,%rsi
+ 2b1:	89 c7                	mov    %eax,%edi
+ 2b3:	e8 37 01 00 00       	call   3ef <fstat>
+ 2b8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 2bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2be:	89 c7                	mov    %eax,%edi
+ 2c0:	e8 ee 00 00 00       	call   3b3 <close>
+  return r;
+ 2c5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+00000000000002ca <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2ca:	55                   	push   %rbp
+ 2cb:	48 89 e5             	mov    %rsp,%rbp
+ 2ce:	48 83 ec 18          	sub    $0x18,%rsp
+ 2d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 2d6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 2dd:	eb 28                	jmp    307 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+ 2df:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 2e2:	89 d0                	mov    %edx,%eax
+ 2e4:	c1 e0 02             	shl    $0x2,%eax
+ 2e7:	01 d0                	add    %edx,%eax
+ 2e9:	01 c0                	add    %eax,%eax
+ 2eb:	89 c1                	mov    %eax,%ecx
+ 2ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2f1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 2f5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 2f9:	0f b6 00             	movzbl (%rax),%eax
+ 2fc:	0f be c0             	movsbl %al,%eax
+ 2ff:	01 c8                	add    %ecx,%eax
+ 301:	83 e8 30             	sub    $0x30,%eax
+ 304:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 307:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 30b:	0f b6 00             	movzbl (%rax),%eax
+ 30e:	3c 2f                	cmp    $0x2f,%al
+ 310:	7e 0b                	jle    31d <atoi+0x53>
+ 312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 316:	0f b6 00             	movzbl (%rax),%eax
+ 319:	3c 39                	cmp    $0x39,%al
+ 31b:	7e c2                	jle    2df <atoi+0x15>
+  return n;
+ 31d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 320:	c9                   	leave
+ 321:	c3                   	ret
+
+0000000000000322 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 322:	55                   	push   %rbp
+ 323:	48 89 e5             	mov    %rsp,%rbp
+ 326:	48 83 ec 28          	sub    $0x28,%rsp
+ 32a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 32e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 332:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+ 335:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 339:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 33d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 341:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 345:	eb 1d                	jmp    364 <memmove+0x42>
+    *dst++ = *src++;
+ 347:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 34b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 34f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 357:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 35b:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 35f:	0f b6 12             	movzbl (%rdx),%edx
+ 362:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 364:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 367:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 36a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 36d:	85 c0                	test   %eax,%eax
+ 36f:	7f d6                	jg     347 <memmove+0x25>
+  return vdst;
+ 371:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 375:	c9                   	leave
+ 376:	c3                   	ret
+
+0000000000000377 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+ 377:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+0000000000000381 <exit>:
+SYSCALL_FAST(exit)
+ 381:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+ 388:	0f 05                	syscall
+ 38a:	c3                   	ret
+
+000000000000038b <wait>:
+SYSCALL_FAST(wait)
+ 38b:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+ 392:	0f 05                	syscall
+ 394:	c3                   	ret
+
+0000000000000395 <pipe>:
+SYSCALL_FAST(pipe)
+ 395:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+ 39c:	0f 05                	syscall
+ 39e:	c3                   	ret
+
+000000000000039f <read>:
+SYSCALL_FAST(read)
+ 39f:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+ 3a6:	0f 05                	syscall
+ 3a8:	c3                   	ret
+
+00000000000003a9 <write>:
+SYSCALL_FAST(write)
+ 3a9:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+ 3b0:	0f 05                	syscall
+ 3b2:	c3                   	ret
+
+00000000000003b3 <close>:
+SYSCALL_FAST(close)
+ 3b3:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+ 3ba:	0f 05                	syscall
+ 3bc:	c3                   	ret
+
+00000000000003bd <kill>:
+SYSCALL_FAST(kill)
+ 3bd:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+ 3c4:	0f 05                	syscall
+ 3c6:	c3                   	ret
+
+00000000000003c7 <exec>:
+SYSCALL(exec)
+ 3c7:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+00000000000003d1 <open>:
+SYSCALL_FAST(open)
+ 3d1:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+ 3d8:	0f 05                	syscall
+ 3da:	c3                   	ret
+
+00000000000003db <mknod>:
+SYSCALL_FAST(mknod)
+ 3db:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+ 3e2:	0f 05                	syscall
+ 3e4:	c3                   	ret
+
+00000000000003e5 <unlink>:
+SYSCALL_FAST(unlink)
+ 3e5:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+ 3ec:	0f 05                	syscall
+ 3ee:	c3                   	ret
+
+00000000000003ef <fstat>:
+SYSCALL_FAST(fstat)
+ 3ef:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+ 3f6:	0f 05                	syscall
+ 3f8:	c3                   	ret
+
+00000000000003f9 <link>:
+SYSCALL_FAST(link)
+ 3f9:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+ 400:	0f 05                	syscall
+ 402:	c3                   	ret
+
+0000000000000403 <mkdir>:
+SYSCALL_FAST(mkdir)
+ 403:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+ 40a:	0f 05                	syscall
+ 40c:	c3                   	ret
+
+000000000000040d <chdir>:
+SYSCALL_FAST(chdir)
+ 40d:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+ 414:	0f 05                	syscall
+ 416:	c3                   	ret
+
+0000000000000417 <dup>:
+SYSCALL_FAST(dup)
+ 417:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+ 41e:	0f 05                	syscall
+ 420:	c3                   	ret
+
+0000000000000421 <sbrk>:
+SYSCALL_FAST(sbrk)
+ 421:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+ 428:	0f 05                	syscall
+ 42a:	c3                   	ret
+
+000000000000042b <sleep>:
+SYSCALL_FAST(sleep)
+ 42b:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+ 432:	0f 05                	syscall
+ 434:	c3                   	ret
+
+0000000000000435 <send>:
+SYSCALL_FAST(send)
+ 435:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+ 43c:	0f 05                	syscall
+ 43e:	c3                   	ret
+
+000000000000043f <send_recv>:
+SYSCALL_FAST(send_recv)
+ 43f:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+ 446:	0f 05                	syscall
+ 448:	c3                   	ret
+
+0000000000000449 <recv>:
+SYSCALL_FAST(recv)
+ 449:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+ 450:	0f 05                	syscall
+ 452:	c3                   	ret
+
+0000000000000453 <call>:
+SYSCALL_FAST(call)
+ 453:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+ 45a:	0f 05                	syscall
+ 45c:	c3                   	ret
+
+000000000000045d <reply_recv>:
+SYSCALL_FAST(reply_recv)
+ 45d:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+ 464:	0f 05                	syscall
+ 466:	c3                   	ret
+
+0000000000000467 <send_reg>:
+SYSCALL_REG(send_reg)
+ 467:	41 54                	push   %r12
+ 469:	41 55                	push   %r13
+ 46b:	41 56                	push   %r14
+ 46d:	41 57                	push   %r15
+ 46f:	56                   	push   %rsi
+ 470:	49 89 f3             	mov    %rsi,%r11
+ 473:	48 89 d6             	mov    %rdx,%rsi
+ 476:	49 8b 13             	mov    (%r11),%rdx
+ 479:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 47d:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 481:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 485:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 489:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 48d:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 491:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 495:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+ 49c:	0f 05                	syscall
+ 49e:	41 5b                	pop    %r11
+ 4a0:	49 89 13             	mov    %rdx,(%r11)
+ 4a3:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 4a7:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 4ab:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 4af:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 4b3:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 4b7:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 4bb:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 4bf:	41 5f                	pop    %r15
+ 4c1:	41 5e                	pop    %r14
+ 4c3:	41 5d                	pop    %r13
+ 4c5:	41 5c                	pop    %r12
+ 4c7:	c3                   	ret
+
+00000000000004c8 <recv_reg>:
+SYSCALL_REG(recv_reg)
+ 4c8:	41 54                	push   %r12
+ 4ca:	41 55                	push   %r13
+ 4cc:	41 56                	push   %r14
+ 4ce:	41 57                	push   %r15
+ 4d0:	56                   	push   %rsi
+ 4d1:	49 89 f3             	mov    %rsi,%r11
+ 4d4:	48 89 d6             	mov    %rdx,%rsi
+ 4d7:	49 8b 13             	mov    (%r11),%rdx
+ 4da:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 4de:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 4e2:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 4e6:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 4ea:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 4ee:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 4f2:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 4f6:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+ 4fd:	0f 05                	syscall
+ 4ff:	41 5b                	pop    %r11
+ 501:	49 89 13             	mov    %rdx,(%r11)
+ 504:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 508:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 50c:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 510:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 514:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 518:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 51c:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 520:	41 5f                	pop    %r15
+ 522:	41 5e                	pop    %r14
+ 524:	41 5d                	pop    %r13
+ 526:	41 5c                	pop    %r12
+ 528:	c3                   	ret
+
+0000000000000529 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+ 529:	41 54                	push   %r12
+ 52b:	41 55                	push   %r13
+ 52d:	41 56                	push   %r14
+ 52f:	41 57                	push   %r15
+ 531:	56                   	push   %rsi
+ 532:	49 89 f3             	mov    %rsi,%r11
+ 535:	48 89 d6             	mov    %rdx,%rsi
+ 538:	49 8b 13             	mov    (%r11),%rdx
+ 53b:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 53f:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 543:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 547:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 54b:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 54f:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 553:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 557:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+ 55e:	0f 05                	syscall
+ 560:	41 5b                	pop    %r11
+ 562:	49 89 13             	mov    %rdx,(%r11)
+ 565:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 569:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 56d:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 571:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 575:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 579:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 57d:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 581:	41 5f                	pop    %r15
+ 583:	41 5e                	pop    %r14
+ 585:	41 5d                	pop    %r13
+ 587:	41 5c                	pop    %r12
+ 589:	c3                   	ret
+
+000000000000058a <call_reg>:
+SYSCALL_REG(call_reg)
+ 58a:	41 54                	push   %r12
+ 58c:	41 55                	push   %r13
+ 58e:	41 56                	push   %r14
+ 590:	41 57                	push   %r15
+ 592:	56                   	push   %rsi
+ 593:	49 89 f3             	mov    %rsi,%r11
+ 596:	48 89 d6             	mov    %rdx,%rsi
+ 599:	49 8b 13             	mov    (%r11),%rdx
+ 59c:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 5a0:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 5a4:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 5a8:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 5ac:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 5b0:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 5b4:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 5b8:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+ 5bf:	0f 05                	syscall
+ 5c1:	41 5b                	pop    %r11
+ 5c3:	49 89 13             	mov    %rdx,(%r11)
+ 5c6:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 5ca:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 5ce:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 5d2:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 5d6:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 5da:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 5de:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 5e2:	41 5f                	pop    %r15
+ 5e4:	41 5e                	pop    %r14
+ 5e6:	41 5d                	pop    %r13
+ 5e8:	41 5c                	pop    %r12
+ 5ea:	c3                   	ret
+
+00000000000005eb <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+ 5eb:	41 54                	push   %r12
+ 5ed:	41 55                	push   %r13
+ 5ef:	41 56                	push   %r14
+ 5f1:	41 57                	push   %r15
+ 5f3:	56                   	push   %rsi
+ 5f4:	49 89 f3             	mov    %rsi,%r11
+ 5f7:	48 89 d6             	mov    %rdx,%rsi
+ 5fa:	49 8b 13             	mov    (%r11),%rdx
+ 5fd:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 601:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 605:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 609:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 60d:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 611:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 615:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 619:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+ 620:	0f 05                	syscall
+ 622:	41 5b                	pop    %r11
+ 624:	49 89 13             	mov    %rdx,(%r11)
+ 627:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 62b:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 62f:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 633:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 637:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 63b:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 63f:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 643:	41 5f                	pop    %r15
+ 645:	41 5e                	pop    %r14
+ 647:	41 5d                	pop    %r13
+ 649:	41 5c                	pop    %r12
+ 64b:	c3                   	ret
+
+000000000000064c <sendx>:
+SYSCALL_FAST(sendx)
+ 64c:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+ 653:	0f 05                	syscall
+ 655:	c3                   	ret
+
+0000000000000656 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+ 656:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+ 65d:	0f 05                	syscall
+ 65f:	c3                   	ret
+
+0000000000000660 <notify>:
+SYSCALL_FAST(notify)
+ 660:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+ 667:	0f 05                	syscall
+ 669:	c3                   	ret
+
+000000000000066a <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+ 66a:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+ 671:	0f 05                	syscall
+ 673:	c3                   	ret
+
+0000000000000674 <send_timed>:
+SYSCALL_FAST(send_timed)
+ 674:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+ 67b:	0f 05                	syscall
+ 67d:	c3                   	ret
+
+000000000000067e <recv_timed>:
+SYSCALL_FAST(recv_timed)
+ 67e:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+ 685:	0f 05                	syscall
+ 687:	c3                   	ret
+
+0000000000000688 <set_add>:
+SYSCALL_FAST(set_add)
+ 688:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+ 68f:	0f 05                	syscall
+ 691:	c3                   	ret
+
+0000000000000692 <set_del>:
+SYSCALL_FAST(set_del)
+ 692:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+ 699:	0f 05                	syscall
+ 69b:	c3                   	ret
+
+000000000000069c <recv_any>:
+SYSCALL_FAST(recv_any)
+ 69c:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+ 6a3:	0f 05                	syscall
+ 6a5:	c3                   	ret
+
+00000000000006a6 <ep_create>:
+SYSCALL_FAST(ep_create)
+ 6a6:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+ 6ad:	0f 05                	syscall
+ 6af:	c3                   	ret
+
+00000000000006b0 <ep_close>:
+SYSCALL_FAST(ep_close)
+ 6b0:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+ 6b7:	0f 05                	syscall
+ 6b9:	c3                   	ret
+
+00000000000006ba <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+ 6ba:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+ 6c1:	0f 05                	syscall
+ 6c3:	c3                   	ret
+
+00000000000006c4 <setprio>:
+SYSCALL_FAST(setprio)
+ 6c4:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+ 6cb:	0f 05                	syscall
+ 6cd:	c3                   	ret
+
+00000000000006ce <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+ 6ce:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+ 6d5:	0f 05                	syscall
+ 6d7:	c3                   	ret
+
+00000000000006d8 <sethuge>:
+SYSCALL_FAST(sethuge)
+ 6d8:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+ 6df:	0f 05                	syscall
+ 6e1:	c3                   	ret
+
+00000000000006e2 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+ 6e2:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+ 6e9:	0f 05                	syscall
+ 6eb:	c3                   	ret
+
+00000000000006ec <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+ 6ec:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+ 6f3:	0f 05                	syscall
+ 6f5:	c3                   	ret
+
+00000000000006f6 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+ 6f6:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+ 6fd:	0f 05                	syscall
+ 6ff:	c3                   	ret
+
+0000000000000700 <null_call>:
+ 700:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+ 707:	0f 05                	syscall
+ 709:	c3                   	ret
+
+000000000000070a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 70a:	55                   	push   %rbp
+ 70b:	48 89 e5             	mov    %rsp,%rbp
+ 70e:	48 83 ec 10          	sub    $0x10,%rsp
+ 712:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 715:	89 f0                	mov    %esi,%eax
+ 717:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+ 71a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 71e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 721:	ba 01 00 00 00       	mov    $0x1,%edx
+ 726:	48 89 ce             	mov    %rcx,%rsi
+ 729:	89 c7                	mov    %eax,%edi
+ 72b:	e8 79 fc ff ff       	call   3a9 <write>
+}
+ 730:	90                   	nop
+ 731:	c9                   	leave
+ 732:	c3                   	ret
+
+0000000000000733 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 733:	55                   	push   %rbp
+ 734:	48 89 e5             	mov    %rsp,%rbp
+ 737:	48 83 ec 30          	sub    $0x30,%rsp
+ 73b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 73e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 741:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 744:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 747:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 74e:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 752:	74 17                	je     76b <printint+0x38>
+ 754:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 758:	79 11                	jns    76b <printint+0x38>
+    neg = 1;
+ 75a:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 761:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 764:	f7 d8                	neg    %eax
+ 766:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 769:	eb 06                	jmp    771 <printint+0x3e>
+  } else {
+    x = xx;
+ 76b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 76e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 771:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 778:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 77b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 77e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 783:	f7 f1                	div    %ecx
+ 785:	89 d1                	mov    %edx,%ecx
+ 787:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 78a:	8d 50 01             	lea    0x1(%rax),%edx
+ 78d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 790:	89 ca                	mov    %ecx,%edx
+ 792:	0f b6 92 c0 12 00 00 	movzbl 0x12c0(%rdx),%edx
+ 799:	48 98                	cltq
+ 79b:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 79f:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 7a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 7a5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7aa:	f7 f6                	div    %esi
+ 7ac:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 7af:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 7b3:	75 c3                	jne    778 <printint+0x45>
+  if(neg)
+ 7b5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 7b9:	74 2b                	je     7e6 <printint+0xb3>
+    buf[i++] = '-';
+ 7bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7be:	8d 50 01             	lea    0x1(%rax),%edx
+ 7c1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 7c4:	48 98                	cltq
+ 7c6:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 7cb:	eb 19                	jmp    7e6 <printint+0xb3>
+    putc(fd, buf[i]);
+ 7cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7d0:	48 98                	cltq
+ 7d2:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+ 7d7:	0f be d0             	movsbl %al,%edx
+ 7da:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7dd:	89 d6                	mov    %edx,%esi
+ 7df:	89 c7                	mov    %eax,%edi
+ 7e1:	e8 24 ff ff ff       	call   70a <putc>
+  while(--i >= 0)
+ 7e6:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 7ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 7ee:	79 dd                	jns    7cd <printint+0x9a>
+}
+ 7f0:	90                   	nop
+ 7f1:	90                   	nop
+ 7f2:	c9                   	leave
+ 7f3:	c3                   	ret
+
+00000000000007f4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7f4:	55                   	push   %rbp
+ 7f5:	48 89 e5             	mov    %rsp,%rbp
+ 7f8:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+ 7ff:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+ 805:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+ 80c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+ 813:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+ 81a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+ 821:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+ 828:	84 c0                	test   %al,%al
+ 82a:	74 20                	je     84c <printf+0x58>
+ 82c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+ 830:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+ 834:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+ 838:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+ 83c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+ 840:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+ 844:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+ 848:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 84c:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+ 853:	00 00 00 
+ 856:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+ 85d:	00 00 00 
+ 860:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 864:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+ 86b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+ 872:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+ 879:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ 880:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ 883:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+ 88a:	00 00 00 
+ 88d:	e9 a8 02 00 00       	jmp    b3a <printf+0x346>
+    c = fmt[i] & 0xff;
+ 892:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ 898:	48 63 d0             	movslq %eax,%rdx
+ 89b:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ 8a2:	48 01 d0             	add    %rdx,%rax
+ 8a5:	0f b6 00             	movzbl (%rax),%eax
+ 8a8:	0f be c0             	movsbl %al,%eax
+ 8ab:	25 ff 00 00 00       	and    $0xff,%eax
+ 8b0:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+ 8b6:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+ 8bd:	75 35                	jne    8f4 <printf+0x100>
+      if(c == '%'){
+ 8bf:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ 8c6:	75 0f                	jne    8d7 <printf+0xe3>
+        state = '%';
+ 8c8:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+ 8cf:	00 00 00 
+ 8d2:	e9 5c 02 00 00       	jmp    b33 <printf+0x33f>
+      } else {
+        putc(fd, c);
+ 8d7:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ 8dd:	0f be d0             	movsbl %al,%edx
+ 8e0:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 8e6:	89 d6                	mov    %edx,%esi
+ 8e8:	89 c7                	mov    %eax,%edi
+ 8ea:	e8 1b fe ff ff       	call   70a <putc>
+ 8ef:	e9 3f 02 00 00       	jmp    b33 <printf+0x33f>
+      }
+    } else if(state == '%'){
+ 8f4:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+ 8fb:	0f 85 32 02 00 00    	jne    b33 <printf+0x33f>
+      if(c == 'd'){
+ 901:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+ 908:	75 5e                	jne    968 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 90a:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 910:	83 f8 2f             	cmp    $0x2f,%eax
+ 913:	77 23                	ja     938 <printf+0x144>
+ 915:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 91c:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 922:	89 d2                	mov    %edx,%edx
+ 924:	48 01 d0             	add    %rdx,%rax
+ 927:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 92d:	83 c2 08             	add    $0x8,%edx
+ 930:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 936:	eb 12                	jmp    94a <printf+0x156>
+ 938:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 93f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 943:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 94a:	8b 30                	mov    (%rax),%esi
+ 94c:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 952:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 957:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 95c:	89 c7                	mov    %eax,%edi
+ 95e:	e8 d0 fd ff ff       	call   733 <printint>
+ 963:	e9 c1 01 00 00       	jmp    b29 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+ 968:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+ 96f:	74 09                	je     97a <printf+0x186>
+ 971:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+ 978:	75 5e                	jne    9d8 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 97a:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 980:	83 f8 2f             	cmp    $0x2f,%eax
+ 983:	77 23                	ja     9a8 <printf+0x1b4>
+ 985:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 98c:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 992:	89 d2                	mov    %edx,%edx
+ 994:	48 01 d0             	add    %rdx,%rax
+ 997:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 99d:	83 c2 08             	add    $0x8,%edx
+ 9a0:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 9a6:	eb 12                	jmp    9ba <printf+0x1c6>
+ 9a8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 9af:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 9b3:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 9ba:	8b 30                	mov    (%rax),%esi
+ 9bc:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 9c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 9c7:	ba 10 00 00 00       	mov    $0x10,%edx
+ 9cc:	89 c7                	mov    %eax,%edi
+ 9ce:	e8 60 fd ff ff       	call   733 <printint>
+ 9d3:	e9 51 01 00 00       	jmp    b29 <printf+0x335>
+      } else if(c == 's'){
+ 9d8:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+ 9df:	0f 85 98 00 00 00    	jne    a7d <printf+0x289>
+        s = va_arg(ap, char*);
+ 9e5:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 9eb:	83 f8 2f             	cmp    $0x2f,%eax
+ 9ee:	77 23                	ja     a13 <printf+0x21f>
+ 9f0:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 9f7:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 9fd:	89 d2                	mov    %edx,%edx
+ 9ff:	48 01 d0             	add    %rdx,%rax
+ a02:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a08:	83 c2 08             	add    $0x8,%edx
+ a0b:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ a11:	eb 12                	jmp    a25 <printf+0x231>
+ a13:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ a1a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ a1e:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ a25:	48 8b 00             	mov    (%rax),%rax
+ a28:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+ a2f:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+ a36:	00 
+ a37:	75 31                	jne    a6a <printf+0x276>
+          s = "(null)";
+ a39:	48 c7 85 48 ff ff ff 	movq   $0xfd7,-0xb8(%rbp)
+ a40:	d7 0f 00 00 
+        while(*s != 0){
+ a44:	eb 24                	jmp    a6a <printf+0x276>
+          putc(fd, *s);
+ a46:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a4d:	0f b6 00             	movzbl (%rax),%eax
+ a50:	0f be d0             	movsbl %al,%edx
+ a53:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ a59:	89 d6                	mov    %edx,%esi
+ a5b:	89 c7                	mov    %eax,%edi
+ a5d:	e8 a8 fc ff ff       	call   70a <putc>
+          s++;
+ a62:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+ a69:	01 
+        while(*s != 0){
+ a6a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a71:	0f b6 00             	movzbl (%rax),%eax
+ a74:	84 c0                	test   %al,%al
+ a76:	75 ce                	jne    a46 <printf+0x252>
+ a78:	e9 ac 00 00 00       	jmp    b29 <printf+0x335>
+        }
+      } else if(c == 'c'){
+ a7d:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+ a84:	75 56                	jne    adc <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+ a86:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ a8c:	83 f8 2f             	cmp    $0x2f,%eax
+ a8f:	77 23                	ja     ab4 <printf+0x2c0>
+ a91:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ a98:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a9e:	89 d2                	mov    %edx,%edx
+ aa0:	48 01 d0             	add    %rdx,%rax
+ aa3:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ aa9:	83 c2 08             	add    $0x8,%edx
+ aac:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ ab2:	eb 12                	jmp    ac6 <printf+0x2d2>
+ ab4:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ abb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ abf:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ ac6:	8b 00                	mov    (%rax),%eax
+ ac8:	0f be d0             	movsbl %al,%edx
+ acb:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ ad1:	89 d6                	mov    %edx,%esi
+ ad3:	89 c7                	mov    %eax,%edi
+ ad5:	e8 30 fc ff ff       	call   70a <putc>
+ ada:	eb 4d                	jmp    b29 <printf+0x335>
+      } else if(c == '%'){
+ adc:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ ae3:	75 1a                	jne    aff <printf+0x30b>
+        putc(fd, c);
+ ae5:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ aeb:	0f be d0             	movsbl %al,%edx
+ aee:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ af4:	89 d6                	mov    %edx,%esi
+ af6:	89 c7                	mov    %eax,%edi
+ af8:	e8 0d fc ff ff       	call   70a <putc>
+ afd:	eb 2a                	jmp    b29 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ aff:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ b05:	be 25 00 00 00       	mov    $0x25,%esi
+ b0a:	89 c7                	mov    %eax,%edi
+ b0c:	e8 f9 fb ff ff       	call   70a <putc>
+        putc(fd, c);
+ b11:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ b17:	0f be d0             	movsbl %al,%edx
+ b1a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ b20:	89 d6                	mov    %edx,%esi
+ b22:	89 c7                	mov    %eax,%edi
+ b24:	e8 e1 fb ff ff       	call   70a <putc>
+      }
+      state = 0;
+ b29:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ b30:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ b33:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+ b3a:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ b40:	48 63 d0             	movslq %eax,%rdx
+ b43:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ b4a:	48 01 d0             	add    %rdx,%rax
+ b4d:	0f b6 00             	movzbl (%rax),%eax
+ b50:	84 c0                	test   %al,%al
+ b52:	0f 85 3a fd ff ff    	jne    892 <printf+0x9e>
+    }
+  }
+}
+ b58:	90                   	nop
+ b59:	90                   	nop
+ b5a:	c9                   	leave
+ b5b:	c3                   	ret
+
+0000000000000b5c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b5c:	55                   	push   %rbp
+ b5d:	48 89 e5             	mov    %rsp,%rbp
+ b60:	48 83 ec 18          	sub    $0x18,%rsp
+ b64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ b6c:	48 83 e8 10          	sub    $0x10,%rax
+ b70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b74:	48 8b 05 75 07 00 00 	mov    0x775(%rip),%rax        # 12f0 <freep>
+ b7b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b7f:	eb 2f                	jmp    bb0 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b85:	48 8b 00             	mov    (%rax),%rax
+ b88:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b8c:	72 17                	jb     ba5 <free+0x49>
+ b8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b92:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b96:	72 2f                	jb     bc7 <free+0x6b>
+ b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b9c:	48 8b 00             	mov    (%rax),%rax
+ b9f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ ba3:	72 22                	jb     bc7 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ba5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ba9:	48 8b 00             	mov    (%rax),%rax
+ bac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ bb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bb4:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ bb8:	73 c7                	jae    b81 <free+0x25>
+ bba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bbe:	48 8b 00             	mov    (%rax),%rax
+ bc1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ bc5:	73 ba                	jae    b81 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bcb:	8b 40 08             	mov    0x8(%rax),%eax
+ bce:	89 c0                	mov    %eax,%eax
+ bd0:	48 c1 e0 04          	shl    $0x4,%rax
+ bd4:	48 89 c2             	mov    %rax,%rdx
+ bd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bdb:	48 01 c2             	add    %rax,%rdx
+ bde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be2:	48 8b 00             	mov    (%rax),%rax
+ be5:	48 39 c2             	cmp    %rax,%rdx
+ be8:	75 2d                	jne    c17 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+ bea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bee:	8b 50 08             	mov    0x8(%rax),%edx
+ bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bf5:	48 8b 00             	mov    (%rax),%rax
+ bf8:	8b 40 08             	mov    0x8(%rax),%eax
+ bfb:	01 c2                	add    %eax,%edx
+ bfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c01:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c08:	48 8b 00             	mov    (%rax),%rax
+ c0b:	48 8b 10             	mov    (%rax),%rdx
+ c0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c12:	48 89 10             	mov    %rdx,(%rax)
+ c15:	eb 0e                	jmp    c25 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+ c17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c1b:	48 8b 10             	mov    (%rax),%rdx
+ c1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c22:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ c25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c29:	8b 40 08             	mov    0x8(%rax),%eax
+ c2c:	89 c0                	mov    %eax,%eax
+ c2e:	48 c1 e0 04          	shl    $0x4,%rax
+ c32:	48 89 c2             	mov    %rax,%rdx
+ c35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c39:	48 01 d0             	add    %rdx,%rax
+ c3c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ c40:	75 27                	jne    c69 <free+0x10d>
+    p->s.size += bp->s.size;
+ c42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c46:	8b 50 08             	mov    0x8(%rax),%edx
+ c49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c4d:	8b 40 08             	mov    0x8(%rax),%eax
+ c50:	01 c2                	add    %eax,%edx
+ c52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c56:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ c59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c5d:	48 8b 10             	mov    (%rax),%rdx
+ c60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c64:	48 89 10             	mov    %rdx,(%rax)
+ c67:	eb 0b                	jmp    c74 <free+0x118>
+  } else
+    p->s.ptr = bp;
+ c69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c6d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ c71:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ c74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c78:	48 89 05 71 06 00 00 	mov    %rax,0x671(%rip)        # 12f0 <freep>
+}
+ c7f:	90                   	nop
+ c80:	c9                   	leave
+ c81:	c3                   	ret
+
+0000000000000c82 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c82:	55                   	push   %rbp
+ c83:	48 89 e5             	mov    %rsp,%rbp
+ c86:	48 83 ec 20          	sub    $0x20,%rsp
+ c8a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c8d:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ c94:	77 07                	ja     c9d <morecore+0x1b>
+    nu = 4096;
+ c96:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ c9d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ ca0:	c1 e0 04             	shl    $0x4,%eax
+ ca3:	89 c7                	mov    %eax,%edi
+ ca5:	e8 77 f7 ff ff       	call   421 <sbrk>
+ caa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ cae:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ cb3:	75 07                	jne    cbc <morecore+0x3a>
+    return 0;
+ cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+ cba:	eb 29                	jmp    ce5 <morecore+0x63>
+  hp = (Header*)p;
+ cbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cc0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ cc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cc8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ ccb:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ cce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cd2:	48 83 c0 10          	add    $0x10,%rax
+ cd6:	48 89 c7             	mov    %rax,%rdi
+ cd9:	e8 7e fe ff ff       	call   b5c <free>
+  return freep;
+ cde:	48 8b 05 0b 06 00 00 	mov    0x60b(%rip),%rax        # 12f0 <freep>
+}
+ ce5:	c9                   	leave
+ ce6:	c3                   	ret
+
+0000000000000ce7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ce7:	55                   	push   %rbp
+ ce8:	48 89 e5             	mov    %rsp,%rbp
+ ceb:	48 83 ec 30          	sub    $0x30,%rsp
+ cef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cf2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ cf5:	48 83 c0 0f          	add    $0xf,%rax
+ cf9:	48 c1 e8 04          	shr    $0x4,%rax
+ cfd:	83 c0 01             	add    $0x1,%eax
+ d00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+ d03:	48 8b 05 e6 05 00 00 	mov    0x5e6(%rip),%rax        # 12f0 <freep>
+ d0a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ d0e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ d13:	75 2b                	jne    d40 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+ d15:	48 c7 45 f0 e0 12 00 	movq   $0x12e0,-0x10(%rbp)
+ d1c:	00 
+ d1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d21:	48 89 05 c8 05 00 00 	mov    %rax,0x5c8(%rip)        # 12f0 <freep>
+ d28:	48 8b 05 c1 05 00 00 	mov    0x5c1(%rip),%rax        # 12f0 <freep>
+ d2f:	48 89 05 aa 05 00 00 	mov    %rax,0x5aa(%rip)        # 12e0 <base>
+    base.s.size = 0;
+ d36:	c7 05 a8 05 00 00 00 	movl   $0x0,0x5a8(%rip)        # 12e8 <base+0x8>
+ d3d:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d44:	48 8b 00             	mov    (%rax),%rax
+ d47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ d4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d4f:	8b 40 08             	mov    0x8(%rax),%eax
+ d52:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ d55:	72 5f                	jb     db6 <malloc+0xcf>
+      if(p->s.size == nunits)
+ d57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d5b:	8b 40 08             	mov    0x8(%rax),%eax
+ d5e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ d61:	75 10                	jne    d73 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+ d63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d67:	48 8b 10             	mov    (%rax),%rdx
+ d6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d6e:	48 89 10             	mov    %rdx,(%rax)
+ d71:	eb 2e                	jmp    da1 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+ d73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d77:	8b 40 08             	mov    0x8(%rax),%eax
+ d7a:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ d7d:	89 c2                	mov    %eax,%edx
+ d7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d83:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ d86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d8a:	8b 40 08             	mov    0x8(%rax),%eax
+ d8d:	89 c0                	mov    %eax,%eax
+ d8f:	48 c1 e0 04          	shl    $0x4,%rax
+ d93:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ d97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d9b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ d9e:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ da1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ da5:	48 89 05 44 05 00 00 	mov    %rax,0x544(%rip)        # 12f0 <freep>
+      return (void*)(p + 1);
+ dac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ db0:	48 83 c0 10          	add    $0x10,%rax
+ db4:	eb 41                	jmp    df7 <malloc+0x110>
+    }
+    if(p == freep)
+ db6:	48 8b 05 33 05 00 00 	mov    0x533(%rip),%rax        # 12f0 <freep>
+ dbd:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ dc1:	75 1c                	jne    ddf <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+ dc3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ dc6:	89 c7                	mov    %eax,%edi
+ dc8:	e8 b5 fe ff ff       	call   c82 <morecore>
+ dcd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ dd1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ dd6:	75 07                	jne    ddf <malloc+0xf8>
+        return 0;
+ dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+ ddd:	eb 18                	jmp    df7 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ddf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ de3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ de7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ deb:	48 8b 00             	mov    (%rax),%rax
+ dee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ df2:	e9 54 ff ff ff       	jmp    d4b <malloc+0x64>
+  }
+}
+ df7:	c9                   	leave
+ df8:	c3                   	ret
+
+0000000000000df9 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+ df9:	55                   	push   %rbp
+ dfa:	48 89 e5             	mov    %rsp,%rbp
+ dfd:	53                   	push   %rbx
+ dfe:	48 83 ec 38          	sub    $0x38,%rsp
+ e02:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ e05:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ e09:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+ e0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e11:	8b 40 40             	mov    0x40(%rax),%eax
+ e14:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+ e17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e1b:	8b 00                	mov    (%rax),%eax
+ e1d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ e20:	29 c2                	sub    %eax,%edx
+ e22:	83 fa 20             	cmp    $0x20,%edx
+ e25:	75 0a                	jne    e31 <ring_send+0x38>
+    return -1;
+ e27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e2c:	e9 93 00 00 00       	jmp    ec4 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+ e31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e34:	83 e0 1f             	and    $0x1f,%eax
+ e37:	89 c2                	mov    %eax,%edx
+ e39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e3d:	89 d2                	mov    %edx,%edx
+ e3f:	48 83 c2 02          	add    $0x2,%rdx
+ e43:	48 c1 e2 06          	shl    $0x6,%rdx
+ e47:	48 01 c2             	add    %rax,%rdx
+ e4a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ e4e:	48 8b 08             	mov    (%rax),%rcx
+ e51:	48 8b 58 08          	mov    0x8(%rax),%rbx
+ e55:	48 89 0a             	mov    %rcx,(%rdx)
+ e58:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+ e5c:	48 8b 48 10          	mov    0x10(%rax),%rcx
+ e60:	48 8b 58 18          	mov    0x18(%rax),%rbx
+ e64:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+ e68:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+ e6c:	48 8b 48 20          	mov    0x20(%rax),%rcx
+ e70:	48 8b 58 28          	mov    0x28(%rax),%rbx
+ e74:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+ e78:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+ e7c:	48 8b 48 30          	mov    0x30(%rax),%rcx
+ e80:	48 8b 58 38          	mov    0x38(%rax),%rbx
+ e84:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+ e88:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+ e8c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+ e92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e95:	8d 50 01             	lea    0x1(%rax),%edx
+ e98:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e9c:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+ e9f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+ ea5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ ea9:	8b 00                	mov    (%rax),%eax
+ eab:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ eae:	75 0f                	jne    ebf <ring_send+0xc6>
+    notify(channel, 1);
+ eb0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ eb3:	be 01 00 00 00       	mov    $0x1,%esi
+ eb8:	89 c7                	mov    %eax,%edi
+ eba:	e8 a1 f7 ff ff       	call   660 <notify>
+  return 0;
+ ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ ec4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ ec8:	c9                   	leave
+ ec9:	c3                   	ret
+
+0000000000000eca <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+ eca:	55                   	push   %rbp
+ ecb:	48 89 e5             	mov    %rsp,%rbp
+ ece:	53                   	push   %rbx
+ ecf:	48 83 ec 38          	sub    $0x38,%rsp
+ ed3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ ed6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ eda:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+ ede:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ ee2:	8b 00                	mov    (%rax),%eax
+ ee4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+ ee7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+ eed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ ef1:	8b 40 40             	mov    0x40(%rax),%eax
+ ef4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ ef7:	75 15                	jne    f0e <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+ ef9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ efc:	89 c7                	mov    %eax,%edi
+ efe:	e8 67 f7 ff ff       	call   66a <nfy_wait>
+ f03:	85 c0                	test   %eax,%eax
+ f05:	79 e0                	jns    ee7 <ring_recv+0x1d>
+      return -1;
+ f07:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f0c:	eb 73                	jmp    f81 <ring_recv+0xb7>
+      break;
+ f0e:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+ f0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ f12:	83 e0 1f             	and    $0x1f,%eax
+ f15:	89 c1                	mov    %eax,%ecx
+ f17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ f1b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ f1f:	89 c9                	mov    %ecx,%ecx
+ f21:	48 83 c1 02          	add    $0x2,%rcx
+ f25:	48 c1 e1 06          	shl    $0x6,%rcx
+ f29:	48 01 ca             	add    %rcx,%rdx
+ f2c:	48 8b 0a             	mov    (%rdx),%rcx
+ f2f:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+ f33:	48 89 08             	mov    %rcx,(%rax)
+ f36:	48 89 58 08          	mov    %rbx,0x8(%rax)
+ f3a:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+ f3e:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+ f42:	48 89 48 10          	mov    %rcx,0x10(%rax)
+ f46:	48 89 58 18          	mov    %rbx,0x18(%rax)
+ f4a:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+ f4e:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+ f52:	48 89 48 20          	mov    %rcx,0x20(%rax)
+ f56:	48 89 58 28          	mov    %rbx,0x28(%rax)
+ f5a:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+ f5e:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+ f62:	48 89 48 30          	mov    %rcx,0x30(%rax)
+ f66:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+ f6a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+ f70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ f73:	8d 50 01             	lea    0x1(%rax),%edx
+ f76:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ f7a:	89 10                	mov    %edx,(%rax)
+  return 0;
+ f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ f81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ f85:	c9                   	leave
+ f86:	c3                   	ret
+
+0000000000000f87 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+ f87:	55                   	push   %rbp
+ f88:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+ f8b:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ f90:	8b 00                	mov    (%rax),%eax
+}
+ f92:	5d                   	pop    %rbp
+ f93:	c3                   	ret
+
+0000000000000f94 <getpid>:
+
+int
+getpid(void)
+{
+ f94:	55                   	push   %rbp
+ f95:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+ f98:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+ f9d:	8b 00                	mov    (%rax),%eax
+}
+ f9f:	5d                   	pop    %rbp
+ fa0:	c3                   	ret
+
+0000000000000fa1 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+ fa1:	55                   	push   %rbp
+ fa2:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+ fa5:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ faa:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+ fae:	5d                   	pop    %rbp
+ faf:	c3                   	ret
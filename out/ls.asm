@@ -0,0 +1,1994 @@
+
+fs/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	53                   	push   %rbx
+       5:	48 83 ec 28          	sub    $0x28,%rsp
+       9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  static char buf[DIRSIZ+1];
+  char *p;
+  
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+       d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      11:	48 89 c7             	mov    %rax,%rdi
+      14:	e8 58 04 00 00       	call   471 <strlen>
+      19:	89 c2                	mov    %eax,%edx
+      1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      1f:	48 01 d0             	add    %rdx,%rax
+      22:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      26:	eb 05                	jmp    2d <fmtname+0x2d>
+      28:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+      2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      31:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+      35:	72 0b                	jb     42 <fmtname+0x42>
+      37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      3b:	0f b6 00             	movzbl (%rax),%eax
+      3e:	3c 2f                	cmp    $0x2f,%al
+      40:	75 e6                	jne    28 <fmtname+0x28>
+    ;
+  p++;
+      42:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+      47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      4b:	48 89 c7             	mov    %rax,%rdi
+      4e:	e8 1e 04 00 00       	call   471 <strlen>
+      53:	83 f8 0d             	cmp    $0xd,%eax
+      56:	76 06                	jbe    5e <fmtname+0x5e>
+    return p;
+      58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      5c:	eb 60                	jmp    be <fmtname+0xbe>
+  memmove(buf, p, strlen(p));
+      5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      62:	48 89 c7             	mov    %rax,%rdi
+      65:	e8 07 04 00 00       	call   471 <strlen>
+      6a:	89 c2                	mov    %eax,%edx
+      6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      70:	48 89 c6             	mov    %rax,%rsi
+      73:	48 c7 c7 70 16 00 00 	mov    $0x1670,%rdi
+      7a:	e8 bc 05 00 00       	call   63b <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      83:	48 89 c7             	mov    %rax,%rdi
+      86:	e8 e6 03 00 00       	call   471 <strlen>
+      8b:	ba 0e 00 00 00       	mov    $0xe,%edx
+      90:	89 d3                	mov    %edx,%ebx
+      92:	29 c3                	sub    %eax,%ebx
+      94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      98:	48 89 c7             	mov    %rax,%rdi
+      9b:	e8 d1 03 00 00       	call   471 <strlen>
+      a0:	89 c0                	mov    %eax,%eax
+      a2:	48 05 70 16 00 00    	add    $0x1670,%rax
+      a8:	89 da                	mov    %ebx,%edx
+      aa:	be 20 00 00 00       	mov    $0x20,%esi
+      af:	48 89 c7             	mov    %rax,%rdi
+      b2:	e8 ec 03 00 00       	call   4a3 <memset>
+  return buf;
+      b7:	48 c7 c0 70 16 00 00 	mov    $0x1670,%rax
+}
+      be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+      c2:	c9                   	leave
+      c3:	c3                   	ret
+
+00000000000000c4 <ls>:
+
+void
+ls(char *path)
+{
+      c4:	55                   	push   %rbp
+      c5:	48 89 e5             	mov    %rsp,%rbp
+      c8:	41 55                	push   %r13
+      ca:	41 54                	push   %r12
+      cc:	53                   	push   %rbx
+      cd:	48 81 ec 58 02 00 00 	sub    $0x258,%rsp
+      d4:	48 89 bd 98 fd ff ff 	mov    %rdi,-0x268(%rbp)
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+  
+  if((fd = open(path, 0)) < 0){
+      db:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+      e2:	be 00 00 00 00       	mov    $0x0,%esi
+      e7:	48 89 c7             	mov    %rax,%rdi
+      ea:	e8 fb 05 00 00       	call   6ea <open>
+      ef:	89 45 dc             	mov    %eax,-0x24(%rbp)
+      f2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+      f6:	79 25                	jns    11d <ls+0x59>
+    printf(2, "ls: cannot open %s\n", path);
+      f8:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+      ff:	48 89 c2             	mov    %rax,%rdx
+     102:	48 c7 c6 c9 12 00 00 	mov    $0x12c9,%rsi
+     109:	bf 02 00 00 00       	mov    $0x2,%edi
+     10e:	b8 00 00 00 00       	mov    $0x0,%eax
+     113:	e8 f5 09 00 00       	call   b0d <printf>
+    return;
+     118:	e9 1b 02 00 00       	jmp    338 <ls+0x274>
+  }
+  
+  if(fstat(fd, &st) < 0){
+     11d:	48 8d 95 a0 fd ff ff 	lea    -0x260(%rbp),%rdx
+     124:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     127:	48 89 d6             	mov    %rdx,%rsi
+     12a:	89 c7                	mov    %eax,%edi
+     12c:	e8 d7 05 00 00       	call   708 <fstat>
+     131:	85 c0                	test   %eax,%eax
+     133:	79 2f                	jns    164 <ls+0xa0>
+    printf(2, "ls: cannot stat %s\n", path);
+     135:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+     13c:	48 89 c2             	mov    %rax,%rdx
+     13f:	48 c7 c6 dd 12 00 00 	mov    $0x12dd,%rsi
+     146:	bf 02 00 00 00       	mov    $0x2,%edi
+     14b:	b8 00 00 00 00       	mov    $0x0,%eax
+     150:	e8 b8 09 00 00       	call   b0d <printf>
+    close(fd);
+     155:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     158:	89 c7                	mov    %eax,%edi
+     15a:	e8 6d 05 00 00       	call   6cc <close>
+    return;
+     15f:	e9 d4 01 00 00       	jmp    338 <ls+0x274>
+  }
+  
+  switch(st.type){
+     164:	0f b7 85 a0 fd ff ff 	movzwl -0x260(%rbp),%eax
+     16b:	98                   	cwtl
+     16c:	83 f8 01             	cmp    $0x1,%eax
+     16f:	74 56                	je     1c7 <ls+0x103>
+     171:	83 f8 02             	cmp    $0x2,%eax
+     174:	0f 85 b4 01 00 00    	jne    32e <ls+0x26a>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     17a:	44 8b ad b0 fd ff ff 	mov    -0x250(%rbp),%r13d
+     181:	44 8b a5 a8 fd ff ff 	mov    -0x258(%rbp),%r12d
+     188:	0f b7 85 a0 fd ff ff 	movzwl -0x260(%rbp),%eax
+     18f:	0f bf d8             	movswl %ax,%ebx
+     192:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+     199:	48 89 c7             	mov    %rax,%rdi
+     19c:	e8 5f fe ff ff       	call   0 <fmtname>
+     1a1:	45 89 e9             	mov    %r13d,%r9d
+     1a4:	45 89 e0             	mov    %r12d,%r8d
+     1a7:	89 d9                	mov    %ebx,%ecx
+     1a9:	48 89 c2             	mov    %rax,%rdx
+     1ac:	48 c7 c6 f1 12 00 00 	mov    $0x12f1,%rsi
+     1b3:	bf 01 00 00 00       	mov    $0x1,%edi
+     1b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     1bd:	e8 4b 09 00 00       	call   b0d <printf>
+    break;
+     1c2:	e9 67 01 00 00       	jmp    32e <ls+0x26a>
+  
+  case T_DIR:
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     1c7:	48 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%rax
+     1ce:	48 89 c7             	mov    %rax,%rdi
+     1d1:	e8 9b 02 00 00       	call   471 <strlen>
+     1d6:	83 c0 10             	add    $0x10,%eax
+     1d9:	3d 00 02 00 00       	cmp    $0x200,%eax
+     1de:	76 1b                	jbe    1fb <ls+0x137>
+      printf(1, "ls: path too long\n");
+     1e0:	48 c7 c6 fe 12 00 00 	mov    $0x12fe,%rsi
+     1e7:	bf 01 00 00 00       	mov    $0x1,%edi
+     1ec:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f1:	e8 17 09 00 00       	call   b0d <printf>
+      break;
+     1f6:	e9 33 01 00 00       	jmp    32e <ls+0x26a>
+    }
+    strcpy(buf, path);
+     1fb:	48 8b 95 98 fd ff ff 	mov    -0x268(%rbp),%rdx
+     202:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+     209:	48 89 d6             	mov    %rdx,%rsi
+     20c:	48 89 c7             	mov    %rax,%rdi
+     20f:	e8 c7 01 00 00       	call   3db <strcpy>
+    p = buf+strlen(buf);
+     214:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+     21b:	48 89 c7             	mov    %rax,%rdi
+     21e:	e8 4e 02 00 00       	call   471 <strlen>
+     223:	89 c2                	mov    %eax,%edx
+     225:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+     22c:	48 01 d0             	add    %rdx,%rax
+     22f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    *p++ = '/';
+     233:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     237:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     23b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     23f:	c6 00 2f             	movb   $0x2f,(%rax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     242:	e9 c4 00 00 00       	jmp    30b <ls+0x247>
+      if(de.inum == 0)
+     247:	0f b7 85 c0 fd ff ff 	movzwl -0x240(%rbp),%eax
+     24e:	66 85 c0             	test   %ax,%ax
+     251:	0f 84 b3 00 00 00    	je     30a <ls+0x246>
+        continue;
+      memmove(p, de.name, DIRSIZ);
+     257:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+     25e:	48 8d 48 02          	lea    0x2(%rax),%rcx
+     262:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     266:	ba 0e 00 00 00       	mov    $0xe,%edx
+     26b:	48 89 ce             	mov    %rcx,%rsi
+     26e:	48 89 c7             	mov    %rax,%rdi
+     271:	e8 c5 03 00 00       	call   63b <memmove>
+      p[DIRSIZ] = 0;
+     276:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     27a:	48 83 c0 0e          	add    $0xe,%rax
+     27e:	c6 00 00             	movb   $0x0,(%rax)
+      if(stat(buf, &st) < 0){
+     281:	48 8d 95 a0 fd ff ff 	lea    -0x260(%rbp),%rdx
+     288:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+     28f:	48 89 d6             	mov    %rdx,%rsi
+     292:	48 89 c7             	mov    %rax,%rdi
+     295:	e8 f5 02 00 00       	call   58f <stat>
+     29a:	85 c0                	test   %eax,%eax
+     29c:	79 22                	jns    2c0 <ls+0x1fc>
+        printf(1, "ls: cannot stat %s\n", buf);
+     29e:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+     2a5:	48 89 c2             	mov    %rax,%rdx
+     2a8:	48 c7 c6 dd 12 00 00 	mov    $0x12dd,%rsi
+     2af:	bf 01 00 00 00       	mov    $0x1,%edi
+     2b4:	b8 00 00 00 00       	mov    $0x0,%eax
+     2b9:	e8 4f 08 00 00       	call   b0d <printf>
+        continue;
+     2be:	eb 4b                	jmp    30b <ls+0x247>
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+     2c0:	44 8b ad b0 fd ff ff 	mov    -0x250(%rbp),%r13d
+     2c7:	44 8b a5 a8 fd ff ff 	mov    -0x258(%rbp),%r12d
+     2ce:	0f b7 85 a0 fd ff ff 	movzwl -0x260(%rbp),%eax
+     2d5:	0f bf d8             	movswl %ax,%ebx
+     2d8:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+     2df:	48 89 c7             	mov    %rax,%rdi
+     2e2:	e8 19 fd ff ff       	call   0 <fmtname>
+     2e7:	45 89 e9             	mov    %r13d,%r9d
+     2ea:	45 89 e0             	mov    %r12d,%r8d
+     2ed:	89 d9                	mov    %ebx,%ecx
+     2ef:	48 89 c2             	mov    %rax,%rdx
+     2f2:	48 c7 c6 f1 12 00 00 	mov    $0x12f1,%rsi
+     2f9:	bf 01 00 00 00       	mov    $0x1,%edi
+     2fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     303:	e8 05 08 00 00       	call   b0d <printf>
+     308:	eb 01                	jmp    30b <ls+0x247>
+        continue;
+     30a:	90                   	nop
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     30b:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+     312:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     315:	ba 10 00 00 00       	mov    $0x10,%edx
+     31a:	48 89 ce             	mov    %rcx,%rsi
+     31d:	89 c7                	mov    %eax,%edi
+     31f:	e8 94 03 00 00       	call   6b8 <read>
+     324:	83 f8 10             	cmp    $0x10,%eax
+     327:	0f 84 1a ff ff ff    	je     247 <ls+0x183>
+    }
+    break;
+     32d:	90                   	nop
+  }
+  close(fd);
+     32e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     331:	89 c7                	mov    %eax,%edi
+     333:	e8 94 03 00 00       	call   6cc <close>
+}
+     338:	48 81 c4 58 02 00 00 	add    $0x258,%rsp
+     33f:	5b                   	pop    %rbx
+     340:	41 5c                	pop    %r12
+     342:	41 5d                	pop    %r13
+     344:	5d                   	pop    %rbp
+     345:	c3                   	ret
+
+0000000000000346 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     346:	55                   	push   %rbp
+     347:	48 89 e5             	mov    %rsp,%rbp
+     34a:	48 83 ec 20          	sub    $0x20,%rsp
+     34e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     351:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if(argc < 2){
+     355:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     359:	7f 11                	jg     36c <main+0x26>
+    ls(".");
+     35b:	48 c7 c7 11 13 00 00 	mov    $0x1311,%rdi
+     362:	e8 5d fd ff ff       	call   c4 <ls>
+    exit();
+     367:	e8 2e 03 00 00       	call   69a <exit>
+  }
+  for(i=1; i<argc; i++)
+     36c:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     373:	eb 23                	jmp    398 <main+0x52>
+    ls(argv[i]);
+     375:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     378:	48 98                	cltq
+     37a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     381:	00 
+     382:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     386:	48 01 d0             	add    %rdx,%rax
+     389:	48 8b 00             	mov    (%rax),%rax
+     38c:	48 89 c7             	mov    %rax,%rdi
+     38f:	e8 30 fd ff ff       	call   c4 <ls>
+  for(i=1; i<argc; i++)
+     394:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     398:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     39b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     39e:	7c d5                	jl     375 <main+0x2f>
+  exit();
+     3a0:	e8 f5 02 00 00       	call   69a <exit>
+
+00000000000003a5 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     3a5:	55                   	push   %rbp
+     3a6:	48 89 e5             	mov    %rsp,%rbp
+     3a9:	48 83 ec 10          	sub    $0x10,%rsp
+     3ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     3b1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     3b4:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     3b7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     3bb:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     3be:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     3c1:	48 89 ce             	mov    %rcx,%rsi
+     3c4:	48 89 f7             	mov    %rsi,%rdi
+     3c7:	89 d1                	mov    %edx,%ecx
+     3c9:	fc                   	cld
+     3ca:	f3 aa                	rep stos %al,%es:(%rdi)
+     3cc:	89 ca                	mov    %ecx,%edx
+     3ce:	48 89 fe             	mov    %rdi,%rsi
+     3d1:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     3d5:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     3d8:	90                   	nop
+     3d9:	c9                   	leave
+     3da:	c3                   	ret
+
+00000000000003db <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     3db:	55                   	push   %rbp
+     3dc:	48 89 e5             	mov    %rsp,%rbp
+     3df:	48 83 ec 20          	sub    $0x20,%rsp
+     3e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     3e7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     3eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3ef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     3f3:	90                   	nop
+     3f4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     3f8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     3fc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     404:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     408:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     40c:	0f b6 12             	movzbl (%rdx),%edx
+     40f:	88 10                	mov    %dl,(%rax)
+     411:	0f b6 00             	movzbl (%rax),%eax
+     414:	84 c0                	test   %al,%al
+     416:	75 dc                	jne    3f4 <strcpy+0x19>
+    ;
+  return os;
+     418:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     41c:	c9                   	leave
+     41d:	c3                   	ret
+
+000000000000041e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     41e:	55                   	push   %rbp
+     41f:	48 89 e5             	mov    %rsp,%rbp
+     422:	48 83 ec 10          	sub    $0x10,%rsp
+     426:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     42a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     42e:	eb 0a                	jmp    43a <strcmp+0x1c>
+    p++, q++;
+     430:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     435:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     43a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     43e:	0f b6 00             	movzbl (%rax),%eax
+     441:	84 c0                	test   %al,%al
+     443:	74 12                	je     457 <strcmp+0x39>
+     445:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     449:	0f b6 10             	movzbl (%rax),%edx
+     44c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     450:	0f b6 00             	movzbl (%rax),%eax
+     453:	38 c2                	cmp    %al,%dl
+     455:	74 d9                	je     430 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     457:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     45b:	0f b6 00             	movzbl (%rax),%eax
+     45e:	0f b6 d0             	movzbl %al,%edx
+     461:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     465:	0f b6 00             	movzbl (%rax),%eax
+     468:	0f b6 c0             	movzbl %al,%eax
+     46b:	29 c2                	sub    %eax,%edx
+     46d:	89 d0                	mov    %edx,%eax
+}
+     46f:	c9                   	leave
+     470:	c3                   	ret
+
+0000000000000471 <strlen>:
+
+uint
+strlen(char *s)
+{
+     471:	55                   	push   %rbp
+     472:	48 89 e5             	mov    %rsp,%rbp
+     475:	48 83 ec 18          	sub    $0x18,%rsp
+     479:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     47d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     484:	eb 04                	jmp    48a <strlen+0x19>
+     486:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     48a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     48d:	48 63 d0             	movslq %eax,%rdx
+     490:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     494:	48 01 d0             	add    %rdx,%rax
+     497:	0f b6 00             	movzbl (%rax),%eax
+     49a:	84 c0                	test   %al,%al
+     49c:	75 e8                	jne    486 <strlen+0x15>
+    ;
+  return n;
+     49e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     4a1:	c9                   	leave
+     4a2:	c3                   	ret
+
+00000000000004a3 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     4a3:	55                   	push   %rbp
+     4a4:	48 89 e5             	mov    %rsp,%rbp
+     4a7:	48 83 ec 10          	sub    $0x10,%rsp
+     4ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     4af:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     4b2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     4b5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     4b8:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     4bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4bf:	89 ce                	mov    %ecx,%esi
+     4c1:	48 89 c7             	mov    %rax,%rdi
+     4c4:	e8 dc fe ff ff       	call   3a5 <stosb>
+  return dst;
+     4c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     4cd:	c9                   	leave
+     4ce:	c3                   	ret
+
+00000000000004cf <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4cf:	55                   	push   %rbp
+     4d0:	48 89 e5             	mov    %rsp,%rbp
+     4d3:	48 83 ec 10          	sub    $0x10,%rsp
+     4d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     4db:	89 f0                	mov    %esi,%eax
+     4dd:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     4e0:	eb 17                	jmp    4f9 <strchr+0x2a>
+    if(*s == c)
+     4e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4e6:	0f b6 00             	movzbl (%rax),%eax
+     4e9:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     4ec:	75 06                	jne    4f4 <strchr+0x25>
+      return (char*)s;
+     4ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4f2:	eb 15                	jmp    509 <strchr+0x3a>
+  for(; *s; s++)
+     4f4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     4f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4fd:	0f b6 00             	movzbl (%rax),%eax
+     500:	84 c0                	test   %al,%al
+     502:	75 de                	jne    4e2 <strchr+0x13>
+  return 0;
+     504:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     509:	c9                   	leave
+     50a:	c3                   	ret
+
+000000000000050b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     50b:	55                   	push   %rbp
+     50c:	48 89 e5             	mov    %rsp,%rbp
+     50f:	48 83 ec 20          	sub    $0x20,%rsp
+     513:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     517:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     51a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     521:	eb 48                	jmp    56b <gets+0x60>
+    cc = read(0, &c, 1);
+     523:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     527:	ba 01 00 00 00       	mov    $0x1,%edx
+     52c:	48 89 c6             	mov    %rax,%rsi
+     52f:	bf 00 00 00 00       	mov    $0x0,%edi
+     534:	e8 7f 01 00 00       	call   6b8 <read>
+     539:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     53c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     540:	7e 36                	jle    578 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     542:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     545:	8d 50 01             	lea    0x1(%rax),%edx
+     548:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     54b:	48 63 d0             	movslq %eax,%rdx
+     54e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     552:	48 01 c2             	add    %rax,%rdx
+     555:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     559:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     55b:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     55f:	3c 0a                	cmp    $0xa,%al
+     561:	74 16                	je     579 <gets+0x6e>
+     563:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     567:	3c 0d                	cmp    $0xd,%al
+     569:	74 0e                	je     579 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     56b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     56e:	83 c0 01             	add    $0x1,%eax
+     571:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     574:	7f ad                	jg     523 <gets+0x18>
+     576:	eb 01                	jmp    579 <gets+0x6e>
+      break;
+     578:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     579:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     57c:	48 63 d0             	movslq %eax,%rdx
+     57f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     583:	48 01 d0             	add    %rdx,%rax
+     586:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     589:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     58d:	c9                   	leave
+     58e:	c3                   	ret
+
+000000000000058f <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     58f:	55                   	push   %rbp
+     590:	48 89 e5             	mov    %rsp,%rbp
+     593:	48 83 ec 20          	sub    $0x20,%rsp
+     597:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     59b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     59f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     5a3:	be 00 00 00 00       	mov    $0x0,%esi
+     5a8:	48 89 c7             	mov    %rax,%rdi
+     5ab:	e8 3a 01 00 00       	call   6ea <open>
+     5b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     5b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     5b7:	79 07                	jns    5c0 <stat+0x31>
+    return -1;
+     5b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5be:	eb 21                	jmp    5e1 <stat+0x52>
+  r = fstat(fd, st);
+     5c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     5c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5c7:	48 89 d6             	mov    %rdx,%rsi
+     5ca:	89 c7                	mov    %eax,%edi
+     5cc:	e8 37 01 00 00       	call   708 <fstat>
+     5d1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     5d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5d7:	89 c7                	mov    %eax,%edi
+     5d9:	e8 ee 00 00 00       	call   6cc <close>
+  return r;
+     5de:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     5e1:	c9                   	leave
+     5e2:	c3                   	ret
+
+00000000000005e3 <atoi>:
+
+int
+atoi(const char *s)
+{
+     5e3:	55                   	push   %rbp
+     5e4:	48 89 e5             	mov    %rsp,%rbp
+     5e7:	48 83 ec 18          	sub    $0x18,%rsp
+     5eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     5ef:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     5f6:	eb 28                	jmp    620 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     5f8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     5fb:	89 d0                	mov    %edx,%eax
+     5fd:	c1 e0 02             	shl    $0x2,%eax
+     600:	01 d0                	add    %edx,%eax
+     602:	01 c0                	add    %eax,%eax
+     604:	89 c1                	mov    %eax,%ecx
+     606:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     60a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     60e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     612:	0f b6 00             	movzbl (%rax),%eax
+     615:	0f be c0             	movsbl %al,%eax
+     618:	01 c8                	add    %ecx,%eax
+     61a:	83 e8 30             	sub    $0x30,%eax
+     61d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     620:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     624:	0f b6 00             	movzbl (%rax),%eax
+     627:	3c 2f                	cmp    $0x2f,%al
+     629:	7e 0b                	jle    636 <atoi+0x53>
+     62b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     62f:	0f b6 00             	movzbl (%rax),%eax
+     632:	3c 39                	cmp    $0x39,%al
+     634:	7e c2                	jle    5f8 <atoi+0x15>
+  return n;
+     636:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     639:	c9                   	leave
+     63a:	c3                   	ret
+
+000000000000063b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     63b:	55                   	push   %rbp
+     63c:	48 89 e5             	mov    %rsp,%rbp
+     63f:	48 83 ec 28          	sub    $0x28,%rsp
+     643:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     647:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     64b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     64e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     652:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     656:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     65a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     65e:	eb 1d                	jmp    67d <memmove+0x42>
+    *dst++ = *src++;
+     660:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     664:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     668:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     66c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     670:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     674:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     678:	0f b6 12             	movzbl (%rdx),%edx
+     67b:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     67d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     680:	8d 50 ff             	lea    -0x1(%rax),%edx
+     683:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     686:	85 c0                	test   %eax,%eax
+     688:	7f d6                	jg     660 <memmove+0x25>
+  return vdst;
+     68a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     68e:	c9                   	leave
+     68f:	c3                   	ret
+
+0000000000000690 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     690:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     697:	cd 40                	int    $0x40
+     699:	c3                   	ret
+
+000000000000069a <exit>:
+SYSCALL_FAST(exit)
+     69a:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     6a1:	0f 05                	syscall
+     6a3:	c3                   	ret
+
+00000000000006a4 <wait>:
+SYSCALL_FAST(wait)
+     6a4:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     6ab:	0f 05                	syscall
+     6ad:	c3                   	ret
+
+00000000000006ae <pipe>:
+SYSCALL_FAST(pipe)
+     6ae:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     6b5:	0f 05                	syscall
+     6b7:	c3                   	ret
+
+00000000000006b8 <read>:
+SYSCALL_FAST(read)
+     6b8:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     6bf:	0f 05                	syscall
+     6c1:	c3                   	ret
+
+00000000000006c2 <write>:
+SYSCALL_FAST(write)
+     6c2:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     6c9:	0f 05                	syscall
+     6cb:	c3                   	ret
+
+00000000000006cc <close>:
+SYSCALL_FAST(close)
+     6cc:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     6d3:	0f 05                	syscall
+     6d5:	c3                   	ret
+
+00000000000006d6 <kill>:
+SYSCALL_FAST(kill)
+     6d6:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     6dd:	0f 05                	syscall
+     6df:	c3                   	ret
+
+00000000000006e0 <exec>:
+SYSCALL(exec)
+     6e0:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     6e7:	cd 40                	int    $0x40
+     6e9:	c3                   	ret
+
+00000000000006ea <open>:
+SYSCALL_FAST(open)
+     6ea:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     6f1:	0f 05                	syscall
+     6f3:	c3                   	ret
+
+00000000000006f4 <mknod>:
+SYSCALL_FAST(mknod)
+     6f4:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     6fb:	0f 05                	syscall
+     6fd:	c3                   	ret
+
+00000000000006fe <unlink>:
+SYSCALL_FAST(unlink)
+     6fe:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     705:	0f 05                	syscall
+     707:	c3                   	ret
+
+0000000000000708 <fstat>:
+SYSCALL_FAST(fstat)
+     708:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     70f:	0f 05                	syscall
+     711:	c3                   	ret
+
+0000000000000712 <link>:
+SYSCALL_FAST(link)
+     712:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     719:	0f 05                	syscall
+     71b:	c3                   	ret
+
+000000000000071c <mkdir>:
+SYSCALL_FAST(mkdir)
+     71c:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     723:	0f 05                	syscall
+     725:	c3                   	ret
+
+0000000000000726 <chdir>:
+SYSCALL_FAST(chdir)
+     726:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     72d:	0f 05                	syscall
+     72f:	c3                   	ret
+
+0000000000000730 <dup>:
+SYSCALL_FAST(dup)
+     730:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     737:	0f 05                	syscall
+     739:	c3                   	ret
+
+000000000000073a <sbrk>:
+SYSCALL_FAST(sbrk)
+     73a:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     741:	0f 05                	syscall
+     743:	c3                   	ret
+
+0000000000000744 <sleep>:
+SYSCALL_FAST(sleep)
+     744:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     74b:	0f 05                	syscall
+     74d:	c3                   	ret
+
+000000000000074e <send>:
+SYSCALL_FAST(send)
+     74e:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     755:	0f 05                	syscall
+     757:	c3                   	ret
+
+0000000000000758 <send_recv>:
+SYSCALL_FAST(send_recv)
+     758:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     75f:	0f 05                	syscall
+     761:	c3                   	ret
+
+0000000000000762 <recv>:
+SYSCALL_FAST(recv)
+     762:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     769:	0f 05                	syscall
+     76b:	c3                   	ret
+
+000000000000076c <call>:
+SYSCALL_FAST(call)
+     76c:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     773:	0f 05                	syscall
+     775:	c3                   	ret
+
+0000000000000776 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     776:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     77d:	0f 05                	syscall
+     77f:	c3                   	ret
+
+0000000000000780 <send_reg>:
+SYSCALL_REG(send_reg)
+     780:	41 54                	push   %r12
+     782:	41 55                	push   %r13
+     784:	41 56                	push   %r14
+     786:	41 57                	push   %r15
+     788:	56                   	push   %rsi
+     789:	49 89 f3             	mov    %rsi,%r11
+     78c:	48 89 d6             	mov    %rdx,%rsi
+     78f:	49 8b 13             	mov    (%r11),%rdx
+     792:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     796:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     79a:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     79e:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     7a2:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     7a6:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     7aa:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     7ae:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     7b5:	0f 05                	syscall
+     7b7:	41 5b                	pop    %r11
+     7b9:	49 89 13             	mov    %rdx,(%r11)
+     7bc:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     7c0:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     7c4:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     7c8:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     7cc:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     7d0:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     7d4:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     7d8:	41 5f                	pop    %r15
+     7da:	41 5e                	pop    %r14
+     7dc:	41 5d                	pop    %r13
+     7de:	41 5c                	pop    %r12
+     7e0:	c3                   	ret
+
+00000000000007e1 <recv_reg>:
+SYSCALL_REG(recv_reg)
+     7e1:	41 54                	push   %r12
+     7e3:	41 55                	push   %r13
+     7e5:	41 56                	push   %r14
+     7e7:	41 57                	push   %r15
+     7e9:	56                   	push   %rsi
+     7ea:	49 89 f3             	mov    %rsi,%r11
+     7ed:	48 89 d6             	mov    %rdx,%rsi
+     7f0:	49 8b 13             	mov    (%r11),%rdx
+     7f3:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     7f7:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     7fb:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     7ff:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     803:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     807:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     80b:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     80f:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+     816:	0f 05                	syscall
+     818:	41 5b                	pop    %r11
+     81a:	49 89 13             	mov    %rdx,(%r11)
+     81d:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     821:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     825:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     829:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     82d:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     831:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     835:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     839:	41 5f                	pop    %r15
+     83b:	41 5e                	pop    %r14
+     83d:	41 5d                	pop    %r13
+     83f:	41 5c                	pop    %r12
+     841:	c3                   	ret
+
+0000000000000842 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+     842:	41 54                	push   %r12
+     844:	41 55                	push   %r13
+     846:	41 56                	push   %r14
+     848:	41 57                	push   %r15
+     84a:	56                   	push   %rsi
+     84b:	49 89 f3             	mov    %rsi,%r11
+     84e:	48 89 d6             	mov    %rdx,%rsi
+     851:	49 8b 13             	mov    (%r11),%rdx
+     854:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     858:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     85c:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     860:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     864:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     868:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     86c:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     870:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+     877:	0f 05                	syscall
+     879:	41 5b                	pop    %r11
+     87b:	49 89 13             	mov    %rdx,(%r11)
+     87e:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     882:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     886:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     88a:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     88e:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     892:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     896:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     89a:	41 5f                	pop    %r15
+     89c:	41 5e                	pop    %r14
+     89e:	41 5d                	pop    %r13
+     8a0:	41 5c                	pop    %r12
+     8a2:	c3                   	ret
+
+00000000000008a3 <call_reg>:
+SYSCALL_REG(call_reg)
+     8a3:	41 54                	push   %r12
+     8a5:	41 55                	push   %r13
+     8a7:	41 56                	push   %r14
+     8a9:	41 57                	push   %r15
+     8ab:	56                   	push   %rsi
+     8ac:	49 89 f3             	mov    %rsi,%r11
+     8af:	48 89 d6             	mov    %rdx,%rsi
+     8b2:	49 8b 13             	mov    (%r11),%rdx
+     8b5:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     8b9:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     8bd:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     8c1:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     8c5:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     8c9:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     8cd:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     8d1:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+     8d8:	0f 05                	syscall
+     8da:	41 5b                	pop    %r11
+     8dc:	49 89 13             	mov    %rdx,(%r11)
+     8df:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     8e3:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     8e7:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     8eb:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     8ef:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     8f3:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     8f7:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     8fb:	41 5f                	pop    %r15
+     8fd:	41 5e                	pop    %r14
+     8ff:	41 5d                	pop    %r13
+     901:	41 5c                	pop    %r12
+     903:	c3                   	ret
+
+0000000000000904 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+     904:	41 54                	push   %r12
+     906:	41 55                	push   %r13
+     908:	41 56                	push   %r14
+     90a:	41 57                	push   %r15
+     90c:	56                   	push   %rsi
+     90d:	49 89 f3             	mov    %rsi,%r11
+     910:	48 89 d6             	mov    %rdx,%rsi
+     913:	49 8b 13             	mov    (%r11),%rdx
+     916:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     91a:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     91e:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     922:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     926:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     92a:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     92e:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     932:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+     939:	0f 05                	syscall
+     93b:	41 5b                	pop    %r11
+     93d:	49 89 13             	mov    %rdx,(%r11)
+     940:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     944:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     948:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     94c:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     950:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     954:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     958:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     95c:	41 5f                	pop    %r15
+     95e:	41 5e                	pop    %r14
+     960:	41 5d                	pop    %r13
+     962:	41 5c                	pop    %r12
+     964:	c3                   	ret
+
+0000000000000965 <sendx>:
+SYSCALL_FAST(sendx)
+     965:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+     96c:	0f 05                	syscall
+     96e:	c3                   	ret
+
+000000000000096f <ring_attach>:
+SYSCALL_FAST(ring_attach)
+     96f:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+     976:	0f 05                	syscall
+     978:	c3                   	ret
+
+0000000000000979 <notify>:
+SYSCALL_FAST(notify)
+     979:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+     980:	0f 05                	syscall
+     982:	c3                   	ret
+
+0000000000000983 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+     983:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+     98a:	0f 05                	syscall
+     98c:	c3                   	ret
+
+000000000000098d <send_timed>:
+SYSCALL_FAST(send_timed)
+     98d:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+     994:	0f 05                	syscall
+     996:	c3                   	ret
+
+0000000000000997 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+     997:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+     99e:	0f 05                	syscall
+     9a0:	c3                   	ret
+
+00000000000009a1 <set_add>:
+SYSCALL_FAST(set_add)
+     9a1:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+     9a8:	0f 05                	syscall
+     9aa:	c3                   	ret
+
+00000000000009ab <set_del>:
+SYSCALL_FAST(set_del)
+     9ab:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+     9b2:	0f 05                	syscall
+     9b4:	c3                   	ret
+
+00000000000009b5 <recv_any>:
+SYSCALL_FAST(recv_any)
+     9b5:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+     9bc:	0f 05                	syscall
+     9be:	c3                   	ret
+
+00000000000009bf <ep_create>:
+SYSCALL_FAST(ep_create)
+     9bf:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+     9c6:	0f 05                	syscall
+     9c8:	c3                   	ret
+
+00000000000009c9 <ep_close>:
+SYSCALL_FAST(ep_close)
+     9c9:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+     9d0:	0f 05                	syscall
+     9d2:	c3                   	ret
+
+00000000000009d3 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+     9d3:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+     9da:	0f 05                	syscall
+     9dc:	c3                   	ret
+
+00000000000009dd <setprio>:
+SYSCALL_FAST(setprio)
+     9dd:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+     9e4:	0f 05                	syscall
+     9e6:	c3                   	ret
+
+00000000000009e7 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+     9e7:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+     9ee:	0f 05                	syscall
+     9f0:	c3                   	ret
+
+00000000000009f1 <sethuge>:
+SYSCALL_FAST(sethuge)
+     9f1:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+     9f8:	0f 05                	syscall
+     9fa:	c3                   	ret
+
+00000000000009fb <cr3_test>:
+SYSCALL_FAST(cr3_test)
+     9fb:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+     a02:	0f 05                	syscall
+     a04:	c3                   	ret
+
+0000000000000a05 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+     a05:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+     a0c:	0f 05                	syscall
+     a0e:	c3                   	ret
+
+0000000000000a0f <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+     a0f:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+     a16:	0f 05                	syscall
+     a18:	c3                   	ret
+
+0000000000000a19 <null_call>:
+     a19:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+     a20:	0f 05                	syscall
+     a22:	c3                   	ret
+
+0000000000000a23 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     a23:	55                   	push   %rbp
+     a24:	48 89 e5             	mov    %rsp,%rbp
+     a27:	48 83 ec 10          	sub    $0x10,%rsp
+     a2b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     a2e:	89 f0                	mov    %esi,%eax
+     a30:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     a33:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     a37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a3a:	ba 01 00 00 00       	mov    $0x1,%edx
+     a3f:	48 89 ce             	mov    %rcx,%rsi
+     a42:	89 c7                	mov    %eax,%edi
+     a44:	e8 79 fc ff ff       	call   6c2 <write>
+}
+     a49:	90                   	nop
+     a4a:	c9                   	leave
+     a4b:	c3                   	ret
+
+0000000000000a4c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     a4c:	55                   	push   %rbp
+     a4d:	48 89 e5             	mov    %rsp,%rbp
+     a50:	48 83 ec 30          	sub    $0x30,%rsp
+     a54:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     a57:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     a5a:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     a5d:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     a60:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     a67:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     a6b:	74 17                	je     a84 <printint+0x38>
+     a6d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     a71:	79 11                	jns    a84 <printint+0x38>
+    neg = 1;
+     a73:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     a7a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a7d:	f7 d8                	neg    %eax
+     a7f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     a82:	eb 06                	jmp    a8a <printint+0x3e>
+  } else {
+    x = xx;
+     a84:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a87:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     a8a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     a91:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     a94:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a97:	ba 00 00 00 00       	mov    $0x0,%edx
+     a9c:	f7 f1                	div    %ecx
+     a9e:	89 d1                	mov    %edx,%ecx
+     aa0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aa3:	8d 50 01             	lea    0x1(%rax),%edx
+     aa6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     aa9:	89 ca                	mov    %ecx,%edx
+     aab:	0f b6 92 50 16 00 00 	movzbl 0x1650(%rdx),%edx
+     ab2:	48 98                	cltq
+     ab4:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     ab8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     abb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     abe:	ba 00 00 00 00       	mov    $0x0,%edx
+     ac3:	f7 f6                	div    %esi
+     ac5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     ac8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     acc:	75 c3                	jne    a91 <printint+0x45>
+  if(neg)
+     ace:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     ad2:	74 2b                	je     aff <printint+0xb3>
+    buf[i++] = '-';
+     ad4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ad7:	8d 50 01             	lea    0x1(%rax),%edx
+     ada:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     add:	48 98                	cltq
+     adf:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+     ae4:	eb 19                	jmp    aff <printint+0xb3>
+    putc(fd, buf[i]);
+     ae6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ae9:	48 98                	cltq
+     aeb:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+     af0:	0f be d0             	movsbl %al,%edx
+     af3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     af6:	89 d6                	mov    %edx,%esi
+     af8:	89 c7                	mov    %eax,%edi
+     afa:	e8 24 ff ff ff       	call   a23 <putc>
+  while(--i >= 0)
+     aff:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     b03:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     b07:	79 dd                	jns    ae6 <printint+0x9a>
+}
+     b09:	90                   	nop
+     b0a:	90                   	nop
+     b0b:	c9                   	leave
+     b0c:	c3                   	ret
+
+0000000000000b0d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b0d:	55                   	push   %rbp
+     b0e:	48 89 e5             	mov    %rsp,%rbp
+     b11:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+     b18:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+     b1e:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+     b25:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+     b2c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+     b33:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+     b3a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+     b41:	84 c0                	test   %al,%al
+     b43:	74 20                	je     b65 <printf+0x58>
+     b45:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+     b49:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+     b4d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+     b51:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+     b55:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+     b59:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+     b5d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+     b61:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+     b65:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+     b6c:	00 00 00 
+     b6f:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+     b76:	00 00 00 
+     b79:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     b7d:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+     b84:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+     b8b:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+     b92:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     b99:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     b9c:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+     ba3:	00 00 00 
+     ba6:	e9 a8 02 00 00       	jmp    e53 <printf+0x346>
+    c = fmt[i] & 0xff;
+     bab:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     bb1:	48 63 d0             	movslq %eax,%rdx
+     bb4:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     bbb:	48 01 d0             	add    %rdx,%rax
+     bbe:	0f b6 00             	movzbl (%rax),%eax
+     bc1:	0f be c0             	movsbl %al,%eax
+     bc4:	25 ff 00 00 00       	and    $0xff,%eax
+     bc9:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+     bcf:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+     bd6:	75 35                	jne    c0d <printf+0x100>
+      if(c == '%'){
+     bd8:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     bdf:	75 0f                	jne    bf0 <printf+0xe3>
+        state = '%';
+     be1:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+     be8:	00 00 00 
+     beb:	e9 5c 02 00 00       	jmp    e4c <printf+0x33f>
+      } else {
+        putc(fd, c);
+     bf0:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     bf6:	0f be d0             	movsbl %al,%edx
+     bf9:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     bff:	89 d6                	mov    %edx,%esi
+     c01:	89 c7                	mov    %eax,%edi
+     c03:	e8 1b fe ff ff       	call   a23 <putc>
+     c08:	e9 3f 02 00 00       	jmp    e4c <printf+0x33f>
+      }
+    } else if(state == '%'){
+     c0d:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+     c14:	0f 85 32 02 00 00    	jne    e4c <printf+0x33f>
+      if(c == 'd'){
+     c1a:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+     c21:	75 5e                	jne    c81 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+     c23:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     c29:	83 f8 2f             	cmp    $0x2f,%eax
+     c2c:	77 23                	ja     c51 <printf+0x144>
+     c2e:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     c35:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c3b:	89 d2                	mov    %edx,%edx
+     c3d:	48 01 d0             	add    %rdx,%rax
+     c40:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c46:	83 c2 08             	add    $0x8,%edx
+     c49:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     c4f:	eb 12                	jmp    c63 <printf+0x156>
+     c51:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     c58:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c5c:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     c63:	8b 30                	mov    (%rax),%esi
+     c65:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c6b:	b9 01 00 00 00       	mov    $0x1,%ecx
+     c70:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c75:	89 c7                	mov    %eax,%edi
+     c77:	e8 d0 fd ff ff       	call   a4c <printint>
+     c7c:	e9 c1 01 00 00       	jmp    e42 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+     c81:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+     c88:	74 09                	je     c93 <printf+0x186>
+     c8a:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+     c91:	75 5e                	jne    cf1 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+     c93:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     c99:	83 f8 2f             	cmp    $0x2f,%eax
+     c9c:	77 23                	ja     cc1 <printf+0x1b4>
+     c9e:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     ca5:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     cab:	89 d2                	mov    %edx,%edx
+     cad:	48 01 d0             	add    %rdx,%rax
+     cb0:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     cb6:	83 c2 08             	add    $0x8,%edx
+     cb9:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     cbf:	eb 12                	jmp    cd3 <printf+0x1c6>
+     cc1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     cc8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ccc:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     cd3:	8b 30                	mov    (%rax),%esi
+     cd5:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     cdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+     ce0:	ba 10 00 00 00       	mov    $0x10,%edx
+     ce5:	89 c7                	mov    %eax,%edi
+     ce7:	e8 60 fd ff ff       	call   a4c <printint>
+     cec:	e9 51 01 00 00       	jmp    e42 <printf+0x335>
+      } else if(c == 's'){
+     cf1:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+     cf8:	0f 85 98 00 00 00    	jne    d96 <printf+0x289>
+        s = va_arg(ap, char*);
+     cfe:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     d04:	83 f8 2f             	cmp    $0x2f,%eax
+     d07:	77 23                	ja     d2c <printf+0x21f>
+     d09:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     d10:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     d16:	89 d2                	mov    %edx,%edx
+     d18:	48 01 d0             	add    %rdx,%rax
+     d1b:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     d21:	83 c2 08             	add    $0x8,%edx
+     d24:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     d2a:	eb 12                	jmp    d3e <printf+0x231>
+     d2c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     d33:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     d37:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     d3e:	48 8b 00             	mov    (%rax),%rax
+     d41:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+     d48:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+     d4f:	00 
+     d50:	75 31                	jne    d83 <printf+0x276>
+          s = "(null)";
+     d52:	48 c7 85 48 ff ff ff 	movq   $0x1313,-0xb8(%rbp)
+     d59:	13 13 00 00 
+        while(*s != 0){
+     d5d:	eb 24                	jmp    d83 <printf+0x276>
+          putc(fd, *s);
+     d5f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     d66:	0f b6 00             	movzbl (%rax),%eax
+     d69:	0f be d0             	movsbl %al,%edx
+     d6c:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     d72:	89 d6                	mov    %edx,%esi
+     d74:	89 c7                	mov    %eax,%edi
+     d76:	e8 a8 fc ff ff       	call   a23 <putc>
+          s++;
+     d7b:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+     d82:	01 
+        while(*s != 0){
+     d83:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     d8a:	0f b6 00             	movzbl (%rax),%eax
+     d8d:	84 c0                	test   %al,%al
+     d8f:	75 ce                	jne    d5f <printf+0x252>
+     d91:	e9 ac 00 00 00       	jmp    e42 <printf+0x335>
+        }
+      } else if(c == 'c'){
+     d96:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+     d9d:	75 56                	jne    df5 <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+     d9f:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     da5:	83 f8 2f             	cmp    $0x2f,%eax
+     da8:	77 23                	ja     dcd <printf+0x2c0>
+     daa:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     db1:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     db7:	89 d2                	mov    %edx,%edx
+     db9:	48 01 d0             	add    %rdx,%rax
+     dbc:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     dc2:	83 c2 08             	add    $0x8,%edx
+     dc5:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     dcb:	eb 12                	jmp    ddf <printf+0x2d2>
+     dcd:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     dd4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     dd8:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     ddf:	8b 00                	mov    (%rax),%eax
+     de1:	0f be d0             	movsbl %al,%edx
+     de4:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     dea:	89 d6                	mov    %edx,%esi
+     dec:	89 c7                	mov    %eax,%edi
+     dee:	e8 30 fc ff ff       	call   a23 <putc>
+     df3:	eb 4d                	jmp    e42 <printf+0x335>
+      } else if(c == '%'){
+     df5:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     dfc:	75 1a                	jne    e18 <printf+0x30b>
+        putc(fd, c);
+     dfe:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     e04:	0f be d0             	movsbl %al,%edx
+     e07:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     e0d:	89 d6                	mov    %edx,%esi
+     e0f:	89 c7                	mov    %eax,%edi
+     e11:	e8 0d fc ff ff       	call   a23 <putc>
+     e16:	eb 2a                	jmp    e42 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     e18:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     e1e:	be 25 00 00 00       	mov    $0x25,%esi
+     e23:	89 c7                	mov    %eax,%edi
+     e25:	e8 f9 fb ff ff       	call   a23 <putc>
+        putc(fd, c);
+     e2a:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     e30:	0f be d0             	movsbl %al,%edx
+     e33:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     e39:	89 d6                	mov    %edx,%esi
+     e3b:	89 c7                	mov    %eax,%edi
+     e3d:	e8 e1 fb ff ff       	call   a23 <putc>
+      }
+      state = 0;
+     e42:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     e49:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     e4c:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+     e53:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     e59:	48 63 d0             	movslq %eax,%rdx
+     e5c:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     e63:	48 01 d0             	add    %rdx,%rax
+     e66:	0f b6 00             	movzbl (%rax),%eax
+     e69:	84 c0                	test   %al,%al
+     e6b:	0f 85 3a fd ff ff    	jne    bab <printf+0x9e>
+    }
+  }
+}
+     e71:	90                   	nop
+     e72:	90                   	nop
+     e73:	c9                   	leave
+     e74:	c3                   	ret
+
+0000000000000e75 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e75:	55                   	push   %rbp
+     e76:	48 89 e5             	mov    %rsp,%rbp
+     e79:	48 83 ec 18          	sub    $0x18,%rsp
+     e7d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e85:	48 83 e8 10          	sub    $0x10,%rax
+     e89:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e8d:	48 8b 05 fc 07 00 00 	mov    0x7fc(%rip),%rax        # 1690 <freep>
+     e94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e98:	eb 2f                	jmp    ec9 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e9e:	48 8b 00             	mov    (%rax),%rax
+     ea1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ea5:	72 17                	jb     ebe <free+0x49>
+     ea7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     eab:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     eaf:	72 2f                	jb     ee0 <free+0x6b>
+     eb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eb5:	48 8b 00             	mov    (%rax),%rax
+     eb8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     ebc:	72 22                	jb     ee0 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ebe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ec2:	48 8b 00             	mov    (%rax),%rax
+     ec5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     ec9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ecd:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ed1:	73 c7                	jae    e9a <free+0x25>
+     ed3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ed7:	48 8b 00             	mov    (%rax),%rax
+     eda:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     ede:	73 ba                	jae    e9a <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ee0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ee4:	8b 40 08             	mov    0x8(%rax),%eax
+     ee7:	89 c0                	mov    %eax,%eax
+     ee9:	48 c1 e0 04          	shl    $0x4,%rax
+     eed:	48 89 c2             	mov    %rax,%rdx
+     ef0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ef4:	48 01 c2             	add    %rax,%rdx
+     ef7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     efb:	48 8b 00             	mov    (%rax),%rax
+     efe:	48 39 c2             	cmp    %rax,%rdx
+     f01:	75 2d                	jne    f30 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+     f03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f07:	8b 50 08             	mov    0x8(%rax),%edx
+     f0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f0e:	48 8b 00             	mov    (%rax),%rax
+     f11:	8b 40 08             	mov    0x8(%rax),%eax
+     f14:	01 c2                	add    %eax,%edx
+     f16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f1a:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f21:	48 8b 00             	mov    (%rax),%rax
+     f24:	48 8b 10             	mov    (%rax),%rdx
+     f27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f2b:	48 89 10             	mov    %rdx,(%rax)
+     f2e:	eb 0e                	jmp    f3e <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+     f30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f34:	48 8b 10             	mov    (%rax),%rdx
+     f37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f3b:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     f3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f42:	8b 40 08             	mov    0x8(%rax),%eax
+     f45:	89 c0                	mov    %eax,%eax
+     f47:	48 c1 e0 04          	shl    $0x4,%rax
+     f4b:	48 89 c2             	mov    %rax,%rdx
+     f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f52:	48 01 d0             	add    %rdx,%rax
+     f55:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     f59:	75 27                	jne    f82 <free+0x10d>
+    p->s.size += bp->s.size;
+     f5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f5f:	8b 50 08             	mov    0x8(%rax),%edx
+     f62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f66:	8b 40 08             	mov    0x8(%rax),%eax
+     f69:	01 c2                	add    %eax,%edx
+     f6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f6f:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     f72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f76:	48 8b 10             	mov    (%rax),%rdx
+     f79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f7d:	48 89 10             	mov    %rdx,(%rax)
+     f80:	eb 0b                	jmp    f8d <free+0x118>
+  } else
+    p->s.ptr = bp;
+     f82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f86:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f8a:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     f8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f91:	48 89 05 f8 06 00 00 	mov    %rax,0x6f8(%rip)        # 1690 <freep>
+}
+     f98:	90                   	nop
+     f99:	c9                   	leave
+     f9a:	c3                   	ret
+
+0000000000000f9b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     f9b:	55                   	push   %rbp
+     f9c:	48 89 e5             	mov    %rsp,%rbp
+     f9f:	48 83 ec 20          	sub    $0x20,%rsp
+     fa3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     fa6:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     fad:	77 07                	ja     fb6 <morecore+0x1b>
+    nu = 4096;
+     faf:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     fb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fb9:	c1 e0 04             	shl    $0x4,%eax
+     fbc:	89 c7                	mov    %eax,%edi
+     fbe:	e8 77 f7 ff ff       	call   73a <sbrk>
+     fc3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     fc7:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     fcc:	75 07                	jne    fd5 <morecore+0x3a>
+    return 0;
+     fce:	b8 00 00 00 00       	mov    $0x0,%eax
+     fd3:	eb 29                	jmp    ffe <morecore+0x63>
+  hp = (Header*)p;
+     fd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fd9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     fdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fe1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     fe4:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     fe7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     feb:	48 83 c0 10          	add    $0x10,%rax
+     fef:	48 89 c7             	mov    %rax,%rdi
+     ff2:	e8 7e fe ff ff       	call   e75 <free>
+  return freep;
+     ff7:	48 8b 05 92 06 00 00 	mov    0x692(%rip),%rax        # 1690 <freep>
+}
+     ffe:	c9                   	leave
+     fff:	c3                   	ret
+
+0000000000001000 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1000:	55                   	push   %rbp
+    1001:	48 89 e5             	mov    %rsp,%rbp
+    1004:	48 83 ec 30          	sub    $0x30,%rsp
+    1008:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    100b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    100e:	48 83 c0 0f          	add    $0xf,%rax
+    1012:	48 c1 e8 04          	shr    $0x4,%rax
+    1016:	83 c0 01             	add    $0x1,%eax
+    1019:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+    101c:	48 8b 05 6d 06 00 00 	mov    0x66d(%rip),%rax        # 1690 <freep>
+    1023:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1027:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    102c:	75 2b                	jne    1059 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+    102e:	48 c7 45 f0 80 16 00 	movq   $0x1680,-0x10(%rbp)
+    1035:	00 
+    1036:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    103a:	48 89 05 4f 06 00 00 	mov    %rax,0x64f(%rip)        # 1690 <freep>
+    1041:	48 8b 05 48 06 00 00 	mov    0x648(%rip),%rax        # 1690 <freep>
+    1048:	48 89 05 31 06 00 00 	mov    %rax,0x631(%rip)        # 1680 <base>
+    base.s.size = 0;
+    104f:	c7 05 2f 06 00 00 00 	movl   $0x0,0x62f(%rip)        # 1688 <base+0x8>
+    1056:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1059:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    105d:	48 8b 00             	mov    (%rax),%rax
+    1060:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1064:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1068:	8b 40 08             	mov    0x8(%rax),%eax
+    106b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    106e:	72 5f                	jb     10cf <malloc+0xcf>
+      if(p->s.size == nunits)
+    1070:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1074:	8b 40 08             	mov    0x8(%rax),%eax
+    1077:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    107a:	75 10                	jne    108c <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+    107c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1080:	48 8b 10             	mov    (%rax),%rdx
+    1083:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1087:	48 89 10             	mov    %rdx,(%rax)
+    108a:	eb 2e                	jmp    10ba <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+    108c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1090:	8b 40 08             	mov    0x8(%rax),%eax
+    1093:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1096:	89 c2                	mov    %eax,%edx
+    1098:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    109c:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    109f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10a3:	8b 40 08             	mov    0x8(%rax),%eax
+    10a6:	89 c0                	mov    %eax,%eax
+    10a8:	48 c1 e0 04          	shl    $0x4,%rax
+    10ac:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    10b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10b4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    10b7:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    10ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10be:	48 89 05 cb 05 00 00 	mov    %rax,0x5cb(%rip)        # 1690 <freep>
+      return (void*)(p + 1);
+    10c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10c9:	48 83 c0 10          	add    $0x10,%rax
+    10cd:	eb 41                	jmp    1110 <malloc+0x110>
+    }
+    if(p == freep)
+    10cf:	48 8b 05 ba 05 00 00 	mov    0x5ba(%rip),%rax        # 1690 <freep>
+    10d6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    10da:	75 1c                	jne    10f8 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+    10dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10df:	89 c7                	mov    %eax,%edi
+    10e1:	e8 b5 fe ff ff       	call   f9b <morecore>
+    10e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    10ea:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    10ef:	75 07                	jne    10f8 <malloc+0xf8>
+        return 0;
+    10f1:	b8 00 00 00 00       	mov    $0x0,%eax
+    10f6:	eb 18                	jmp    1110 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1100:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1104:	48 8b 00             	mov    (%rax),%rax
+    1107:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    110b:	e9 54 ff ff ff       	jmp    1064 <malloc+0x64>
+  }
+}
+    1110:	c9                   	leave
+    1111:	c3                   	ret
+
+0000000000001112 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+    1112:	55                   	push   %rbp
+    1113:	48 89 e5             	mov    %rsp,%rbp
+    1116:	53                   	push   %rbx
+    1117:	48 83 ec 38          	sub    $0x38,%rsp
+    111b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    111e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1122:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+    1126:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    112a:	8b 40 40             	mov    0x40(%rax),%eax
+    112d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+    1130:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1134:	8b 00                	mov    (%rax),%eax
+    1136:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1139:	29 c2                	sub    %eax,%edx
+    113b:	83 fa 20             	cmp    $0x20,%edx
+    113e:	75 0a                	jne    114a <ring_send+0x38>
+    return -1;
+    1140:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1145:	e9 93 00 00 00       	jmp    11dd <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+    114a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    114d:	83 e0 1f             	and    $0x1f,%eax
+    1150:	89 c2                	mov    %eax,%edx
+    1152:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1156:	89 d2                	mov    %edx,%edx
+    1158:	48 83 c2 02          	add    $0x2,%rdx
+    115c:	48 c1 e2 06          	shl    $0x6,%rdx
+    1160:	48 01 c2             	add    %rax,%rdx
+    1163:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1167:	48 8b 08             	mov    (%rax),%rcx
+    116a:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    116e:	48 89 0a             	mov    %rcx,(%rdx)
+    1171:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+    1175:	48 8b 48 10          	mov    0x10(%rax),%rcx
+    1179:	48 8b 58 18          	mov    0x18(%rax),%rbx
+    117d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+    1181:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+    1185:	48 8b 48 20          	mov    0x20(%rax),%rcx
+    1189:	48 8b 58 28          	mov    0x28(%rax),%rbx
+    118d:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+    1191:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+    1195:	48 8b 48 30          	mov    0x30(%rax),%rcx
+    1199:	48 8b 58 38          	mov    0x38(%rax),%rbx
+    119d:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+    11a1:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+    11a5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+    11ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    11ae:	8d 50 01             	lea    0x1(%rax),%edx
+    11b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11b5:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+    11b8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+    11be:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11c2:	8b 00                	mov    (%rax),%eax
+    11c4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    11c7:	75 0f                	jne    11d8 <ring_send+0xc6>
+    notify(channel, 1);
+    11c9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11cc:	be 01 00 00 00       	mov    $0x1,%esi
+    11d1:	89 c7                	mov    %eax,%edi
+    11d3:	e8 a1 f7 ff ff       	call   979 <notify>
+  return 0;
+    11d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    11dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    11e1:	c9                   	leave
+    11e2:	c3                   	ret
+
+00000000000011e3 <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+    11e3:	55                   	push   %rbp
+    11e4:	48 89 e5             	mov    %rsp,%rbp
+    11e7:	53                   	push   %rbx
+    11e8:	48 83 ec 38          	sub    $0x38,%rsp
+    11ec:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    11ef:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    11f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+    11f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11fb:	8b 00                	mov    (%rax),%eax
+    11fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+    1200:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+    1206:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    120a:	8b 40 40             	mov    0x40(%rax),%eax
+    120d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1210:	75 15                	jne    1227 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+    1212:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1215:	89 c7                	mov    %eax,%edi
+    1217:	e8 67 f7 ff ff       	call   983 <nfy_wait>
+    121c:	85 c0                	test   %eax,%eax
+    121e:	79 e0                	jns    1200 <ring_recv+0x1d>
+      return -1;
+    1220:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1225:	eb 73                	jmp    129a <ring_recv+0xb7>
+      break;
+    1227:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+    1228:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    122b:	83 e0 1f             	and    $0x1f,%eax
+    122e:	89 c1                	mov    %eax,%ecx
+    1230:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1234:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1238:	89 c9                	mov    %ecx,%ecx
+    123a:	48 83 c1 02          	add    $0x2,%rcx
+    123e:	48 c1 e1 06          	shl    $0x6,%rcx
+    1242:	48 01 ca             	add    %rcx,%rdx
+    1245:	48 8b 0a             	mov    (%rdx),%rcx
+    1248:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+    124c:	48 89 08             	mov    %rcx,(%rax)
+    124f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    1253:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    1257:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    125b:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    125f:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    1263:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    1267:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    126b:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    126f:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    1273:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    1277:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    127b:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    127f:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    1283:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    1289:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    128c:	8d 50 01             	lea    0x1(%rax),%edx
+    128f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1293:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1295:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    129a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    129e:	c9                   	leave
+    129f:	c3                   	ret
+
+00000000000012a0 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    12a0:	55                   	push   %rbp
+    12a1:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    12a4:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    12a9:	8b 00                	mov    (%rax),%eax
+}
+    12ab:	5d                   	pop    %rbp
+    12ac:	c3                   	ret
+
+00000000000012ad <getpid>:
+
+int
+getpid(void)
+{
+    12ad:	55                   	push   %rbp
+    12ae:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    12b1:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    12b6:	8b 00                	mov    (%rax),%eax
+}
+    12b8:	5d                   	pop    %rbp
+    12b9:	c3                   	ret
+
+00000000000012ba <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    12ba:	55                   	push   %rbp
+    12bb:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    12be:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    12c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    12c7:	5d                   	pop    %rbp
+    12c8:	c3                   	ret
@@ -0,0 +1,1738 @@
+
+fs/rm:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+   b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if(argc < 2){
+   f:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  13:	7f 1b                	jg     30 <main+0x30>
+    printf(2, "Usage: rm files...\n");
+  15:	48 c7 c6 c3 0f 00 00 	mov    $0xfc3,%rsi
+  1c:	bf 02 00 00 00       	mov    $0x2,%edi
+  21:	b8 00 00 00 00       	mov    $0x0,%eax
+  26:	e8 dc 07 00 00       	call   807 <printf>
+    exit();
+  2b:	e8 64 03 00 00       	call   394 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  37:	eb 59                	jmp    92 <main+0x92>
+    if(unlink(argv[i]) < 0){
+  39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  3c:	48 98                	cltq
+  3e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  45:	00 
+  46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  4a:	48 01 d0             	add    %rdx,%rax
+  4d:	48 8b 00             	mov    (%rax),%rax
+  50:	48 89 c7             	mov    %rax,%rdi
+  53:	e8 a0 03 00 00       	call   3f8 <unlink>
+  58:	85 c0                	test   %eax,%eax
+  5a:	79 32                	jns    8e <main+0x8e>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  5f:	48 98                	cltq
+  61:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  68:	00 
+  69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  6d:	48 01 d0             	add    %rdx,%rax
+  70:	48 8b 00             	mov    (%rax),%rax
+  73:	48 89 c2             	mov    %rax,%rdx
+  76:	48 c7 c6 d7 0f 00 00 	mov    $0xfd7,%rsi
+  7d:	bf 02 00 00 00       	mov    $0x2,%edi
+  82:	b8 00 00 00 00       	mov    $0x0,%eax
+  87:	e8 7b 07 00 00       	call   807 <printf>
+      break;
+  8c:	eb 0c                	jmp    9a <main+0x9a>
+  for(i = 1; i < argc; i++){
+  8e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  92:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  95:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  98:	7c 9f                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  9a:	e8 f5 02 00 00       	call   394 <exit>
+
+000000000000009f <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  9f:	55                   	push   %rbp
+  a0:	48 89 e5             	mov    %rsp,%rbp
+  a3:	48 83 ec 10          	sub    $0x10,%rsp
+  a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  ab:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  ae:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+  b1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  b5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  b8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  bb:	48 89 ce             	mov    %rcx,%rsi
+  be:	48 89 f7             	mov    %rsi,%rdi
+  c1:	89 d1                	mov    %edx,%ecx
+  c3:	fc                   	cld
+  c4:	f3 aa                	rep stos %al,%es:(%rdi)
+  c6:	89 ca                	mov    %ecx,%edx
+  c8:	48 89 fe             	mov    %rdi,%rsi
+  cb:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  cf:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  d2:	90                   	nop
+  d3:	c9                   	leave
+  d4:	c3                   	ret
+
+00000000000000d5 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  d5:	55                   	push   %rbp
+  d6:	48 89 e5             	mov    %rsp,%rbp
+  d9:	48 83 ec 20          	sub    $0x20,%rsp
+  dd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  e1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+  e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+  ed:	90                   	nop
+  ee:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  f2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  f6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  fe:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 102:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 106:	0f b6 12             	movzbl (%rdx),%edx
+ 109:	88 10                	mov    %dl,(%rax)
+ 10b:	0f b6 00             	movzbl (%rax),%eax
+ 10e:	84 c0                	test   %al,%al
+ 110:	75 dc                	jne    ee <strcpy+0x19>
+    ;
+  return os;
+ 112:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 116:	c9                   	leave
+ 117:	c3                   	ret
+
+0000000000000118 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 118:	55                   	push   %rbp
+ 119:	48 89 e5             	mov    %rsp,%rbp
+ 11c:	48 83 ec 10          	sub    $0x10,%rsp
+ 120:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 124:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 128:	eb 0a                	jmp    134 <strcmp+0x1c>
+    p++, q++;
+ 12a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 12f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 134:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 138:	0f b6 00             	movzbl (%rax),%eax
+ 13b:	84 c0                	test   %al,%al
+ 13d:	74 12                	je     151 <strcmp+0x39>
+ 13f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 143:	0f b6 10             	movzbl (%rax),%edx
+ 146:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 14a:	0f b6 00             	movzbl (%rax),%eax
+ 14d:	38 c2                	cmp    %al,%dl
+ 14f:	74 d9                	je     12a <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+ 151:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 155:	0f b6 00             	movzbl (%rax),%eax
+ 158:	0f b6 d0             	movzbl %al,%edx
+ 15b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 15f:	0f b6 00             	movzbl (%rax),%eax
+ 162:	0f b6 c0             	movzbl %al,%eax
+ 165:	29 c2                	sub    %eax,%edx
+ 167:	89 d0                	mov    %edx,%eax
+}
+ 169:	c9                   	leave
+ 16a:	c3                   	ret
+
+000000000000016b <strlen>:
+
+uint
+strlen(char *s)
+{
+ 16b:	55                   	push   %rbp
+ 16c:	48 89 e5             	mov    %rsp,%rbp
+ 16f:	48 83 ec 18          	sub    $0x18,%rsp
+ 173:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 177:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 17e:	eb 04                	jmp    184 <strlen+0x19>
+ 180:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 184:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 187:	48 63 d0             	movslq %eax,%rdx
+ 18a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 18e:	48 01 d0             	add    %rdx,%rax
+ 191:	0f b6 00             	movzbl (%rax),%eax
+ 194:	84 c0                	test   %al,%al
+ 196:	75 e8                	jne    180 <strlen+0x15>
+    ;
+  return n;
+ 198:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+
+000000000000019d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 19d:	55                   	push   %rbp
+ 19e:	48 89 e5             	mov    %rsp,%rbp
+ 1a1:	48 83 ec 10          	sub    $0x10,%rsp
+ 1a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 1a9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 1ac:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 1af:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 1b2:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 1b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1b9:	89 ce                	mov    %ecx,%esi
+ 1bb:	48 89 c7             	mov    %rax,%rdi
+ 1be:	e8 dc fe ff ff       	call   9f <stosb>
+  return dst;
+ 1c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+
+00000000000001c9 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1c9:	55                   	push   %rbp
+ 1ca:	48 89 e5             	mov    %rsp,%rbp
+ 1cd:	48 83 ec 10          	sub    $0x10,%rsp
+ 1d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 1d5:	89 f0                	mov    %esi,%eax
+ 1d7:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 1da:	eb 17                	jmp    1f3 <strchr+0x2a>
+    if(*s == c)
+ 1dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1e0:	0f b6 00             	movzbl (%rax),%eax
+ 1e3:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 1e6:	75 06                	jne    1ee <strchr+0x25>
+      return (char*)s;
+ 1e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1ec:	eb 15                	jmp    203 <strchr+0x3a>
+  for(; *s; s++)
+ 1ee:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 1f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 1f7:	0f b6 00             	movzbl (%rax),%eax
+ 1fa:	84 c0                	test   %al,%al
+ 1fc:	75 de                	jne    1dc <strchr+0x13>
+  return 0;
+ 1fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 203:	c9                   	leave
+ 204:	c3                   	ret
+
+0000000000000205 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 205:	55                   	push   %rbp
+ 206:	48 89 e5             	mov    %rsp,%rbp
+ 209:	48 83 ec 20          	sub    $0x20,%rsp
+ 20d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 211:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 214:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 21b:	eb 48                	jmp    265 <gets+0x60>
+    cc = read(0, &c, 1);
+ 21d:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 221:	ba 01 00 00 00       	mov    $0x1,%edx
+ 226:	48 89 c6             	mov    %rax,%rsi
+ 229:	bf 00 00 00 00       	mov    $0x0,%edi
+ 22e:	e8 7f 01 00 00       	call   3b2 <read>
+ 233:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 236:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 23a:	7e 36                	jle    272 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 23c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 23f:	8d 50 01             	lea    0x1(%rax),%edx
+ 242:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 245:	48 63 d0             	movslq %eax,%rdx
+ 248:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 24c:	48 01 c2             	add    %rax,%rdx
+ 24f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 253:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 255:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 259:	3c 0a                	cmp    $0xa,%al
+ 25b:	74 16                	je     273 <gets+0x6e>
+ 25d:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 261:	3c 0d                	cmp    $0xd,%al
+ 263:	74 0e                	je     273 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 265:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 268:	83 c0 01             	add    $0x1,%eax
+ 26b:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 26e:	7f ad                	jg     21d <gets+0x18>
+ 270:	eb 01                	jmp    273 <gets+0x6e>
+      break;
+ 272:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 276:	48 63 d0             	movslq %eax,%rdx
+ 279:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 27d:	48 01 d0             	add    %rdx,%rax
+ 280:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 287:	c9                   	leave
+ 288:	c3                   	ret
+
+0000000000000289 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 289:	55                   	push   %rbp
+ 28a:	48 89 e5             	mov    %rsp,%rbp
+ 28d:	48 83 ec 20          	sub    $0x20,%rsp
+ 291:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 295:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 299:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 29d:	be 00 00 00 00       	mov    $0x0,%esi
+ 2a2:	48 89 c7             	mov    %rax,%rdi
+ 2a5:	e8 3a 01 00 00       	call   3e4 <open>
+ 2aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 2ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 2b1:	79 07                	jns    2ba <stat+0x31>
+    return -1;
+ 2b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2b8:	eb 21                	jmp    2db <stat+0x52>
+  r = fstat(fd, st);
+ 2ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 2be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2c1:	48 89 d6             	mov    %rdx,%rsi
+ 2c4:	89 c7                	mov    %eax,%edi
+ 2c6:	e8 37 01 00 00       	call   402 <fstat>
+ 2cb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 2ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2d1:	89 c7                	mov    %eax,%edi
+ 2d3:	e8 ee 00 00 00       	call   3c6 <close>
+  return r;
+ 2d8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+
+00000000000002dd <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2dd:	55                   	push   %rbp
+ 2de:	48 89 e5             	mov    %rsp,%rbp
+ 2e1:	48 83 ec 18          	sub    $0x18,%rsp
+ 2e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 2e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 2f0:	eb 28                	jmp    31a <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+ 2f2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 2f5:	89 d0                	mov    %edx,%eax
+ 2f7:	c1 e0 02             	shl    $0x2,%eax
+ 2fa:	01 d0                	add    %edx,%eax
+ 2fc:	01 c0                	add    %eax,%eax
+ 2fe:	89 c1                	mov    %eax,%ecx
+ 300:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 304:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 308:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 30c:	0f b6 00             	movzbl (%rax),%eax
+ 30f:	0f be c0             	movsbl %al,%eax
+ 312:	01 c8                	add    %ecx,%eax
+ 314:	83 e8 30             	sub    $0x30,%eax
+ 317:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 31a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 31e:	0f b6 00             	movzbl (%rax),%eax
+ 321:	3c 2f                	cmp    $0x2f,%al
+ 323:	7e 0b                	jle    330 <atoi+0x53>
+ 325:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 329:	0f b6 00             	movzbl (%rax),%eax
+ 32c:	3c 39                	cmp    $0x39,%al
+ 32e:	7e c2                	jle    2f2 <atoi+0x15>
+  return n;
+ 330:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+
+0000000000000335 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 335:	55                   	push   %rbp
+ 336:	48 89 e5             	mov    %rsp,%rbp
+ 339:	48 83 ec 28          	sub    $0x28,%rsp
+ 33d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 341:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 345:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+ 348:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 34c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 350:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 354:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 358:	eb 1d                	jmp    377 <memmove+0x42>
+    *dst++ = *src++;
+ 35a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 35e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 362:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 366:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 36a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 36e:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 372:	0f b6 12             	movzbl (%rdx),%edx
+ 375:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 377:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 37a:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 37d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 380:	85 c0                	test   %eax,%eax
+ 382:	7f d6                	jg     35a <memmove+0x25>
+  return vdst;
+ 384:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 388:	c9                   	leave
+ 389:	c3                   	ret
+
+000000000000038a <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+ 38a:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+0000000000000394 <exit>:
+SYSCALL_FAST(exit)
+ 394:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+ 39b:	0f 05                	syscall
+ 39d:	c3                   	ret
+
+000000000000039e <wait>:
+SYSCALL_FAST(wait)
+ 39e:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+ 3a5:	0f 05                	syscall
+ 3a7:	c3                   	ret
+
+00000000000003a8 <pipe>:
+SYSCALL_FAST(pipe)
+ 3a8:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+ 3af:	0f 05                	syscall
+ 3b1:	c3                   	ret
+
+00000000000003b2 <read>:
+SYSCALL_FAST(read)
+ 3b2:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+ 3b9:	0f 05                	syscall
+ 3bb:	c3                   	ret
+
+00000000000003bc <write>:
+SYSCALL_FAST(write)
+ 3bc:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+ 3c3:	0f 05                	syscall
+ 3c5:	c3                   	ret
+
+00000000000003c6 <close>:
+SYSCALL_FAST(close)
+ 3c6:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+ 3cd:	0f 05                	syscall
+ 3cf:	c3                   	ret
+
+00000000000003d0 <kill>:
+SYSCALL_FAST(kill)
+ 3d0:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+ 3d7:	0f 05                	syscall
+ 3d9:	c3                   	ret
+
+00000000000003da <exec>:
+SYSCALL(exec)
+ 3da:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+00000000000003e4 <open>:
+SYSCALL_FAST(open)
+ 3e4:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+ 3eb:	0f 05                	syscall
+ 3ed:	c3                   	ret
+
+00000000000003ee <mknod>:
+SYSCALL_FAST(mknod)
+ 3ee:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+ 3f5:	0f 05                	syscall
+ 3f7:	c3                   	ret
+
+00000000000003f8 <unlink>:
+SYSCALL_FAST(unlink)
+ 3f8:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+ 3ff:	0f 05                	syscall
+ 401:	c3                   	ret
+
+0000000000000402 <fstat>:
+SYSCALL_FAST(fstat)
+ 402:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+ 409:	0f 05                	syscall
+ 40b:	c3                   	ret
+
+000000000000040c <link>:
+SYSCALL_FAST(link)
+ 40c:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+ 413:	0f 05                	syscall
+ 415:	c3                   	ret
+
+0000000000000416 <mkdir>:
+SYSCALL_FAST(mkdir)
+ 416:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+ 41d:	0f 05                	syscall
+ 41f:	c3                   	ret
+
+0000000000000420 <chdir>:
+SYSCALL_FAST(chdir)
+ 420:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+ 427:	0f 05                	syscall
+ 429:	c3                   	ret
+
+000000000000042a <dup>:
+SYSCALL_FAST(dup)
+ 42a:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+ 431:	0f 05                	syscall
+ 433:	c3                   	ret
+
+0000000000000434 <sbrk>:
+SYSCALL_FAST(sbrk)
+ 434:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+ 43b:	0f 05                	syscall
+ 43d:	c3                   	ret
+
+000000000000043e <sleep>:
+SYSCALL_FAST(sleep)
+ 43e:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+ 445:	0f 05                	syscall
+ 447:	c3                   	ret
+
+0000000000000448 <send>:
+SYSCALL_FAST(send)
+ 448:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+ 44f:	0f 05                	syscall
+ 451:	c3                   	ret
+
+0000000000000452 <send_recv>:
+SYSCALL_FAST(send_recv)
+ 452:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+ 459:	0f 05                	syscall
+ 45b:	c3                   	ret
+
+000000000000045c <recv>:
+SYSCALL_FAST(recv)
+ 45c:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+ 463:	0f 05                	syscall
+ 465:	c3                   	ret
+
+0000000000000466 <call>:
+SYSCALL_FAST(call)
+ 466:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+ 46d:	0f 05                	syscall
+ 46f:	c3                   	ret
+
+0000000000000470 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+ 470:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+ 477:	0f 05                	syscall
+ 479:	c3                   	ret
+
+000000000000047a <send_reg>:
+SYSCALL_REG(send_reg)
+ 47a:	41 54                	push   %r12
+ 47c:	41 55                	push   %r13
+ 47e:	41 56                	push   %r14
+ 480:	41 57                	push   %r15
+ 482:	56                   	push   %rsi
+ 483:	49 89 f3             	mov    %rsi,%r11
+ 486:	48 89 d6             	mov    %rdx,%rsi
+ 489:	49 8b 13             	mov    (%r11),%rdx
+ 48c:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 490:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 494:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 498:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 49c:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 4a0:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 4a4:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 4a8:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+ 4af:	0f 05                	syscall
+ 4b1:	41 5b                	pop    %r11
+ 4b3:	49 89 13             	mov    %rdx,(%r11)
+ 4b6:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 4ba:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 4be:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 4c2:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 4c6:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 4ca:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 4ce:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 4d2:	41 5f                	pop    %r15
+ 4d4:	41 5e                	pop    %r14
+ 4d6:	41 5d                	pop    %r13
+ 4d8:	41 5c                	pop    %r12
+ 4da:	c3                   	ret
+
+00000000000004db <recv_reg>:
+SYSCALL_REG(recv_reg)
+ 4db:	41 54                	push   %r12
+ 4dd:	41 55                	push   %r13
+ 4df:	41 56                	push   %r14
+ 4e1:	41 57                	push   %r15
+ 4e3:	56                   	push   %rsi
+ 4e4:	49 89 f3             	mov    %rsi,%r11
+ 4e7:	48 89 d6             	mov    %rdx,%rsi
+ 4ea:	49 8b 13             	mov    (%r11),%rdx
+ 4ed:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 4f1:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 4f5:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 4f9:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 4fd:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 501:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 505:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 509:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+ 510:	0f 05                	syscall
+ 512:	41 5b                	pop    %r11
+ 514:	49 89 13             	mov    %rdx,(%r11)
+ 517:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 51b:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 51f:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 523:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 527:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 52b:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 52f:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 533:	41 5f                	pop    %r15
+ 535:	41 5e                	pop    %r14
+ 537:	41 5d                	pop    %r13
+ 539:	41 5c                	pop    %r12
+ 53b:	c3                   	ret
+
+000000000000053c <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+ 53c:	41 54                	push   %r12
+ 53e:	41 55                	push   %r13
+ 540:	41 56                	push   %r14
+ 542:	41 57                	push   %r15
+ 544:	56                   	push   %rsi
+ 545:	49 89 f3             	mov    %rsi,%r11
+ 548:	48 89 d6             	mov    %rdx,%rsi
+ 54b:	49 8b 13             	mov    (%r11),%rdx
+ 54e:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 552:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 556:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 55a:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 55e:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 562:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 566:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 56a:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+ 571:	0f 05                	syscall
+ 573:	41 5b                	pop    %r11
+ 575:	49 89 13             	mov    %rdx,(%r11)
+ 578:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 57c:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 580:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 584:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 588:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 58c:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 590:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 594:	41 5f                	pop    %r15
+ 596:	41 5e                	pop    %r14
+ 598:	41 5d                	pop    %r13
+ 59a:	41 5c                	pop    %r12
+ 59c:	c3                   	ret
+
+000000000000059d <call_reg>:
+SYSCALL_REG(call_reg)
+ 59d:	41 54                	push   %r12
+ 59f:	41 55                	push   %r13
+ 5a1:	41 56                	push   %r14
+ 5a3:	41 57                	push   %r15
+ 5a5:	56                   	push   %rsi
+ 5a6:	49 89 f3             	mov    %rsi,%r11
+ 5a9:	48 89 d6             	mov    %rdx,%rsi
+ 5ac:	49 8b 13             	mov    (%r11),%rdx
+ 5af:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 5b3:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 5b7:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 5bb:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 5bf:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 5c3:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 5c7:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 5cb:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+ 5d2:	0f 05                	syscall
+ 5d4:	41 5b                	pop    %r11
+ 5d6:	49 89 13             	mov    %rdx,(%r11)
+ 5d9:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 5dd:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 5e1:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 5e5:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 5e9:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 5ed:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 5f1:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 5f5:	41 5f                	pop    %r15
+ 5f7:	41 5e                	pop    %r14
+ 5f9:	41 5d                	pop    %r13
+ 5fb:	41 5c                	pop    %r12
+ 5fd:	c3                   	ret
+
+00000000000005fe <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+ 5fe:	41 54                	push   %r12
+ 600:	41 55                	push   %r13
+ 602:	41 56                	push   %r14
+ 604:	41 57                	push   %r15
+ 606:	56                   	push   %rsi
+ 607:	49 89 f3             	mov    %rsi,%r11
+ 60a:	48 89 d6             	mov    %rdx,%rsi
+ 60d:	49 8b 13             	mov    (%r11),%rdx
+ 610:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 614:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 618:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 61c:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 620:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 624:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 628:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 62c:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+ 633:	0f 05                	syscall
+ 635:	41 5b                	pop    %r11
+ 637:	49 89 13             	mov    %rdx,(%r11)
+ 63a:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 63e:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 642:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 646:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 64a:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 64e:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 652:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 656:	41 5f                	pop    %r15
+ 658:	41 5e                	pop    %r14
+ 65a:	41 5d                	pop    %r13
+ 65c:	41 5c                	pop    %r12
+ 65e:	c3                   	ret
+
+000000000000065f <sendx>:
+SYSCALL_FAST(sendx)
+ 65f:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+ 666:	0f 05                	syscall
+ 668:	c3                   	ret
+
+0000000000000669 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+ 669:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+ 670:	0f 05                	syscall
+ 672:	c3                   	ret
+
+0000000000000673 <notify>:
+SYSCALL_FAST(notify)
+ 673:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+ 67a:	0f 05                	syscall
+ 67c:	c3                   	ret
+
+000000000000067d <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+ 67d:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+ 684:	0f 05                	syscall
+ 686:	c3                   	ret
+
+0000000000000687 <send_timed>:
+SYSCALL_FAST(send_timed)
+ 687:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+ 68e:	0f 05                	syscall
+ 690:	c3                   	ret
+
+0000000000000691 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+ 691:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+ 698:	0f 05                	syscall
+ 69a:	c3                   	ret
+
+000000000000069b <set_add>:
+SYSCALL_FAST(set_add)
+ 69b:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+ 6a2:	0f 05                	syscall
+ 6a4:	c3                   	ret
+
+00000000000006a5 <set_del>:
+SYSCALL_FAST(set_del)
+ 6a5:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+ 6ac:	0f 05                	syscall
+ 6ae:	c3                   	ret
+
+00000000000006af <recv_any>:
+SYSCALL_FAST(recv_any)
+ 6af:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+ 6b6:	0f 05                	syscall
+ 6b8:	c3                   	ret
+
+00000000000006b9 <ep_create>:
+SYSCALL_FAST(ep_create)
+ 6b9:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+ 6c0:	0f 05                	syscall
+ 6c2:	c3                   	ret
+
+00000000000006c3 <ep_close>:
+SYSCALL_FAST(ep_close)
+ 6c3:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+ 6ca:	0f 05                	syscall
+ 6cc:	c3                   	ret
+
+00000000000006cd <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+ 6cd:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+ 6d4:	0f 05                	syscall
+ 6d6:	c3                   	ret
+
+00000000000006d7 <setprio>:
+SYSCALL_FAST(setprio)
+ 6d7:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+ 6de:	0f 05                	syscall
+ 6e0:	c3                   	ret
+
+00000000000006e1 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+ 6e1:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+ 6e8:	0f 05                	syscall
+ 6ea:	c3                   	ret
+
+00000000000006eb <sethuge>:
+SYSCALL_FAST(sethuge)
+ 6eb:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+ 6f2:	0f 05                	syscall
+ 6f4:	c3                   	ret
+
+00000000000006f5 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+ 6f5:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+ 6fc:	0f 05                	syscall
+ 6fe:	c3                   	ret
+
+00000000000006ff <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+ 6ff:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+ 706:	0f 05                	syscall
+ 708:	c3                   	ret
+
+0000000000000709 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+ 709:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+ 710:	0f 05                	syscall
+ 712:	c3                   	ret
+
+0000000000000713 <null_call>:
+ 713:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+ 71a:	0f 05                	syscall
+ 71c:	c3                   	ret
+
+000000000000071d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 71d:	55                   	push   %rbp
+ 71e:	48 89 e5             	mov    %rsp,%rbp
+ 721:	48 83 ec 10          	sub    $0x10,%rsp
+ 725:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 728:	89 f0                	mov    %esi,%eax
+ 72a:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+ 72d:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 731:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 734:	ba 01 00 00 00       	mov    $0x1,%edx
+ 739:	48 89 ce             	mov    %rcx,%rsi
+ 73c:	89 c7                	mov    %eax,%edi
+ 73e:	e8 79 fc ff ff       	call   3bc <write>
+}
+ 743:	90                   	nop
+ 744:	c9                   	leave
+ 745:	c3                   	ret
+
+0000000000000746 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 746:	55                   	push   %rbp
+ 747:	48 89 e5             	mov    %rsp,%rbp
+ 74a:	48 83 ec 30          	sub    $0x30,%rsp
+ 74e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 751:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 754:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 757:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 75a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 761:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 765:	74 17                	je     77e <printint+0x38>
+ 767:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 76b:	79 11                	jns    77e <printint+0x38>
+    neg = 1;
+ 76d:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 774:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 777:	f7 d8                	neg    %eax
+ 779:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 77c:	eb 06                	jmp    784 <printint+0x3e>
+  } else {
+    x = xx;
+ 77e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 781:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 784:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 78b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 78e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 791:	ba 00 00 00 00       	mov    $0x0,%edx
+ 796:	f7 f1                	div    %ecx
+ 798:	89 d1                	mov    %edx,%ecx
+ 79a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 79d:	8d 50 01             	lea    0x1(%rax),%edx
+ 7a0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 7a3:	89 ca                	mov    %ecx,%edx
+ 7a5:	0f b6 92 e0 12 00 00 	movzbl 0x12e0(%rdx),%edx
+ 7ac:	48 98                	cltq
+ 7ae:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 7b2:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 7b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 7b8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7bd:	f7 f6                	div    %esi
+ 7bf:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 7c2:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 7c6:	75 c3                	jne    78b <printint+0x45>
+  if(neg)
+ 7c8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 7cc:	74 2b                	je     7f9 <printint+0xb3>
+    buf[i++] = '-';
+ 7ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7d1:	8d 50 01             	lea    0x1(%rax),%edx
+ 7d4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 7d7:	48 98                	cltq
+ 7d9:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 7de:	eb 19                	jmp    7f9 <printint+0xb3>
+    putc(fd, buf[i]);
+ 7e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7e3:	48 98                	cltq
+ 7e5:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+ 7ea:	0f be d0             	movsbl %al,%edx
+ 7ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7f0:	89 d6                	mov    %edx,%esi
+ 7f2:	89 c7                	mov    %eax,%edi
+ 7f4:	e8 24 ff ff ff       	call   71d <putc>
+  while(--i >= 0)
+ 7f9:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 7fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 801:	79 dd                	jns    7e0 <printint+0x9a>
+}
+ 803:	90                   	nop
+ 804:	90                   	nop
+ 805:	c9                   	leave
+ 806:	c3                   	ret
+
+0000000000000807 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 807:	55                   	push   %rbp
+ 808:	48 89 e5             	mov    %rsp,%rbp
+ 80b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+ 812:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+ 818:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+ 81f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+ 826:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+ 82d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+ 834:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+ 83b:	84 c0                	test   %al,%al
+ 83d:	74 20                	je     85f <printf+0x58>
+ 83f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+ 843:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+ 847:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+ 84b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+ 84f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+ 853:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+ 857:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+ 85b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 85f:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+ 866:	00 00 00 
+ 869:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+ 870:	00 00 00 
+ 873:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 877:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+ 87e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+ 885:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+ 88c:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ 893:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ 896:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+ 89d:	00 00 00 
+ 8a0:	e9 a8 02 00 00       	jmp    b4d <printf+0x346>
+    c = fmt[i] & 0xff;
+ 8a5:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ 8ab:	48 63 d0             	movslq %eax,%rdx
+ 8ae:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ 8b5:	48 01 d0             	add    %rdx,%rax
+ 8b8:	0f b6 00             	movzbl (%rax),%eax
+ 8bb:	0f be c0             	movsbl %al,%eax
+ 8be:	25 ff 00 00 00       	and    $0xff,%eax
+ 8c3:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+ 8c9:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+ 8d0:	75 35                	jne    907 <printf+0x100>
+      if(c == '%'){
+ 8d2:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ 8d9:	75 0f                	jne    8ea <printf+0xe3>
+        state = '%';
+ 8db:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+ 8e2:	00 00 00 
+ 8e5:	e9 5c 02 00 00       	jmp    b46 <printf+0x33f>
+      } else {
+        putc(fd, c);
+ 8ea:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ 8f0:	0f be d0             	movsbl %al,%edx
+ 8f3:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 8f9:	89 d6                	mov    %edx,%esi
+ 8fb:	89 c7                	mov    %eax,%edi
+ 8fd:	e8 1b fe ff ff       	call   71d <putc>
+ 902:	e9 3f 02 00 00       	jmp    b46 <printf+0x33f>
+      }
+    } else if(state == '%'){
+ 907:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+ 90e:	0f 85 32 02 00 00    	jne    b46 <printf+0x33f>
+      if(c == 'd'){
+ 914:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+ 91b:	75 5e                	jne    97b <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 91d:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 923:	83 f8 2f             	cmp    $0x2f,%eax
+ 926:	77 23                	ja     94b <printf+0x144>
+ 928:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 92f:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 935:	89 d2                	mov    %edx,%edx
+ 937:	48 01 d0             	add    %rdx,%rax
+ 93a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 940:	83 c2 08             	add    $0x8,%edx
+ 943:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 949:	eb 12                	jmp    95d <printf+0x156>
+ 94b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 952:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 956:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 95d:	8b 30                	mov    (%rax),%esi
+ 95f:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 965:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 96a:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 96f:	89 c7                	mov    %eax,%edi
+ 971:	e8 d0 fd ff ff       	call   746 <printint>
+ 976:	e9 c1 01 00 00       	jmp    b3c <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+ 97b:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+ 982:	74 09                	je     98d <printf+0x186>
+ 984:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+ 98b:	75 5e                	jne    9eb <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 98d:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 993:	83 f8 2f             	cmp    $0x2f,%eax
+ 996:	77 23                	ja     9bb <printf+0x1b4>
+ 998:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 99f:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 9a5:	89 d2                	mov    %edx,%edx
+ 9a7:	48 01 d0             	add    %rdx,%rax
+ 9aa:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 9b0:	83 c2 08             	add    $0x8,%edx
+ 9b3:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 9b9:	eb 12                	jmp    9cd <printf+0x1c6>
+ 9bb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 9c2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 9c6:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 9cd:	8b 30                	mov    (%rax),%esi
+ 9cf:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 9d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 9da:	ba 10 00 00 00       	mov    $0x10,%edx
+ 9df:	89 c7                	mov    %eax,%edi
+ 9e1:	e8 60 fd ff ff       	call   746 <printint>
+ 9e6:	e9 51 01 00 00       	jmp    b3c <printf+0x335>
+      } else if(c == 's'){
+ 9eb:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+ 9f2:	0f 85 98 00 00 00    	jne    a90 <printf+0x289>
+        s = va_arg(ap, char*);
+ 9f8:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 9fe:	83 f8 2f             	cmp    $0x2f,%eax
+ a01:	77 23                	ja     a26 <printf+0x21f>
+ a03:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ a0a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a10:	89 d2                	mov    %edx,%edx
+ a12:	48 01 d0             	add    %rdx,%rax
+ a15:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a1b:	83 c2 08             	add    $0x8,%edx
+ a1e:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ a24:	eb 12                	jmp    a38 <printf+0x231>
+ a26:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ a2d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ a31:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ a38:	48 8b 00             	mov    (%rax),%rax
+ a3b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+ a42:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+ a49:	00 
+ a4a:	75 31                	jne    a7d <printf+0x276>
+          s = "(null)";
+ a4c:	48 c7 85 48 ff ff ff 	movq   $0xff0,-0xb8(%rbp)
+ a53:	f0 0f 00 00 
+        while(*s != 0){
+ a57:	eb 24                	jmp    a7d <printf+0x276>
+          putc(fd, *s);
+ a59:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a60:	0f b6 00             	movzbl (%rax),%eax
+ a63:	0f be d0             	movsbl %al,%edx
+ a66:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ a6c:	89 d6                	mov    %edx,%esi
+ a6e:	89 c7                	mov    %eax,%edi
+ a70:	e8 a8 fc ff ff       	call   71d <putc>
+          s++;
+ a75:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+ a7c:	01 
+        while(*s != 0){
+ a7d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a84:	0f b6 00             	movzbl (%rax),%eax
+ a87:	84 c0                	test   %al,%al
+ a89:	75 ce                	jne    a59 <printf+0x252>
+ a8b:	e9 ac 00 00 00       	jmp    b3c <printf+0x335>
+        }
+      } else if(c == 'c'){
+ a90:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+ a97:	75 56                	jne    aef <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+ a99:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ a9f:	83 f8 2f             	cmp    $0x2f,%eax
+ aa2:	77 23                	ja     ac7 <printf+0x2c0>
+ aa4:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ aab:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ ab1:	89 d2                	mov    %edx,%edx
+ ab3:	48 01 d0             	add    %rdx,%rax
+ ab6:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ abc:	83 c2 08             	add    $0x8,%edx
+ abf:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ ac5:	eb 12                	jmp    ad9 <printf+0x2d2>
+ ac7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ ace:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ ad2:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ ad9:	8b 00                	mov    (%rax),%eax
+ adb:	0f be d0             	movsbl %al,%edx
+ ade:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ ae4:	89 d6                	mov    %edx,%esi
+ ae6:	89 c7                	mov    %eax,%edi
+ ae8:	e8 30 fc ff ff       	call   71d <putc>
+ aed:	eb 4d                	jmp    b3c <printf+0x335>
+      } else if(c == '%'){
+ aef:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ af6:	75 1a                	jne    b12 <printf+0x30b>
+        putc(fd, c);
+ af8:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ afe:	0f be d0             	movsbl %al,%edx
+ b01:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ b07:	89 d6                	mov    %edx,%esi
+ b09:	89 c7                	mov    %eax,%edi
+ b0b:	e8 0d fc ff ff       	call   71d <putc>
+ b10:	eb 2a                	jmp    b3c <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b12:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ b18:	be 25 00 00 00       	mov    $0x25,%esi
+ b1d:	89 c7                	mov    %eax,%edi
+ b1f:	e8 f9 fb ff ff       	call   71d <putc>
+        putc(fd, c);
+ b24:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ b2a:	0f be d0             	movsbl %al,%edx
+ b2d:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ b33:	89 d6                	mov    %edx,%esi
+ b35:	89 c7                	mov    %eax,%edi
+ b37:	e8 e1 fb ff ff       	call   71d <putc>
+      }
+      state = 0;
+ b3c:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ b43:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ b46:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+ b4d:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ b53:	48 63 d0             	movslq %eax,%rdx
+ b56:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ b5d:	48 01 d0             	add    %rdx,%rax
+ b60:	0f b6 00             	movzbl (%rax),%eax
+ b63:	84 c0                	test   %al,%al
+ b65:	0f 85 3a fd ff ff    	jne    8a5 <printf+0x9e>
+    }
+  }
+}
+ b6b:	90                   	nop
+ b6c:	90                   	nop
+ b6d:	c9                   	leave
+ b6e:	c3                   	ret
+
+0000000000000b6f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b6f:	55                   	push   %rbp
+ b70:	48 89 e5             	mov    %rsp,%rbp
+ b73:	48 83 ec 18          	sub    $0x18,%rsp
+ b77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ b7f:	48 83 e8 10          	sub    $0x10,%rax
+ b83:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b87:	48 8b 05 82 07 00 00 	mov    0x782(%rip),%rax        # 1310 <freep>
+ b8e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b92:	eb 2f                	jmp    bc3 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b98:	48 8b 00             	mov    (%rax),%rax
+ b9b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b9f:	72 17                	jb     bb8 <free+0x49>
+ ba1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ba5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ ba9:	72 2f                	jb     bda <free+0x6b>
+ bab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ baf:	48 8b 00             	mov    (%rax),%rax
+ bb2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ bb6:	72 22                	jb     bda <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bbc:	48 8b 00             	mov    (%rax),%rax
+ bbf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ bc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bc7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ bcb:	73 c7                	jae    b94 <free+0x25>
+ bcd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd1:	48 8b 00             	mov    (%rax),%rax
+ bd4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ bd8:	73 ba                	jae    b94 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bde:	8b 40 08             	mov    0x8(%rax),%eax
+ be1:	89 c0                	mov    %eax,%eax
+ be3:	48 c1 e0 04          	shl    $0x4,%rax
+ be7:	48 89 c2             	mov    %rax,%rdx
+ bea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bee:	48 01 c2             	add    %rax,%rdx
+ bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bf5:	48 8b 00             	mov    (%rax),%rax
+ bf8:	48 39 c2             	cmp    %rax,%rdx
+ bfb:	75 2d                	jne    c2a <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+ bfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c01:	8b 50 08             	mov    0x8(%rax),%edx
+ c04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c08:	48 8b 00             	mov    (%rax),%rax
+ c0b:	8b 40 08             	mov    0x8(%rax),%eax
+ c0e:	01 c2                	add    %eax,%edx
+ c10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c14:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c1b:	48 8b 00             	mov    (%rax),%rax
+ c1e:	48 8b 10             	mov    (%rax),%rdx
+ c21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c25:	48 89 10             	mov    %rdx,(%rax)
+ c28:	eb 0e                	jmp    c38 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+ c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c2e:	48 8b 10             	mov    (%rax),%rdx
+ c31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c35:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ c38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c3c:	8b 40 08             	mov    0x8(%rax),%eax
+ c3f:	89 c0                	mov    %eax,%eax
+ c41:	48 c1 e0 04          	shl    $0x4,%rax
+ c45:	48 89 c2             	mov    %rax,%rdx
+ c48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c4c:	48 01 d0             	add    %rdx,%rax
+ c4f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ c53:	75 27                	jne    c7c <free+0x10d>
+    p->s.size += bp->s.size;
+ c55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c59:	8b 50 08             	mov    0x8(%rax),%edx
+ c5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c60:	8b 40 08             	mov    0x8(%rax),%eax
+ c63:	01 c2                	add    %eax,%edx
+ c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c69:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ c6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c70:	48 8b 10             	mov    (%rax),%rdx
+ c73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c77:	48 89 10             	mov    %rdx,(%rax)
+ c7a:	eb 0b                	jmp    c87 <free+0x118>
+  } else
+    p->s.ptr = bp;
+ c7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c80:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ c84:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ c87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c8b:	48 89 05 7e 06 00 00 	mov    %rax,0x67e(%rip)        # 1310 <freep>
+}
+ c92:	90                   	nop
+ c93:	c9                   	leave
+ c94:	c3                   	ret
+
+0000000000000c95 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c95:	55                   	push   %rbp
+ c96:	48 89 e5             	mov    %rsp,%rbp
+ c99:	48 83 ec 20          	sub    $0x20,%rsp
+ c9d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ ca0:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ ca7:	77 07                	ja     cb0 <morecore+0x1b>
+    nu = 4096;
+ ca9:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ cb0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ cb3:	c1 e0 04             	shl    $0x4,%eax
+ cb6:	89 c7                	mov    %eax,%edi
+ cb8:	e8 77 f7 ff ff       	call   434 <sbrk>
+ cbd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ cc1:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ cc6:	75 07                	jne    ccf <morecore+0x3a>
+    return 0;
+ cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+ ccd:	eb 29                	jmp    cf8 <morecore+0x63>
+  hp = (Header*)p;
+ ccf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cd3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ cd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cdb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ cde:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ ce1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ce5:	48 83 c0 10          	add    $0x10,%rax
+ ce9:	48 89 c7             	mov    %rax,%rdi
+ cec:	e8 7e fe ff ff       	call   b6f <free>
+  return freep;
+ cf1:	48 8b 05 18 06 00 00 	mov    0x618(%rip),%rax        # 1310 <freep>
+}
+ cf8:	c9                   	leave
+ cf9:	c3                   	ret
+
+0000000000000cfa <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ cfa:	55                   	push   %rbp
+ cfb:	48 89 e5             	mov    %rsp,%rbp
+ cfe:	48 83 ec 30          	sub    $0x30,%rsp
+ d02:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ d08:	48 83 c0 0f          	add    $0xf,%rax
+ d0c:	48 c1 e8 04          	shr    $0x4,%rax
+ d10:	83 c0 01             	add    $0x1,%eax
+ d13:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+ d16:	48 8b 05 f3 05 00 00 	mov    0x5f3(%rip),%rax        # 1310 <freep>
+ d1d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ d21:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ d26:	75 2b                	jne    d53 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+ d28:	48 c7 45 f0 00 13 00 	movq   $0x1300,-0x10(%rbp)
+ d2f:	00 
+ d30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d34:	48 89 05 d5 05 00 00 	mov    %rax,0x5d5(%rip)        # 1310 <freep>
+ d3b:	48 8b 05 ce 05 00 00 	mov    0x5ce(%rip),%rax        # 1310 <freep>
+ d42:	48 89 05 b7 05 00 00 	mov    %rax,0x5b7(%rip)        # 1300 <base>
+    base.s.size = 0;
+ d49:	c7 05 b5 05 00 00 00 	movl   $0x0,0x5b5(%rip)        # 1308 <base+0x8>
+ d50:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d57:	48 8b 00             	mov    (%rax),%rax
+ d5a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ d5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d62:	8b 40 08             	mov    0x8(%rax),%eax
+ d65:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ d68:	72 5f                	jb     dc9 <malloc+0xcf>
+      if(p->s.size == nunits)
+ d6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d6e:	8b 40 08             	mov    0x8(%rax),%eax
+ d71:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ d74:	75 10                	jne    d86 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+ d76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d7a:	48 8b 10             	mov    (%rax),%rdx
+ d7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d81:	48 89 10             	mov    %rdx,(%rax)
+ d84:	eb 2e                	jmp    db4 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+ d86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d8a:	8b 40 08             	mov    0x8(%rax),%eax
+ d8d:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ d90:	89 c2                	mov    %eax,%edx
+ d92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d96:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ d99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d9d:	8b 40 08             	mov    0x8(%rax),%eax
+ da0:	89 c0                	mov    %eax,%eax
+ da2:	48 c1 e0 04          	shl    $0x4,%rax
+ da6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ daa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ dae:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ db1:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ db4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ db8:	48 89 05 51 05 00 00 	mov    %rax,0x551(%rip)        # 1310 <freep>
+      return (void*)(p + 1);
+ dbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ dc3:	48 83 c0 10          	add    $0x10,%rax
+ dc7:	eb 41                	jmp    e0a <malloc+0x110>
+    }
+    if(p == freep)
+ dc9:	48 8b 05 40 05 00 00 	mov    0x540(%rip),%rax        # 1310 <freep>
+ dd0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ dd4:	75 1c                	jne    df2 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+ dd6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ dd9:	89 c7                	mov    %eax,%edi
+ ddb:	e8 b5 fe ff ff       	call   c95 <morecore>
+ de0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ de4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ de9:	75 07                	jne    df2 <malloc+0xf8>
+        return 0;
+ deb:	b8 00 00 00 00       	mov    $0x0,%eax
+ df0:	eb 18                	jmp    e0a <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ df2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ df6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ dfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ dfe:	48 8b 00             	mov    (%rax),%rax
+ e01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ e05:	e9 54 ff ff ff       	jmp    d5e <malloc+0x64>
+  }
+}
+ e0a:	c9                   	leave
+ e0b:	c3                   	ret
+
+0000000000000e0c <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+ e0c:	55                   	push   %rbp
+ e0d:	48 89 e5             	mov    %rsp,%rbp
+ e10:	53                   	push   %rbx
+ e11:	48 83 ec 38          	sub    $0x38,%rsp
+ e15:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ e18:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ e1c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+ e20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e24:	8b 40 40             	mov    0x40(%rax),%eax
+ e27:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+ e2a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e2e:	8b 00                	mov    (%rax),%eax
+ e30:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ e33:	29 c2                	sub    %eax,%edx
+ e35:	83 fa 20             	cmp    $0x20,%edx
+ e38:	75 0a                	jne    e44 <ring_send+0x38>
+    return -1;
+ e3a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e3f:	e9 93 00 00 00       	jmp    ed7 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+ e44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e47:	83 e0 1f             	and    $0x1f,%eax
+ e4a:	89 c2                	mov    %eax,%edx
+ e4c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e50:	89 d2                	mov    %edx,%edx
+ e52:	48 83 c2 02          	add    $0x2,%rdx
+ e56:	48 c1 e2 06          	shl    $0x6,%rdx
+ e5a:	48 01 c2             	add    %rax,%rdx
+ e5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ e61:	48 8b 08             	mov    (%rax),%rcx
+ e64:	48 8b 58 08          	mov    0x8(%rax),%rbx
+ e68:	48 89 0a             	mov    %rcx,(%rdx)
+ e6b:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+ e6f:	48 8b 48 10          	mov    0x10(%rax),%rcx
+ e73:	48 8b 58 18          	mov    0x18(%rax),%rbx
+ e77:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+ e7b:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+ e7f:	48 8b 48 20          	mov    0x20(%rax),%rcx
+ e83:	48 8b 58 28          	mov    0x28(%rax),%rbx
+ e87:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+ e8b:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+ e8f:	48 8b 48 30          	mov    0x30(%rax),%rcx
+ e93:	48 8b 58 38          	mov    0x38(%rax),%rbx
+ e97:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+ e9b:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+ e9f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+ ea5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ ea8:	8d 50 01             	lea    0x1(%rax),%edx
+ eab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ eaf:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+ eb2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+ eb8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ ebc:	8b 00                	mov    (%rax),%eax
+ ebe:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ ec1:	75 0f                	jne    ed2 <ring_send+0xc6>
+    notify(channel, 1);
+ ec3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ ec6:	be 01 00 00 00       	mov    $0x1,%esi
+ ecb:	89 c7                	mov    %eax,%edi
+ ecd:	e8 a1 f7 ff ff       	call   673 <notify>
+  return 0;
+ ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ ed7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ edb:	c9                   	leave
+ edc:	c3                   	ret
+
+0000000000000edd <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+ edd:	55                   	push   %rbp
+ ede:	48 89 e5             	mov    %rsp,%rbp
+ ee1:	53                   	push   %rbx
+ ee2:	48 83 ec 38          	sub    $0x38,%rsp
+ ee6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ ee9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ eed:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+ ef1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ ef5:	8b 00                	mov    (%rax),%eax
+ ef7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+ efa:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+ f00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ f04:	8b 40 40             	mov    0x40(%rax),%eax
+ f07:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ f0a:	75 15                	jne    f21 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+ f0c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ f0f:	89 c7                	mov    %eax,%edi
+ f11:	e8 67 f7 ff ff       	call   67d <nfy_wait>
+ f16:	85 c0                	test   %eax,%eax
+ f18:	79 e0                	jns    efa <ring_recv+0x1d>
+      return -1;
+ f1a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f1f:	eb 73                	jmp    f94 <ring_recv+0xb7>
+      break;
+ f21:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+ f22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ f25:	83 e0 1f             	and    $0x1f,%eax
+ f28:	89 c1                	mov    %eax,%ecx
+ f2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ f2e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ f32:	89 c9                	mov    %ecx,%ecx
+ f34:	48 83 c1 02          	add    $0x2,%rcx
+ f38:	48 c1 e1 06          	shl    $0x6,%rcx
+ f3c:	48 01 ca             	add    %rcx,%rdx
+ f3f:	48 8b 0a             	mov    (%rdx),%rcx
+ f42:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+ f46:	48 89 08             	mov    %rcx,(%rax)
+ f49:	48 89 58 08          	mov    %rbx,0x8(%rax)
+ f4d:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+ f51:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+ f55:	48 89 48 10          	mov    %rcx,0x10(%rax)
+ f59:	48 89 58 18          	mov    %rbx,0x18(%rax)
+ f5d:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+ f61:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+ f65:	48 89 48 20          	mov    %rcx,0x20(%rax)
+ f69:	48 89 58 28          	mov    %rbx,0x28(%rax)
+ f6d:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+ f71:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+ f75:	48 89 48 30          	mov    %rcx,0x30(%rax)
+ f79:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+ f7d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+ f83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ f86:	8d 50 01             	lea    0x1(%rax),%edx
+ f89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ f8d:	89 10                	mov    %edx,(%rax)
+  return 0;
+ f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ f94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ f98:	c9                   	leave
+ f99:	c3                   	ret
+
+0000000000000f9a <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+ f9a:	55                   	push   %rbp
+ f9b:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+ f9e:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ fa3:	8b 00                	mov    (%rax),%eax
+}
+ fa5:	5d                   	pop    %rbp
+ fa6:	c3                   	ret
+
+0000000000000fa7 <getpid>:
+
+int
+getpid(void)
+{
+ fa7:	55                   	push   %rbp
+ fa8:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+ fab:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+ fb0:	8b 00                	mov    (%rax),%eax
+}
+ fb2:	5d                   	pop    %rbp
+ fb3:	c3                   	ret
+
+0000000000000fb4 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+ fb4:	55                   	push   %rbp
+ fb5:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+ fb8:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ fbd:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+ fc1:	5d                   	pop    %rbp
+ fc2:	c3                   	ret
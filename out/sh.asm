@@ -0,0 +1,3118 @@
+
+fs/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <runcmd>:
+struct cmd *parsecmd(char*);
+
+// Execute cmd.  Never returns.
+void
+runcmd(struct cmd *cmd)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 40          	sub    $0x40,%rsp
+       8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+       c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+      11:	75 05                	jne    18 <runcmd+0x18>
+    exit();
+      13:	e8 d9 10 00 00       	call   10f1 <exit>
+  
+  switch(cmd->type){
+      18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      1c:	8b 00                	mov    (%rax),%eax
+      1e:	83 f8 05             	cmp    $0x5,%eax
+      21:	77 0c                	ja     2f <runcmd+0x2f>
+      23:	89 c0                	mov    %eax,%eax
+      25:	48 8b 04 c5 50 1d 00 	mov    0x1d50(,%rax,8),%rax
+      2c:	00 
+      2d:	ff e0                	jmp    *%rax
+  default:
+    panic("runcmd");
+      2f:	48 c7 c7 20 1d 00 00 	mov    $0x1d20,%rdi
+      36:	e8 40 03 00 00       	call   37b <panic>
+
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+      3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      3f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if(ecmd->argv[0] == 0)
+      43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      47:	48 8b 40 08          	mov    0x8(%rax),%rax
+      4b:	48 85 c0             	test   %rax,%rax
+      4e:	75 05                	jne    55 <runcmd+0x55>
+      exit();
+      50:	e8 9c 10 00 00       	call   10f1 <exit>
+    exec(ecmd->argv[0], ecmd->argv);
+      55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      59:	48 8d 50 08          	lea    0x8(%rax),%rdx
+      5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      61:	48 8b 40 08          	mov    0x8(%rax),%rax
+      65:	48 89 d6             	mov    %rdx,%rsi
+      68:	48 89 c7             	mov    %rax,%rdi
+      6b:	e8 c7 10 00 00       	call   1137 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      74:	48 8b 40 08          	mov    0x8(%rax),%rax
+      78:	48 89 c2             	mov    %rax,%rdx
+      7b:	48 c7 c6 27 1d 00 00 	mov    $0x1d27,%rsi
+      82:	bf 02 00 00 00       	mov    $0x2,%edi
+      87:	b8 00 00 00 00       	mov    $0x0,%eax
+      8c:	e8 d3 14 00 00       	call   1564 <printf>
+    break;
+      91:	e9 91 01 00 00       	jmp    227 <runcmd+0x227>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+      96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      9a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    close(rcmd->fd);
+      9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      a2:	8b 40 24             	mov    0x24(%rax),%eax
+      a5:	89 c7                	mov    %eax,%edi
+      a7:	e8 77 10 00 00       	call   1123 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+      ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      b0:	8b 50 20             	mov    0x20(%rax),%edx
+      b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      b7:	48 8b 40 10          	mov    0x10(%rax),%rax
+      bb:	89 d6                	mov    %edx,%esi
+      bd:	48 89 c7             	mov    %rax,%rdi
+      c0:	e8 7c 10 00 00       	call   1141 <open>
+      c5:	85 c0                	test   %eax,%eax
+      c7:	79 26                	jns    ef <runcmd+0xef>
+      printf(2, "open %s failed\n", rcmd->file);
+      c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      cd:	48 8b 40 10          	mov    0x10(%rax),%rax
+      d1:	48 89 c2             	mov    %rax,%rdx
+      d4:	48 c7 c6 37 1d 00 00 	mov    $0x1d37,%rsi
+      db:	bf 02 00 00 00       	mov    $0x2,%edi
+      e0:	b8 00 00 00 00       	mov    $0x0,%eax
+      e5:	e8 7a 14 00 00       	call   1564 <printf>
+      exit();
+      ea:	e8 02 10 00 00       	call   10f1 <exit>
+    }
+    runcmd(rcmd->cmd);
+      ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      f3:	48 8b 40 08          	mov    0x8(%rax),%rax
+      f7:	48 89 c7             	mov    %rax,%rdi
+      fa:	e8 01 ff ff ff       	call   0 <runcmd>
+    break;
+      ff:	e9 23 01 00 00       	jmp    227 <runcmd+0x227>
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+     104:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     108:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(fork1() == 0)
+     10c:	e8 98 02 00 00       	call   3a9 <fork1>
+     111:	85 c0                	test   %eax,%eax
+     113:	75 10                	jne    125 <runcmd+0x125>
+      runcmd(lcmd->left);
+     115:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     119:	48 8b 40 08          	mov    0x8(%rax),%rax
+     11d:	48 89 c7             	mov    %rax,%rdi
+     120:	e8 db fe ff ff       	call   0 <runcmd>
+    wait();
+     125:	e8 d1 0f 00 00       	call   10fb <wait>
+    runcmd(lcmd->right);
+     12a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     12e:	48 8b 40 10          	mov    0x10(%rax),%rax
+     132:	48 89 c7             	mov    %rax,%rdi
+     135:	e8 c6 fe ff ff       	call   0 <runcmd>
+    break;
+     13a:	e9 e8 00 00 00       	jmp    227 <runcmd+0x227>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     13f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     143:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if(pipe(p) < 0)
+     147:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     14b:	48 89 c7             	mov    %rax,%rdi
+     14e:	e8 b2 0f 00 00       	call   1105 <pipe>
+     153:	85 c0                	test   %eax,%eax
+     155:	79 0c                	jns    163 <runcmd+0x163>
+      panic("pipe");
+     157:	48 c7 c7 47 1d 00 00 	mov    $0x1d47,%rdi
+     15e:	e8 18 02 00 00       	call   37b <panic>
+    if(fork1() == 0){
+     163:	e8 41 02 00 00       	call   3a9 <fork1>
+     168:	85 c0                	test   %eax,%eax
+     16a:	75 38                	jne    1a4 <runcmd+0x1a4>
+      close(1);
+     16c:	bf 01 00 00 00       	mov    $0x1,%edi
+     171:	e8 ad 0f 00 00       	call   1123 <close>
+      dup(p[1]);
+     176:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     179:	89 c7                	mov    %eax,%edi
+     17b:	e8 07 10 00 00       	call   1187 <dup>
+      close(p[0]);
+     180:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     183:	89 c7                	mov    %eax,%edi
+     185:	e8 99 0f 00 00       	call   1123 <close>
+      close(p[1]);
+     18a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     18d:	89 c7                	mov    %eax,%edi
+     18f:	e8 8f 0f 00 00       	call   1123 <close>
+      runcmd(pcmd->left);
+     194:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     198:	48 8b 40 08          	mov    0x8(%rax),%rax
+     19c:	48 89 c7             	mov    %rax,%rdi
+     19f:	e8 5c fe ff ff       	call   0 <runcmd>
+    }
+    if(fork1() == 0){
+     1a4:	e8 00 02 00 00       	call   3a9 <fork1>
+     1a9:	85 c0                	test   %eax,%eax
+     1ab:	75 38                	jne    1e5 <runcmd+0x1e5>
+      close(0);
+     1ad:	bf 00 00 00 00       	mov    $0x0,%edi
+     1b2:	e8 6c 0f 00 00       	call   1123 <close>
+      dup(p[0]);
+     1b7:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     1ba:	89 c7                	mov    %eax,%edi
+     1bc:	e8 c6 0f 00 00       	call   1187 <dup>
+      close(p[0]);
+     1c1:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     1c4:	89 c7                	mov    %eax,%edi
+     1c6:	e8 58 0f 00 00       	call   1123 <close>
+      close(p[1]);
+     1cb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     1ce:	89 c7                	mov    %eax,%edi
+     1d0:	e8 4e 0f 00 00       	call   1123 <close>
+      runcmd(pcmd->right);
+     1d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1d9:	48 8b 40 10          	mov    0x10(%rax),%rax
+     1dd:	48 89 c7             	mov    %rax,%rdi
+     1e0:	e8 1b fe ff ff       	call   0 <runcmd>
+    }
+    close(p[0]);
+     1e5:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     1e8:	89 c7                	mov    %eax,%edi
+     1ea:	e8 34 0f 00 00       	call   1123 <close>
+    close(p[1]);
+     1ef:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     1f2:	89 c7                	mov    %eax,%edi
+     1f4:	e8 2a 0f 00 00       	call   1123 <close>
+    wait();
+     1f9:	e8 fd 0e 00 00       	call   10fb <wait>
+    wait();
+     1fe:	e8 f8 0e 00 00       	call   10fb <wait>
+    break;
+     203:	eb 22                	jmp    227 <runcmd+0x227>
+    
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     205:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     209:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(fork1() == 0)
+     20d:	e8 97 01 00 00       	call   3a9 <fork1>
+     212:	85 c0                	test   %eax,%eax
+     214:	75 10                	jne    226 <runcmd+0x226>
+      runcmd(bcmd->cmd);
+     216:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     21a:	48 8b 40 08          	mov    0x8(%rax),%rax
+     21e:	48 89 c7             	mov    %rax,%rdi
+     221:	e8 da fd ff ff       	call   0 <runcmd>
+    break;
+     226:	90                   	nop
+  }
+  exit();
+     227:	e8 c5 0e 00 00       	call   10f1 <exit>
+
+000000000000022c <getcmd>:
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+     22c:	55                   	push   %rbp
+     22d:	48 89 e5             	mov    %rsp,%rbp
+     230:	48 83 ec 10          	sub    $0x10,%rsp
+     234:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     238:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  printf(2, "$ ");
+     23b:	48 c7 c6 80 1d 00 00 	mov    $0x1d80,%rsi
+     242:	bf 02 00 00 00       	mov    $0x2,%edi
+     247:	b8 00 00 00 00       	mov    $0x0,%eax
+     24c:	e8 13 13 00 00       	call   1564 <printf>
+  memset(buf, 0, nbuf);
+     251:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     254:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     258:	be 00 00 00 00       	mov    $0x0,%esi
+     25d:	48 89 c7             	mov    %rax,%rdi
+     260:	e8 95 0c 00 00       	call   efa <memset>
+  gets(buf, nbuf);
+     265:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     268:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     26c:	89 d6                	mov    %edx,%esi
+     26e:	48 89 c7             	mov    %rax,%rdi
+     271:	e8 ec 0c 00 00       	call   f62 <gets>
+  if(buf[0] == 0) // EOF
+     276:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     27a:	0f b6 00             	movzbl (%rax),%eax
+     27d:	84 c0                	test   %al,%al
+     27f:	75 07                	jne    288 <getcmd+0x5c>
+    return -1;
+     281:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     286:	eb 05                	jmp    28d <getcmd+0x61>
+  return 0;
+     288:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     28d:	c9                   	leave
+     28e:	c3                   	ret
+
+000000000000028f <main>:
+
+int
+main(void)
+{
+     28f:	55                   	push   %rbp
+     290:	48 89 e5             	mov    %rsp,%rbp
+     293:	48 83 ec 10          	sub    $0x10,%rsp
+  static char buf[100];
+  int fd;
+  
+  // Assumes three file descriptors open.
+  while((fd = open("console", O_RDWR)) >= 0){
+     297:	eb 12                	jmp    2ab <main+0x1c>
+    if(fd >= 3){
+     299:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+     29d:	7e 0c                	jle    2ab <main+0x1c>
+      close(fd);
+     29f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2a2:	89 c7                	mov    %eax,%edi
+     2a4:	e8 7a 0e 00 00       	call   1123 <close>
+      break;
+     2a9:	eb 1a                	jmp    2c5 <main+0x36>
+  while((fd = open("console", O_RDWR)) >= 0){
+     2ab:	be 02 00 00 00       	mov    $0x2,%esi
+     2b0:	48 c7 c7 83 1d 00 00 	mov    $0x1d83,%rdi
+     2b7:	e8 85 0e 00 00       	call   1141 <open>
+     2bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     2bf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     2c3:	79 d4                	jns    299 <main+0xa>
+    }
+  }
+  
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     2c5:	e9 93 00 00 00       	jmp    35d <main+0xce>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     2ca:	0f b6 05 cf 20 00 00 	movzbl 0x20cf(%rip),%eax        # 23a0 <buf.0>
+     2d1:	3c 63                	cmp    $0x63,%al
+     2d3:	75 63                	jne    338 <main+0xa9>
+     2d5:	0f b6 05 c5 20 00 00 	movzbl 0x20c5(%rip),%eax        # 23a1 <buf.0+0x1>
+     2dc:	3c 64                	cmp    $0x64,%al
+     2de:	75 58                	jne    338 <main+0xa9>
+     2e0:	0f b6 05 bb 20 00 00 	movzbl 0x20bb(%rip),%eax        # 23a2 <buf.0+0x2>
+     2e7:	3c 20                	cmp    $0x20,%al
+     2e9:	75 4d                	jne    338 <main+0xa9>
+      // Clumsy but will have to do for now.
+      // Chdir has no effect on the parent if run in the child.
+      buf[strlen(buf)-1] = 0;  // chop \n
+     2eb:	48 c7 c7 a0 23 00 00 	mov    $0x23a0,%rdi
+     2f2:	e8 d1 0b 00 00       	call   ec8 <strlen>
+     2f7:	83 e8 01             	sub    $0x1,%eax
+     2fa:	89 c0                	mov    %eax,%eax
+     2fc:	c6 80 a0 23 00 00 00 	movb   $0x0,0x23a0(%rax)
+      if(chdir(buf+3) < 0)
+     303:	48 c7 c0 a3 23 00 00 	mov    $0x23a3,%rax
+     30a:	48 89 c7             	mov    %rax,%rdi
+     30d:	e8 6b 0e 00 00       	call   117d <chdir>
+     312:	85 c0                	test   %eax,%eax
+     314:	79 46                	jns    35c <main+0xcd>
+        printf(2, "cannot cd %s\n", buf+3);
+     316:	48 c7 c0 a3 23 00 00 	mov    $0x23a3,%rax
+     31d:	48 89 c2             	mov    %rax,%rdx
+     320:	48 c7 c6 8b 1d 00 00 	mov    $0x1d8b,%rsi
+     327:	bf 02 00 00 00       	mov    $0x2,%edi
+     32c:	b8 00 00 00 00       	mov    $0x0,%eax
+     331:	e8 2e 12 00 00       	call   1564 <printf>
+      continue;
+     336:	eb 24                	jmp    35c <main+0xcd>
+    }
+    if(fork1() == 0)
+     338:	e8 6c 00 00 00       	call   3a9 <fork1>
+     33d:	85 c0                	test   %eax,%eax
+     33f:	75 14                	jne    355 <main+0xc6>
+      runcmd(parsecmd(buf));
+     341:	48 c7 c7 a0 23 00 00 	mov    $0x23a0,%rdi
+     348:	e8 53 04 00 00       	call   7a0 <parsecmd>
+     34d:	48 89 c7             	mov    %rax,%rdi
+     350:	e8 ab fc ff ff       	call   0 <runcmd>
+    wait();
+     355:	e8 a1 0d 00 00       	call   10fb <wait>
+     35a:	eb 01                	jmp    35d <main+0xce>
+      continue;
+     35c:	90                   	nop
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     35d:	be 64 00 00 00       	mov    $0x64,%esi
+     362:	48 c7 c7 a0 23 00 00 	mov    $0x23a0,%rdi
+     369:	e8 be fe ff ff       	call   22c <getcmd>
+     36e:	85 c0                	test   %eax,%eax
+     370:	0f 89 54 ff ff ff    	jns    2ca <main+0x3b>
+  }
+  exit();
+     376:	e8 76 0d 00 00       	call   10f1 <exit>
+
+000000000000037b <panic>:
+}
+
+void
+panic(char *s)
+{
+     37b:	55                   	push   %rbp
+     37c:	48 89 e5             	mov    %rsp,%rbp
+     37f:	48 83 ec 10          	sub    $0x10,%rsp
+     383:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  printf(2, "%s\n", s);
+     387:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     38b:	48 89 c2             	mov    %rax,%rdx
+     38e:	48 c7 c6 99 1d 00 00 	mov    $0x1d99,%rsi
+     395:	bf 02 00 00 00       	mov    $0x2,%edi
+     39a:	b8 00 00 00 00       	mov    $0x0,%eax
+     39f:	e8 c0 11 00 00       	call   1564 <printf>
+  exit();
+     3a4:	e8 48 0d 00 00       	call   10f1 <exit>
+
+00000000000003a9 <fork1>:
+}
+
+int
+fork1(void)
+{
+     3a9:	55                   	push   %rbp
+     3aa:	48 89 e5             	mov    %rsp,%rbp
+     3ad:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid;
+  
+  pid = fork();
+     3b1:	e8 31 0d 00 00       	call   10e7 <fork>
+     3b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid == -1)
+     3b9:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     3bd:	75 0c                	jne    3cb <fork1+0x22>
+    panic("fork");
+     3bf:	48 c7 c7 9d 1d 00 00 	mov    $0x1d9d,%rdi
+     3c6:	e8 b0 ff ff ff       	call   37b <panic>
+  return pid;
+     3cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     3ce:	c9                   	leave
+     3cf:	c3                   	ret
+
+00000000000003d0 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     3d0:	55                   	push   %rbp
+     3d1:	48 89 e5             	mov    %rsp,%rbp
+     3d4:	48 83 ec 10          	sub    $0x10,%rsp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3d8:	bf a8 00 00 00       	mov    $0xa8,%edi
+     3dd:	e8 75 16 00 00       	call   1a57 <malloc>
+     3e2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     3e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3ea:	ba a8 00 00 00       	mov    $0xa8,%edx
+     3ef:	be 00 00 00 00       	mov    $0x0,%esi
+     3f4:	48 89 c7             	mov    %rax,%rdi
+     3f7:	e8 fe 0a 00 00       	call   efa <memset>
+  cmd->type = EXEC;
+     3fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     400:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  return (struct cmd*)cmd;
+     406:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     40a:	c9                   	leave
+     40b:	c3                   	ret
+
+000000000000040c <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     40c:	55                   	push   %rbp
+     40d:	48 89 e5             	mov    %rsp,%rbp
+     410:	48 83 ec 30          	sub    $0x30,%rsp
+     414:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     418:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     41c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+     420:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+     423:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     427:	bf 28 00 00 00       	mov    $0x28,%edi
+     42c:	e8 26 16 00 00       	call   1a57 <malloc>
+     431:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     435:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     439:	ba 28 00 00 00       	mov    $0x28,%edx
+     43e:	be 00 00 00 00       	mov    $0x0,%esi
+     443:	48 89 c7             	mov    %rax,%rdi
+     446:	e8 af 0a 00 00       	call   efa <memset>
+  cmd->type = REDIR;
+     44b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     44f:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+  cmd->cmd = subcmd;
+     455:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     459:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     45d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->file = file;
+     461:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     465:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     469:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  cmd->efile = efile;
+     46d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     471:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     475:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  cmd->mode = mode;
+     479:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     47d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+     480:	89 50 20             	mov    %edx,0x20(%rax)
+  cmd->fd = fd;
+     483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     487:	8b 55 d0             	mov    -0x30(%rbp),%edx
+     48a:	89 50 24             	mov    %edx,0x24(%rax)
+  return (struct cmd*)cmd;
+     48d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     491:	c9                   	leave
+     492:	c3                   	ret
+
+0000000000000493 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     493:	55                   	push   %rbp
+     494:	48 89 e5             	mov    %rsp,%rbp
+     497:	48 83 ec 20          	sub    $0x20,%rsp
+     49b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     49f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4a3:	bf 18 00 00 00       	mov    $0x18,%edi
+     4a8:	e8 aa 15 00 00       	call   1a57 <malloc>
+     4ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     4b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4b5:	ba 18 00 00 00       	mov    $0x18,%edx
+     4ba:	be 00 00 00 00       	mov    $0x0,%esi
+     4bf:	48 89 c7             	mov    %rax,%rdi
+     4c2:	e8 33 0a 00 00       	call   efa <memset>
+  cmd->type = PIPE;
+     4c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4cb:	c7 00 03 00 00 00    	movl   $0x3,(%rax)
+  cmd->left = left;
+     4d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4d5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     4d9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->right = right;
+     4dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4e1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     4e5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return (struct cmd*)cmd;
+     4e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     4ed:	c9                   	leave
+     4ee:	c3                   	ret
+
+00000000000004ef <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     4ef:	55                   	push   %rbp
+     4f0:	48 89 e5             	mov    %rsp,%rbp
+     4f3:	48 83 ec 20          	sub    $0x20,%rsp
+     4f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     4fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4ff:	bf 18 00 00 00       	mov    $0x18,%edi
+     504:	e8 4e 15 00 00       	call   1a57 <malloc>
+     509:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     50d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     511:	ba 18 00 00 00       	mov    $0x18,%edx
+     516:	be 00 00 00 00       	mov    $0x0,%esi
+     51b:	48 89 c7             	mov    %rax,%rdi
+     51e:	e8 d7 09 00 00       	call   efa <memset>
+  cmd->type = LIST;
+     523:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     527:	c7 00 04 00 00 00    	movl   $0x4,(%rax)
+  cmd->left = left;
+     52d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     531:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     535:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->right = right;
+     539:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     53d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     541:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return (struct cmd*)cmd;
+     545:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     549:	c9                   	leave
+     54a:	c3                   	ret
+
+000000000000054b <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     54b:	55                   	push   %rbp
+     54c:	48 89 e5             	mov    %rsp,%rbp
+     54f:	48 83 ec 20          	sub    $0x20,%rsp
+     553:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     557:	bf 10 00 00 00       	mov    $0x10,%edi
+     55c:	e8 f6 14 00 00       	call   1a57 <malloc>
+     561:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     565:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     569:	ba 10 00 00 00       	mov    $0x10,%edx
+     56e:	be 00 00 00 00       	mov    $0x0,%esi
+     573:	48 89 c7             	mov    %rax,%rdi
+     576:	e8 7f 09 00 00       	call   efa <memset>
+  cmd->type = BACK;
+     57b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     57f:	c7 00 05 00 00 00    	movl   $0x5,(%rax)
+  cmd->cmd = subcmd;
+     585:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     589:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     58d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return (struct cmd*)cmd;
+     591:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     595:	c9                   	leave
+     596:	c3                   	ret
+
+0000000000000597 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     597:	55                   	push   %rbp
+     598:	48 89 e5             	mov    %rsp,%rbp
+     59b:	48 83 ec 30          	sub    $0x30,%rsp
+     59f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     5a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     5a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+     5ab:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  char *s;
+  int ret;
+  
+  s = *ps;
+     5af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     5b3:	48 8b 00             	mov    (%rax),%rax
+     5b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     5ba:	eb 05                	jmp    5c1 <gettoken+0x2a>
+    s++;
+     5bc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     5c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5c5:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     5c9:	73 1d                	jae    5e8 <gettoken+0x51>
+     5cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5cf:	0f b6 00             	movzbl (%rax),%eax
+     5d2:	0f be c0             	movsbl %al,%eax
+     5d5:	89 c6                	mov    %eax,%esi
+     5d7:	48 c7 c7 70 23 00 00 	mov    $0x2370,%rdi
+     5de:	e8 43 09 00 00       	call   f26 <strchr>
+     5e3:	48 85 c0             	test   %rax,%rax
+     5e6:	75 d4                	jne    5bc <gettoken+0x25>
+  if(q)
+     5e8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     5ed:	74 0b                	je     5fa <gettoken+0x63>
+    *q = s;
+     5ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     5f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     5f7:	48 89 10             	mov    %rdx,(%rax)
+  ret = *s;
+     5fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5fe:	0f b6 00             	movzbl (%rax),%eax
+     601:	0f be c0             	movsbl %al,%eax
+     604:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  switch(*s){
+     607:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     60b:	0f b6 00             	movzbl (%rax),%eax
+     60e:	0f be c0             	movsbl %al,%eax
+     611:	83 f8 7c             	cmp    $0x7c,%eax
+     614:	74 2c                	je     642 <gettoken+0xab>
+     616:	83 f8 7c             	cmp    $0x7c,%eax
+     619:	7f 4c                	jg     667 <gettoken+0xd0>
+     61b:	83 f8 3e             	cmp    $0x3e,%eax
+     61e:	74 29                	je     649 <gettoken+0xb2>
+     620:	83 f8 3e             	cmp    $0x3e,%eax
+     623:	7f 42                	jg     667 <gettoken+0xd0>
+     625:	83 f8 3c             	cmp    $0x3c,%eax
+     628:	7f 3d                	jg     667 <gettoken+0xd0>
+     62a:	83 f8 3b             	cmp    $0x3b,%eax
+     62d:	7d 13                	jge    642 <gettoken+0xab>
+     62f:	83 f8 29             	cmp    $0x29,%eax
+     632:	7f 33                	jg     667 <gettoken+0xd0>
+     634:	83 f8 28             	cmp    $0x28,%eax
+     637:	7d 09                	jge    642 <gettoken+0xab>
+     639:	85 c0                	test   %eax,%eax
+     63b:	74 7e                	je     6bb <gettoken+0x124>
+     63d:	83 f8 26             	cmp    $0x26,%eax
+     640:	75 25                	jne    667 <gettoken+0xd0>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     642:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    break;
+     647:	eb 79                	jmp    6c2 <gettoken+0x12b>
+  case '>':
+    s++;
+     649:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    if(*s == '>'){
+     64e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     652:	0f b6 00             	movzbl (%rax),%eax
+     655:	3c 3e                	cmp    $0x3e,%al
+     657:	75 65                	jne    6be <gettoken+0x127>
+      ret = '+';
+     659:	c7 45 f4 2b 00 00 00 	movl   $0x2b,-0xc(%rbp)
+      s++;
+     660:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    }
+    break;
+     665:	eb 57                	jmp    6be <gettoken+0x127>
+  default:
+    ret = 'a';
+     667:	c7 45 f4 61 00 00 00 	movl   $0x61,-0xc(%rbp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     66e:	eb 05                	jmp    675 <gettoken+0xde>
+      s++;
+     670:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     675:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     679:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     67d:	73 42                	jae    6c1 <gettoken+0x12a>
+     67f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     683:	0f b6 00             	movzbl (%rax),%eax
+     686:	0f be c0             	movsbl %al,%eax
+     689:	89 c6                	mov    %eax,%esi
+     68b:	48 c7 c7 70 23 00 00 	mov    $0x2370,%rdi
+     692:	e8 8f 08 00 00       	call   f26 <strchr>
+     697:	48 85 c0             	test   %rax,%rax
+     69a:	75 25                	jne    6c1 <gettoken+0x12a>
+     69c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6a0:	0f b6 00             	movzbl (%rax),%eax
+     6a3:	0f be c0             	movsbl %al,%eax
+     6a6:	89 c6                	mov    %eax,%esi
+     6a8:	48 c7 c7 78 23 00 00 	mov    $0x2378,%rdi
+     6af:	e8 72 08 00 00       	call   f26 <strchr>
+     6b4:	48 85 c0             	test   %rax,%rax
+     6b7:	74 b7                	je     670 <gettoken+0xd9>
+    break;
+     6b9:	eb 06                	jmp    6c1 <gettoken+0x12a>
+    break;
+     6bb:	90                   	nop
+     6bc:	eb 04                	jmp    6c2 <gettoken+0x12b>
+    break;
+     6be:	90                   	nop
+     6bf:	eb 01                	jmp    6c2 <gettoken+0x12b>
+    break;
+     6c1:	90                   	nop
+  }
+  if(eq)
+     6c2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     6c7:	74 12                	je     6db <gettoken+0x144>
+    *eq = s;
+     6c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     6cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     6d1:	48 89 10             	mov    %rdx,(%rax)
+  
+  while(s < es && strchr(whitespace, *s))
+     6d4:	eb 05                	jmp    6db <gettoken+0x144>
+    s++;
+     6d6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     6db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6df:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     6e3:	73 1d                	jae    702 <gettoken+0x16b>
+     6e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6e9:	0f b6 00             	movzbl (%rax),%eax
+     6ec:	0f be c0             	movsbl %al,%eax
+     6ef:	89 c6                	mov    %eax,%esi
+     6f1:	48 c7 c7 70 23 00 00 	mov    $0x2370,%rdi
+     6f8:	e8 29 08 00 00       	call   f26 <strchr>
+     6fd:	48 85 c0             	test   %rax,%rax
+     700:	75 d4                	jne    6d6 <gettoken+0x13f>
+  *ps = s;
+     702:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     706:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     70a:	48 89 10             	mov    %rdx,(%rax)
+  return ret;
+     70d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+}
+     710:	c9                   	leave
+     711:	c3                   	ret
+
+0000000000000712 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     712:	55                   	push   %rbp
+     713:	48 89 e5             	mov    %rsp,%rbp
+     716:	48 83 ec 30          	sub    $0x30,%rsp
+     71a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     71e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     722:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  char *s;
+  
+  s = *ps;
+     726:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     72a:	48 8b 00             	mov    (%rax),%rax
+     72d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     731:	eb 05                	jmp    738 <peek+0x26>
+    s++;
+     733:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     738:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     73c:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     740:	73 1d                	jae    75f <peek+0x4d>
+     742:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     746:	0f b6 00             	movzbl (%rax),%eax
+     749:	0f be c0             	movsbl %al,%eax
+     74c:	89 c6                	mov    %eax,%esi
+     74e:	48 c7 c7 70 23 00 00 	mov    $0x2370,%rdi
+     755:	e8 cc 07 00 00       	call   f26 <strchr>
+     75a:	48 85 c0             	test   %rax,%rax
+     75d:	75 d4                	jne    733 <peek+0x21>
+  *ps = s;
+     75f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     763:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     767:	48 89 10             	mov    %rdx,(%rax)
+  return *s && strchr(toks, *s);
+     76a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     76e:	0f b6 00             	movzbl (%rax),%eax
+     771:	84 c0                	test   %al,%al
+     773:	74 24                	je     799 <peek+0x87>
+     775:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     779:	0f b6 00             	movzbl (%rax),%eax
+     77c:	0f be d0             	movsbl %al,%edx
+     77f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     783:	89 d6                	mov    %edx,%esi
+     785:	48 89 c7             	mov    %rax,%rdi
+     788:	e8 99 07 00 00       	call   f26 <strchr>
+     78d:	48 85 c0             	test   %rax,%rax
+     790:	74 07                	je     799 <peek+0x87>
+     792:	b8 01 00 00 00       	mov    $0x1,%eax
+     797:	eb 05                	jmp    79e <peek+0x8c>
+     799:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     79e:	c9                   	leave
+     79f:	c3                   	ret
+
+00000000000007a0 <parsecmd>:
+struct cmd *parseexec(char**, char*);
+struct cmd *nulterminate(struct cmd*);
+
+struct cmd*
+parsecmd(char *s)
+{
+     7a0:	55                   	push   %rbp
+     7a1:	48 89 e5             	mov    %rsp,%rbp
+     7a4:	53                   	push   %rbx
+     7a5:	48 83 ec 28          	sub    $0x28,%rsp
+     7a9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  char *es;
+  struct cmd *cmd;
+
+  es = s + strlen(s);
+     7ad:	48 8b 5d d8          	mov    -0x28(%rbp),%rbx
+     7b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     7b5:	48 89 c7             	mov    %rax,%rdi
+     7b8:	e8 0b 07 00 00       	call   ec8 <strlen>
+     7bd:	89 c0                	mov    %eax,%eax
+     7bf:	48 01 d8             	add    %rbx,%rax
+     7c2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  cmd = parseline(&s, es);
+     7c6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     7ca:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+     7ce:	48 89 d6             	mov    %rdx,%rsi
+     7d1:	48 89 c7             	mov    %rax,%rdi
+     7d4:	e8 67 00 00 00       	call   840 <parseline>
+     7d9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  peek(&s, es, "");
+     7dd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     7e1:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+     7e5:	48 c7 c2 a2 1d 00 00 	mov    $0x1da2,%rdx
+     7ec:	48 89 ce             	mov    %rcx,%rsi
+     7ef:	48 89 c7             	mov    %rax,%rdi
+     7f2:	e8 1b ff ff ff       	call   712 <peek>
+  if(s != es){
+     7f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     7fb:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     7ff:	74 29                	je     82a <parsecmd+0x8a>
+    printf(2, "leftovers: %s\n", s);
+     801:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     805:	48 89 c2             	mov    %rax,%rdx
+     808:	48 c7 c6 a3 1d 00 00 	mov    $0x1da3,%rsi
+     80f:	bf 02 00 00 00       	mov    $0x2,%edi
+     814:	b8 00 00 00 00       	mov    $0x0,%eax
+     819:	e8 46 0d 00 00       	call   1564 <printf>
+    panic("syntax");
+     81e:	48 c7 c7 b2 1d 00 00 	mov    $0x1db2,%rdi
+     825:	e8 51 fb ff ff       	call   37b <panic>
+  }
+  nulterminate(cmd);
+     82a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     82e:	48 89 c7             	mov    %rax,%rdi
+     831:	e8 b2 04 00 00       	call   ce8 <nulterminate>
+  return cmd;
+     836:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+     83a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     83e:	c9                   	leave
+     83f:	c3                   	ret
+
+0000000000000840 <parseline>:
+
+struct cmd*
+parseline(char **ps, char *es)
+{
+     840:	55                   	push   %rbp
+     841:	48 89 e5             	mov    %rsp,%rbp
+     844:	48 83 ec 20          	sub    $0x20,%rsp
+     848:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     84c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  cmd = parsepipe(ps, es);
+     850:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     854:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     858:	48 89 d6             	mov    %rdx,%rsi
+     85b:	48 89 c7             	mov    %rax,%rdi
+     85e:	e8 b5 00 00 00       	call   918 <parsepipe>
+     863:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(peek(ps, es, "&")){
+     867:	eb 2a                	jmp    893 <parseline+0x53>
+    gettoken(ps, es, 0, 0);
+     869:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     86d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     871:	b9 00 00 00 00       	mov    $0x0,%ecx
+     876:	ba 00 00 00 00       	mov    $0x0,%edx
+     87b:	48 89 c7             	mov    %rax,%rdi
+     87e:	e8 14 fd ff ff       	call   597 <gettoken>
+    cmd = backcmd(cmd);
+     883:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     887:	48 89 c7             	mov    %rax,%rdi
+     88a:	e8 bc fc ff ff       	call   54b <backcmd>
+     88f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(peek(ps, es, "&")){
+     893:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     897:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     89b:	48 c7 c2 b9 1d 00 00 	mov    $0x1db9,%rdx
+     8a2:	48 89 ce             	mov    %rcx,%rsi
+     8a5:	48 89 c7             	mov    %rax,%rdi
+     8a8:	e8 65 fe ff ff       	call   712 <peek>
+     8ad:	85 c0                	test   %eax,%eax
+     8af:	75 b8                	jne    869 <parseline+0x29>
+  }
+  if(peek(ps, es, ";")){
+     8b1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     8b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     8b9:	48 c7 c2 bb 1d 00 00 	mov    $0x1dbb,%rdx
+     8c0:	48 89 ce             	mov    %rcx,%rsi
+     8c3:	48 89 c7             	mov    %rax,%rdi
+     8c6:	e8 47 fe ff ff       	call   712 <peek>
+     8cb:	85 c0                	test   %eax,%eax
+     8cd:	74 43                	je     912 <parseline+0xd2>
+    gettoken(ps, es, 0, 0);
+     8cf:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     8d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     8d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+     8dc:	ba 00 00 00 00       	mov    $0x0,%edx
+     8e1:	48 89 c7             	mov    %rax,%rdi
+     8e4:	e8 ae fc ff ff       	call   597 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     8e9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     8ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     8f1:	48 89 d6             	mov    %rdx,%rsi
+     8f4:	48 89 c7             	mov    %rax,%rdi
+     8f7:	e8 44 ff ff ff       	call   840 <parseline>
+     8fc:	48 89 c2             	mov    %rax,%rdx
+     8ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     903:	48 89 d6             	mov    %rdx,%rsi
+     906:	48 89 c7             	mov    %rax,%rdi
+     909:	e8 e1 fb ff ff       	call   4ef <listcmd>
+     90e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+  return cmd;
+     912:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     916:	c9                   	leave
+     917:	c3                   	ret
+
+0000000000000918 <parsepipe>:
+
+struct cmd*
+parsepipe(char **ps, char *es)
+{
+     918:	55                   	push   %rbp
+     919:	48 89 e5             	mov    %rsp,%rbp
+     91c:	48 83 ec 20          	sub    $0x20,%rsp
+     920:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     924:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  cmd = parseexec(ps, es);
+     928:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     92c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     930:	48 89 d6             	mov    %rdx,%rsi
+     933:	48 89 c7             	mov    %rax,%rdi
+     936:	e8 48 02 00 00       	call   b83 <parseexec>
+     93b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(peek(ps, es, "|")){
+     93f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     943:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     947:	48 c7 c2 bd 1d 00 00 	mov    $0x1dbd,%rdx
+     94e:	48 89 ce             	mov    %rcx,%rsi
+     951:	48 89 c7             	mov    %rax,%rdi
+     954:	e8 b9 fd ff ff       	call   712 <peek>
+     959:	85 c0                	test   %eax,%eax
+     95b:	74 43                	je     9a0 <parsepipe+0x88>
+    gettoken(ps, es, 0, 0);
+     95d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     961:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     965:	b9 00 00 00 00       	mov    $0x0,%ecx
+     96a:	ba 00 00 00 00       	mov    $0x0,%edx
+     96f:	48 89 c7             	mov    %rax,%rdi
+     972:	e8 20 fc ff ff       	call   597 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     977:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     97b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     97f:	48 89 d6             	mov    %rdx,%rsi
+     982:	48 89 c7             	mov    %rax,%rdi
+     985:	e8 8e ff ff ff       	call   918 <parsepipe>
+     98a:	48 89 c2             	mov    %rax,%rdx
+     98d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     991:	48 89 d6             	mov    %rdx,%rsi
+     994:	48 89 c7             	mov    %rax,%rdi
+     997:	e8 f7 fa ff ff       	call   493 <pipecmd>
+     99c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+  return cmd;
+     9a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     9a4:	c9                   	leave
+     9a5:	c3                   	ret
+
+00000000000009a6 <parseredirs>:
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     9a6:	55                   	push   %rbp
+     9a7:	48 89 e5             	mov    %rsp,%rbp
+     9aa:	48 83 ec 40          	sub    $0x40,%rsp
+     9ae:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+     9b2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     9b6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     9ba:	e9 cc 00 00 00       	jmp    a8b <parseredirs+0xe5>
+    tok = gettoken(ps, es, 0, 0);
+     9bf:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+     9c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     9c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+     9cc:	ba 00 00 00 00       	mov    $0x0,%edx
+     9d1:	48 89 c7             	mov    %rax,%rdi
+     9d4:	e8 be fb ff ff       	call   597 <gettoken>
+     9d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     9dc:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     9e0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+     9e4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+     9e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     9ec:	48 89 c7             	mov    %rax,%rdi
+     9ef:	e8 a3 fb ff ff       	call   597 <gettoken>
+     9f4:	83 f8 61             	cmp    $0x61,%eax
+     9f7:	74 0c                	je     a05 <parseredirs+0x5f>
+      panic("missing file for redirection");
+     9f9:	48 c7 c7 bf 1d 00 00 	mov    $0x1dbf,%rdi
+     a00:	e8 76 f9 ff ff       	call   37b <panic>
+    switch(tok){
+     a05:	83 7d fc 3e          	cmpl   $0x3e,-0x4(%rbp)
+     a09:	74 37                	je     a42 <parseredirs+0x9c>
+     a0b:	83 7d fc 3e          	cmpl   $0x3e,-0x4(%rbp)
+     a0f:	7f 7a                	jg     a8b <parseredirs+0xe5>
+     a11:	83 7d fc 2b          	cmpl   $0x2b,-0x4(%rbp)
+     a15:	74 50                	je     a67 <parseredirs+0xc1>
+     a17:	83 7d fc 3c          	cmpl   $0x3c,-0x4(%rbp)
+     a1b:	75 6e                	jne    a8b <parseredirs+0xe5>
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     a1d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a21:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     a25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     a29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     a2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a34:	48 89 c7             	mov    %rax,%rdi
+     a37:	e8 d0 f9 ff ff       	call   40c <redircmd>
+     a3c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     a40:	eb 49                	jmp    a8b <parseredirs+0xe5>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     a42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a46:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     a4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     a4e:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+     a54:	b9 01 02 00 00       	mov    $0x201,%ecx
+     a59:	48 89 c7             	mov    %rax,%rdi
+     a5c:	e8 ab f9 ff ff       	call   40c <redircmd>
+     a61:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     a65:	eb 24                	jmp    a8b <parseredirs+0xe5>
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     a67:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a6b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     a6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     a73:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+     a79:	b9 01 02 00 00       	mov    $0x201,%ecx
+     a7e:	48 89 c7             	mov    %rax,%rdi
+     a81:	e8 86 f9 ff ff       	call   40c <redircmd>
+     a86:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     a8a:	90                   	nop
+  while(peek(ps, es, "<>")){
+     a8b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     a8f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     a93:	48 c7 c2 dc 1d 00 00 	mov    $0x1ddc,%rdx
+     a9a:	48 89 ce             	mov    %rcx,%rsi
+     a9d:	48 89 c7             	mov    %rax,%rdi
+     aa0:	e8 6d fc ff ff       	call   712 <peek>
+     aa5:	85 c0                	test   %eax,%eax
+     aa7:	0f 85 12 ff ff ff    	jne    9bf <parseredirs+0x19>
+    }
+  }
+  return cmd;
+     aad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+     ab1:	c9                   	leave
+     ab2:	c3                   	ret
+
+0000000000000ab3 <parseblock>:
+
+struct cmd*
+parseblock(char **ps, char *es)
+{
+     ab3:	55                   	push   %rbp
+     ab4:	48 89 e5             	mov    %rsp,%rbp
+     ab7:	48 83 ec 20          	sub    $0x20,%rsp
+     abb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     abf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  if(!peek(ps, es, "("))
+     ac3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     ac7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     acb:	48 c7 c2 df 1d 00 00 	mov    $0x1ddf,%rdx
+     ad2:	48 89 ce             	mov    %rcx,%rsi
+     ad5:	48 89 c7             	mov    %rax,%rdi
+     ad8:	e8 35 fc ff ff       	call   712 <peek>
+     add:	85 c0                	test   %eax,%eax
+     adf:	75 0c                	jne    aed <parseblock+0x3a>
+    panic("parseblock");
+     ae1:	48 c7 c7 e1 1d 00 00 	mov    $0x1de1,%rdi
+     ae8:	e8 8e f8 ff ff       	call   37b <panic>
+  gettoken(ps, es, 0, 0);
+     aed:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     af1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     af5:	b9 00 00 00 00       	mov    $0x0,%ecx
+     afa:	ba 00 00 00 00       	mov    $0x0,%edx
+     aff:	48 89 c7             	mov    %rax,%rdi
+     b02:	e8 90 fa ff ff       	call   597 <gettoken>
+  cmd = parseline(ps, es);
+     b07:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b0f:	48 89 d6             	mov    %rdx,%rsi
+     b12:	48 89 c7             	mov    %rax,%rdi
+     b15:	e8 26 fd ff ff       	call   840 <parseline>
+     b1a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(!peek(ps, es, ")"))
+     b1e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     b22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b26:	48 c7 c2 ec 1d 00 00 	mov    $0x1dec,%rdx
+     b2d:	48 89 ce             	mov    %rcx,%rsi
+     b30:	48 89 c7             	mov    %rax,%rdi
+     b33:	e8 da fb ff ff       	call   712 <peek>
+     b38:	85 c0                	test   %eax,%eax
+     b3a:	75 0c                	jne    b48 <parseblock+0x95>
+    panic("syntax - missing )");
+     b3c:	48 c7 c7 ee 1d 00 00 	mov    $0x1dee,%rdi
+     b43:	e8 33 f8 ff ff       	call   37b <panic>
+  gettoken(ps, es, 0, 0);
+     b48:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b50:	b9 00 00 00 00       	mov    $0x0,%ecx
+     b55:	ba 00 00 00 00       	mov    $0x0,%edx
+     b5a:	48 89 c7             	mov    %rax,%rdi
+     b5d:	e8 35 fa ff ff       	call   597 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     b62:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b66:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     b6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b6e:	48 89 ce             	mov    %rcx,%rsi
+     b71:	48 89 c7             	mov    %rax,%rdi
+     b74:	e8 2d fe ff ff       	call   9a6 <parseredirs>
+     b79:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  return cmd;
+     b7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b81:	c9                   	leave
+     b82:	c3                   	ret
+
+0000000000000b83 <parseexec>:
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     b83:	55                   	push   %rbp
+     b84:	48 89 e5             	mov    %rsp,%rbp
+     b87:	48 83 ec 40          	sub    $0x40,%rsp
+     b8b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+     b8f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+  
+  if(peek(ps, es, "("))
+     b93:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     b97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b9b:	48 c7 c2 df 1d 00 00 	mov    $0x1ddf,%rdx
+     ba2:	48 89 ce             	mov    %rcx,%rsi
+     ba5:	48 89 c7             	mov    %rax,%rdi
+     ba8:	e8 65 fb ff ff       	call   712 <peek>
+     bad:	85 c0                	test   %eax,%eax
+     baf:	74 18                	je     bc9 <parseexec+0x46>
+    return parseblock(ps, es);
+     bb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     bb5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     bb9:	48 89 d6             	mov    %rdx,%rsi
+     bbc:	48 89 c7             	mov    %rax,%rdi
+     bbf:	e8 ef fe ff ff       	call   ab3 <parseblock>
+     bc4:	e9 1d 01 00 00       	jmp    ce6 <parseexec+0x163>
+
+  ret = execcmd();
+     bc9:	e8 02 f8 ff ff       	call   3d0 <execcmd>
+     bce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  cmd = (struct execcmd*)ret;
+     bd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bd6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+  argc = 0;
+     bda:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  ret = parseredirs(ret, ps, es);
+     be1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     be5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     be9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bed:	48 89 ce             	mov    %rcx,%rsi
+     bf0:	48 89 c7             	mov    %rax,%rdi
+     bf3:	e8 ae fd ff ff       	call   9a6 <parseredirs>
+     bf8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(!peek(ps, es, "|)&;")){
+     bfc:	e9 92 00 00 00       	jmp    c93 <parseexec+0x110>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     c01:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+     c05:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+     c09:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+     c0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c11:	48 89 c7             	mov    %rax,%rdi
+     c14:	e8 7e f9 ff ff       	call   597 <gettoken>
+     c19:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+     c1c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     c20:	0f 84 91 00 00 00    	je     cb7 <parseexec+0x134>
+      break;
+    if(tok != 'a')
+     c26:	83 7d e4 61          	cmpl   $0x61,-0x1c(%rbp)
+     c2a:	74 0c                	je     c38 <parseexec+0xb5>
+      panic("syntax");
+     c2c:	48 c7 c7 b2 1d 00 00 	mov    $0x1db2,%rdi
+     c33:	e8 43 f7 ff ff       	call   37b <panic>
+    cmd->argv[argc] = q;
+     c38:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     c3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c40:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     c43:	48 63 d2             	movslq %edx,%rdx
+     c46:	48 89 4c d0 08       	mov    %rcx,0x8(%rax,%rdx,8)
+    cmd->eargv[argc] = eq;
+     c4b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+     c4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c53:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     c56:	48 63 c9             	movslq %ecx,%rcx
+     c59:	48 83 c1 0a          	add    $0xa,%rcx
+     c5d:	48 89 54 c8 08       	mov    %rdx,0x8(%rax,%rcx,8)
+    argc++;
+     c62:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    if(argc >= MAXARGS)
+     c66:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     c6a:	7e 0c                	jle    c78 <parseexec+0xf5>
+      panic("too many args");
+     c6c:	48 c7 c7 01 1e 00 00 	mov    $0x1e01,%rdi
+     c73:	e8 03 f7 ff ff       	call   37b <panic>
+    ret = parseredirs(ret, ps, es);
+     c78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     c7c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     c80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c84:	48 89 ce             	mov    %rcx,%rsi
+     c87:	48 89 c7             	mov    %rax,%rdi
+     c8a:	e8 17 fd ff ff       	call   9a6 <parseredirs>
+     c8f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(!peek(ps, es, "|)&;")){
+     c93:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     c97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c9b:	48 c7 c2 0f 1e 00 00 	mov    $0x1e0f,%rdx
+     ca2:	48 89 ce             	mov    %rcx,%rsi
+     ca5:	48 89 c7             	mov    %rax,%rdi
+     ca8:	e8 65 fa ff ff       	call   712 <peek>
+     cad:	85 c0                	test   %eax,%eax
+     caf:	0f 84 4c ff ff ff    	je     c01 <parseexec+0x7e>
+     cb5:	eb 01                	jmp    cb8 <parseexec+0x135>
+      break;
+     cb7:	90                   	nop
+  }
+  cmd->argv[argc] = 0;
+     cb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cbc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     cbf:	48 63 d2             	movslq %edx,%rdx
+     cc2:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+     cc9:	00 00 
+  cmd->eargv[argc] = 0;
+     ccb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ccf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     cd2:	48 63 d2             	movslq %edx,%rdx
+     cd5:	48 83 c2 0a          	add    $0xa,%rdx
+     cd9:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+     ce0:	00 00 
+  return ret;
+     ce2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+     ce6:	c9                   	leave
+     ce7:	c3                   	ret
+
+0000000000000ce8 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     ce8:	55                   	push   %rbp
+     ce9:	48 89 e5             	mov    %rsp,%rbp
+     cec:	48 83 ec 40          	sub    $0x40,%rsp
+     cf0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     cf4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     cf9:	75 0a                	jne    d05 <nulterminate+0x1d>
+    return 0;
+     cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+     d00:	e9 f5 00 00 00       	jmp    dfa <nulterminate+0x112>
+  
+  switch(cmd->type){
+     d05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d09:	8b 00                	mov    (%rax),%eax
+     d0b:	83 f8 05             	cmp    $0x5,%eax
+     d0e:	0f 87 e2 00 00 00    	ja     df6 <nulterminate+0x10e>
+     d14:	89 c0                	mov    %eax,%eax
+     d16:	48 8b 04 c5 18 1e 00 	mov    0x1e18(,%rax,8),%rax
+     d1d:	00 
+     d1e:	ff e0                	jmp    *%rax
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+     d20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d24:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    for(i=0; ecmd->argv[i]; i++)
+     d28:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d2f:	eb 1a                	jmp    d4b <nulterminate+0x63>
+      *ecmd->eargv[i] = 0;
+     d31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     d35:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     d38:	48 63 d2             	movslq %edx,%rdx
+     d3b:	48 83 c2 0a          	add    $0xa,%rdx
+     d3f:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     d44:	c6 00 00             	movb   $0x0,(%rax)
+    for(i=0; ecmd->argv[i]; i++)
+     d47:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     d4f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     d52:	48 63 d2             	movslq %edx,%rdx
+     d55:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     d5a:	48 85 c0             	test   %rax,%rax
+     d5d:	75 d2                	jne    d31 <nulterminate+0x49>
+    break;
+     d5f:	e9 92 00 00 00       	jmp    df6 <nulterminate+0x10e>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+     d64:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d68:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    nulterminate(rcmd->cmd);
+     d6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     d70:	48 8b 40 08          	mov    0x8(%rax),%rax
+     d74:	48 89 c7             	mov    %rax,%rdi
+     d77:	e8 6c ff ff ff       	call   ce8 <nulterminate>
+    *rcmd->efile = 0;
+     d7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     d80:	48 8b 40 18          	mov    0x18(%rax),%rax
+     d84:	c6 00 00             	movb   $0x0,(%rax)
+    break;
+     d87:	eb 6d                	jmp    df6 <nulterminate+0x10e>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     d89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d8d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    nulterminate(pcmd->left);
+     d91:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     d95:	48 8b 40 08          	mov    0x8(%rax),%rax
+     d99:	48 89 c7             	mov    %rax,%rdi
+     d9c:	e8 47 ff ff ff       	call   ce8 <nulterminate>
+    nulterminate(pcmd->right);
+     da1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     da5:	48 8b 40 10          	mov    0x10(%rax),%rax
+     da9:	48 89 c7             	mov    %rax,%rdi
+     dac:	e8 37 ff ff ff       	call   ce8 <nulterminate>
+    break;
+     db1:	eb 43                	jmp    df6 <nulterminate+0x10e>
+    
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+     db3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     db7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    nulterminate(lcmd->left);
+     dbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dbf:	48 8b 40 08          	mov    0x8(%rax),%rax
+     dc3:	48 89 c7             	mov    %rax,%rdi
+     dc6:	e8 1d ff ff ff       	call   ce8 <nulterminate>
+    nulterminate(lcmd->right);
+     dcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dcf:	48 8b 40 10          	mov    0x10(%rax),%rax
+     dd3:	48 89 c7             	mov    %rax,%rdi
+     dd6:	e8 0d ff ff ff       	call   ce8 <nulterminate>
+    break;
+     ddb:	eb 19                	jmp    df6 <nulterminate+0x10e>
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     ddd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     de1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nulterminate(bcmd->cmd);
+     de5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     de9:	48 8b 40 08          	mov    0x8(%rax),%rax
+     ded:	48 89 c7             	mov    %rax,%rdi
+     df0:	e8 f3 fe ff ff       	call   ce8 <nulterminate>
+    break;
+     df5:	90                   	nop
+  }
+  return cmd;
+     df6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+     dfa:	c9                   	leave
+     dfb:	c3                   	ret
+
+0000000000000dfc <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     dfc:	55                   	push   %rbp
+     dfd:	48 89 e5             	mov    %rsp,%rbp
+     e00:	48 83 ec 10          	sub    $0x10,%rsp
+     e04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e08:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     e0b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     e0e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     e12:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     e15:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e18:	48 89 ce             	mov    %rcx,%rsi
+     e1b:	48 89 f7             	mov    %rsi,%rdi
+     e1e:	89 d1                	mov    %edx,%ecx
+     e20:	fc                   	cld
+     e21:	f3 aa                	rep stos %al,%es:(%rdi)
+     e23:	89 ca                	mov    %ecx,%edx
+     e25:	48 89 fe             	mov    %rdi,%rsi
+     e28:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     e2c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     e2f:	90                   	nop
+     e30:	c9                   	leave
+     e31:	c3                   	ret
+
+0000000000000e32 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     e32:	55                   	push   %rbp
+     e33:	48 89 e5             	mov    %rsp,%rbp
+     e36:	48 83 ec 20          	sub    $0x20,%rsp
+     e3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e3e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     e42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     e4a:	90                   	nop
+     e4b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     e4f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     e53:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     e57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e5b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     e5f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     e63:	0f b6 12             	movzbl (%rdx),%edx
+     e66:	88 10                	mov    %dl,(%rax)
+     e68:	0f b6 00             	movzbl (%rax),%eax
+     e6b:	84 c0                	test   %al,%al
+     e6d:	75 dc                	jne    e4b <strcpy+0x19>
+    ;
+  return os;
+     e6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     e73:	c9                   	leave
+     e74:	c3                   	ret
+
+0000000000000e75 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     e75:	55                   	push   %rbp
+     e76:	48 89 e5             	mov    %rsp,%rbp
+     e79:	48 83 ec 10          	sub    $0x10,%rsp
+     e7d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e81:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     e85:	eb 0a                	jmp    e91 <strcmp+0x1c>
+    p++, q++;
+     e87:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     e8c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     e91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e95:	0f b6 00             	movzbl (%rax),%eax
+     e98:	84 c0                	test   %al,%al
+     e9a:	74 12                	je     eae <strcmp+0x39>
+     e9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ea0:	0f b6 10             	movzbl (%rax),%edx
+     ea3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ea7:	0f b6 00             	movzbl (%rax),%eax
+     eaa:	38 c2                	cmp    %al,%dl
+     eac:	74 d9                	je     e87 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     eae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eb2:	0f b6 00             	movzbl (%rax),%eax
+     eb5:	0f b6 d0             	movzbl %al,%edx
+     eb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ebc:	0f b6 00             	movzbl (%rax),%eax
+     ebf:	0f b6 c0             	movzbl %al,%eax
+     ec2:	29 c2                	sub    %eax,%edx
+     ec4:	89 d0                	mov    %edx,%eax
+}
+     ec6:	c9                   	leave
+     ec7:	c3                   	ret
+
+0000000000000ec8 <strlen>:
+
+uint
+strlen(char *s)
+{
+     ec8:	55                   	push   %rbp
+     ec9:	48 89 e5             	mov    %rsp,%rbp
+     ecc:	48 83 ec 18          	sub    $0x18,%rsp
+     ed0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     ed4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     edb:	eb 04                	jmp    ee1 <strlen+0x19>
+     edd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ee1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ee4:	48 63 d0             	movslq %eax,%rdx
+     ee7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     eeb:	48 01 d0             	add    %rdx,%rax
+     eee:	0f b6 00             	movzbl (%rax),%eax
+     ef1:	84 c0                	test   %al,%al
+     ef3:	75 e8                	jne    edd <strlen+0x15>
+    ;
+  return n;
+     ef5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     ef8:	c9                   	leave
+     ef9:	c3                   	ret
+
+0000000000000efa <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     efa:	55                   	push   %rbp
+     efb:	48 89 e5             	mov    %rsp,%rbp
+     efe:	48 83 ec 10          	sub    $0x10,%rsp
+     f02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f06:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     f09:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     f0c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     f0f:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     f12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f16:	89 ce                	mov    %ecx,%esi
+     f18:	48 89 c7             	mov    %rax,%rdi
+     f1b:	e8 dc fe ff ff       	call   dfc <stosb>
+  return dst;
+     f20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     f24:	c9                   	leave
+     f25:	c3                   	ret
+
+0000000000000f26 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     f26:	55                   	push   %rbp
+     f27:	48 89 e5             	mov    %rsp,%rbp
+     f2a:	48 83 ec 10          	sub    $0x10,%rsp
+     f2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f32:	89 f0                	mov    %esi,%eax
+     f34:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     f37:	eb 17                	jmp    f50 <strchr+0x2a>
+    if(*s == c)
+     f39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f3d:	0f b6 00             	movzbl (%rax),%eax
+     f40:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     f43:	75 06                	jne    f4b <strchr+0x25>
+      return (char*)s;
+     f45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f49:	eb 15                	jmp    f60 <strchr+0x3a>
+  for(; *s; s++)
+     f4b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     f50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f54:	0f b6 00             	movzbl (%rax),%eax
+     f57:	84 c0                	test   %al,%al
+     f59:	75 de                	jne    f39 <strchr+0x13>
+  return 0;
+     f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f60:	c9                   	leave
+     f61:	c3                   	ret
+
+0000000000000f62 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     f62:	55                   	push   %rbp
+     f63:	48 89 e5             	mov    %rsp,%rbp
+     f66:	48 83 ec 20          	sub    $0x20,%rsp
+     f6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     f6e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     f71:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     f78:	eb 48                	jmp    fc2 <gets+0x60>
+    cc = read(0, &c, 1);
+     f7a:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     f7e:	ba 01 00 00 00       	mov    $0x1,%edx
+     f83:	48 89 c6             	mov    %rax,%rsi
+     f86:	bf 00 00 00 00       	mov    $0x0,%edi
+     f8b:	e8 7f 01 00 00       	call   110f <read>
+     f90:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     f93:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     f97:	7e 36                	jle    fcf <gets+0x6d>
+      break;
+    buf[i++] = c;
+     f99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f9c:	8d 50 01             	lea    0x1(%rax),%edx
+     f9f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     fa2:	48 63 d0             	movslq %eax,%rdx
+     fa5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fa9:	48 01 c2             	add    %rax,%rdx
+     fac:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     fb0:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     fb2:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     fb6:	3c 0a                	cmp    $0xa,%al
+     fb8:	74 16                	je     fd0 <gets+0x6e>
+     fba:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     fbe:	3c 0d                	cmp    $0xd,%al
+     fc0:	74 0e                	je     fd0 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     fc2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fc5:	83 c0 01             	add    $0x1,%eax
+     fc8:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     fcb:	7f ad                	jg     f7a <gets+0x18>
+     fcd:	eb 01                	jmp    fd0 <gets+0x6e>
+      break;
+     fcf:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     fd0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fd3:	48 63 d0             	movslq %eax,%rdx
+     fd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fda:	48 01 d0             	add    %rdx,%rax
+     fdd:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     fe0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     fe4:	c9                   	leave
+     fe5:	c3                   	ret
+
+0000000000000fe6 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     fe6:	55                   	push   %rbp
+     fe7:	48 89 e5             	mov    %rsp,%rbp
+     fea:	48 83 ec 20          	sub    $0x20,%rsp
+     fee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ff2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     ff6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ffa:	be 00 00 00 00       	mov    $0x0,%esi
+     fff:	48 89 c7             	mov    %rax,%rdi
+    1002:	e8 3a 01 00 00       	call   1141 <open>
+    1007:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    100a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    100e:	79 07                	jns    1017 <stat+0x31>
+    return -1;
+    1010:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1015:	eb 21                	jmp    1038 <stat+0x52>
+  r = fstat(fd, st);
+    1017:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    101b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    101e:	48 89 d6             	mov    %rdx,%rsi
+    1021:	89 c7                	mov    %eax,%edi
+    1023:	e8 37 01 00 00       	call   115f <fstat>
+    1028:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    102b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    102e:	89 c7                	mov    %eax,%edi
+    1030:	e8 ee 00 00 00       	call   1123 <close>
+  return r;
+    1035:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1038:	c9                   	leave
+    1039:	c3                   	ret
+
+000000000000103a <atoi>:
+
+int
+atoi(const char *s)
+{
+    103a:	55                   	push   %rbp
+    103b:	48 89 e5             	mov    %rsp,%rbp
+    103e:	48 83 ec 18          	sub    $0x18,%rsp
+    1042:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1046:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    104d:	eb 28                	jmp    1077 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+    104f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1052:	89 d0                	mov    %edx,%eax
+    1054:	c1 e0 02             	shl    $0x2,%eax
+    1057:	01 d0                	add    %edx,%eax
+    1059:	01 c0                	add    %eax,%eax
+    105b:	89 c1                	mov    %eax,%ecx
+    105d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1061:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1065:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1069:	0f b6 00             	movzbl (%rax),%eax
+    106c:	0f be c0             	movsbl %al,%eax
+    106f:	01 c8                	add    %ecx,%eax
+    1071:	83 e8 30             	sub    $0x30,%eax
+    1074:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1077:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    107b:	0f b6 00             	movzbl (%rax),%eax
+    107e:	3c 2f                	cmp    $0x2f,%al
+    1080:	7e 0b                	jle    108d <atoi+0x53>
+    1082:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1086:	0f b6 00             	movzbl (%rax),%eax
+    1089:	3c 39                	cmp    $0x39,%al
+    108b:	7e c2                	jle    104f <atoi+0x15>
+  return n;
+    108d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1090:	c9                   	leave
+    1091:	c3                   	ret
+
+0000000000001092 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1092:	55                   	push   %rbp
+    1093:	48 89 e5             	mov    %rsp,%rbp
+    1096:	48 83 ec 28          	sub    $0x28,%rsp
+    109a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    109e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    10a2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+    10a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    10ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    10b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    10b5:	eb 1d                	jmp    10d4 <memmove+0x42>
+    *dst++ = *src++;
+    10b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    10bb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    10bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    10c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10c7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    10cb:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    10cf:	0f b6 12             	movzbl (%rdx),%edx
+    10d2:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    10d4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    10d7:	8d 50 ff             	lea    -0x1(%rax),%edx
+    10da:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    10dd:	85 c0                	test   %eax,%eax
+    10df:	7f d6                	jg     10b7 <memmove+0x25>
+  return vdst;
+    10e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    10e5:	c9                   	leave
+    10e6:	c3                   	ret
+
+00000000000010e7 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+    10e7:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+    10ee:	cd 40                	int    $0x40
+    10f0:	c3                   	ret
+
+00000000000010f1 <exit>:
+SYSCALL_FAST(exit)
+    10f1:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+    10f8:	0f 05                	syscall
+    10fa:	c3                   	ret
+
+00000000000010fb <wait>:
+SYSCALL_FAST(wait)
+    10fb:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+    1102:	0f 05                	syscall
+    1104:	c3                   	ret
+
+0000000000001105 <pipe>:
+SYSCALL_FAST(pipe)
+    1105:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+    110c:	0f 05                	syscall
+    110e:	c3                   	ret
+
+000000000000110f <read>:
+SYSCALL_FAST(read)
+    110f:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+    1116:	0f 05                	syscall
+    1118:	c3                   	ret
+
+0000000000001119 <write>:
+SYSCALL_FAST(write)
+    1119:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+    1120:	0f 05                	syscall
+    1122:	c3                   	ret
+
+0000000000001123 <close>:
+SYSCALL_FAST(close)
+    1123:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+    112a:	0f 05                	syscall
+    112c:	c3                   	ret
+
+000000000000112d <kill>:
+SYSCALL_FAST(kill)
+    112d:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+    1134:	0f 05                	syscall
+    1136:	c3                   	ret
+
+0000000000001137 <exec>:
+SYSCALL(exec)
+    1137:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+    113e:	cd 40                	int    $0x40
+    1140:	c3                   	ret
+
+0000000000001141 <open>:
+SYSCALL_FAST(open)
+    1141:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+    1148:	0f 05                	syscall
+    114a:	c3                   	ret
+
+000000000000114b <mknod>:
+SYSCALL_FAST(mknod)
+    114b:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+    1152:	0f 05                	syscall
+    1154:	c3                   	ret
+
+0000000000001155 <unlink>:
+SYSCALL_FAST(unlink)
+    1155:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+    115c:	0f 05                	syscall
+    115e:	c3                   	ret
+
+000000000000115f <fstat>:
+SYSCALL_FAST(fstat)
+    115f:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+    1166:	0f 05                	syscall
+    1168:	c3                   	ret
+
+0000000000001169 <link>:
+SYSCALL_FAST(link)
+    1169:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+    1170:	0f 05                	syscall
+    1172:	c3                   	ret
+
+0000000000001173 <mkdir>:
+SYSCALL_FAST(mkdir)
+    1173:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+    117a:	0f 05                	syscall
+    117c:	c3                   	ret
+
+000000000000117d <chdir>:
+SYSCALL_FAST(chdir)
+    117d:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+    1184:	0f 05                	syscall
+    1186:	c3                   	ret
+
+0000000000001187 <dup>:
+SYSCALL_FAST(dup)
+    1187:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+    118e:	0f 05                	syscall
+    1190:	c3                   	ret
+
+0000000000001191 <sbrk>:
+SYSCALL_FAST(sbrk)
+    1191:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+    1198:	0f 05                	syscall
+    119a:	c3                   	ret
+
+000000000000119b <sleep>:
+SYSCALL_FAST(sleep)
+    119b:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+    11a2:	0f 05                	syscall
+    11a4:	c3                   	ret
+
+00000000000011a5 <send>:
+SYSCALL_FAST(send)
+    11a5:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+    11ac:	0f 05                	syscall
+    11ae:	c3                   	ret
+
+00000000000011af <send_recv>:
+SYSCALL_FAST(send_recv)
+    11af:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+    11b6:	0f 05                	syscall
+    11b8:	c3                   	ret
+
+00000000000011b9 <recv>:
+SYSCALL_FAST(recv)
+    11b9:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+    11c0:	0f 05                	syscall
+    11c2:	c3                   	ret
+
+00000000000011c3 <call>:
+SYSCALL_FAST(call)
+    11c3:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+    11ca:	0f 05                	syscall
+    11cc:	c3                   	ret
+
+00000000000011cd <reply_recv>:
+SYSCALL_FAST(reply_recv)
+    11cd:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+    11d4:	0f 05                	syscall
+    11d6:	c3                   	ret
+
+00000000000011d7 <send_reg>:
+SYSCALL_REG(send_reg)
+    11d7:	41 54                	push   %r12
+    11d9:	41 55                	push   %r13
+    11db:	41 56                	push   %r14
+    11dd:	41 57                	push   %r15
+    11df:	56                   	push   %rsi
+    11e0:	49 89 f3             	mov    %rsi,%r11
+    11e3:	48 89 d6             	mov    %rdx,%rsi
+    11e6:	49 8b 13             	mov    (%r11),%rdx
+    11e9:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    11ed:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    11f1:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    11f5:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    11f9:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    11fd:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1201:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1205:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+    120c:	0f 05                	syscall
+    120e:	41 5b                	pop    %r11
+    1210:	49 89 13             	mov    %rdx,(%r11)
+    1213:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    1217:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    121b:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    121f:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    1223:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    1227:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    122b:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    122f:	41 5f                	pop    %r15
+    1231:	41 5e                	pop    %r14
+    1233:	41 5d                	pop    %r13
+    1235:	41 5c                	pop    %r12
+    1237:	c3                   	ret
+
+0000000000001238 <recv_reg>:
+SYSCALL_REG(recv_reg)
+    1238:	41 54                	push   %r12
+    123a:	41 55                	push   %r13
+    123c:	41 56                	push   %r14
+    123e:	41 57                	push   %r15
+    1240:	56                   	push   %rsi
+    1241:	49 89 f3             	mov    %rsi,%r11
+    1244:	48 89 d6             	mov    %rdx,%rsi
+    1247:	49 8b 13             	mov    (%r11),%rdx
+    124a:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    124e:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    1252:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    1256:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    125a:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    125e:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1262:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1266:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+    126d:	0f 05                	syscall
+    126f:	41 5b                	pop    %r11
+    1271:	49 89 13             	mov    %rdx,(%r11)
+    1274:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    1278:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    127c:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    1280:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    1284:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    1288:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    128c:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    1290:	41 5f                	pop    %r15
+    1292:	41 5e                	pop    %r14
+    1294:	41 5d                	pop    %r13
+    1296:	41 5c                	pop    %r12
+    1298:	c3                   	ret
+
+0000000000001299 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+    1299:	41 54                	push   %r12
+    129b:	41 55                	push   %r13
+    129d:	41 56                	push   %r14
+    129f:	41 57                	push   %r15
+    12a1:	56                   	push   %rsi
+    12a2:	49 89 f3             	mov    %rsi,%r11
+    12a5:	48 89 d6             	mov    %rdx,%rsi
+    12a8:	49 8b 13             	mov    (%r11),%rdx
+    12ab:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    12af:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    12b3:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    12b7:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    12bb:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    12bf:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    12c3:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    12c7:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+    12ce:	0f 05                	syscall
+    12d0:	41 5b                	pop    %r11
+    12d2:	49 89 13             	mov    %rdx,(%r11)
+    12d5:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    12d9:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    12dd:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    12e1:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    12e5:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    12e9:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    12ed:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    12f1:	41 5f                	pop    %r15
+    12f3:	41 5e                	pop    %r14
+    12f5:	41 5d                	pop    %r13
+    12f7:	41 5c                	pop    %r12
+    12f9:	c3                   	ret
+
+00000000000012fa <call_reg>:
+SYSCALL_REG(call_reg)
+    12fa:	41 54                	push   %r12
+    12fc:	41 55                	push   %r13
+    12fe:	41 56                	push   %r14
+    1300:	41 57                	push   %r15
+    1302:	56                   	push   %rsi
+    1303:	49 89 f3             	mov    %rsi,%r11
+    1306:	48 89 d6             	mov    %rdx,%rsi
+    1309:	49 8b 13             	mov    (%r11),%rdx
+    130c:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    1310:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    1314:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    1318:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    131c:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    1320:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1324:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1328:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+    132f:	0f 05                	syscall
+    1331:	41 5b                	pop    %r11
+    1333:	49 89 13             	mov    %rdx,(%r11)
+    1336:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    133a:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    133e:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    1342:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    1346:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    134a:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    134e:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    1352:	41 5f                	pop    %r15
+    1354:	41 5e                	pop    %r14
+    1356:	41 5d                	pop    %r13
+    1358:	41 5c                	pop    %r12
+    135a:	c3                   	ret
+
+000000000000135b <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+    135b:	41 54                	push   %r12
+    135d:	41 55                	push   %r13
+    135f:	41 56                	push   %r14
+    1361:	41 57                	push   %r15
+    1363:	56                   	push   %rsi
+    1364:	49 89 f3             	mov    %rsi,%r11
+    1367:	48 89 d6             	mov    %rdx,%rsi
+    136a:	49 8b 13             	mov    (%r11),%rdx
+    136d:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    1371:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    1375:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    1379:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    137d:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    1381:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1385:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1389:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+    1390:	0f 05                	syscall
+    1392:	41 5b                	pop    %r11
+    1394:	49 89 13             	mov    %rdx,(%r11)
+    1397:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    139b:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    139f:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    13a3:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    13a7:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    13ab:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    13af:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    13b3:	41 5f                	pop    %r15
+    13b5:	41 5e                	pop    %r14
+    13b7:	41 5d                	pop    %r13
+    13b9:	41 5c                	pop    %r12
+    13bb:	c3                   	ret
+
+00000000000013bc <sendx>:
+SYSCALL_FAST(sendx)
+    13bc:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+    13c3:	0f 05                	syscall
+    13c5:	c3                   	ret
+
+00000000000013c6 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+    13c6:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+    13cd:	0f 05                	syscall
+    13cf:	c3                   	ret
+
+00000000000013d0 <notify>:
+SYSCALL_FAST(notify)
+    13d0:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+    13d7:	0f 05                	syscall
+    13d9:	c3                   	ret
+
+00000000000013da <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+    13da:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+    13e1:	0f 05                	syscall
+    13e3:	c3                   	ret
+
+00000000000013e4 <send_timed>:
+SYSCALL_FAST(send_timed)
+    13e4:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+    13eb:	0f 05                	syscall
+    13ed:	c3                   	ret
+
+00000000000013ee <recv_timed>:
+SYSCALL_FAST(recv_timed)
+    13ee:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+    13f5:	0f 05                	syscall
+    13f7:	c3                   	ret
+
+00000000000013f8 <set_add>:
+SYSCALL_FAST(set_add)
+    13f8:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+    13ff:	0f 05                	syscall
+    1401:	c3                   	ret
+
+0000000000001402 <set_del>:
+SYSCALL_FAST(set_del)
+    1402:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+    1409:	0f 05                	syscall
+    140b:	c3                   	ret
+
+000000000000140c <recv_any>:
+SYSCALL_FAST(recv_any)
+    140c:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+    1413:	0f 05                	syscall
+    1415:	c3                   	ret
+
+0000000000001416 <ep_create>:
+SYSCALL_FAST(ep_create)
+    1416:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+    141d:	0f 05                	syscall
+    141f:	c3                   	ret
+
+0000000000001420 <ep_close>:
+SYSCALL_FAST(ep_close)
+    1420:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+    1427:	0f 05                	syscall
+    1429:	c3                   	ret
+
+000000000000142a <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+    142a:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+    1431:	0f 05                	syscall
+    1433:	c3                   	ret
+
+0000000000001434 <setprio>:
+SYSCALL_FAST(setprio)
+    1434:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+    143b:	0f 05                	syscall
+    143d:	c3                   	ret
+
+000000000000143e <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+    143e:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+    1445:	0f 05                	syscall
+    1447:	c3                   	ret
+
+0000000000001448 <sethuge>:
+SYSCALL_FAST(sethuge)
+    1448:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+    144f:	0f 05                	syscall
+    1451:	c3                   	ret
+
+0000000000001452 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+    1452:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+    1459:	0f 05                	syscall
+    145b:	c3                   	ret
+
+000000000000145c <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+    145c:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+    1463:	0f 05                	syscall
+    1465:	c3                   	ret
+
+0000000000001466 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+    1466:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+    146d:	0f 05                	syscall
+    146f:	c3                   	ret
+
+0000000000001470 <null_call>:
+    1470:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+    1477:	0f 05                	syscall
+    1479:	c3                   	ret
+
+000000000000147a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    147a:	55                   	push   %rbp
+    147b:	48 89 e5             	mov    %rsp,%rbp
+    147e:	48 83 ec 10          	sub    $0x10,%rsp
+    1482:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1485:	89 f0                	mov    %esi,%eax
+    1487:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    148a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    148e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1491:	ba 01 00 00 00       	mov    $0x1,%edx
+    1496:	48 89 ce             	mov    %rcx,%rsi
+    1499:	89 c7                	mov    %eax,%edi
+    149b:	e8 79 fc ff ff       	call   1119 <write>
+}
+    14a0:	90                   	nop
+    14a1:	c9                   	leave
+    14a2:	c3                   	ret
+
+00000000000014a3 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    14a3:	55                   	push   %rbp
+    14a4:	48 89 e5             	mov    %rsp,%rbp
+    14a7:	48 83 ec 30          	sub    $0x30,%rsp
+    14ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    14ae:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    14b1:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    14b4:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    14b7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    14be:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    14c2:	74 17                	je     14db <printint+0x38>
+    14c4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    14c8:	79 11                	jns    14db <printint+0x38>
+    neg = 1;
+    14ca:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    14d1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    14d4:	f7 d8                	neg    %eax
+    14d6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    14d9:	eb 06                	jmp    14e1 <printint+0x3e>
+  } else {
+    x = xx;
+    14db:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    14de:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    14e1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    14e8:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    14eb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    14ee:	ba 00 00 00 00       	mov    $0x0,%edx
+    14f3:	f7 f1                	div    %ecx
+    14f5:	89 d1                	mov    %edx,%ecx
+    14f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14fa:	8d 50 01             	lea    0x1(%rax),%edx
+    14fd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1500:	89 ca                	mov    %ecx,%edx
+    1502:	0f b6 92 80 23 00 00 	movzbl 0x2380(%rdx),%edx
+    1509:	48 98                	cltq
+    150b:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    150f:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1512:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1515:	ba 00 00 00 00       	mov    $0x0,%edx
+    151a:	f7 f6                	div    %esi
+    151c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    151f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1523:	75 c3                	jne    14e8 <printint+0x45>
+  if(neg)
+    1525:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1529:	74 2b                	je     1556 <printint+0xb3>
+    buf[i++] = '-';
+    152b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    152e:	8d 50 01             	lea    0x1(%rax),%edx
+    1531:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1534:	48 98                	cltq
+    1536:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+    153b:	eb 19                	jmp    1556 <printint+0xb3>
+    putc(fd, buf[i]);
+    153d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1540:	48 98                	cltq
+    1542:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+    1547:	0f be d0             	movsbl %al,%edx
+    154a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    154d:	89 d6                	mov    %edx,%esi
+    154f:	89 c7                	mov    %eax,%edi
+    1551:	e8 24 ff ff ff       	call   147a <putc>
+  while(--i >= 0)
+    1556:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    155a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    155e:	79 dd                	jns    153d <printint+0x9a>
+}
+    1560:	90                   	nop
+    1561:	90                   	nop
+    1562:	c9                   	leave
+    1563:	c3                   	ret
+
+0000000000001564 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1564:	55                   	push   %rbp
+    1565:	48 89 e5             	mov    %rsp,%rbp
+    1568:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+    156f:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+    1575:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+    157c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+    1583:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+    158a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+    1591:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+    1598:	84 c0                	test   %al,%al
+    159a:	74 20                	je     15bc <printf+0x58>
+    159c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+    15a0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+    15a4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+    15a8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+    15ac:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+    15b0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+    15b4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+    15b8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+    15bc:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+    15c3:	00 00 00 
+    15c6:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+    15cd:	00 00 00 
+    15d0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    15d4:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+    15db:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+    15e2:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+    15e9:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+    15f0:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+    15f3:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+    15fa:	00 00 00 
+    15fd:	e9 a8 02 00 00       	jmp    18aa <printf+0x346>
+    c = fmt[i] & 0xff;
+    1602:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+    1608:	48 63 d0             	movslq %eax,%rdx
+    160b:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    1612:	48 01 d0             	add    %rdx,%rax
+    1615:	0f b6 00             	movzbl (%rax),%eax
+    1618:	0f be c0             	movsbl %al,%eax
+    161b:	25 ff 00 00 00       	and    $0xff,%eax
+    1620:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+    1626:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+    162d:	75 35                	jne    1664 <printf+0x100>
+      if(c == '%'){
+    162f:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+    1636:	75 0f                	jne    1647 <printf+0xe3>
+        state = '%';
+    1638:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+    163f:	00 00 00 
+    1642:	e9 5c 02 00 00       	jmp    18a3 <printf+0x33f>
+      } else {
+        putc(fd, c);
+    1647:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    164d:	0f be d0             	movsbl %al,%edx
+    1650:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1656:	89 d6                	mov    %edx,%esi
+    1658:	89 c7                	mov    %eax,%edi
+    165a:	e8 1b fe ff ff       	call   147a <putc>
+    165f:	e9 3f 02 00 00       	jmp    18a3 <printf+0x33f>
+      }
+    } else if(state == '%'){
+    1664:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+    166b:	0f 85 32 02 00 00    	jne    18a3 <printf+0x33f>
+      if(c == 'd'){
+    1671:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+    1678:	75 5e                	jne    16d8 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+    167a:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    1680:	83 f8 2f             	cmp    $0x2f,%eax
+    1683:	77 23                	ja     16a8 <printf+0x144>
+    1685:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    168c:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    1692:	89 d2                	mov    %edx,%edx
+    1694:	48 01 d0             	add    %rdx,%rax
+    1697:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    169d:	83 c2 08             	add    $0x8,%edx
+    16a0:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    16a6:	eb 12                	jmp    16ba <printf+0x156>
+    16a8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    16af:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    16b3:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    16ba:	8b 30                	mov    (%rax),%esi
+    16bc:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    16c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+    16c7:	ba 0a 00 00 00       	mov    $0xa,%edx
+    16cc:	89 c7                	mov    %eax,%edi
+    16ce:	e8 d0 fd ff ff       	call   14a3 <printint>
+    16d3:	e9 c1 01 00 00       	jmp    1899 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+    16d8:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+    16df:	74 09                	je     16ea <printf+0x186>
+    16e1:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+    16e8:	75 5e                	jne    1748 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+    16ea:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    16f0:	83 f8 2f             	cmp    $0x2f,%eax
+    16f3:	77 23                	ja     1718 <printf+0x1b4>
+    16f5:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    16fc:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    1702:	89 d2                	mov    %edx,%edx
+    1704:	48 01 d0             	add    %rdx,%rax
+    1707:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    170d:	83 c2 08             	add    $0x8,%edx
+    1710:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    1716:	eb 12                	jmp    172a <printf+0x1c6>
+    1718:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    171f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1723:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    172a:	8b 30                	mov    (%rax),%esi
+    172c:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1732:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1737:	ba 10 00 00 00       	mov    $0x10,%edx
+    173c:	89 c7                	mov    %eax,%edi
+    173e:	e8 60 fd ff ff       	call   14a3 <printint>
+    1743:	e9 51 01 00 00       	jmp    1899 <printf+0x335>
+      } else if(c == 's'){
+    1748:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+    174f:	0f 85 98 00 00 00    	jne    17ed <printf+0x289>
+        s = va_arg(ap, char*);
+    1755:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    175b:	83 f8 2f             	cmp    $0x2f,%eax
+    175e:	77 23                	ja     1783 <printf+0x21f>
+    1760:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    1767:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    176d:	89 d2                	mov    %edx,%edx
+    176f:	48 01 d0             	add    %rdx,%rax
+    1772:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    1778:	83 c2 08             	add    $0x8,%edx
+    177b:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    1781:	eb 12                	jmp    1795 <printf+0x231>
+    1783:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    178a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    178e:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    1795:	48 8b 00             	mov    (%rax),%rax
+    1798:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+    179f:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+    17a6:	00 
+    17a7:	75 31                	jne    17da <printf+0x276>
+          s = "(null)";
+    17a9:	48 c7 85 48 ff ff ff 	movq   $0x1e48,-0xb8(%rbp)
+    17b0:	48 1e 00 00 
+        while(*s != 0){
+    17b4:	eb 24                	jmp    17da <printf+0x276>
+          putc(fd, *s);
+    17b6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+    17bd:	0f b6 00             	movzbl (%rax),%eax
+    17c0:	0f be d0             	movsbl %al,%edx
+    17c3:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    17c9:	89 d6                	mov    %edx,%esi
+    17cb:	89 c7                	mov    %eax,%edi
+    17cd:	e8 a8 fc ff ff       	call   147a <putc>
+          s++;
+    17d2:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+    17d9:	01 
+        while(*s != 0){
+    17da:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+    17e1:	0f b6 00             	movzbl (%rax),%eax
+    17e4:	84 c0                	test   %al,%al
+    17e6:	75 ce                	jne    17b6 <printf+0x252>
+    17e8:	e9 ac 00 00 00       	jmp    1899 <printf+0x335>
+        }
+      } else if(c == 'c'){
+    17ed:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+    17f4:	75 56                	jne    184c <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+    17f6:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    17fc:	83 f8 2f             	cmp    $0x2f,%eax
+    17ff:	77 23                	ja     1824 <printf+0x2c0>
+    1801:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    1808:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    180e:	89 d2                	mov    %edx,%edx
+    1810:	48 01 d0             	add    %rdx,%rax
+    1813:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    1819:	83 c2 08             	add    $0x8,%edx
+    181c:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    1822:	eb 12                	jmp    1836 <printf+0x2d2>
+    1824:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    182b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    182f:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    1836:	8b 00                	mov    (%rax),%eax
+    1838:	0f be d0             	movsbl %al,%edx
+    183b:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1841:	89 d6                	mov    %edx,%esi
+    1843:	89 c7                	mov    %eax,%edi
+    1845:	e8 30 fc ff ff       	call   147a <putc>
+    184a:	eb 4d                	jmp    1899 <printf+0x335>
+      } else if(c == '%'){
+    184c:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+    1853:	75 1a                	jne    186f <printf+0x30b>
+        putc(fd, c);
+    1855:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    185b:	0f be d0             	movsbl %al,%edx
+    185e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1864:	89 d6                	mov    %edx,%esi
+    1866:	89 c7                	mov    %eax,%edi
+    1868:	e8 0d fc ff ff       	call   147a <putc>
+    186d:	eb 2a                	jmp    1899 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    186f:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1875:	be 25 00 00 00       	mov    $0x25,%esi
+    187a:	89 c7                	mov    %eax,%edi
+    187c:	e8 f9 fb ff ff       	call   147a <putc>
+        putc(fd, c);
+    1881:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    1887:	0f be d0             	movsbl %al,%edx
+    188a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    1890:	89 d6                	mov    %edx,%esi
+    1892:	89 c7                	mov    %eax,%edi
+    1894:	e8 e1 fb ff ff       	call   147a <putc>
+      }
+      state = 0;
+    1899:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+    18a0:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+    18a3:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+    18aa:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+    18b0:	48 63 d0             	movslq %eax,%rdx
+    18b3:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    18ba:	48 01 d0             	add    %rdx,%rax
+    18bd:	0f b6 00             	movzbl (%rax),%eax
+    18c0:	84 c0                	test   %al,%al
+    18c2:	0f 85 3a fd ff ff    	jne    1602 <printf+0x9e>
+    }
+  }
+}
+    18c8:	90                   	nop
+    18c9:	90                   	nop
+    18ca:	c9                   	leave
+    18cb:	c3                   	ret
+
+00000000000018cc <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    18cc:	55                   	push   %rbp
+    18cd:	48 89 e5             	mov    %rsp,%rbp
+    18d0:	48 83 ec 18          	sub    $0x18,%rsp
+    18d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    18d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18dc:	48 83 e8 10          	sub    $0x10,%rax
+    18e0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    18e4:	48 8b 05 35 0b 00 00 	mov    0xb35(%rip),%rax        # 2420 <freep>
+    18eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18ef:	eb 2f                	jmp    1920 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    18f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18f5:	48 8b 00             	mov    (%rax),%rax
+    18f8:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    18fc:	72 17                	jb     1915 <free+0x49>
+    18fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1902:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1906:	72 2f                	jb     1937 <free+0x6b>
+    1908:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    190c:	48 8b 00             	mov    (%rax),%rax
+    190f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1913:	72 22                	jb     1937 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1915:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1919:	48 8b 00             	mov    (%rax),%rax
+    191c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1920:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1924:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1928:	73 c7                	jae    18f1 <free+0x25>
+    192a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    192e:	48 8b 00             	mov    (%rax),%rax
+    1931:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1935:	73 ba                	jae    18f1 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1937:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    193b:	8b 40 08             	mov    0x8(%rax),%eax
+    193e:	89 c0                	mov    %eax,%eax
+    1940:	48 c1 e0 04          	shl    $0x4,%rax
+    1944:	48 89 c2             	mov    %rax,%rdx
+    1947:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    194b:	48 01 c2             	add    %rax,%rdx
+    194e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1952:	48 8b 00             	mov    (%rax),%rax
+    1955:	48 39 c2             	cmp    %rax,%rdx
+    1958:	75 2d                	jne    1987 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+    195a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    195e:	8b 50 08             	mov    0x8(%rax),%edx
+    1961:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1965:	48 8b 00             	mov    (%rax),%rax
+    1968:	8b 40 08             	mov    0x8(%rax),%eax
+    196b:	01 c2                	add    %eax,%edx
+    196d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1971:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1974:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1978:	48 8b 00             	mov    (%rax),%rax
+    197b:	48 8b 10             	mov    (%rax),%rdx
+    197e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1982:	48 89 10             	mov    %rdx,(%rax)
+    1985:	eb 0e                	jmp    1995 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1987:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    198b:	48 8b 10             	mov    (%rax),%rdx
+    198e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1992:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    1995:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1999:	8b 40 08             	mov    0x8(%rax),%eax
+    199c:	89 c0                	mov    %eax,%eax
+    199e:	48 c1 e0 04          	shl    $0x4,%rax
+    19a2:	48 89 c2             	mov    %rax,%rdx
+    19a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19a9:	48 01 d0             	add    %rdx,%rax
+    19ac:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    19b0:	75 27                	jne    19d9 <free+0x10d>
+    p->s.size += bp->s.size;
+    19b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19b6:	8b 50 08             	mov    0x8(%rax),%edx
+    19b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19bd:	8b 40 08             	mov    0x8(%rax),%eax
+    19c0:	01 c2                	add    %eax,%edx
+    19c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c6:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    19c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19cd:	48 8b 10             	mov    (%rax),%rdx
+    19d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19d4:	48 89 10             	mov    %rdx,(%rax)
+    19d7:	eb 0b                	jmp    19e4 <free+0x118>
+  } else
+    p->s.ptr = bp;
+    19d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    19e1:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    19e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19e8:	48 89 05 31 0a 00 00 	mov    %rax,0xa31(%rip)        # 2420 <freep>
+}
+    19ef:	90                   	nop
+    19f0:	c9                   	leave
+    19f1:	c3                   	ret
+
+00000000000019f2 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    19f2:	55                   	push   %rbp
+    19f3:	48 89 e5             	mov    %rsp,%rbp
+    19f6:	48 83 ec 20          	sub    $0x20,%rsp
+    19fa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    19fd:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1a04:	77 07                	ja     1a0d <morecore+0x1b>
+    nu = 4096;
+    1a06:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1a0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1a10:	c1 e0 04             	shl    $0x4,%eax
+    1a13:	89 c7                	mov    %eax,%edi
+    1a15:	e8 77 f7 ff ff       	call   1191 <sbrk>
+    1a1a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1a1e:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1a23:	75 07                	jne    1a2c <morecore+0x3a>
+    return 0;
+    1a25:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a2a:	eb 29                	jmp    1a55 <morecore+0x63>
+  hp = (Header*)p;
+    1a2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a30:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1a34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a38:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1a3b:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1a3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a42:	48 83 c0 10          	add    $0x10,%rax
+    1a46:	48 89 c7             	mov    %rax,%rdi
+    1a49:	e8 7e fe ff ff       	call   18cc <free>
+  return freep;
+    1a4e:	48 8b 05 cb 09 00 00 	mov    0x9cb(%rip),%rax        # 2420 <freep>
+}
+    1a55:	c9                   	leave
+    1a56:	c3                   	ret
+
+0000000000001a57 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1a57:	55                   	push   %rbp
+    1a58:	48 89 e5             	mov    %rsp,%rbp
+    1a5b:	48 83 ec 30          	sub    $0x30,%rsp
+    1a5f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a62:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a65:	48 83 c0 0f          	add    $0xf,%rax
+    1a69:	48 c1 e8 04          	shr    $0x4,%rax
+    1a6d:	83 c0 01             	add    $0x1,%eax
+    1a70:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+    1a73:	48 8b 05 a6 09 00 00 	mov    0x9a6(%rip),%rax        # 2420 <freep>
+    1a7a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a7e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1a83:	75 2b                	jne    1ab0 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+    1a85:	48 c7 45 f0 10 24 00 	movq   $0x2410,-0x10(%rbp)
+    1a8c:	00 
+    1a8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a91:	48 89 05 88 09 00 00 	mov    %rax,0x988(%rip)        # 2420 <freep>
+    1a98:	48 8b 05 81 09 00 00 	mov    0x981(%rip),%rax        # 2420 <freep>
+    1a9f:	48 89 05 6a 09 00 00 	mov    %rax,0x96a(%rip)        # 2410 <base>
+    base.s.size = 0;
+    1aa6:	c7 05 68 09 00 00 00 	movl   $0x0,0x968(%rip)        # 2418 <base+0x8>
+    1aad:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1ab0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ab4:	48 8b 00             	mov    (%rax),%rax
+    1ab7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1abb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1abf:	8b 40 08             	mov    0x8(%rax),%eax
+    1ac2:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1ac5:	72 5f                	jb     1b26 <malloc+0xcf>
+      if(p->s.size == nunits)
+    1ac7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1acb:	8b 40 08             	mov    0x8(%rax),%eax
+    1ace:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1ad1:	75 10                	jne    1ae3 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+    1ad3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ad7:	48 8b 10             	mov    (%rax),%rdx
+    1ada:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ade:	48 89 10             	mov    %rdx,(%rax)
+    1ae1:	eb 2e                	jmp    1b11 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+    1ae3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ae7:	8b 40 08             	mov    0x8(%rax),%eax
+    1aea:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1aed:	89 c2                	mov    %eax,%edx
+    1aef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1af3:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1af6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1afa:	8b 40 08             	mov    0x8(%rax),%eax
+    1afd:	89 c0                	mov    %eax,%eax
+    1aff:	48 c1 e0 04          	shl    $0x4,%rax
+    1b03:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1b07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b0b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b0e:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1b11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b15:	48 89 05 04 09 00 00 	mov    %rax,0x904(%rip)        # 2420 <freep>
+      return (void*)(p + 1);
+    1b1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b20:	48 83 c0 10          	add    $0x10,%rax
+    1b24:	eb 41                	jmp    1b67 <malloc+0x110>
+    }
+    if(p == freep)
+    1b26:	48 8b 05 f3 08 00 00 	mov    0x8f3(%rip),%rax        # 2420 <freep>
+    1b2d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1b31:	75 1c                	jne    1b4f <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+    1b33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1b36:	89 c7                	mov    %eax,%edi
+    1b38:	e8 b5 fe ff ff       	call   19f2 <morecore>
+    1b3d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1b41:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1b46:	75 07                	jne    1b4f <malloc+0xf8>
+        return 0;
+    1b48:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b4d:	eb 18                	jmp    1b67 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1b4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b5b:	48 8b 00             	mov    (%rax),%rax
+    1b5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1b62:	e9 54 ff ff ff       	jmp    1abb <malloc+0x64>
+  }
+}
+    1b67:	c9                   	leave
+    1b68:	c3                   	ret
+
+0000000000001b69 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+    1b69:	55                   	push   %rbp
+    1b6a:	48 89 e5             	mov    %rsp,%rbp
+    1b6d:	53                   	push   %rbx
+    1b6e:	48 83 ec 38          	sub    $0x38,%rsp
+    1b72:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1b75:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1b79:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+    1b7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1b81:	8b 40 40             	mov    0x40(%rax),%eax
+    1b84:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+    1b87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1b8b:	8b 00                	mov    (%rax),%eax
+    1b8d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b90:	29 c2                	sub    %eax,%edx
+    1b92:	83 fa 20             	cmp    $0x20,%edx
+    1b95:	75 0a                	jne    1ba1 <ring_send+0x38>
+    return -1;
+    1b97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b9c:	e9 93 00 00 00       	jmp    1c34 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+    1ba1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ba4:	83 e0 1f             	and    $0x1f,%eax
+    1ba7:	89 c2                	mov    %eax,%edx
+    1ba9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1bad:	89 d2                	mov    %edx,%edx
+    1baf:	48 83 c2 02          	add    $0x2,%rdx
+    1bb3:	48 c1 e2 06          	shl    $0x6,%rdx
+    1bb7:	48 01 c2             	add    %rax,%rdx
+    1bba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1bbe:	48 8b 08             	mov    (%rax),%rcx
+    1bc1:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    1bc5:	48 89 0a             	mov    %rcx,(%rdx)
+    1bc8:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+    1bcc:	48 8b 48 10          	mov    0x10(%rax),%rcx
+    1bd0:	48 8b 58 18          	mov    0x18(%rax),%rbx
+    1bd4:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+    1bd8:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+    1bdc:	48 8b 48 20          	mov    0x20(%rax),%rcx
+    1be0:	48 8b 58 28          	mov    0x28(%rax),%rbx
+    1be4:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+    1be8:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+    1bec:	48 8b 48 30          	mov    0x30(%rax),%rcx
+    1bf0:	48 8b 58 38          	mov    0x38(%rax),%rbx
+    1bf4:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+    1bf8:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+    1bfc:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+    1c02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c05:	8d 50 01             	lea    0x1(%rax),%edx
+    1c08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1c0c:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+    1c0f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+    1c15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1c19:	8b 00                	mov    (%rax),%eax
+    1c1b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1c1e:	75 0f                	jne    1c2f <ring_send+0xc6>
+    notify(channel, 1);
+    1c20:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c23:	be 01 00 00 00       	mov    $0x1,%esi
+    1c28:	89 c7                	mov    %eax,%edi
+    1c2a:	e8 a1 f7 ff ff       	call   13d0 <notify>
+  return 0;
+    1c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1c34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1c38:	c9                   	leave
+    1c39:	c3                   	ret
+
+0000000000001c3a <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+    1c3a:	55                   	push   %rbp
+    1c3b:	48 89 e5             	mov    %rsp,%rbp
+    1c3e:	53                   	push   %rbx
+    1c3f:	48 83 ec 38          	sub    $0x38,%rsp
+    1c43:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1c46:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1c4a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+    1c4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1c52:	8b 00                	mov    (%rax),%eax
+    1c54:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+    1c57:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+    1c5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1c61:	8b 40 40             	mov    0x40(%rax),%eax
+    1c64:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1c67:	75 15                	jne    1c7e <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+    1c69:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c6c:	89 c7                	mov    %eax,%edi
+    1c6e:	e8 67 f7 ff ff       	call   13da <nfy_wait>
+    1c73:	85 c0                	test   %eax,%eax
+    1c75:	79 e0                	jns    1c57 <ring_recv+0x1d>
+      return -1;
+    1c77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1c7c:	eb 73                	jmp    1cf1 <ring_recv+0xb7>
+      break;
+    1c7e:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+    1c7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c82:	83 e0 1f             	and    $0x1f,%eax
+    1c85:	89 c1                	mov    %eax,%ecx
+    1c87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1c8b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1c8f:	89 c9                	mov    %ecx,%ecx
+    1c91:	48 83 c1 02          	add    $0x2,%rcx
+    1c95:	48 c1 e1 06          	shl    $0x6,%rcx
+    1c99:	48 01 ca             	add    %rcx,%rdx
+    1c9c:	48 8b 0a             	mov    (%rdx),%rcx
+    1c9f:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+    1ca3:	48 89 08             	mov    %rcx,(%rax)
+    1ca6:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    1caa:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    1cae:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    1cb2:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    1cb6:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    1cba:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    1cbe:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    1cc2:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    1cc6:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    1cca:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    1cce:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    1cd2:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    1cd6:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    1cda:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    1ce0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ce3:	8d 50 01             	lea    0x1(%rax),%edx
+    1ce6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1cea:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1cec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1cf1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1cf5:	c9                   	leave
+    1cf6:	c3                   	ret
+
+0000000000001cf7 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    1cf7:	55                   	push   %rbp
+    1cf8:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    1cfb:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1d00:	8b 00                	mov    (%rax),%eax
+}
+    1d02:	5d                   	pop    %rbp
+    1d03:	c3                   	ret
+
+0000000000001d04 <getpid>:
+
+int
+getpid(void)
+{
+    1d04:	55                   	push   %rbp
+    1d05:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    1d08:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    1d0d:	8b 00                	mov    (%rax),%eax
+}
+    1d0f:	5d                   	pop    %rbp
+    1d10:	c3                   	ret
+
+0000000000001d11 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    1d11:	55                   	push   %rbp
+    1d12:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    1d15:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1d1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    1d1e:	5d                   	pop    %rbp
+    1d1f:	c3                   	ret
@@ -0,0 +1,1795 @@
+
+fs/stressfs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 81 ec 30 02 00 00 	sub    $0x230,%rsp
+       b:	89 bd dc fd ff ff    	mov    %edi,-0x224(%rbp)
+      11:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+  int fd, i;
+  char path[] = "stressfs0";
+      18:	48 b8 73 74 72 65 73 	movabs $0x7366737365727473,%rax
+      1f:	73 66 73 
+      22:	48 89 45 ee          	mov    %rax,-0x12(%rbp)
+      26:	66 c7 45 f6 30 00    	movw   $0x30,-0xa(%rbp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+      2c:	48 c7 c6 7b 10 00 00 	mov    $0x107b,%rsi
+      33:	bf 01 00 00 00       	mov    $0x1,%edi
+      38:	b8 00 00 00 00       	mov    $0x0,%eax
+      3d:	e8 7d 08 00 00       	call   8bf <printf>
+  memset(data, 'a', sizeof(data));
+      42:	48 8d 85 e0 fd ff ff 	lea    -0x220(%rbp),%rax
+      49:	ba 00 02 00 00       	mov    $0x200,%edx
+      4e:	be 61 00 00 00       	mov    $0x61,%esi
+      53:	48 89 c7             	mov    %rax,%rdi
+      56:	e8 fa 01 00 00       	call   255 <memset>
+
+  for(i = 0; i < 4; i++)
+      5b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      62:	eb 0d                	jmp    71 <main+0x71>
+    if(fork() > 0)
+      64:	e8 d9 03 00 00       	call   442 <fork>
+      69:	85 c0                	test   %eax,%eax
+      6b:	7f 0c                	jg     79 <main+0x79>
+  for(i = 0; i < 4; i++)
+      6d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      71:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+      75:	7e ed                	jle    64 <main+0x64>
+      77:	eb 01                	jmp    7a <main+0x7a>
+      break;
+      79:	90                   	nop
+
+  printf(1, "write %d\n", i);
+      7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      7d:	89 c2                	mov    %eax,%edx
+      7f:	48 c7 c6 8e 10 00 00 	mov    $0x108e,%rsi
+      86:	bf 01 00 00 00       	mov    $0x1,%edi
+      8b:	b8 00 00 00 00       	mov    $0x0,%eax
+      90:	e8 2a 08 00 00       	call   8bf <printf>
+
+  path[8] += i;
+      95:	0f b6 45 f6          	movzbl -0xa(%rbp),%eax
+      99:	89 c2                	mov    %eax,%edx
+      9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      9e:	01 d0                	add    %edx,%eax
+      a0:	88 45 f6             	mov    %al,-0xa(%rbp)
+  fd = open(path, O_CREATE | O_RDWR);
+      a3:	48 8d 45 ee          	lea    -0x12(%rbp),%rax
+      a7:	be 02 02 00 00       	mov    $0x202,%esi
+      ac:	48 89 c7             	mov    %rax,%rdi
+      af:	e8 e8 03 00 00       	call   49c <open>
+      b4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for(i = 0; i < 20; i++)
+      b7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      be:	eb 1d                	jmp    dd <main+0xdd>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+      c0:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+      c7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      ca:	ba 00 02 00 00       	mov    $0x200,%edx
+      cf:	48 89 ce             	mov    %rcx,%rsi
+      d2:	89 c7                	mov    %eax,%edi
+      d4:	e8 9b 03 00 00       	call   474 <write>
+  for(i = 0; i < 20; i++)
+      d9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      dd:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+      e1:	7e dd                	jle    c0 <main+0xc0>
+  close(fd);
+      e3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      e6:	89 c7                	mov    %eax,%edi
+      e8:	e8 91 03 00 00       	call   47e <close>
+
+  printf(1, "read\n");
+      ed:	48 c7 c6 98 10 00 00 	mov    $0x1098,%rsi
+      f4:	bf 01 00 00 00       	mov    $0x1,%edi
+      f9:	b8 00 00 00 00       	mov    $0x0,%eax
+      fe:	e8 bc 07 00 00       	call   8bf <printf>
+
+  fd = open(path, O_RDONLY);
+     103:	48 8d 45 ee          	lea    -0x12(%rbp),%rax
+     107:	be 00 00 00 00       	mov    $0x0,%esi
+     10c:	48 89 c7             	mov    %rax,%rdi
+     10f:	e8 88 03 00 00       	call   49c <open>
+     114:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for (i = 0; i < 20; i++)
+     117:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     11e:	eb 1d                	jmp    13d <main+0x13d>
+    read(fd, data, sizeof(data));
+     120:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+     127:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     12a:	ba 00 02 00 00       	mov    $0x200,%edx
+     12f:	48 89 ce             	mov    %rcx,%rsi
+     132:	89 c7                	mov    %eax,%edi
+     134:	e8 31 03 00 00       	call   46a <read>
+  for (i = 0; i < 20; i++)
+     139:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     13d:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+     141:	7e dd                	jle    120 <main+0x120>
+  close(fd);
+     143:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     146:	89 c7                	mov    %eax,%edi
+     148:	e8 31 03 00 00       	call   47e <close>
+
+  wait();
+     14d:	e8 04 03 00 00       	call   456 <wait>
+  
+  exit();
+     152:	e8 f5 02 00 00       	call   44c <exit>
+
+0000000000000157 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     157:	55                   	push   %rbp
+     158:	48 89 e5             	mov    %rsp,%rbp
+     15b:	48 83 ec 10          	sub    $0x10,%rsp
+     15f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     163:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     166:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     169:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     16d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     170:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     173:	48 89 ce             	mov    %rcx,%rsi
+     176:	48 89 f7             	mov    %rsi,%rdi
+     179:	89 d1                	mov    %edx,%ecx
+     17b:	fc                   	cld
+     17c:	f3 aa                	rep stos %al,%es:(%rdi)
+     17e:	89 ca                	mov    %ecx,%edx
+     180:	48 89 fe             	mov    %rdi,%rsi
+     183:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     187:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     18a:	90                   	nop
+     18b:	c9                   	leave
+     18c:	c3                   	ret
+
+000000000000018d <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     18d:	55                   	push   %rbp
+     18e:	48 89 e5             	mov    %rsp,%rbp
+     191:	48 83 ec 20          	sub    $0x20,%rsp
+     195:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     199:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     19d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     1a5:	90                   	nop
+     1a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     1aa:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     1ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     1b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1b6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     1ba:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     1be:	0f b6 12             	movzbl (%rdx),%edx
+     1c1:	88 10                	mov    %dl,(%rax)
+     1c3:	0f b6 00             	movzbl (%rax),%eax
+     1c6:	84 c0                	test   %al,%al
+     1c8:	75 dc                	jne    1a6 <strcpy+0x19>
+    ;
+  return os;
+     1ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     1ce:	c9                   	leave
+     1cf:	c3                   	ret
+
+00000000000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1d0:	55                   	push   %rbp
+     1d1:	48 89 e5             	mov    %rsp,%rbp
+     1d4:	48 83 ec 10          	sub    $0x10,%rsp
+     1d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     1dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     1e0:	eb 0a                	jmp    1ec <strcmp+0x1c>
+    p++, q++;
+     1e2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     1e7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     1ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     1f0:	0f b6 00             	movzbl (%rax),%eax
+     1f3:	84 c0                	test   %al,%al
+     1f5:	74 12                	je     209 <strcmp+0x39>
+     1f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     1fb:	0f b6 10             	movzbl (%rax),%edx
+     1fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     202:	0f b6 00             	movzbl (%rax),%eax
+     205:	38 c2                	cmp    %al,%dl
+     207:	74 d9                	je     1e2 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     209:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     20d:	0f b6 00             	movzbl (%rax),%eax
+     210:	0f b6 d0             	movzbl %al,%edx
+     213:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     217:	0f b6 00             	movzbl (%rax),%eax
+     21a:	0f b6 c0             	movzbl %al,%eax
+     21d:	29 c2                	sub    %eax,%edx
+     21f:	89 d0                	mov    %edx,%eax
+}
+     221:	c9                   	leave
+     222:	c3                   	ret
+
+0000000000000223 <strlen>:
+
+uint
+strlen(char *s)
+{
+     223:	55                   	push   %rbp
+     224:	48 89 e5             	mov    %rsp,%rbp
+     227:	48 83 ec 18          	sub    $0x18,%rsp
+     22b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     22f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     236:	eb 04                	jmp    23c <strlen+0x19>
+     238:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     23c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     23f:	48 63 d0             	movslq %eax,%rdx
+     242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     246:	48 01 d0             	add    %rdx,%rax
+     249:	0f b6 00             	movzbl (%rax),%eax
+     24c:	84 c0                	test   %al,%al
+     24e:	75 e8                	jne    238 <strlen+0x15>
+    ;
+  return n;
+     250:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     253:	c9                   	leave
+     254:	c3                   	ret
+
+0000000000000255 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     255:	55                   	push   %rbp
+     256:	48 89 e5             	mov    %rsp,%rbp
+     259:	48 83 ec 10          	sub    $0x10,%rsp
+     25d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     261:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     264:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     267:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     26a:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     26d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     271:	89 ce                	mov    %ecx,%esi
+     273:	48 89 c7             	mov    %rax,%rdi
+     276:	e8 dc fe ff ff       	call   157 <stosb>
+  return dst;
+     27b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     27f:	c9                   	leave
+     280:	c3                   	ret
+
+0000000000000281 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     281:	55                   	push   %rbp
+     282:	48 89 e5             	mov    %rsp,%rbp
+     285:	48 83 ec 10          	sub    $0x10,%rsp
+     289:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     28d:	89 f0                	mov    %esi,%eax
+     28f:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     292:	eb 17                	jmp    2ab <strchr+0x2a>
+    if(*s == c)
+     294:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     298:	0f b6 00             	movzbl (%rax),%eax
+     29b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     29e:	75 06                	jne    2a6 <strchr+0x25>
+      return (char*)s;
+     2a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2a4:	eb 15                	jmp    2bb <strchr+0x3a>
+  for(; *s; s++)
+     2a6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     2ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2af:	0f b6 00             	movzbl (%rax),%eax
+     2b2:	84 c0                	test   %al,%al
+     2b4:	75 de                	jne    294 <strchr+0x13>
+  return 0;
+     2b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2bb:	c9                   	leave
+     2bc:	c3                   	ret
+
+00000000000002bd <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     2bd:	55                   	push   %rbp
+     2be:	48 89 e5             	mov    %rsp,%rbp
+     2c1:	48 83 ec 20          	sub    $0x20,%rsp
+     2c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     2c9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     2cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     2d3:	eb 48                	jmp    31d <gets+0x60>
+    cc = read(0, &c, 1);
+     2d5:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     2d9:	ba 01 00 00 00       	mov    $0x1,%edx
+     2de:	48 89 c6             	mov    %rax,%rsi
+     2e1:	bf 00 00 00 00       	mov    $0x0,%edi
+     2e6:	e8 7f 01 00 00       	call   46a <read>
+     2eb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     2ee:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     2f2:	7e 36                	jle    32a <gets+0x6d>
+      break;
+    buf[i++] = c;
+     2f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2f7:	8d 50 01             	lea    0x1(%rax),%edx
+     2fa:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     2fd:	48 63 d0             	movslq %eax,%rdx
+     300:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     304:	48 01 c2             	add    %rax,%rdx
+     307:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     30b:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     30d:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     311:	3c 0a                	cmp    $0xa,%al
+     313:	74 16                	je     32b <gets+0x6e>
+     315:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     319:	3c 0d                	cmp    $0xd,%al
+     31b:	74 0e                	je     32b <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     31d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     320:	83 c0 01             	add    $0x1,%eax
+     323:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     326:	7f ad                	jg     2d5 <gets+0x18>
+     328:	eb 01                	jmp    32b <gets+0x6e>
+      break;
+     32a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     32b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     32e:	48 63 d0             	movslq %eax,%rdx
+     331:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     335:	48 01 d0             	add    %rdx,%rax
+     338:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     33b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     33f:	c9                   	leave
+     340:	c3                   	ret
+
+0000000000000341 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     341:	55                   	push   %rbp
+     342:	48 89 e5             	mov    %rsp,%rbp
+     345:	48 83 ec 20          	sub    $0x20,%rsp
+     349:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     34d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     351:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     355:	be 00 00 00 00       	mov    $0x0,%esi
+     35a:	48 89 c7             	mov    %rax,%rdi
+     35d:	e8 3a 01 00 00       	call   49c <open>
+     362:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     365:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     369:	79 07                	jns    372 <stat+0x31>
+    return -1;
+     36b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     370:	eb 21                	jmp    393 <stat+0x52>
+  r = fstat(fd, st);
+     372:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     376:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     379:	48 89 d6             	mov    %rdx,%rsi
+     37c:	89 c7                	mov    %eax,%edi
+     37e:	e8 37 01 00 00       	call   4ba <fstat>
+     383:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     386:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     389:	89 c7                	mov    %eax,%edi
+     38b:	e8 ee 00 00 00       	call   47e <close>
+  return r;
+     390:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     393:	c9                   	leave
+     394:	c3                   	ret
+
+0000000000000395 <atoi>:
+
+int
+atoi(const char *s)
+{
+     395:	55                   	push   %rbp
+     396:	48 89 e5             	mov    %rsp,%rbp
+     399:	48 83 ec 18          	sub    $0x18,%rsp
+     39d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     3a1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     3a8:	eb 28                	jmp    3d2 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     3aa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     3ad:	89 d0                	mov    %edx,%eax
+     3af:	c1 e0 02             	shl    $0x2,%eax
+     3b2:	01 d0                	add    %edx,%eax
+     3b4:	01 c0                	add    %eax,%eax
+     3b6:	89 c1                	mov    %eax,%ecx
+     3b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3bc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     3c0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     3c4:	0f b6 00             	movzbl (%rax),%eax
+     3c7:	0f be c0             	movsbl %al,%eax
+     3ca:	01 c8                	add    %ecx,%eax
+     3cc:	83 e8 30             	sub    $0x30,%eax
+     3cf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     3d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3d6:	0f b6 00             	movzbl (%rax),%eax
+     3d9:	3c 2f                	cmp    $0x2f,%al
+     3db:	7e 0b                	jle    3e8 <atoi+0x53>
+     3dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3e1:	0f b6 00             	movzbl (%rax),%eax
+     3e4:	3c 39                	cmp    $0x39,%al
+     3e6:	7e c2                	jle    3aa <atoi+0x15>
+  return n;
+     3e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     3eb:	c9                   	leave
+     3ec:	c3                   	ret
+
+00000000000003ed <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     3ed:	55                   	push   %rbp
+     3ee:	48 89 e5             	mov    %rsp,%rbp
+     3f1:	48 83 ec 28          	sub    $0x28,%rsp
+     3f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     3f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     3fd:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     404:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     408:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     40c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     410:	eb 1d                	jmp    42f <memmove+0x42>
+    *dst++ = *src++;
+     412:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     416:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     41a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     41e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     422:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     426:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     42a:	0f b6 12             	movzbl (%rdx),%edx
+     42d:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     42f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     432:	8d 50 ff             	lea    -0x1(%rax),%edx
+     435:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     438:	85 c0                	test   %eax,%eax
+     43a:	7f d6                	jg     412 <memmove+0x25>
+  return vdst;
+     43c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     440:	c9                   	leave
+     441:	c3                   	ret
+
+0000000000000442 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     442:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     449:	cd 40                	int    $0x40
+     44b:	c3                   	ret
+
+000000000000044c <exit>:
+SYSCALL_FAST(exit)
+     44c:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     453:	0f 05                	syscall
+     455:	c3                   	ret
+
+0000000000000456 <wait>:
+SYSCALL_FAST(wait)
+     456:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     45d:	0f 05                	syscall
+     45f:	c3                   	ret
+
+0000000000000460 <pipe>:
+SYSCALL_FAST(pipe)
+     460:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     467:	0f 05                	syscall
+     469:	c3                   	ret
+
+000000000000046a <read>:
+SYSCALL_FAST(read)
+     46a:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     471:	0f 05                	syscall
+     473:	c3                   	ret
+
+0000000000000474 <write>:
+SYSCALL_FAST(write)
+     474:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     47b:	0f 05                	syscall
+     47d:	c3                   	ret
+
+000000000000047e <close>:
+SYSCALL_FAST(close)
+     47e:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     485:	0f 05                	syscall
+     487:	c3                   	ret
+
+0000000000000488 <kill>:
+SYSCALL_FAST(kill)
+     488:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     48f:	0f 05                	syscall
+     491:	c3                   	ret
+
+0000000000000492 <exec>:
+SYSCALL(exec)
+     492:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     499:	cd 40                	int    $0x40
+     49b:	c3                   	ret
+
+000000000000049c <open>:
+SYSCALL_FAST(open)
+     49c:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     4a3:	0f 05                	syscall
+     4a5:	c3                   	ret
+
+00000000000004a6 <mknod>:
+SYSCALL_FAST(mknod)
+     4a6:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     4ad:	0f 05                	syscall
+     4af:	c3                   	ret
+
+00000000000004b0 <unlink>:
+SYSCALL_FAST(unlink)
+     4b0:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     4b7:	0f 05                	syscall
+     4b9:	c3                   	ret
+
+00000000000004ba <fstat>:
+SYSCALL_FAST(fstat)
+     4ba:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     4c1:	0f 05                	syscall
+     4c3:	c3                   	ret
+
+00000000000004c4 <link>:
+SYSCALL_FAST(link)
+     4c4:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     4cb:	0f 05                	syscall
+     4cd:	c3                   	ret
+
+00000000000004ce <mkdir>:
+SYSCALL_FAST(mkdir)
+     4ce:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     4d5:	0f 05                	syscall
+     4d7:	c3                   	ret
+
+00000000000004d8 <chdir>:
+SYSCALL_FAST(chdir)
+     4d8:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     4df:	0f 05                	syscall
+     4e1:	c3                   	ret
+
+00000000000004e2 <dup>:
+SYSCALL_FAST(dup)
+     4e2:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     4e9:	0f 05                	syscall
+     4eb:	c3                   	ret
+
+00000000000004ec <sbrk>:
+SYSCALL_FAST(sbrk)
+     4ec:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     4f3:	0f 05                	syscall
+     4f5:	c3                   	ret
+
+00000000000004f6 <sleep>:
+SYSCALL_FAST(sleep)
+     4f6:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     4fd:	0f 05                	syscall
+     4ff:	c3                   	ret
+
+0000000000000500 <send>:
+SYSCALL_FAST(send)
+     500:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     507:	0f 05                	syscall
+     509:	c3                   	ret
+
+000000000000050a <send_recv>:
+SYSCALL_FAST(send_recv)
+     50a:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     511:	0f 05                	syscall
+     513:	c3                   	ret
+
+0000000000000514 <recv>:
+SYSCALL_FAST(recv)
+     514:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     51b:	0f 05                	syscall
+     51d:	c3                   	ret
+
+000000000000051e <call>:
+SYSCALL_FAST(call)
+     51e:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     525:	0f 05                	syscall
+     527:	c3                   	ret
+
+0000000000000528 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     528:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     52f:	0f 05                	syscall
+     531:	c3                   	ret
+
+0000000000000532 <send_reg>:
+SYSCALL_REG(send_reg)
+     532:	41 54                	push   %r12
+     534:	41 55                	push   %r13
+     536:	41 56                	push   %r14
+     538:	41 57                	push   %r15
+     53a:	56                   	push   %rsi
+     53b:	49 89 f3             	mov    %rsi,%r11
+     53e:	48 89 d6             	mov    %rdx,%rsi
+     541:	49 8b 13             	mov    (%r11),%rdx
+     544:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     548:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     54c:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     550:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     554:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     558:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     55c:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     560:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     567:	0f 05                	syscall
+     569:	41 5b                	pop    %r11
+     56b:	49 89 13             	mov    %rdx,(%r11)
+     56e:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     572:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     576:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     57a:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     57e:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     582:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     586:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     58a:	41 5f                	pop    %r15
+     58c:	41 5e                	pop    %r14
+     58e:	41 5d                	pop    %r13
+     590:	41 5c                	pop    %r12
+     592:	c3                   	ret
+
+0000000000000593 <recv_reg>:
+SYSCALL_REG(recv_reg)
+     593:	41 54                	push   %r12
+     595:	41 55                	push   %r13
+     597:	41 56                	push   %r14
+     599:	41 57                	push   %r15
+     59b:	56                   	push   %rsi
+     59c:	49 89 f3             	mov    %rsi,%r11
+     59f:	48 89 d6             	mov    %rdx,%rsi
+     5a2:	49 8b 13             	mov    (%r11),%rdx
+     5a5:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     5a9:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     5ad:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     5b1:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     5b5:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     5b9:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     5bd:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     5c1:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+     5c8:	0f 05                	syscall
+     5ca:	41 5b                	pop    %r11
+     5cc:	49 89 13             	mov    %rdx,(%r11)
+     5cf:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     5d3:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     5d7:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     5db:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     5df:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     5e3:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     5e7:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     5eb:	41 5f                	pop    %r15
+     5ed:	41 5e                	pop    %r14
+     5ef:	41 5d                	pop    %r13
+     5f1:	41 5c                	pop    %r12
+     5f3:	c3                   	ret
+
+00000000000005f4 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+     5f4:	41 54                	push   %r12
+     5f6:	41 55                	push   %r13
+     5f8:	41 56                	push   %r14
+     5fa:	41 57                	push   %r15
+     5fc:	56                   	push   %rsi
+     5fd:	49 89 f3             	mov    %rsi,%r11
+     600:	48 89 d6             	mov    %rdx,%rsi
+     603:	49 8b 13             	mov    (%r11),%rdx
+     606:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     60a:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     60e:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     612:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     616:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     61a:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     61e:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     622:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+     629:	0f 05                	syscall
+     62b:	41 5b                	pop    %r11
+     62d:	49 89 13             	mov    %rdx,(%r11)
+     630:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     634:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     638:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     63c:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     640:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     644:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     648:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     64c:	41 5f                	pop    %r15
+     64e:	41 5e                	pop    %r14
+     650:	41 5d                	pop    %r13
+     652:	41 5c                	pop    %r12
+     654:	c3                   	ret
+
+0000000000000655 <call_reg>:
+SYSCALL_REG(call_reg)
+     655:	41 54                	push   %r12
+     657:	41 55                	push   %r13
+     659:	41 56                	push   %r14
+     65b:	41 57                	push   %r15
+     65d:	56                   	push   %rsi
+     65e:	49 89 f3             	mov    %rsi,%r11
+     661:	48 89 d6             	mov    %rdx,%rsi
+     664:	49 8b 13             	mov    (%r11),%rdx
+     667:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     66b:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     66f:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     673:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     677:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     67b:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     67f:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     683:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+     68a:	0f 05                	syscall
+     68c:	41 5b                	pop    %r11
+     68e:	49 89 13             	mov    %rdx,(%r11)
+     691:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     695:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     699:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     69d:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     6a1:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     6a5:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     6a9:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     6ad:	41 5f                	pop    %r15
+     6af:	41 5e                	pop    %r14
+     6b1:	41 5d                	pop    %r13
+     6b3:	41 5c                	pop    %r12
+     6b5:	c3                   	ret
+
+00000000000006b6 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+     6b6:	41 54                	push   %r12
+     6b8:	41 55                	push   %r13
+     6ba:	41 56                	push   %r14
+     6bc:	41 57                	push   %r15
+     6be:	56                   	push   %rsi
+     6bf:	49 89 f3             	mov    %rsi,%r11
+     6c2:	48 89 d6             	mov    %rdx,%rsi
+     6c5:	49 8b 13             	mov    (%r11),%rdx
+     6c8:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     6cc:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     6d0:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     6d4:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     6d8:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     6dc:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     6e0:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     6e4:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+     6eb:	0f 05                	syscall
+     6ed:	41 5b                	pop    %r11
+     6ef:	49 89 13             	mov    %rdx,(%r11)
+     6f2:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     6f6:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     6fa:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     6fe:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     702:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     706:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     70a:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     70e:	41 5f                	pop    %r15
+     710:	41 5e                	pop    %r14
+     712:	41 5d                	pop    %r13
+     714:	41 5c                	pop    %r12
+     716:	c3                   	ret
+
+0000000000000717 <sendx>:
+SYSCALL_FAST(sendx)
+     717:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+     71e:	0f 05                	syscall
+     720:	c3                   	ret
+
+0000000000000721 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+     721:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+     728:	0f 05                	syscall
+     72a:	c3                   	ret
+
+000000000000072b <notify>:
+SYSCALL_FAST(notify)
+     72b:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+     732:	0f 05                	syscall
+     734:	c3                   	ret
+
+0000000000000735 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+     735:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+     73c:	0f 05                	syscall
+     73e:	c3                   	ret
+
+000000000000073f <send_timed>:
+SYSCALL_FAST(send_timed)
+     73f:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+     746:	0f 05                	syscall
+     748:	c3                   	ret
+
+0000000000000749 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+     749:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+     750:	0f 05                	syscall
+     752:	c3                   	ret
+
+0000000000000753 <set_add>:
+SYSCALL_FAST(set_add)
+     753:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+     75a:	0f 05                	syscall
+     75c:	c3                   	ret
+
+000000000000075d <set_del>:
+SYSCALL_FAST(set_del)
+     75d:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+     764:	0f 05                	syscall
+     766:	c3                   	ret
+
+0000000000000767 <recv_any>:
+SYSCALL_FAST(recv_any)
+     767:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+     76e:	0f 05                	syscall
+     770:	c3                   	ret
+
+0000000000000771 <ep_create>:
+SYSCALL_FAST(ep_create)
+     771:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+     778:	0f 05                	syscall
+     77a:	c3                   	ret
+
+000000000000077b <ep_close>:
+SYSCALL_FAST(ep_close)
+     77b:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+     782:	0f 05                	syscall
+     784:	c3                   	ret
+
+0000000000000785 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+     785:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+     78c:	0f 05                	syscall
+     78e:	c3                   	ret
+
+000000000000078f <setprio>:
+SYSCALL_FAST(setprio)
+     78f:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+     796:	0f 05                	syscall
+     798:	c3                   	ret
+
+0000000000000799 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+     799:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+     7a0:	0f 05                	syscall
+     7a2:	c3                   	ret
+
+00000000000007a3 <sethuge>:
+SYSCALL_FAST(sethuge)
+     7a3:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+     7aa:	0f 05                	syscall
+     7ac:	c3                   	ret
+
+00000000000007ad <cr3_test>:
+SYSCALL_FAST(cr3_test)
+     7ad:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+     7b4:	0f 05                	syscall
+     7b6:	c3                   	ret
+
+00000000000007b7 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+     7b7:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+     7be:	0f 05                	syscall
+     7c0:	c3                   	ret
+
+00000000000007c1 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+     7c1:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+     7c8:	0f 05                	syscall
+     7ca:	c3                   	ret
+
+00000000000007cb <null_call>:
+     7cb:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+     7d2:	0f 05                	syscall
+     7d4:	c3                   	ret
+
+00000000000007d5 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     7d5:	55                   	push   %rbp
+     7d6:	48 89 e5             	mov    %rsp,%rbp
+     7d9:	48 83 ec 10          	sub    $0x10,%rsp
+     7dd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     7e0:	89 f0                	mov    %esi,%eax
+     7e2:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     7e5:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     7e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7ec:	ba 01 00 00 00       	mov    $0x1,%edx
+     7f1:	48 89 ce             	mov    %rcx,%rsi
+     7f4:	89 c7                	mov    %eax,%edi
+     7f6:	e8 79 fc ff ff       	call   474 <write>
+}
+     7fb:	90                   	nop
+     7fc:	c9                   	leave
+     7fd:	c3                   	ret
+
+00000000000007fe <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     7fe:	55                   	push   %rbp
+     7ff:	48 89 e5             	mov    %rsp,%rbp
+     802:	48 83 ec 30          	sub    $0x30,%rsp
+     806:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     809:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     80c:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     80f:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     812:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     819:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     81d:	74 17                	je     836 <printint+0x38>
+     81f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     823:	79 11                	jns    836 <printint+0x38>
+    neg = 1;
+     825:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     82c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     82f:	f7 d8                	neg    %eax
+     831:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     834:	eb 06                	jmp    83c <printint+0x3e>
+  } else {
+    x = xx;
+     836:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     839:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     83c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     843:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     846:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     849:	ba 00 00 00 00       	mov    $0x0,%edx
+     84e:	f7 f1                	div    %ecx
+     850:	89 d1                	mov    %edx,%ecx
+     852:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     855:	8d 50 01             	lea    0x1(%rax),%edx
+     858:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     85b:	89 ca                	mov    %ecx,%edx
+     85d:	0f b6 92 90 13 00 00 	movzbl 0x1390(%rdx),%edx
+     864:	48 98                	cltq
+     866:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     86a:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     86d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     870:	ba 00 00 00 00       	mov    $0x0,%edx
+     875:	f7 f6                	div    %esi
+     877:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     87a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     87e:	75 c3                	jne    843 <printint+0x45>
+  if(neg)
+     880:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     884:	74 2b                	je     8b1 <printint+0xb3>
+    buf[i++] = '-';
+     886:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     889:	8d 50 01             	lea    0x1(%rax),%edx
+     88c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     88f:	48 98                	cltq
+     891:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+     896:	eb 19                	jmp    8b1 <printint+0xb3>
+    putc(fd, buf[i]);
+     898:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     89b:	48 98                	cltq
+     89d:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+     8a2:	0f be d0             	movsbl %al,%edx
+     8a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     8a8:	89 d6                	mov    %edx,%esi
+     8aa:	89 c7                	mov    %eax,%edi
+     8ac:	e8 24 ff ff ff       	call   7d5 <putc>
+  while(--i >= 0)
+     8b1:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     8b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8b9:	79 dd                	jns    898 <printint+0x9a>
+}
+     8bb:	90                   	nop
+     8bc:	90                   	nop
+     8bd:	c9                   	leave
+     8be:	c3                   	ret
+
+00000000000008bf <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     8bf:	55                   	push   %rbp
+     8c0:	48 89 e5             	mov    %rsp,%rbp
+     8c3:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+     8ca:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+     8d0:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+     8d7:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+     8de:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+     8e5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+     8ec:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+     8f3:	84 c0                	test   %al,%al
+     8f5:	74 20                	je     917 <printf+0x58>
+     8f7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+     8fb:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+     8ff:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+     903:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+     907:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+     90b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+     90f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+     913:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+     917:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+     91e:	00 00 00 
+     921:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+     928:	00 00 00 
+     92b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     92f:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+     936:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+     93d:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+     944:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     94b:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     94e:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+     955:	00 00 00 
+     958:	e9 a8 02 00 00       	jmp    c05 <printf+0x346>
+    c = fmt[i] & 0xff;
+     95d:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     963:	48 63 d0             	movslq %eax,%rdx
+     966:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     96d:	48 01 d0             	add    %rdx,%rax
+     970:	0f b6 00             	movzbl (%rax),%eax
+     973:	0f be c0             	movsbl %al,%eax
+     976:	25 ff 00 00 00       	and    $0xff,%eax
+     97b:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+     981:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+     988:	75 35                	jne    9bf <printf+0x100>
+      if(c == '%'){
+     98a:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     991:	75 0f                	jne    9a2 <printf+0xe3>
+        state = '%';
+     993:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+     99a:	00 00 00 
+     99d:	e9 5c 02 00 00       	jmp    bfe <printf+0x33f>
+      } else {
+        putc(fd, c);
+     9a2:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     9a8:	0f be d0             	movsbl %al,%edx
+     9ab:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     9b1:	89 d6                	mov    %edx,%esi
+     9b3:	89 c7                	mov    %eax,%edi
+     9b5:	e8 1b fe ff ff       	call   7d5 <putc>
+     9ba:	e9 3f 02 00 00       	jmp    bfe <printf+0x33f>
+      }
+    } else if(state == '%'){
+     9bf:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+     9c6:	0f 85 32 02 00 00    	jne    bfe <printf+0x33f>
+      if(c == 'd'){
+     9cc:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+     9d3:	75 5e                	jne    a33 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+     9d5:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     9db:	83 f8 2f             	cmp    $0x2f,%eax
+     9de:	77 23                	ja     a03 <printf+0x144>
+     9e0:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     9e7:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     9ed:	89 d2                	mov    %edx,%edx
+     9ef:	48 01 d0             	add    %rdx,%rax
+     9f2:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     9f8:	83 c2 08             	add    $0x8,%edx
+     9fb:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     a01:	eb 12                	jmp    a15 <printf+0x156>
+     a03:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     a0a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a0e:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     a15:	8b 30                	mov    (%rax),%esi
+     a17:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     a1d:	b9 01 00 00 00       	mov    $0x1,%ecx
+     a22:	ba 0a 00 00 00       	mov    $0xa,%edx
+     a27:	89 c7                	mov    %eax,%edi
+     a29:	e8 d0 fd ff ff       	call   7fe <printint>
+     a2e:	e9 c1 01 00 00       	jmp    bf4 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+     a33:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+     a3a:	74 09                	je     a45 <printf+0x186>
+     a3c:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+     a43:	75 5e                	jne    aa3 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+     a45:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     a4b:	83 f8 2f             	cmp    $0x2f,%eax
+     a4e:	77 23                	ja     a73 <printf+0x1b4>
+     a50:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     a57:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a5d:	89 d2                	mov    %edx,%edx
+     a5f:	48 01 d0             	add    %rdx,%rax
+     a62:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a68:	83 c2 08             	add    $0x8,%edx
+     a6b:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     a71:	eb 12                	jmp    a85 <printf+0x1c6>
+     a73:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     a7a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a7e:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     a85:	8b 30                	mov    (%rax),%esi
+     a87:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     a8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a92:	ba 10 00 00 00       	mov    $0x10,%edx
+     a97:	89 c7                	mov    %eax,%edi
+     a99:	e8 60 fd ff ff       	call   7fe <printint>
+     a9e:	e9 51 01 00 00       	jmp    bf4 <printf+0x335>
+      } else if(c == 's'){
+     aa3:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+     aaa:	0f 85 98 00 00 00    	jne    b48 <printf+0x289>
+        s = va_arg(ap, char*);
+     ab0:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     ab6:	83 f8 2f             	cmp    $0x2f,%eax
+     ab9:	77 23                	ja     ade <printf+0x21f>
+     abb:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     ac2:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     ac8:	89 d2                	mov    %edx,%edx
+     aca:	48 01 d0             	add    %rdx,%rax
+     acd:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     ad3:	83 c2 08             	add    $0x8,%edx
+     ad6:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     adc:	eb 12                	jmp    af0 <printf+0x231>
+     ade:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     ae5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ae9:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     af0:	48 8b 00             	mov    (%rax),%rax
+     af3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+     afa:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+     b01:	00 
+     b02:	75 31                	jne    b35 <printf+0x276>
+          s = "(null)";
+     b04:	48 c7 85 48 ff ff ff 	movq   $0x109e,-0xb8(%rbp)
+     b0b:	9e 10 00 00 
+        while(*s != 0){
+     b0f:	eb 24                	jmp    b35 <printf+0x276>
+          putc(fd, *s);
+     b11:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     b18:	0f b6 00             	movzbl (%rax),%eax
+     b1b:	0f be d0             	movsbl %al,%edx
+     b1e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b24:	89 d6                	mov    %edx,%esi
+     b26:	89 c7                	mov    %eax,%edi
+     b28:	e8 a8 fc ff ff       	call   7d5 <putc>
+          s++;
+     b2d:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+     b34:	01 
+        while(*s != 0){
+     b35:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     b3c:	0f b6 00             	movzbl (%rax),%eax
+     b3f:	84 c0                	test   %al,%al
+     b41:	75 ce                	jne    b11 <printf+0x252>
+     b43:	e9 ac 00 00 00       	jmp    bf4 <printf+0x335>
+        }
+      } else if(c == 'c'){
+     b48:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+     b4f:	75 56                	jne    ba7 <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+     b51:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     b57:	83 f8 2f             	cmp    $0x2f,%eax
+     b5a:	77 23                	ja     b7f <printf+0x2c0>
+     b5c:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     b63:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b69:	89 d2                	mov    %edx,%edx
+     b6b:	48 01 d0             	add    %rdx,%rax
+     b6e:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b74:	83 c2 08             	add    $0x8,%edx
+     b77:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     b7d:	eb 12                	jmp    b91 <printf+0x2d2>
+     b7f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     b86:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     b8a:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     b91:	8b 00                	mov    (%rax),%eax
+     b93:	0f be d0             	movsbl %al,%edx
+     b96:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b9c:	89 d6                	mov    %edx,%esi
+     b9e:	89 c7                	mov    %eax,%edi
+     ba0:	e8 30 fc ff ff       	call   7d5 <putc>
+     ba5:	eb 4d                	jmp    bf4 <printf+0x335>
+      } else if(c == '%'){
+     ba7:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     bae:	75 1a                	jne    bca <printf+0x30b>
+        putc(fd, c);
+     bb0:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     bb6:	0f be d0             	movsbl %al,%edx
+     bb9:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     bbf:	89 d6                	mov    %edx,%esi
+     bc1:	89 c7                	mov    %eax,%edi
+     bc3:	e8 0d fc ff ff       	call   7d5 <putc>
+     bc8:	eb 2a                	jmp    bf4 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     bca:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     bd0:	be 25 00 00 00       	mov    $0x25,%esi
+     bd5:	89 c7                	mov    %eax,%edi
+     bd7:	e8 f9 fb ff ff       	call   7d5 <putc>
+        putc(fd, c);
+     bdc:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     be2:	0f be d0             	movsbl %al,%edx
+     be5:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     beb:	89 d6                	mov    %edx,%esi
+     bed:	89 c7                	mov    %eax,%edi
+     bef:	e8 e1 fb ff ff       	call   7d5 <putc>
+      }
+      state = 0;
+     bf4:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     bfb:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     bfe:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+     c05:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     c0b:	48 63 d0             	movslq %eax,%rdx
+     c0e:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     c15:	48 01 d0             	add    %rdx,%rax
+     c18:	0f b6 00             	movzbl (%rax),%eax
+     c1b:	84 c0                	test   %al,%al
+     c1d:	0f 85 3a fd ff ff    	jne    95d <printf+0x9e>
+    }
+  }
+}
+     c23:	90                   	nop
+     c24:	90                   	nop
+     c25:	c9                   	leave
+     c26:	c3                   	ret
+
+0000000000000c27 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     c27:	55                   	push   %rbp
+     c28:	48 89 e5             	mov    %rsp,%rbp
+     c2b:	48 83 ec 18          	sub    $0x18,%rsp
+     c2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     c33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c37:	48 83 e8 10          	sub    $0x10,%rax
+     c3b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c3f:	48 8b 05 7a 07 00 00 	mov    0x77a(%rip),%rax        # 13c0 <freep>
+     c46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     c4a:	eb 2f                	jmp    c7b <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     c4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c50:	48 8b 00             	mov    (%rax),%rax
+     c53:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c57:	72 17                	jb     c70 <free+0x49>
+     c59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c5d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c61:	72 2f                	jb     c92 <free+0x6b>
+     c63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c67:	48 8b 00             	mov    (%rax),%rax
+     c6a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     c6e:	72 22                	jb     c92 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     c70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c74:	48 8b 00             	mov    (%rax),%rax
+     c77:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     c7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c7f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     c83:	73 c7                	jae    c4c <free+0x25>
+     c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c89:	48 8b 00             	mov    (%rax),%rax
+     c8c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     c90:	73 ba                	jae    c4c <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     c92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c96:	8b 40 08             	mov    0x8(%rax),%eax
+     c99:	89 c0                	mov    %eax,%eax
+     c9b:	48 c1 e0 04          	shl    $0x4,%rax
+     c9f:	48 89 c2             	mov    %rax,%rdx
+     ca2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ca6:	48 01 c2             	add    %rax,%rdx
+     ca9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cad:	48 8b 00             	mov    (%rax),%rax
+     cb0:	48 39 c2             	cmp    %rax,%rdx
+     cb3:	75 2d                	jne    ce2 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+     cb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cb9:	8b 50 08             	mov    0x8(%rax),%edx
+     cbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cc0:	48 8b 00             	mov    (%rax),%rax
+     cc3:	8b 40 08             	mov    0x8(%rax),%eax
+     cc6:	01 c2                	add    %eax,%edx
+     cc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ccc:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ccf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cd3:	48 8b 00             	mov    (%rax),%rax
+     cd6:	48 8b 10             	mov    (%rax),%rdx
+     cd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cdd:	48 89 10             	mov    %rdx,(%rax)
+     ce0:	eb 0e                	jmp    cf0 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+     ce2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ce6:	48 8b 10             	mov    (%rax),%rdx
+     ce9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ced:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     cf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cf4:	8b 40 08             	mov    0x8(%rax),%eax
+     cf7:	89 c0                	mov    %eax,%eax
+     cf9:	48 c1 e0 04          	shl    $0x4,%rax
+     cfd:	48 89 c2             	mov    %rax,%rdx
+     d00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d04:	48 01 d0             	add    %rdx,%rax
+     d07:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     d0b:	75 27                	jne    d34 <free+0x10d>
+    p->s.size += bp->s.size;
+     d0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d11:	8b 50 08             	mov    0x8(%rax),%edx
+     d14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d18:	8b 40 08             	mov    0x8(%rax),%eax
+     d1b:	01 c2                	add    %eax,%edx
+     d1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d21:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     d24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d28:	48 8b 10             	mov    (%rax),%rdx
+     d2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d2f:	48 89 10             	mov    %rdx,(%rax)
+     d32:	eb 0b                	jmp    d3f <free+0x118>
+  } else
+    p->s.ptr = bp;
+     d34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d38:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d3c:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     d3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d43:	48 89 05 76 06 00 00 	mov    %rax,0x676(%rip)        # 13c0 <freep>
+}
+     d4a:	90                   	nop
+     d4b:	c9                   	leave
+     d4c:	c3                   	ret
+
+0000000000000d4d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     d4d:	55                   	push   %rbp
+     d4e:	48 89 e5             	mov    %rsp,%rbp
+     d51:	48 83 ec 20          	sub    $0x20,%rsp
+     d55:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     d58:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     d5f:	77 07                	ja     d68 <morecore+0x1b>
+    nu = 4096;
+     d61:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     d68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     d6b:	c1 e0 04             	shl    $0x4,%eax
+     d6e:	89 c7                	mov    %eax,%edi
+     d70:	e8 77 f7 ff ff       	call   4ec <sbrk>
+     d75:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     d79:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     d7e:	75 07                	jne    d87 <morecore+0x3a>
+    return 0;
+     d80:	b8 00 00 00 00       	mov    $0x0,%eax
+     d85:	eb 29                	jmp    db0 <morecore+0x63>
+  hp = (Header*)p;
+     d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d8b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     d8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d93:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     d96:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     d99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d9d:	48 83 c0 10          	add    $0x10,%rax
+     da1:	48 89 c7             	mov    %rax,%rdi
+     da4:	e8 7e fe ff ff       	call   c27 <free>
+  return freep;
+     da9:	48 8b 05 10 06 00 00 	mov    0x610(%rip),%rax        # 13c0 <freep>
+}
+     db0:	c9                   	leave
+     db1:	c3                   	ret
+
+0000000000000db2 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     db2:	55                   	push   %rbp
+     db3:	48 89 e5             	mov    %rsp,%rbp
+     db6:	48 83 ec 30          	sub    $0x30,%rsp
+     dba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     dbd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     dc0:	48 83 c0 0f          	add    $0xf,%rax
+     dc4:	48 c1 e8 04          	shr    $0x4,%rax
+     dc8:	83 c0 01             	add    $0x1,%eax
+     dcb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+     dce:	48 8b 05 eb 05 00 00 	mov    0x5eb(%rip),%rax        # 13c0 <freep>
+     dd5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     dd9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     dde:	75 2b                	jne    e0b <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+     de0:	48 c7 45 f0 b0 13 00 	movq   $0x13b0,-0x10(%rbp)
+     de7:	00 
+     de8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     dec:	48 89 05 cd 05 00 00 	mov    %rax,0x5cd(%rip)        # 13c0 <freep>
+     df3:	48 8b 05 c6 05 00 00 	mov    0x5c6(%rip),%rax        # 13c0 <freep>
+     dfa:	48 89 05 af 05 00 00 	mov    %rax,0x5af(%rip)        # 13b0 <base>
+    base.s.size = 0;
+     e01:	c7 05 ad 05 00 00 00 	movl   $0x0,0x5ad(%rip)        # 13b8 <base+0x8>
+     e08:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e0f:	48 8b 00             	mov    (%rax),%rax
+     e12:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     e16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e1a:	8b 40 08             	mov    0x8(%rax),%eax
+     e1d:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     e20:	72 5f                	jb     e81 <malloc+0xcf>
+      if(p->s.size == nunits)
+     e22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e26:	8b 40 08             	mov    0x8(%rax),%eax
+     e29:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     e2c:	75 10                	jne    e3e <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+     e2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e32:	48 8b 10             	mov    (%rax),%rdx
+     e35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e39:	48 89 10             	mov    %rdx,(%rax)
+     e3c:	eb 2e                	jmp    e6c <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+     e3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e42:	8b 40 08             	mov    0x8(%rax),%eax
+     e45:	2b 45 ec             	sub    -0x14(%rbp),%eax
+     e48:	89 c2                	mov    %eax,%edx
+     e4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e4e:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+     e51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e55:	8b 40 08             	mov    0x8(%rax),%eax
+     e58:	89 c0                	mov    %eax,%eax
+     e5a:	48 c1 e0 04          	shl    $0x4,%rax
+     e5e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+     e62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e66:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     e69:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+     e6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e70:	48 89 05 49 05 00 00 	mov    %rax,0x549(%rip)        # 13c0 <freep>
+      return (void*)(p + 1);
+     e77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e7b:	48 83 c0 10          	add    $0x10,%rax
+     e7f:	eb 41                	jmp    ec2 <malloc+0x110>
+    }
+    if(p == freep)
+     e81:	48 8b 05 38 05 00 00 	mov    0x538(%rip),%rax        # 13c0 <freep>
+     e88:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e8c:	75 1c                	jne    eaa <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+     e8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     e91:	89 c7                	mov    %eax,%edi
+     e93:	e8 b5 fe ff ff       	call   d4d <morecore>
+     e98:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e9c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     ea1:	75 07                	jne    eaa <malloc+0xf8>
+        return 0;
+     ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ea8:	eb 18                	jmp    ec2 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     eaa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     eb2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eb6:	48 8b 00             	mov    (%rax),%rax
+     eb9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     ebd:	e9 54 ff ff ff       	jmp    e16 <malloc+0x64>
+  }
+}
+     ec2:	c9                   	leave
+     ec3:	c3                   	ret
+
+0000000000000ec4 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+     ec4:	55                   	push   %rbp
+     ec5:	48 89 e5             	mov    %rsp,%rbp
+     ec8:	53                   	push   %rbx
+     ec9:	48 83 ec 38          	sub    $0x38,%rsp
+     ecd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     ed0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     ed4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+     ed8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     edc:	8b 40 40             	mov    0x40(%rax),%eax
+     edf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+     ee2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     ee6:	8b 00                	mov    (%rax),%eax
+     ee8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     eeb:	29 c2                	sub    %eax,%edx
+     eed:	83 fa 20             	cmp    $0x20,%edx
+     ef0:	75 0a                	jne    efc <ring_send+0x38>
+    return -1;
+     ef2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ef7:	e9 93 00 00 00       	jmp    f8f <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+     efc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     eff:	83 e0 1f             	and    $0x1f,%eax
+     f02:	89 c2                	mov    %eax,%edx
+     f04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f08:	89 d2                	mov    %edx,%edx
+     f0a:	48 83 c2 02          	add    $0x2,%rdx
+     f0e:	48 c1 e2 06          	shl    $0x6,%rdx
+     f12:	48 01 c2             	add    %rax,%rdx
+     f15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f19:	48 8b 08             	mov    (%rax),%rcx
+     f1c:	48 8b 58 08          	mov    0x8(%rax),%rbx
+     f20:	48 89 0a             	mov    %rcx,(%rdx)
+     f23:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+     f27:	48 8b 48 10          	mov    0x10(%rax),%rcx
+     f2b:	48 8b 58 18          	mov    0x18(%rax),%rbx
+     f2f:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+     f33:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+     f37:	48 8b 48 20          	mov    0x20(%rax),%rcx
+     f3b:	48 8b 58 28          	mov    0x28(%rax),%rbx
+     f3f:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+     f43:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+     f47:	48 8b 48 30          	mov    0x30(%rax),%rcx
+     f4b:	48 8b 58 38          	mov    0x38(%rax),%rbx
+     f4f:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+     f53:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+     f57:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+     f5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f60:	8d 50 01             	lea    0x1(%rax),%edx
+     f63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f67:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+     f6a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+     f70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f74:	8b 00                	mov    (%rax),%eax
+     f76:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     f79:	75 0f                	jne    f8a <ring_send+0xc6>
+    notify(channel, 1);
+     f7b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f7e:	be 01 00 00 00       	mov    $0x1,%esi
+     f83:	89 c7                	mov    %eax,%edi
+     f85:	e8 a1 f7 ff ff       	call   72b <notify>
+  return 0;
+     f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     f93:	c9                   	leave
+     f94:	c3                   	ret
+
+0000000000000f95 <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+     f95:	55                   	push   %rbp
+     f96:	48 89 e5             	mov    %rsp,%rbp
+     f99:	53                   	push   %rbx
+     f9a:	48 83 ec 38          	sub    $0x38,%rsp
+     f9e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     fa1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     fa5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+     fa9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     fad:	8b 00                	mov    (%rax),%eax
+     faf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+     fb2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+     fb8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     fbc:	8b 40 40             	mov    0x40(%rax),%eax
+     fbf:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     fc2:	75 15                	jne    fd9 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+     fc4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fc7:	89 c7                	mov    %eax,%edi
+     fc9:	e8 67 f7 ff ff       	call   735 <nfy_wait>
+     fce:	85 c0                	test   %eax,%eax
+     fd0:	79 e0                	jns    fb2 <ring_recv+0x1d>
+      return -1;
+     fd2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fd7:	eb 73                	jmp    104c <ring_recv+0xb7>
+      break;
+     fd9:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+     fda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fdd:	83 e0 1f             	and    $0x1f,%eax
+     fe0:	89 c1                	mov    %eax,%ecx
+     fe2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     fe6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+     fea:	89 c9                	mov    %ecx,%ecx
+     fec:	48 83 c1 02          	add    $0x2,%rcx
+     ff0:	48 c1 e1 06          	shl    $0x6,%rcx
+     ff4:	48 01 ca             	add    %rcx,%rdx
+     ff7:	48 8b 0a             	mov    (%rdx),%rcx
+     ffa:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+     ffe:	48 89 08             	mov    %rcx,(%rax)
+    1001:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    1005:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    1009:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    100d:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    1011:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    1015:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    1019:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    101d:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    1021:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    1025:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    1029:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    102d:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    1031:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    1035:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    103b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    103e:	8d 50 01             	lea    0x1(%rax),%edx
+    1041:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1045:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1047:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    104c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1050:	c9                   	leave
+    1051:	c3                   	ret
+
+0000000000001052 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    1052:	55                   	push   %rbp
+    1053:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    1056:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    105b:	8b 00                	mov    (%rax),%eax
+}
+    105d:	5d                   	pop    %rbp
+    105e:	c3                   	ret
+
+000000000000105f <getpid>:
+
+int
+getpid(void)
+{
+    105f:	55                   	push   %rbp
+    1060:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    1063:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    1068:	8b 00                	mov    (%rax),%eax
+}
+    106a:	5d                   	pop    %rbp
+    106b:	c3                   	ret
+
+000000000000106c <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    106c:	55                   	push   %rbp
+    106d:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    1070:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1075:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    1079:	5d                   	pop    %rbp
+    107a:	c3                   	ret
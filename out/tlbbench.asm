@@ -0,0 +1,2008 @@
+
+fs/tlbbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <rdtscp>:
+
+static uint samples[REPS];
+
+static inline unsigned long long
+rdtscp(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  uint lo, hi;
+  asm volatile("rdtscp" : "=a" (lo), "=d" (hi) : : "rcx");
+       8:	0f 01 f9             	rdtscp
+       b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+       e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((unsigned long long)hi << 32) | lo;
+      11:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      14:	48 c1 e0 20          	shl    $0x20,%rax
+      18:	48 89 c2             	mov    %rax,%rdx
+      1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      1e:	48 09 d0             	or     %rdx,%rax
+}
+      21:	c9                   	leave
+      22:	c3                   	ret
+
+0000000000000023 <touch>:
+// Read one word in each of the n pages at a.  Successive pages are
+// read at successive cache lines so the reads do not all compete
+// for one cache set.
+static void
+touch(volatile char *a, int n)
+{
+      23:	55                   	push   %rbp
+      24:	48 89 e5             	mov    %rsp,%rbp
+      27:	48 83 ec 20          	sub    $0x20,%rsp
+      2b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+      2f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i;
+
+  for(i = 0; i < n; i++)
+      32:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      39:	eb 32                	jmp    6d <touch+0x4a>
+    (void)a[i*PGSIZE + (i%64)*64];
+      3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      3e:	c1 e0 06             	shl    $0x6,%eax
+      41:	89 c1                	mov    %eax,%ecx
+      43:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      46:	89 d0                	mov    %edx,%eax
+      48:	c1 f8 1f             	sar    $0x1f,%eax
+      4b:	c1 e8 1a             	shr    $0x1a,%eax
+      4e:	01 c2                	add    %eax,%edx
+      50:	83 e2 3f             	and    $0x3f,%edx
+      53:	29 c2                	sub    %eax,%edx
+      55:	89 d0                	mov    %edx,%eax
+      57:	01 c8                	add    %ecx,%eax
+      59:	c1 e0 06             	shl    $0x6,%eax
+      5c:	48 63 d0             	movslq %eax,%rdx
+      5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      63:	48 01 d0             	add    %rdx,%rax
+      66:	0f b6 00             	movzbl (%rax),%eax
+  for(i = 0; i < n; i++)
+      69:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      70:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+      73:	7c c6                	jl     3b <touch+0x18>
+}
+      75:	90                   	nop
+      76:	90                   	nop
+      77:	c9                   	leave
+      78:	c3                   	ret
+
+0000000000000079 <median>:
+
+static uint
+median(void)
+{
+      79:	55                   	push   %rbp
+      7a:	48 89 e5             	mov    %rsp,%rbp
+      7d:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, j;
+  uint t;
+
+  for(i = 1; i < REPS; i++){
+      81:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+      88:	eb 63                	jmp    ed <median+0x74>
+    t = samples[i];
+      8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      8d:	48 98                	cltq
+      8f:	8b 04 85 a0 16 00 00 	mov    0x16a0(,%rax,4),%eax
+      96:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    for(j = i; j > 0 && samples[j-1] > t; j--)
+      99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      9c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      9f:	eb 1f                	jmp    c0 <median+0x47>
+      samples[j] = samples[j-1];
+      a1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      a4:	83 e8 01             	sub    $0x1,%eax
+      a7:	48 98                	cltq
+      a9:	8b 14 85 a0 16 00 00 	mov    0x16a0(,%rax,4),%edx
+      b0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      b3:	48 98                	cltq
+      b5:	89 14 85 a0 16 00 00 	mov    %edx,0x16a0(,%rax,4)
+    for(j = i; j > 0 && samples[j-1] > t; j--)
+      bc:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+      c0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      c4:	7e 14                	jle    da <median+0x61>
+      c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      c9:	83 e8 01             	sub    $0x1,%eax
+      cc:	48 98                	cltq
+      ce:	8b 04 85 a0 16 00 00 	mov    0x16a0(,%rax,4),%eax
+      d5:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+      d8:	72 c7                	jb     a1 <median+0x28>
+    samples[j] = t;
+      da:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      dd:	48 98                	cltq
+      df:	8b 55 f4             	mov    -0xc(%rbp),%edx
+      e2:	89 14 85 a0 16 00 00 	mov    %edx,0x16a0(,%rax,4)
+  for(i = 1; i < REPS; i++){
+      e9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      ed:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+      f4:	7e 94                	jle    8a <median+0x11>
+  }
+  return samples[REPS/2];
+      f6:	8b 05 34 17 00 00    	mov    0x1734(%rip),%eax        # 1830 <samples+0x190>
+}
+      fc:	c9                   	leave
+      fd:	c3                   	ret
+
+00000000000000fe <measure>:
+
+static uint
+measure(char *a, int n, int mode)
+{
+      fe:	55                   	push   %rbp
+      ff:	48 89 e5             	mov    %rsp,%rbp
+     102:	48 83 ec 20          	sub    $0x20,%rsp
+     106:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     10a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+     10d:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  unsigned long long t;
+  int i;
+
+  touch(a, n);
+     110:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+     113:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     117:	89 d6                	mov    %edx,%esi
+     119:	48 89 c7             	mov    %rax,%rdi
+     11c:	e8 02 ff ff ff       	call   23 <touch>
+  for(i = 0; i < REPS; i++){
+     121:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     128:	eb 5a                	jmp    184 <measure+0x86>
+    if(mode != NONE)
+     12a:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+     12e:	74 11                	je     141 <measure+0x43>
+      cr3_switch(mode == INVALIDATE);
+     130:	83 7d e0 02          	cmpl   $0x2,-0x20(%rbp)
+     134:	0f 94 c0             	sete   %al
+     137:	0f b6 c0             	movzbl %al,%eax
+     13a:	89 c7                	mov    %eax,%edi
+     13c:	e8 69 08 00 00       	call   9aa <cr3_switch>
+    t = rdtscp();
+     141:	e8 ba fe ff ff       	call   0 <rdtscp>
+     146:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    touch(a, n);
+     14a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+     14d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     151:	89 d6                	mov    %edx,%esi
+     153:	48 89 c7             	mov    %rax,%rdi
+     156:	e8 c8 fe ff ff       	call   23 <touch>
+    samples[i] = (rdtscp() - t) / n;
+     15b:	e8 a0 fe ff ff       	call   0 <rdtscp>
+     160:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+     164:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+     167:	48 63 ca             	movslq %edx,%rcx
+     16a:	ba 00 00 00 00       	mov    $0x0,%edx
+     16f:	48 f7 f1             	div    %rcx
+     172:	89 c2                	mov    %eax,%edx
+     174:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     177:	48 98                	cltq
+     179:	89 14 85 a0 16 00 00 	mov    %edx,0x16a0(,%rax,4)
+  for(i = 0; i < REPS; i++){
+     180:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     184:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+     18b:	7e 9d                	jle    12a <measure+0x2c>
+  }
+  return median();
+     18d:	e8 e7 fe ff ff       	call   79 <median>
+}
+     192:	c9                   	leave
+     193:	c3                   	ret
+
+0000000000000194 <run>:
+
+static void
+run(char *map, int huge)
+{
+     194:	55                   	push   %rbp
+     195:	48 89 e5             	mov    %rsp,%rbp
+     198:	41 54                	push   %r12
+     19a:	53                   	push   %rbx
+     19b:	48 83 ec 30          	sub    $0x30,%rsp
+     19f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+     1a3:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  char *brk, *a;
+  int n;
+
+  brk = sbrk(0);
+     1a6:	bf 00 00 00 00       	mov    $0x0,%edi
+     1ab:	e8 25 05 00 00       	call   6d5 <sbrk>
+     1b0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  sethuge(huge);
+     1b4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     1b7:	89 c7                	mov    %eax,%edi
+     1b9:	e8 ce 07 00 00       	call   98c <sethuge>
+  sbrk(HUGESZ - (uintp)brk % HUGESZ);
+     1be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1c2:	25 ff ff 1f 00       	and    $0x1fffff,%eax
+     1c7:	ba 00 00 20 00       	mov    $0x200000,%edx
+     1cc:	29 c2                	sub    %eax,%edx
+     1ce:	89 d0                	mov    %edx,%eax
+     1d0:	89 c7                	mov    %eax,%edi
+     1d2:	e8 fe 04 00 00       	call   6d5 <sbrk>
+  a = sbrk(MAXPAGES*PGSIZE);
+     1d7:	bf 00 00 00 01       	mov    $0x1000000,%edi
+     1dc:	e8 f4 04 00 00       	call   6d5 <sbrk>
+     1e1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  sethuge(0);
+     1e5:	bf 00 00 00 00       	mov    $0x0,%edi
+     1ea:	e8 9d 07 00 00       	call   98c <sethuge>
+  if(a == (char*)-1){
+     1ef:	48 83 7d d8 ff       	cmpq   $0xffffffffffffffff,-0x28(%rbp)
+     1f4:	75 1b                	jne    211 <run+0x7d>
+    printf(1, "tlbbench: sbrk failed\n");
+     1f6:	48 c7 c6 68 12 00 00 	mov    $0x1268,%rsi
+     1fd:	bf 01 00 00 00       	mov    $0x1,%edi
+     202:	b8 00 00 00 00       	mov    $0x0,%eax
+     207:	e8 9c 08 00 00       	call   aa8 <printf>
+    exit();
+     20c:	e8 24 04 00 00       	call   635 <exit>
+  }
+  memset(a, 1, MAXPAGES*PGSIZE);
+     211:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     215:	ba 00 00 00 01       	mov    $0x1000000,%edx
+     21a:	be 01 00 00 00       	mov    $0x1,%esi
+     21f:	48 89 c7             	mov    %rax,%rdi
+     222:	e8 17 02 00 00       	call   43e <memset>
+  for(n = 1; n <= MAXPAGES; n *= 2)
+     227:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+     22e:	eb 7d                	jmp    2ad <run+0x119>
+    printf(1, "tlbbench map=%s pages=%d none=%d preserve=%d invalidate=%d\n",
+     230:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     233:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     237:	ba 02 00 00 00       	mov    $0x2,%edx
+     23c:	89 ce                	mov    %ecx,%esi
+     23e:	48 89 c7             	mov    %rax,%rdi
+     241:	e8 b8 fe ff ff       	call   fe <measure>
+     246:	89 c3                	mov    %eax,%ebx
+     248:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     24b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     24f:	ba 01 00 00 00       	mov    $0x1,%edx
+     254:	89 ce                	mov    %ecx,%esi
+     256:	48 89 c7             	mov    %rax,%rdi
+     259:	e8 a0 fe ff ff       	call   fe <measure>
+     25e:	41 89 c4             	mov    %eax,%r12d
+     261:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     264:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     268:	ba 00 00 00 00       	mov    $0x0,%edx
+     26d:	89 ce                	mov    %ecx,%esi
+     26f:	48 89 c7             	mov    %rax,%rdi
+     272:	e8 87 fe ff ff       	call   fe <measure>
+     277:	89 c1                	mov    %eax,%ecx
+     279:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     27c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     280:	48 83 ec 08          	sub    $0x8,%rsp
+     284:	53                   	push   %rbx
+     285:	45 89 e1             	mov    %r12d,%r9d
+     288:	41 89 c8             	mov    %ecx,%r8d
+     28b:	89 d1                	mov    %edx,%ecx
+     28d:	48 89 c2             	mov    %rax,%rdx
+     290:	48 c7 c6 80 12 00 00 	mov    $0x1280,%rsi
+     297:	bf 01 00 00 00       	mov    $0x1,%edi
+     29c:	b8 00 00 00 00       	mov    $0x0,%eax
+     2a1:	e8 02 08 00 00       	call   aa8 <printf>
+     2a6:	48 83 c4 10          	add    $0x10,%rsp
+  for(n = 1; n <= MAXPAGES; n *= 2)
+     2aa:	d1 65 ec             	shll   -0x14(%rbp)
+     2ad:	81 7d ec 00 10 00 00 	cmpl   $0x1000,-0x14(%rbp)
+     2b4:	0f 8e 76 ff ff ff    	jle    230 <run+0x9c>
+           map, n, measure(a, n, NONE), measure(a, n, PRESERVE),
+           measure(a, n, INVALIDATE));
+  sbrk(-(sbrk(0) - brk));
+     2ba:	bf 00 00 00 00       	mov    $0x0,%edi
+     2bf:	e8 11 04 00 00       	call   6d5 <sbrk>
+     2c4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     2c8:	48 29 c2             	sub    %rax,%rdx
+     2cb:	89 d0                	mov    %edx,%eax
+     2cd:	89 c7                	mov    %eax,%edi
+     2cf:	e8 01 04 00 00       	call   6d5 <sbrk>
+}
+     2d4:	90                   	nop
+     2d5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+     2d9:	5b                   	pop    %rbx
+     2da:	41 5c                	pop    %r12
+     2dc:	5d                   	pop    %rbp
+     2dd:	c3                   	ret
+
+00000000000002de <main>:
+
+int
+main(int argc, char *argv[])
+{
+     2de:	55                   	push   %rbp
+     2df:	48 89 e5             	mov    %rsp,%rbp
+     2e2:	48 83 ec 10          	sub    $0x10,%rsp
+     2e6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     2e9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(1, "tlbbench start\n");
+     2ed:	48 c7 c6 bc 12 00 00 	mov    $0x12bc,%rsi
+     2f4:	bf 01 00 00 00       	mov    $0x1,%edi
+     2f9:	b8 00 00 00 00       	mov    $0x0,%eax
+     2fe:	e8 a5 07 00 00       	call   aa8 <printf>
+  run("4k", 0);
+     303:	be 00 00 00 00       	mov    $0x0,%esi
+     308:	48 c7 c7 cc 12 00 00 	mov    $0x12cc,%rdi
+     30f:	e8 80 fe ff ff       	call   194 <run>
+  run("2m", 1);
+     314:	be 01 00 00 00       	mov    $0x1,%esi
+     319:	48 c7 c7 cf 12 00 00 	mov    $0x12cf,%rdi
+     320:	e8 6f fe ff ff       	call   194 <run>
+  printf(1, "tlbbench done\n");
+     325:	48 c7 c6 d2 12 00 00 	mov    $0x12d2,%rsi
+     32c:	bf 01 00 00 00       	mov    $0x1,%edi
+     331:	b8 00 00 00 00       	mov    $0x0,%eax
+     336:	e8 6d 07 00 00       	call   aa8 <printf>
+  exit();
+     33b:	e8 f5 02 00 00       	call   635 <exit>
+
+0000000000000340 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     340:	55                   	push   %rbp
+     341:	48 89 e5             	mov    %rsp,%rbp
+     344:	48 83 ec 10          	sub    $0x10,%rsp
+     348:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     34c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     34f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     352:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     356:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     359:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     35c:	48 89 ce             	mov    %rcx,%rsi
+     35f:	48 89 f7             	mov    %rsi,%rdi
+     362:	89 d1                	mov    %edx,%ecx
+     364:	fc                   	cld
+     365:	f3 aa                	rep stos %al,%es:(%rdi)
+     367:	89 ca                	mov    %ecx,%edx
+     369:	48 89 fe             	mov    %rdi,%rsi
+     36c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     370:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     373:	90                   	nop
+     374:	c9                   	leave
+     375:	c3                   	ret
+
+0000000000000376 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     376:	55                   	push   %rbp
+     377:	48 89 e5             	mov    %rsp,%rbp
+     37a:	48 83 ec 20          	sub    $0x20,%rsp
+     37e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     382:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     386:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     38a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     38e:	90                   	nop
+     38f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     393:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     397:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     39b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     39f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     3a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     3a7:	0f b6 12             	movzbl (%rdx),%edx
+     3aa:	88 10                	mov    %dl,(%rax)
+     3ac:	0f b6 00             	movzbl (%rax),%eax
+     3af:	84 c0                	test   %al,%al
+     3b1:	75 dc                	jne    38f <strcpy+0x19>
+    ;
+  return os;
+     3b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     3b7:	c9                   	leave
+     3b8:	c3                   	ret
+
+00000000000003b9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3b9:	55                   	push   %rbp
+     3ba:	48 89 e5             	mov    %rsp,%rbp
+     3bd:	48 83 ec 10          	sub    $0x10,%rsp
+     3c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     3c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     3c9:	eb 0a                	jmp    3d5 <strcmp+0x1c>
+    p++, q++;
+     3cb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     3d0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     3d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3d9:	0f b6 00             	movzbl (%rax),%eax
+     3dc:	84 c0                	test   %al,%al
+     3de:	74 12                	je     3f2 <strcmp+0x39>
+     3e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3e4:	0f b6 10             	movzbl (%rax),%edx
+     3e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3eb:	0f b6 00             	movzbl (%rax),%eax
+     3ee:	38 c2                	cmp    %al,%dl
+     3f0:	74 d9                	je     3cb <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     3f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3f6:	0f b6 00             	movzbl (%rax),%eax
+     3f9:	0f b6 d0             	movzbl %al,%edx
+     3fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     400:	0f b6 00             	movzbl (%rax),%eax
+     403:	0f b6 c0             	movzbl %al,%eax
+     406:	29 c2                	sub    %eax,%edx
+     408:	89 d0                	mov    %edx,%eax
+}
+     40a:	c9                   	leave
+     40b:	c3                   	ret
+
+000000000000040c <strlen>:
+
+uint
+strlen(char *s)
+{
+     40c:	55                   	push   %rbp
+     40d:	48 89 e5             	mov    %rsp,%rbp
+     410:	48 83 ec 18          	sub    $0x18,%rsp
+     414:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     418:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     41f:	eb 04                	jmp    425 <strlen+0x19>
+     421:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     425:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     428:	48 63 d0             	movslq %eax,%rdx
+     42b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     42f:	48 01 d0             	add    %rdx,%rax
+     432:	0f b6 00             	movzbl (%rax),%eax
+     435:	84 c0                	test   %al,%al
+     437:	75 e8                	jne    421 <strlen+0x15>
+    ;
+  return n;
+     439:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     43c:	c9                   	leave
+     43d:	c3                   	ret
+
+000000000000043e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     43e:	55                   	push   %rbp
+     43f:	48 89 e5             	mov    %rsp,%rbp
+     442:	48 83 ec 10          	sub    $0x10,%rsp
+     446:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     44a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     44d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     450:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     453:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     456:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     45a:	89 ce                	mov    %ecx,%esi
+     45c:	48 89 c7             	mov    %rax,%rdi
+     45f:	e8 dc fe ff ff       	call   340 <stosb>
+  return dst;
+     464:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     468:	c9                   	leave
+     469:	c3                   	ret
+
+000000000000046a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     46a:	55                   	push   %rbp
+     46b:	48 89 e5             	mov    %rsp,%rbp
+     46e:	48 83 ec 10          	sub    $0x10,%rsp
+     472:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     476:	89 f0                	mov    %esi,%eax
+     478:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     47b:	eb 17                	jmp    494 <strchr+0x2a>
+    if(*s == c)
+     47d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     481:	0f b6 00             	movzbl (%rax),%eax
+     484:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     487:	75 06                	jne    48f <strchr+0x25>
+      return (char*)s;
+     489:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     48d:	eb 15                	jmp    4a4 <strchr+0x3a>
+  for(; *s; s++)
+     48f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     494:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     498:	0f b6 00             	movzbl (%rax),%eax
+     49b:	84 c0                	test   %al,%al
+     49d:	75 de                	jne    47d <strchr+0x13>
+  return 0;
+     49f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     4a4:	c9                   	leave
+     4a5:	c3                   	ret
+
+00000000000004a6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4a6:	55                   	push   %rbp
+     4a7:	48 89 e5             	mov    %rsp,%rbp
+     4aa:	48 83 ec 20          	sub    $0x20,%rsp
+     4ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     4b2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     4b5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     4bc:	eb 48                	jmp    506 <gets+0x60>
+    cc = read(0, &c, 1);
+     4be:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     4c2:	ba 01 00 00 00       	mov    $0x1,%edx
+     4c7:	48 89 c6             	mov    %rax,%rsi
+     4ca:	bf 00 00 00 00       	mov    $0x0,%edi
+     4cf:	e8 7f 01 00 00       	call   653 <read>
+     4d4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     4d7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     4db:	7e 36                	jle    513 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     4dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4e0:	8d 50 01             	lea    0x1(%rax),%edx
+     4e3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     4e6:	48 63 d0             	movslq %eax,%rdx
+     4e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     4ed:	48 01 c2             	add    %rax,%rdx
+     4f0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     4f4:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     4f6:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     4fa:	3c 0a                	cmp    $0xa,%al
+     4fc:	74 16                	je     514 <gets+0x6e>
+     4fe:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     502:	3c 0d                	cmp    $0xd,%al
+     504:	74 0e                	je     514 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     506:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     509:	83 c0 01             	add    $0x1,%eax
+     50c:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     50f:	7f ad                	jg     4be <gets+0x18>
+     511:	eb 01                	jmp    514 <gets+0x6e>
+      break;
+     513:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     514:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     517:	48 63 d0             	movslq %eax,%rdx
+     51a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     51e:	48 01 d0             	add    %rdx,%rax
+     521:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     524:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     528:	c9                   	leave
+     529:	c3                   	ret
+
+000000000000052a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     52a:	55                   	push   %rbp
+     52b:	48 89 e5             	mov    %rsp,%rbp
+     52e:	48 83 ec 20          	sub    $0x20,%rsp
+     532:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     536:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     53a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     53e:	be 00 00 00 00       	mov    $0x0,%esi
+     543:	48 89 c7             	mov    %rax,%rdi
+     546:	e8 3a 01 00 00       	call   685 <open>
+     54b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     54e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     552:	79 07                	jns    55b <stat+0x31>
+    return -1;
+     554:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     559:	eb 21                	jmp    57c <stat+0x52>
+  r = fstat(fd, st);
+     55b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     55f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     562:	48 89 d6             	mov    %rdx,%rsi
+     565:	89 c7                	mov    %eax,%edi
+     567:	e8 37 01 00 00       	call   6a3 <fstat>
+     56c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     56f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     572:	89 c7                	mov    %eax,%edi
+     574:	e8 ee 00 00 00       	call   667 <close>
+  return r;
+     579:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     57c:	c9                   	leave
+     57d:	c3                   	ret
+
+000000000000057e <atoi>:
+
+int
+atoi(const char *s)
+{
+     57e:	55                   	push   %rbp
+     57f:	48 89 e5             	mov    %rsp,%rbp
+     582:	48 83 ec 18          	sub    $0x18,%rsp
+     586:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     58a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     591:	eb 28                	jmp    5bb <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     593:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     596:	89 d0                	mov    %edx,%eax
+     598:	c1 e0 02             	shl    $0x2,%eax
+     59b:	01 d0                	add    %edx,%eax
+     59d:	01 c0                	add    %eax,%eax
+     59f:	89 c1                	mov    %eax,%ecx
+     5a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     5a5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     5a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     5ad:	0f b6 00             	movzbl (%rax),%eax
+     5b0:	0f be c0             	movsbl %al,%eax
+     5b3:	01 c8                	add    %ecx,%eax
+     5b5:	83 e8 30             	sub    $0x30,%eax
+     5b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     5bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     5bf:	0f b6 00             	movzbl (%rax),%eax
+     5c2:	3c 2f                	cmp    $0x2f,%al
+     5c4:	7e 0b                	jle    5d1 <atoi+0x53>
+     5c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     5ca:	0f b6 00             	movzbl (%rax),%eax
+     5cd:	3c 39                	cmp    $0x39,%al
+     5cf:	7e c2                	jle    593 <atoi+0x15>
+  return n;
+     5d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     5d4:	c9                   	leave
+     5d5:	c3                   	ret
+
+00000000000005d6 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     5d6:	55                   	push   %rbp
+     5d7:	48 89 e5             	mov    %rsp,%rbp
+     5da:	48 83 ec 28          	sub    $0x28,%rsp
+     5de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     5e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     5e6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     5e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     5ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     5f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     5f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     5f9:	eb 1d                	jmp    618 <memmove+0x42>
+    *dst++ = *src++;
+     5fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     5ff:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     603:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     607:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     60b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     60f:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     613:	0f b6 12             	movzbl (%rdx),%edx
+     616:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     618:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     61b:	8d 50 ff             	lea    -0x1(%rax),%edx
+     61e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     621:	85 c0                	test   %eax,%eax
+     623:	7f d6                	jg     5fb <memmove+0x25>
+  return vdst;
+     625:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     629:	c9                   	leave
+     62a:	c3                   	ret
+
+000000000000062b <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     62b:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     632:	cd 40                	int    $0x40
+     634:	c3                   	ret
+
+0000000000000635 <exit>:
+SYSCALL_FAST(exit)
+     635:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     63c:	0f 05                	syscall
+     63e:	c3                   	ret
+
+000000000000063f <wait>:
+SYSCALL_FAST(wait)
+     63f:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     646:	0f 05                	syscall
+     648:	c3                   	ret
+
+0000000000000649 <pipe>:
+SYSCALL_FAST(pipe)
+     649:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     650:	0f 05                	syscall
+     652:	c3                   	ret
+
+0000000000000653 <read>:
+SYSCALL_FAST(read)
+     653:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     65a:	0f 05                	syscall
+     65c:	c3                   	ret
+
+000000000000065d <write>:
+SYSCALL_FAST(write)
+     65d:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     664:	0f 05                	syscall
+     666:	c3                   	ret
+
+0000000000000667 <close>:
+SYSCALL_FAST(close)
+     667:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     66e:	0f 05                	syscall
+     670:	c3                   	ret
+
+0000000000000671 <kill>:
+SYSCALL_FAST(kill)
+     671:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     678:	0f 05                	syscall
+     67a:	c3                   	ret
+
+000000000000067b <exec>:
+SYSCALL(exec)
+     67b:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     682:	cd 40                	int    $0x40
+     684:	c3                   	ret
+
+0000000000000685 <open>:
+SYSCALL_FAST(open)
+     685:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     68c:	0f 05                	syscall
+     68e:	c3                   	ret
+
+000000000000068f <mknod>:
+SYSCALL_FAST(mknod)
+     68f:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     696:	0f 05                	syscall
+     698:	c3                   	ret
+
+0000000000000699 <unlink>:
+SYSCALL_FAST(unlink)
+     699:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     6a0:	0f 05                	syscall
+     6a2:	c3                   	ret
+
+00000000000006a3 <fstat>:
+SYSCALL_FAST(fstat)
+     6a3:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     6aa:	0f 05                	syscall
+     6ac:	c3                   	ret
+
+00000000000006ad <link>:
+SYSCALL_FAST(link)
+     6ad:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     6b4:	0f 05                	syscall
+     6b6:	c3                   	ret
+
+00000000000006b7 <mkdir>:
+SYSCALL_FAST(mkdir)
+     6b7:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     6be:	0f 05                	syscall
+     6c0:	c3                   	ret
+
+00000000000006c1 <chdir>:
+SYSCALL_FAST(chdir)
+     6c1:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     6c8:	0f 05                	syscall
+     6ca:	c3                   	ret
+
+00000000000006cb <dup>:
+SYSCALL_FAST(dup)
+     6cb:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     6d2:	0f 05                	syscall
+     6d4:	c3                   	ret
+
+00000000000006d5 <sbrk>:
+SYSCALL_FAST(sbrk)
+     6d5:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     6dc:	0f 05                	syscall
+     6de:	c3                   	ret
+
+00000000000006df <sleep>:
+SYSCALL_FAST(sleep)
+     6df:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     6e6:	0f 05                	syscall
+     6e8:	c3                   	ret
+
+00000000000006e9 <send>:
+SYSCALL_FAST(send)
+     6e9:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     6f0:	0f 05                	syscall
+     6f2:	c3                   	ret
+
+00000000000006f3 <send_recv>:
+SYSCALL_FAST(send_recv)
+     6f3:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     6fa:	0f 05                	syscall
+     6fc:	c3                   	ret
+
+00000000000006fd <recv>:
+SYSCALL_FAST(recv)
+     6fd:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     704:	0f 05                	syscall
+     706:	c3                   	ret
+
+0000000000000707 <call>:
+SYSCALL_FAST(call)
+     707:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     70e:	0f 05                	syscall
+     710:	c3                   	ret
+
+0000000000000711 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     711:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     718:	0f 05                	syscall
+     71a:	c3                   	ret
+
+000000000000071b <send_reg>:
+SYSCALL_REG(send_reg)
+     71b:	41 54                	push   %r12
+     71d:	41 55                	push   %r13
+     71f:	41 56                	push   %r14
+     721:	41 57                	push   %r15
+     723:	56                   	push   %rsi
+     724:	49 89 f3             	mov    %rsi,%r11
+     727:	48 89 d6             	mov    %rdx,%rsi
+     72a:	49 8b 13             	mov    (%r11),%rdx
+     72d:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     731:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     735:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     739:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     73d:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     741:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     745:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     749:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     750:	0f 05                	syscall
+     752:	41 5b                	pop    %r11
+     754:	49 89 13             	mov    %rdx,(%r11)
+     757:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     75b:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     75f:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     763:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     767:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     76b:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     76f:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     773:	41 5f                	pop    %r15
+     775:	41 5e                	pop    %r14
+     777:	41 5d                	pop    %r13
+     779:	41 5c                	pop    %r12
+     77b:	c3                   	ret
+
+000000000000077c <recv_reg>:
+SYSCALL_REG(recv_reg)
+     77c:	41 54                	push   %r12
+     77e:	41 55                	push   %r13
+     780:	41 56                	push   %r14
+     782:	41 57                	push   %r15
+     784:	56                   	push   %rsi
+     785:	49 89 f3             	mov    %rsi,%r11
+     788:	48 89 d6             	mov    %rdx,%rsi
+     78b:	49 8b 13             	mov    (%r11),%rdx
+     78e:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     792:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     796:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     79a:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     79e:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     7a2:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     7a6:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     7aa:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+     7b1:	0f 05                	syscall
+     7b3:	41 5b                	pop    %r11
+     7b5:	49 89 13             	mov    %rdx,(%r11)
+     7b8:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     7bc:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     7c0:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     7c4:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     7c8:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     7cc:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     7d0:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     7d4:	41 5f                	pop    %r15
+     7d6:	41 5e                	pop    %r14
+     7d8:	41 5d                	pop    %r13
+     7da:	41 5c                	pop    %r12
+     7dc:	c3                   	ret
+
+00000000000007dd <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+     7dd:	41 54                	push   %r12
+     7df:	41 55                	push   %r13
+     7e1:	41 56                	push   %r14
+     7e3:	41 57                	push   %r15
+     7e5:	56                   	push   %rsi
+     7e6:	49 89 f3             	mov    %rsi,%r11
+     7e9:	48 89 d6             	mov    %rdx,%rsi
+     7ec:	49 8b 13             	mov    (%r11),%rdx
+     7ef:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     7f3:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     7f7:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     7fb:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     7ff:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     803:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     807:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     80b:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+     812:	0f 05                	syscall
+     814:	41 5b                	pop    %r11
+     816:	49 89 13             	mov    %rdx,(%r11)
+     819:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     81d:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     821:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     825:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     829:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     82d:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     831:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     835:	41 5f                	pop    %r15
+     837:	41 5e                	pop    %r14
+     839:	41 5d                	pop    %r13
+     83b:	41 5c                	pop    %r12
+     83d:	c3                   	ret
+
+000000000000083e <call_reg>:
+SYSCALL_REG(call_reg)
+     83e:	41 54                	push   %r12
+     840:	41 55                	push   %r13
+     842:	41 56                	push   %r14
+     844:	41 57                	push   %r15
+     846:	56                   	push   %rsi
+     847:	49 89 f3             	mov    %rsi,%r11
+     84a:	48 89 d6             	mov    %rdx,%rsi
+     84d:	49 8b 13             	mov    (%r11),%rdx
+     850:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     854:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     858:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     85c:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     860:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     864:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     868:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     86c:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+     873:	0f 05                	syscall
+     875:	41 5b                	pop    %r11
+     877:	49 89 13             	mov    %rdx,(%r11)
+     87a:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     87e:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     882:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     886:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     88a:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     88e:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     892:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     896:	41 5f                	pop    %r15
+     898:	41 5e                	pop    %r14
+     89a:	41 5d                	pop    %r13
+     89c:	41 5c                	pop    %r12
+     89e:	c3                   	ret
+
+000000000000089f <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+     89f:	41 54                	push   %r12
+     8a1:	41 55                	push   %r13
+     8a3:	41 56                	push   %r14
+     8a5:	41 57                	push   %r15
+     8a7:	56                   	push   %rsi
+     8a8:	49 89 f3             	mov    %rsi,%r11
+     8ab:	48 89 d6             	mov    %rdx,%rsi
+     8ae:	49 8b 13             	mov    (%r11),%rdx
+     8b1:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     8b5:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     8b9:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     8bd:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     8c1:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     8c5:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     8c9:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     8cd:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+     8d4:	0f 05                	syscall
+     8d6:	41 5b                	pop    %r11
+     8d8:	49 89 13             	mov    %rdx,(%r11)
+     8db:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     8df:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     8e3:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     8e7:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     8eb:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     8ef:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     8f3:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     8f7:	41 5f                	pop    %r15
+     8f9:	41 5e                	pop    %r14
+     8fb:	41 5d                	pop    %r13
+     8fd:	41 5c                	pop    %r12
+     8ff:	c3                   	ret
+
+0000000000000900 <sendx>:
+SYSCALL_FAST(sendx)
+     900:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+     907:	0f 05                	syscall
+     909:	c3                   	ret
+
+000000000000090a <ring_attach>:
+SYSCALL_FAST(ring_attach)
+     90a:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+     911:	0f 05                	syscall
+     913:	c3                   	ret
+
+0000000000000914 <notify>:
+SYSCALL_FAST(notify)
+     914:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+     91b:	0f 05                	syscall
+     91d:	c3                   	ret
+
+000000000000091e <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+     91e:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+     925:	0f 05                	syscall
+     927:	c3                   	ret
+
+0000000000000928 <send_timed>:
+SYSCALL_FAST(send_timed)
+     928:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+     92f:	0f 05                	syscall
+     931:	c3                   	ret
+
+0000000000000932 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+     932:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+     939:	0f 05                	syscall
+     93b:	c3                   	ret
+
+000000000000093c <set_add>:
+SYSCALL_FAST(set_add)
+     93c:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+     943:	0f 05                	syscall
+     945:	c3                   	ret
+
+0000000000000946 <set_del>:
+SYSCALL_FAST(set_del)
+     946:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+     94d:	0f 05                	syscall
+     94f:	c3                   	ret
+
+0000000000000950 <recv_any>:
+SYSCALL_FAST(recv_any)
+     950:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+     957:	0f 05                	syscall
+     959:	c3                   	ret
+
+000000000000095a <ep_create>:
+SYSCALL_FAST(ep_create)
+     95a:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+     961:	0f 05                	syscall
+     963:	c3                   	ret
+
+0000000000000964 <ep_close>:
+SYSCALL_FAST(ep_close)
+     964:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+     96b:	0f 05                	syscall
+     96d:	c3                   	ret
+
+000000000000096e <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+     96e:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+     975:	0f 05                	syscall
+     977:	c3                   	ret
+
+0000000000000978 <setprio>:
+SYSCALL_FAST(setprio)
+     978:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+     97f:	0f 05                	syscall
+     981:	c3                   	ret
+
+0000000000000982 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+     982:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+     989:	0f 05                	syscall
+     98b:	c3                   	ret
+
+000000000000098c <sethuge>:
+SYSCALL_FAST(sethuge)
+     98c:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+     993:	0f 05                	syscall
+     995:	c3                   	ret
+
+0000000000000996 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+     996:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+     99d:	0f 05                	syscall
+     99f:	c3                   	ret
+
+00000000000009a0 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+     9a0:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+     9a7:	0f 05                	syscall
+     9a9:	c3                   	ret
+
+00000000000009aa <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+     9aa:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+     9b1:	0f 05                	syscall
+     9b3:	c3                   	ret
+
+00000000000009b4 <null_call>:
+     9b4:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+     9bb:	0f 05                	syscall
+     9bd:	c3                   	ret
+
+00000000000009be <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     9be:	55                   	push   %rbp
+     9bf:	48 89 e5             	mov    %rsp,%rbp
+     9c2:	48 83 ec 10          	sub    $0x10,%rsp
+     9c6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     9c9:	89 f0                	mov    %esi,%eax
+     9cb:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     9ce:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     9d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9d5:	ba 01 00 00 00       	mov    $0x1,%edx
+     9da:	48 89 ce             	mov    %rcx,%rsi
+     9dd:	89 c7                	mov    %eax,%edi
+     9df:	e8 79 fc ff ff       	call   65d <write>
+}
+     9e4:	90                   	nop
+     9e5:	c9                   	leave
+     9e6:	c3                   	ret
+
+00000000000009e7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     9e7:	55                   	push   %rbp
+     9e8:	48 89 e5             	mov    %rsp,%rbp
+     9eb:	48 83 ec 30          	sub    $0x30,%rsp
+     9ef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     9f2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     9f5:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     9f8:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     9fb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     a02:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     a06:	74 17                	je     a1f <printint+0x38>
+     a08:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     a0c:	79 11                	jns    a1f <printint+0x38>
+    neg = 1;
+     a0e:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     a15:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a18:	f7 d8                	neg    %eax
+     a1a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     a1d:	eb 06                	jmp    a25 <printint+0x3e>
+  } else {
+    x = xx;
+     a1f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a22:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     a25:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     a2c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     a2f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a32:	ba 00 00 00 00       	mov    $0x0,%edx
+     a37:	f7 f1                	div    %ecx
+     a39:	89 d1                	mov    %edx,%ecx
+     a3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a3e:	8d 50 01             	lea    0x1(%rax),%edx
+     a41:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     a44:	89 ca                	mov    %ecx,%edx
+     a46:	0f b6 92 70 16 00 00 	movzbl 0x1670(%rdx),%edx
+     a4d:	48 98                	cltq
+     a4f:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     a53:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     a56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a59:	ba 00 00 00 00       	mov    $0x0,%edx
+     a5e:	f7 f6                	div    %esi
+     a60:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     a63:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     a67:	75 c3                	jne    a2c <printint+0x45>
+  if(neg)
+     a69:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     a6d:	74 2b                	je     a9a <printint+0xb3>
+    buf[i++] = '-';
+     a6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a72:	8d 50 01             	lea    0x1(%rax),%edx
+     a75:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     a78:	48 98                	cltq
+     a7a:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+     a7f:	eb 19                	jmp    a9a <printint+0xb3>
+    putc(fd, buf[i]);
+     a81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a84:	48 98                	cltq
+     a86:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+     a8b:	0f be d0             	movsbl %al,%edx
+     a8e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a91:	89 d6                	mov    %edx,%esi
+     a93:	89 c7                	mov    %eax,%edi
+     a95:	e8 24 ff ff ff       	call   9be <putc>
+  while(--i >= 0)
+     a9a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     a9e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     aa2:	79 dd                	jns    a81 <printint+0x9a>
+}
+     aa4:	90                   	nop
+     aa5:	90                   	nop
+     aa6:	c9                   	leave
+     aa7:	c3                   	ret
+
+0000000000000aa8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     aa8:	55                   	push   %rbp
+     aa9:	48 89 e5             	mov    %rsp,%rbp
+     aac:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+     ab3:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+     ab9:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+     ac0:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+     ac7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+     ace:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+     ad5:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+     adc:	84 c0                	test   %al,%al
+     ade:	74 20                	je     b00 <printf+0x58>
+     ae0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+     ae4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+     ae8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+     aec:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+     af0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+     af4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+     af8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+     afc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+     b00:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+     b07:	00 00 00 
+     b0a:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+     b11:	00 00 00 
+     b14:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     b18:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+     b1f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+     b26:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+     b2d:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     b34:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     b37:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+     b3e:	00 00 00 
+     b41:	e9 a8 02 00 00       	jmp    dee <printf+0x346>
+    c = fmt[i] & 0xff;
+     b46:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     b4c:	48 63 d0             	movslq %eax,%rdx
+     b4f:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     b56:	48 01 d0             	add    %rdx,%rax
+     b59:	0f b6 00             	movzbl (%rax),%eax
+     b5c:	0f be c0             	movsbl %al,%eax
+     b5f:	25 ff 00 00 00       	and    $0xff,%eax
+     b64:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+     b6a:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+     b71:	75 35                	jne    ba8 <printf+0x100>
+      if(c == '%'){
+     b73:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     b7a:	75 0f                	jne    b8b <printf+0xe3>
+        state = '%';
+     b7c:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+     b83:	00 00 00 
+     b86:	e9 5c 02 00 00       	jmp    de7 <printf+0x33f>
+      } else {
+        putc(fd, c);
+     b8b:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     b91:	0f be d0             	movsbl %al,%edx
+     b94:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b9a:	89 d6                	mov    %edx,%esi
+     b9c:	89 c7                	mov    %eax,%edi
+     b9e:	e8 1b fe ff ff       	call   9be <putc>
+     ba3:	e9 3f 02 00 00       	jmp    de7 <printf+0x33f>
+      }
+    } else if(state == '%'){
+     ba8:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+     baf:	0f 85 32 02 00 00    	jne    de7 <printf+0x33f>
+      if(c == 'd'){
+     bb5:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+     bbc:	75 5e                	jne    c1c <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+     bbe:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     bc4:	83 f8 2f             	cmp    $0x2f,%eax
+     bc7:	77 23                	ja     bec <printf+0x144>
+     bc9:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     bd0:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     bd6:	89 d2                	mov    %edx,%edx
+     bd8:	48 01 d0             	add    %rdx,%rax
+     bdb:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     be1:	83 c2 08             	add    $0x8,%edx
+     be4:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     bea:	eb 12                	jmp    bfe <printf+0x156>
+     bec:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     bf3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     bf7:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     bfe:	8b 30                	mov    (%rax),%esi
+     c00:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c06:	b9 01 00 00 00       	mov    $0x1,%ecx
+     c0b:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c10:	89 c7                	mov    %eax,%edi
+     c12:	e8 d0 fd ff ff       	call   9e7 <printint>
+     c17:	e9 c1 01 00 00       	jmp    ddd <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+     c1c:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+     c23:	74 09                	je     c2e <printf+0x186>
+     c25:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+     c2c:	75 5e                	jne    c8c <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+     c2e:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     c34:	83 f8 2f             	cmp    $0x2f,%eax
+     c37:	77 23                	ja     c5c <printf+0x1b4>
+     c39:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     c40:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c46:	89 d2                	mov    %edx,%edx
+     c48:	48 01 d0             	add    %rdx,%rax
+     c4b:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c51:	83 c2 08             	add    $0x8,%edx
+     c54:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     c5a:	eb 12                	jmp    c6e <printf+0x1c6>
+     c5c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     c63:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c67:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     c6e:	8b 30                	mov    (%rax),%esi
+     c70:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c76:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c7b:	ba 10 00 00 00       	mov    $0x10,%edx
+     c80:	89 c7                	mov    %eax,%edi
+     c82:	e8 60 fd ff ff       	call   9e7 <printint>
+     c87:	e9 51 01 00 00       	jmp    ddd <printf+0x335>
+      } else if(c == 's'){
+     c8c:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+     c93:	0f 85 98 00 00 00    	jne    d31 <printf+0x289>
+        s = va_arg(ap, char*);
+     c99:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     c9f:	83 f8 2f             	cmp    $0x2f,%eax
+     ca2:	77 23                	ja     cc7 <printf+0x21f>
+     ca4:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     cab:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     cb1:	89 d2                	mov    %edx,%edx
+     cb3:	48 01 d0             	add    %rdx,%rax
+     cb6:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     cbc:	83 c2 08             	add    $0x8,%edx
+     cbf:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     cc5:	eb 12                	jmp    cd9 <printf+0x231>
+     cc7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     cce:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     cd2:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     cd9:	48 8b 00             	mov    (%rax),%rax
+     cdc:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+     ce3:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+     cea:	00 
+     ceb:	75 31                	jne    d1e <printf+0x276>
+          s = "(null)";
+     ced:	48 c7 85 48 ff ff ff 	movq   $0x12e1,-0xb8(%rbp)
+     cf4:	e1 12 00 00 
+        while(*s != 0){
+     cf8:	eb 24                	jmp    d1e <printf+0x276>
+          putc(fd, *s);
+     cfa:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     d01:	0f b6 00             	movzbl (%rax),%eax
+     d04:	0f be d0             	movsbl %al,%edx
+     d07:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     d0d:	89 d6                	mov    %edx,%esi
+     d0f:	89 c7                	mov    %eax,%edi
+     d11:	e8 a8 fc ff ff       	call   9be <putc>
+          s++;
+     d16:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+     d1d:	01 
+        while(*s != 0){
+     d1e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     d25:	0f b6 00             	movzbl (%rax),%eax
+     d28:	84 c0                	test   %al,%al
+     d2a:	75 ce                	jne    cfa <printf+0x252>
+     d2c:	e9 ac 00 00 00       	jmp    ddd <printf+0x335>
+        }
+      } else if(c == 'c'){
+     d31:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+     d38:	75 56                	jne    d90 <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+     d3a:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     d40:	83 f8 2f             	cmp    $0x2f,%eax
+     d43:	77 23                	ja     d68 <printf+0x2c0>
+     d45:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     d4c:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     d52:	89 d2                	mov    %edx,%edx
+     d54:	48 01 d0             	add    %rdx,%rax
+     d57:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     d5d:	83 c2 08             	add    $0x8,%edx
+     d60:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     d66:	eb 12                	jmp    d7a <printf+0x2d2>
+     d68:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     d6f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     d73:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     d7a:	8b 00                	mov    (%rax),%eax
+     d7c:	0f be d0             	movsbl %al,%edx
+     d7f:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     d85:	89 d6                	mov    %edx,%esi
+     d87:	89 c7                	mov    %eax,%edi
+     d89:	e8 30 fc ff ff       	call   9be <putc>
+     d8e:	eb 4d                	jmp    ddd <printf+0x335>
+      } else if(c == '%'){
+     d90:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     d97:	75 1a                	jne    db3 <printf+0x30b>
+        putc(fd, c);
+     d99:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     d9f:	0f be d0             	movsbl %al,%edx
+     da2:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     da8:	89 d6                	mov    %edx,%esi
+     daa:	89 c7                	mov    %eax,%edi
+     dac:	e8 0d fc ff ff       	call   9be <putc>
+     db1:	eb 2a                	jmp    ddd <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     db3:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     db9:	be 25 00 00 00       	mov    $0x25,%esi
+     dbe:	89 c7                	mov    %eax,%edi
+     dc0:	e8 f9 fb ff ff       	call   9be <putc>
+        putc(fd, c);
+     dc5:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     dcb:	0f be d0             	movsbl %al,%edx
+     dce:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     dd4:	89 d6                	mov    %edx,%esi
+     dd6:	89 c7                	mov    %eax,%edi
+     dd8:	e8 e1 fb ff ff       	call   9be <putc>
+      }
+      state = 0;
+     ddd:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     de4:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     de7:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+     dee:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     df4:	48 63 d0             	movslq %eax,%rdx
+     df7:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     dfe:	48 01 d0             	add    %rdx,%rax
+     e01:	0f b6 00             	movzbl (%rax),%eax
+     e04:	84 c0                	test   %al,%al
+     e06:	0f 85 3a fd ff ff    	jne    b46 <printf+0x9e>
+    }
+  }
+}
+     e0c:	90                   	nop
+     e0d:	90                   	nop
+     e0e:	c9                   	leave
+     e0f:	c3                   	ret
+
+0000000000000e10 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e10:	55                   	push   %rbp
+     e11:	48 89 e5             	mov    %rsp,%rbp
+     e14:	48 83 ec 18          	sub    $0x18,%rsp
+     e18:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e20:	48 83 e8 10          	sub    $0x10,%rax
+     e24:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e28:	48 8b 05 a1 0b 00 00 	mov    0xba1(%rip),%rax        # 19d0 <freep>
+     e2f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e33:	eb 2f                	jmp    e64 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e39:	48 8b 00             	mov    (%rax),%rax
+     e3c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e40:	72 17                	jb     e59 <free+0x49>
+     e42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e46:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e4a:	72 2f                	jb     e7b <free+0x6b>
+     e4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e50:	48 8b 00             	mov    (%rax),%rax
+     e53:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     e57:	72 22                	jb     e7b <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e5d:	48 8b 00             	mov    (%rax),%rax
+     e60:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e68:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e6c:	73 c7                	jae    e35 <free+0x25>
+     e6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e72:	48 8b 00             	mov    (%rax),%rax
+     e75:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     e79:	73 ba                	jae    e35 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e7f:	8b 40 08             	mov    0x8(%rax),%eax
+     e82:	89 c0                	mov    %eax,%eax
+     e84:	48 c1 e0 04          	shl    $0x4,%rax
+     e88:	48 89 c2             	mov    %rax,%rdx
+     e8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e8f:	48 01 c2             	add    %rax,%rdx
+     e92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e96:	48 8b 00             	mov    (%rax),%rax
+     e99:	48 39 c2             	cmp    %rax,%rdx
+     e9c:	75 2d                	jne    ecb <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+     e9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ea2:	8b 50 08             	mov    0x8(%rax),%edx
+     ea5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ea9:	48 8b 00             	mov    (%rax),%rax
+     eac:	8b 40 08             	mov    0x8(%rax),%eax
+     eaf:	01 c2                	add    %eax,%edx
+     eb1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     eb5:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     eb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ebc:	48 8b 00             	mov    (%rax),%rax
+     ebf:	48 8b 10             	mov    (%rax),%rdx
+     ec2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ec6:	48 89 10             	mov    %rdx,(%rax)
+     ec9:	eb 0e                	jmp    ed9 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+     ecb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ecf:	48 8b 10             	mov    (%rax),%rdx
+     ed2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ed6:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     ed9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     edd:	8b 40 08             	mov    0x8(%rax),%eax
+     ee0:	89 c0                	mov    %eax,%eax
+     ee2:	48 c1 e0 04          	shl    $0x4,%rax
+     ee6:	48 89 c2             	mov    %rax,%rdx
+     ee9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eed:	48 01 d0             	add    %rdx,%rax
+     ef0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     ef4:	75 27                	jne    f1d <free+0x10d>
+    p->s.size += bp->s.size;
+     ef6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     efa:	8b 50 08             	mov    0x8(%rax),%edx
+     efd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f01:	8b 40 08             	mov    0x8(%rax),%eax
+     f04:	01 c2                	add    %eax,%edx
+     f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f0a:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     f0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f11:	48 8b 10             	mov    (%rax),%rdx
+     f14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f18:	48 89 10             	mov    %rdx,(%rax)
+     f1b:	eb 0b                	jmp    f28 <free+0x118>
+  } else
+    p->s.ptr = bp;
+     f1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f21:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f25:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     f28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f2c:	48 89 05 9d 0a 00 00 	mov    %rax,0xa9d(%rip)        # 19d0 <freep>
+}
+     f33:	90                   	nop
+     f34:	c9                   	leave
+     f35:	c3                   	ret
+
+0000000000000f36 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     f36:	55                   	push   %rbp
+     f37:	48 89 e5             	mov    %rsp,%rbp
+     f3a:	48 83 ec 20          	sub    $0x20,%rsp
+     f3e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     f41:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     f48:	77 07                	ja     f51 <morecore+0x1b>
+    nu = 4096;
+     f4a:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     f51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f54:	c1 e0 04             	shl    $0x4,%eax
+     f57:	89 c7                	mov    %eax,%edi
+     f59:	e8 77 f7 ff ff       	call   6d5 <sbrk>
+     f5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     f62:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     f67:	75 07                	jne    f70 <morecore+0x3a>
+    return 0;
+     f69:	b8 00 00 00 00       	mov    $0x0,%eax
+     f6e:	eb 29                	jmp    f99 <morecore+0x63>
+  hp = (Header*)p;
+     f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f74:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     f78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f7c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     f7f:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     f82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f86:	48 83 c0 10          	add    $0x10,%rax
+     f8a:	48 89 c7             	mov    %rax,%rdi
+     f8d:	e8 7e fe ff ff       	call   e10 <free>
+  return freep;
+     f92:	48 8b 05 37 0a 00 00 	mov    0xa37(%rip),%rax        # 19d0 <freep>
+}
+     f99:	c9                   	leave
+     f9a:	c3                   	ret
+
+0000000000000f9b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f9b:	55                   	push   %rbp
+     f9c:	48 89 e5             	mov    %rsp,%rbp
+     f9f:	48 83 ec 30          	sub    $0x30,%rsp
+     fa3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fa6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fa9:	48 83 c0 0f          	add    $0xf,%rax
+     fad:	48 c1 e8 04          	shr    $0x4,%rax
+     fb1:	83 c0 01             	add    $0x1,%eax
+     fb4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+     fb7:	48 8b 05 12 0a 00 00 	mov    0xa12(%rip),%rax        # 19d0 <freep>
+     fbe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     fc2:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     fc7:	75 2b                	jne    ff4 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+     fc9:	48 c7 45 f0 c0 19 00 	movq   $0x19c0,-0x10(%rbp)
+     fd0:	00 
+     fd1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fd5:	48 89 05 f4 09 00 00 	mov    %rax,0x9f4(%rip)        # 19d0 <freep>
+     fdc:	48 8b 05 ed 09 00 00 	mov    0x9ed(%rip),%rax        # 19d0 <freep>
+     fe3:	48 89 05 d6 09 00 00 	mov    %rax,0x9d6(%rip)        # 19c0 <base>
+    base.s.size = 0;
+     fea:	c7 05 d4 09 00 00 00 	movl   $0x0,0x9d4(%rip)        # 19c8 <base+0x8>
+     ff1:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ff4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ff8:	48 8b 00             	mov    (%rax),%rax
+     ffb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     fff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1003:	8b 40 08             	mov    0x8(%rax),%eax
+    1006:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1009:	72 5f                	jb     106a <malloc+0xcf>
+      if(p->s.size == nunits)
+    100b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    100f:	8b 40 08             	mov    0x8(%rax),%eax
+    1012:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1015:	75 10                	jne    1027 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+    1017:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    101b:	48 8b 10             	mov    (%rax),%rdx
+    101e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1022:	48 89 10             	mov    %rdx,(%rax)
+    1025:	eb 2e                	jmp    1055 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+    1027:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    102b:	8b 40 08             	mov    0x8(%rax),%eax
+    102e:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1031:	89 c2                	mov    %eax,%edx
+    1033:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1037:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    103a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    103e:	8b 40 08             	mov    0x8(%rax),%eax
+    1041:	89 c0                	mov    %eax,%eax
+    1043:	48 c1 e0 04          	shl    $0x4,%rax
+    1047:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    104b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    104f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1052:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1055:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1059:	48 89 05 70 09 00 00 	mov    %rax,0x970(%rip)        # 19d0 <freep>
+      return (void*)(p + 1);
+    1060:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1064:	48 83 c0 10          	add    $0x10,%rax
+    1068:	eb 41                	jmp    10ab <malloc+0x110>
+    }
+    if(p == freep)
+    106a:	48 8b 05 5f 09 00 00 	mov    0x95f(%rip),%rax        # 19d0 <freep>
+    1071:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1075:	75 1c                	jne    1093 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+    1077:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    107a:	89 c7                	mov    %eax,%edi
+    107c:	e8 b5 fe ff ff       	call   f36 <morecore>
+    1081:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1085:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    108a:	75 07                	jne    1093 <malloc+0xf8>
+        return 0;
+    108c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1091:	eb 18                	jmp    10ab <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1093:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1097:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    109b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    109f:	48 8b 00             	mov    (%rax),%rax
+    10a2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    10a6:	e9 54 ff ff ff       	jmp    fff <malloc+0x64>
+  }
+}
+    10ab:	c9                   	leave
+    10ac:	c3                   	ret
+
+00000000000010ad <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+    10ad:	55                   	push   %rbp
+    10ae:	48 89 e5             	mov    %rsp,%rbp
+    10b1:	53                   	push   %rbx
+    10b2:	48 83 ec 38          	sub    $0x38,%rsp
+    10b6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    10b9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    10bd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+    10c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    10c5:	8b 40 40             	mov    0x40(%rax),%eax
+    10c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+    10cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    10cf:	8b 00                	mov    (%rax),%eax
+    10d1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    10d4:	29 c2                	sub    %eax,%edx
+    10d6:	83 fa 20             	cmp    $0x20,%edx
+    10d9:	75 0a                	jne    10e5 <ring_send+0x38>
+    return -1;
+    10db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10e0:	e9 93 00 00 00       	jmp    1178 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+    10e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10e8:	83 e0 1f             	and    $0x1f,%eax
+    10eb:	89 c2                	mov    %eax,%edx
+    10ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    10f1:	89 d2                	mov    %edx,%edx
+    10f3:	48 83 c2 02          	add    $0x2,%rdx
+    10f7:	48 c1 e2 06          	shl    $0x6,%rdx
+    10fb:	48 01 c2             	add    %rax,%rdx
+    10fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1102:	48 8b 08             	mov    (%rax),%rcx
+    1105:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    1109:	48 89 0a             	mov    %rcx,(%rdx)
+    110c:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+    1110:	48 8b 48 10          	mov    0x10(%rax),%rcx
+    1114:	48 8b 58 18          	mov    0x18(%rax),%rbx
+    1118:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+    111c:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+    1120:	48 8b 48 20          	mov    0x20(%rax),%rcx
+    1124:	48 8b 58 28          	mov    0x28(%rax),%rbx
+    1128:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+    112c:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+    1130:	48 8b 48 30          	mov    0x30(%rax),%rcx
+    1134:	48 8b 58 38          	mov    0x38(%rax),%rbx
+    1138:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+    113c:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+    1140:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+    1146:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1149:	8d 50 01             	lea    0x1(%rax),%edx
+    114c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1150:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+    1153:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+    1159:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    115d:	8b 00                	mov    (%rax),%eax
+    115f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1162:	75 0f                	jne    1173 <ring_send+0xc6>
+    notify(channel, 1);
+    1164:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1167:	be 01 00 00 00       	mov    $0x1,%esi
+    116c:	89 c7                	mov    %eax,%edi
+    116e:	e8 a1 f7 ff ff       	call   914 <notify>
+  return 0;
+    1173:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1178:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    117c:	c9                   	leave
+    117d:	c3                   	ret
+
+000000000000117e <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+    117e:	55                   	push   %rbp
+    117f:	48 89 e5             	mov    %rsp,%rbp
+    1182:	53                   	push   %rbx
+    1183:	48 83 ec 38          	sub    $0x38,%rsp
+    1187:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    118a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    118e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+    1192:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1196:	8b 00                	mov    (%rax),%eax
+    1198:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+    119b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+    11a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11a5:	8b 40 40             	mov    0x40(%rax),%eax
+    11a8:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    11ab:	75 15                	jne    11c2 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+    11ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11b0:	89 c7                	mov    %eax,%edi
+    11b2:	e8 67 f7 ff ff       	call   91e <nfy_wait>
+    11b7:	85 c0                	test   %eax,%eax
+    11b9:	79 e0                	jns    119b <ring_recv+0x1d>
+      return -1;
+    11bb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11c0:	eb 73                	jmp    1235 <ring_recv+0xb7>
+      break;
+    11c2:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+    11c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    11c6:	83 e0 1f             	and    $0x1f,%eax
+    11c9:	89 c1                	mov    %eax,%ecx
+    11cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    11cf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    11d3:	89 c9                	mov    %ecx,%ecx
+    11d5:	48 83 c1 02          	add    $0x2,%rcx
+    11d9:	48 c1 e1 06          	shl    $0x6,%rcx
+    11dd:	48 01 ca             	add    %rcx,%rdx
+    11e0:	48 8b 0a             	mov    (%rdx),%rcx
+    11e3:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+    11e7:	48 89 08             	mov    %rcx,(%rax)
+    11ea:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    11ee:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    11f2:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    11f6:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    11fa:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    11fe:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    1202:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    1206:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    120a:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    120e:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    1212:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    1216:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    121a:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    121e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    1224:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1227:	8d 50 01             	lea    0x1(%rax),%edx
+    122a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    122e:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1230:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1235:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1239:	c9                   	leave
+    123a:	c3                   	ret
+
+000000000000123b <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    123b:	55                   	push   %rbp
+    123c:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    123f:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1244:	8b 00                	mov    (%rax),%eax
+}
+    1246:	5d                   	pop    %rbp
+    1247:	c3                   	ret
+
+0000000000001248 <getpid>:
+
+int
+getpid(void)
+{
+    1248:	55                   	push   %rbp
+    1249:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    124c:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    1251:	8b 00                	mov    (%rax),%eax
+}
+    1253:	5d                   	pop    %rbp
+    1254:	c3                   	ret
+
+0000000000001255 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    1255:	55                   	push   %rbp
+    1256:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    1259:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    125e:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    1262:	5d                   	pop    %rbp
+    1263:	c3                   	ret
@@ -0,0 +1,1856 @@
+
+fs/wc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 30          	sub    $0x30,%rsp
+       8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+       b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+       f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+      16:	8b 45 f0             	mov    -0x10(%rbp),%eax
+      19:	89 45 f4             	mov    %eax,-0xc(%rbp)
+      1c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      1f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  inword = 0;
+      22:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+      29:	eb 69                	jmp    94 <wc+0x94>
+    for(i=0; i<n; i++){
+      2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      32:	eb 58                	jmp    8c <wc+0x8c>
+      c++;
+      34:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+      if(buf[i] == '\n')
+      38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      3b:	48 98                	cltq
+      3d:	0f b6 80 80 14 00 00 	movzbl 0x1480(%rax),%eax
+      44:	3c 0a                	cmp    $0xa,%al
+      46:	75 04                	jne    4c <wc+0x4c>
+        l++;
+      48:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+      if(strchr(" \r\t\n\v", buf[i]))
+      4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      4f:	48 98                	cltq
+      51:	0f b6 80 80 14 00 00 	movzbl 0x1480(%rax),%eax
+      58:	0f be c0             	movsbl %al,%eax
+      5b:	89 c6                	mov    %eax,%esi
+      5d:	48 c7 c7 08 11 00 00 	mov    $0x1108,%rdi
+      64:	e8 a5 02 00 00       	call   30e <strchr>
+      69:	48 85 c0             	test   %rax,%rax
+      6c:	74 09                	je     77 <wc+0x77>
+        inword = 0;
+      6e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+      75:	eb 11                	jmp    88 <wc+0x88>
+      else if(!inword){
+      77:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+      7b:	75 0b                	jne    88 <wc+0x88>
+        w++;
+      7d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+        inword = 1;
+      81:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+    for(i=0; i<n; i++){
+      88:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      8f:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+      92:	7c a0                	jl     34 <wc+0x34>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+      94:	8b 45 dc             	mov    -0x24(%rbp),%eax
+      97:	ba 00 02 00 00       	mov    $0x200,%edx
+      9c:	48 c7 c6 80 14 00 00 	mov    $0x1480,%rsi
+      a3:	89 c7                	mov    %eax,%edi
+      a5:	e8 4d 04 00 00       	call   4f7 <read>
+      aa:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      ad:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+      b1:	0f 8f 74 ff ff ff    	jg     2b <wc+0x2b>
+      }
+    }
+  }
+  if(n < 0){
+      b7:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+      bb:	79 1b                	jns    d8 <wc+0xd8>
+    printf(1, "wc: read error\n");
+      bd:	48 c7 c6 0e 11 00 00 	mov    $0x110e,%rsi
+      c4:	bf 01 00 00 00       	mov    $0x1,%edi
+      c9:	b8 00 00 00 00       	mov    $0x0,%eax
+      ce:	e8 79 08 00 00       	call   94c <printf>
+    exit();
+      d3:	e8 01 04 00 00       	call   4d9 <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+      d8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+      dc:	8b 4d f0             	mov    -0x10(%rbp),%ecx
+      df:	8b 55 f4             	mov    -0xc(%rbp),%edx
+      e2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      e5:	49 89 f1             	mov    %rsi,%r9
+      e8:	41 89 c8             	mov    %ecx,%r8d
+      eb:	89 d1                	mov    %edx,%ecx
+      ed:	89 c2                	mov    %eax,%edx
+      ef:	48 c7 c6 1e 11 00 00 	mov    $0x111e,%rsi
+      f6:	bf 01 00 00 00       	mov    $0x1,%edi
+      fb:	b8 00 00 00 00       	mov    $0x0,%eax
+     100:	e8 47 08 00 00       	call   94c <printf>
+}
+     105:	90                   	nop
+     106:	c9                   	leave
+     107:	c3                   	ret
+
+0000000000000108 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     108:	55                   	push   %rbp
+     109:	48 89 e5             	mov    %rsp,%rbp
+     10c:	48 83 ec 20          	sub    $0x20,%rsp
+     110:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     113:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, i;
+
+  if(argc <= 1){
+     117:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     11b:	7f 16                	jg     133 <main+0x2b>
+    wc(0, "");
+     11d:	48 c7 c6 2b 11 00 00 	mov    $0x112b,%rsi
+     124:	bf 00 00 00 00       	mov    $0x0,%edi
+     129:	e8 d2 fe ff ff       	call   0 <wc>
+    exit();
+     12e:	e8 a6 03 00 00       	call   4d9 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+     133:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     13a:	e9 94 00 00 00       	jmp    1d3 <main+0xcb>
+    if((fd = open(argv[i], 0)) < 0){
+     13f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     142:	48 98                	cltq
+     144:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     14b:	00 
+     14c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     150:	48 01 d0             	add    %rdx,%rax
+     153:	48 8b 00             	mov    (%rax),%rax
+     156:	be 00 00 00 00       	mov    $0x0,%esi
+     15b:	48 89 c7             	mov    %rax,%rdi
+     15e:	e8 c6 03 00 00       	call   529 <open>
+     163:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     166:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     16a:	79 35                	jns    1a1 <main+0x99>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+     16c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     16f:	48 98                	cltq
+     171:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     178:	00 
+     179:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     17d:	48 01 d0             	add    %rdx,%rax
+     180:	48 8b 00             	mov    (%rax),%rax
+     183:	48 89 c2             	mov    %rax,%rdx
+     186:	48 c7 c6 2c 11 00 00 	mov    $0x112c,%rsi
+     18d:	bf 01 00 00 00       	mov    $0x1,%edi
+     192:	b8 00 00 00 00       	mov    $0x0,%eax
+     197:	e8 b0 07 00 00       	call   94c <printf>
+      exit();
+     19c:	e8 38 03 00 00       	call   4d9 <exit>
+    }
+    wc(fd, argv[i]);
+     1a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1a4:	48 98                	cltq
+     1a6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     1ad:	00 
+     1ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1b2:	48 01 d0             	add    %rdx,%rax
+     1b5:	48 8b 10             	mov    (%rax),%rdx
+     1b8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1bb:	48 89 d6             	mov    %rdx,%rsi
+     1be:	89 c7                	mov    %eax,%edi
+     1c0:	e8 3b fe ff ff       	call   0 <wc>
+    close(fd);
+     1c5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1c8:	89 c7                	mov    %eax,%edi
+     1ca:	e8 3c 03 00 00       	call   50b <close>
+  for(i = 1; i < argc; i++){
+     1cf:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1d6:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     1d9:	0f 8c 60 ff ff ff    	jl     13f <main+0x37>
+  }
+  exit();
+     1df:	e8 f5 02 00 00       	call   4d9 <exit>
+
+00000000000001e4 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     1e4:	55                   	push   %rbp
+     1e5:	48 89 e5             	mov    %rsp,%rbp
+     1e8:	48 83 ec 10          	sub    $0x10,%rsp
+     1ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     1f0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     1f3:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+     1f6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     1fa:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     1fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     200:	48 89 ce             	mov    %rcx,%rsi
+     203:	48 89 f7             	mov    %rsi,%rdi
+     206:	89 d1                	mov    %edx,%ecx
+     208:	fc                   	cld
+     209:	f3 aa                	rep stos %al,%es:(%rdi)
+     20b:	89 ca                	mov    %ecx,%edx
+     20d:	48 89 fe             	mov    %rdi,%rsi
+     210:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     214:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     217:	90                   	nop
+     218:	c9                   	leave
+     219:	c3                   	ret
+
+000000000000021a <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     21a:	55                   	push   %rbp
+     21b:	48 89 e5             	mov    %rsp,%rbp
+     21e:	48 83 ec 20          	sub    $0x20,%rsp
+     222:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     226:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+     22a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     22e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     232:	90                   	nop
+     233:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     237:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     23b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     23f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     243:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     247:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     24b:	0f b6 12             	movzbl (%rdx),%edx
+     24e:	88 10                	mov    %dl,(%rax)
+     250:	0f b6 00             	movzbl (%rax),%eax
+     253:	84 c0                	test   %al,%al
+     255:	75 dc                	jne    233 <strcpy+0x19>
+    ;
+  return os;
+     257:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     25b:	c9                   	leave
+     25c:	c3                   	ret
+
+000000000000025d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     25d:	55                   	push   %rbp
+     25e:	48 89 e5             	mov    %rsp,%rbp
+     261:	48 83 ec 10          	sub    $0x10,%rsp
+     265:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     269:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     26d:	eb 0a                	jmp    279 <strcmp+0x1c>
+    p++, q++;
+     26f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     274:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     279:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     27d:	0f b6 00             	movzbl (%rax),%eax
+     280:	84 c0                	test   %al,%al
+     282:	74 12                	je     296 <strcmp+0x39>
+     284:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     288:	0f b6 10             	movzbl (%rax),%edx
+     28b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     28f:	0f b6 00             	movzbl (%rax),%eax
+     292:	38 c2                	cmp    %al,%dl
+     294:	74 d9                	je     26f <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+     296:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     29a:	0f b6 00             	movzbl (%rax),%eax
+     29d:	0f b6 d0             	movzbl %al,%edx
+     2a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2a4:	0f b6 00             	movzbl (%rax),%eax
+     2a7:	0f b6 c0             	movzbl %al,%eax
+     2aa:	29 c2                	sub    %eax,%edx
+     2ac:	89 d0                	mov    %edx,%eax
+}
+     2ae:	c9                   	leave
+     2af:	c3                   	ret
+
+00000000000002b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+     2b0:	55                   	push   %rbp
+     2b1:	48 89 e5             	mov    %rsp,%rbp
+     2b4:	48 83 ec 18          	sub    $0x18,%rsp
+     2b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     2c3:	eb 04                	jmp    2c9 <strlen+0x19>
+     2c5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     2c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2cc:	48 63 d0             	movslq %eax,%rdx
+     2cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     2d3:	48 01 d0             	add    %rdx,%rax
+     2d6:	0f b6 00             	movzbl (%rax),%eax
+     2d9:	84 c0                	test   %al,%al
+     2db:	75 e8                	jne    2c5 <strlen+0x15>
+    ;
+  return n;
+     2dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     2e0:	c9                   	leave
+     2e1:	c3                   	ret
+
+00000000000002e2 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2e2:	55                   	push   %rbp
+     2e3:	48 89 e5             	mov    %rsp,%rbp
+     2e6:	48 83 ec 10          	sub    $0x10,%rsp
+     2ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     2ee:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     2f1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     2f4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     2f7:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     2fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2fe:	89 ce                	mov    %ecx,%esi
+     300:	48 89 c7             	mov    %rax,%rdi
+     303:	e8 dc fe ff ff       	call   1e4 <stosb>
+  return dst;
+     308:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     30c:	c9                   	leave
+     30d:	c3                   	ret
+
+000000000000030e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     30e:	55                   	push   %rbp
+     30f:	48 89 e5             	mov    %rsp,%rbp
+     312:	48 83 ec 10          	sub    $0x10,%rsp
+     316:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     31a:	89 f0                	mov    %esi,%eax
+     31c:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     31f:	eb 17                	jmp    338 <strchr+0x2a>
+    if(*s == c)
+     321:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     325:	0f b6 00             	movzbl (%rax),%eax
+     328:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     32b:	75 06                	jne    333 <strchr+0x25>
+      return (char*)s;
+     32d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     331:	eb 15                	jmp    348 <strchr+0x3a>
+  for(; *s; s++)
+     333:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     338:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     33c:	0f b6 00             	movzbl (%rax),%eax
+     33f:	84 c0                	test   %al,%al
+     341:	75 de                	jne    321 <strchr+0x13>
+  return 0;
+     343:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     348:	c9                   	leave
+     349:	c3                   	ret
+
+000000000000034a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     34a:	55                   	push   %rbp
+     34b:	48 89 e5             	mov    %rsp,%rbp
+     34e:	48 83 ec 20          	sub    $0x20,%rsp
+     352:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     356:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     359:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     360:	eb 48                	jmp    3aa <gets+0x60>
+    cc = read(0, &c, 1);
+     362:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     366:	ba 01 00 00 00       	mov    $0x1,%edx
+     36b:	48 89 c6             	mov    %rax,%rsi
+     36e:	bf 00 00 00 00       	mov    $0x0,%edi
+     373:	e8 7f 01 00 00       	call   4f7 <read>
+     378:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     37b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     37f:	7e 36                	jle    3b7 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     381:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     384:	8d 50 01             	lea    0x1(%rax),%edx
+     387:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     38a:	48 63 d0             	movslq %eax,%rdx
+     38d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     391:	48 01 c2             	add    %rax,%rdx
+     394:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     398:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     39a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     39e:	3c 0a                	cmp    $0xa,%al
+     3a0:	74 16                	je     3b8 <gets+0x6e>
+     3a2:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     3a6:	3c 0d                	cmp    $0xd,%al
+     3a8:	74 0e                	je     3b8 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     3aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3ad:	83 c0 01             	add    $0x1,%eax
+     3b0:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     3b3:	7f ad                	jg     362 <gets+0x18>
+     3b5:	eb 01                	jmp    3b8 <gets+0x6e>
+      break;
+     3b7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     3b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3bb:	48 63 d0             	movslq %eax,%rdx
+     3be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3c2:	48 01 d0             	add    %rdx,%rax
+     3c5:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     3c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     3cc:	c9                   	leave
+     3cd:	c3                   	ret
+
+00000000000003ce <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     3ce:	55                   	push   %rbp
+     3cf:	48 89 e5             	mov    %rsp,%rbp
+     3d2:	48 83 ec 20          	sub    $0x20,%rsp
+     3d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     3da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     3de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3e2:	be 00 00 00 00       	mov    $0x0,%esi
+     3e7:	48 89 c7             	mov    %rax,%rdi
+     3ea:	e8 3a 01 00 00       	call   529 <open>
+     3ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     3f2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     3f6:	79 07                	jns    3ff <stat+0x31>
+    return -1;
+     3f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     3fd:	eb 21                	jmp    420 <stat+0x52>
+  r = fstat(fd, st);
+     3ff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     403:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     406:	48 89 d6             	mov    %rdx,%rsi
+     409:	89 c7                	mov    %eax,%edi
+     40b:	e8 37 01 00 00       	call   547 <fstat>
+     410:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     413:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     416:	89 c7                	mov    %eax,%edi
+     418:	e8 ee 00 00 00       	call   50b <close>
+  return r;
+     41d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     420:	c9                   	leave
+     421:	c3                   	ret
+
+0000000000000422 <atoi>:
+
+int
+atoi(const char *s)
+{
+     422:	55                   	push   %rbp
+     423:	48 89 e5             	mov    %rsp,%rbp
+     426:	48 83 ec 18          	sub    $0x18,%rsp
+     42a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     42e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     435:	eb 28                	jmp    45f <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+     437:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     43a:	89 d0                	mov    %edx,%eax
+     43c:	c1 e0 02             	shl    $0x2,%eax
+     43f:	01 d0                	add    %edx,%eax
+     441:	01 c0                	add    %eax,%eax
+     443:	89 c1                	mov    %eax,%ecx
+     445:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     449:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     44d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     451:	0f b6 00             	movzbl (%rax),%eax
+     454:	0f be c0             	movsbl %al,%eax
+     457:	01 c8                	add    %ecx,%eax
+     459:	83 e8 30             	sub    $0x30,%eax
+     45c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     45f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     463:	0f b6 00             	movzbl (%rax),%eax
+     466:	3c 2f                	cmp    $0x2f,%al
+     468:	7e 0b                	jle    475 <atoi+0x53>
+     46a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     46e:	0f b6 00             	movzbl (%rax),%eax
+     471:	3c 39                	cmp    $0x39,%al
+     473:	7e c2                	jle    437 <atoi+0x15>
+  return n;
+     475:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     478:	c9                   	leave
+     479:	c3                   	ret
+
+000000000000047a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     47a:	55                   	push   %rbp
+     47b:	48 89 e5             	mov    %rsp,%rbp
+     47e:	48 83 ec 28          	sub    $0x28,%rsp
+     482:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     486:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     48a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+     48d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     491:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     495:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     499:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     49d:	eb 1d                	jmp    4bc <memmove+0x42>
+    *dst++ = *src++;
+     49f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     4a3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     4a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     4ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4af:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     4b3:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     4b7:	0f b6 12             	movzbl (%rdx),%edx
+     4ba:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     4bc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     4bf:	8d 50 ff             	lea    -0x1(%rax),%edx
+     4c2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     4c5:	85 c0                	test   %eax,%eax
+     4c7:	7f d6                	jg     49f <memmove+0x25>
+  return vdst;
+     4c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     4cd:	c9                   	leave
+     4ce:	c3                   	ret
+
+00000000000004cf <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+     4cf:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+     4d6:	cd 40                	int    $0x40
+     4d8:	c3                   	ret
+
+00000000000004d9 <exit>:
+SYSCALL_FAST(exit)
+     4d9:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+     4e0:	0f 05                	syscall
+     4e2:	c3                   	ret
+
+00000000000004e3 <wait>:
+SYSCALL_FAST(wait)
+     4e3:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+     4ea:	0f 05                	syscall
+     4ec:	c3                   	ret
+
+00000000000004ed <pipe>:
+SYSCALL_FAST(pipe)
+     4ed:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+     4f4:	0f 05                	syscall
+     4f6:	c3                   	ret
+
+00000000000004f7 <read>:
+SYSCALL_FAST(read)
+     4f7:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+     4fe:	0f 05                	syscall
+     500:	c3                   	ret
+
+0000000000000501 <write>:
+SYSCALL_FAST(write)
+     501:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+     508:	0f 05                	syscall
+     50a:	c3                   	ret
+
+000000000000050b <close>:
+SYSCALL_FAST(close)
+     50b:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+     512:	0f 05                	syscall
+     514:	c3                   	ret
+
+0000000000000515 <kill>:
+SYSCALL_FAST(kill)
+     515:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+     51c:	0f 05                	syscall
+     51e:	c3                   	ret
+
+000000000000051f <exec>:
+SYSCALL(exec)
+     51f:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+     526:	cd 40                	int    $0x40
+     528:	c3                   	ret
+
+0000000000000529 <open>:
+SYSCALL_FAST(open)
+     529:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+     530:	0f 05                	syscall
+     532:	c3                   	ret
+
+0000000000000533 <mknod>:
+SYSCALL_FAST(mknod)
+     533:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+     53a:	0f 05                	syscall
+     53c:	c3                   	ret
+
+000000000000053d <unlink>:
+SYSCALL_FAST(unlink)
+     53d:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+     544:	0f 05                	syscall
+     546:	c3                   	ret
+
+0000000000000547 <fstat>:
+SYSCALL_FAST(fstat)
+     547:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+     54e:	0f 05                	syscall
+     550:	c3                   	ret
+
+0000000000000551 <link>:
+SYSCALL_FAST(link)
+     551:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+     558:	0f 05                	syscall
+     55a:	c3                   	ret
+
+000000000000055b <mkdir>:
+SYSCALL_FAST(mkdir)
+     55b:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+     562:	0f 05                	syscall
+     564:	c3                   	ret
+
+0000000000000565 <chdir>:
+SYSCALL_FAST(chdir)
+     565:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+     56c:	0f 05                	syscall
+     56e:	c3                   	ret
+
+000000000000056f <dup>:
+SYSCALL_FAST(dup)
+     56f:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+     576:	0f 05                	syscall
+     578:	c3                   	ret
+
+0000000000000579 <sbrk>:
+SYSCALL_FAST(sbrk)
+     579:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+     580:	0f 05                	syscall
+     582:	c3                   	ret
+
+0000000000000583 <sleep>:
+SYSCALL_FAST(sleep)
+     583:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+     58a:	0f 05                	syscall
+     58c:	c3                   	ret
+
+000000000000058d <send>:
+SYSCALL_FAST(send)
+     58d:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+     594:	0f 05                	syscall
+     596:	c3                   	ret
+
+0000000000000597 <send_recv>:
+SYSCALL_FAST(send_recv)
+     597:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+     59e:	0f 05                	syscall
+     5a0:	c3                   	ret
+
+00000000000005a1 <recv>:
+SYSCALL_FAST(recv)
+     5a1:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+     5a8:	0f 05                	syscall
+     5aa:	c3                   	ret
+
+00000000000005ab <call>:
+SYSCALL_FAST(call)
+     5ab:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+     5b2:	0f 05                	syscall
+     5b4:	c3                   	ret
+
+00000000000005b5 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+     5b5:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+     5bc:	0f 05                	syscall
+     5be:	c3                   	ret
+
+00000000000005bf <send_reg>:
+SYSCALL_REG(send_reg)
+     5bf:	41 54                	push   %r12
+     5c1:	41 55                	push   %r13
+     5c3:	41 56                	push   %r14
+     5c5:	41 57                	push   %r15
+     5c7:	56                   	push   %rsi
+     5c8:	49 89 f3             	mov    %rsi,%r11
+     5cb:	48 89 d6             	mov    %rdx,%rsi
+     5ce:	49 8b 13             	mov    (%r11),%rdx
+     5d1:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     5d5:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     5d9:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     5dd:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     5e1:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     5e5:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     5e9:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     5ed:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+     5f4:	0f 05                	syscall
+     5f6:	41 5b                	pop    %r11
+     5f8:	49 89 13             	mov    %rdx,(%r11)
+     5fb:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     5ff:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     603:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     607:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     60b:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     60f:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     613:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     617:	41 5f                	pop    %r15
+     619:	41 5e                	pop    %r14
+     61b:	41 5d                	pop    %r13
+     61d:	41 5c                	pop    %r12
+     61f:	c3                   	ret
+
+0000000000000620 <recv_reg>:
+SYSCALL_REG(recv_reg)
+     620:	41 54                	push   %r12
+     622:	41 55                	push   %r13
+     624:	41 56                	push   %r14
+     626:	41 57                	push   %r15
+     628:	56                   	push   %rsi
+     629:	49 89 f3             	mov    %rsi,%r11
+     62c:	48 89 d6             	mov    %rdx,%rsi
+     62f:	49 8b 13             	mov    (%r11),%rdx
+     632:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     636:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     63a:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     63e:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     642:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     646:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     64a:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     64e:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+     655:	0f 05                	syscall
+     657:	41 5b                	pop    %r11
+     659:	49 89 13             	mov    %rdx,(%r11)
+     65c:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     660:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     664:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     668:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     66c:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     670:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     674:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     678:	41 5f                	pop    %r15
+     67a:	41 5e                	pop    %r14
+     67c:	41 5d                	pop    %r13
+     67e:	41 5c                	pop    %r12
+     680:	c3                   	ret
+
+0000000000000681 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+     681:	41 54                	push   %r12
+     683:	41 55                	push   %r13
+     685:	41 56                	push   %r14
+     687:	41 57                	push   %r15
+     689:	56                   	push   %rsi
+     68a:	49 89 f3             	mov    %rsi,%r11
+     68d:	48 89 d6             	mov    %rdx,%rsi
+     690:	49 8b 13             	mov    (%r11),%rdx
+     693:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     697:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     69b:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     69f:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     6a3:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     6a7:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     6ab:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     6af:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+     6b6:	0f 05                	syscall
+     6b8:	41 5b                	pop    %r11
+     6ba:	49 89 13             	mov    %rdx,(%r11)
+     6bd:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     6c1:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     6c5:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     6c9:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     6cd:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     6d1:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     6d5:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     6d9:	41 5f                	pop    %r15
+     6db:	41 5e                	pop    %r14
+     6dd:	41 5d                	pop    %r13
+     6df:	41 5c                	pop    %r12
+     6e1:	c3                   	ret
+
+00000000000006e2 <call_reg>:
+SYSCALL_REG(call_reg)
+     6e2:	41 54                	push   %r12
+     6e4:	41 55                	push   %r13
+     6e6:	41 56                	push   %r14
+     6e8:	41 57                	push   %r15
+     6ea:	56                   	push   %rsi
+     6eb:	49 89 f3             	mov    %rsi,%r11
+     6ee:	48 89 d6             	mov    %rdx,%rsi
+     6f1:	49 8b 13             	mov    (%r11),%rdx
+     6f4:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     6f8:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     6fc:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     700:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     704:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     708:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     70c:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     710:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+     717:	0f 05                	syscall
+     719:	41 5b                	pop    %r11
+     71b:	49 89 13             	mov    %rdx,(%r11)
+     71e:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     722:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     726:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     72a:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     72e:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     732:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     736:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     73a:	41 5f                	pop    %r15
+     73c:	41 5e                	pop    %r14
+     73e:	41 5d                	pop    %r13
+     740:	41 5c                	pop    %r12
+     742:	c3                   	ret
+
+0000000000000743 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+     743:	41 54                	push   %r12
+     745:	41 55                	push   %r13
+     747:	41 56                	push   %r14
+     749:	41 57                	push   %r15
+     74b:	56                   	push   %rsi
+     74c:	49 89 f3             	mov    %rsi,%r11
+     74f:	48 89 d6             	mov    %rdx,%rsi
+     752:	49 8b 13             	mov    (%r11),%rdx
+     755:	4d 8b 43 08          	mov    0x8(%r11),%r8
+     759:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+     75d:	4d 8b 53 18          	mov    0x18(%r11),%r10
+     761:	4d 8b 63 20          	mov    0x20(%r11),%r12
+     765:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+     769:	4d 8b 73 30          	mov    0x30(%r11),%r14
+     76d:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+     771:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+     778:	0f 05                	syscall
+     77a:	41 5b                	pop    %r11
+     77c:	49 89 13             	mov    %rdx,(%r11)
+     77f:	4d 89 43 08          	mov    %r8,0x8(%r11)
+     783:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+     787:	4d 89 53 18          	mov    %r10,0x18(%r11)
+     78b:	4d 89 63 20          	mov    %r12,0x20(%r11)
+     78f:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+     793:	4d 89 73 30          	mov    %r14,0x30(%r11)
+     797:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+     79b:	41 5f                	pop    %r15
+     79d:	41 5e                	pop    %r14
+     79f:	41 5d                	pop    %r13
+     7a1:	41 5c                	pop    %r12
+     7a3:	c3                   	ret
+
+00000000000007a4 <sendx>:
+SYSCALL_FAST(sendx)
+     7a4:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+     7ab:	0f 05                	syscall
+     7ad:	c3                   	ret
+
+00000000000007ae <ring_attach>:
+SYSCALL_FAST(ring_attach)
+     7ae:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+     7b5:	0f 05                	syscall
+     7b7:	c3                   	ret
+
+00000000000007b8 <notify>:
+SYSCALL_FAST(notify)
+     7b8:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+     7bf:	0f 05                	syscall
+     7c1:	c3                   	ret
+
+00000000000007c2 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+     7c2:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+     7c9:	0f 05                	syscall
+     7cb:	c3                   	ret
+
+00000000000007cc <send_timed>:
+SYSCALL_FAST(send_timed)
+     7cc:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+     7d3:	0f 05                	syscall
+     7d5:	c3                   	ret
+
+00000000000007d6 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+     7d6:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+     7dd:	0f 05                	syscall
+     7df:	c3                   	ret
+
+00000000000007e0 <set_add>:
+SYSCALL_FAST(set_add)
+     7e0:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+     7e7:	0f 05                	syscall
+     7e9:	c3                   	ret
+
+00000000000007ea <set_del>:
+SYSCALL_FAST(set_del)
+     7ea:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+     7f1:	0f 05                	syscall
+     7f3:	c3                   	ret
+
+00000000000007f4 <recv_any>:
+SYSCALL_FAST(recv_any)
+     7f4:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+     7fb:	0f 05                	syscall
+     7fd:	c3                   	ret
+
+00000000000007fe <ep_create>:
+SYSCALL_FAST(ep_create)
+     7fe:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+     805:	0f 05                	syscall
+     807:	c3                   	ret
+
+0000000000000808 <ep_close>:
+SYSCALL_FAST(ep_close)
+     808:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+     80f:	0f 05                	syscall
+     811:	c3                   	ret
+
+0000000000000812 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+     812:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+     819:	0f 05                	syscall
+     81b:	c3                   	ret
+
+000000000000081c <setprio>:
+SYSCALL_FAST(setprio)
+     81c:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+     823:	0f 05                	syscall
+     825:	c3                   	ret
+
+0000000000000826 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+     826:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+     82d:	0f 05                	syscall
+     82f:	c3                   	ret
+
+0000000000000830 <sethuge>:
+SYSCALL_FAST(sethuge)
+     830:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+     837:	0f 05                	syscall
+     839:	c3                   	ret
+
+000000000000083a <cr3_test>:
+SYSCALL_FAST(cr3_test)
+     83a:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+     841:	0f 05                	syscall
+     843:	c3                   	ret
+
+0000000000000844 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+     844:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+     84b:	0f 05                	syscall
+     84d:	c3                   	ret
+
+000000000000084e <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+     84e:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+     855:	0f 05                	syscall
+     857:	c3                   	ret
+
+0000000000000858 <null_call>:
+     858:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+     85f:	0f 05                	syscall
+     861:	c3                   	ret
+
+0000000000000862 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     862:	55                   	push   %rbp
+     863:	48 89 e5             	mov    %rsp,%rbp
+     866:	48 83 ec 10          	sub    $0x10,%rsp
+     86a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     86d:	89 f0                	mov    %esi,%eax
+     86f:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     872:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     876:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     879:	ba 01 00 00 00       	mov    $0x1,%edx
+     87e:	48 89 ce             	mov    %rcx,%rsi
+     881:	89 c7                	mov    %eax,%edi
+     883:	e8 79 fc ff ff       	call   501 <write>
+}
+     888:	90                   	nop
+     889:	c9                   	leave
+     88a:	c3                   	ret
+
+000000000000088b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     88b:	55                   	push   %rbp
+     88c:	48 89 e5             	mov    %rsp,%rbp
+     88f:	48 83 ec 30          	sub    $0x30,%rsp
+     893:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     896:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     899:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     89c:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     89f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     8a6:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     8aa:	74 17                	je     8c3 <printint+0x38>
+     8ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     8b0:	79 11                	jns    8c3 <printint+0x38>
+    neg = 1;
+     8b2:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     8b9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     8bc:	f7 d8                	neg    %eax
+     8be:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     8c1:	eb 06                	jmp    8c9 <printint+0x3e>
+  } else {
+    x = xx;
+     8c3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     8c6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     8c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     8d0:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     8d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     8d6:	ba 00 00 00 00       	mov    $0x0,%edx
+     8db:	f7 f1                	div    %ecx
+     8dd:	89 d1                	mov    %edx,%ecx
+     8df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8e2:	8d 50 01             	lea    0x1(%rax),%edx
+     8e5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     8e8:	89 ca                	mov    %ecx,%edx
+     8ea:	0f b6 92 50 14 00 00 	movzbl 0x1450(%rdx),%edx
+     8f1:	48 98                	cltq
+     8f3:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     8f7:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     8fa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     8fd:	ba 00 00 00 00       	mov    $0x0,%edx
+     902:	f7 f6                	div    %esi
+     904:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     907:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     90b:	75 c3                	jne    8d0 <printint+0x45>
+  if(neg)
+     90d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     911:	74 2b                	je     93e <printint+0xb3>
+    buf[i++] = '-';
+     913:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     916:	8d 50 01             	lea    0x1(%rax),%edx
+     919:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     91c:	48 98                	cltq
+     91e:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+     923:	eb 19                	jmp    93e <printint+0xb3>
+    putc(fd, buf[i]);
+     925:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     928:	48 98                	cltq
+     92a:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+     92f:	0f be d0             	movsbl %al,%edx
+     932:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     935:	89 d6                	mov    %edx,%esi
+     937:	89 c7                	mov    %eax,%edi
+     939:	e8 24 ff ff ff       	call   862 <putc>
+  while(--i >= 0)
+     93e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     942:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     946:	79 dd                	jns    925 <printint+0x9a>
+}
+     948:	90                   	nop
+     949:	90                   	nop
+     94a:	c9                   	leave
+     94b:	c3                   	ret
+
+000000000000094c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     94c:	55                   	push   %rbp
+     94d:	48 89 e5             	mov    %rsp,%rbp
+     950:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+     957:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+     95d:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+     964:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+     96b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+     972:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+     979:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+     980:	84 c0                	test   %al,%al
+     982:	74 20                	je     9a4 <printf+0x58>
+     984:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+     988:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+     98c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+     990:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+     994:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+     998:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+     99c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+     9a0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+     9a4:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+     9ab:	00 00 00 
+     9ae:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+     9b5:	00 00 00 
+     9b8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     9bc:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+     9c3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+     9ca:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+     9d1:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     9d8:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     9db:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+     9e2:	00 00 00 
+     9e5:	e9 a8 02 00 00       	jmp    c92 <printf+0x346>
+    c = fmt[i] & 0xff;
+     9ea:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     9f0:	48 63 d0             	movslq %eax,%rdx
+     9f3:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     9fa:	48 01 d0             	add    %rdx,%rax
+     9fd:	0f b6 00             	movzbl (%rax),%eax
+     a00:	0f be c0             	movsbl %al,%eax
+     a03:	25 ff 00 00 00       	and    $0xff,%eax
+     a08:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+     a0e:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+     a15:	75 35                	jne    a4c <printf+0x100>
+      if(c == '%'){
+     a17:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     a1e:	75 0f                	jne    a2f <printf+0xe3>
+        state = '%';
+     a20:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+     a27:	00 00 00 
+     a2a:	e9 5c 02 00 00       	jmp    c8b <printf+0x33f>
+      } else {
+        putc(fd, c);
+     a2f:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     a35:	0f be d0             	movsbl %al,%edx
+     a38:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     a3e:	89 d6                	mov    %edx,%esi
+     a40:	89 c7                	mov    %eax,%edi
+     a42:	e8 1b fe ff ff       	call   862 <putc>
+     a47:	e9 3f 02 00 00       	jmp    c8b <printf+0x33f>
+      }
+    } else if(state == '%'){
+     a4c:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+     a53:	0f 85 32 02 00 00    	jne    c8b <printf+0x33f>
+      if(c == 'd'){
+     a59:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+     a60:	75 5e                	jne    ac0 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+     a62:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     a68:	83 f8 2f             	cmp    $0x2f,%eax
+     a6b:	77 23                	ja     a90 <printf+0x144>
+     a6d:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     a74:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a7a:	89 d2                	mov    %edx,%edx
+     a7c:	48 01 d0             	add    %rdx,%rax
+     a7f:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     a85:	83 c2 08             	add    $0x8,%edx
+     a88:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     a8e:	eb 12                	jmp    aa2 <printf+0x156>
+     a90:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     a97:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a9b:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     aa2:	8b 30                	mov    (%rax),%esi
+     aa4:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     aaa:	b9 01 00 00 00       	mov    $0x1,%ecx
+     aaf:	ba 0a 00 00 00       	mov    $0xa,%edx
+     ab4:	89 c7                	mov    %eax,%edi
+     ab6:	e8 d0 fd ff ff       	call   88b <printint>
+     abb:	e9 c1 01 00 00       	jmp    c81 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+     ac0:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+     ac7:	74 09                	je     ad2 <printf+0x186>
+     ac9:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+     ad0:	75 5e                	jne    b30 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+     ad2:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     ad8:	83 f8 2f             	cmp    $0x2f,%eax
+     adb:	77 23                	ja     b00 <printf+0x1b4>
+     add:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     ae4:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     aea:	89 d2                	mov    %edx,%edx
+     aec:	48 01 d0             	add    %rdx,%rax
+     aef:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     af5:	83 c2 08             	add    $0x8,%edx
+     af8:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     afe:	eb 12                	jmp    b12 <printf+0x1c6>
+     b00:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     b07:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     b0b:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     b12:	8b 30                	mov    (%rax),%esi
+     b14:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+     b1f:	ba 10 00 00 00       	mov    $0x10,%edx
+     b24:	89 c7                	mov    %eax,%edi
+     b26:	e8 60 fd ff ff       	call   88b <printint>
+     b2b:	e9 51 01 00 00       	jmp    c81 <printf+0x335>
+      } else if(c == 's'){
+     b30:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+     b37:	0f 85 98 00 00 00    	jne    bd5 <printf+0x289>
+        s = va_arg(ap, char*);
+     b3d:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     b43:	83 f8 2f             	cmp    $0x2f,%eax
+     b46:	77 23                	ja     b6b <printf+0x21f>
+     b48:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     b4f:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b55:	89 d2                	mov    %edx,%edx
+     b57:	48 01 d0             	add    %rdx,%rax
+     b5a:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     b60:	83 c2 08             	add    $0x8,%edx
+     b63:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     b69:	eb 12                	jmp    b7d <printf+0x231>
+     b6b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     b72:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     b76:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     b7d:	48 8b 00             	mov    (%rax),%rax
+     b80:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+     b87:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+     b8e:	00 
+     b8f:	75 31                	jne    bc2 <printf+0x276>
+          s = "(null)";
+     b91:	48 c7 85 48 ff ff ff 	movq   $0x1140,-0xb8(%rbp)
+     b98:	40 11 00 00 
+        while(*s != 0){
+     b9c:	eb 24                	jmp    bc2 <printf+0x276>
+          putc(fd, *s);
+     b9e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     ba5:	0f b6 00             	movzbl (%rax),%eax
+     ba8:	0f be d0             	movsbl %al,%edx
+     bab:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     bb1:	89 d6                	mov    %edx,%esi
+     bb3:	89 c7                	mov    %eax,%edi
+     bb5:	e8 a8 fc ff ff       	call   862 <putc>
+          s++;
+     bba:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+     bc1:	01 
+        while(*s != 0){
+     bc2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+     bc9:	0f b6 00             	movzbl (%rax),%eax
+     bcc:	84 c0                	test   %al,%al
+     bce:	75 ce                	jne    b9e <printf+0x252>
+     bd0:	e9 ac 00 00 00       	jmp    c81 <printf+0x335>
+        }
+      } else if(c == 'c'){
+     bd5:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+     bdc:	75 56                	jne    c34 <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+     bde:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+     be4:	83 f8 2f             	cmp    $0x2f,%eax
+     be7:	77 23                	ja     c0c <printf+0x2c0>
+     be9:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+     bf0:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     bf6:	89 d2                	mov    %edx,%edx
+     bf8:	48 01 d0             	add    %rdx,%rax
+     bfb:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+     c01:	83 c2 08             	add    $0x8,%edx
+     c04:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+     c0a:	eb 12                	jmp    c1e <printf+0x2d2>
+     c0c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+     c13:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c17:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+     c1e:	8b 00                	mov    (%rax),%eax
+     c20:	0f be d0             	movsbl %al,%edx
+     c23:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c29:	89 d6                	mov    %edx,%esi
+     c2b:	89 c7                	mov    %eax,%edi
+     c2d:	e8 30 fc ff ff       	call   862 <putc>
+     c32:	eb 4d                	jmp    c81 <printf+0x335>
+      } else if(c == '%'){
+     c34:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+     c3b:	75 1a                	jne    c57 <printf+0x30b>
+        putc(fd, c);
+     c3d:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     c43:	0f be d0             	movsbl %al,%edx
+     c46:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c4c:	89 d6                	mov    %edx,%esi
+     c4e:	89 c7                	mov    %eax,%edi
+     c50:	e8 0d fc ff ff       	call   862 <putc>
+     c55:	eb 2a                	jmp    c81 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     c57:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c5d:	be 25 00 00 00       	mov    $0x25,%esi
+     c62:	89 c7                	mov    %eax,%edi
+     c64:	e8 f9 fb ff ff       	call   862 <putc>
+        putc(fd, c);
+     c69:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+     c6f:	0f be d0             	movsbl %al,%edx
+     c72:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     c78:	89 d6                	mov    %edx,%esi
+     c7a:	89 c7                	mov    %eax,%edi
+     c7c:	e8 e1 fb ff ff       	call   862 <putc>
+      }
+      state = 0;
+     c81:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+     c88:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+     c8b:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+     c92:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+     c98:	48 63 d0             	movslq %eax,%rdx
+     c9b:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+     ca2:	48 01 d0             	add    %rdx,%rax
+     ca5:	0f b6 00             	movzbl (%rax),%eax
+     ca8:	84 c0                	test   %al,%al
+     caa:	0f 85 3a fd ff ff    	jne    9ea <printf+0x9e>
+    }
+  }
+}
+     cb0:	90                   	nop
+     cb1:	90                   	nop
+     cb2:	c9                   	leave
+     cb3:	c3                   	ret
+
+0000000000000cb4 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     cb4:	55                   	push   %rbp
+     cb5:	48 89 e5             	mov    %rsp,%rbp
+     cb8:	48 83 ec 18          	sub    $0x18,%rsp
+     cbc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     cc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cc4:	48 83 e8 10          	sub    $0x10,%rax
+     cc8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ccc:	48 8b 05 bd 09 00 00 	mov    0x9bd(%rip),%rax        # 1690 <freep>
+     cd3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     cd7:	eb 2f                	jmp    d08 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     cd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cdd:	48 8b 00             	mov    (%rax),%rax
+     ce0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ce4:	72 17                	jb     cfd <free+0x49>
+     ce6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cea:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     cee:	72 2f                	jb     d1f <free+0x6b>
+     cf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cf4:	48 8b 00             	mov    (%rax),%rax
+     cf7:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     cfb:	72 22                	jb     d1f <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     cfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d01:	48 8b 00             	mov    (%rax),%rax
+     d04:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     d08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d0c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     d10:	73 c7                	jae    cd9 <free+0x25>
+     d12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d16:	48 8b 00             	mov    (%rax),%rax
+     d19:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     d1d:	73 ba                	jae    cd9 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     d1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d23:	8b 40 08             	mov    0x8(%rax),%eax
+     d26:	89 c0                	mov    %eax,%eax
+     d28:	48 c1 e0 04          	shl    $0x4,%rax
+     d2c:	48 89 c2             	mov    %rax,%rdx
+     d2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d33:	48 01 c2             	add    %rax,%rdx
+     d36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d3a:	48 8b 00             	mov    (%rax),%rax
+     d3d:	48 39 c2             	cmp    %rax,%rdx
+     d40:	75 2d                	jne    d6f <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+     d42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d46:	8b 50 08             	mov    0x8(%rax),%edx
+     d49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d4d:	48 8b 00             	mov    (%rax),%rax
+     d50:	8b 40 08             	mov    0x8(%rax),%eax
+     d53:	01 c2                	add    %eax,%edx
+     d55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d59:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d60:	48 8b 00             	mov    (%rax),%rax
+     d63:	48 8b 10             	mov    (%rax),%rdx
+     d66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d6a:	48 89 10             	mov    %rdx,(%rax)
+     d6d:	eb 0e                	jmp    d7d <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+     d6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d73:	48 8b 10             	mov    (%rax),%rdx
+     d76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d7a:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     d7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d81:	8b 40 08             	mov    0x8(%rax),%eax
+     d84:	89 c0                	mov    %eax,%eax
+     d86:	48 c1 e0 04          	shl    $0x4,%rax
+     d8a:	48 89 c2             	mov    %rax,%rdx
+     d8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d91:	48 01 d0             	add    %rdx,%rax
+     d94:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     d98:	75 27                	jne    dc1 <free+0x10d>
+    p->s.size += bp->s.size;
+     d9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d9e:	8b 50 08             	mov    0x8(%rax),%edx
+     da1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     da5:	8b 40 08             	mov    0x8(%rax),%eax
+     da8:	01 c2                	add    %eax,%edx
+     daa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dae:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     db1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     db5:	48 8b 10             	mov    (%rax),%rdx
+     db8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dbc:	48 89 10             	mov    %rdx,(%rax)
+     dbf:	eb 0b                	jmp    dcc <free+0x118>
+  } else
+    p->s.ptr = bp;
+     dc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dc5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     dc9:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     dcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dd0:	48 89 05 b9 08 00 00 	mov    %rax,0x8b9(%rip)        # 1690 <freep>
+}
+     dd7:	90                   	nop
+     dd8:	c9                   	leave
+     dd9:	c3                   	ret
+
+0000000000000dda <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     dda:	55                   	push   %rbp
+     ddb:	48 89 e5             	mov    %rsp,%rbp
+     dde:	48 83 ec 20          	sub    $0x20,%rsp
+     de2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     de5:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     dec:	77 07                	ja     df5 <morecore+0x1b>
+    nu = 4096;
+     dee:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     df5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     df8:	c1 e0 04             	shl    $0x4,%eax
+     dfb:	89 c7                	mov    %eax,%edi
+     dfd:	e8 77 f7 ff ff       	call   579 <sbrk>
+     e02:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     e06:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     e0b:	75 07                	jne    e14 <morecore+0x3a>
+    return 0;
+     e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+     e12:	eb 29                	jmp    e3d <morecore+0x63>
+  hp = (Header*)p;
+     e14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e18:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     e1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e20:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     e23:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     e26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e2a:	48 83 c0 10          	add    $0x10,%rax
+     e2e:	48 89 c7             	mov    %rax,%rdi
+     e31:	e8 7e fe ff ff       	call   cb4 <free>
+  return freep;
+     e36:	48 8b 05 53 08 00 00 	mov    0x853(%rip),%rax        # 1690 <freep>
+}
+     e3d:	c9                   	leave
+     e3e:	c3                   	ret
+
+0000000000000e3f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     e3f:	55                   	push   %rbp
+     e40:	48 89 e5             	mov    %rsp,%rbp
+     e43:	48 83 ec 30          	sub    $0x30,%rsp
+     e47:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e4d:	48 83 c0 0f          	add    $0xf,%rax
+     e51:	48 c1 e8 04          	shr    $0x4,%rax
+     e55:	83 c0 01             	add    $0x1,%eax
+     e58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+     e5b:	48 8b 05 2e 08 00 00 	mov    0x82e(%rip),%rax        # 1690 <freep>
+     e62:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     e66:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     e6b:	75 2b                	jne    e98 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+     e6d:	48 c7 45 f0 80 16 00 	movq   $0x1680,-0x10(%rbp)
+     e74:	00 
+     e75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e79:	48 89 05 10 08 00 00 	mov    %rax,0x810(%rip)        # 1690 <freep>
+     e80:	48 8b 05 09 08 00 00 	mov    0x809(%rip),%rax        # 1690 <freep>
+     e87:	48 89 05 f2 07 00 00 	mov    %rax,0x7f2(%rip)        # 1680 <base>
+    base.s.size = 0;
+     e8e:	c7 05 f0 07 00 00 00 	movl   $0x0,0x7f0(%rip)        # 1688 <base+0x8>
+     e95:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e9c:	48 8b 00             	mov    (%rax),%rax
+     e9f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     ea3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ea7:	8b 40 08             	mov    0x8(%rax),%eax
+     eaa:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     ead:	72 5f                	jb     f0e <malloc+0xcf>
+      if(p->s.size == nunits)
+     eaf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eb3:	8b 40 08             	mov    0x8(%rax),%eax
+     eb6:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     eb9:	75 10                	jne    ecb <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+     ebb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ebf:	48 8b 10             	mov    (%rax),%rdx
+     ec2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ec6:	48 89 10             	mov    %rdx,(%rax)
+     ec9:	eb 2e                	jmp    ef9 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+     ecb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ecf:	8b 40 08             	mov    0x8(%rax),%eax
+     ed2:	2b 45 ec             	sub    -0x14(%rbp),%eax
+     ed5:	89 c2                	mov    %eax,%edx
+     ed7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     edb:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+     ede:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ee2:	8b 40 08             	mov    0x8(%rax),%eax
+     ee5:	89 c0                	mov    %eax,%eax
+     ee7:	48 c1 e0 04          	shl    $0x4,%rax
+     eeb:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+     eef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ef3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     ef6:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+     ef9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     efd:	48 89 05 8c 07 00 00 	mov    %rax,0x78c(%rip)        # 1690 <freep>
+      return (void*)(p + 1);
+     f04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f08:	48 83 c0 10          	add    $0x10,%rax
+     f0c:	eb 41                	jmp    f4f <malloc+0x110>
+    }
+    if(p == freep)
+     f0e:	48 8b 05 7b 07 00 00 	mov    0x77b(%rip),%rax        # 1690 <freep>
+     f15:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     f19:	75 1c                	jne    f37 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+     f1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f1e:	89 c7                	mov    %eax,%edi
+     f20:	e8 b5 fe ff ff       	call   dda <morecore>
+     f25:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     f29:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     f2e:	75 07                	jne    f37 <malloc+0xf8>
+        return 0;
+     f30:	b8 00 00 00 00       	mov    $0x0,%eax
+     f35:	eb 18                	jmp    f4f <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f3b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     f3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f43:	48 8b 00             	mov    (%rax),%rax
+     f46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     f4a:	e9 54 ff ff ff       	jmp    ea3 <malloc+0x64>
+  }
+}
+     f4f:	c9                   	leave
+     f50:	c3                   	ret
+
+0000000000000f51 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+     f51:	55                   	push   %rbp
+     f52:	48 89 e5             	mov    %rsp,%rbp
+     f55:	53                   	push   %rbx
+     f56:	48 83 ec 38          	sub    $0x38,%rsp
+     f5a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     f5d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     f61:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+     f65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f69:	8b 40 40             	mov    0x40(%rax),%eax
+     f6c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+     f6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f73:	8b 00                	mov    (%rax),%eax
+     f75:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     f78:	29 c2                	sub    %eax,%edx
+     f7a:	83 fa 20             	cmp    $0x20,%edx
+     f7d:	75 0a                	jne    f89 <ring_send+0x38>
+    return -1;
+     f7f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f84:	e9 93 00 00 00       	jmp    101c <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+     f89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f8c:	83 e0 1f             	and    $0x1f,%eax
+     f8f:	89 c2                	mov    %eax,%edx
+     f91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f95:	89 d2                	mov    %edx,%edx
+     f97:	48 83 c2 02          	add    $0x2,%rdx
+     f9b:	48 c1 e2 06          	shl    $0x6,%rdx
+     f9f:	48 01 c2             	add    %rax,%rdx
+     fa2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     fa6:	48 8b 08             	mov    (%rax),%rcx
+     fa9:	48 8b 58 08          	mov    0x8(%rax),%rbx
+     fad:	48 89 0a             	mov    %rcx,(%rdx)
+     fb0:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+     fb4:	48 8b 48 10          	mov    0x10(%rax),%rcx
+     fb8:	48 8b 58 18          	mov    0x18(%rax),%rbx
+     fbc:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+     fc0:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+     fc4:	48 8b 48 20          	mov    0x20(%rax),%rcx
+     fc8:	48 8b 58 28          	mov    0x28(%rax),%rbx
+     fcc:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+     fd0:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+     fd4:	48 8b 48 30          	mov    0x30(%rax),%rcx
+     fd8:	48 8b 58 38          	mov    0x38(%rax),%rbx
+     fdc:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+     fe0:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+     fe4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+     fea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fed:	8d 50 01             	lea    0x1(%rax),%edx
+     ff0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     ff4:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+     ff7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+     ffd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1001:	8b 00                	mov    (%rax),%eax
+    1003:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1006:	75 0f                	jne    1017 <ring_send+0xc6>
+    notify(channel, 1);
+    1008:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    100b:	be 01 00 00 00       	mov    $0x1,%esi
+    1010:	89 c7                	mov    %eax,%edi
+    1012:	e8 a1 f7 ff ff       	call   7b8 <notify>
+  return 0;
+    1017:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    101c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1020:	c9                   	leave
+    1021:	c3                   	ret
+
+0000000000001022 <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+    1022:	55                   	push   %rbp
+    1023:	48 89 e5             	mov    %rsp,%rbp
+    1026:	53                   	push   %rbx
+    1027:	48 83 ec 38          	sub    $0x38,%rsp
+    102b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    102e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1032:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+    1036:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    103a:	8b 00                	mov    (%rax),%eax
+    103c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+    103f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+    1045:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1049:	8b 40 40             	mov    0x40(%rax),%eax
+    104c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    104f:	75 15                	jne    1066 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+    1051:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1054:	89 c7                	mov    %eax,%edi
+    1056:	e8 67 f7 ff ff       	call   7c2 <nfy_wait>
+    105b:	85 c0                	test   %eax,%eax
+    105d:	79 e0                	jns    103f <ring_recv+0x1d>
+      return -1;
+    105f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1064:	eb 73                	jmp    10d9 <ring_recv+0xb7>
+      break;
+    1066:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+    1067:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    106a:	83 e0 1f             	and    $0x1f,%eax
+    106d:	89 c1                	mov    %eax,%ecx
+    106f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1073:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1077:	89 c9                	mov    %ecx,%ecx
+    1079:	48 83 c1 02          	add    $0x2,%rcx
+    107d:	48 c1 e1 06          	shl    $0x6,%rcx
+    1081:	48 01 ca             	add    %rcx,%rdx
+    1084:	48 8b 0a             	mov    (%rdx),%rcx
+    1087:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+    108b:	48 89 08             	mov    %rcx,(%rax)
+    108e:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    1092:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    1096:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    109a:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    109e:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    10a2:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    10a6:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    10aa:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    10ae:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    10b2:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    10b6:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    10ba:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    10be:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    10c2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    10c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10cb:	8d 50 01             	lea    0x1(%rax),%edx
+    10ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    10d2:	89 10                	mov    %edx,(%rax)
+  return 0;
+    10d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    10d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    10dd:	c9                   	leave
+    10de:	c3                   	ret
+
+00000000000010df <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    10df:	55                   	push   %rbp
+    10e0:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    10e3:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    10e8:	8b 00                	mov    (%rax),%eax
+}
+    10ea:	5d                   	pop    %rbp
+    10eb:	c3                   	ret
+
+00000000000010ec <getpid>:
+
+int
+getpid(void)
+{
+    10ec:	55                   	push   %rbp
+    10ed:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    10f0:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    10f5:	8b 00                	mov    (%rax),%eax
+}
+    10f7:	5d                   	pop    %rbp
+    10f8:	c3                   	ret
+
+00000000000010f9 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    10f9:	55                   	push   %rbp
+    10fa:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    10fd:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    1102:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    1106:	5d                   	pop    %rbp
+    1107:	c3                   	ret
@@ -0,0 +1,4164 @@
+
+fs/xtests:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <hugetest>:
+char hugemsg[4096] __attribute__((aligned(4096)));
+int stdout = 1;
+
+void
+hugetest(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 70          	sub    $0x70,%rsp
+  struct msg m;
+  char *oldbrk, *a, *p;
+  int h, n, pid, va;
+
+  printf(stdout, "huge test\n");
+       8:	8b 05 82 35 00 00    	mov    0x3582(%rip),%eax        # 3590 <stdout>
+       e:	48 c7 c6 b0 2a 00 00 	mov    $0x2ab0,%rsi
+      15:	89 c7                	mov    %eax,%edi
+      17:	b8 00 00 00 00       	mov    $0x0,%eax
+      1c:	e8 cc 22 00 00       	call   22ed <printf>
+  oldbrk = sbrk(0);
+      21:	bf 00 00 00 00       	mov    $0x0,%edi
+      26:	e8 ef 1e 00 00       	call   1f1a <sbrk>
+      2b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  n = sethuge(1);
+      2f:	bf 01 00 00 00       	mov    $0x1,%edi
+      34:	e8 98 21 00 00       	call   21d1 <sethuge>
+      39:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  sbrk(HUGESZ - (uintp)oldbrk % HUGESZ);
+      3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      40:	25 ff ff 1f 00       	and    $0x1fffff,%eax
+      45:	ba 00 00 20 00       	mov    $0x200000,%edx
+      4a:	29 c2                	sub    %eax,%edx
+      4c:	89 d0                	mov    %edx,%eax
+      4e:	89 c7                	mov    %eax,%edi
+      50:	e8 c5 1e 00 00       	call   1f1a <sbrk>
+  a = sbrk(2*HUGESZ);
+      55:	bf 00 00 40 00       	mov    $0x400000,%edi
+      5a:	e8 bb 1e 00 00       	call   1f1a <sbrk>
+      5f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  if(a == (char*)-1){
+      63:	48 83 7d e0 ff       	cmpq   $0xffffffffffffffff,-0x20(%rbp)
+      68:	75 1e                	jne    88 <hugetest+0x88>
+    printf(stdout, "huge sbrk failed\n");
+      6a:	8b 05 20 35 00 00    	mov    0x3520(%rip),%eax        # 3590 <stdout>
+      70:	48 c7 c6 bb 2a 00 00 	mov    $0x2abb,%rsi
+      77:	89 c7                	mov    %eax,%edi
+      79:	b8 00 00 00 00       	mov    $0x0,%eax
+      7e:	e8 6a 22 00 00       	call   22ed <printf>
+    exit();
+      83:	e8 f2 1d 00 00       	call   1e7a <exit>
+  }
+  if(n >= 2 && sethuge(1) != n - 2){
+      88:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+      8c:	7e 32                	jle    c0 <hugetest+0xc0>
+      8e:	bf 01 00 00 00       	mov    $0x1,%edi
+      93:	e8 39 21 00 00       	call   21d1 <sethuge>
+      98:	8b 55 ec             	mov    -0x14(%rbp),%edx
+      9b:	83 ea 02             	sub    $0x2,%edx
+      9e:	39 d0                	cmp    %edx,%eax
+      a0:	74 1e                	je     c0 <hugetest+0xc0>
+    printf(stdout, "huge sbrk did not use the pool\n");
+      a2:	8b 05 e8 34 00 00    	mov    0x34e8(%rip),%eax        # 3590 <stdout>
+      a8:	48 c7 c6 d0 2a 00 00 	mov    $0x2ad0,%rsi
+      af:	89 c7                	mov    %eax,%edi
+      b1:	b8 00 00 00 00       	mov    $0x0,%eax
+      b6:	e8 32 22 00 00       	call   22ed <printf>
+    exit();
+      bb:	e8 ba 1d 00 00       	call   1e7a <exit>
+  }
+  for(p = a; p < a + 2*HUGESZ; p += 4096)
+      c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      c4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+      c8:	eb 2a                	jmp    f4 <hugetest+0xf4>
+    *p = (p - a) / 4096;
+      ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      ce:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+      d2:	48 8d 90 ff 0f 00 00 	lea    0xfff(%rax),%rdx
+      d9:	48 85 c0             	test   %rax,%rax
+      dc:	48 0f 48 c2          	cmovs  %rdx,%rax
+      e0:	48 c1 f8 0c          	sar    $0xc,%rax
+      e4:	89 c2                	mov    %eax,%edx
+      e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      ea:	88 10                	mov    %dl,(%rax)
+  for(p = a; p < a + 2*HUGESZ; p += 4096)
+      ec:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+      f3:	00 
+      f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      f8:	48 05 00 00 40 00    	add    $0x400000,%rax
+      fe:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     102:	72 c6                	jb     ca <hugetest+0xca>
+  pid = fork();
+     104:	e8 67 1d 00 00       	call   1e70 <fork>
+     109:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  if(pid < 0){
+     10c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     110:	79 1e                	jns    130 <hugetest+0x130>
+    printf(stdout, "fork failed\n");
+     112:	8b 05 78 34 00 00    	mov    0x3478(%rip),%eax        # 3590 <stdout>
+     118:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     11f:	89 c7                	mov    %eax,%edi
+     121:	b8 00 00 00 00       	mov    $0x0,%eax
+     126:	e8 c2 21 00 00       	call   22ed <printf>
+    exit();
+     12b:	e8 4a 1d 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+     130:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     134:	75 6a                	jne    1a0 <hugetest+0x1a0>
+    for(p = a; p < a + 2*HUGESZ; p += 4096){
+     136:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     13a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     13e:	eb 4b                	jmp    18b <hugetest+0x18b>
+      if(*p != (char)((p - a) / 4096)){
+     140:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     144:	0f b6 10             	movzbl (%rax),%edx
+     147:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     14b:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+     14f:	48 8d 88 ff 0f 00 00 	lea    0xfff(%rax),%rcx
+     156:	48 85 c0             	test   %rax,%rax
+     159:	48 0f 48 c1          	cmovs  %rcx,%rax
+     15d:	48 c1 f8 0c          	sar    $0xc,%rax
+     161:	38 c2                	cmp    %al,%dl
+     163:	74 1e                	je     183 <hugetest+0x183>
+        printf(stdout, "huge page not copied by fork\n");
+     165:	8b 05 25 34 00 00    	mov    0x3425(%rip),%eax        # 3590 <stdout>
+     16b:	48 c7 c6 fd 2a 00 00 	mov    $0x2afd,%rsi
+     172:	89 c7                	mov    %eax,%edi
+     174:	b8 00 00 00 00       	mov    $0x0,%eax
+     179:	e8 6f 21 00 00       	call   22ed <printf>
+        exit();
+     17e:	e8 f7 1c 00 00       	call   1e7a <exit>
+    for(p = a; p < a + 2*HUGESZ; p += 4096){
+     183:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+     18a:	00 
+     18b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     18f:	48 05 00 00 40 00    	add    $0x400000,%rax
+     195:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     199:	72 a5                	jb     140 <hugetest+0x140>
+      }
+    }
+    exit();
+     19b:	e8 da 1c 00 00       	call   1e7a <exit>
+  }
+  wait();
+     1a0:	e8 df 1c 00 00       	call   1e84 <wait>
+  // Shrinking into the first large page leaves it mapped.
+  sbrk(-(HUGESZ + 4096));
+     1a5:	bf 00 f0 df ff       	mov    $0xffdff000,%edi
+     1aa:	e8 6b 1d 00 00       	call   1f1a <sbrk>
+  if(a[0] != 0 || a[4096] != 1){
+     1af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1b3:	0f b6 00             	movzbl (%rax),%eax
+     1b6:	84 c0                	test   %al,%al
+     1b8:	75 11                	jne    1cb <hugetest+0x1cb>
+     1ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1be:	48 05 00 10 00 00    	add    $0x1000,%rax
+     1c4:	0f b6 00             	movzbl (%rax),%eax
+     1c7:	3c 01                	cmp    $0x1,%al
+     1c9:	74 1e                	je     1e9 <hugetest+0x1e9>
+    printf(stdout, "huge page lost\n");
+     1cb:	8b 05 bf 33 00 00    	mov    0x33bf(%rip),%eax        # 3590 <stdout>
+     1d1:	48 c7 c6 1b 2b 00 00 	mov    $0x2b1b,%rsi
+     1d8:	89 c7                	mov    %eax,%edi
+     1da:	b8 00 00 00 00       	mov    $0x0,%eax
+     1df:	e8 09 21 00 00       	call   22ed <printf>
+    exit();
+     1e4:	e8 91 1c 00 00       	call   1e7a <exit>
+  }
+  if(n >= 2 && sethuge(1) != n - 1){
+     1e9:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     1ed:	7e 32                	jle    221 <hugetest+0x221>
+     1ef:	bf 01 00 00 00       	mov    $0x1,%edi
+     1f4:	e8 d8 1f 00 00       	call   21d1 <sethuge>
+     1f9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     1fc:	83 ea 01             	sub    $0x1,%edx
+     1ff:	39 d0                	cmp    %edx,%eax
+     201:	74 1e                	je     221 <hugetest+0x221>
+    printf(stdout, "huge page not returned to the pool\n");
+     203:	8b 05 87 33 00 00    	mov    0x3387(%rip),%eax        # 3590 <stdout>
+     209:	48 c7 c6 30 2b 00 00 	mov    $0x2b30,%rsi
+     210:	89 c7                	mov    %eax,%edi
+     212:	b8 00 00 00 00       	mov    $0x0,%eax
+     217:	e8 d1 20 00 00       	call   22ed <printf>
+    exit();
+     21c:	e8 59 1c 00 00       	call   1e7a <exit>
+  }
+  // Pages mapped at the break now go past that large page.
+  h = ep_create();
+     221:	e8 79 1f 00 00       	call   219f <ep_create>
+     226:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  if((va = ring_attach(h)) == -1 || sbrk(0) != (char*)(uintp)va + 4096){
+     229:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     22c:	89 c7                	mov    %eax,%edi
+     22e:	e8 1c 1f 00 00       	call   214f <ring_attach>
+     233:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+     236:	83 7d d4 ff          	cmpl   $0xffffffff,-0x2c(%rbp)
+     23a:	74 1c                	je     258 <hugetest+0x258>
+     23c:	bf 00 00 00 00       	mov    $0x0,%edi
+     241:	e8 d4 1c 00 00       	call   1f1a <sbrk>
+     246:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+     249:	48 63 d2             	movslq %edx,%rdx
+     24c:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+     253:	48 39 d0             	cmp    %rdx,%rax
+     256:	74 1e                	je     276 <hugetest+0x276>
+    printf(stdout, "huge ring_attach failed\n");
+     258:	8b 05 32 33 00 00    	mov    0x3332(%rip),%eax        # 3590 <stdout>
+     25e:	48 c7 c6 54 2b 00 00 	mov    $0x2b54,%rsi
+     265:	89 c7                	mov    %eax,%edi
+     267:	b8 00 00 00 00       	mov    $0x0,%eax
+     26c:	e8 7c 20 00 00       	call   22ed <printf>
+    exit();
+     271:	e8 04 1c 00 00       	call   1e7a <exit>
+  }
+  ((char*)(uintp)va)[0] = 1;
+     276:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     279:	48 98                	cltq
+     27b:	c6 00 01             	movb   $0x1,(%rax)
+  pid = fork();
+     27e:	e8 ed 1b 00 00       	call   1e70 <fork>
+     283:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  if(pid < 0){
+     286:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     28a:	79 1e                	jns    2aa <hugetest+0x2aa>
+    printf(stdout, "fork failed\n");
+     28c:	8b 05 fe 32 00 00    	mov    0x32fe(%rip),%eax        # 3590 <stdout>
+     292:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     299:	89 c7                	mov    %eax,%edi
+     29b:	b8 00 00 00 00       	mov    $0x0,%eax
+     2a0:	e8 48 20 00 00       	call   22ed <printf>
+    exit();
+     2a5:	e8 d0 1b 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+     2aa:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     2ae:	75 35                	jne    2e5 <hugetest+0x2e5>
+    hugemsg[0] = 'h';
+     2b0:	c6 05 49 3d 00 00 68 	movb   $0x68,0x3d49(%rip)        # 4000 <hugemsg>
+    m.regs[0] = (uintp)hugemsg;
+     2b7:	48 c7 c0 00 40 00 00 	mov    $0x4000,%rax
+     2be:	48 89 45 90          	mov    %rax,-0x70(%rbp)
+    m.regs[1] = 1;
+     2c2:	48 c7 45 98 01 00 00 	movq   $0x1,-0x68(%rbp)
+     2c9:	00 
+    sendx(h, &m, SX_MAP);
+     2ca:	48 8d 4d 90          	lea    -0x70(%rbp),%rcx
+     2ce:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2d1:	ba 01 00 00 00       	mov    $0x1,%edx
+     2d6:	48 89 ce             	mov    %rcx,%rsi
+     2d9:	89 c7                	mov    %eax,%edi
+     2db:	e8 65 1e 00 00       	call   2145 <sendx>
+    exit();
+     2e0:	e8 95 1b 00 00       	call   1e7a <exit>
+  }
+  if(recv(h, &m) < 0 || m.regs[0] < (uintp)va + 4096 ||
+     2e5:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+     2e9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2ec:	48 89 d6             	mov    %rdx,%rsi
+     2ef:	89 c7                	mov    %eax,%edi
+     2f1:	e8 4c 1c 00 00       	call   1f42 <recv>
+     2f6:	85 c0                	test   %eax,%eax
+     2f8:	78 1f                	js     319 <hugetest+0x319>
+     2fa:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+     2fe:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     301:	48 98                	cltq
+     303:	48 05 00 10 00 00    	add    $0x1000,%rax
+     309:	48 39 c2             	cmp    %rax,%rdx
+     30c:	72 0b                	jb     319 <hugetest+0x319>
+     ((char*)(uintp)m.regs[0])[0] != 'h'){
+     30e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     312:	0f b6 00             	movzbl (%rax),%eax
+  if(recv(h, &m) < 0 || m.regs[0] < (uintp)va + 4096 ||
+     315:	3c 68                	cmp    $0x68,%al
+     317:	74 1e                	je     337 <hugetest+0x337>
+    printf(stdout, "huge sx_map receive failed\n");
+     319:	8b 05 71 32 00 00    	mov    0x3271(%rip),%eax        # 3590 <stdout>
+     31f:	48 c7 c6 6d 2b 00 00 	mov    $0x2b6d,%rsi
+     326:	89 c7                	mov    %eax,%edi
+     328:	b8 00 00 00 00       	mov    $0x0,%eax
+     32d:	e8 bb 1f 00 00       	call   22ed <printf>
+    exit();
+     332:	e8 43 1b 00 00       	call   1e7a <exit>
+  }
+  wait();
+     337:	e8 48 1b 00 00       	call   1e84 <wait>
+  ep_close(h);
+     33c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     33f:	89 c7                	mov    %eax,%edi
+     341:	e8 63 1e 00 00       	call   21a9 <ep_close>
+  sbrk(-(sbrk(0) - oldbrk));
+     346:	bf 00 00 00 00       	mov    $0x0,%edi
+     34b:	e8 ca 1b 00 00       	call   1f1a <sbrk>
+     350:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     354:	48 29 c2             	sub    %rax,%rdx
+     357:	89 d0                	mov    %edx,%eax
+     359:	89 c7                	mov    %eax,%edi
+     35b:	e8 ba 1b 00 00       	call   1f1a <sbrk>
+  if(sethuge(0) != n){
+     360:	bf 00 00 00 00       	mov    $0x0,%edi
+     365:	e8 67 1e 00 00       	call   21d1 <sethuge>
+     36a:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     36d:	74 1e                	je     38d <hugetest+0x38d>
+    printf(stdout, "huge pool not refilled\n");
+     36f:	8b 05 1b 32 00 00    	mov    0x321b(%rip),%eax        # 3590 <stdout>
+     375:	48 c7 c6 89 2b 00 00 	mov    $0x2b89,%rsi
+     37c:	89 c7                	mov    %eax,%edi
+     37e:	b8 00 00 00 00       	mov    $0x0,%eax
+     383:	e8 65 1f 00 00       	call   22ed <printf>
+    exit();
+     388:	e8 ed 1a 00 00       	call   1e7a <exit>
+  }
+  printf(stdout, "huge test ok\n");
+     38d:	8b 05 fd 31 00 00    	mov    0x31fd(%rip),%eax        # 3590 <stdout>
+     393:	48 c7 c6 a1 2b 00 00 	mov    $0x2ba1,%rsi
+     39a:	89 c7                	mov    %eax,%edi
+     39c:	b8 00 00 00 00       	mov    $0x0,%eax
+     3a1:	e8 47 1f 00 00       	call   22ed <printf>
+}
+     3a6:	90                   	nop
+     3a7:	c9                   	leave
+     3a8:	c3                   	ret
+
+00000000000003a9 <ipctest>:
+
+// several servers answering call()s on one channel
+void
+ipctest(void)
+{
+     3a9:	55                   	push   %rbp
+     3aa:	48 89 e5             	mov    %rsp,%rbp
+     3ad:	48 83 ec 50          	sub    $0x50,%rsp
+  struct msg m;
+  int i, pid, tok;
+
+  printf(stdout, "ipc test\n");
+     3b1:	8b 05 d9 31 00 00    	mov    0x31d9(%rip),%eax        # 3590 <stdout>
+     3b7:	48 c7 c6 af 2b 00 00 	mov    $0x2baf,%rsi
+     3be:	89 c7                	mov    %eax,%edi
+     3c0:	b8 00 00 00 00       	mov    $0x0,%eax
+     3c5:	e8 23 1f 00 00       	call   22ed <printf>
+  if(ipc_affinity(NCPU, 0) != -1 || ipc_affinity(0, 100) != 0){
+     3ca:	be 00 00 00 00       	mov    $0x0,%esi
+     3cf:	bf 08 00 00 00       	mov    $0x8,%edi
+     3d4:	e8 da 1d 00 00       	call   21b3 <ipc_affinity>
+     3d9:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3dc:	75 13                	jne    3f1 <ipctest+0x48>
+     3de:	be 64 00 00 00       	mov    $0x64,%esi
+     3e3:	bf 00 00 00 00       	mov    $0x0,%edi
+     3e8:	e8 c6 1d 00 00       	call   21b3 <ipc_affinity>
+     3ed:	85 c0                	test   %eax,%eax
+     3ef:	74 1e                	je     40f <ipctest+0x66>
+    printf(stdout, "ipc_affinity failed\n");
+     3f1:	8b 05 99 31 00 00    	mov    0x3199(%rip),%eax        # 3590 <stdout>
+     3f7:	48 c7 c6 b9 2b 00 00 	mov    $0x2bb9,%rsi
+     3fe:	89 c7                	mov    %eax,%edi
+     400:	b8 00 00 00 00       	mov    $0x0,%eax
+     405:	e8 e3 1e 00 00       	call   22ed <printf>
+    exit();
+     40a:	e8 6b 1a 00 00       	call   1e7a <exit>
+  }
+  if(setprio(NPRIO) != -1 || setprio(NPRIO/2) != 0){
+     40f:	bf 08 00 00 00       	mov    $0x8,%edi
+     414:	e8 a4 1d 00 00       	call   21bd <setprio>
+     419:	83 f8 ff             	cmp    $0xffffffff,%eax
+     41c:	75 0e                	jne    42c <ipctest+0x83>
+     41e:	bf 04 00 00 00       	mov    $0x4,%edi
+     423:	e8 95 1d 00 00       	call   21bd <setprio>
+     428:	85 c0                	test   %eax,%eax
+     42a:	74 1e                	je     44a <ipctest+0xa1>
+    printf(stdout, "setprio failed\n");
+     42c:	8b 05 5e 31 00 00    	mov    0x315e(%rip),%eax        # 3590 <stdout>
+     432:	48 c7 c6 ce 2b 00 00 	mov    $0x2bce,%rsi
+     439:	89 c7                	mov    %eax,%edi
+     43b:	b8 00 00 00 00       	mov    $0x0,%eax
+     440:	e8 a8 1e 00 00       	call   22ed <printf>
+    exit();
+     445:	e8 30 1a 00 00       	call   1e7a <exit>
+  }
+  for(i = 0; i < 2; i++){
+     44a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     451:	eb 7d                	jmp    4d0 <ipctest+0x127>
+    pid = fork();
+     453:	e8 18 1a 00 00       	call   1e70 <fork>
+     458:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if(pid < 0){
+     45b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     45f:	79 1e                	jns    47f <ipctest+0xd6>
+      printf(stdout, "fork failed\n");
+     461:	8b 05 29 31 00 00    	mov    0x3129(%rip),%eax        # 3590 <stdout>
+     467:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     46e:	89 c7                	mov    %eax,%edi
+     470:	b8 00 00 00 00       	mov    $0x0,%eax
+     475:	e8 73 1e 00 00       	call   22ed <printf>
+      exit();
+     47a:	e8 fb 19 00 00       	call   1e7a <exit>
+    }
+    if(pid == 0){
+     47f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     483:	75 47                	jne    4cc <ipctest+0x123>
+      tok = recv(1, &m);
+     485:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     489:	48 89 c6             	mov    %rax,%rsi
+     48c:	bf 01 00 00 00       	mov    $0x1,%edi
+     491:	e8 ac 1a 00 00       	call   1f42 <recv>
+     496:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      while(m.regs[0] != 0){
+     499:	eb 23                	jmp    4be <ipctest+0x115>
+        m.regs[0]++;
+     49b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     49f:	48 83 c0 01          	add    $0x1,%rax
+     4a3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        tok = reply_recv(1, &m, tok);
+     4a7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     4aa:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     4ae:	48 89 c6             	mov    %rax,%rsi
+     4b1:	bf 01 00 00 00       	mov    $0x1,%edi
+     4b6:	e8 9b 1a 00 00       	call   1f56 <reply_recv>
+     4bb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      while(m.regs[0] != 0){
+     4be:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     4c2:	48 85 c0             	test   %rax,%rax
+     4c5:	75 d4                	jne    49b <ipctest+0xf2>
+      }
+      exit();
+     4c7:	e8 ae 19 00 00       	call   1e7a <exit>
+  for(i = 0; i < 2; i++){
+     4cc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     4d0:	83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+     4d4:	0f 8e 79 ff ff ff    	jle    453 <ipctest+0xaa>
+    }
+  }
+
+  for(i = 1; i < 1000; i++){
+     4da:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     4e1:	e9 b5 00 00 00       	jmp    59b <ipctest+0x1f2>
+    m.regs[0] = i;
+     4e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4e9:	48 98                	cltq
+     4eb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    m.regs[7] = i;
+     4ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4f2:	48 98                	cltq
+     4f4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if((i & 1) ? call_reg(1, &m) != 1 : call(1, &m) != 1){
+     4f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4fb:	83 e0 01             	and    $0x1,%eax
+     4fe:	85 c0                	test   %eax,%eax
+     500:	74 19                	je     51b <ipctest+0x172>
+     502:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     506:	48 89 c6             	mov    %rax,%rsi
+     509:	bf 01 00 00 00       	mov    $0x1,%edi
+     50e:	e8 70 1b 00 00       	call   2083 <call_reg>
+     513:	83 f8 01             	cmp    $0x1,%eax
+     516:	0f 95 c0             	setne  %al
+     519:	eb 17                	jmp    532 <ipctest+0x189>
+     51b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     51f:	48 89 c6             	mov    %rax,%rsi
+     522:	bf 01 00 00 00       	mov    $0x1,%edi
+     527:	e8 20 1a 00 00       	call   1f4c <call>
+     52c:	83 f8 01             	cmp    $0x1,%eax
+     52f:	0f 95 c0             	setne  %al
+     532:	84 c0                	test   %al,%al
+     534:	74 21                	je     557 <ipctest+0x1ae>
+      printf(stdout, "ipc call %d failed\n", i);
+     536:	8b 05 54 30 00 00    	mov    0x3054(%rip),%eax        # 3590 <stdout>
+     53c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     53f:	48 c7 c6 de 2b 00 00 	mov    $0x2bde,%rsi
+     546:	89 c7                	mov    %eax,%edi
+     548:	b8 00 00 00 00       	mov    $0x0,%eax
+     54d:	e8 9b 1d 00 00       	call   22ed <printf>
+      exit();
+     552:	e8 23 19 00 00       	call   1e7a <exit>
+    }
+    if(m.regs[0] != i + 1 || m.regs[7] != i){
+     557:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+     55b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     55e:	83 c0 01             	add    $0x1,%eax
+     561:	48 98                	cltq
+     563:	48 39 c2             	cmp    %rax,%rdx
+     566:	75 0e                	jne    576 <ipctest+0x1cd>
+     568:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     56c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     56f:	48 98                	cltq
+     571:	48 39 c2             	cmp    %rax,%rdx
+     574:	74 21                	je     597 <ipctest+0x1ee>
+      printf(stdout, "ipc call %d wrong reply\n", i);
+     576:	8b 05 14 30 00 00    	mov    0x3014(%rip),%eax        # 3590 <stdout>
+     57c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     57f:	48 c7 c6 f2 2b 00 00 	mov    $0x2bf2,%rsi
+     586:	89 c7                	mov    %eax,%edi
+     588:	b8 00 00 00 00       	mov    $0x0,%eax
+     58d:	e8 5b 1d 00 00       	call   22ed <printf>
+      exit();
+     592:	e8 e3 18 00 00       	call   1e7a <exit>
+  for(i = 1; i < 1000; i++){
+     597:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     59b:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+     5a2:	0f 8e 3e ff ff ff    	jle    4e6 <ipctest+0x13d>
+    }
+  }
+  m.regs[0] = 0;
+     5a8:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+     5af:	00 
+  send(1, &m);
+     5b0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     5b4:	48 89 c6             	mov    %rax,%rsi
+     5b7:	bf 01 00 00 00       	mov    $0x1,%edi
+     5bc:	e8 6d 19 00 00       	call   1f2e <send>
+  send(1, &m);
+     5c1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     5c5:	48 89 c6             	mov    %rax,%rsi
+     5c8:	bf 01 00 00 00       	mov    $0x1,%edi
+     5cd:	e8 5c 19 00 00       	call   1f2e <send>
+  wait();
+     5d2:	e8 ad 18 00 00       	call   1e84 <wait>
+  wait();
+     5d7:	e8 a8 18 00 00       	call   1e84 <wait>
+  ipc_affinity(-1, 0);
+     5dc:	be 00 00 00 00       	mov    $0x0,%esi
+     5e1:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+     5e6:	e8 c8 1b 00 00       	call   21b3 <ipc_affinity>
+  printf(stdout, "ipc test ok\n");
+     5eb:	8b 05 9f 2f 00 00    	mov    0x2f9f(%rip),%eax        # 3590 <stdout>
+     5f1:	48 c7 c6 0b 2c 00 00 	mov    $0x2c0b,%rsi
+     5f8:	89 c7                	mov    %eax,%edi
+     5fa:	b8 00 00 00 00       	mov    $0x0,%eax
+     5ff:	e8 e9 1c 00 00       	call   22ed <printf>
+}
+     604:	90                   	nop
+     605:	c9                   	leave
+     606:	c3                   	ret
+
+0000000000000607 <ipctokentest>:
+
+// A reply token answers only the call it came with, even when
+// the same client calls the same server again.
+void
+ipctokentest(void)
+{
+     607:	55                   	push   %rbp
+     608:	48 89 e5             	mov    %rsp,%rbp
+     60b:	48 83 ec 50          	sub    $0x50,%rsp
+  struct msg m;
+  int h, pid, tok, old;
+
+  printf(stdout, "ipc token test\n");
+     60f:	8b 05 7b 2f 00 00    	mov    0x2f7b(%rip),%eax        # 3590 <stdout>
+     615:	48 c7 c6 18 2c 00 00 	mov    $0x2c18,%rsi
+     61c:	89 c7                	mov    %eax,%edi
+     61e:	b8 00 00 00 00       	mov    $0x0,%eax
+     623:	e8 c5 1c 00 00       	call   22ed <printf>
+  h = ep_create();
+     628:	e8 72 1b 00 00       	call   219f <ep_create>
+     62d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  pid = fork();
+     630:	e8 3b 18 00 00       	call   1e70 <fork>
+     635:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if(pid < 0){
+     638:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     63c:	79 1e                	jns    65c <ipctokentest+0x55>
+    printf(stdout, "fork failed\n");
+     63e:	8b 05 4c 2f 00 00    	mov    0x2f4c(%rip),%eax        # 3590 <stdout>
+     644:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     64b:	89 c7                	mov    %eax,%edi
+     64d:	b8 00 00 00 00       	mov    $0x0,%eax
+     652:	e8 96 1c 00 00       	call   22ed <printf>
+    exit();
+     657:	e8 1e 18 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+     65c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     660:	0f 85 84 00 00 00    	jne    6ea <ipctokentest+0xe3>
+    old = recv(h, &m);
+     666:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     66a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     66d:	48 89 d6             	mov    %rdx,%rsi
+     670:	89 c7                	mov    %eax,%edi
+     672:	e8 cb 18 00 00       	call   1f42 <recv>
+     677:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    tok = reply_recv(h, &m, old);
+     67a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     67d:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+     681:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     684:	48 89 ce             	mov    %rcx,%rsi
+     687:	89 c7                	mov    %eax,%edi
+     689:	e8 c8 18 00 00       	call   1f56 <reply_recv>
+     68e:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if(tok <= 0 || tok == old || reply_recv(h, &m, old) != -1)
+     691:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     695:	7e 21                	jle    6b8 <ipctokentest+0xb1>
+     697:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     69a:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+     69d:	74 19                	je     6b8 <ipctokentest+0xb1>
+     69f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     6a2:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+     6a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6a9:	48 89 ce             	mov    %rcx,%rsi
+     6ac:	89 c7                	mov    %eax,%edi
+     6ae:	e8 a3 18 00 00       	call   1f56 <reply_recv>
+     6b3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6b6:	74 19                	je     6d1 <ipctokentest+0xca>
+      printf(stdout, "ipc stale reply token accepted\n");
+     6b8:	8b 05 d2 2e 00 00    	mov    0x2ed2(%rip),%eax        # 3590 <stdout>
+     6be:	48 c7 c6 28 2c 00 00 	mov    $0x2c28,%rsi
+     6c5:	89 c7                	mov    %eax,%edi
+     6c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     6cc:	e8 1c 1c 00 00       	call   22ed <printf>
+    reply_recv(h, &m, tok);
+     6d1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     6d4:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+     6d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6db:	48 89 ce             	mov    %rcx,%rsi
+     6de:	89 c7                	mov    %eax,%edi
+     6e0:	e8 71 18 00 00       	call   1f56 <reply_recv>
+    exit();
+     6e5:	e8 90 17 00 00       	call   1e7a <exit>
+  }
+  if(call(h, &m) != 1 || call(h, &m) != 1){
+     6ea:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     6ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6f1:	48 89 d6             	mov    %rdx,%rsi
+     6f4:	89 c7                	mov    %eax,%edi
+     6f6:	e8 51 18 00 00       	call   1f4c <call>
+     6fb:	83 f8 01             	cmp    $0x1,%eax
+     6fe:	75 16                	jne    716 <ipctokentest+0x10f>
+     700:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     704:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     707:	48 89 d6             	mov    %rdx,%rsi
+     70a:	89 c7                	mov    %eax,%edi
+     70c:	e8 3b 18 00 00       	call   1f4c <call>
+     711:	83 f8 01             	cmp    $0x1,%eax
+     714:	74 1e                	je     734 <ipctokentest+0x12d>
+    printf(stdout, "ipc token call failed\n");
+     716:	8b 05 74 2e 00 00    	mov    0x2e74(%rip),%eax        # 3590 <stdout>
+     71c:	48 c7 c6 48 2c 00 00 	mov    $0x2c48,%rsi
+     723:	89 c7                	mov    %eax,%edi
+     725:	b8 00 00 00 00       	mov    $0x0,%eax
+     72a:	e8 be 1b 00 00       	call   22ed <printf>
+    exit();
+     72f:	e8 46 17 00 00       	call   1e7a <exit>
+  }
+  send(h, &m);
+     734:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     738:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     73b:	48 89 d6             	mov    %rdx,%rsi
+     73e:	89 c7                	mov    %eax,%edi
+     740:	e8 e9 17 00 00       	call   1f2e <send>
+  wait();
+     745:	e8 3a 17 00 00       	call   1e84 <wait>
+  ep_close(h);
+     74a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     74d:	89 c7                	mov    %eax,%edi
+     74f:	e8 55 1a 00 00       	call   21a9 <ep_close>
+  printf(stdout, "ipc token test ok\n");
+     754:	8b 05 36 2e 00 00    	mov    0x2e36(%rip),%eax        # 3590 <stdout>
+     75a:	48 c7 c6 5f 2c 00 00 	mov    $0x2c5f,%rsi
+     761:	89 c7                	mov    %eax,%edi
+     763:	b8 00 00 00 00       	mov    $0x0,%eax
+     768:	e8 80 1b 00 00       	call   22ed <printf>
+}
+     76d:	90                   	nop
+     76e:	c9                   	leave
+     76f:	c3                   	ret
+
+0000000000000770 <ipcgranttest>:
+
+// Pages shared with SX_MAP and moved with SX_GRANT.
+void
+ipcgranttest(void)
+{
+     770:	55                   	push   %rbp
+     771:	48 89 e5             	mov    %rsp,%rbp
+     774:	48 83 ec 60          	sub    $0x60,%rsp
+  struct msg m;
+  char *a, *b;
+  int pid, tok;
+
+  printf(stdout, "ipc grant test\n");
+     778:	8b 05 12 2e 00 00    	mov    0x2e12(%rip),%eax        # 3590 <stdout>
+     77e:	48 c7 c6 72 2c 00 00 	mov    $0x2c72,%rsi
+     785:	89 c7                	mov    %eax,%edi
+     787:	b8 00 00 00 00       	mov    $0x0,%eax
+     78c:	e8 5c 1b 00 00       	call   22ed <printf>
+  pid = fork();
+     791:	e8 da 16 00 00       	call   1e70 <fork>
+     796:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid < 0){
+     799:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     79d:	79 1e                	jns    7bd <ipcgranttest+0x4d>
+    printf(stdout, "fork failed\n");
+     79f:	8b 05 eb 2d 00 00    	mov    0x2deb(%rip),%eax        # 3590 <stdout>
+     7a5:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     7ac:	89 c7                	mov    %eax,%edi
+     7ae:	b8 00 00 00 00       	mov    $0x0,%eax
+     7b3:	e8 35 1b 00 00       	call   22ed <printf>
+    exit();
+     7b8:	e8 bd 16 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+     7bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     7c1:	0f 85 ba 00 00 00    	jne    881 <ipcgranttest+0x111>
+    tok = recv(2, &m);
+     7c7:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     7cb:	48 89 c6             	mov    %rax,%rsi
+     7ce:	bf 02 00 00 00       	mov    $0x2,%edi
+     7d3:	e8 6a 17 00 00       	call   1f42 <recv>
+     7d8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    b = (char*)m.regs[0];
+     7db:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     7df:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if(b == 0 || m.regs[1] != 2 || b[0] != 'x' || b[4096] != 'y')
+     7e3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+     7e8:	74 26                	je     810 <ipcgranttest+0xa0>
+     7ea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     7ee:	48 83 f8 02          	cmp    $0x2,%rax
+     7f2:	75 1c                	jne    810 <ipcgranttest+0xa0>
+     7f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     7f8:	0f b6 00             	movzbl (%rax),%eax
+     7fb:	3c 78                	cmp    $0x78,%al
+     7fd:	75 11                	jne    810 <ipcgranttest+0xa0>
+     7ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     803:	48 05 00 10 00 00    	add    $0x1000,%rax
+     809:	0f b6 00             	movzbl (%rax),%eax
+     80c:	3c 79                	cmp    $0x79,%al
+     80e:	74 08                	je     818 <ipcgranttest+0xa8>
+      m.regs[1] = 0;
+     810:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+     817:	00 
+    b[4096] = 'z';
+     818:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     81c:	48 05 00 10 00 00    	add    $0x1000,%rax
+     822:	c6 00 7a             	movb   $0x7a,(%rax)
+    tok = reply_recv(2, &m, tok);
+     825:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     828:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     82c:	48 89 c6             	mov    %rax,%rsi
+     82f:	bf 02 00 00 00       	mov    $0x2,%edi
+     834:	e8 1d 17 00 00       	call   1f56 <reply_recv>
+     839:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    b = (char*)m.regs[0];
+     83c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     840:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if(b == 0 || m.regs[1] != 1 || b[0] != 'g')
+     844:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+     849:	74 15                	je     860 <ipcgranttest+0xf0>
+     84b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     84f:	48 83 f8 01          	cmp    $0x1,%rax
+     853:	75 0b                	jne    860 <ipcgranttest+0xf0>
+     855:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     859:	0f b6 00             	movzbl (%rax),%eax
+     85c:	3c 67                	cmp    $0x67,%al
+     85e:	74 08                	je     868 <ipcgranttest+0xf8>
+      m.regs[1] = 0;
+     860:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+     867:	00 
+    reply_recv(2, &m, tok);
+     868:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     86b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     86f:	48 89 c6             	mov    %rax,%rsi
+     872:	bf 02 00 00 00       	mov    $0x2,%edi
+     877:	e8 da 16 00 00       	call   1f56 <reply_recv>
+    exit();
+     87c:	e8 f9 15 00 00       	call   1e7a <exit>
+  }
+
+  a = sbrk(0);
+     881:	bf 00 00 00 00       	mov    $0x0,%edi
+     886:	e8 8f 16 00 00       	call   1f1a <sbrk>
+     88b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  sbrk((4096 - (uintp)a % 4096) % 4096);
+     88f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     893:	f7 d8                	neg    %eax
+     895:	25 ff 0f 00 00       	and    $0xfff,%eax
+     89a:	89 c7                	mov    %eax,%edi
+     89c:	e8 79 16 00 00       	call   1f1a <sbrk>
+  a = sbrk(3*4096);
+     8a1:	bf 00 30 00 00       	mov    $0x3000,%edi
+     8a6:	e8 6f 16 00 00       	call   1f1a <sbrk>
+     8ab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  a[0] = 'x';
+     8af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8b3:	c6 00 78             	movb   $0x78,(%rax)
+  a[4096] = 'y';
+     8b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8ba:	48 05 00 10 00 00    	add    $0x1000,%rax
+     8c0:	c6 00 79             	movb   $0x79,(%rax)
+  a[2*4096] = 'g';
+     8c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8c7:	48 05 00 20 00 00    	add    $0x2000,%rax
+     8cd:	c6 00 67             	movb   $0x67,(%rax)
+  m.regs[0] = (uintp)a;
+     8d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8d4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  m.regs[1] = 2;
+     8d8:	48 c7 45 a8 02 00 00 	movq   $0x2,-0x58(%rbp)
+     8df:	00 
+  if(sendx(2, &m, SX_MAP|SX_GRANT) != -1){
+     8e0:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     8e4:	ba 03 00 00 00       	mov    $0x3,%edx
+     8e9:	48 89 c6             	mov    %rax,%rsi
+     8ec:	bf 02 00 00 00       	mov    $0x2,%edi
+     8f1:	e8 4f 18 00 00       	call   2145 <sendx>
+     8f6:	83 f8 ff             	cmp    $0xffffffff,%eax
+     8f9:	74 1e                	je     919 <ipcgranttest+0x1a9>
+    printf(stdout, "sendx with both map and grant succeeded\n");
+     8fb:	8b 05 8f 2c 00 00    	mov    0x2c8f(%rip),%eax        # 3590 <stdout>
+     901:	48 c7 c6 88 2c 00 00 	mov    $0x2c88,%rsi
+     908:	89 c7                	mov    %eax,%edi
+     90a:	b8 00 00 00 00       	mov    $0x0,%eax
+     90f:	e8 d9 19 00 00       	call   22ed <printf>
+    exit();
+     914:	e8 61 15 00 00       	call   1e7a <exit>
+  }
+  if(sendx(2, &m, SX_MAP|SX_CALL) != 1 || m.regs[1] != 2 || a[4096] != 'z'){
+     919:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     91d:	ba 05 00 00 00       	mov    $0x5,%edx
+     922:	48 89 c6             	mov    %rax,%rsi
+     925:	bf 02 00 00 00       	mov    $0x2,%edi
+     92a:	e8 16 18 00 00       	call   2145 <sendx>
+     92f:	83 f8 01             	cmp    $0x1,%eax
+     932:	75 1b                	jne    94f <ipcgranttest+0x1df>
+     934:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     938:	48 83 f8 02          	cmp    $0x2,%rax
+     93c:	75 11                	jne    94f <ipcgranttest+0x1df>
+     93e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     942:	48 05 00 10 00 00    	add    $0x1000,%rax
+     948:	0f b6 00             	movzbl (%rax),%eax
+     94b:	3c 7a                	cmp    $0x7a,%al
+     94d:	74 1e                	je     96d <ipcgranttest+0x1fd>
+    printf(stdout, "ipc map failed\n");
+     94f:	8b 05 3b 2c 00 00    	mov    0x2c3b(%rip),%eax        # 3590 <stdout>
+     955:	48 c7 c6 b1 2c 00 00 	mov    $0x2cb1,%rsi
+     95c:	89 c7                	mov    %eax,%edi
+     95e:	b8 00 00 00 00       	mov    $0x0,%eax
+     963:	e8 85 19 00 00       	call   22ed <printf>
+    exit();
+     968:	e8 0d 15 00 00       	call   1e7a <exit>
+  }
+  m.regs[0] = (uintp)(a + 2*4096);
+     96d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     971:	48 05 00 20 00 00    	add    $0x2000,%rax
+     977:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  m.regs[1] = 1;
+     97b:	48 c7 45 a8 01 00 00 	movq   $0x1,-0x58(%rbp)
+     982:	00 
+  if(sendx(2, &m, SX_GRANT|SX_CALL) != 1 || m.regs[1] != 1){
+     983:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     987:	ba 06 00 00 00       	mov    $0x6,%edx
+     98c:	48 89 c6             	mov    %rax,%rsi
+     98f:	bf 02 00 00 00       	mov    $0x2,%edi
+     994:	e8 ac 17 00 00       	call   2145 <sendx>
+     999:	83 f8 01             	cmp    $0x1,%eax
+     99c:	75 0a                	jne    9a8 <ipcgranttest+0x238>
+     99e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     9a2:	48 83 f8 01          	cmp    $0x1,%rax
+     9a6:	74 1e                	je     9c6 <ipcgranttest+0x256>
+    printf(stdout, "ipc grant failed\n");
+     9a8:	8b 05 e2 2b 00 00    	mov    0x2be2(%rip),%eax        # 3590 <stdout>
+     9ae:	48 c7 c6 c1 2c 00 00 	mov    $0x2cc1,%rsi
+     9b5:	89 c7                	mov    %eax,%edi
+     9b7:	b8 00 00 00 00       	mov    $0x0,%eax
+     9bc:	e8 2c 19 00 00       	call   22ed <printf>
+    exit();
+     9c1:	e8 b4 14 00 00       	call   1e7a <exit>
+  }
+  if(sbrk(0) != a + 2*4096){
+     9c6:	bf 00 00 00 00       	mov    $0x0,%edi
+     9cb:	e8 4a 15 00 00       	call   1f1a <sbrk>
+     9d0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     9d4:	48 81 c2 00 20 00 00 	add    $0x2000,%rdx
+     9db:	48 39 d0             	cmp    %rdx,%rax
+     9de:	74 1e                	je     9fe <ipcgranttest+0x28e>
+    printf(stdout, "ipc grant did not shrink sender\n");
+     9e0:	8b 05 aa 2b 00 00    	mov    0x2baa(%rip),%eax        # 3590 <stdout>
+     9e6:	48 c7 c6 d8 2c 00 00 	mov    $0x2cd8,%rsi
+     9ed:	89 c7                	mov    %eax,%edi
+     9ef:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f4:	e8 f4 18 00 00       	call   22ed <printf>
+    exit();
+     9f9:	e8 7c 14 00 00       	call   1e7a <exit>
+  }
+  send(2, &m);
+     9fe:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     a02:	48 89 c6             	mov    %rax,%rsi
+     a05:	bf 02 00 00 00       	mov    $0x2,%edi
+     a0a:	e8 1f 15 00 00       	call   1f2e <send>
+  wait();
+     a0f:	e8 70 14 00 00       	call   1e84 <wait>
+  printf(stdout, "ipc grant test ok\n");
+     a14:	8b 05 76 2b 00 00    	mov    0x2b76(%rip),%eax        # 3590 <stdout>
+     a1a:	48 c7 c6 f9 2c 00 00 	mov    $0x2cf9,%rsi
+     a21:	89 c7                	mov    %eax,%edi
+     a23:	b8 00 00 00 00       	mov    $0x0,%eax
+     a28:	e8 c0 18 00 00       	call   22ed <printf>
+}
+     a2d:	90                   	nop
+     a2e:	c9                   	leave
+     a2f:	c3                   	ret
+
+0000000000000a30 <ipcringtest>:
+
+// Stream messages through a ring shared across fork.
+void
+ipcringtest(void)
+{
+     a30:	55                   	push   %rbp
+     a31:	48 89 e5             	mov    %rsp,%rbp
+     a34:	48 83 ec 60          	sub    $0x60,%rsp
+  struct ring *r;
+  struct msg m;
+  int i, pid, ok;
+
+  printf(stdout, "ipc ring test\n");
+     a38:	8b 05 52 2b 00 00    	mov    0x2b52(%rip),%eax        # 3590 <stdout>
+     a3e:	48 c7 c6 0c 2d 00 00 	mov    $0x2d0c,%rsi
+     a45:	89 c7                	mov    %eax,%edi
+     a47:	b8 00 00 00 00       	mov    $0x0,%eax
+     a4c:	e8 9c 18 00 00       	call   22ed <printf>
+  i = ring_attach(3);
+     a51:	bf 03 00 00 00       	mov    $0x3,%edi
+     a56:	e8 f4 16 00 00       	call   214f <ring_attach>
+     a5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(i < 0){
+     a5e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     a62:	79 1e                	jns    a82 <ipcringtest+0x52>
+    printf(stdout, "ring_attach failed\n");
+     a64:	8b 05 26 2b 00 00    	mov    0x2b26(%rip),%eax        # 3590 <stdout>
+     a6a:	48 c7 c6 1b 2d 00 00 	mov    $0x2d1b,%rsi
+     a71:	89 c7                	mov    %eax,%edi
+     a73:	b8 00 00 00 00       	mov    $0x0,%eax
+     a78:	e8 70 18 00 00       	call   22ed <printf>
+    exit();
+     a7d:	e8 f8 13 00 00       	call   1e7a <exit>
+  }
+  r = (struct ring*)(uintp)i;
+     a82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a85:	48 98                	cltq
+     a87:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  pid = fork();
+     a8b:	e8 e0 13 00 00       	call   1e70 <fork>
+     a90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(pid < 0){
+     a93:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     a97:	79 1e                	jns    ab7 <ipcringtest+0x87>
+    printf(stdout, "fork failed\n");
+     a99:	8b 05 f1 2a 00 00    	mov    0x2af1(%rip),%eax        # 3590 <stdout>
+     a9f:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     aa6:	89 c7                	mov    %eax,%edi
+     aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+     aad:	e8 3b 18 00 00       	call   22ed <printf>
+    exit();
+     ab2:	e8 c3 13 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+     ab7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     abb:	75 7b                	jne    b38 <ipcringtest+0x108>
+    ok = 0;
+     abd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    for(i = 0; i < 1000; i++){
+     ac4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     acb:	eb 40                	jmp    b0d <ipcringtest+0xdd>
+      if(ring_recv(3, r, &m) < 0)
+     acd:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+     ad1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ad5:	48 89 c6             	mov    %rax,%rsi
+     ad8:	bf 03 00 00 00       	mov    $0x3,%edi
+     add:	e8 e1 1e 00 00       	call   29c3 <ring_recv>
+     ae2:	85 c0                	test   %eax,%eax
+     ae4:	78 32                	js     b18 <ipcringtest+0xe8>
+        break;
+      if(m.regs[0] == i && m.regs[7] == ~(unsigned long long)i)
+     ae6:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+     aea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aed:	48 98                	cltq
+     aef:	48 39 c2             	cmp    %rax,%rdx
+     af2:	75 15                	jne    b09 <ipcringtest+0xd9>
+     af4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     af8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     afb:	48 98                	cltq
+     afd:	48 f7 d0             	not    %rax
+     b00:	48 39 c2             	cmp    %rax,%rdx
+     b03:	75 04                	jne    b09 <ipcringtest+0xd9>
+        ok++;
+     b05:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    for(i = 0; i < 1000; i++){
+     b09:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b0d:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+     b14:	7e b7                	jle    acd <ipcringtest+0x9d>
+     b16:	eb 01                	jmp    b19 <ipcringtest+0xe9>
+        break;
+     b18:	90                   	nop
+    }
+    m.regs[0] = ok;
+     b19:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b1c:	48 98                	cltq
+     b1e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    send(3, &m);
+     b22:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     b26:	48 89 c6             	mov    %rax,%rsi
+     b29:	bf 03 00 00 00       	mov    $0x3,%edi
+     b2e:	e8 fb 13 00 00       	call   1f2e <send>
+    exit();
+     b33:	e8 42 13 00 00       	call   1e7a <exit>
+  }
+
+  for(i = 0; i < 1000; i++){
+     b38:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b3f:	eb 3e                	jmp    b7f <ipcringtest+0x14f>
+    m.regs[0] = i;
+     b41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b44:	48 98                	cltq
+     b46:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    m.regs[7] = ~(unsigned long long)i;
+     b4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b4d:	48 98                	cltq
+     b4f:	48 f7 d0             	not    %rax
+     b52:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    while(ring_send(3, r, &m) < 0)
+     b56:	eb 0a                	jmp    b62 <ipcringtest+0x132>
+      sleep(1);
+     b58:	bf 01 00 00 00       	mov    $0x1,%edi
+     b5d:	e8 c2 13 00 00       	call   1f24 <sleep>
+    while(ring_send(3, r, &m) < 0)
+     b62:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+     b66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b6a:	48 89 c6             	mov    %rax,%rsi
+     b6d:	bf 03 00 00 00       	mov    $0x3,%edi
+     b72:	e8 7b 1d 00 00       	call   28f2 <ring_send>
+     b77:	85 c0                	test   %eax,%eax
+     b79:	78 dd                	js     b58 <ipcringtest+0x128>
+  for(i = 0; i < 1000; i++){
+     b7b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b7f:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+     b86:	7e b9                	jle    b41 <ipcringtest+0x111>
+  }
+  if(recv(3, &m) < 0 || m.regs[0] != 1000){
+     b88:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+     b8c:	48 89 c6             	mov    %rax,%rsi
+     b8f:	bf 03 00 00 00       	mov    $0x3,%edi
+     b94:	e8 a9 13 00 00       	call   1f42 <recv>
+     b99:	85 c0                	test   %eax,%eax
+     b9b:	78 0c                	js     ba9 <ipcringtest+0x179>
+     b9d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     ba1:	48 3d e8 03 00 00    	cmp    $0x3e8,%rax
+     ba7:	74 1e                	je     bc7 <ipcringtest+0x197>
+    printf(stdout, "ipc ring lost messages\n");
+     ba9:	8b 05 e1 29 00 00    	mov    0x29e1(%rip),%eax        # 3590 <stdout>
+     baf:	48 c7 c6 2f 2d 00 00 	mov    $0x2d2f,%rsi
+     bb6:	89 c7                	mov    %eax,%edi
+     bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+     bbd:	e8 2b 17 00 00       	call   22ed <printf>
+    exit();
+     bc2:	e8 b3 12 00 00       	call   1e7a <exit>
+  }
+  wait();
+     bc7:	e8 b8 12 00 00       	call   1e84 <wait>
+  printf(stdout, "ipc ring test ok\n");
+     bcc:	8b 05 be 29 00 00    	mov    0x29be(%rip),%eax        # 3590 <stdout>
+     bd2:	48 c7 c6 47 2d 00 00 	mov    $0x2d47,%rsi
+     bd9:	89 c7                	mov    %eax,%edi
+     bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+     be0:	e8 08 17 00 00       	call   22ed <printf>
+}
+     be5:	90                   	nop
+     be6:	c9                   	leave
+     be7:	c3                   	ret
+
+0000000000000be8 <ipcreftest>:
+
+// A page mapped more times than its reference count holds
+// makes ring_attach, fork and sendx fail rather than the kernel.
+void
+ipcreftest(void)
+{
+     be8:	55                   	push   %rbp
+     be9:	48 89 e5             	mov    %rsp,%rbp
+     bec:	48 83 ec 50          	sub    $0x50,%rsp
+  struct msg m;
+  int h, n, pid, va;
+
+  printf(stdout, "ipc ref test\n");
+     bf0:	8b 05 9a 29 00 00    	mov    0x299a(%rip),%eax        # 3590 <stdout>
+     bf6:	48 c7 c6 59 2d 00 00 	mov    $0x2d59,%rsi
+     bfd:	89 c7                	mov    %eax,%edi
+     bff:	b8 00 00 00 00       	mov    $0x0,%eax
+     c04:	e8 e4 16 00 00       	call   22ed <printf>
+  pid = fork();
+     c09:	e8 62 12 00 00       	call   1e70 <fork>
+     c0e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if(pid < 0){
+     c11:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     c15:	79 1e                	jns    c35 <ipcreftest+0x4d>
+    printf(stdout, "fork failed\n");
+     c17:	8b 05 73 29 00 00    	mov    0x2973(%rip),%eax        # 3590 <stdout>
+     c1d:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     c24:	89 c7                	mov    %eax,%edi
+     c26:	b8 00 00 00 00       	mov    $0x0,%eax
+     c2b:	e8 bd 16 00 00       	call   22ed <printf>
+    exit();
+     c30:	e8 45 12 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+     c35:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     c39:	0f 85 6c 01 00 00    	jne    dab <ipcreftest+0x1c3>
+    h = ep_create();
+     c3f:	e8 5b 15 00 00       	call   219f <ep_create>
+     c44:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    pid = fork();
+     c47:	e8 24 12 00 00       	call   1e70 <fork>
+     c4c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(pid < 0){
+     c4f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     c53:	79 1e                	jns    c73 <ipcreftest+0x8b>
+      printf(stdout, "fork failed\n");
+     c55:	8b 05 35 29 00 00    	mov    0x2935(%rip),%eax        # 3590 <stdout>
+     c5b:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     c62:	89 c7                	mov    %eax,%edi
+     c64:	b8 00 00 00 00       	mov    $0x0,%eax
+     c69:	e8 7f 16 00 00       	call   22ed <printf>
+      exit();
+     c6e:	e8 07 12 00 00       	call   1e7a <exit>
+    }
+    if(pid == 0){
+     c73:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     c77:	75 45                	jne    cbe <ipcreftest+0xd6>
+      if(recv(h, &m) < 0 || m.regs[0] != 0 || m.regs[1] != 0)
+     c79:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+     c7d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c80:	48 89 d6             	mov    %rdx,%rsi
+     c83:	89 c7                	mov    %eax,%edi
+     c85:	e8 b8 12 00 00       	call   1f42 <recv>
+     c8a:	85 c0                	test   %eax,%eax
+     c8c:	78 12                	js     ca0 <ipcreftest+0xb8>
+     c8e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     c92:	48 85 c0             	test   %rax,%rax
+     c95:	75 09                	jne    ca0 <ipcreftest+0xb8>
+     c97:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     c9b:	48 85 c0             	test   %rax,%rax
+     c9e:	74 19                	je     cb9 <ipcreftest+0xd1>
+        printf(stdout, "ipc ref sx_map mapped past the limit\n");
+     ca0:	8b 05 ea 28 00 00    	mov    0x28ea(%rip),%eax        # 3590 <stdout>
+     ca6:	48 c7 c6 68 2d 00 00 	mov    $0x2d68,%rsi
+     cad:	89 c7                	mov    %eax,%edi
+     caf:	b8 00 00 00 00       	mov    $0x0,%eax
+     cb4:	e8 34 16 00 00       	call   22ed <printf>
+      exit();
+     cb9:	e8 bc 11 00 00       	call   1e7a <exit>
+    }
+    va = ring_attach(h);
+     cbe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cc1:	89 c7                	mov    %eax,%edi
+     cc3:	e8 87 14 00 00       	call   214f <ring_attach>
+     cc8:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    for(n = 1; n < 300; n++)
+     ccb:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     cd2:	eb 13                	jmp    ce7 <ipcreftest+0xff>
+      if(ring_attach(h) == -1)
+     cd4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cd7:	89 c7                	mov    %eax,%edi
+     cd9:	e8 71 14 00 00       	call   214f <ring_attach>
+     cde:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ce1:	74 0f                	je     cf2 <ipcreftest+0x10a>
+    for(n = 1; n < 300; n++)
+     ce3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ce7:	81 7d fc 2b 01 00 00 	cmpl   $0x12b,-0x4(%rbp)
+     cee:	7e e4                	jle    cd4 <ipcreftest+0xec>
+     cf0:	eb 01                	jmp    cf3 <ipcreftest+0x10b>
+        break;
+     cf2:	90                   	nop
+    if(va == -1 || n == 300){
+     cf3:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%rbp)
+     cf7:	74 09                	je     d02 <ipcreftest+0x11a>
+     cf9:	81 7d fc 2c 01 00 00 	cmpl   $0x12c,-0x4(%rbp)
+     d00:	75 1e                	jne    d20 <ipcreftest+0x138>
+      printf(stdout, "ipc ref ring_attach did not fail\n");
+     d02:	8b 05 88 28 00 00    	mov    0x2888(%rip),%eax        # 3590 <stdout>
+     d08:	48 c7 c6 90 2d 00 00 	mov    $0x2d90,%rsi
+     d0f:	89 c7                	mov    %eax,%edi
+     d11:	b8 00 00 00 00       	mov    $0x0,%eax
+     d16:	e8 d2 15 00 00       	call   22ed <printf>
+      exit();
+     d1b:	e8 5a 11 00 00       	call   1e7a <exit>
+    }
+    if((pid = fork()) == 0)
+     d20:	e8 4b 11 00 00       	call   1e70 <fork>
+     d25:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     d28:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     d2c:	75 05                	jne    d33 <ipcreftest+0x14b>
+      exit();
+     d2e:	e8 47 11 00 00       	call   1e7a <exit>
+    if(pid != -1){
+     d33:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+     d37:	74 1e                	je     d57 <ipcreftest+0x16f>
+      printf(stdout, "ipc ref fork did not fail\n");
+     d39:	8b 05 51 28 00 00    	mov    0x2851(%rip),%eax        # 3590 <stdout>
+     d3f:	48 c7 c6 b2 2d 00 00 	mov    $0x2db2,%rsi
+     d46:	89 c7                	mov    %eax,%edi
+     d48:	b8 00 00 00 00       	mov    $0x0,%eax
+     d4d:	e8 9b 15 00 00       	call   22ed <printf>
+      exit();
+     d52:	e8 23 11 00 00       	call   1e7a <exit>
+    }
+    m.regs[0] = va;
+     d57:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d5a:	48 98                	cltq
+     d5c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    m.regs[1] = 1;
+     d60:	48 c7 45 b8 01 00 00 	movq   $0x1,-0x48(%rbp)
+     d67:	00 
+    if(sendx(h, &m, SX_MAP) != -1){
+     d68:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+     d6c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d6f:	ba 01 00 00 00       	mov    $0x1,%edx
+     d74:	48 89 ce             	mov    %rcx,%rsi
+     d77:	89 c7                	mov    %eax,%edi
+     d79:	e8 c7 13 00 00       	call   2145 <sendx>
+     d7e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d81:	74 1e                	je     da1 <ipcreftest+0x1b9>
+      printf(stdout, "ipc ref sendx did not fail\n");
+     d83:	8b 05 07 28 00 00    	mov    0x2807(%rip),%eax        # 3590 <stdout>
+     d89:	48 c7 c6 cd 2d 00 00 	mov    $0x2dcd,%rsi
+     d90:	89 c7                	mov    %eax,%edi
+     d92:	b8 00 00 00 00       	mov    $0x0,%eax
+     d97:	e8 51 15 00 00       	call   22ed <printf>
+      exit();
+     d9c:	e8 d9 10 00 00       	call   1e7a <exit>
+    }
+    wait();
+     da1:	e8 de 10 00 00       	call   1e84 <wait>
+    exit();
+     da6:	e8 cf 10 00 00       	call   1e7a <exit>
+  }
+  wait();
+     dab:	e8 d4 10 00 00       	call   1e84 <wait>
+  printf(stdout, "ipc ref test ok\n");
+     db0:	8b 05 da 27 00 00    	mov    0x27da(%rip),%eax        # 3590 <stdout>
+     db6:	48 c7 c6 e9 2d 00 00 	mov    $0x2de9,%rsi
+     dbd:	89 c7                	mov    %eax,%edi
+     dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc4:	e8 24 15 00 00       	call   22ed <printf>
+}
+     dc9:	90                   	nop
+     dca:	c9                   	leave
+     dcb:	c3                   	ret
+
+0000000000000dcc <ipctimetest>:
+
+// Polling, timeouts, and kill() of a blocked receiver.
+void
+ipctimetest(void)
+{
+     dcc:	55                   	push   %rbp
+     dcd:	48 89 e5             	mov    %rsp,%rbp
+     dd0:	48 83 ec 50          	sub    $0x50,%rsp
+  struct msg m;
+  int pid;
+
+  printf(stdout, "ipc timeout test\n");
+     dd4:	8b 05 b6 27 00 00    	mov    0x27b6(%rip),%eax        # 3590 <stdout>
+     dda:	48 c7 c6 fa 2d 00 00 	mov    $0x2dfa,%rsi
+     de1:	89 c7                	mov    %eax,%edi
+     de3:	b8 00 00 00 00       	mov    $0x0,%eax
+     de8:	e8 00 15 00 00       	call   22ed <printf>
+  if(try_recv(4, &m) != IPC_WOULDBLOCK || try_send(4, &m) != IPC_WOULDBLOCK){
+     ded:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     df1:	ba 00 00 00 00       	mov    $0x0,%edx
+     df6:	48 89 c6             	mov    %rax,%rsi
+     df9:	bf 04 00 00 00       	mov    $0x4,%edi
+     dfe:	e8 74 13 00 00       	call   2177 <recv_timed>
+     e03:	83 f8 fe             	cmp    $0xfffffffe,%eax
+     e06:	75 1b                	jne    e23 <ipctimetest+0x57>
+     e08:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     e0c:	ba 00 00 00 00       	mov    $0x0,%edx
+     e11:	48 89 c6             	mov    %rax,%rsi
+     e14:	bf 04 00 00 00       	mov    $0x4,%edi
+     e19:	e8 4f 13 00 00       	call   216d <send_timed>
+     e1e:	83 f8 fe             	cmp    $0xfffffffe,%eax
+     e21:	74 1e                	je     e41 <ipctimetest+0x75>
+    printf(stdout, "ipc poll blocked\n");
+     e23:	8b 05 67 27 00 00    	mov    0x2767(%rip),%eax        # 3590 <stdout>
+     e29:	48 c7 c6 0c 2e 00 00 	mov    $0x2e0c,%rsi
+     e30:	89 c7                	mov    %eax,%edi
+     e32:	b8 00 00 00 00       	mov    $0x0,%eax
+     e37:	e8 b1 14 00 00       	call   22ed <printf>
+    exit();
+     e3c:	e8 39 10 00 00       	call   1e7a <exit>
+  }
+  if(recv_timed(4, &m, 2) != IPC_TIMEOUT || send_timed(4, &m, 2) != IPC_TIMEOUT){
+     e41:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     e45:	ba 02 00 00 00       	mov    $0x2,%edx
+     e4a:	48 89 c6             	mov    %rax,%rsi
+     e4d:	bf 04 00 00 00       	mov    $0x4,%edi
+     e52:	e8 20 13 00 00       	call   2177 <recv_timed>
+     e57:	83 f8 fd             	cmp    $0xfffffffd,%eax
+     e5a:	75 1b                	jne    e77 <ipctimetest+0xab>
+     e5c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     e60:	ba 02 00 00 00       	mov    $0x2,%edx
+     e65:	48 89 c6             	mov    %rax,%rsi
+     e68:	bf 04 00 00 00       	mov    $0x4,%edi
+     e6d:	e8 fb 12 00 00       	call   216d <send_timed>
+     e72:	83 f8 fd             	cmp    $0xfffffffd,%eax
+     e75:	74 1e                	je     e95 <ipctimetest+0xc9>
+    printf(stdout, "ipc timeout failed\n");
+     e77:	8b 05 13 27 00 00    	mov    0x2713(%rip),%eax        # 3590 <stdout>
+     e7d:	48 c7 c6 1e 2e 00 00 	mov    $0x2e1e,%rsi
+     e84:	89 c7                	mov    %eax,%edi
+     e86:	b8 00 00 00 00       	mov    $0x0,%eax
+     e8b:	e8 5d 14 00 00       	call   22ed <printf>
+    exit();
+     e90:	e8 e5 0f 00 00       	call   1e7a <exit>
+  }
+  pid = fork();
+     e95:	e8 d6 0f 00 00       	call   1e70 <fork>
+     e9a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid < 0){
+     e9d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     ea1:	79 1e                	jns    ec1 <ipctimetest+0xf5>
+    printf(stdout, "fork failed\n");
+     ea3:	8b 05 e7 26 00 00    	mov    0x26e7(%rip),%eax        # 3590 <stdout>
+     ea9:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+     eb0:	89 c7                	mov    %eax,%edi
+     eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+     eb7:	e8 31 14 00 00       	call   22ed <printf>
+    exit();
+     ebc:	e8 b9 0f 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+     ec1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     ec5:	75 13                	jne    eda <ipctimetest+0x10e>
+    for(;;)
+      recv(4, &m);
+     ec7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     ecb:	48 89 c6             	mov    %rax,%rsi
+     ece:	bf 04 00 00 00       	mov    $0x4,%edi
+     ed3:	e8 6a 10 00 00       	call   1f42 <recv>
+     ed8:	eb ed                	jmp    ec7 <ipctimetest+0xfb>
+  }
+  sleep(2);
+     eda:	bf 02 00 00 00       	mov    $0x2,%edi
+     edf:	e8 40 10 00 00       	call   1f24 <sleep>
+  if(kill(pid) < 0 || wait() != pid){
+     ee4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ee7:	89 c7                	mov    %eax,%edi
+     ee9:	e8 c8 0f 00 00       	call   1eb6 <kill>
+     eee:	85 c0                	test   %eax,%eax
+     ef0:	78 0a                	js     efc <ipctimetest+0x130>
+     ef2:	e8 8d 0f 00 00       	call   1e84 <wait>
+     ef7:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     efa:	74 1e                	je     f1a <ipctimetest+0x14e>
+    printf(stdout, "ipc kill failed\n");
+     efc:	8b 05 8e 26 00 00    	mov    0x268e(%rip),%eax        # 3590 <stdout>
+     f02:	48 c7 c6 32 2e 00 00 	mov    $0x2e32,%rsi
+     f09:	89 c7                	mov    %eax,%edi
+     f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+     f10:	e8 d8 13 00 00       	call   22ed <printf>
+    exit();
+     f15:	e8 60 0f 00 00       	call   1e7a <exit>
+  }
+  if(try_send(4, &m) != IPC_WOULDBLOCK){
+     f1a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+     f23:	48 89 c6             	mov    %rax,%rsi
+     f26:	bf 04 00 00 00       	mov    $0x4,%edi
+     f2b:	e8 3d 12 00 00       	call   216d <send_timed>
+     f30:	83 f8 fe             	cmp    $0xfffffffe,%eax
+     f33:	74 1e                	je     f53 <ipctimetest+0x187>
+    printf(stdout, "killed receiver still queued\n");
+     f35:	8b 05 55 26 00 00    	mov    0x2655(%rip),%eax        # 3590 <stdout>
+     f3b:	48 c7 c6 43 2e 00 00 	mov    $0x2e43,%rsi
+     f42:	89 c7                	mov    %eax,%edi
+     f44:	b8 00 00 00 00       	mov    $0x0,%eax
+     f49:	e8 9f 13 00 00       	call   22ed <printf>
+    exit();
+     f4e:	e8 27 0f 00 00       	call   1e7a <exit>
+  }
+  printf(stdout, "ipc timeout test ok\n");
+     f53:	8b 05 37 26 00 00    	mov    0x2637(%rip),%eax        # 3590 <stdout>
+     f59:	48 c7 c6 61 2e 00 00 	mov    $0x2e61,%rsi
+     f60:	89 c7                	mov    %eax,%edi
+     f62:	b8 00 00 00 00       	mov    $0x0,%eax
+     f67:	e8 81 13 00 00       	call   22ed <printf>
+}
+     f6c:	90                   	nop
+     f6d:	c9                   	leave
+     f6e:	c3                   	ret
+
+0000000000000f6f <ipcsettest>:
+
+// One receiver serving a set of channels with recv_any().
+void
+ipcsettest(void)
+{
+     f6f:	55                   	push   %rbp
+     f70:	48 89 e5             	mov    %rsp,%rbp
+     f73:	48 83 ec 60          	sub    $0x60,%rsp
+  struct msg m;
+  int i, ch, ok, pid;
+
+  printf(stdout, "ipc set test\n");
+     f77:	8b 05 13 26 00 00    	mov    0x2613(%rip),%eax        # 3590 <stdout>
+     f7d:	48 c7 c6 76 2e 00 00 	mov    $0x2e76,%rsi
+     f84:	89 c7                	mov    %eax,%edi
+     f86:	b8 00 00 00 00       	mov    $0x0,%eax
+     f8b:	e8 5d 13 00 00       	call   22ed <printf>
+  if(set_add(5, 6) < 0 || set_add(5, 7) < 0){
+     f90:	be 06 00 00 00       	mov    $0x6,%esi
+     f95:	bf 05 00 00 00       	mov    $0x5,%edi
+     f9a:	e8 e2 11 00 00       	call   2181 <set_add>
+     f9f:	85 c0                	test   %eax,%eax
+     fa1:	78 13                	js     fb6 <ipcsettest+0x47>
+     fa3:	be 07 00 00 00       	mov    $0x7,%esi
+     fa8:	bf 05 00 00 00       	mov    $0x5,%edi
+     fad:	e8 cf 11 00 00       	call   2181 <set_add>
+     fb2:	85 c0                	test   %eax,%eax
+     fb4:	79 1e                	jns    fd4 <ipcsettest+0x65>
+    printf(stdout, "set_add failed\n");
+     fb6:	8b 05 d4 25 00 00    	mov    0x25d4(%rip),%eax        # 3590 <stdout>
+     fbc:	48 c7 c6 84 2e 00 00 	mov    $0x2e84,%rsi
+     fc3:	89 c7                	mov    %eax,%edi
+     fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+     fca:	e8 1e 13 00 00       	call   22ed <printf>
+    exit();
+     fcf:	e8 a6 0e 00 00       	call   1e7a <exit>
+  }
+  if(set_add(6, 5) != -1 || set_add(8, 6) != -1){
+     fd4:	be 05 00 00 00       	mov    $0x5,%esi
+     fd9:	bf 06 00 00 00       	mov    $0x6,%edi
+     fde:	e8 9e 11 00 00       	call   2181 <set_add>
+     fe3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fe6:	75 14                	jne    ffc <ipcsettest+0x8d>
+     fe8:	be 06 00 00 00       	mov    $0x6,%esi
+     fed:	bf 08 00 00 00       	mov    $0x8,%edi
+     ff2:	e8 8a 11 00 00       	call   2181 <set_add>
+     ff7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ffa:	74 1e                	je     101a <ipcsettest+0xab>
+    printf(stdout, "set_add allowed nesting\n");
+     ffc:	8b 05 8e 25 00 00    	mov    0x258e(%rip),%eax        # 3590 <stdout>
+    1002:	48 c7 c6 94 2e 00 00 	mov    $0x2e94,%rsi
+    1009:	89 c7                	mov    %eax,%edi
+    100b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1010:	e8 d8 12 00 00       	call   22ed <printf>
+    exit();
+    1015:	e8 60 0e 00 00       	call   1e7a <exit>
+  }
+  pid = fork();
+    101a:	e8 51 0e 00 00       	call   1e70 <fork>
+    101f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if(pid < 0){
+    1022:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1026:	79 1e                	jns    1046 <ipcsettest+0xd7>
+    printf(stdout, "fork failed\n");
+    1028:	8b 05 62 25 00 00    	mov    0x2562(%rip),%eax        # 3590 <stdout>
+    102e:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+    1035:	89 c7                	mov    %eax,%edi
+    1037:	b8 00 00 00 00       	mov    $0x0,%eax
+    103c:	e8 ac 12 00 00       	call   22ed <printf>
+    exit();
+    1041:	e8 34 0e 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+    1046:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    104a:	75 64                	jne    10b0 <ipcsettest+0x141>
+    ok = 0;
+    104c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    for(i = 0; i < 6; i++)
+    1053:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    105a:	eb 2f                	jmp    108b <ipcsettest+0x11c>
+      if(recv_any(5, &m, &ch) >= 0 && m.regs[0] == ch)
+    105c:	48 8d 55 ac          	lea    -0x54(%rbp),%rdx
+    1060:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1064:	48 89 c6             	mov    %rax,%rsi
+    1067:	bf 05 00 00 00       	mov    $0x5,%edi
+    106c:	e8 24 11 00 00       	call   2195 <recv_any>
+    1071:	85 c0                	test   %eax,%eax
+    1073:	78 12                	js     1087 <ipcsettest+0x118>
+    1075:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    1079:	8b 45 ac             	mov    -0x54(%rbp),%eax
+    107c:	48 98                	cltq
+    107e:	48 39 c2             	cmp    %rax,%rdx
+    1081:	75 04                	jne    1087 <ipcsettest+0x118>
+        ok++;
+    1083:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    for(i = 0; i < 6; i++)
+    1087:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    108b:	83 7d fc 05          	cmpl   $0x5,-0x4(%rbp)
+    108f:	7e cb                	jle    105c <ipcsettest+0xed>
+    m.regs[0] = ok;
+    1091:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1094:	48 98                	cltq
+    1096:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    send(8, &m);
+    109a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    109e:	48 89 c6             	mov    %rax,%rsi
+    10a1:	bf 08 00 00 00       	mov    $0x8,%edi
+    10a6:	e8 83 0e 00 00       	call   1f2e <send>
+    exit();
+    10ab:	e8 ca 0d 00 00       	call   1e7a <exit>
+  }
+  for(i = 0; i < 6; i++){
+    10b0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    10b7:	eb 46                	jmp    10ff <ipcsettest+0x190>
+    m.regs[0] = 5 + i % 3;
+    10b9:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+    10bc:	48 63 c1             	movslq %ecx,%rax
+    10bf:	48 69 c0 56 55 55 55 	imul   $0x55555556,%rax,%rax
+    10c6:	48 c1 e8 20          	shr    $0x20,%rax
+    10ca:	48 89 c2             	mov    %rax,%rdx
+    10cd:	89 c8                	mov    %ecx,%eax
+    10cf:	c1 f8 1f             	sar    $0x1f,%eax
+    10d2:	29 c2                	sub    %eax,%edx
+    10d4:	89 d0                	mov    %edx,%eax
+    10d6:	01 c0                	add    %eax,%eax
+    10d8:	01 d0                	add    %edx,%eax
+    10da:	29 c1                	sub    %eax,%ecx
+    10dc:	89 ca                	mov    %ecx,%edx
+    10de:	8d 42 05             	lea    0x5(%rdx),%eax
+    10e1:	48 98                	cltq
+    10e3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    send(m.regs[0], &m);
+    10e7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    10eb:	89 c2                	mov    %eax,%edx
+    10ed:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    10f1:	48 89 c6             	mov    %rax,%rsi
+    10f4:	89 d7                	mov    %edx,%edi
+    10f6:	e8 33 0e 00 00       	call   1f2e <send>
+  for(i = 0; i < 6; i++){
+    10fb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    10ff:	83 7d fc 05          	cmpl   $0x5,-0x4(%rbp)
+    1103:	7e b4                	jle    10b9 <ipcsettest+0x14a>
+  }
+  if(recv(8, &m) < 0 || m.regs[0] != 6){
+    1105:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1109:	48 89 c6             	mov    %rax,%rsi
+    110c:	bf 08 00 00 00       	mov    $0x8,%edi
+    1111:	e8 2c 0e 00 00       	call   1f42 <recv>
+    1116:	85 c0                	test   %eax,%eax
+    1118:	78 0a                	js     1124 <ipcsettest+0x1b5>
+    111a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    111e:	48 83 f8 06          	cmp    $0x6,%rax
+    1122:	74 1e                	je     1142 <ipcsettest+0x1d3>
+    printf(stdout, "recv_any got wrong channel\n");
+    1124:	8b 05 66 24 00 00    	mov    0x2466(%rip),%eax        # 3590 <stdout>
+    112a:	48 c7 c6 ad 2e 00 00 	mov    $0x2ead,%rsi
+    1131:	89 c7                	mov    %eax,%edi
+    1133:	b8 00 00 00 00       	mov    $0x0,%eax
+    1138:	e8 b0 11 00 00       	call   22ed <printf>
+    exit();
+    113d:	e8 38 0d 00 00       	call   1e7a <exit>
+  }
+  wait();
+    1142:	e8 3d 0d 00 00       	call   1e84 <wait>
+  if(set_del(6) < 0 || set_del(6) != -1 || set_del(7) < 0){
+    1147:	bf 06 00 00 00       	mov    $0x6,%edi
+    114c:	e8 3a 10 00 00       	call   218b <set_del>
+    1151:	85 c0                	test   %eax,%eax
+    1153:	78 1d                	js     1172 <ipcsettest+0x203>
+    1155:	bf 06 00 00 00       	mov    $0x6,%edi
+    115a:	e8 2c 10 00 00       	call   218b <set_del>
+    115f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1162:	75 0e                	jne    1172 <ipcsettest+0x203>
+    1164:	bf 07 00 00 00       	mov    $0x7,%edi
+    1169:	e8 1d 10 00 00       	call   218b <set_del>
+    116e:	85 c0                	test   %eax,%eax
+    1170:	79 1e                	jns    1190 <ipcsettest+0x221>
+    printf(stdout, "set_del failed\n");
+    1172:	8b 05 18 24 00 00    	mov    0x2418(%rip),%eax        # 3590 <stdout>
+    1178:	48 c7 c6 c9 2e 00 00 	mov    $0x2ec9,%rsi
+    117f:	89 c7                	mov    %eax,%edi
+    1181:	b8 00 00 00 00       	mov    $0x0,%eax
+    1186:	e8 62 11 00 00       	call   22ed <printf>
+    exit();
+    118b:	e8 ea 0c 00 00       	call   1e7a <exit>
+  }
+  printf(stdout, "ipc set test ok\n");
+    1190:	8b 05 fa 23 00 00    	mov    0x23fa(%rip),%eax        # 3590 <stdout>
+    1196:	48 c7 c6 d9 2e 00 00 	mov    $0x2ed9,%rsi
+    119d:	89 c7                	mov    %eax,%edi
+    119f:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a4:	e8 44 11 00 00       	call   22ed <printf>
+}
+    11a9:	90                   	nop
+    11aa:	c9                   	leave
+    11ab:	c3                   	ret
+
+00000000000011ac <ipchandletest>:
+
+// Endpoints created at run time and named by per-process handles.
+void
+ipchandletest(void)
+{
+    11ac:	55                   	push   %rbp
+    11ad:	48 89 e5             	mov    %rsp,%rbp
+    11b0:	48 81 ec e0 01 00 00 	sub    $0x1e0,%rsp
+  struct msg m;
+  int i, h, pid, tok;
+  int hs[100];
+
+  printf(stdout, "ipc handle test\n");
+    11b7:	8b 05 d3 23 00 00    	mov    0x23d3(%rip),%eax        # 3590 <stdout>
+    11bd:	48 c7 c6 ea 2e 00 00 	mov    $0x2eea,%rsi
+    11c4:	89 c7                	mov    %eax,%edi
+    11c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    11cb:	e8 1d 11 00 00       	call   22ed <printf>
+  for(i = 0; i < 100; i++){
+    11d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    11d7:	eb 45                	jmp    121e <ipchandletest+0x72>
+    if((hs[i] = ep_create()) < NENDS){
+    11d9:	e8 c1 0f 00 00       	call   219f <ep_create>
+    11de:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    11e1:	48 63 d2             	movslq %edx,%rdx
+    11e4:	89 84 95 20 fe ff ff 	mov    %eax,-0x1e0(%rbp,%rdx,4)
+    11eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11ee:	48 98                	cltq
+    11f0:	8b 84 85 20 fe ff ff 	mov    -0x1e0(%rbp,%rax,4),%eax
+    11f7:	83 f8 0f             	cmp    $0xf,%eax
+    11fa:	7f 1e                	jg     121a <ipchandletest+0x6e>
+      printf(stdout, "ep_create failed\n");
+    11fc:	8b 05 8e 23 00 00    	mov    0x238e(%rip),%eax        # 3590 <stdout>
+    1202:	48 c7 c6 fb 2e 00 00 	mov    $0x2efb,%rsi
+    1209:	89 c7                	mov    %eax,%edi
+    120b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1210:	e8 d8 10 00 00       	call   22ed <printf>
+      exit();
+    1215:	e8 60 0c 00 00       	call   1e7a <exit>
+  for(i = 0; i < 100; i++){
+    121a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    121e:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+    1222:	7e b5                	jle    11d9 <ipchandletest+0x2d>
+    }
+  }
+  for(i = 0; i < 100; i++)
+    1224:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    122b:	eb 17                	jmp    1244 <ipchandletest+0x98>
+    ep_close(hs[i]);
+    122d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1230:	48 98                	cltq
+    1232:	8b 84 85 20 fe ff ff 	mov    -0x1e0(%rbp,%rax,4),%eax
+    1239:	89 c7                	mov    %eax,%edi
+    123b:	e8 69 0f 00 00       	call   21a9 <ep_close>
+  for(i = 0; i < 100; i++)
+    1240:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1244:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+    1248:	7e e3                	jle    122d <ipchandletest+0x81>
+  h = ep_create();
+    124a:	e8 50 0f 00 00       	call   219f <ep_create>
+    124f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if(h != hs[0]){
+    1252:	8b 85 20 fe ff ff    	mov    -0x1e0(%rbp),%eax
+    1258:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+    125b:	74 1e                	je     127b <ipchandletest+0xcf>
+    printf(stdout, "ep_create did not reuse handle\n");
+    125d:	8b 05 2d 23 00 00    	mov    0x232d(%rip),%eax        # 3590 <stdout>
+    1263:	48 c7 c6 10 2f 00 00 	mov    $0x2f10,%rsi
+    126a:	89 c7                	mov    %eax,%edi
+    126c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1271:	e8 77 10 00 00       	call   22ed <printf>
+    exit();
+    1276:	e8 ff 0b 00 00       	call   1e7a <exit>
+  }
+  pid = fork();
+    127b:	e8 f0 0b 00 00       	call   1e70 <fork>
+    1280:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if(pid < 0){
+    1283:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1287:	79 1e                	jns    12a7 <ipchandletest+0xfb>
+    printf(stdout, "fork failed\n");
+    1289:	8b 05 01 23 00 00    	mov    0x2301(%rip),%eax        # 3590 <stdout>
+    128f:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+    1296:	89 c7                	mov    %eax,%edi
+    1298:	b8 00 00 00 00       	mov    $0x0,%eax
+    129d:	e8 4b 10 00 00       	call   22ed <printf>
+    exit();
+    12a2:	e8 d3 0b 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+    12a7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    12ab:	75 39                	jne    12e6 <ipchandletest+0x13a>
+    tok = recv(h, &m);
+    12ad:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    12b1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    12b4:	48 89 d6             	mov    %rdx,%rsi
+    12b7:	89 c7                	mov    %eax,%edi
+    12b9:	e8 84 0c 00 00       	call   1f42 <recv>
+    12be:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    m.regs[0]++;
+    12c1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    12c5:	48 83 c0 01          	add    $0x1,%rax
+    12c9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    reply_recv(h, &m, tok);
+    12cd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    12d0:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+    12d4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    12d7:	48 89 ce             	mov    %rcx,%rsi
+    12da:	89 c7                	mov    %eax,%edi
+    12dc:	e8 75 0c 00 00       	call   1f56 <reply_recv>
+    exit();
+    12e1:	e8 94 0b 00 00       	call   1e7a <exit>
+  }
+  m.regs[0] = 41;
+    12e6:	48 c7 45 b0 29 00 00 	movq   $0x29,-0x50(%rbp)
+    12ed:	00 
+  if(call(h, &m) != 1 || m.regs[0] != 42){
+    12ee:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    12f2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    12f5:	48 89 d6             	mov    %rdx,%rsi
+    12f8:	89 c7                	mov    %eax,%edi
+    12fa:	e8 4d 0c 00 00       	call   1f4c <call>
+    12ff:	83 f8 01             	cmp    $0x1,%eax
+    1302:	75 0a                	jne    130e <ipchandletest+0x162>
+    1304:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1308:	48 83 f8 2a          	cmp    $0x2a,%rax
+    130c:	74 1e                	je     132c <ipchandletest+0x180>
+    printf(stdout, "ipc on created endpoint failed\n");
+    130e:	8b 05 7c 22 00 00    	mov    0x227c(%rip),%eax        # 3590 <stdout>
+    1314:	48 c7 c6 30 2f 00 00 	mov    $0x2f30,%rsi
+    131b:	89 c7                	mov    %eax,%edi
+    131d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1322:	e8 c6 0f 00 00       	call   22ed <printf>
+    exit();
+    1327:	e8 4e 0b 00 00       	call   1e7a <exit>
+  }
+  send(h, &m);
+    132c:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1330:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1333:	48 89 d6             	mov    %rdx,%rsi
+    1336:	89 c7                	mov    %eax,%edi
+    1338:	e8 f1 0b 00 00       	call   1f2e <send>
+  wait();
+    133d:	e8 42 0b 00 00       	call   1e84 <wait>
+  if(ep_close(h) < 0 || ep_close(h) != -1 || send(h, &m) != -1 ||
+    1342:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1345:	89 c7                	mov    %eax,%edi
+    1347:	e8 5d 0e 00 00       	call   21a9 <ep_close>
+    134c:	85 c0                	test   %eax,%eax
+    134e:	78 3b                	js     138b <ipchandletest+0x1df>
+    1350:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1353:	89 c7                	mov    %eax,%edi
+    1355:	e8 4f 0e 00 00       	call   21a9 <ep_close>
+    135a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    135d:	75 2c                	jne    138b <ipchandletest+0x1df>
+    135f:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1363:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1366:	48 89 d6             	mov    %rdx,%rsi
+    1369:	89 c7                	mov    %eax,%edi
+    136b:	e8 be 0b 00 00       	call   1f2e <send>
+    1370:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1373:	75 16                	jne    138b <ipchandletest+0x1df>
+     send(NHANDLE, &m) != -1){
+    1375:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1379:	48 89 c6             	mov    %rax,%rsi
+    137c:	bf 80 00 00 00       	mov    $0x80,%edi
+    1381:	e8 a8 0b 00 00       	call   1f2e <send>
+  if(ep_close(h) < 0 || ep_close(h) != -1 || send(h, &m) != -1 ||
+    1386:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1389:	74 1e                	je     13a9 <ipchandletest+0x1fd>
+    printf(stdout, "ipc on closed handle succeeded\n");
+    138b:	8b 05 ff 21 00 00    	mov    0x21ff(%rip),%eax        # 3590 <stdout>
+    1391:	48 c7 c6 50 2f 00 00 	mov    $0x2f50,%rsi
+    1398:	89 c7                	mov    %eax,%edi
+    139a:	b8 00 00 00 00       	mov    $0x0,%eax
+    139f:	e8 49 0f 00 00       	call   22ed <printf>
+    exit();
+    13a4:	e8 d1 0a 00 00       	call   1e7a <exit>
+  }
+  printf(stdout, "ipc handle test ok\n");
+    13a9:	8b 05 e1 21 00 00    	mov    0x21e1(%rip),%eax        # 3590 <stdout>
+    13af:	48 c7 c6 70 2f 00 00 	mov    $0x2f70,%rsi
+    13b6:	89 c7                	mov    %eax,%edi
+    13b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    13bd:	e8 2b 0f 00 00       	call   22ed <printf>
+}
+    13c2:	90                   	nop
+    13c3:	c9                   	leave
+    13c4:	c3                   	ret
+
+00000000000013c5 <ipcbatchtest>:
+
+void
+ipcbatchtest(void)
+{
+    13c5:	55                   	push   %rbp
+    13c6:	48 89 e5             	mov    %rsp,%rbp
+    13c9:	48 81 ec e0 01 00 00 	sub    $0x1e0,%rsp
+  struct ipcop ops[5];
+  struct msg m;
+  int i, h, pid, tok;
+
+  printf(stdout, "ipc batch test\n");
+    13d0:	8b 05 ba 21 00 00    	mov    0x21ba(%rip),%eax        # 3590 <stdout>
+    13d6:	48 c7 c6 84 2f 00 00 	mov    $0x2f84,%rsi
+    13dd:	89 c7                	mov    %eax,%edi
+    13df:	b8 00 00 00 00       	mov    $0x0,%eax
+    13e4:	e8 04 0f 00 00       	call   22ed <printf>
+  h = ep_create();
+    13e9:	e8 b1 0d 00 00       	call   219f <ep_create>
+    13ee:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  pid = fork();
+    13f1:	e8 7a 0a 00 00       	call   1e70 <fork>
+    13f6:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  if(pid < 0){
+    13f9:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+    13fd:	79 1e                	jns    141d <ipcbatchtest+0x58>
+    printf(stdout, "fork failed\n");
+    13ff:	8b 05 8b 21 00 00    	mov    0x218b(%rip),%eax        # 3590 <stdout>
+    1405:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+    140c:	89 c7                	mov    %eax,%edi
+    140e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1413:	e8 d5 0e 00 00       	call   22ed <printf>
+    exit();
+    1418:	e8 5d 0a 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+    141d:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+    1421:	75 50                	jne    1473 <ipcbatchtest+0xae>
+    tok = recv(h, &m);
+    1423:	48 8d 95 20 fe ff ff 	lea    -0x1e0(%rbp),%rdx
+    142a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    142d:	48 89 d6             	mov    %rdx,%rsi
+    1430:	89 c7                	mov    %eax,%edi
+    1432:	e8 0b 0b 00 00       	call   1f42 <recv>
+    1437:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    while(tok > 0){
+    143a:	eb 2c                	jmp    1468 <ipcbatchtest+0xa3>
+      m.regs[0]++;
+    143c:	48 8b 85 20 fe ff ff 	mov    -0x1e0(%rbp),%rax
+    1443:	48 83 c0 01          	add    $0x1,%rax
+    1447:	48 89 85 20 fe ff ff 	mov    %rax,-0x1e0(%rbp)
+      tok = reply_recv(h, &m, tok);
+    144e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1451:	48 8d 8d 20 fe ff ff 	lea    -0x1e0(%rbp),%rcx
+    1458:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    145b:	48 89 ce             	mov    %rcx,%rsi
+    145e:	89 c7                	mov    %eax,%edi
+    1460:	e8 f1 0a 00 00       	call   1f56 <reply_recv>
+    1465:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    while(tok > 0){
+    1468:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    146c:	7f ce                	jg     143c <ipcbatchtest+0x77>
+    }
+    exit();
+    146e:	e8 07 0a 00 00       	call   1e7a <exit>
+  }
+  for(i = 0; i < 4; i++){
+    1473:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    147a:	eb 79                	jmp    14f5 <ipcbatchtest+0x130>
+    ops[i].op = IPCOP_CALL;
+    147c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    147f:	48 63 d0             	movslq %eax,%rdx
+    1482:	48 89 d0             	mov    %rdx,%rax
+    1485:	48 c1 e0 02          	shl    $0x2,%rax
+    1489:	48 01 d0             	add    %rdx,%rax
+    148c:	48 c1 e0 04          	shl    $0x4,%rax
+    1490:	48 01 e8             	add    %rbp,%rax
+    1493:	48 2d a0 01 00 00    	sub    $0x1a0,%rax
+    1499:	c7 00 04 00 00 00    	movl   $0x4,(%rax)
+    ops[i].ch = h;
+    149f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14a2:	48 63 d0             	movslq %eax,%rdx
+    14a5:	48 89 d0             	mov    %rdx,%rax
+    14a8:	48 c1 e0 02          	shl    $0x2,%rax
+    14ac:	48 01 d0             	add    %rdx,%rax
+    14af:	48 c1 e0 04          	shl    $0x4,%rax
+    14b3:	48 01 e8             	add    %rbp,%rax
+    14b6:	48 8d 90 64 fe ff ff 	lea    -0x19c(%rax),%rdx
+    14bd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    14c0:	89 02                	mov    %eax,(%rdx)
+    ops[i].m.regs[0] = 10*i;
+    14c2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    14c5:	89 d0                	mov    %edx,%eax
+    14c7:	c1 e0 02             	shl    $0x2,%eax
+    14ca:	01 d0                	add    %edx,%eax
+    14cc:	01 c0                	add    %eax,%eax
+    14ce:	48 63 c8             	movslq %eax,%rcx
+    14d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14d4:	48 63 d0             	movslq %eax,%rdx
+    14d7:	48 89 d0             	mov    %rdx,%rax
+    14da:	48 c1 e0 02          	shl    $0x2,%rax
+    14de:	48 01 d0             	add    %rdx,%rax
+    14e1:	48 c1 e0 04          	shl    $0x4,%rax
+    14e5:	48 01 e8             	add    %rbp,%rax
+    14e8:	48 2d 90 01 00 00    	sub    $0x190,%rax
+    14ee:	48 89 08             	mov    %rcx,(%rax)
+  for(i = 0; i < 4; i++){
+    14f1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    14f5:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+    14f9:	7e 81                	jle    147c <ipcbatchtest+0xb7>
+  }
+  ops[4].op = IPCOP_SEND;
+    14fb:	c7 45 a0 01 00 00 00 	movl   $0x1,-0x60(%rbp)
+  ops[4].ch = h;
+    1502:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1505:	89 45 a4             	mov    %eax,-0x5c(%rbp)
+  ops[4].arg = -1;
+    1508:	c7 45 a8 ff ff ff ff 	movl   $0xffffffff,-0x58(%rbp)
+  if(ipc_batch(ops, 5) != 5){
+    150f:	48 8d 85 60 fe ff ff 	lea    -0x1a0(%rbp),%rax
+    1516:	be 05 00 00 00       	mov    $0x5,%esi
+    151b:	48 89 c7             	mov    %rax,%rdi
+    151e:	e8 a4 0c 00 00       	call   21c7 <ipc_batch>
+    1523:	83 f8 05             	cmp    $0x5,%eax
+    1526:	74 1e                	je     1546 <ipcbatchtest+0x181>
+    printf(stdout, "ipc_batch stopped early\n");
+    1528:	8b 05 62 20 00 00    	mov    0x2062(%rip),%eax        # 3590 <stdout>
+    152e:	48 c7 c6 94 2f 00 00 	mov    $0x2f94,%rsi
+    1535:	89 c7                	mov    %eax,%edi
+    1537:	b8 00 00 00 00       	mov    $0x0,%eax
+    153c:	e8 ac 0d 00 00       	call   22ed <printf>
+    exit();
+    1541:	e8 34 09 00 00       	call   1e7a <exit>
+  }
+  for(i = 0; i < 4; i++){
+    1546:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    154d:	eb 7f                	jmp    15ce <ipcbatchtest+0x209>
+    if(ops[i].ret != 1 || ops[i].m.regs[0] != 10*i + 1){
+    154f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1552:	48 63 d0             	movslq %eax,%rdx
+    1555:	48 89 d0             	mov    %rdx,%rax
+    1558:	48 c1 e0 02          	shl    $0x2,%rax
+    155c:	48 01 d0             	add    %rdx,%rax
+    155f:	48 c1 e0 04          	shl    $0x4,%rax
+    1563:	48 01 e8             	add    %rbp,%rax
+    1566:	48 2d 94 01 00 00    	sub    $0x194,%rax
+    156c:	8b 00                	mov    (%rax),%eax
+    156e:	83 f8 01             	cmp    $0x1,%eax
+    1571:	75 36                	jne    15a9 <ipcbatchtest+0x1e4>
+    1573:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1576:	48 63 d0             	movslq %eax,%rdx
+    1579:	48 89 d0             	mov    %rdx,%rax
+    157c:	48 c1 e0 02          	shl    $0x2,%rax
+    1580:	48 01 d0             	add    %rdx,%rax
+    1583:	48 c1 e0 04          	shl    $0x4,%rax
+    1587:	48 01 e8             	add    %rbp,%rax
+    158a:	48 2d 90 01 00 00    	sub    $0x190,%rax
+    1590:	48 8b 08             	mov    (%rax),%rcx
+    1593:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1596:	89 d0                	mov    %edx,%eax
+    1598:	c1 e0 02             	shl    $0x2,%eax
+    159b:	01 d0                	add    %edx,%eax
+    159d:	01 c0                	add    %eax,%eax
+    159f:	83 c0 01             	add    $0x1,%eax
+    15a2:	48 98                	cltq
+    15a4:	48 39 c1             	cmp    %rax,%rcx
+    15a7:	74 21                	je     15ca <ipcbatchtest+0x205>
+      printf(stdout, "ipc_batch call %d failed\n", i);
+    15a9:	8b 05 e1 1f 00 00    	mov    0x1fe1(%rip),%eax        # 3590 <stdout>
+    15af:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    15b2:	48 c7 c6 ad 2f 00 00 	mov    $0x2fad,%rsi
+    15b9:	89 c7                	mov    %eax,%edi
+    15bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    15c0:	e8 28 0d 00 00       	call   22ed <printf>
+      exit();
+    15c5:	e8 b0 08 00 00       	call   1e7a <exit>
+  for(i = 0; i < 4; i++){
+    15ca:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    15ce:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+    15d2:	0f 8e 77 ff ff ff    	jle    154f <ipcbatchtest+0x18a>
+    }
+  }
+  wait();
+    15d8:	e8 a7 08 00 00       	call   1e84 <wait>
+  ops[0].op = IPCOP_SEND;
+    15dd:	c7 85 60 fe ff ff 01 	movl   $0x1,-0x1a0(%rbp)
+    15e4:	00 00 00 
+  ops[0].arg = 0;
+    15e7:	c7 85 68 fe ff ff 00 	movl   $0x0,-0x198(%rbp)
+    15ee:	00 00 00 
+  ops[1].op = 0;
+    15f1:	c7 85 b0 fe ff ff 00 	movl   $0x0,-0x150(%rbp)
+    15f8:	00 00 00 
+  if(ipc_batch(ops, 2) != 0 || ops[0].ret != IPC_WOULDBLOCK ||
+    15fb:	48 8d 85 60 fe ff ff 	lea    -0x1a0(%rbp),%rax
+    1602:	be 02 00 00 00       	mov    $0x2,%esi
+    1607:	48 89 c7             	mov    %rax,%rdi
+    160a:	e8 b8 0b 00 00       	call   21c7 <ipc_batch>
+    160f:	85 c0                	test   %eax,%eax
+    1611:	75 24                	jne    1637 <ipcbatchtest+0x272>
+    1613:	8b 85 6c fe ff ff    	mov    -0x194(%rbp),%eax
+    1619:	83 f8 fe             	cmp    $0xfffffffe,%eax
+    161c:	75 19                	jne    1637 <ipcbatchtest+0x272>
+     ipc_batch(ops, IPC_MAXBATCH + 1) != -1){
+    161e:	48 8d 85 60 fe ff ff 	lea    -0x1a0(%rbp),%rax
+    1625:	be 41 00 00 00       	mov    $0x41,%esi
+    162a:	48 89 c7             	mov    %rax,%rdi
+    162d:	e8 95 0b 00 00       	call   21c7 <ipc_batch>
+  if(ipc_batch(ops, 2) != 0 || ops[0].ret != IPC_WOULDBLOCK ||
+    1632:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1635:	74 1e                	je     1655 <ipcbatchtest+0x290>
+    printf(stdout, "ipc_batch error handling failed\n");
+    1637:	8b 05 53 1f 00 00    	mov    0x1f53(%rip),%eax        # 3590 <stdout>
+    163d:	48 c7 c6 c8 2f 00 00 	mov    $0x2fc8,%rsi
+    1644:	89 c7                	mov    %eax,%edi
+    1646:	b8 00 00 00 00       	mov    $0x0,%eax
+    164b:	e8 9d 0c 00 00       	call   22ed <printf>
+    exit();
+    1650:	e8 25 08 00 00       	call   1e7a <exit>
+  }
+  ep_close(h);
+    1655:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1658:	89 c7                	mov    %eax,%edi
+    165a:	e8 4a 0b 00 00       	call   21a9 <ep_close>
+  printf(stdout, "ipc batch test ok\n");
+    165f:	8b 05 2b 1f 00 00    	mov    0x1f2b(%rip),%eax        # 3590 <stdout>
+    1665:	48 c7 c6 e9 2f 00 00 	mov    $0x2fe9,%rsi
+    166c:	89 c7                	mov    %eax,%edi
+    166e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1673:	e8 75 0c 00 00       	call   22ed <printf>
+}
+    1678:	90                   	nop
+    1679:	c9                   	leave
+    167a:	c3                   	ret
+
+000000000000167b <ipcfdtest>:
+
+void
+ipcfdtest(void)
+{
+    167b:	55                   	push   %rbp
+    167c:	48 89 e5             	mov    %rsp,%rbp
+    167f:	48 83 ec 70          	sub    $0x70,%rsp
+  struct msg m;
+  char buf[2];
+  int fds[2], h, h2, pid, tok, ok;
+
+  printf(stdout, "ipc fd test\n");
+    1683:	8b 05 07 1f 00 00    	mov    0x1f07(%rip),%eax        # 3590 <stdout>
+    1689:	48 c7 c6 fc 2f 00 00 	mov    $0x2ffc,%rsi
+    1690:	89 c7                	mov    %eax,%edi
+    1692:	b8 00 00 00 00       	mov    $0x0,%eax
+    1697:	e8 51 0c 00 00       	call   22ed <printf>
+  h = ep_create();
+    169c:	e8 fe 0a 00 00       	call   219f <ep_create>
+    16a1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  pid = fork();
+    16a4:	e8 c7 07 00 00       	call   1e70 <fork>
+    16a9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if(pid < 0){
+    16ac:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    16b0:	79 1e                	jns    16d0 <ipcfdtest+0x55>
+    printf(stdout, "fork failed\n");
+    16b2:	8b 05 d8 1e 00 00    	mov    0x1ed8(%rip),%eax        # 3590 <stdout>
+    16b8:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+    16bf:	89 c7                	mov    %eax,%edi
+    16c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    16c6:	e8 22 0c 00 00       	call   22ed <printf>
+    exit();
+    16cb:	e8 aa 07 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+    16d0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    16d4:	0f 85 9b 00 00 00    	jne    1775 <ipcfdtest+0xfa>
+    tok = recv(h, &m);
+    16da:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    16de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16e1:	48 89 d6             	mov    %rdx,%rsi
+    16e4:	89 c7                	mov    %eax,%edi
+    16e6:	e8 57 08 00 00       	call   1f42 <recv>
+    16eb:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    ok = (int)m.regs[SX_FDREG] >= 0 && read(m.regs[SX_FDREG], buf, 2) == 2 &&
+    16ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+         buf[0] == 'h' && buf[1] == 'i';
+    16f2:	85 c0                	test   %eax,%eax
+    16f4:	78 35                	js     172b <ipcfdtest+0xb0>
+    ok = (int)m.regs[SX_FDREG] >= 0 && read(m.regs[SX_FDREG], buf, 2) == 2 &&
+    16f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    16fa:	89 c1                	mov    %eax,%ecx
+    16fc:	48 8d 45 9e          	lea    -0x62(%rbp),%rax
+    1700:	ba 02 00 00 00       	mov    $0x2,%edx
+    1705:	48 89 c6             	mov    %rax,%rsi
+    1708:	89 cf                	mov    %ecx,%edi
+    170a:	e8 89 07 00 00       	call   1e98 <read>
+    170f:	83 f8 02             	cmp    $0x2,%eax
+    1712:	75 17                	jne    172b <ipcfdtest+0xb0>
+         buf[0] == 'h' && buf[1] == 'i';
+    1714:	0f b6 45 9e          	movzbl -0x62(%rbp),%eax
+    ok = (int)m.regs[SX_FDREG] >= 0 && read(m.regs[SX_FDREG], buf, 2) == 2 &&
+    1718:	3c 68                	cmp    $0x68,%al
+    171a:	75 0f                	jne    172b <ipcfdtest+0xb0>
+         buf[0] == 'h' && buf[1] == 'i';
+    171c:	0f b6 45 9f          	movzbl -0x61(%rbp),%eax
+    1720:	3c 69                	cmp    $0x69,%al
+    1722:	75 07                	jne    172b <ipcfdtest+0xb0>
+    1724:	b8 01 00 00 00       	mov    $0x1,%eax
+    1729:	eb 05                	jmp    1730 <ipcfdtest+0xb5>
+    172b:	b8 00 00 00 00       	mov    $0x0,%eax
+    ok = (int)m.regs[SX_FDREG] >= 0 && read(m.regs[SX_FDREG], buf, 2) == 2 &&
+    1730:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    h2 = m.regs[SX_EPREG];
+    1733:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1737:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    m.regs[0] = ok;
+    173a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    173d:	48 98                	cltq
+    173f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    reply_recv(h, &m, tok);
+    1743:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1746:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+    174a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    174d:	48 89 ce             	mov    %rcx,%rsi
+    1750:	89 c7                	mov    %eax,%edi
+    1752:	e8 ff 07 00 00       	call   1f56 <reply_recv>
+    m.regs[0] = 99;
+    1757:	48 c7 45 a0 63 00 00 	movq   $0x63,-0x60(%rbp)
+    175e:	00 
+    send(h2, &m);
+    175f:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    1763:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1766:	48 89 d6             	mov    %rdx,%rsi
+    1769:	89 c7                	mov    %eax,%edi
+    176b:	e8 be 07 00 00       	call   1f2e <send>
+    exit();
+    1770:	e8 05 07 00 00       	call   1e7a <exit>
+  }
+  // Open both after the fork so the child can only get them by IPC.
+  if(pipe(fds) != 0){
+    1775:	48 8d 45 94          	lea    -0x6c(%rbp),%rax
+    1779:	48 89 c7             	mov    %rax,%rdi
+    177c:	e8 0d 07 00 00       	call   1e8e <pipe>
+    1781:	85 c0                	test   %eax,%eax
+    1783:	74 1e                	je     17a3 <ipcfdtest+0x128>
+    printf(stdout, "pipe failed\n");
+    1785:	8b 05 05 1e 00 00    	mov    0x1e05(%rip),%eax        # 3590 <stdout>
+    178b:	48 c7 c6 09 30 00 00 	mov    $0x3009,%rsi
+    1792:	89 c7                	mov    %eax,%edi
+    1794:	b8 00 00 00 00       	mov    $0x0,%eax
+    1799:	e8 4f 0b 00 00       	call   22ed <printf>
+    exit();
+    179e:	e8 d7 06 00 00       	call   1e7a <exit>
+  }
+  h2 = ep_create();
+    17a3:	e8 f7 09 00 00       	call   219f <ep_create>
+    17a8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  write(fds[1], "hi", 2);
+    17ab:	8b 45 98             	mov    -0x68(%rbp),%eax
+    17ae:	ba 02 00 00 00       	mov    $0x2,%edx
+    17b3:	48 c7 c6 16 30 00 00 	mov    $0x3016,%rsi
+    17ba:	89 c7                	mov    %eax,%edi
+    17bc:	e8 e1 06 00 00       	call   1ea2 <write>
+  m.regs[SX_FDREG] = fds[0];
+    17c1:	8b 45 94             	mov    -0x6c(%rbp),%eax
+    17c4:	48 98                	cltq
+    17c6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  m.regs[SX_EPREG] = h2;
+    17ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    17cd:	48 98                	cltq
+    17cf:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  if(sendx(h, &m, SX_FD|SX_EP|SX_CALL) != 1 || m.regs[0] != 1){
+    17d3:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+    17d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17da:	ba 1c 00 00 00       	mov    $0x1c,%edx
+    17df:	48 89 ce             	mov    %rcx,%rsi
+    17e2:	89 c7                	mov    %eax,%edi
+    17e4:	e8 5c 09 00 00       	call   2145 <sendx>
+    17e9:	83 f8 01             	cmp    $0x1,%eax
+    17ec:	75 0a                	jne    17f8 <ipcfdtest+0x17d>
+    17ee:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    17f2:	48 83 f8 01          	cmp    $0x1,%rax
+    17f6:	74 1e                	je     1816 <ipcfdtest+0x19b>
+    printf(stdout, "ipc fd transfer failed\n");
+    17f8:	8b 05 92 1d 00 00    	mov    0x1d92(%rip),%eax        # 3590 <stdout>
+    17fe:	48 c7 c6 19 30 00 00 	mov    $0x3019,%rsi
+    1805:	89 c7                	mov    %eax,%edi
+    1807:	b8 00 00 00 00       	mov    $0x0,%eax
+    180c:	e8 dc 0a 00 00       	call   22ed <printf>
+    exit();
+    1811:	e8 64 06 00 00       	call   1e7a <exit>
+  }
+  send(h, &m);
+    1816:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    181a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    181d:	48 89 d6             	mov    %rdx,%rsi
+    1820:	89 c7                	mov    %eax,%edi
+    1822:	e8 07 07 00 00       	call   1f2e <send>
+  if(recv(h2, &m) != 0 || m.regs[0] != 99){
+    1827:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    182b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    182e:	48 89 d6             	mov    %rdx,%rsi
+    1831:	89 c7                	mov    %eax,%edi
+    1833:	e8 0a 07 00 00       	call   1f42 <recv>
+    1838:	85 c0                	test   %eax,%eax
+    183a:	75 0a                	jne    1846 <ipcfdtest+0x1cb>
+    183c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    1840:	48 83 f8 63          	cmp    $0x63,%rax
+    1844:	74 1e                	je     1864 <ipcfdtest+0x1e9>
+    printf(stdout, "ipc handle transfer failed\n");
+    1846:	8b 05 44 1d 00 00    	mov    0x1d44(%rip),%eax        # 3590 <stdout>
+    184c:	48 c7 c6 31 30 00 00 	mov    $0x3031,%rsi
+    1853:	89 c7                	mov    %eax,%edi
+    1855:	b8 00 00 00 00       	mov    $0x0,%eax
+    185a:	e8 8e 0a 00 00       	call   22ed <printf>
+    exit();
+    185f:	e8 16 06 00 00       	call   1e7a <exit>
+  }
+  wait();
+    1864:	e8 1b 06 00 00       	call   1e84 <wait>
+  m.regs[SX_FDREG] = NOFILE;
+    1869:	48 c7 45 d8 10 00 00 	movq   $0x10,-0x28(%rbp)
+    1870:	00 
+  if(sendx(h, &m, SX_FD) != -1){
+    1871:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+    1875:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1878:	ba 08 00 00 00       	mov    $0x8,%edx
+    187d:	48 89 ce             	mov    %rcx,%rsi
+    1880:	89 c7                	mov    %eax,%edi
+    1882:	e8 be 08 00 00       	call   2145 <sendx>
+    1887:	83 f8 ff             	cmp    $0xffffffff,%eax
+    188a:	74 1e                	je     18aa <ipcfdtest+0x22f>
+    printf(stdout, "sendx of bad fd succeeded\n");
+    188c:	8b 05 fe 1c 00 00    	mov    0x1cfe(%rip),%eax        # 3590 <stdout>
+    1892:	48 c7 c6 4d 30 00 00 	mov    $0x304d,%rsi
+    1899:	89 c7                	mov    %eax,%edi
+    189b:	b8 00 00 00 00       	mov    $0x0,%eax
+    18a0:	e8 48 0a 00 00       	call   22ed <printf>
+    exit();
+    18a5:	e8 d0 05 00 00       	call   1e7a <exit>
+  }
+  close(fds[0]);
+    18aa:	8b 45 94             	mov    -0x6c(%rbp),%eax
+    18ad:	89 c7                	mov    %eax,%edi
+    18af:	e8 f8 05 00 00       	call   1eac <close>
+  close(fds[1]);
+    18b4:	8b 45 98             	mov    -0x68(%rbp),%eax
+    18b7:	89 c7                	mov    %eax,%edi
+    18b9:	e8 ee 05 00 00       	call   1eac <close>
+  ep_close(h2);
+    18be:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    18c1:	89 c7                	mov    %eax,%edi
+    18c3:	e8 e1 08 00 00       	call   21a9 <ep_close>
+  ep_close(h);
+    18c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    18cb:	89 c7                	mov    %eax,%edi
+    18cd:	e8 d7 08 00 00       	call   21a9 <ep_close>
+  printf(stdout, "ipc fd test ok\n");
+    18d2:	8b 05 b8 1c 00 00    	mov    0x1cb8(%rip),%eax        # 3590 <stdout>
+    18d8:	48 c7 c6 68 30 00 00 	mov    $0x3068,%rsi
+    18df:	89 c7                	mov    %eax,%edi
+    18e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    18e6:	e8 02 0a 00 00       	call   22ed <printf>
+}
+    18eb:	90                   	nop
+    18ec:	c9                   	leave
+    18ed:	c3                   	ret
+
+00000000000018ee <vdsotest>:
+
+void
+vdsotest(void)
+{
+    18ee:	55                   	push   %rbp
+    18ef:	48 89 e5             	mov    %rsp,%rbp
+    18f2:	53                   	push   %rbx
+    18f3:	48 83 ec 28          	sub    $0x28,%rsp
+  int fds[2], pid, cpid, t;
+
+  printf(stdout, "vdso test\n");
+    18f7:	8b 05 93 1c 00 00    	mov    0x1c93(%rip),%eax        # 3590 <stdout>
+    18fd:	48 c7 c6 78 30 00 00 	mov    $0x3078,%rsi
+    1904:	89 c7                	mov    %eax,%edi
+    1906:	b8 00 00 00 00       	mov    $0x0,%eax
+    190b:	e8 dd 09 00 00       	call   22ed <printf>
+  if(pipe(fds) != 0){
+    1910:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1914:	48 89 c7             	mov    %rax,%rdi
+    1917:	e8 72 05 00 00       	call   1e8e <pipe>
+    191c:	85 c0                	test   %eax,%eax
+    191e:	74 1e                	je     193e <vdsotest+0x50>
+    printf(stdout, "pipe failed\n");
+    1920:	8b 05 6a 1c 00 00    	mov    0x1c6a(%rip),%eax        # 3590 <stdout>
+    1926:	48 c7 c6 09 30 00 00 	mov    $0x3009,%rsi
+    192d:	89 c7                	mov    %eax,%edi
+    192f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1934:	e8 b4 09 00 00       	call   22ed <printf>
+    exit();
+    1939:	e8 3c 05 00 00       	call   1e7a <exit>
+  }
+  pid = fork();
+    193e:	e8 2d 05 00 00       	call   1e70 <fork>
+    1943:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(pid < 0){
+    1946:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    194a:	79 1e                	jns    196a <vdsotest+0x7c>
+    printf(stdout, "fork failed\n");
+    194c:	8b 05 3e 1c 00 00    	mov    0x1c3e(%rip),%eax        # 3590 <stdout>
+    1952:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+    1959:	89 c7                	mov    %eax,%edi
+    195b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1960:	e8 88 09 00 00       	call   22ed <printf>
+    exit();
+    1965:	e8 10 05 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+    196a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    196e:	75 23                	jne    1993 <vdsotest+0xa5>
+    cpid = getpid();
+    1970:	e8 18 11 00 00       	call   2a8d <getpid>
+    1975:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    write(fds[1], &cpid, sizeof(cpid));
+    1978:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    197b:	48 8d 4d dc          	lea    -0x24(%rbp),%rcx
+    197f:	ba 04 00 00 00       	mov    $0x4,%edx
+    1984:	48 89 ce             	mov    %rcx,%rsi
+    1987:	89 c7                	mov    %eax,%edi
+    1989:	e8 14 05 00 00       	call   1ea2 <write>
+    exit();
+    198e:	e8 e7 04 00 00       	call   1e7a <exit>
+  }
+  if(read(fds[0], &cpid, sizeof(cpid)) != sizeof(cpid) || cpid != pid){
+    1993:	8b 45 e0             	mov    -0x20(%rbp),%eax
+    1996:	48 8d 4d dc          	lea    -0x24(%rbp),%rcx
+    199a:	ba 04 00 00 00       	mov    $0x4,%edx
+    199f:	48 89 ce             	mov    %rcx,%rsi
+    19a2:	89 c7                	mov    %eax,%edi
+    19a4:	e8 ef 04 00 00       	call   1e98 <read>
+    19a9:	83 f8 04             	cmp    $0x4,%eax
+    19ac:	75 08                	jne    19b6 <vdsotest+0xc8>
+    19ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19b1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    19b4:	74 1e                	je     19d4 <vdsotest+0xe6>
+    printf(stdout, "vdso getpid wrong in child\n");
+    19b6:	8b 05 d4 1b 00 00    	mov    0x1bd4(%rip),%eax        # 3590 <stdout>
+    19bc:	48 c7 c6 83 30 00 00 	mov    $0x3083,%rsi
+    19c3:	89 c7                	mov    %eax,%edi
+    19c5:	b8 00 00 00 00       	mov    $0x0,%eax
+    19ca:	e8 1e 09 00 00       	call   22ed <printf>
+    exit();
+    19cf:	e8 a6 04 00 00       	call   1e7a <exit>
+  }
+  wait();
+    19d4:	e8 ab 04 00 00       	call   1e84 <wait>
+  close(fds[0]);
+    19d9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+    19dc:	89 c7                	mov    %eax,%edi
+    19de:	e8 c9 04 00 00       	call   1eac <close>
+  close(fds[1]);
+    19e3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    19e6:	89 c7                	mov    %eax,%edi
+    19e8:	e8 bf 04 00 00       	call   1eac <close>
+  t = uptime();
+    19ed:	e8 8e 10 00 00       	call   2a80 <uptime>
+    19f2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  sleep(2);
+    19f5:	bf 02 00 00 00       	mov    $0x2,%edi
+    19fa:	e8 25 05 00 00       	call   1f24 <sleep>
+  if(uptime() < t + 2){
+    19ff:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1a02:	8d 58 01             	lea    0x1(%rax),%ebx
+    1a05:	e8 76 10 00 00       	call   2a80 <uptime>
+    1a0a:	39 c3                	cmp    %eax,%ebx
+    1a0c:	7c 1e                	jl     1a2c <vdsotest+0x13e>
+    printf(stdout, "vdso uptime did not advance\n");
+    1a0e:	8b 05 7c 1b 00 00    	mov    0x1b7c(%rip),%eax        # 3590 <stdout>
+    1a14:	48 c7 c6 9f 30 00 00 	mov    $0x309f,%rsi
+    1a1b:	89 c7                	mov    %eax,%edi
+    1a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a22:	e8 c6 08 00 00       	call   22ed <printf>
+    exit();
+    1a27:	e8 4e 04 00 00       	call   1e7a <exit>
+  }
+  printf(stdout, "vdso test ok\n");
+    1a2c:	8b 05 5e 1b 00 00    	mov    0x1b5e(%rip),%eax        # 3590 <stdout>
+    1a32:	48 c7 c6 bc 30 00 00 	mov    $0x30bc,%rsi
+    1a39:	89 c7                	mov    %eax,%edi
+    1a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a40:	e8 a8 08 00 00       	call   22ed <printf>
+}
+    1a45:	90                   	nop
+    1a46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1a4a:	c9                   	leave
+    1a4b:	c3                   	ret
+
+0000000000001a4c <fstest>:
+
+// The kernel finds its per-CPU data through %fs; reloading it
+// from user space must not break system calls or traps.
+void
+fstest(void)
+{
+    1a4c:	55                   	push   %rbp
+    1a4d:	48 89 e5             	mov    %rsp,%rbp
+    1a50:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid;
+
+  printf(stdout, "fs test\n");
+    1a54:	8b 05 36 1b 00 00    	mov    0x1b36(%rip),%eax        # 3590 <stdout>
+    1a5a:	48 c7 c6 ca 30 00 00 	mov    $0x30ca,%rsi
+    1a61:	89 c7                	mov    %eax,%edi
+    1a63:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a68:	e8 80 08 00 00       	call   22ed <printf>
+  pid = fork();
+    1a6d:	e8 fe 03 00 00       	call   1e70 <fork>
+    1a72:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid < 0){
+    1a75:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1a79:	79 1e                	jns    1a99 <fstest+0x4d>
+    printf(stdout, "fork failed\n");
+    1a7b:	8b 05 0f 1b 00 00    	mov    0x1b0f(%rip),%eax        # 3590 <stdout>
+    1a81:	48 c7 c6 f0 2a 00 00 	mov    $0x2af0,%rsi
+    1a88:	89 c7                	mov    %eax,%edi
+    1a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a8f:	e8 59 08 00 00       	call   22ed <printf>
+    exit();
+    1a94:	e8 e1 03 00 00       	call   1e7a <exit>
+  }
+  if(pid == 0){
+    1a99:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1a9d:	75 44                	jne    1ae3 <fstest+0x97>
+    asm volatile("movw %0, %%fs" : : "r" ((ushort)0));
+    1a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1aa4:	8e e0                	mov    %eax,%fs
+    write(stdout, "", 0);
+    1aa6:	8b 05 e4 1a 00 00    	mov    0x1ae4(%rip),%eax        # 3590 <stdout>
+    1aac:	ba 00 00 00 00       	mov    $0x0,%edx
+    1ab1:	48 c7 c6 d3 30 00 00 	mov    $0x30d3,%rsi
+    1ab8:	89 c7                	mov    %eax,%edi
+    1aba:	e8 e3 03 00 00       	call   1ea2 <write>
+    asm volatile("movw %0, %%fs" : : "r" ((ushort)0));
+    1abf:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ac4:	8e e0                	mov    %eax,%fs
+    if((pid = fork()) == 0)
+    1ac6:	e8 a5 03 00 00       	call   1e70 <fork>
+    1acb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    1ace:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1ad2:	75 05                	jne    1ad9 <fstest+0x8d>
+      exit();
+    1ad4:	e8 a1 03 00 00       	call   1e7a <exit>
+    wait();
+    1ad9:	e8 a6 03 00 00       	call   1e84 <wait>
+    exit();
+    1ade:	e8 97 03 00 00       	call   1e7a <exit>
+  }
+  wait();
+    1ae3:	e8 9c 03 00 00       	call   1e84 <wait>
+  printf(stdout, "fs test ok\n");
+    1ae8:	8b 05 a2 1a 00 00    	mov    0x1aa2(%rip),%eax        # 3590 <stdout>
+    1aee:	48 c7 c6 d4 30 00 00 	mov    $0x30d4,%rsi
+    1af5:	89 c7                	mov    %eax,%edi
+    1af7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1afc:	e8 ec 07 00 00       	call   22ed <printf>
+}
+    1b01:	90                   	nop
+    1b02:	c9                   	leave
+    1b03:	c3                   	ret
+
+0000000000001b04 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    1b04:	55                   	push   %rbp
+    1b05:	48 89 e5             	mov    %rsp,%rbp
+    1b08:	48 83 ec 10          	sub    $0x10,%rsp
+    1b0c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1b0f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(1, "xtests starting\n");
+    1b13:	48 c7 c6 e0 30 00 00 	mov    $0x30e0,%rsi
+    1b1a:	bf 01 00 00 00       	mov    $0x1,%edi
+    1b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b24:	e8 c4 07 00 00       	call   22ed <printf>
+
+  hugetest();
+    1b29:	e8 d2 e4 ff ff       	call   0 <hugetest>
+  vdsotest();
+    1b2e:	e8 bb fd ff ff       	call   18ee <vdsotest>
+  fstest();
+    1b33:	e8 14 ff ff ff       	call   1a4c <fstest>
+  ipctest();
+    1b38:	e8 6c e8 ff ff       	call   3a9 <ipctest>
+  ipctokentest();
+    1b3d:	e8 c5 ea ff ff       	call   607 <ipctokentest>
+  ipcgranttest();
+    1b42:	e8 29 ec ff ff       	call   770 <ipcgranttest>
+  ipcringtest();
+    1b47:	e8 e4 ee ff ff       	call   a30 <ipcringtest>
+  ipcreftest();
+    1b4c:	e8 97 f0 ff ff       	call   be8 <ipcreftest>
+  ipctimetest();
+    1b51:	e8 76 f2 ff ff       	call   dcc <ipctimetest>
+  ipcsettest();
+    1b56:	e8 14 f4 ff ff       	call   f6f <ipcsettest>
+  ipchandletest();
+    1b5b:	e8 4c f6 ff ff       	call   11ac <ipchandletest>
+  ipcbatchtest();
+    1b60:	e8 60 f8 ff ff       	call   13c5 <ipcbatchtest>
+  ipcfdtest();
+    1b65:	e8 11 fb ff ff       	call   167b <ipcfdtest>
+
+  printf(1, "xtests passed\n");
+    1b6a:	48 c7 c6 f1 30 00 00 	mov    $0x30f1,%rsi
+    1b71:	bf 01 00 00 00       	mov    $0x1,%edi
+    1b76:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b7b:	e8 6d 07 00 00       	call   22ed <printf>
+  exit();
+    1b80:	e8 f5 02 00 00       	call   1e7a <exit>
+
+0000000000001b85 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+    1b85:	55                   	push   %rbp
+    1b86:	48 89 e5             	mov    %rsp,%rbp
+    1b89:	48 83 ec 10          	sub    $0x10,%rsp
+    1b8d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1b91:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1b94:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+    1b97:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1b9b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1b9e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1ba1:	48 89 ce             	mov    %rcx,%rsi
+    1ba4:	48 89 f7             	mov    %rsi,%rdi
+    1ba7:	89 d1                	mov    %edx,%ecx
+    1ba9:	fc                   	cld
+    1baa:	f3 aa                	rep stos %al,%es:(%rdi)
+    1bac:	89 ca                	mov    %ecx,%edx
+    1bae:	48 89 fe             	mov    %rdi,%rsi
+    1bb1:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1bb5:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    1bb8:	90                   	nop
+    1bb9:	c9                   	leave
+    1bba:	c3                   	ret
+
+0000000000001bbb <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    1bbb:	55                   	push   %rbp
+    1bbc:	48 89 e5             	mov    %rsp,%rbp
+    1bbf:	48 83 ec 20          	sub    $0x20,%rsp
+    1bc3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1bc7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+    1bcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bcf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    1bd3:	90                   	nop
+    1bd4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1bd8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1bdc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1be0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1be4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1be8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1bec:	0f b6 12             	movzbl (%rdx),%edx
+    1bef:	88 10                	mov    %dl,(%rax)
+    1bf1:	0f b6 00             	movzbl (%rax),%eax
+    1bf4:	84 c0                	test   %al,%al
+    1bf6:	75 dc                	jne    1bd4 <strcpy+0x19>
+    ;
+  return os;
+    1bf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1bfc:	c9                   	leave
+    1bfd:	c3                   	ret
+
+0000000000001bfe <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1bfe:	55                   	push   %rbp
+    1bff:	48 89 e5             	mov    %rsp,%rbp
+    1c02:	48 83 ec 10          	sub    $0x10,%rsp
+    1c06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c0a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    1c0e:	eb 0a                	jmp    1c1a <strcmp+0x1c>
+    p++, q++;
+    1c10:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1c15:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1c1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c1e:	0f b6 00             	movzbl (%rax),%eax
+    1c21:	84 c0                	test   %al,%al
+    1c23:	74 12                	je     1c37 <strcmp+0x39>
+    1c25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c29:	0f b6 10             	movzbl (%rax),%edx
+    1c2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c30:	0f b6 00             	movzbl (%rax),%eax
+    1c33:	38 c2                	cmp    %al,%dl
+    1c35:	74 d9                	je     1c10 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+    1c37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c3b:	0f b6 00             	movzbl (%rax),%eax
+    1c3e:	0f b6 d0             	movzbl %al,%edx
+    1c41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c45:	0f b6 00             	movzbl (%rax),%eax
+    1c48:	0f b6 c0             	movzbl %al,%eax
+    1c4b:	29 c2                	sub    %eax,%edx
+    1c4d:	89 d0                	mov    %edx,%eax
+}
+    1c4f:	c9                   	leave
+    1c50:	c3                   	ret
+
+0000000000001c51 <strlen>:
+
+uint
+strlen(char *s)
+{
+    1c51:	55                   	push   %rbp
+    1c52:	48 89 e5             	mov    %rsp,%rbp
+    1c55:	48 83 ec 18          	sub    $0x18,%rsp
+    1c59:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1c5d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1c64:	eb 04                	jmp    1c6a <strlen+0x19>
+    1c66:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1c6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c6d:	48 63 d0             	movslq %eax,%rdx
+    1c70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c74:	48 01 d0             	add    %rdx,%rax
+    1c77:	0f b6 00             	movzbl (%rax),%eax
+    1c7a:	84 c0                	test   %al,%al
+    1c7c:	75 e8                	jne    1c66 <strlen+0x15>
+    ;
+  return n;
+    1c7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1c81:	c9                   	leave
+    1c82:	c3                   	ret
+
+0000000000001c83 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1c83:	55                   	push   %rbp
+    1c84:	48 89 e5             	mov    %rsp,%rbp
+    1c87:	48 83 ec 10          	sub    $0x10,%rsp
+    1c8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c8f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1c92:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1c95:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1c98:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1c9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c9f:	89 ce                	mov    %ecx,%esi
+    1ca1:	48 89 c7             	mov    %rax,%rdi
+    1ca4:	e8 dc fe ff ff       	call   1b85 <stosb>
+  return dst;
+    1ca9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1cad:	c9                   	leave
+    1cae:	c3                   	ret
+
+0000000000001caf <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1caf:	55                   	push   %rbp
+    1cb0:	48 89 e5             	mov    %rsp,%rbp
+    1cb3:	48 83 ec 10          	sub    $0x10,%rsp
+    1cb7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1cbb:	89 f0                	mov    %esi,%eax
+    1cbd:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    1cc0:	eb 17                	jmp    1cd9 <strchr+0x2a>
+    if(*s == c)
+    1cc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc6:	0f b6 00             	movzbl (%rax),%eax
+    1cc9:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1ccc:	75 06                	jne    1cd4 <strchr+0x25>
+      return (char*)s;
+    1cce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cd2:	eb 15                	jmp    1ce9 <strchr+0x3a>
+  for(; *s; s++)
+    1cd4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1cd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cdd:	0f b6 00             	movzbl (%rax),%eax
+    1ce0:	84 c0                	test   %al,%al
+    1ce2:	75 de                	jne    1cc2 <strchr+0x13>
+  return 0;
+    1ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1ce9:	c9                   	leave
+    1cea:	c3                   	ret
+
+0000000000001ceb <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1ceb:	55                   	push   %rbp
+    1cec:	48 89 e5             	mov    %rsp,%rbp
+    1cef:	48 83 ec 20          	sub    $0x20,%rsp
+    1cf3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cf7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    1cfa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1d01:	eb 48                	jmp    1d4b <gets+0x60>
+    cc = read(0, &c, 1);
+    1d03:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1d07:	ba 01 00 00 00       	mov    $0x1,%edx
+    1d0c:	48 89 c6             	mov    %rax,%rsi
+    1d0f:	bf 00 00 00 00       	mov    $0x0,%edi
+    1d14:	e8 7f 01 00 00       	call   1e98 <read>
+    1d19:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1d1c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1d20:	7e 36                	jle    1d58 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1d22:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d25:	8d 50 01             	lea    0x1(%rax),%edx
+    1d28:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1d2b:	48 63 d0             	movslq %eax,%rdx
+    1d2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d32:	48 01 c2             	add    %rax,%rdx
+    1d35:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d39:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1d3b:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d3f:	3c 0a                	cmp    $0xa,%al
+    1d41:	74 16                	je     1d59 <gets+0x6e>
+    1d43:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d47:	3c 0d                	cmp    $0xd,%al
+    1d49:	74 0e                	je     1d59 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1d4b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d4e:	83 c0 01             	add    $0x1,%eax
+    1d51:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1d54:	7f ad                	jg     1d03 <gets+0x18>
+    1d56:	eb 01                	jmp    1d59 <gets+0x6e>
+      break;
+    1d58:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1d59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d5c:	48 63 d0             	movslq %eax,%rdx
+    1d5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d63:	48 01 d0             	add    %rdx,%rax
+    1d66:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1d69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1d6d:	c9                   	leave
+    1d6e:	c3                   	ret
+
+0000000000001d6f <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1d6f:	55                   	push   %rbp
+    1d70:	48 89 e5             	mov    %rsp,%rbp
+    1d73:	48 83 ec 20          	sub    $0x20,%rsp
+    1d77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d7b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1d7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d83:	be 00 00 00 00       	mov    $0x0,%esi
+    1d88:	48 89 c7             	mov    %rax,%rdi
+    1d8b:	e8 3a 01 00 00       	call   1eca <open>
+    1d90:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1d93:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1d97:	79 07                	jns    1da0 <stat+0x31>
+    return -1;
+    1d99:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d9e:	eb 21                	jmp    1dc1 <stat+0x52>
+  r = fstat(fd, st);
+    1da0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1da4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1da7:	48 89 d6             	mov    %rdx,%rsi
+    1daa:	89 c7                	mov    %eax,%edi
+    1dac:	e8 37 01 00 00       	call   1ee8 <fstat>
+    1db1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1db4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1db7:	89 c7                	mov    %eax,%edi
+    1db9:	e8 ee 00 00 00       	call   1eac <close>
+  return r;
+    1dbe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1dc1:	c9                   	leave
+    1dc2:	c3                   	ret
+
+0000000000001dc3 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1dc3:	55                   	push   %rbp
+    1dc4:	48 89 e5             	mov    %rsp,%rbp
+    1dc7:	48 83 ec 18          	sub    $0x18,%rsp
+    1dcb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1dcf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1dd6:	eb 28                	jmp    1e00 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+    1dd8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1ddb:	89 d0                	mov    %edx,%eax
+    1ddd:	c1 e0 02             	shl    $0x2,%eax
+    1de0:	01 d0                	add    %edx,%eax
+    1de2:	01 c0                	add    %eax,%eax
+    1de4:	89 c1                	mov    %eax,%ecx
+    1de6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dea:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1dee:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1df2:	0f b6 00             	movzbl (%rax),%eax
+    1df5:	0f be c0             	movsbl %al,%eax
+    1df8:	01 c8                	add    %ecx,%eax
+    1dfa:	83 e8 30             	sub    $0x30,%eax
+    1dfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1e00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e04:	0f b6 00             	movzbl (%rax),%eax
+    1e07:	3c 2f                	cmp    $0x2f,%al
+    1e09:	7e 0b                	jle    1e16 <atoi+0x53>
+    1e0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e0f:	0f b6 00             	movzbl (%rax),%eax
+    1e12:	3c 39                	cmp    $0x39,%al
+    1e14:	7e c2                	jle    1dd8 <atoi+0x15>
+  return n;
+    1e16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1e19:	c9                   	leave
+    1e1a:	c3                   	ret
+
+0000000000001e1b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1e1b:	55                   	push   %rbp
+    1e1c:	48 89 e5             	mov    %rsp,%rbp
+    1e1f:	48 83 ec 28          	sub    $0x28,%rsp
+    1e23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e27:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e2b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+    1e2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e32:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1e36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e3a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    1e3e:	eb 1d                	jmp    1e5d <memmove+0x42>
+    *dst++ = *src++;
+    1e40:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e44:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1e48:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1e4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e50:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1e54:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1e58:	0f b6 12             	movzbl (%rdx),%edx
+    1e5b:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1e5d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e60:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1e63:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1e66:	85 c0                	test   %eax,%eax
+    1e68:	7f d6                	jg     1e40 <memmove+0x25>
+  return vdst;
+    1e6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1e6e:	c9                   	leave
+    1e6f:	c3                   	ret
+
+0000000000001e70 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+    1e70:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+    1e77:	cd 40                	int    $0x40
+    1e79:	c3                   	ret
+
+0000000000001e7a <exit>:
+SYSCALL_FAST(exit)
+    1e7a:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+    1e81:	0f 05                	syscall
+    1e83:	c3                   	ret
+
+0000000000001e84 <wait>:
+SYSCALL_FAST(wait)
+    1e84:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+    1e8b:	0f 05                	syscall
+    1e8d:	c3                   	ret
+
+0000000000001e8e <pipe>:
+SYSCALL_FAST(pipe)
+    1e8e:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+    1e95:	0f 05                	syscall
+    1e97:	c3                   	ret
+
+0000000000001e98 <read>:
+SYSCALL_FAST(read)
+    1e98:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+    1e9f:	0f 05                	syscall
+    1ea1:	c3                   	ret
+
+0000000000001ea2 <write>:
+SYSCALL_FAST(write)
+    1ea2:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+    1ea9:	0f 05                	syscall
+    1eab:	c3                   	ret
+
+0000000000001eac <close>:
+SYSCALL_FAST(close)
+    1eac:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+    1eb3:	0f 05                	syscall
+    1eb5:	c3                   	ret
+
+0000000000001eb6 <kill>:
+SYSCALL_FAST(kill)
+    1eb6:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+    1ebd:	0f 05                	syscall
+    1ebf:	c3                   	ret
+
+0000000000001ec0 <exec>:
+SYSCALL(exec)
+    1ec0:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+    1ec7:	cd 40                	int    $0x40
+    1ec9:	c3                   	ret
+
+0000000000001eca <open>:
+SYSCALL_FAST(open)
+    1eca:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+    1ed1:	0f 05                	syscall
+    1ed3:	c3                   	ret
+
+0000000000001ed4 <mknod>:
+SYSCALL_FAST(mknod)
+    1ed4:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+    1edb:	0f 05                	syscall
+    1edd:	c3                   	ret
+
+0000000000001ede <unlink>:
+SYSCALL_FAST(unlink)
+    1ede:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+    1ee5:	0f 05                	syscall
+    1ee7:	c3                   	ret
+
+0000000000001ee8 <fstat>:
+SYSCALL_FAST(fstat)
+    1ee8:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+    1eef:	0f 05                	syscall
+    1ef1:	c3                   	ret
+
+0000000000001ef2 <link>:
+SYSCALL_FAST(link)
+    1ef2:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+    1ef9:	0f 05                	syscall
+    1efb:	c3                   	ret
+
+0000000000001efc <mkdir>:
+SYSCALL_FAST(mkdir)
+    1efc:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+    1f03:	0f 05                	syscall
+    1f05:	c3                   	ret
+
+0000000000001f06 <chdir>:
+SYSCALL_FAST(chdir)
+    1f06:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+    1f0d:	0f 05                	syscall
+    1f0f:	c3                   	ret
+
+0000000000001f10 <dup>:
+SYSCALL_FAST(dup)
+    1f10:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+    1f17:	0f 05                	syscall
+    1f19:	c3                   	ret
+
+0000000000001f1a <sbrk>:
+SYSCALL_FAST(sbrk)
+    1f1a:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+    1f21:	0f 05                	syscall
+    1f23:	c3                   	ret
+
+0000000000001f24 <sleep>:
+SYSCALL_FAST(sleep)
+    1f24:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+    1f2b:	0f 05                	syscall
+    1f2d:	c3                   	ret
+
+0000000000001f2e <send>:
+SYSCALL_FAST(send)
+    1f2e:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+    1f35:	0f 05                	syscall
+    1f37:	c3                   	ret
+
+0000000000001f38 <send_recv>:
+SYSCALL_FAST(send_recv)
+    1f38:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+    1f3f:	0f 05                	syscall
+    1f41:	c3                   	ret
+
+0000000000001f42 <recv>:
+SYSCALL_FAST(recv)
+    1f42:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+    1f49:	0f 05                	syscall
+    1f4b:	c3                   	ret
+
+0000000000001f4c <call>:
+SYSCALL_FAST(call)
+    1f4c:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+    1f53:	0f 05                	syscall
+    1f55:	c3                   	ret
+
+0000000000001f56 <reply_recv>:
+SYSCALL_FAST(reply_recv)
+    1f56:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+    1f5d:	0f 05                	syscall
+    1f5f:	c3                   	ret
+
+0000000000001f60 <send_reg>:
+SYSCALL_REG(send_reg)
+    1f60:	41 54                	push   %r12
+    1f62:	41 55                	push   %r13
+    1f64:	41 56                	push   %r14
+    1f66:	41 57                	push   %r15
+    1f68:	56                   	push   %rsi
+    1f69:	49 89 f3             	mov    %rsi,%r11
+    1f6c:	48 89 d6             	mov    %rdx,%rsi
+    1f6f:	49 8b 13             	mov    (%r11),%rdx
+    1f72:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    1f76:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    1f7a:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    1f7e:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    1f82:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    1f86:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1f8a:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1f8e:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+    1f95:	0f 05                	syscall
+    1f97:	41 5b                	pop    %r11
+    1f99:	49 89 13             	mov    %rdx,(%r11)
+    1f9c:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    1fa0:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    1fa4:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    1fa8:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    1fac:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    1fb0:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    1fb4:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    1fb8:	41 5f                	pop    %r15
+    1fba:	41 5e                	pop    %r14
+    1fbc:	41 5d                	pop    %r13
+    1fbe:	41 5c                	pop    %r12
+    1fc0:	c3                   	ret
+
+0000000000001fc1 <recv_reg>:
+SYSCALL_REG(recv_reg)
+    1fc1:	41 54                	push   %r12
+    1fc3:	41 55                	push   %r13
+    1fc5:	41 56                	push   %r14
+    1fc7:	41 57                	push   %r15
+    1fc9:	56                   	push   %rsi
+    1fca:	49 89 f3             	mov    %rsi,%r11
+    1fcd:	48 89 d6             	mov    %rdx,%rsi
+    1fd0:	49 8b 13             	mov    (%r11),%rdx
+    1fd3:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    1fd7:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    1fdb:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    1fdf:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    1fe3:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    1fe7:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    1feb:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    1fef:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+    1ff6:	0f 05                	syscall
+    1ff8:	41 5b                	pop    %r11
+    1ffa:	49 89 13             	mov    %rdx,(%r11)
+    1ffd:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    2001:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    2005:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    2009:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    200d:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    2011:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    2015:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    2019:	41 5f                	pop    %r15
+    201b:	41 5e                	pop    %r14
+    201d:	41 5d                	pop    %r13
+    201f:	41 5c                	pop    %r12
+    2021:	c3                   	ret
+
+0000000000002022 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+    2022:	41 54                	push   %r12
+    2024:	41 55                	push   %r13
+    2026:	41 56                	push   %r14
+    2028:	41 57                	push   %r15
+    202a:	56                   	push   %rsi
+    202b:	49 89 f3             	mov    %rsi,%r11
+    202e:	48 89 d6             	mov    %rdx,%rsi
+    2031:	49 8b 13             	mov    (%r11),%rdx
+    2034:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    2038:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    203c:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    2040:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    2044:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    2048:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    204c:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    2050:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+    2057:	0f 05                	syscall
+    2059:	41 5b                	pop    %r11
+    205b:	49 89 13             	mov    %rdx,(%r11)
+    205e:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    2062:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    2066:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    206a:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    206e:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    2072:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    2076:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    207a:	41 5f                	pop    %r15
+    207c:	41 5e                	pop    %r14
+    207e:	41 5d                	pop    %r13
+    2080:	41 5c                	pop    %r12
+    2082:	c3                   	ret
+
+0000000000002083 <call_reg>:
+SYSCALL_REG(call_reg)
+    2083:	41 54                	push   %r12
+    2085:	41 55                	push   %r13
+    2087:	41 56                	push   %r14
+    2089:	41 57                	push   %r15
+    208b:	56                   	push   %rsi
+    208c:	49 89 f3             	mov    %rsi,%r11
+    208f:	48 89 d6             	mov    %rdx,%rsi
+    2092:	49 8b 13             	mov    (%r11),%rdx
+    2095:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    2099:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    209d:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    20a1:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    20a5:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    20a9:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    20ad:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    20b1:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+    20b8:	0f 05                	syscall
+    20ba:	41 5b                	pop    %r11
+    20bc:	49 89 13             	mov    %rdx,(%r11)
+    20bf:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    20c3:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    20c7:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    20cb:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    20cf:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    20d3:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    20d7:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    20db:	41 5f                	pop    %r15
+    20dd:	41 5e                	pop    %r14
+    20df:	41 5d                	pop    %r13
+    20e1:	41 5c                	pop    %r12
+    20e3:	c3                   	ret
+
+00000000000020e4 <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+    20e4:	41 54                	push   %r12
+    20e6:	41 55                	push   %r13
+    20e8:	41 56                	push   %r14
+    20ea:	41 57                	push   %r15
+    20ec:	56                   	push   %rsi
+    20ed:	49 89 f3             	mov    %rsi,%r11
+    20f0:	48 89 d6             	mov    %rdx,%rsi
+    20f3:	49 8b 13             	mov    (%r11),%rdx
+    20f6:	4d 8b 43 08          	mov    0x8(%r11),%r8
+    20fa:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+    20fe:	4d 8b 53 18          	mov    0x18(%r11),%r10
+    2102:	4d 8b 63 20          	mov    0x20(%r11),%r12
+    2106:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+    210a:	4d 8b 73 30          	mov    0x30(%r11),%r14
+    210e:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+    2112:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+    2119:	0f 05                	syscall
+    211b:	41 5b                	pop    %r11
+    211d:	49 89 13             	mov    %rdx,(%r11)
+    2120:	4d 89 43 08          	mov    %r8,0x8(%r11)
+    2124:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+    2128:	4d 89 53 18          	mov    %r10,0x18(%r11)
+    212c:	4d 89 63 20          	mov    %r12,0x20(%r11)
+    2130:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+    2134:	4d 89 73 30          	mov    %r14,0x30(%r11)
+    2138:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+    213c:	41 5f                	pop    %r15
+    213e:	41 5e                	pop    %r14
+    2140:	41 5d                	pop    %r13
+    2142:	41 5c                	pop    %r12
+    2144:	c3                   	ret
+
+0000000000002145 <sendx>:
+SYSCALL_FAST(sendx)
+    2145:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+    214c:	0f 05                	syscall
+    214e:	c3                   	ret
+
+000000000000214f <ring_attach>:
+SYSCALL_FAST(ring_attach)
+    214f:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+    2156:	0f 05                	syscall
+    2158:	c3                   	ret
+
+0000000000002159 <notify>:
+SYSCALL_FAST(notify)
+    2159:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+    2160:	0f 05                	syscall
+    2162:	c3                   	ret
+
+0000000000002163 <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+    2163:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+    216a:	0f 05                	syscall
+    216c:	c3                   	ret
+
+000000000000216d <send_timed>:
+SYSCALL_FAST(send_timed)
+    216d:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+    2174:	0f 05                	syscall
+    2176:	c3                   	ret
+
+0000000000002177 <recv_timed>:
+SYSCALL_FAST(recv_timed)
+    2177:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+    217e:	0f 05                	syscall
+    2180:	c3                   	ret
+
+0000000000002181 <set_add>:
+SYSCALL_FAST(set_add)
+    2181:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+    2188:	0f 05                	syscall
+    218a:	c3                   	ret
+
+000000000000218b <set_del>:
+SYSCALL_FAST(set_del)
+    218b:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+    2192:	0f 05                	syscall
+    2194:	c3                   	ret
+
+0000000000002195 <recv_any>:
+SYSCALL_FAST(recv_any)
+    2195:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+    219c:	0f 05                	syscall
+    219e:	c3                   	ret
+
+000000000000219f <ep_create>:
+SYSCALL_FAST(ep_create)
+    219f:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+    21a6:	0f 05                	syscall
+    21a8:	c3                   	ret
+
+00000000000021a9 <ep_close>:
+SYSCALL_FAST(ep_close)
+    21a9:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+    21b0:	0f 05                	syscall
+    21b2:	c3                   	ret
+
+00000000000021b3 <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+    21b3:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+    21ba:	0f 05                	syscall
+    21bc:	c3                   	ret
+
+00000000000021bd <setprio>:
+SYSCALL_FAST(setprio)
+    21bd:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+    21c4:	0f 05                	syscall
+    21c6:	c3                   	ret
+
+00000000000021c7 <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+    21c7:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+    21ce:	0f 05                	syscall
+    21d0:	c3                   	ret
+
+00000000000021d1 <sethuge>:
+SYSCALL_FAST(sethuge)
+    21d1:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+    21d8:	0f 05                	syscall
+    21da:	c3                   	ret
+
+00000000000021db <cr3_test>:
+SYSCALL_FAST(cr3_test)
+    21db:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+    21e2:	0f 05                	syscall
+    21e4:	c3                   	ret
+
+00000000000021e5 <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+    21e5:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+    21ec:	0f 05                	syscall
+    21ee:	c3                   	ret
+
+00000000000021ef <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+    21ef:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+    21f6:	0f 05                	syscall
+    21f8:	c3                   	ret
+
+00000000000021f9 <null_call>:
+    21f9:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+    2200:	0f 05                	syscall
+    2202:	c3                   	ret
+
+0000000000002203 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    2203:	55                   	push   %rbp
+    2204:	48 89 e5             	mov    %rsp,%rbp
+    2207:	48 83 ec 10          	sub    $0x10,%rsp
+    220b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    220e:	89 f0                	mov    %esi,%eax
+    2210:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    2213:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    2217:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    221a:	ba 01 00 00 00       	mov    $0x1,%edx
+    221f:	48 89 ce             	mov    %rcx,%rsi
+    2222:	89 c7                	mov    %eax,%edi
+    2224:	e8 79 fc ff ff       	call   1ea2 <write>
+}
+    2229:	90                   	nop
+    222a:	c9                   	leave
+    222b:	c3                   	ret
+
+000000000000222c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    222c:	55                   	push   %rbp
+    222d:	48 89 e5             	mov    %rsp,%rbp
+    2230:	48 83 ec 30          	sub    $0x30,%rsp
+    2234:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    2237:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    223a:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    223d:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    2240:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    2247:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    224b:	74 17                	je     2264 <printint+0x38>
+    224d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    2251:	79 11                	jns    2264 <printint+0x38>
+    neg = 1;
+    2253:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    225a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    225d:	f7 d8                	neg    %eax
+    225f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2262:	eb 06                	jmp    226a <printint+0x3e>
+  } else {
+    x = xx;
+    2264:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    2267:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    226a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    2271:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    2274:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2277:	ba 00 00 00 00       	mov    $0x0,%edx
+    227c:	f7 f1                	div    %ecx
+    227e:	89 d1                	mov    %edx,%ecx
+    2280:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2283:	8d 50 01             	lea    0x1(%rax),%edx
+    2286:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2289:	89 ca                	mov    %ecx,%edx
+    228b:	0f b6 92 a0 35 00 00 	movzbl 0x35a0(%rdx),%edx
+    2292:	48 98                	cltq
+    2294:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    2298:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    229b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    229e:	ba 00 00 00 00       	mov    $0x0,%edx
+    22a3:	f7 f6                	div    %esi
+    22a5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    22a8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    22ac:	75 c3                	jne    2271 <printint+0x45>
+  if(neg)
+    22ae:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    22b2:	74 2b                	je     22df <printint+0xb3>
+    buf[i++] = '-';
+    22b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22b7:	8d 50 01             	lea    0x1(%rax),%edx
+    22ba:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    22bd:	48 98                	cltq
+    22bf:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+    22c4:	eb 19                	jmp    22df <printint+0xb3>
+    putc(fd, buf[i]);
+    22c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22c9:	48 98                	cltq
+    22cb:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+    22d0:	0f be d0             	movsbl %al,%edx
+    22d3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    22d6:	89 d6                	mov    %edx,%esi
+    22d8:	89 c7                	mov    %eax,%edi
+    22da:	e8 24 ff ff ff       	call   2203 <putc>
+  while(--i >= 0)
+    22df:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    22e3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    22e7:	79 dd                	jns    22c6 <printint+0x9a>
+}
+    22e9:	90                   	nop
+    22ea:	90                   	nop
+    22eb:	c9                   	leave
+    22ec:	c3                   	ret
+
+00000000000022ed <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    22ed:	55                   	push   %rbp
+    22ee:	48 89 e5             	mov    %rsp,%rbp
+    22f1:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+    22f8:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+    22fe:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+    2305:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+    230c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+    2313:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+    231a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+    2321:	84 c0                	test   %al,%al
+    2323:	74 20                	je     2345 <printf+0x58>
+    2325:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+    2329:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+    232d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+    2331:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+    2335:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+    2339:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+    233d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+    2341:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+    2345:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+    234c:	00 00 00 
+    234f:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+    2356:	00 00 00 
+    2359:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    235d:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+    2364:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+    236b:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+    2372:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+    2379:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+    237c:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+    2383:	00 00 00 
+    2386:	e9 a8 02 00 00       	jmp    2633 <printf+0x346>
+    c = fmt[i] & 0xff;
+    238b:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+    2391:	48 63 d0             	movslq %eax,%rdx
+    2394:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    239b:	48 01 d0             	add    %rdx,%rax
+    239e:	0f b6 00             	movzbl (%rax),%eax
+    23a1:	0f be c0             	movsbl %al,%eax
+    23a4:	25 ff 00 00 00       	and    $0xff,%eax
+    23a9:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+    23af:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+    23b6:	75 35                	jne    23ed <printf+0x100>
+      if(c == '%'){
+    23b8:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+    23bf:	75 0f                	jne    23d0 <printf+0xe3>
+        state = '%';
+    23c1:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+    23c8:	00 00 00 
+    23cb:	e9 5c 02 00 00       	jmp    262c <printf+0x33f>
+      } else {
+        putc(fd, c);
+    23d0:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    23d6:	0f be d0             	movsbl %al,%edx
+    23d9:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    23df:	89 d6                	mov    %edx,%esi
+    23e1:	89 c7                	mov    %eax,%edi
+    23e3:	e8 1b fe ff ff       	call   2203 <putc>
+    23e8:	e9 3f 02 00 00       	jmp    262c <printf+0x33f>
+      }
+    } else if(state == '%'){
+    23ed:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+    23f4:	0f 85 32 02 00 00    	jne    262c <printf+0x33f>
+      if(c == 'd'){
+    23fa:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+    2401:	75 5e                	jne    2461 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+    2403:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    2409:	83 f8 2f             	cmp    $0x2f,%eax
+    240c:	77 23                	ja     2431 <printf+0x144>
+    240e:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    2415:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    241b:	89 d2                	mov    %edx,%edx
+    241d:	48 01 d0             	add    %rdx,%rax
+    2420:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    2426:	83 c2 08             	add    $0x8,%edx
+    2429:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    242f:	eb 12                	jmp    2443 <printf+0x156>
+    2431:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    2438:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    243c:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    2443:	8b 30                	mov    (%rax),%esi
+    2445:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    244b:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2450:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2455:	89 c7                	mov    %eax,%edi
+    2457:	e8 d0 fd ff ff       	call   222c <printint>
+    245c:	e9 c1 01 00 00       	jmp    2622 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+    2461:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+    2468:	74 09                	je     2473 <printf+0x186>
+    246a:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+    2471:	75 5e                	jne    24d1 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+    2473:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    2479:	83 f8 2f             	cmp    $0x2f,%eax
+    247c:	77 23                	ja     24a1 <printf+0x1b4>
+    247e:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    2485:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    248b:	89 d2                	mov    %edx,%edx
+    248d:	48 01 d0             	add    %rdx,%rax
+    2490:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    2496:	83 c2 08             	add    $0x8,%edx
+    2499:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    249f:	eb 12                	jmp    24b3 <printf+0x1c6>
+    24a1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    24a8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    24ac:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    24b3:	8b 30                	mov    (%rax),%esi
+    24b5:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    24bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+    24c0:	ba 10 00 00 00       	mov    $0x10,%edx
+    24c5:	89 c7                	mov    %eax,%edi
+    24c7:	e8 60 fd ff ff       	call   222c <printint>
+    24cc:	e9 51 01 00 00       	jmp    2622 <printf+0x335>
+      } else if(c == 's'){
+    24d1:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+    24d8:	0f 85 98 00 00 00    	jne    2576 <printf+0x289>
+        s = va_arg(ap, char*);
+    24de:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    24e4:	83 f8 2f             	cmp    $0x2f,%eax
+    24e7:	77 23                	ja     250c <printf+0x21f>
+    24e9:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    24f0:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    24f6:	89 d2                	mov    %edx,%edx
+    24f8:	48 01 d0             	add    %rdx,%rax
+    24fb:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    2501:	83 c2 08             	add    $0x8,%edx
+    2504:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    250a:	eb 12                	jmp    251e <printf+0x231>
+    250c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    2513:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2517:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    251e:	48 8b 00             	mov    (%rax),%rax
+    2521:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+    2528:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+    252f:	00 
+    2530:	75 31                	jne    2563 <printf+0x276>
+          s = "(null)";
+    2532:	48 c7 85 48 ff ff ff 	movq   $0x3100,-0xb8(%rbp)
+    2539:	00 31 00 00 
+        while(*s != 0){
+    253d:	eb 24                	jmp    2563 <printf+0x276>
+          putc(fd, *s);
+    253f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+    2546:	0f b6 00             	movzbl (%rax),%eax
+    2549:	0f be d0             	movsbl %al,%edx
+    254c:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    2552:	89 d6                	mov    %edx,%esi
+    2554:	89 c7                	mov    %eax,%edi
+    2556:	e8 a8 fc ff ff       	call   2203 <putc>
+          s++;
+    255b:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+    2562:	01 
+        while(*s != 0){
+    2563:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+    256a:	0f b6 00             	movzbl (%rax),%eax
+    256d:	84 c0                	test   %al,%al
+    256f:	75 ce                	jne    253f <printf+0x252>
+    2571:	e9 ac 00 00 00       	jmp    2622 <printf+0x335>
+        }
+      } else if(c == 'c'){
+    2576:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+    257d:	75 56                	jne    25d5 <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+    257f:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+    2585:	83 f8 2f             	cmp    $0x2f,%eax
+    2588:	77 23                	ja     25ad <printf+0x2c0>
+    258a:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+    2591:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    2597:	89 d2                	mov    %edx,%edx
+    2599:	48 01 d0             	add    %rdx,%rax
+    259c:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+    25a2:	83 c2 08             	add    $0x8,%edx
+    25a5:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+    25ab:	eb 12                	jmp    25bf <printf+0x2d2>
+    25ad:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    25b4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    25b8:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    25bf:	8b 00                	mov    (%rax),%eax
+    25c1:	0f be d0             	movsbl %al,%edx
+    25c4:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    25ca:	89 d6                	mov    %edx,%esi
+    25cc:	89 c7                	mov    %eax,%edi
+    25ce:	e8 30 fc ff ff       	call   2203 <putc>
+    25d3:	eb 4d                	jmp    2622 <printf+0x335>
+      } else if(c == '%'){
+    25d5:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+    25dc:	75 1a                	jne    25f8 <printf+0x30b>
+        putc(fd, c);
+    25de:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    25e4:	0f be d0             	movsbl %al,%edx
+    25e7:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    25ed:	89 d6                	mov    %edx,%esi
+    25ef:	89 c7                	mov    %eax,%edi
+    25f1:	e8 0d fc ff ff       	call   2203 <putc>
+    25f6:	eb 2a                	jmp    2622 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    25f8:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    25fe:	be 25 00 00 00       	mov    $0x25,%esi
+    2603:	89 c7                	mov    %eax,%edi
+    2605:	e8 f9 fb ff ff       	call   2203 <putc>
+        putc(fd, c);
+    260a:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+    2610:	0f be d0             	movsbl %al,%edx
+    2613:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    2619:	89 d6                	mov    %edx,%esi
+    261b:	89 c7                	mov    %eax,%edi
+    261d:	e8 e1 fb ff ff       	call   2203 <putc>
+      }
+      state = 0;
+    2622:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+    2629:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+    262c:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+    2633:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+    2639:	48 63 d0             	movslq %eax,%rdx
+    263c:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    2643:	48 01 d0             	add    %rdx,%rax
+    2646:	0f b6 00             	movzbl (%rax),%eax
+    2649:	84 c0                	test   %al,%al
+    264b:	0f 85 3a fd ff ff    	jne    238b <printf+0x9e>
+    }
+  }
+}
+    2651:	90                   	nop
+    2652:	90                   	nop
+    2653:	c9                   	leave
+    2654:	c3                   	ret
+
+0000000000002655 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2655:	55                   	push   %rbp
+    2656:	48 89 e5             	mov    %rsp,%rbp
+    2659:	48 83 ec 18          	sub    $0x18,%rsp
+    265d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    2661:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2665:	48 83 e8 10          	sub    $0x10,%rax
+    2669:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    266d:	48 8b 05 9c 29 00 00 	mov    0x299c(%rip),%rax        # 5010 <freep>
+    2674:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2678:	eb 2f                	jmp    26a9 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    267a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    267e:	48 8b 00             	mov    (%rax),%rax
+    2681:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2685:	72 17                	jb     269e <free+0x49>
+    2687:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    268b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    268f:	72 2f                	jb     26c0 <free+0x6b>
+    2691:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2695:	48 8b 00             	mov    (%rax),%rax
+    2698:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    269c:	72 22                	jb     26c0 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    269e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26a2:	48 8b 00             	mov    (%rax),%rax
+    26a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    26a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26ad:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    26b1:	73 c7                	jae    267a <free+0x25>
+    26b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26b7:	48 8b 00             	mov    (%rax),%rax
+    26ba:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    26be:	73 ba                	jae    267a <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    26c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26c4:	8b 40 08             	mov    0x8(%rax),%eax
+    26c7:	89 c0                	mov    %eax,%eax
+    26c9:	48 c1 e0 04          	shl    $0x4,%rax
+    26cd:	48 89 c2             	mov    %rax,%rdx
+    26d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26d4:	48 01 c2             	add    %rax,%rdx
+    26d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26db:	48 8b 00             	mov    (%rax),%rax
+    26de:	48 39 c2             	cmp    %rax,%rdx
+    26e1:	75 2d                	jne    2710 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+    26e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26e7:	8b 50 08             	mov    0x8(%rax),%edx
+    26ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26ee:	48 8b 00             	mov    (%rax),%rax
+    26f1:	8b 40 08             	mov    0x8(%rax),%eax
+    26f4:	01 c2                	add    %eax,%edx
+    26f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26fa:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    26fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2701:	48 8b 00             	mov    (%rax),%rax
+    2704:	48 8b 10             	mov    (%rax),%rdx
+    2707:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    270b:	48 89 10             	mov    %rdx,(%rax)
+    270e:	eb 0e                	jmp    271e <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+    2710:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2714:	48 8b 10             	mov    (%rax),%rdx
+    2717:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    271b:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    271e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2722:	8b 40 08             	mov    0x8(%rax),%eax
+    2725:	89 c0                	mov    %eax,%eax
+    2727:	48 c1 e0 04          	shl    $0x4,%rax
+    272b:	48 89 c2             	mov    %rax,%rdx
+    272e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2732:	48 01 d0             	add    %rdx,%rax
+    2735:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2739:	75 27                	jne    2762 <free+0x10d>
+    p->s.size += bp->s.size;
+    273b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    273f:	8b 50 08             	mov    0x8(%rax),%edx
+    2742:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2746:	8b 40 08             	mov    0x8(%rax),%eax
+    2749:	01 c2                	add    %eax,%edx
+    274b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    274f:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    2752:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2756:	48 8b 10             	mov    (%rax),%rdx
+    2759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    275d:	48 89 10             	mov    %rdx,(%rax)
+    2760:	eb 0b                	jmp    276d <free+0x118>
+  } else
+    p->s.ptr = bp;
+    2762:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2766:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    276a:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    276d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2771:	48 89 05 98 28 00 00 	mov    %rax,0x2898(%rip)        # 5010 <freep>
+}
+    2778:	90                   	nop
+    2779:	c9                   	leave
+    277a:	c3                   	ret
+
+000000000000277b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    277b:	55                   	push   %rbp
+    277c:	48 89 e5             	mov    %rsp,%rbp
+    277f:	48 83 ec 20          	sub    $0x20,%rsp
+    2783:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    2786:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    278d:	77 07                	ja     2796 <morecore+0x1b>
+    nu = 4096;
+    278f:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    2796:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2799:	c1 e0 04             	shl    $0x4,%eax
+    279c:	89 c7                	mov    %eax,%edi
+    279e:	e8 77 f7 ff ff       	call   1f1a <sbrk>
+    27a3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    27a7:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    27ac:	75 07                	jne    27b5 <morecore+0x3a>
+    return 0;
+    27ae:	b8 00 00 00 00       	mov    $0x0,%eax
+    27b3:	eb 29                	jmp    27de <morecore+0x63>
+  hp = (Header*)p;
+    27b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27b9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    27bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27c1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    27c4:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    27c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27cb:	48 83 c0 10          	add    $0x10,%rax
+    27cf:	48 89 c7             	mov    %rax,%rdi
+    27d2:	e8 7e fe ff ff       	call   2655 <free>
+  return freep;
+    27d7:	48 8b 05 32 28 00 00 	mov    0x2832(%rip),%rax        # 5010 <freep>
+}
+    27de:	c9                   	leave
+    27df:	c3                   	ret
+
+00000000000027e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    27e0:	55                   	push   %rbp
+    27e1:	48 89 e5             	mov    %rsp,%rbp
+    27e4:	48 83 ec 30          	sub    $0x30,%rsp
+    27e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    27eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    27ee:	48 83 c0 0f          	add    $0xf,%rax
+    27f2:	48 c1 e8 04          	shr    $0x4,%rax
+    27f6:	83 c0 01             	add    $0x1,%eax
+    27f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+    27fc:	48 8b 05 0d 28 00 00 	mov    0x280d(%rip),%rax        # 5010 <freep>
+    2803:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2807:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    280c:	75 2b                	jne    2839 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+    280e:	48 c7 45 f0 00 50 00 	movq   $0x5000,-0x10(%rbp)
+    2815:	00 
+    2816:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    281a:	48 89 05 ef 27 00 00 	mov    %rax,0x27ef(%rip)        # 5010 <freep>
+    2821:	48 8b 05 e8 27 00 00 	mov    0x27e8(%rip),%rax        # 5010 <freep>
+    2828:	48 89 05 d1 27 00 00 	mov    %rax,0x27d1(%rip)        # 5000 <base>
+    base.s.size = 0;
+    282f:	c7 05 cf 27 00 00 00 	movl   $0x0,0x27cf(%rip)        # 5008 <base+0x8>
+    2836:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2839:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    283d:	48 8b 00             	mov    (%rax),%rax
+    2840:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    2844:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2848:	8b 40 08             	mov    0x8(%rax),%eax
+    284b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    284e:	72 5f                	jb     28af <malloc+0xcf>
+      if(p->s.size == nunits)
+    2850:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2854:	8b 40 08             	mov    0x8(%rax),%eax
+    2857:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    285a:	75 10                	jne    286c <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+    285c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2860:	48 8b 10             	mov    (%rax),%rdx
+    2863:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2867:	48 89 10             	mov    %rdx,(%rax)
+    286a:	eb 2e                	jmp    289a <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+    286c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2870:	8b 40 08             	mov    0x8(%rax),%eax
+    2873:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    2876:	89 c2                	mov    %eax,%edx
+    2878:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    287c:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    287f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2883:	8b 40 08             	mov    0x8(%rax),%eax
+    2886:	89 c0                	mov    %eax,%eax
+    2888:	48 c1 e0 04          	shl    $0x4,%rax
+    288c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    2890:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2894:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2897:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    289a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    289e:	48 89 05 6b 27 00 00 	mov    %rax,0x276b(%rip)        # 5010 <freep>
+      return (void*)(p + 1);
+    28a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28a9:	48 83 c0 10          	add    $0x10,%rax
+    28ad:	eb 41                	jmp    28f0 <malloc+0x110>
+    }
+    if(p == freep)
+    28af:	48 8b 05 5a 27 00 00 	mov    0x275a(%rip),%rax        # 5010 <freep>
+    28b6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    28ba:	75 1c                	jne    28d8 <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+    28bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    28bf:	89 c7                	mov    %eax,%edi
+    28c1:	e8 b5 fe ff ff       	call   277b <morecore>
+    28c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    28ca:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    28cf:	75 07                	jne    28d8 <malloc+0xf8>
+        return 0;
+    28d1:	b8 00 00 00 00       	mov    $0x0,%eax
+    28d6:	eb 18                	jmp    28f0 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    28d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    28e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28e4:	48 8b 00             	mov    (%rax),%rax
+    28e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    28eb:	e9 54 ff ff ff       	jmp    2844 <malloc+0x64>
+  }
+}
+    28f0:	c9                   	leave
+    28f1:	c3                   	ret
+
+00000000000028f2 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+    28f2:	55                   	push   %rbp
+    28f3:	48 89 e5             	mov    %rsp,%rbp
+    28f6:	53                   	push   %rbx
+    28f7:	48 83 ec 38          	sub    $0x38,%rsp
+    28fb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    28fe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2902:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+    2906:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    290a:	8b 40 40             	mov    0x40(%rax),%eax
+    290d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+    2910:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2914:	8b 00                	mov    (%rax),%eax
+    2916:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2919:	29 c2                	sub    %eax,%edx
+    291b:	83 fa 20             	cmp    $0x20,%edx
+    291e:	75 0a                	jne    292a <ring_send+0x38>
+    return -1;
+    2920:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2925:	e9 93 00 00 00       	jmp    29bd <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+    292a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    292d:	83 e0 1f             	and    $0x1f,%eax
+    2930:	89 c2                	mov    %eax,%edx
+    2932:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2936:	89 d2                	mov    %edx,%edx
+    2938:	48 83 c2 02          	add    $0x2,%rdx
+    293c:	48 c1 e2 06          	shl    $0x6,%rdx
+    2940:	48 01 c2             	add    %rax,%rdx
+    2943:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2947:	48 8b 08             	mov    (%rax),%rcx
+    294a:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    294e:	48 89 0a             	mov    %rcx,(%rdx)
+    2951:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+    2955:	48 8b 48 10          	mov    0x10(%rax),%rcx
+    2959:	48 8b 58 18          	mov    0x18(%rax),%rbx
+    295d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+    2961:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+    2965:	48 8b 48 20          	mov    0x20(%rax),%rcx
+    2969:	48 8b 58 28          	mov    0x28(%rax),%rbx
+    296d:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+    2971:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+    2975:	48 8b 48 30          	mov    0x30(%rax),%rcx
+    2979:	48 8b 58 38          	mov    0x38(%rax),%rbx
+    297d:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+    2981:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+    2985:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+    298b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    298e:	8d 50 01             	lea    0x1(%rax),%edx
+    2991:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2995:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+    2998:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+    299e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    29a2:	8b 00                	mov    (%rax),%eax
+    29a4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    29a7:	75 0f                	jne    29b8 <ring_send+0xc6>
+    notify(channel, 1);
+    29a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    29ac:	be 01 00 00 00       	mov    $0x1,%esi
+    29b1:	89 c7                	mov    %eax,%edi
+    29b3:	e8 a1 f7 ff ff       	call   2159 <notify>
+  return 0;
+    29b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    29bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    29c1:	c9                   	leave
+    29c2:	c3                   	ret
+
+00000000000029c3 <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+    29c3:	55                   	push   %rbp
+    29c4:	48 89 e5             	mov    %rsp,%rbp
+    29c7:	53                   	push   %rbx
+    29c8:	48 83 ec 38          	sub    $0x38,%rsp
+    29cc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    29cf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    29d3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+    29d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    29db:	8b 00                	mov    (%rax),%eax
+    29dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+    29e0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+    29e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    29ea:	8b 40 40             	mov    0x40(%rax),%eax
+    29ed:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    29f0:	75 15                	jne    2a07 <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+    29f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    29f5:	89 c7                	mov    %eax,%edi
+    29f7:	e8 67 f7 ff ff       	call   2163 <nfy_wait>
+    29fc:	85 c0                	test   %eax,%eax
+    29fe:	79 e0                	jns    29e0 <ring_recv+0x1d>
+      return -1;
+    2a00:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2a05:	eb 73                	jmp    2a7a <ring_recv+0xb7>
+      break;
+    2a07:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+    2a08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2a0b:	83 e0 1f             	and    $0x1f,%eax
+    2a0e:	89 c1                	mov    %eax,%ecx
+    2a10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2a14:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2a18:	89 c9                	mov    %ecx,%ecx
+    2a1a:	48 83 c1 02          	add    $0x2,%rcx
+    2a1e:	48 c1 e1 06          	shl    $0x6,%rcx
+    2a22:	48 01 ca             	add    %rcx,%rdx
+    2a25:	48 8b 0a             	mov    (%rdx),%rcx
+    2a28:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+    2a2c:	48 89 08             	mov    %rcx,(%rax)
+    2a2f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    2a33:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+    2a37:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+    2a3b:	48 89 48 10          	mov    %rcx,0x10(%rax)
+    2a3f:	48 89 58 18          	mov    %rbx,0x18(%rax)
+    2a43:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+    2a47:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+    2a4b:	48 89 48 20          	mov    %rcx,0x20(%rax)
+    2a4f:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    2a53:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+    2a57:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+    2a5b:	48 89 48 30          	mov    %rcx,0x30(%rax)
+    2a5f:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+    2a63:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+    2a69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2a6c:	8d 50 01             	lea    0x1(%rax),%edx
+    2a6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2a73:	89 10                	mov    %edx,(%rax)
+  return 0;
+    2a75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2a7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2a7e:	c9                   	leave
+    2a7f:	c3                   	ret
+
+0000000000002a80 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+    2a80:	55                   	push   %rbp
+    2a81:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+    2a84:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    2a89:	8b 00                	mov    (%rax),%eax
+}
+    2a8b:	5d                   	pop    %rbp
+    2a8c:	c3                   	ret
+
+0000000000002a8d <getpid>:
+
+int
+getpid(void)
+{
+    2a8d:	55                   	push   %rbp
+    2a8e:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+    2a91:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+    2a96:	8b 00                	mov    (%rax),%eax
+}
+    2a98:	5d                   	pop    %rbp
+    2a99:	c3                   	ret
+
+0000000000002a9a <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+    2a9a:	55                   	push   %rbp
+    2a9b:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+    2a9e:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+    2aa3:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+    2aa7:	5d                   	pop    %rbp
+    2aa8:	c3                   	ret
@@ -0,0 +1,1690 @@
+
+fs/zombie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+  if(fork() > 0)
+   4:	e8 fe 02 00 00       	call   307 <fork>
+   9:	85 c0                	test   %eax,%eax
+   b:	7e 0a                	jle    17 <main+0x17>
+    sleep(5);  // Let child exit before parent.
+   d:	bf 05 00 00 00       	mov    $0x5,%edi
+  12:	e8 a4 03 00 00       	call   3bb <sleep>
+  exit();
+  17:	e8 f5 02 00 00       	call   311 <exit>
+
+000000000000001c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  1c:	55                   	push   %rbp
+  1d:	48 89 e5             	mov    %rsp,%rbp
+  20:	48 83 ec 10          	sub    $0x10,%rsp
+  24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  28:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  2b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+  2e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  32:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  35:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  38:	48 89 ce             	mov    %rcx,%rsi
+  3b:	48 89 f7             	mov    %rsi,%rdi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%rdi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	48 89 fe             	mov    %rdi,%rsi
+  48:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  4c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  4f:	90                   	nop
+  50:	c9                   	leave
+  51:	c3                   	ret
+
+0000000000000052 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  52:	55                   	push   %rbp
+  53:	48 89 e5             	mov    %rsp,%rbp
+  56:	48 83 ec 20          	sub    $0x20,%rsp
+  5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  5e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *os;
+
+  os = s;
+  62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  66:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+  6a:	90                   	nop
+  6b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  6f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  73:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  7b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  7f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  83:	0f b6 12             	movzbl (%rdx),%edx
+  86:	88 10                	mov    %dl,(%rax)
+  88:	0f b6 00             	movzbl (%rax),%eax
+  8b:	84 c0                	test   %al,%al
+  8d:	75 dc                	jne    6b <strcpy+0x19>
+    ;
+  return os;
+  8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  93:	c9                   	leave
+  94:	c3                   	ret
+
+0000000000000095 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  95:	55                   	push   %rbp
+  96:	48 89 e5             	mov    %rsp,%rbp
+  99:	48 83 ec 10          	sub    $0x10,%rsp
+  9d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  a1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+  a5:	eb 0a                	jmp    b1 <strcmp+0x1c>
+    p++, q++;
+  a7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  ac:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+  b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  b5:	0f b6 00             	movzbl (%rax),%eax
+  b8:	84 c0                	test   %al,%al
+  ba:	74 12                	je     ce <strcmp+0x39>
+  bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  c0:	0f b6 10             	movzbl (%rax),%edx
+  c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  c7:	0f b6 00             	movzbl (%rax),%eax
+  ca:	38 c2                	cmp    %al,%dl
+  cc:	74 d9                	je     a7 <strcmp+0x12>
+  return (uchar)*p - (uchar)*q;
+  ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  d2:	0f b6 00             	movzbl (%rax),%eax
+  d5:	0f b6 d0             	movzbl %al,%edx
+  d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  dc:	0f b6 00             	movzbl (%rax),%eax
+  df:	0f b6 c0             	movzbl %al,%eax
+  e2:	29 c2                	sub    %eax,%edx
+  e4:	89 d0                	mov    %edx,%eax
+}
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+00000000000000e8 <strlen>:
+
+uint
+strlen(char *s)
+{
+  e8:	55                   	push   %rbp
+  e9:	48 89 e5             	mov    %rsp,%rbp
+  ec:	48 83 ec 18          	sub    $0x18,%rsp
+  f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  fb:	eb 04                	jmp    101 <strlen+0x19>
+  fd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 101:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 104:	48 63 d0             	movslq %eax,%rdx
+ 107:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 10b:	48 01 d0             	add    %rdx,%rax
+ 10e:	0f b6 00             	movzbl (%rax),%eax
+ 111:	84 c0                	test   %al,%al
+ 113:	75 e8                	jne    fd <strlen+0x15>
+    ;
+  return n;
+ 115:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 118:	c9                   	leave
+ 119:	c3                   	ret
+
+000000000000011a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 11a:	55                   	push   %rbp
+ 11b:	48 89 e5             	mov    %rsp,%rbp
+ 11e:	48 83 ec 10          	sub    $0x10,%rsp
+ 122:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 126:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 129:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 12c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 12f:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 132:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 136:	89 ce                	mov    %ecx,%esi
+ 138:	48 89 c7             	mov    %rax,%rdi
+ 13b:	e8 dc fe ff ff       	call   1c <stosb>
+  return dst;
+ 140:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 144:	c9                   	leave
+ 145:	c3                   	ret
+
+0000000000000146 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 146:	55                   	push   %rbp
+ 147:	48 89 e5             	mov    %rsp,%rbp
+ 14a:	48 83 ec 10          	sub    $0x10,%rsp
+ 14e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 152:	89 f0                	mov    %esi,%eax
+ 154:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 157:	eb 17                	jmp    170 <strchr+0x2a>
+    if(*s == c)
+ 159:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 15d:	0f b6 00             	movzbl (%rax),%eax
+ 160:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 163:	75 06                	jne    16b <strchr+0x25>
+      return (char*)s;
+ 165:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 169:	eb 15                	jmp    180 <strchr+0x3a>
+  for(; *s; s++)
+ 16b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 170:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 174:	0f b6 00             	movzbl (%rax),%eax
+ 177:	84 c0                	test   %al,%al
+ 179:	75 de                	jne    159 <strchr+0x13>
+  return 0;
+ 17b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 180:	c9                   	leave
+ 181:	c3                   	ret
+
+0000000000000182 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 182:	55                   	push   %rbp
+ 183:	48 89 e5             	mov    %rsp,%rbp
+ 186:	48 83 ec 20          	sub    $0x20,%rsp
+ 18a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 18e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 191:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 198:	eb 48                	jmp    1e2 <gets+0x60>
+    cc = read(0, &c, 1);
+ 19a:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 19e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 1a3:	48 89 c6             	mov    %rax,%rsi
+ 1a6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 1ab:	e8 7f 01 00 00       	call   32f <read>
+ 1b0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 1b3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 1b7:	7e 36                	jle    1ef <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 1b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1bc:	8d 50 01             	lea    0x1(%rax),%edx
+ 1bf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1c2:	48 63 d0             	movslq %eax,%rdx
+ 1c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 1c9:	48 01 c2             	add    %rax,%rdx
+ 1cc:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 1d0:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 1d2:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 1d6:	3c 0a                	cmp    $0xa,%al
+ 1d8:	74 16                	je     1f0 <gets+0x6e>
+ 1da:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 1de:	3c 0d                	cmp    $0xd,%al
+ 1e0:	74 0e                	je     1f0 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 1e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1e5:	83 c0 01             	add    $0x1,%eax
+ 1e8:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 1eb:	7f ad                	jg     19a <gets+0x18>
+ 1ed:	eb 01                	jmp    1f0 <gets+0x6e>
+      break;
+ 1ef:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1f3:	48 63 d0             	movslq %eax,%rdx
+ 1f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 1fa:	48 01 d0             	add    %rdx,%rax
+ 1fd:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 200:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+
+0000000000000206 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 206:	55                   	push   %rbp
+ 207:	48 89 e5             	mov    %rsp,%rbp
+ 20a:	48 83 ec 20          	sub    $0x20,%rsp
+ 20e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 212:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 216:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 21a:	be 00 00 00 00       	mov    $0x0,%esi
+ 21f:	48 89 c7             	mov    %rax,%rdi
+ 222:	e8 3a 01 00 00       	call   361 <open>
+ 227:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 22a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 22e:	79 07                	jns    237 <stat+0x31>
+    return -1;
+ 230:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 235:	eb 21                	jmp    258 <stat+0x52>
+  r = fstat(fd, st);
+ 237:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 23b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 23e:	48 89 d6             	mov    %rdx,%rsi
+ 241:	89 c7                	mov    %eax,%edi
+ 243:	e8 37 01 00 00       	call   37f <fstat>
+ 248:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 24b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 24e:	89 c7                	mov    %eax,%edi
+ 250:	e8 ee 00 00 00       	call   343 <close>
+  return r;
+ 255:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 258:	c9                   	leave
+ 259:	c3                   	ret
+
+000000000000025a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 25a:	55                   	push   %rbp
+ 25b:	48 89 e5             	mov    %rsp,%rbp
+ 25e:	48 83 ec 18          	sub    $0x18,%rsp
+ 262:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 266:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 26d:	eb 28                	jmp    297 <atoi+0x3d>
+    n = n*10 + *s++ - '0';
+ 26f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 272:	89 d0                	mov    %edx,%eax
+ 274:	c1 e0 02             	shl    $0x2,%eax
+ 277:	01 d0                	add    %edx,%eax
+ 279:	01 c0                	add    %eax,%eax
+ 27b:	89 c1                	mov    %eax,%ecx
+ 27d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 281:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 285:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 289:	0f b6 00             	movzbl (%rax),%eax
+ 28c:	0f be c0             	movsbl %al,%eax
+ 28f:	01 c8                	add    %ecx,%eax
+ 291:	83 e8 30             	sub    $0x30,%eax
+ 294:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 297:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 29b:	0f b6 00             	movzbl (%rax),%eax
+ 29e:	3c 2f                	cmp    $0x2f,%al
+ 2a0:	7e 0b                	jle    2ad <atoi+0x53>
+ 2a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2a6:	0f b6 00             	movzbl (%rax),%eax
+ 2a9:	3c 39                	cmp    $0x39,%al
+ 2ab:	7e c2                	jle    26f <atoi+0x15>
+  return n;
+ 2ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 2b0:	c9                   	leave
+ 2b1:	c3                   	ret
+
+00000000000002b2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2b2:	55                   	push   %rbp
+ 2b3:	48 89 e5             	mov    %rsp,%rbp
+ 2b6:	48 83 ec 28          	sub    $0x28,%rsp
+ 2ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 2be:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 2c2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+  
+  dst = vdst;
+ 2c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 2c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 2cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 2d1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 2d5:	eb 1d                	jmp    2f4 <memmove+0x42>
+    *dst++ = *src++;
+ 2d7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 2db:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 2df:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 2e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2e7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 2eb:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 2ef:	0f b6 12             	movzbl (%rdx),%edx
+ 2f2:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 2f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 2f7:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 2fa:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	7f d6                	jg     2d7 <memmove+0x25>
+  return vdst;
+ 301:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 305:	c9                   	leave
+ 306:	c3                   	ret
+
+0000000000000307 <fork>:
+  popq %r13; \
+  popq %r12; \
+  retq
+
+// fork and exec need the full trap frame that int builds.
+SYSCALL(fork)
+ 307:	48 c7 c0 01 00 00 00 	mov    $0x1,%rax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+0000000000000311 <exit>:
+SYSCALL_FAST(exit)
+ 311:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+ 318:	0f 05                	syscall
+ 31a:	c3                   	ret
+
+000000000000031b <wait>:
+SYSCALL_FAST(wait)
+ 31b:	48 c7 c0 03 00 00 00 	mov    $0x3,%rax
+ 322:	0f 05                	syscall
+ 324:	c3                   	ret
+
+0000000000000325 <pipe>:
+SYSCALL_FAST(pipe)
+ 325:	48 c7 c0 04 00 00 00 	mov    $0x4,%rax
+ 32c:	0f 05                	syscall
+ 32e:	c3                   	ret
+
+000000000000032f <read>:
+SYSCALL_FAST(read)
+ 32f:	48 c7 c0 05 00 00 00 	mov    $0x5,%rax
+ 336:	0f 05                	syscall
+ 338:	c3                   	ret
+
+0000000000000339 <write>:
+SYSCALL_FAST(write)
+ 339:	48 c7 c0 10 00 00 00 	mov    $0x10,%rax
+ 340:	0f 05                	syscall
+ 342:	c3                   	ret
+
+0000000000000343 <close>:
+SYSCALL_FAST(close)
+ 343:	48 c7 c0 15 00 00 00 	mov    $0x15,%rax
+ 34a:	0f 05                	syscall
+ 34c:	c3                   	ret
+
+000000000000034d <kill>:
+SYSCALL_FAST(kill)
+ 34d:	48 c7 c0 06 00 00 00 	mov    $0x6,%rax
+ 354:	0f 05                	syscall
+ 356:	c3                   	ret
+
+0000000000000357 <exec>:
+SYSCALL(exec)
+ 357:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+0000000000000361 <open>:
+SYSCALL_FAST(open)
+ 361:	48 c7 c0 0f 00 00 00 	mov    $0xf,%rax
+ 368:	0f 05                	syscall
+ 36a:	c3                   	ret
+
+000000000000036b <mknod>:
+SYSCALL_FAST(mknod)
+ 36b:	48 c7 c0 11 00 00 00 	mov    $0x11,%rax
+ 372:	0f 05                	syscall
+ 374:	c3                   	ret
+
+0000000000000375 <unlink>:
+SYSCALL_FAST(unlink)
+ 375:	48 c7 c0 12 00 00 00 	mov    $0x12,%rax
+ 37c:	0f 05                	syscall
+ 37e:	c3                   	ret
+
+000000000000037f <fstat>:
+SYSCALL_FAST(fstat)
+ 37f:	48 c7 c0 08 00 00 00 	mov    $0x8,%rax
+ 386:	0f 05                	syscall
+ 388:	c3                   	ret
+
+0000000000000389 <link>:
+SYSCALL_FAST(link)
+ 389:	48 c7 c0 13 00 00 00 	mov    $0x13,%rax
+ 390:	0f 05                	syscall
+ 392:	c3                   	ret
+
+0000000000000393 <mkdir>:
+SYSCALL_FAST(mkdir)
+ 393:	48 c7 c0 14 00 00 00 	mov    $0x14,%rax
+ 39a:	0f 05                	syscall
+ 39c:	c3                   	ret
+
+000000000000039d <chdir>:
+SYSCALL_FAST(chdir)
+ 39d:	48 c7 c0 09 00 00 00 	mov    $0x9,%rax
+ 3a4:	0f 05                	syscall
+ 3a6:	c3                   	ret
+
+00000000000003a7 <dup>:
+SYSCALL_FAST(dup)
+ 3a7:	48 c7 c0 0a 00 00 00 	mov    $0xa,%rax
+ 3ae:	0f 05                	syscall
+ 3b0:	c3                   	ret
+
+00000000000003b1 <sbrk>:
+SYSCALL_FAST(sbrk)
+ 3b1:	48 c7 c0 0c 00 00 00 	mov    $0xc,%rax
+ 3b8:	0f 05                	syscall
+ 3ba:	c3                   	ret
+
+00000000000003bb <sleep>:
+SYSCALL_FAST(sleep)
+ 3bb:	48 c7 c0 0d 00 00 00 	mov    $0xd,%rax
+ 3c2:	0f 05                	syscall
+ 3c4:	c3                   	ret
+
+00000000000003c5 <send>:
+SYSCALL_FAST(send)
+ 3c5:	48 c7 c0 16 00 00 00 	mov    $0x16,%rax
+ 3cc:	0f 05                	syscall
+ 3ce:	c3                   	ret
+
+00000000000003cf <send_recv>:
+SYSCALL_FAST(send_recv)
+ 3cf:	48 c7 c0 18 00 00 00 	mov    $0x18,%rax
+ 3d6:	0f 05                	syscall
+ 3d8:	c3                   	ret
+
+00000000000003d9 <recv>:
+SYSCALL_FAST(recv)
+ 3d9:	48 c7 c0 17 00 00 00 	mov    $0x17,%rax
+ 3e0:	0f 05                	syscall
+ 3e2:	c3                   	ret
+
+00000000000003e3 <call>:
+SYSCALL_FAST(call)
+ 3e3:	48 c7 c0 1c 00 00 00 	mov    $0x1c,%rax
+ 3ea:	0f 05                	syscall
+ 3ec:	c3                   	ret
+
+00000000000003ed <reply_recv>:
+SYSCALL_FAST(reply_recv)
+ 3ed:	48 c7 c0 1d 00 00 00 	mov    $0x1d,%rax
+ 3f4:	0f 05                	syscall
+ 3f6:	c3                   	ret
+
+00000000000003f7 <send_reg>:
+SYSCALL_REG(send_reg)
+ 3f7:	41 54                	push   %r12
+ 3f9:	41 55                	push   %r13
+ 3fb:	41 56                	push   %r14
+ 3fd:	41 57                	push   %r15
+ 3ff:	56                   	push   %rsi
+ 400:	49 89 f3             	mov    %rsi,%r11
+ 403:	48 89 d6             	mov    %rdx,%rsi
+ 406:	49 8b 13             	mov    (%r11),%rdx
+ 409:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 40d:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 411:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 415:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 419:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 41d:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 421:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 425:	48 c7 c0 1e 00 00 00 	mov    $0x1e,%rax
+ 42c:	0f 05                	syscall
+ 42e:	41 5b                	pop    %r11
+ 430:	49 89 13             	mov    %rdx,(%r11)
+ 433:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 437:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 43b:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 43f:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 443:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 447:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 44b:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 44f:	41 5f                	pop    %r15
+ 451:	41 5e                	pop    %r14
+ 453:	41 5d                	pop    %r13
+ 455:	41 5c                	pop    %r12
+ 457:	c3                   	ret
+
+0000000000000458 <recv_reg>:
+SYSCALL_REG(recv_reg)
+ 458:	41 54                	push   %r12
+ 45a:	41 55                	push   %r13
+ 45c:	41 56                	push   %r14
+ 45e:	41 57                	push   %r15
+ 460:	56                   	push   %rsi
+ 461:	49 89 f3             	mov    %rsi,%r11
+ 464:	48 89 d6             	mov    %rdx,%rsi
+ 467:	49 8b 13             	mov    (%r11),%rdx
+ 46a:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 46e:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 472:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 476:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 47a:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 47e:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 482:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 486:	48 c7 c0 1f 00 00 00 	mov    $0x1f,%rax
+ 48d:	0f 05                	syscall
+ 48f:	41 5b                	pop    %r11
+ 491:	49 89 13             	mov    %rdx,(%r11)
+ 494:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 498:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 49c:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 4a0:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 4a4:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 4a8:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 4ac:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 4b0:	41 5f                	pop    %r15
+ 4b2:	41 5e                	pop    %r14
+ 4b4:	41 5d                	pop    %r13
+ 4b6:	41 5c                	pop    %r12
+ 4b8:	c3                   	ret
+
+00000000000004b9 <send_recv_reg>:
+SYSCALL_REG(send_recv_reg)
+ 4b9:	41 54                	push   %r12
+ 4bb:	41 55                	push   %r13
+ 4bd:	41 56                	push   %r14
+ 4bf:	41 57                	push   %r15
+ 4c1:	56                   	push   %rsi
+ 4c2:	49 89 f3             	mov    %rsi,%r11
+ 4c5:	48 89 d6             	mov    %rdx,%rsi
+ 4c8:	49 8b 13             	mov    (%r11),%rdx
+ 4cb:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 4cf:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 4d3:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 4d7:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 4db:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 4df:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 4e3:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 4e7:	48 c7 c0 20 00 00 00 	mov    $0x20,%rax
+ 4ee:	0f 05                	syscall
+ 4f0:	41 5b                	pop    %r11
+ 4f2:	49 89 13             	mov    %rdx,(%r11)
+ 4f5:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 4f9:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 4fd:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 501:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 505:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 509:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 50d:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 511:	41 5f                	pop    %r15
+ 513:	41 5e                	pop    %r14
+ 515:	41 5d                	pop    %r13
+ 517:	41 5c                	pop    %r12
+ 519:	c3                   	ret
+
+000000000000051a <call_reg>:
+SYSCALL_REG(call_reg)
+ 51a:	41 54                	push   %r12
+ 51c:	41 55                	push   %r13
+ 51e:	41 56                	push   %r14
+ 520:	41 57                	push   %r15
+ 522:	56                   	push   %rsi
+ 523:	49 89 f3             	mov    %rsi,%r11
+ 526:	48 89 d6             	mov    %rdx,%rsi
+ 529:	49 8b 13             	mov    (%r11),%rdx
+ 52c:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 530:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 534:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 538:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 53c:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 540:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 544:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 548:	48 c7 c0 21 00 00 00 	mov    $0x21,%rax
+ 54f:	0f 05                	syscall
+ 551:	41 5b                	pop    %r11
+ 553:	49 89 13             	mov    %rdx,(%r11)
+ 556:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 55a:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 55e:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 562:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 566:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 56a:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 56e:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 572:	41 5f                	pop    %r15
+ 574:	41 5e                	pop    %r14
+ 576:	41 5d                	pop    %r13
+ 578:	41 5c                	pop    %r12
+ 57a:	c3                   	ret
+
+000000000000057b <reply_recv_reg>:
+SYSCALL_REG(reply_recv_reg)
+ 57b:	41 54                	push   %r12
+ 57d:	41 55                	push   %r13
+ 57f:	41 56                	push   %r14
+ 581:	41 57                	push   %r15
+ 583:	56                   	push   %rsi
+ 584:	49 89 f3             	mov    %rsi,%r11
+ 587:	48 89 d6             	mov    %rdx,%rsi
+ 58a:	49 8b 13             	mov    (%r11),%rdx
+ 58d:	4d 8b 43 08          	mov    0x8(%r11),%r8
+ 591:	4d 8b 4b 10          	mov    0x10(%r11),%r9
+ 595:	4d 8b 53 18          	mov    0x18(%r11),%r10
+ 599:	4d 8b 63 20          	mov    0x20(%r11),%r12
+ 59d:	4d 8b 6b 28          	mov    0x28(%r11),%r13
+ 5a1:	4d 8b 73 30          	mov    0x30(%r11),%r14
+ 5a5:	4d 8b 7b 38          	mov    0x38(%r11),%r15
+ 5a9:	48 c7 c0 22 00 00 00 	mov    $0x22,%rax
+ 5b0:	0f 05                	syscall
+ 5b2:	41 5b                	pop    %r11
+ 5b4:	49 89 13             	mov    %rdx,(%r11)
+ 5b7:	4d 89 43 08          	mov    %r8,0x8(%r11)
+ 5bb:	4d 89 4b 10          	mov    %r9,0x10(%r11)
+ 5bf:	4d 89 53 18          	mov    %r10,0x18(%r11)
+ 5c3:	4d 89 63 20          	mov    %r12,0x20(%r11)
+ 5c7:	4d 89 6b 28          	mov    %r13,0x28(%r11)
+ 5cb:	4d 89 73 30          	mov    %r14,0x30(%r11)
+ 5cf:	4d 89 7b 38          	mov    %r15,0x38(%r11)
+ 5d3:	41 5f                	pop    %r15
+ 5d5:	41 5e                	pop    %r14
+ 5d7:	41 5d                	pop    %r13
+ 5d9:	41 5c                	pop    %r12
+ 5db:	c3                   	ret
+
+00000000000005dc <sendx>:
+SYSCALL_FAST(sendx)
+ 5dc:	48 c7 c0 23 00 00 00 	mov    $0x23,%rax
+ 5e3:	0f 05                	syscall
+ 5e5:	c3                   	ret
+
+00000000000005e6 <ring_attach>:
+SYSCALL_FAST(ring_attach)
+ 5e6:	48 c7 c0 24 00 00 00 	mov    $0x24,%rax
+ 5ed:	0f 05                	syscall
+ 5ef:	c3                   	ret
+
+00000000000005f0 <notify>:
+SYSCALL_FAST(notify)
+ 5f0:	48 c7 c0 25 00 00 00 	mov    $0x25,%rax
+ 5f7:	0f 05                	syscall
+ 5f9:	c3                   	ret
+
+00000000000005fa <nfy_wait>:
+SYSCALL_FAST(nfy_wait)
+ 5fa:	48 c7 c0 26 00 00 00 	mov    $0x26,%rax
+ 601:	0f 05                	syscall
+ 603:	c3                   	ret
+
+0000000000000604 <send_timed>:
+SYSCALL_FAST(send_timed)
+ 604:	48 c7 c0 27 00 00 00 	mov    $0x27,%rax
+ 60b:	0f 05                	syscall
+ 60d:	c3                   	ret
+
+000000000000060e <recv_timed>:
+SYSCALL_FAST(recv_timed)
+ 60e:	48 c7 c0 28 00 00 00 	mov    $0x28,%rax
+ 615:	0f 05                	syscall
+ 617:	c3                   	ret
+
+0000000000000618 <set_add>:
+SYSCALL_FAST(set_add)
+ 618:	48 c7 c0 29 00 00 00 	mov    $0x29,%rax
+ 61f:	0f 05                	syscall
+ 621:	c3                   	ret
+
+0000000000000622 <set_del>:
+SYSCALL_FAST(set_del)
+ 622:	48 c7 c0 2a 00 00 00 	mov    $0x2a,%rax
+ 629:	0f 05                	syscall
+ 62b:	c3                   	ret
+
+000000000000062c <recv_any>:
+SYSCALL_FAST(recv_any)
+ 62c:	48 c7 c0 2b 00 00 00 	mov    $0x2b,%rax
+ 633:	0f 05                	syscall
+ 635:	c3                   	ret
+
+0000000000000636 <ep_create>:
+SYSCALL_FAST(ep_create)
+ 636:	48 c7 c0 2c 00 00 00 	mov    $0x2c,%rax
+ 63d:	0f 05                	syscall
+ 63f:	c3                   	ret
+
+0000000000000640 <ep_close>:
+SYSCALL_FAST(ep_close)
+ 640:	48 c7 c0 2d 00 00 00 	mov    $0x2d,%rax
+ 647:	0f 05                	syscall
+ 649:	c3                   	ret
+
+000000000000064a <ipc_affinity>:
+SYSCALL_FAST(ipc_affinity)
+ 64a:	48 c7 c0 2e 00 00 00 	mov    $0x2e,%rax
+ 651:	0f 05                	syscall
+ 653:	c3                   	ret
+
+0000000000000654 <setprio>:
+SYSCALL_FAST(setprio)
+ 654:	48 c7 c0 2f 00 00 00 	mov    $0x2f,%rax
+ 65b:	0f 05                	syscall
+ 65d:	c3                   	ret
+
+000000000000065e <ipc_batch>:
+SYSCALL_FAST(ipc_batch)
+ 65e:	48 c7 c0 30 00 00 00 	mov    $0x30,%rax
+ 665:	0f 05                	syscall
+ 667:	c3                   	ret
+
+0000000000000668 <sethuge>:
+SYSCALL_FAST(sethuge)
+ 668:	48 c7 c0 31 00 00 00 	mov    $0x31,%rax
+ 66f:	0f 05                	syscall
+ 671:	c3                   	ret
+
+0000000000000672 <cr3_test>:
+SYSCALL_FAST(cr3_test)
+ 672:	48 c7 c0 19 00 00 00 	mov    $0x19,%rax
+ 679:	0f 05                	syscall
+ 67b:	c3                   	ret
+
+000000000000067c <cr3_kernel>:
+SYSCALL_FAST(cr3_kernel)
+ 67c:	48 c7 c0 1a 00 00 00 	mov    $0x1a,%rax
+ 683:	0f 05                	syscall
+ 685:	c3                   	ret
+
+0000000000000686 <cr3_switch>:
+SYSCALL_FAST(cr3_switch)
+ 686:	48 c7 c0 32 00 00 00 	mov    $0x32,%rax
+ 68d:	0f 05                	syscall
+ 68f:	c3                   	ret
+
+0000000000000690 <null_call>:
+ 690:	48 c7 c0 1b 00 00 00 	mov    $0x1b,%rax
+ 697:	0f 05                	syscall
+ 699:	c3                   	ret
+
+000000000000069a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 69a:	55                   	push   %rbp
+ 69b:	48 89 e5             	mov    %rsp,%rbp
+ 69e:	48 83 ec 10          	sub    $0x10,%rsp
+ 6a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 6a5:	89 f0                	mov    %esi,%eax
+ 6a7:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+ 6aa:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 6ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6b1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 6b6:	48 89 ce             	mov    %rcx,%rsi
+ 6b9:	89 c7                	mov    %eax,%edi
+ 6bb:	e8 79 fc ff ff       	call   339 <write>
+}
+ 6c0:	90                   	nop
+ 6c1:	c9                   	leave
+ 6c2:	c3                   	ret
+
+00000000000006c3 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6c3:	55                   	push   %rbp
+ 6c4:	48 89 e5             	mov    %rsp,%rbp
+ 6c7:	48 83 ec 30          	sub    $0x30,%rsp
+ 6cb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 6ce:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 6d1:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 6d4:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6d7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 6de:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 6e2:	74 17                	je     6fb <printint+0x38>
+ 6e4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 6e8:	79 11                	jns    6fb <printint+0x38>
+    neg = 1;
+ 6ea:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 6f1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 6f4:	f7 d8                	neg    %eax
+ 6f6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 6f9:	eb 06                	jmp    701 <printint+0x3e>
+  } else {
+    x = xx;
+ 6fb:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 6fe:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 701:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 708:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 70b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 70e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 713:	f7 f1                	div    %ecx
+ 715:	89 d1                	mov    %edx,%ecx
+ 717:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 71a:	8d 50 01             	lea    0x1(%rax),%edx
+ 71d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 720:	89 ca                	mov    %ecx,%edx
+ 722:	0f b6 92 30 12 00 00 	movzbl 0x1230(%rdx),%edx
+ 729:	48 98                	cltq
+ 72b:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 72f:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 732:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 735:	ba 00 00 00 00       	mov    $0x0,%edx
+ 73a:	f7 f6                	div    %esi
+ 73c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 73f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 743:	75 c3                	jne    708 <printint+0x45>
+  if(neg)
+ 745:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 749:	74 2b                	je     776 <printint+0xb3>
+    buf[i++] = '-';
+ 74b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 74e:	8d 50 01             	lea    0x1(%rax),%edx
+ 751:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 754:	48 98                	cltq
+ 756:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 75b:	eb 19                	jmp    776 <printint+0xb3>
+    putc(fd, buf[i]);
+ 75d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 760:	48 98                	cltq
+ 762:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+ 767:	0f be d0             	movsbl %al,%edx
+ 76a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 76d:	89 d6                	mov    %edx,%esi
+ 76f:	89 c7                	mov    %eax,%edi
+ 771:	e8 24 ff ff ff       	call   69a <putc>
+  while(--i >= 0)
+ 776:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 77a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 77e:	79 dd                	jns    75d <printint+0x9a>
+}
+ 780:	90                   	nop
+ 781:	90                   	nop
+ 782:	c9                   	leave
+ 783:	c3                   	ret
+
+0000000000000784 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 784:	55                   	push   %rbp
+ 785:	48 89 e5             	mov    %rsp,%rbp
+ 788:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+ 78f:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+ 795:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+ 79c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+ 7a3:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+ 7aa:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+ 7b1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	74 20                	je     7dc <printf+0x58>
+ 7bc:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+ 7c0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+ 7c4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+ 7c8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+ 7cc:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+ 7d0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+ 7d4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+ 7d8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 7dc:	c7 85 20 ff ff ff 10 	movl   $0x10,-0xe0(%rbp)
+ 7e3:	00 00 00 
+ 7e6:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+ 7ed:	00 00 00 
+ 7f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 7f4:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+ 7fb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+ 802:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  state = 0;
+ 809:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ 810:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ 813:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%rbp)
+ 81a:	00 00 00 
+ 81d:	e9 a8 02 00 00       	jmp    aca <printf+0x346>
+    c = fmt[i] & 0xff;
+ 822:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ 828:	48 63 d0             	movslq %eax,%rdx
+ 82b:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ 832:	48 01 d0             	add    %rdx,%rax
+ 835:	0f b6 00             	movzbl (%rax),%eax
+ 838:	0f be c0             	movsbl %al,%eax
+ 83b:	25 ff 00 00 00       	and    $0xff,%eax
+ 840:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    if(state == 0){
+ 846:	83 bd 40 ff ff ff 00 	cmpl   $0x0,-0xc0(%rbp)
+ 84d:	75 35                	jne    884 <printf+0x100>
+      if(c == '%'){
+ 84f:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ 856:	75 0f                	jne    867 <printf+0xe3>
+        state = '%';
+ 858:	c7 85 40 ff ff ff 25 	movl   $0x25,-0xc0(%rbp)
+ 85f:	00 00 00 
+ 862:	e9 5c 02 00 00       	jmp    ac3 <printf+0x33f>
+      } else {
+        putc(fd, c);
+ 867:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ 86d:	0f be d0             	movsbl %al,%edx
+ 870:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 876:	89 d6                	mov    %edx,%esi
+ 878:	89 c7                	mov    %eax,%edi
+ 87a:	e8 1b fe ff ff       	call   69a <putc>
+ 87f:	e9 3f 02 00 00       	jmp    ac3 <printf+0x33f>
+      }
+    } else if(state == '%'){
+ 884:	83 bd 40 ff ff ff 25 	cmpl   $0x25,-0xc0(%rbp)
+ 88b:	0f 85 32 02 00 00    	jne    ac3 <printf+0x33f>
+      if(c == 'd'){
+ 891:	83 bd 3c ff ff ff 64 	cmpl   $0x64,-0xc4(%rbp)
+ 898:	75 5e                	jne    8f8 <printf+0x174>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 89a:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 8a0:	83 f8 2f             	cmp    $0x2f,%eax
+ 8a3:	77 23                	ja     8c8 <printf+0x144>
+ 8a5:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 8ac:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 8b2:	89 d2                	mov    %edx,%edx
+ 8b4:	48 01 d0             	add    %rdx,%rax
+ 8b7:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 8bd:	83 c2 08             	add    $0x8,%edx
+ 8c0:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 8c6:	eb 12                	jmp    8da <printf+0x156>
+ 8c8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 8cf:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 8d3:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 8da:	8b 30                	mov    (%rax),%esi
+ 8dc:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 8e2:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 8e7:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 8ec:	89 c7                	mov    %eax,%edi
+ 8ee:	e8 d0 fd ff ff       	call   6c3 <printint>
+ 8f3:	e9 c1 01 00 00       	jmp    ab9 <printf+0x335>
+      } else if(c == 'x' || c == 'p'){
+ 8f8:	83 bd 3c ff ff ff 78 	cmpl   $0x78,-0xc4(%rbp)
+ 8ff:	74 09                	je     90a <printf+0x186>
+ 901:	83 bd 3c ff ff ff 70 	cmpl   $0x70,-0xc4(%rbp)
+ 908:	75 5e                	jne    968 <printf+0x1e4>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 90a:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 910:	83 f8 2f             	cmp    $0x2f,%eax
+ 913:	77 23                	ja     938 <printf+0x1b4>
+ 915:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 91c:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 922:	89 d2                	mov    %edx,%edx
+ 924:	48 01 d0             	add    %rdx,%rax
+ 927:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 92d:	83 c2 08             	add    $0x8,%edx
+ 930:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 936:	eb 12                	jmp    94a <printf+0x1c6>
+ 938:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 93f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 943:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 94a:	8b 30                	mov    (%rax),%esi
+ 94c:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 952:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 957:	ba 10 00 00 00       	mov    $0x10,%edx
+ 95c:	89 c7                	mov    %eax,%edi
+ 95e:	e8 60 fd ff ff       	call   6c3 <printint>
+ 963:	e9 51 01 00 00       	jmp    ab9 <printf+0x335>
+      } else if(c == 's'){
+ 968:	83 bd 3c ff ff ff 73 	cmpl   $0x73,-0xc4(%rbp)
+ 96f:	0f 85 98 00 00 00    	jne    a0d <printf+0x289>
+        s = va_arg(ap, char*);
+ 975:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ 97b:	83 f8 2f             	cmp    $0x2f,%eax
+ 97e:	77 23                	ja     9a3 <printf+0x21f>
+ 980:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ 987:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 98d:	89 d2                	mov    %edx,%edx
+ 98f:	48 01 d0             	add    %rdx,%rax
+ 992:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ 998:	83 c2 08             	add    $0x8,%edx
+ 99b:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ 9a1:	eb 12                	jmp    9b5 <printf+0x231>
+ 9a3:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ 9aa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 9ae:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ 9b5:	48 8b 00             	mov    (%rax),%rax
+ 9b8:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        if(s == 0)
+ 9bf:	48 83 bd 48 ff ff ff 	cmpq   $0x0,-0xb8(%rbp)
+ 9c6:	00 
+ 9c7:	75 31                	jne    9fa <printf+0x276>
+          s = "(null)";
+ 9c9:	48 c7 85 48 ff ff ff 	movq   $0xf40,-0xb8(%rbp)
+ 9d0:	40 0f 00 00 
+        while(*s != 0){
+ 9d4:	eb 24                	jmp    9fa <printf+0x276>
+          putc(fd, *s);
+ 9d6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ 9dd:	0f b6 00             	movzbl (%rax),%eax
+ 9e0:	0f be d0             	movsbl %al,%edx
+ 9e3:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ 9e9:	89 d6                	mov    %edx,%esi
+ 9eb:	89 c7                	mov    %eax,%edi
+ 9ed:	e8 a8 fc ff ff       	call   69a <putc>
+          s++;
+ 9f2:	48 83 85 48 ff ff ff 	addq   $0x1,-0xb8(%rbp)
+ 9f9:	01 
+        while(*s != 0){
+ 9fa:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+ a01:	0f b6 00             	movzbl (%rax),%eax
+ a04:	84 c0                	test   %al,%al
+ a06:	75 ce                	jne    9d6 <printf+0x252>
+ a08:	e9 ac 00 00 00       	jmp    ab9 <printf+0x335>
+        }
+      } else if(c == 'c'){
+ a0d:	83 bd 3c ff ff ff 63 	cmpl   $0x63,-0xc4(%rbp)
+ a14:	75 56                	jne    a6c <printf+0x2e8>
+        putc(fd, va_arg(ap, uint));
+ a16:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ a1c:	83 f8 2f             	cmp    $0x2f,%eax
+ a1f:	77 23                	ja     a44 <printf+0x2c0>
+ a21:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ a28:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a2e:	89 d2                	mov    %edx,%edx
+ a30:	48 01 d0             	add    %rdx,%rax
+ a33:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ a39:	83 c2 08             	add    $0x8,%edx
+ a3c:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ a42:	eb 12                	jmp    a56 <printf+0x2d2>
+ a44:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ a4b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ a4f:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ a56:	8b 00                	mov    (%rax),%eax
+ a58:	0f be d0             	movsbl %al,%edx
+ a5b:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ a61:	89 d6                	mov    %edx,%esi
+ a63:	89 c7                	mov    %eax,%edi
+ a65:	e8 30 fc ff ff       	call   69a <putc>
+ a6a:	eb 4d                	jmp    ab9 <printf+0x335>
+      } else if(c == '%'){
+ a6c:	83 bd 3c ff ff ff 25 	cmpl   $0x25,-0xc4(%rbp)
+ a73:	75 1a                	jne    a8f <printf+0x30b>
+        putc(fd, c);
+ a75:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ a7b:	0f be d0             	movsbl %al,%edx
+ a7e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ a84:	89 d6                	mov    %edx,%esi
+ a86:	89 c7                	mov    %eax,%edi
+ a88:	e8 0d fc ff ff       	call   69a <putc>
+ a8d:	eb 2a                	jmp    ab9 <printf+0x335>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a8f:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ a95:	be 25 00 00 00       	mov    $0x25,%esi
+ a9a:	89 c7                	mov    %eax,%edi
+ a9c:	e8 f9 fb ff ff       	call   69a <putc>
+        putc(fd, c);
+ aa1:	8b 85 3c ff ff ff    	mov    -0xc4(%rbp),%eax
+ aa7:	0f be d0             	movsbl %al,%edx
+ aaa:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+ ab0:	89 d6                	mov    %edx,%esi
+ ab2:	89 c7                	mov    %eax,%edi
+ ab4:	e8 e1 fb ff ff       	call   69a <putc>
+      }
+      state = 0;
+ ab9:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%rbp)
+ ac0:	00 00 00 
+  for(i = 0; fmt[i]; i++){
+ ac3:	83 85 44 ff ff ff 01 	addl   $0x1,-0xbc(%rbp)
+ aca:	8b 85 44 ff ff ff    	mov    -0xbc(%rbp),%eax
+ ad0:	48 63 d0             	movslq %eax,%rdx
+ ad3:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+ ada:	48 01 d0             	add    %rdx,%rax
+ add:	0f b6 00             	movzbl (%rax),%eax
+ ae0:	84 c0                	test   %al,%al
+ ae2:	0f 85 3a fd ff ff    	jne    822 <printf+0x9e>
+    }
+  }
+}
+ ae8:	90                   	nop
+ ae9:	90                   	nop
+ aea:	c9                   	leave
+ aeb:	c3                   	ret
+
+0000000000000aec <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ aec:	55                   	push   %rbp
+ aed:	48 89 e5             	mov    %rsp,%rbp
+ af0:	48 83 ec 18          	sub    $0x18,%rsp
+ af4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ af8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ afc:	48 83 e8 10          	sub    $0x10,%rax
+ b00:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b04:	48 8b 05 55 07 00 00 	mov    0x755(%rip),%rax        # 1260 <freep>
+ b0b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b0f:	eb 2f                	jmp    b40 <free+0x54>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b15:	48 8b 00             	mov    (%rax),%rax
+ b18:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b1c:	72 17                	jb     b35 <free+0x49>
+ b1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b22:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b26:	72 2f                	jb     b57 <free+0x6b>
+ b28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b2c:	48 8b 00             	mov    (%rax),%rax
+ b2f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ b33:	72 22                	jb     b57 <free+0x6b>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b39:	48 8b 00             	mov    (%rax),%rax
+ b3c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b44:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b48:	73 c7                	jae    b11 <free+0x25>
+ b4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b4e:	48 8b 00             	mov    (%rax),%rax
+ b51:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ b55:	73 ba                	jae    b11 <free+0x25>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b5b:	8b 40 08             	mov    0x8(%rax),%eax
+ b5e:	89 c0                	mov    %eax,%eax
+ b60:	48 c1 e0 04          	shl    $0x4,%rax
+ b64:	48 89 c2             	mov    %rax,%rdx
+ b67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b6b:	48 01 c2             	add    %rax,%rdx
+ b6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b72:	48 8b 00             	mov    (%rax),%rax
+ b75:	48 39 c2             	cmp    %rax,%rdx
+ b78:	75 2d                	jne    ba7 <free+0xbb>
+    bp->s.size += p->s.ptr->s.size;
+ b7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b7e:	8b 50 08             	mov    0x8(%rax),%edx
+ b81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b85:	48 8b 00             	mov    (%rax),%rax
+ b88:	8b 40 08             	mov    0x8(%rax),%eax
+ b8b:	01 c2                	add    %eax,%edx
+ b8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b91:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b98:	48 8b 00             	mov    (%rax),%rax
+ b9b:	48 8b 10             	mov    (%rax),%rdx
+ b9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ba2:	48 89 10             	mov    %rdx,(%rax)
+ ba5:	eb 0e                	jmp    bb5 <free+0xc9>
+  } else
+    bp->s.ptr = p->s.ptr;
+ ba7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bab:	48 8b 10             	mov    (%rax),%rdx
+ bae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bb2:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ bb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bb9:	8b 40 08             	mov    0x8(%rax),%eax
+ bbc:	89 c0                	mov    %eax,%eax
+ bbe:	48 c1 e0 04          	shl    $0x4,%rax
+ bc2:	48 89 c2             	mov    %rax,%rdx
+ bc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bc9:	48 01 d0             	add    %rdx,%rax
+ bcc:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ bd0:	75 27                	jne    bf9 <free+0x10d>
+    p->s.size += bp->s.size;
+ bd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd6:	8b 50 08             	mov    0x8(%rax),%edx
+ bd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bdd:	8b 40 08             	mov    0x8(%rax),%eax
+ be0:	01 c2                	add    %eax,%edx
+ be2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be6:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ be9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bed:	48 8b 10             	mov    (%rax),%rdx
+ bf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bf4:	48 89 10             	mov    %rdx,(%rax)
+ bf7:	eb 0b                	jmp    c04 <free+0x118>
+  } else
+    p->s.ptr = bp;
+ bf9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bfd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ c01:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ c04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c08:	48 89 05 51 06 00 00 	mov    %rax,0x651(%rip)        # 1260 <freep>
+}
+ c0f:	90                   	nop
+ c10:	c9                   	leave
+ c11:	c3                   	ret
+
+0000000000000c12 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c12:	55                   	push   %rbp
+ c13:	48 89 e5             	mov    %rsp,%rbp
+ c16:	48 83 ec 20          	sub    $0x20,%rsp
+ c1a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c1d:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ c24:	77 07                	ja     c2d <morecore+0x1b>
+    nu = 4096;
+ c26:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ c2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c30:	c1 e0 04             	shl    $0x4,%eax
+ c33:	89 c7                	mov    %eax,%edi
+ c35:	e8 77 f7 ff ff       	call   3b1 <sbrk>
+ c3a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ c3e:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ c43:	75 07                	jne    c4c <morecore+0x3a>
+    return 0;
+ c45:	b8 00 00 00 00       	mov    $0x0,%eax
+ c4a:	eb 29                	jmp    c75 <morecore+0x63>
+  hp = (Header*)p;
+ c4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c50:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ c54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c58:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ c5b:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ c5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c62:	48 83 c0 10          	add    $0x10,%rax
+ c66:	48 89 c7             	mov    %rax,%rdi
+ c69:	e8 7e fe ff ff       	call   aec <free>
+  return freep;
+ c6e:	48 8b 05 eb 05 00 00 	mov    0x5eb(%rip),%rax        # 1260 <freep>
+}
+ c75:	c9                   	leave
+ c76:	c3                   	ret
+
+0000000000000c77 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c77:	55                   	push   %rbp
+ c78:	48 89 e5             	mov    %rsp,%rbp
+ c7b:	48 83 ec 30          	sub    $0x30,%rsp
+ c7f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c82:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ c85:	48 83 c0 0f          	add    $0xf,%rax
+ c89:	48 c1 e8 04          	shr    $0x4,%rax
+ c8d:	83 c0 01             	add    $0x1,%eax
+ c90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if((prevp = freep) == 0){
+ c93:	48 8b 05 c6 05 00 00 	mov    0x5c6(%rip),%rax        # 1260 <freep>
+ c9a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c9e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ ca3:	75 2b                	jne    cd0 <malloc+0x59>
+    base.s.ptr = freep = prevp = &base;
+ ca5:	48 c7 45 f0 50 12 00 	movq   $0x1250,-0x10(%rbp)
+ cac:	00 
+ cad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cb1:	48 89 05 a8 05 00 00 	mov    %rax,0x5a8(%rip)        # 1260 <freep>
+ cb8:	48 8b 05 a1 05 00 00 	mov    0x5a1(%rip),%rax        # 1260 <freep>
+ cbf:	48 89 05 8a 05 00 00 	mov    %rax,0x58a(%rip)        # 1250 <base>
+    base.s.size = 0;
+ cc6:	c7 05 88 05 00 00 00 	movl   $0x0,0x588(%rip)        # 1258 <base+0x8>
+ ccd:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cd4:	48 8b 00             	mov    (%rax),%rax
+ cd7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ cdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cdf:	8b 40 08             	mov    0x8(%rax),%eax
+ ce2:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ ce5:	72 5f                	jb     d46 <malloc+0xcf>
+      if(p->s.size == nunits)
+ ce7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ceb:	8b 40 08             	mov    0x8(%rax),%eax
+ cee:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ cf1:	75 10                	jne    d03 <malloc+0x8c>
+        prevp->s.ptr = p->s.ptr;
+ cf3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cf7:	48 8b 10             	mov    (%rax),%rdx
+ cfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cfe:	48 89 10             	mov    %rdx,(%rax)
+ d01:	eb 2e                	jmp    d31 <malloc+0xba>
+      else {
+        p->s.size -= nunits;
+ d03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d07:	8b 40 08             	mov    0x8(%rax),%eax
+ d0a:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ d0d:	89 c2                	mov    %eax,%edx
+ d0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d13:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ d16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d1a:	8b 40 08             	mov    0x8(%rax),%eax
+ d1d:	89 c0                	mov    %eax,%eax
+ d1f:	48 c1 e0 04          	shl    $0x4,%rax
+ d23:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ d27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d2b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ d2e:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ d31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d35:	48 89 05 24 05 00 00 	mov    %rax,0x524(%rip)        # 1260 <freep>
+      return (void*)(p + 1);
+ d3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d40:	48 83 c0 10          	add    $0x10,%rax
+ d44:	eb 41                	jmp    d87 <malloc+0x110>
+    }
+    if(p == freep)
+ d46:	48 8b 05 13 05 00 00 	mov    0x513(%rip),%rax        # 1260 <freep>
+ d4d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ d51:	75 1c                	jne    d6f <malloc+0xf8>
+      if((p = morecore(nunits)) == 0)
+ d53:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ d56:	89 c7                	mov    %eax,%edi
+ d58:	e8 b5 fe ff ff       	call   c12 <morecore>
+ d5d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ d61:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ d66:	75 07                	jne    d6f <malloc+0xf8>
+        return 0;
+ d68:	b8 00 00 00 00       	mov    $0x0,%eax
+ d6d:	eb 18                	jmp    d87 <malloc+0x110>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d73:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ d77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d7b:	48 8b 00             	mov    (%rax),%rax
+ d7e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ d82:	e9 54 ff ff ff       	jmp    cdb <malloc+0x64>
+  }
+}
+ d87:	c9                   	leave
+ d88:	c3                   	ret
+
+0000000000000d89 <ring_send>:
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+ d89:	55                   	push   %rbp
+ d8a:	48 89 e5             	mov    %rsp,%rbp
+ d8d:	53                   	push   %rbx
+ d8e:	48 83 ec 38          	sub    $0x38,%rsp
+ d92:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ d95:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ d99:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint t;
+
+  t = r->tail;
+ d9d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ da1:	8b 40 40             	mov    0x40(%rax),%eax
+ da4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(t - r->head == RING_SLOTS)
+ da7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ dab:	8b 00                	mov    (%rax),%eax
+ dad:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ db0:	29 c2                	sub    %eax,%edx
+ db2:	83 fa 20             	cmp    $0x20,%edx
+ db5:	75 0a                	jne    dc1 <ring_send+0x38>
+    return -1;
+ db7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ dbc:	e9 93 00 00 00       	jmp    e54 <ring_send+0xcb>
+  r->slot[t % RING_SLOTS] = *m;
+ dc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ dc4:	83 e0 1f             	and    $0x1f,%eax
+ dc7:	89 c2                	mov    %eax,%edx
+ dc9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ dcd:	89 d2                	mov    %edx,%edx
+ dcf:	48 83 c2 02          	add    $0x2,%rdx
+ dd3:	48 c1 e2 06          	shl    $0x6,%rdx
+ dd7:	48 01 c2             	add    %rax,%rdx
+ dda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ dde:	48 8b 08             	mov    (%rax),%rcx
+ de1:	48 8b 58 08          	mov    0x8(%rax),%rbx
+ de5:	48 89 0a             	mov    %rcx,(%rdx)
+ de8:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+ dec:	48 8b 48 10          	mov    0x10(%rax),%rcx
+ df0:	48 8b 58 18          	mov    0x18(%rax),%rbx
+ df4:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+ df8:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+ dfc:	48 8b 48 20          	mov    0x20(%rax),%rcx
+ e00:	48 8b 58 28          	mov    0x28(%rax),%rbx
+ e04:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+ e08:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+ e0c:	48 8b 48 30          	mov    0x30(%rax),%rcx
+ e10:	48 8b 58 38          	mov    0x38(%rax),%rbx
+ e14:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+ e18:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  __sync_synchronize();
+ e1c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->tail = t + 1;
+ e22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e25:	8d 50 01             	lea    0x1(%rax),%edx
+ e28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e2c:	89 50 40             	mov    %edx,0x40(%rax)
+  __sync_synchronize();
+ e2f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  if(r->head == t)
+ e35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e39:	8b 00                	mov    (%rax),%eax
+ e3b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ e3e:	75 0f                	jne    e4f <ring_send+0xc6>
+    notify(channel, 1);
+ e40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ e43:	be 01 00 00 00       	mov    $0x1,%esi
+ e48:	89 c7                	mov    %eax,%edi
+ e4a:	e8 a1 f7 ff ff       	call   5f0 <notify>
+  return 0;
+ e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ e54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ e58:	c9                   	leave
+ e59:	c3                   	ret
+
+0000000000000e5a <ring_recv>:
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+ e5a:	55                   	push   %rbp
+ e5b:	48 89 e5             	mov    %rsp,%rbp
+ e5e:	53                   	push   %rbx
+ e5f:	48 83 ec 38          	sub    $0x38,%rsp
+ e63:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ e66:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ e6a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint h;
+
+  h = r->head;
+ e6e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e72:	8b 00                	mov    (%rax),%eax
+ e74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(;;){
+    __sync_synchronize();
+ e77:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if(r->tail != h)
+ e7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ e81:	8b 40 40             	mov    0x40(%rax),%eax
+ e84:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ e87:	75 15                	jne    e9e <ring_recv+0x44>
+      break;
+    if(nfy_wait(channel) < 0)
+ e89:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ e8c:	89 c7                	mov    %eax,%edi
+ e8e:	e8 67 f7 ff ff       	call   5fa <nfy_wait>
+ e93:	85 c0                	test   %eax,%eax
+ e95:	79 e0                	jns    e77 <ring_recv+0x1d>
+      return -1;
+ e97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e9c:	eb 73                	jmp    f11 <ring_recv+0xb7>
+      break;
+ e9e:	90                   	nop
+  }
+  *m = r->slot[h % RING_SLOTS];
+ e9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ ea2:	83 e0 1f             	and    $0x1f,%eax
+ ea5:	89 c1                	mov    %eax,%ecx
+ ea7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ eab:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ eaf:	89 c9                	mov    %ecx,%ecx
+ eb1:	48 83 c1 02          	add    $0x2,%rcx
+ eb5:	48 c1 e1 06          	shl    $0x6,%rcx
+ eb9:	48 01 ca             	add    %rcx,%rdx
+ ebc:	48 8b 0a             	mov    (%rdx),%rcx
+ ebf:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+ ec3:	48 89 08             	mov    %rcx,(%rax)
+ ec6:	48 89 58 08          	mov    %rbx,0x8(%rax)
+ eca:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+ ece:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+ ed2:	48 89 48 10          	mov    %rcx,0x10(%rax)
+ ed6:	48 89 58 18          	mov    %rbx,0x18(%rax)
+ eda:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+ ede:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+ ee2:	48 89 48 20          	mov    %rcx,0x20(%rax)
+ ee6:	48 89 58 28          	mov    %rbx,0x28(%rax)
+ eea:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+ eee:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+ ef2:	48 89 48 30          	mov    %rcx,0x30(%rax)
+ ef6:	48 89 58 38          	mov    %rbx,0x38(%rax)
+  __sync_synchronize();
+ efa:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  r->head = h + 1;
+ f00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ f03:	8d 50 01             	lea    0x1(%rax),%edx
+ f06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ f0a:	89 10                	mov    %edx,(%rax)
+  return 0;
+ f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ f11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ f15:	c9                   	leave
+ f16:	c3                   	ret
+
+0000000000000f17 <uptime>:
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+ f17:	55                   	push   %rbp
+ f18:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->ticks;
+ f1b:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ f20:	8b 00                	mov    (%rax),%eax
+}
+ f22:	5d                   	pop    %rbp
+ f23:	c3                   	ret
+
+0000000000000f24 <getpid>:
+
+int
+getpid(void)
+{
+ f24:	55                   	push   %rbp
+ f25:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vproc*)VPROC)->pid;
+ f28:	b8 00 10 a0 3f       	mov    $0x3fa01000,%eax
+ f2d:	8b 00                	mov    (%rax),%eax
+}
+ f2f:	5d                   	pop    %rbp
+ f30:	c3                   	ret
+
+0000000000000f31 <tscticks>:
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+ f31:	55                   	push   %rbp
+ f32:	48 89 e5             	mov    %rsp,%rbp
+  return ((struct vdso*)VDSO)->tscticks;
+ f35:	b8 00 00 a0 3f       	mov    $0x3fa00000,%eax
+ f3a:	48 8b 40 08          	mov    0x8(%rax),%rax
+}
+ f3e:	5d                   	pop    %rbp
+ f3f:	c3                   	ret
@@ -0,0 +1,50 @@
+#include "types.h"
+#include "user.h"
+#include "ipc.h"
+
+// Single-producer, single-consumer message rings over a page
+// mapped with ring_attach().  The producer only enters the kernel
+// when the ring goes from empty to non-empty; the fences order the
+// index updates against the other side's emptiness check so that
+// a consumer about to wait cannot miss that notification.
+
+// Append m to r, notifying channel if the consumer may be
+// waiting.  Returns 0, or -1 if the ring is full.
+int
+ring_send(int channel, struct ring *r, struct msg *m)
+{
+  uint t;
+
+  t = r->tail;
+  if(t - r->head == RING_SLOTS)
+    return -1;
+  r->slot[t % RING_SLOTS] = *m;
+  __sync_synchronize();
+  r->tail = t + 1;
+  __sync_synchronize();
+  if(r->head == t)
+    notify(channel, 1);
+  return 0;
+}
+
+// Take the oldest message from r into m, waiting on channel's
+// notification word while the ring is empty.  Returns 0, or -1
+// if the wait failed.
+int
+ring_recv(int channel, struct ring *r, struct msg *m)
+{
+  uint h;
+
+  h = r->head;
+  for(;;){
+    __sync_synchronize();
+    if(r->tail != h)
+      break;
+    if(nfy_wait(channel) < 0)
+      return -1;
+  }
+  *m = r->slot[h % RING_SLOTS];
+  __sync_synchronize();
+  r->head = h + 1;
+  return 0;
+}
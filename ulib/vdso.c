@@ -0,0 +1,27 @@
+#include "types.h"
+#include "user.h"
+#include "memlayout.h"
+#include "vdso.h"
+
+// These read the pages the kernel maps at VDSO and VPROC
+// instead of entering the kernel.
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+}
+
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+
+// TSC cycles per timer tick, or 0 while the kernel is still
+// calibrating.
+unsigned long long
+tscticks(void)
+{
+  return ((struct vdso*)VDSO)->tscticks;
+}
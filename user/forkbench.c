@@ -0,0 +1,78 @@
+// forkbench: fork/exec throughput with parallel workers.
+//
+// Starts p workers, each running NITER rounds of fork, exec of
+// forkbench itself (which exits at once) and wait, and times the
+// whole batch.  Prints one line per worker count:
+//   forkbench procs=<p> n=<rounds> total=<kc> per=<c>
+// with the total in thousands of cycles and cycles per round.  On
+// a multiprocessor the per-round figure should fall as p grows up
+// to the number of CPUs.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NITER 200
+#define NELEM(x) (sizeof(x)/sizeof((x)[0]))
+
+static inline unsigned long long
+rdtscp(void)
+{
+  uint lo, hi;
+  asm volatile("rdtscp" : "=a" (lo), "=d" (hi) : : "rcx");
+  return ((unsigned long long)hi << 32) | lo;
+}
+
+static void
+worker(char *self)
+{
+  char *argv[] = { self, "-", 0 };
+  int i, pid;
+
+  for(i = 0; i < NITER; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "forkbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(self, argv);
+      printf(1, "forkbench: exec %s failed\n", self);
+      exit();
+    }
+    wait();
+  }
+  exit();
+}
+
+static void
+bench(char *self, int p)
+{
+  unsigned long long t;
+  int i;
+
+  t = rdtscp();
+  for(i = 0; i < p; i++)
+    if(fork() == 0)
+      worker(self);
+  for(i = 0; i < p; i++)
+    wait();
+  t = rdtscp() - t;
+  printf(1, "forkbench procs=%d n=%d total=%d per=%d\n",
+         p, p*NITER, (int)(t / 1000), (int)(t / (p*NITER)));
+}
+
+int
+main(int argc, char *argv[])
+{
+  static int procs[] = { 1, 2, 4, 8 };
+  int i;
+
+  if(argc > 1 && argv[1][0] == '-')
+    exit();
+  printf(1, "forkbench start\n");
+  for(i = 0; i < NELEM(procs); i++)
+    bench(argv[0], procs[i]);
+  printf(1, "forkbench done\n");
+  exit();
+}
@@ -0,0 +1,300 @@
+// ipcbench: IPC latency benchmarks.
+//
+// Times every iteration with rdtscp and prints one line per run:
+//   ipcbench test=<name> size=<bytes> eps=<endpoints> procs=<n>
+//            n=<samples> min=<c> p50=<c> p99=<c> max=<c>
+// with all figures in cycles.  Sweeps message size (register,
+// memory and page-mapped messages), the number of endpoints a
+// server multiplexes, and the number of processes sharing it.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "ipc.h"
+
+#define NSAMPLE 10000
+#define WARMUP  100
+#define PGSIZE  4096
+#define NELEM(x) (sizeof(x)/sizeof((x)[0]))
+
+static uint samples[NSAMPLE];
+
+static inline unsigned long long
+rdtscp(void)
+{
+  uint lo, hi;
+  asm volatile("rdtscp" : "=a" (lo), "=d" (hi) : : "rcx");
+  return ((unsigned long long)hi << 32) | lo;
+}
+
+static void
+sort(uint *a, int n)
+{
+  int gap, i, j;
+  uint t;
+
+  for(gap = n/2; gap > 0; gap /= 2){
+    for(i = gap; i < n; i++){
+      t = a[i];
+      for(j = i; j >= gap && a[j-gap] > t; j -= gap)
+        a[j] = a[j-gap];
+      a[j] = t;
+    }
+  }
+}
+
+static void
+report(char *test, int size, int eps, int procs)
+{
+  sort(samples, NSAMPLE);
+  printf(1, "ipcbench test=%s size=%d eps=%d procs=%d n=%d min=%d p50=%d p99=%d max=%d\n",
+         test, size, eps, procs, NSAMPLE, samples[0], samples[NSAMPLE/2],
+         samples[NSAMPLE*99/100], samples[NSAMPLE-1]);
+}
+
+static void
+null_bench(void)
+{
+  unsigned long long t;
+  int i;
+
+  for(i = -WARMUP; i < NSAMPLE; i++){
+    t = rdtscp();
+    null_call();
+    t = rdtscp() - t;
+    if(i >= 0)
+      samples[i] = t;
+  }
+  report("null_call", 0, 0, 1);
+}
+
+static void
+cr3_bench(void)
+{
+  unsigned long long t;
+  int i;
+
+  for(i = -WARMUP; i < NSAMPLE; i++){
+    t = rdtscp();
+    cr3_test();
+    t = rdtscp() - t;
+    if(i >= 0)
+      samples[i] = t;
+  }
+  report("cr3_reload", 0, 0, 1);
+
+  // The in-kernel loop can only be timed as a whole.
+  t = rdtscp();
+  cr3_kernel(NSAMPLE);
+  t = (rdtscp() - t) / NSAMPLE;
+  printf(1, "ipcbench test=cr3_kernel n=%d mean=%d\n", NSAMPLE, (int)t);
+}
+
+// The original symmetric benchmark: both sides in send_recv().
+static void
+send_recv_bench(void)
+{
+  struct msg m;
+  unsigned long long t;
+  int h, i;
+
+  h = ep_create();
+  if(fork() == 0){
+    recv(h, &m);
+    for(i = 1; i < WARMUP + NSAMPLE; i++)
+      send_recv(h, &m);
+    send(h, &m);
+    exit();
+  }
+  for(i = -WARMUP; i < NSAMPLE; i++){
+    t = rdtscp();
+    send_recv(h, &m);
+    t = rdtscp() - t;
+    if(i >= 0)
+      samples[i] = t;
+  }
+  wait();
+  ep_close(h);
+  report("send_recv", sizeof(m), 1, 2);
+}
+
+// Server answering calls on h until it gets a plain send.  With
+// pages set it unmaps the pages each call brings.
+static void
+server(int h, int pages)
+{
+  struct msg m;
+  int tok;
+
+  tok = recv(h, &m);
+  while(tok > 0){
+    if(pages){
+      ((char*)(uintp)m.regs[0])[0]++;
+      sbrk(-pages*PGSIZE);
+    }
+    m.regs[0]++;
+    tok = reply_recv(h, &m, tok);
+  }
+  exit();
+}
+
+// Time call() from one client while procs-2 other clients keep the
+// server busy.  kind selects how the message travels: 0 in memory,
+// -1 in registers, else as that many mapped pages.
+static void
+call_bench(char *test, int kind, int eps, int procs)
+{
+  struct msg m;
+  unsigned long long t;
+  int h[16], set, i, j, k, size;
+  char *buf;
+
+  set = ep_create();
+  h[0] = set;
+  for(i = 1; i < eps; i++){
+    h[i] = ep_create();
+    set_add(set, h[i]);
+  }
+  if(fork() == 0)
+    server(set, kind > 0 ? kind : 0);
+
+  buf = 0;
+  if(kind > 0){
+    buf = sbrk(0);
+    sbrk((PGSIZE - (uintp)buf % PGSIZE) % PGSIZE);
+    buf = sbrk(kind*PGSIZE);
+  }
+  size = kind > 0 ? kind*PGSIZE : sizeof(m);
+
+  for(k = 1; k < procs - 1; k++){
+    if(fork() == 0){
+      for(i = -WARMUP; i < NSAMPLE; i++)
+        call(h[((i + k) % eps + eps) % eps], &m);
+      exit();
+    }
+  }
+  for(i = -WARMUP; i < NSAMPLE; i++){
+    m.regs[0] = (uintp)buf;
+    m.regs[1] = kind > 0 ? kind : 0;
+    j = (i % eps + eps) % eps;   // i is negative while warming up
+    t = rdtscp();
+    if(kind == 0)
+      call(h[j], &m);
+    else if(kind < 0)
+      call_reg(h[j], &m);
+    else
+      sendx(h[j], &m, SX_MAP|SX_CALL);
+    t = rdtscp() - t;
+    if(i >= 0)
+      samples[i] = t;
+  }
+  for(k = 1; k < procs - 1; k++)
+    wait();
+  send(set, &m);
+  wait();
+  for(i = 0; i < eps; i++)
+    ep_close(h[i]);
+  if(kind > 0)
+    sbrk(-kind*PGSIZE);
+  report(test, size, eps, procs);
+}
+
+// Pipeline b calls per ipc_batch() entry; samples are per message.
+static void
+batch_bench(int b)
+{
+  static struct ipcop ops[IPC_MAXBATCH];
+  struct msg m;
+  unsigned long long t;
+  int h, i, j;
+
+  h = ep_create();
+  if(fork() == 0)
+    server(h, 0);
+  for(j = 0; j < b; j++){
+    ops[j].op = IPCOP_CALL;
+    ops[j].ch = h;
+  }
+  for(i = -WARMUP; i < NSAMPLE; i++){
+    t = rdtscp();
+    ipc_batch(ops, b);
+    t = (rdtscp() - t) / b;
+    if(i >= 0)
+      samples[i] = t;
+  }
+  send(h, &m);
+  wait();
+  ep_close(h);
+  report("call_batch", b*sizeof(m), 1, 2);
+}
+
+// Pass a message around n processes, each in its own address space;
+// samples are per hop.  Stays flat for as long as the TLB entries
+// of all n survive the switches between them.
+static void
+hop_bench(int n)
+{
+  struct msg m;
+  unsigned long long t;
+  int h[32], i, k;
+
+  for(i = 0; i < n; i++)
+    h[i] = ep_create();
+  for(k = 1; k < n; k++){
+    if(fork() == 0){
+      for(;;){
+        recv(h[k], &m);
+        send(h[(k + 1) % n], &m);
+        if(m.regs[0] == 0)
+          exit();
+      }
+    }
+  }
+  m.regs[0] = 1;
+  for(i = -WARMUP; i < NSAMPLE; i++){
+    t = rdtscp();
+    send(h[1], &m);
+    recv(h[0], &m);
+    t = (rdtscp() - t) / n;
+    if(i >= 0)
+      samples[i] = t;
+  }
+  m.regs[0] = 0;
+  send(h[1], &m);
+  recv(h[0], &m);
+  for(k = 1; k < n; k++)
+    wait();
+  for(i = 0; i < n; i++)
+    ep_close(h[i]);
+  report("hop", sizeof(m), 1, n);
+}
+
+int
+main(int argc, char *argv[])
+{
+  static int sizes[] = { 1, 4, 16 };
+  static int eps[] = { 1, 4, 16 };
+  static int procs[] = { 2, 3, 5 };
+  static int batch[] = { 1, 4, 16 };
+  static int hops[] = { 2, 8, 32 };
+  int i;
+
+  printf(1, "ipcbench start\n");
+  null_bench();
+  cr3_bench();
+  send_recv_bench();
+  call_bench("call", 0, 1, 2);
+  call_bench("call_reg", -1, 1, 2);
+  for(i = 0; i < NELEM(sizes); i++)
+    call_bench("call_map", sizes[i], 1, 2);
+  for(i = 0; i < NELEM(eps); i++)
+    call_bench("call_set", 0, eps[i], 2);
+  for(i = 0; i < NELEM(procs); i++)
+    call_bench("call_shared", 0, 1, procs[i]);
+  for(i = 0; i < NELEM(batch); i++)
+    batch_bench(batch[i]);
+  for(i = 0; i < NELEM(hops); i++)
+    hop_bench(hops[i]);
+  printf(1, "ipcbench done\n");
+  exit();
+}
@@ -0,0 +1,106 @@
+// tlbbench: cost of touching a working set after a CR3 switch.
+//
+// Touches n pages, switches page tables with cr3_switch(), then
+// times touching them again, for n from 1 to MAXPAGES and with
+// 4KB and 2MB mappings.  Prints one line per size:
+//   tlbbench map=<4k|2m> pages=<n> none=<c> preserve=<c> invalidate=<c>
+// giving median cycles per page with no switch, with a switch
+// that keeps our PCID's translations, and with one that drops them.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define MAXPAGES 4096
+#define REPS     200
+#define PGSIZE   4096
+#define HUGESZ   (2*1024*1024)
+
+enum { NONE, PRESERVE, INVALIDATE };
+
+static uint samples[REPS];
+
+static inline unsigned long long
+rdtscp(void)
+{
+  uint lo, hi;
+  asm volatile("rdtscp" : "=a" (lo), "=d" (hi) : : "rcx");
+  return ((unsigned long long)hi << 32) | lo;
+}
+
+// Read one word in each of the n pages at a.  Successive pages are
+// read at successive cache lines so the reads do not all compete
+// for one cache set.
+static void
+touch(volatile char *a, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    (void)a[i*PGSIZE + (i%64)*64];
+}
+
+static uint
+median(void)
+{
+  int i, j;
+  uint t;
+
+  for(i = 1; i < REPS; i++){
+    t = samples[i];
+    for(j = i; j > 0 && samples[j-1] > t; j--)
+      samples[j] = samples[j-1];
+    samples[j] = t;
+  }
+  return samples[REPS/2];
+}
+
+static uint
+measure(char *a, int n, int mode)
+{
+  unsigned long long t;
+  int i;
+
+  touch(a, n);
+  for(i = 0; i < REPS; i++){
+    if(mode != NONE)
+      cr3_switch(mode == INVALIDATE);
+    t = rdtscp();
+    touch(a, n);
+    samples[i] = (rdtscp() - t) / n;
+  }
+  return median();
+}
+
+static void
+run(char *map, int huge)
+{
+  char *brk, *a;
+  int n;
+
+  brk = sbrk(0);
+  sethuge(huge);
+  sbrk(HUGESZ - (uintp)brk % HUGESZ);
+  a = sbrk(MAXPAGES*PGSIZE);
+  sethuge(0);
+  if(a == (char*)-1){
+    printf(1, "tlbbench: sbrk failed\n");
+    exit();
+  }
+  memset(a, 1, MAXPAGES*PGSIZE);
+  for(n = 1; n <= MAXPAGES; n *= 2)
+    printf(1, "tlbbench map=%s pages=%d none=%d preserve=%d invalidate=%d\n",
+           map, n, measure(a, n, NONE), measure(a, n, PRESERVE),
+           measure(a, n, INVALIDATE));
+  sbrk(-(sbrk(0) - brk));
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "tlbbench start\n");
+  run("4k", 0);
+  run("2m", 1);
+  printf(1, "tlbbench done\n");
+  exit();
+}
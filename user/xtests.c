@@ -0,0 +1,665 @@
+// Tests for the IPC, huge page and vDSO extensions.  Kept apart from
+// usertests so that neither binary outgrows MAXFILE in mkfs.
+
+#include "param.h"
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "ipc.h"
+
+#define HUGESZ (2*1024*1024)
+
+char hugemsg[4096] __attribute__((aligned(4096)));
+int stdout = 1;
+
+void
+hugetest(void)
+{
+  struct msg m;
+  char *oldbrk, *a, *p;
+  int h, n, pid, va;
+
+  printf(stdout, "huge test\n");
+  oldbrk = sbrk(0);
+  n = sethuge(1);
+  sbrk(HUGESZ - (uintp)oldbrk % HUGESZ);
+  a = sbrk(2*HUGESZ);
+  if(a == (char*)-1){
+    printf(stdout, "huge sbrk failed\n");
+    exit();
+  }
+  if(n >= 2 && sethuge(1) != n - 2){
+    printf(stdout, "huge sbrk did not use the pool\n");
+    exit();
+  }
+  for(p = a; p < a + 2*HUGESZ; p += 4096)
+    *p = (p - a) / 4096;
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(p = a; p < a + 2*HUGESZ; p += 4096){
+      if(*p != (char)((p - a) / 4096)){
+        printf(stdout, "huge page not copied by fork\n");
+        exit();
+      }
+    }
+    exit();
+  }
+  wait();
+  // Shrinking into the first large page leaves it mapped.
+  sbrk(-(HUGESZ + 4096));
+  if(a[0] != 0 || a[4096] != 1){
+    printf(stdout, "huge page lost\n");
+    exit();
+  }
+  if(n >= 2 && sethuge(1) != n - 1){
+    printf(stdout, "huge page not returned to the pool\n");
+    exit();
+  }
+  // Pages mapped at the break now go past that large page.
+  h = ep_create();
+  if((va = ring_attach(h)) == -1 || sbrk(0) != (char*)(uintp)va + 4096){
+    printf(stdout, "huge ring_attach failed\n");
+    exit();
+  }
+  ((char*)(uintp)va)[0] = 1;
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    hugemsg[0] = 'h';
+    m.regs[0] = (uintp)hugemsg;
+    m.regs[1] = 1;
+    sendx(h, &m, SX_MAP);
+    exit();
+  }
+  if(recv(h, &m) < 0 || m.regs[0] < (uintp)va + 4096 ||
+     ((char*)(uintp)m.regs[0])[0] != 'h'){
+    printf(stdout, "huge sx_map receive failed\n");
+    exit();
+  }
+  wait();
+  ep_close(h);
+  sbrk(-(sbrk(0) - oldbrk));
+  if(sethuge(0) != n){
+    printf(stdout, "huge pool not refilled\n");
+    exit();
+  }
+  printf(stdout, "huge test ok\n");
+}
+
+// several servers answering call()s on one channel
+void
+ipctest(void)
+{
+  struct msg m;
+  int i, pid, tok;
+
+  printf(stdout, "ipc test\n");
+  if(ipc_affinity(NCPU, 0) != -1 || ipc_affinity(0, 100) != 0){
+    printf(stdout, "ipc_affinity failed\n");
+    exit();
+  }
+  if(setprio(NPRIO) != -1 || setprio(NPRIO/2) != 0){
+    printf(stdout, "setprio failed\n");
+    exit();
+  }
+  for(i = 0; i < 2; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      tok = recv(1, &m);
+      while(m.regs[0] != 0){
+        m.regs[0]++;
+        tok = reply_recv(1, &m, tok);
+      }
+      exit();
+    }
+  }
+
+  for(i = 1; i < 1000; i++){
+    m.regs[0] = i;
+    m.regs[7] = i;
+    if((i & 1) ? call_reg(1, &m) != 1 : call(1, &m) != 1){
+      printf(stdout, "ipc call %d failed\n", i);
+      exit();
+    }
+    if(m.regs[0] != i + 1 || m.regs[7] != i){
+      printf(stdout, "ipc call %d wrong reply\n", i);
+      exit();
+    }
+  }
+  m.regs[0] = 0;
+  send(1, &m);
+  send(1, &m);
+  wait();
+  wait();
+  ipc_affinity(-1, 0);
+  printf(stdout, "ipc test ok\n");
+}
+
+// A reply token answers only the call it came with, even when
+// the same client calls the same server again.
+void
+ipctokentest(void)
+{
+  struct msg m;
+  int h, pid, tok, old;
+
+  printf(stdout, "ipc token test\n");
+  h = ep_create();
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    old = recv(h, &m);
+    tok = reply_recv(h, &m, old);
+    if(tok <= 0 || tok == old || reply_recv(h, &m, old) != -1)
+      printf(stdout, "ipc stale reply token accepted\n");
+    reply_recv(h, &m, tok);
+    exit();
+  }
+  if(call(h, &m) != 1 || call(h, &m) != 1){
+    printf(stdout, "ipc token call failed\n");
+    exit();
+  }
+  send(h, &m);
+  wait();
+  ep_close(h);
+  printf(stdout, "ipc token test ok\n");
+}
+
+// Pages shared with SX_MAP and moved with SX_GRANT.
+void
+ipcgranttest(void)
+{
+  struct msg m;
+  char *a, *b;
+  int pid, tok;
+
+  printf(stdout, "ipc grant test\n");
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    tok = recv(2, &m);
+    b = (char*)m.regs[0];
+    if(b == 0 || m.regs[1] != 2 || b[0] != 'x' || b[4096] != 'y')
+      m.regs[1] = 0;
+    b[4096] = 'z';
+    tok = reply_recv(2, &m, tok);
+    b = (char*)m.regs[0];
+    if(b == 0 || m.regs[1] != 1 || b[0] != 'g')
+      m.regs[1] = 0;
+    reply_recv(2, &m, tok);
+    exit();
+  }
+
+  a = sbrk(0);
+  sbrk((4096 - (uintp)a % 4096) % 4096);
+  a = sbrk(3*4096);
+  a[0] = 'x';
+  a[4096] = 'y';
+  a[2*4096] = 'g';
+  m.regs[0] = (uintp)a;
+  m.regs[1] = 2;
+  if(sendx(2, &m, SX_MAP|SX_GRANT) != -1){
+    printf(stdout, "sendx with both map and grant succeeded\n");
+    exit();
+  }
+  if(sendx(2, &m, SX_MAP|SX_CALL) != 1 || m.regs[1] != 2 || a[4096] != 'z'){
+    printf(stdout, "ipc map failed\n");
+    exit();
+  }
+  m.regs[0] = (uintp)(a + 2*4096);
+  m.regs[1] = 1;
+  if(sendx(2, &m, SX_GRANT|SX_CALL) != 1 || m.regs[1] != 1){
+    printf(stdout, "ipc grant failed\n");
+    exit();
+  }
+  if(sbrk(0) != a + 2*4096){
+    printf(stdout, "ipc grant did not shrink sender\n");
+    exit();
+  }
+  send(2, &m);
+  wait();
+  printf(stdout, "ipc grant test ok\n");
+}
+
+// Stream messages through a ring shared across fork.
+void
+ipcringtest(void)
+{
+  struct ring *r;
+  struct msg m;
+  int i, pid, ok;
+
+  printf(stdout, "ipc ring test\n");
+  i = ring_attach(3);
+  if(i < 0){
+    printf(stdout, "ring_attach failed\n");
+    exit();
+  }
+  r = (struct ring*)(uintp)i;
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    ok = 0;
+    for(i = 0; i < 1000; i++){
+      if(ring_recv(3, r, &m) < 0)
+        break;
+      if(m.regs[0] == i && m.regs[7] == ~(unsigned long long)i)
+        ok++;
+    }
+    m.regs[0] = ok;
+    send(3, &m);
+    exit();
+  }
+
+  for(i = 0; i < 1000; i++){
+    m.regs[0] = i;
+    m.regs[7] = ~(unsigned long long)i;
+    while(ring_send(3, r, &m) < 0)
+      sleep(1);
+  }
+  if(recv(3, &m) < 0 || m.regs[0] != 1000){
+    printf(stdout, "ipc ring lost messages\n");
+    exit();
+  }
+  wait();
+  printf(stdout, "ipc ring test ok\n");
+}
+
+// A page mapped more times than its reference count holds
+// makes ring_attach, fork and sendx fail rather than the kernel.
+void
+ipcreftest(void)
+{
+  struct msg m;
+  int h, n, pid, va;
+
+  printf(stdout, "ipc ref test\n");
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    h = ep_create();
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      if(recv(h, &m) < 0 || m.regs[0] != 0 || m.regs[1] != 0)
+        printf(stdout, "ipc ref sx_map mapped past the limit\n");
+      exit();
+    }
+    va = ring_attach(h);
+    for(n = 1; n < 300; n++)
+      if(ring_attach(h) == -1)
+        break;
+    if(va == -1 || n == 300){
+      printf(stdout, "ipc ref ring_attach did not fail\n");
+      exit();
+    }
+    if((pid = fork()) == 0)
+      exit();
+    if(pid != -1){
+      printf(stdout, "ipc ref fork did not fail\n");
+      exit();
+    }
+    m.regs[0] = va;
+    m.regs[1] = 1;
+    if(sendx(h, &m, SX_MAP) != -1){
+      printf(stdout, "ipc ref sendx did not fail\n");
+      exit();
+    }
+    wait();
+    exit();
+  }
+  wait();
+  printf(stdout, "ipc ref test ok\n");
+}
+
+// Polling, timeouts, and kill() of a blocked receiver.
+void
+ipctimetest(void)
+{
+  struct msg m;
+  int pid;
+
+  printf(stdout, "ipc timeout test\n");
+  if(try_recv(4, &m) != IPC_WOULDBLOCK || try_send(4, &m) != IPC_WOULDBLOCK){
+    printf(stdout, "ipc poll blocked\n");
+    exit();
+  }
+  if(recv_timed(4, &m, 2) != IPC_TIMEOUT || send_timed(4, &m, 2) != IPC_TIMEOUT){
+    printf(stdout, "ipc timeout failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(;;)
+      recv(4, &m);
+  }
+  sleep(2);
+  if(kill(pid) < 0 || wait() != pid){
+    printf(stdout, "ipc kill failed\n");
+    exit();
+  }
+  if(try_send(4, &m) != IPC_WOULDBLOCK){
+    printf(stdout, "killed receiver still queued\n");
+    exit();
+  }
+  printf(stdout, "ipc timeout test ok\n");
+}
+
+// One receiver serving a set of channels with recv_any().
+void
+ipcsettest(void)
+{
+  struct msg m;
+  int i, ch, ok, pid;
+
+  printf(stdout, "ipc set test\n");
+  if(set_add(5, 6) < 0 || set_add(5, 7) < 0){
+    printf(stdout, "set_add failed\n");
+    exit();
+  }
+  if(set_add(6, 5) != -1 || set_add(8, 6) != -1){
+    printf(stdout, "set_add allowed nesting\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    ok = 0;
+    for(i = 0; i < 6; i++)
+      if(recv_any(5, &m, &ch) >= 0 && m.regs[0] == ch)
+        ok++;
+    m.regs[0] = ok;
+    send(8, &m);
+    exit();
+  }
+  for(i = 0; i < 6; i++){
+    m.regs[0] = 5 + i % 3;
+    send(m.regs[0], &m);
+  }
+  if(recv(8, &m) < 0 || m.regs[0] != 6){
+    printf(stdout, "recv_any got wrong channel\n");
+    exit();
+  }
+  wait();
+  if(set_del(6) < 0 || set_del(6) != -1 || set_del(7) < 0){
+    printf(stdout, "set_del failed\n");
+    exit();
+  }
+  printf(stdout, "ipc set test ok\n");
+}
+
+// Endpoints created at run time and named by per-process handles.
+void
+ipchandletest(void)
+{
+  struct msg m;
+  int i, h, pid, tok;
+  int hs[100];
+
+  printf(stdout, "ipc handle test\n");
+  for(i = 0; i < 100; i++){
+    if((hs[i] = ep_create()) < NENDS){
+      printf(stdout, "ep_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 100; i++)
+    ep_close(hs[i]);
+  h = ep_create();
+  if(h != hs[0]){
+    printf(stdout, "ep_create did not reuse handle\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    tok = recv(h, &m);
+    m.regs[0]++;
+    reply_recv(h, &m, tok);
+    exit();
+  }
+  m.regs[0] = 41;
+  if(call(h, &m) != 1 || m.regs[0] != 42){
+    printf(stdout, "ipc on created endpoint failed\n");
+    exit();
+  }
+  send(h, &m);
+  wait();
+  if(ep_close(h) < 0 || ep_close(h) != -1 || send(h, &m) != -1 ||
+     send(NHANDLE, &m) != -1){
+    printf(stdout, "ipc on closed handle succeeded\n");
+    exit();
+  }
+  printf(stdout, "ipc handle test ok\n");
+}
+
+void
+ipcbatchtest(void)
+{
+  struct ipcop ops[5];
+  struct msg m;
+  int i, h, pid, tok;
+
+  printf(stdout, "ipc batch test\n");
+  h = ep_create();
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    tok = recv(h, &m);
+    while(tok > 0){
+      m.regs[0]++;
+      tok = reply_recv(h, &m, tok);
+    }
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    ops[i].op = IPCOP_CALL;
+    ops[i].ch = h;
+    ops[i].m.regs[0] = 10*i;
+  }
+  ops[4].op = IPCOP_SEND;
+  ops[4].ch = h;
+  ops[4].arg = -1;
+  if(ipc_batch(ops, 5) != 5){
+    printf(stdout, "ipc_batch stopped early\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    if(ops[i].ret != 1 || ops[i].m.regs[0] != 10*i + 1){
+      printf(stdout, "ipc_batch call %d failed\n", i);
+      exit();
+    }
+  }
+  wait();
+  ops[0].op = IPCOP_SEND;
+  ops[0].arg = 0;
+  ops[1].op = 0;
+  if(ipc_batch(ops, 2) != 0 || ops[0].ret != IPC_WOULDBLOCK ||
+     ipc_batch(ops, IPC_MAXBATCH + 1) != -1){
+    printf(stdout, "ipc_batch error handling failed\n");
+    exit();
+  }
+  ep_close(h);
+  printf(stdout, "ipc batch test ok\n");
+}
+
+void
+ipcfdtest(void)
+{
+  struct msg m;
+  char buf[2];
+  int fds[2], h, h2, pid, tok, ok;
+
+  printf(stdout, "ipc fd test\n");
+  h = ep_create();
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    tok = recv(h, &m);
+    ok = (int)m.regs[SX_FDREG] >= 0 && read(m.regs[SX_FDREG], buf, 2) == 2 &&
+         buf[0] == 'h' && buf[1] == 'i';
+    h2 = m.regs[SX_EPREG];
+    m.regs[0] = ok;
+    reply_recv(h, &m, tok);
+    m.regs[0] = 99;
+    send(h2, &m);
+    exit();
+  }
+  // Open both after the fork so the child can only get them by IPC.
+  if(pipe(fds) != 0){
+    printf(stdout, "pipe failed\n");
+    exit();
+  }
+  h2 = ep_create();
+  write(fds[1], "hi", 2);
+  m.regs[SX_FDREG] = fds[0];
+  m.regs[SX_EPREG] = h2;
+  if(sendx(h, &m, SX_FD|SX_EP|SX_CALL) != 1 || m.regs[0] != 1){
+    printf(stdout, "ipc fd transfer failed\n");
+    exit();
+  }
+  send(h, &m);
+  if(recv(h2, &m) != 0 || m.regs[0] != 99){
+    printf(stdout, "ipc handle transfer failed\n");
+    exit();
+  }
+  wait();
+  m.regs[SX_FDREG] = NOFILE;
+  if(sendx(h, &m, SX_FD) != -1){
+    printf(stdout, "sendx of bad fd succeeded\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  ep_close(h2);
+  ep_close(h);
+  printf(stdout, "ipc fd test ok\n");
+}
+
+void
+vdsotest(void)
+{
+  int fds[2], pid, cpid, t;
+
+  printf(stdout, "vdso test\n");
+  if(pipe(fds) != 0){
+    printf(stdout, "pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    cpid = getpid();
+    write(fds[1], &cpid, sizeof(cpid));
+    exit();
+  }
+  if(read(fds[0], &cpid, sizeof(cpid)) != sizeof(cpid) || cpid != pid){
+    printf(stdout, "vdso getpid wrong in child\n");
+    exit();
+  }
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+  t = uptime();
+  sleep(2);
+  if(uptime() < t + 2){
+    printf(stdout, "vdso uptime did not advance\n");
+    exit();
+  }
+  printf(stdout, "vdso test ok\n");
+}
+
+// The kernel finds its per-CPU data through %fs; reloading it
+// from user space must not break system calls or traps.
+void
+fstest(void)
+{
+  int pid;
+
+  printf(stdout, "fs test\n");
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    asm volatile("movw %0, %%fs" : : "r" ((ushort)0));
+    write(stdout, "", 0);
+    asm volatile("movw %0, %%fs" : : "r" ((ushort)0));
+    if((pid = fork()) == 0)
+      exit();
+    wait();
+    exit();
+  }
+  wait();
+  printf(stdout, "fs test ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "xtests starting\n");
+
+  hugetest();
+  vdsotest();
+  fstest();
+  ipctest();
+  ipctokentest();
+  ipcgranttest();
+  ipcringtest();
+  ipcreftest();
+  ipctimetest();
+  ipcsettest();
+  ipchandletest();
+  ipcbatchtest();
+  ipcfdtest();
+
+  printf(1, "xtests passed\n");
+  exit();
+}